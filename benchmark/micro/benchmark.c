@@ -0,0 +1,2952 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by pbtools.
+ */
+
+#include <limits.h>
+#include "benchmark.h"
+
+#if CHAR_BIT != 8
+#    error "Number of bits in a char must be 8."
+#endif
+
+void benchmark_sub_message_init(
+    struct benchmark_sub_message_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->field1 = 0;
+    self_p->field2 = 0;
+    self_p->field3 = 0;
+    self_p->field15_p = "";
+    pbtools_bytes_init(&self_p->field12);
+    self_p->field13 = 0;
+    self_p->field14 = 0;
+    self_p->field21 = 0;
+    self_p->field22 = 0;
+    self_p->field206 = 0;
+    self_p->field203 = 0;
+    self_p->field204 = 0;
+    self_p->field205_p = "";
+    self_p->field207 = 0;
+    self_p->field300 = 0;
+}
+
+void benchmark_sub_message_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct benchmark_sub_message_t *self_p)
+{
+    pbtools_encoder_write_enum(encoder_p, 300, self_p->field300);
+    pbtools_encoder_write_uint64(encoder_p, 207, self_p->field207);
+    pbtools_encoder_write_string(encoder_p, 205, self_p->field205_p);
+    pbtools_encoder_write_int32(encoder_p, 204, self_p->field204);
+    pbtools_encoder_write_fixed32(encoder_p, 203, self_p->field203);
+    pbtools_encoder_write_bool(encoder_p, 206, self_p->field206);
+    pbtools_encoder_write_int32(encoder_p, 22, self_p->field22);
+    pbtools_encoder_write_fixed64(encoder_p, 21, self_p->field21);
+    pbtools_encoder_write_int64(encoder_p, 14, self_p->field14);
+    pbtools_encoder_write_int64(encoder_p, 13, self_p->field13);
+    pbtools_encoder_write_bytes(encoder_p, 12, &self_p->field12);
+    pbtools_encoder_write_string(encoder_p, 15, self_p->field15_p);
+    pbtools_encoder_write_int32(encoder_p, 3, self_p->field3);
+    pbtools_encoder_write_uint32(encoder_p, 2, self_p->field2);
+    pbtools_encoder_write_uint32(encoder_p, 1, self_p->field1);
+}
+
+static const uint32_t benchmark_sub_message_keys[16] = {
+    PBTOOLS_KEY(300, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(204, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(13, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(21, PBTOOLS_WIRE_TYPE_64_BIT),
+    0,
+    PBTOOLS_KEY(206, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(14, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(22, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(207, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(12, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(15, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(205, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(203, PBTOOLS_WIRE_TYPE_32_BIT)
+};
+
+static const uint8_t benchmark_sub_message_displacements[8] = {
+    1, 2, 5, 7, 0, 11, 0, 1
+};
+
+void benchmark_sub_message_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_sub_message_t *self_p)
+{
+    uint32_t key;
+    uint32_t hash;
+    uint32_t slot;
+    int wire_type;
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+        hash = (key * 0x7d99c885u);
+        slot = (((hash >> 25) & 0xf)
+                ^ benchmark_sub_message_displacements[hash >> 29]);
+
+        if (benchmark_sub_message_keys[slot] != key) {
+            slot = 16;
+        }
+
+        switch (slot) {
+
+        case 7:
+            self_p->field1 = pbtools_decoder_read_uint32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
+
+            break;
+
+        case 12:
+        field_2:
+            self_p->field2 = pbtools_decoder_read_uint32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_3;
+            }
+
+            break;
+
+        case 3:
+        field_3:
+            self_p->field3 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  15,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_15;
+            }
+
+            break;
+
+        case 13:
+        field_15:
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->field15_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  12,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_12;
+            }
+
+            break;
+
+        case 11:
+        field_12:
+            pbtools_decoder_read_bytes_unchecked(decoder_p, &self_p->field12);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  13,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_13;
+            }
+
+            break;
+
+        case 2:
+        field_13:
+            self_p->field13 = pbtools_decoder_read_int64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  14,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_14;
+            }
+
+            break;
+
+        case 8:
+        field_14:
+            self_p->field14 = pbtools_decoder_read_int64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  21,
+                                                  PBTOOLS_WIRE_TYPE_64_BIT)) {
+                goto field_21;
+            }
+
+            break;
+
+        case 4:
+        field_21:
+            self_p->field21 = pbtools_decoder_read_fixed64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  22,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_22;
+            }
+
+            break;
+
+        case 9:
+        field_22:
+            self_p->field22 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  206,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_206;
+            }
+
+            break;
+
+        case 6:
+        field_206:
+            self_p->field206 = pbtools_decoder_read_bool_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  203,
+                                                  PBTOOLS_WIRE_TYPE_32_BIT)) {
+                goto field_203;
+            }
+
+            break;
+
+        case 15:
+        field_203:
+            self_p->field203 = pbtools_decoder_read_fixed32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  204,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_204;
+            }
+
+            break;
+
+        case 1:
+        field_204:
+            self_p->field204 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  205,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_205;
+            }
+
+            break;
+
+        case 14:
+        field_205:
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->field205_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  207,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_207;
+            }
+
+            break;
+
+        case 10:
+        field_207:
+            self_p->field207 = pbtools_decoder_read_uint64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  300,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_300;
+            }
+
+            break;
+
+        case 0:
+        field_300:
+            self_p->field300 = pbtools_decoder_read_enum_unchecked(decoder_p);
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 12:
+            case 13:
+            case 14:
+            case 15:
+            case 21:
+            case 22:
+            case 203:
+            case 204:
+            case 205:
+            case 206:
+            case 207:
+            case 300:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+}
+
+void benchmark_sub_message_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct benchmark_sub_message_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        benchmark_sub_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void benchmark_sub_message_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct benchmark_sub_message_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct benchmark_sub_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        benchmark_sub_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        benchmark_sub_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t benchmark_sub_message_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 15, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 12, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 13, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 14, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 21, PBTOOLS_WIRE_TYPE_64_BIT, false },
+    { 22, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 206, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 203, PBTOOLS_WIRE_TYPE_32_BIT, false },
+    { 204, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 205, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 207, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 300, PBTOOLS_WIRE_TYPE_VARINT, false }
+};
+
+void benchmark_sub_message_view_init(
+    struct benchmark_sub_message_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &benchmark_sub_message_view_fields[0],
+                      15,
+                      &self_p->offsets[0]);
+}
+
+int benchmark_sub_message_view_error(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+uint32_t benchmark_sub_message_view_get_field1(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 0, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_uint32_unchecked(&decoder));
+}
+
+uint32_t benchmark_sub_message_view_get_field2(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 1, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_uint32_unchecked(&decoder));
+}
+
+int32_t benchmark_sub_message_view_get_field3(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 2, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+struct pbtools_bytes_t benchmark_sub_message_view_get_field15(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+
+    value.buf_p = NULL;
+    value.size = 0;
+
+    if (pbtools_view_seek(&self_p->base, 3, &decoder)) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    return (value);
+}
+
+struct pbtools_bytes_t benchmark_sub_message_view_get_field12(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+
+    value.buf_p = NULL;
+    value.size = 0;
+
+    if (pbtools_view_seek(&self_p->base, 4, &decoder)) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    return (value);
+}
+
+int64_t benchmark_sub_message_view_get_field13(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 5, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int64_unchecked(&decoder));
+}
+
+int64_t benchmark_sub_message_view_get_field14(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 6, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int64_unchecked(&decoder));
+}
+
+uint64_t benchmark_sub_message_view_get_field21(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 7, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_fixed64_unchecked(&decoder));
+}
+
+int32_t benchmark_sub_message_view_get_field22(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 8, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+bool benchmark_sub_message_view_get_field206(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 9, &decoder)) {
+        return (false);
+    }
+
+    return (pbtools_decoder_read_bool_unchecked(&decoder));
+}
+
+uint32_t benchmark_sub_message_view_get_field203(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 10, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_fixed32_unchecked(&decoder));
+}
+
+int32_t benchmark_sub_message_view_get_field204(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 11, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+struct pbtools_bytes_t benchmark_sub_message_view_get_field205(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+
+    value.buf_p = NULL;
+    value.size = 0;
+
+    if (pbtools_view_seek(&self_p->base, 12, &decoder)) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    return (value);
+}
+
+uint64_t benchmark_sub_message_view_get_field207(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 13, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_uint64_unchecked(&decoder));
+}
+
+enum benchmark_enum_e benchmark_sub_message_view_get_field300(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 14, &decoder)) {
+        return ((enum benchmark_enum_e)0);
+    }
+
+    return ((enum benchmark_enum_e)pbtools_decoder_read_enum_unchecked(&decoder));
+}
+
+struct benchmark_sub_message_t *
+benchmark_sub_message_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct benchmark_sub_message_t),
+                (pbtools_message_init_t)benchmark_sub_message_init));
+}
+
+int benchmark_sub_message_encode(
+    struct benchmark_sub_message_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)benchmark_sub_message_encode_inner));
+}
+
+int benchmark_sub_message_decode(
+    struct benchmark_sub_message_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)benchmark_sub_message_decode_inner));
+}
+
+int benchmark_sub_message_decode_padded(
+    struct benchmark_sub_message_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode_padded(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)benchmark_sub_message_decode_inner));
+}
+
+int benchmark_sub_message_decode_segments(
+    struct benchmark_sub_message_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)benchmark_sub_message_decode_inner));
+}
+
+void benchmark_message1_init(
+    struct benchmark_message1_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->field80 = 0;
+    self_p->field81 = 0;
+    self_p->field2 = 0;
+    self_p->field3 = 0;
+    self_p->field280 = 0;
+    self_p->field6 = 0;
+    self_p->field22 = 0;
+    self_p->field4.length = 0;
+    self_p->field59 = 0;
+    self_p->field16 = 0;
+    self_p->field150 = 0;
+    self_p->field23 = 0;
+    self_p->field24 = 0;
+    self_p->field25 = 0;
+    self_p->field15_p = NULL;
+    self_p->field78 = 0;
+    self_p->field67 = 0;
+    self_p->field68 = 0;
+    self_p->field128 = 0;
+    self_p->field129_p = "";
+    self_p->field131 = 0;
+}
+
+void benchmark_message1_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct benchmark_message1_t *self_p)
+{
+    pbtools_encoder_write_int32(encoder_p, 131, self_p->field131);
+    pbtools_encoder_write_string(encoder_p, 129, self_p->field129_p);
+    pbtools_encoder_write_int32(encoder_p, 128, self_p->field128);
+    pbtools_encoder_write_int32(encoder_p, 68, self_p->field68);
+    pbtools_encoder_write_int32(encoder_p, 67, self_p->field67);
+    pbtools_encoder_write_bool(encoder_p, 78, self_p->field78);
+    pbtools_encoder_sub_message_encode(
+        encoder_p,
+        15,
+        (struct pbtools_message_base_t *)self_p->field15_p,
+        (pbtools_message_encode_inner_t)benchmark_sub_message_encode_inner);
+    pbtools_encoder_write_int32(encoder_p, 25, self_p->field25);
+    pbtools_encoder_write_bool(encoder_p, 24, self_p->field24);
+    pbtools_encoder_write_int32(encoder_p, 23, self_p->field23);
+    pbtools_encoder_write_int32(encoder_p, 150, self_p->field150);
+    pbtools_encoder_write_int32(encoder_p, 16, self_p->field16);
+    pbtools_encoder_write_bool(encoder_p, 59, self_p->field59);
+    pbtools_encoder_write_repeated_string(encoder_p, 4, &self_p->field4);
+    pbtools_encoder_write_int64(encoder_p, 22, self_p->field22);
+    pbtools_encoder_write_int32(encoder_p, 6, self_p->field6);
+    pbtools_encoder_write_int32(encoder_p, 280, self_p->field280);
+    pbtools_encoder_write_int32(encoder_p, 3, self_p->field3);
+    pbtools_encoder_write_int32(encoder_p, 2, self_p->field2);
+    pbtools_encoder_write_bool(encoder_p, 81, self_p->field81);
+    pbtools_encoder_write_bool(encoder_p, 80, self_p->field80);
+}
+
+static const uint32_t benchmark_message1_keys[32] = {
+    PBTOOLS_KEY(67, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    0,
+    0,
+    PBTOOLS_KEY(22, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(131, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(150, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(68, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(280, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(59, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(15, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(78, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(23, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    0,
+    0,
+    PBTOOLS_KEY(24, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(80, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(25, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(16, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(81, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(129, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    0,
+    PBTOOLS_KEY(128, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    0,
+    0,
+    0
+};
+
+static const uint8_t benchmark_message1_displacements[16] = {
+    1, 0, 0, 2, 8, 0, 1, 0,
+    0, 0, 0, 0, 8, 0, 3, 0
+};
+
+void benchmark_message1_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message1_t *self_p)
+{
+    uint32_t key;
+    uint32_t hash;
+    uint32_t slot;
+    int wire_type;
+    struct pbtools_repeated_info_t repeated_info_field4;
+
+    pbtools_repeated_info_init(&repeated_info_field4, 4);
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+        hash = (key * 0x9e3779b1u);
+        slot = (((hash >> 23) & 0x1f)
+                ^ benchmark_message1_displacements[hash >> 28]);
+
+        if (benchmark_message1_keys[slot] != key) {
+            slot = 32;
+        }
+
+        switch (slot) {
+
+        case 21:
+            self_p->field80 = pbtools_decoder_read_bool_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  81,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_81;
+            }
+
+            break;
+
+        case 24:
+        field_81:
+            self_p->field81 = pbtools_decoder_read_bool_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
+
+            break;
+
+        case 5:
+        field_2:
+            self_p->field2 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_3;
+            }
+
+            break;
+
+        case 10:
+        field_3:
+            self_p->field3 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  280,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_280;
+            }
+
+            break;
+
+        case 11:
+        field_280:
+            self_p->field280 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  6,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_6;
+            }
+
+            break;
+
+        case 20:
+        field_6:
+            self_p->field6 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  22,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_22;
+            }
+
+            break;
+
+        case 4:
+        field_22:
+            self_p->field22 = pbtools_decoder_read_int64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_4;
+            }
+
+            break;
+
+        case 7:
+        field_4:
+            pbtools_repeated_info_decode_string(
+                &repeated_info_field4,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_4;
+            }
+
+            break;
+
+        case 12:
+            self_p->field59 = pbtools_decoder_read_bool_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  16,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_16;
+            }
+
+            break;
+
+        case 23:
+        field_16:
+            self_p->field16 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  150,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_150;
+            }
+
+            break;
+
+        case 8:
+        field_150:
+            self_p->field150 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  23,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_23;
+            }
+
+            break;
+
+        case 15:
+        field_23:
+            self_p->field23 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  24,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_24;
+            }
+
+            break;
+
+        case 19:
+        field_24:
+            self_p->field24 = pbtools_decoder_read_bool_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  25,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_25;
+            }
+
+            break;
+
+        case 22:
+        field_25:
+            self_p->field25 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  15,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_15;
+            }
+
+            break;
+
+        case 13:
+        field_15:
+            pbtools_decoder_sub_message_decode_unchecked(
+                decoder_p,
+                (struct pbtools_message_base_t **)&self_p->field15_p,
+                sizeof(struct benchmark_sub_message_t),
+                (pbtools_message_init_t)benchmark_sub_message_init,
+                (pbtools_message_decode_inner_t)benchmark_sub_message_decode_inner);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  78,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_78;
+            }
+
+            break;
+
+        case 14:
+        field_78:
+            self_p->field78 = pbtools_decoder_read_bool_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  67,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_67;
+            }
+
+            break;
+
+        case 0:
+        field_67:
+            self_p->field67 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  68,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_68;
+            }
+
+            break;
+
+        case 9:
+        field_68:
+            self_p->field68 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  128,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_128;
+            }
+
+            break;
+
+        case 27:
+        field_128:
+            self_p->field128 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  129,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_129;
+            }
+
+            break;
+
+        case 25:
+        field_129:
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->field129_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  131,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_131;
+            }
+
+            break;
+
+        case 6:
+        field_131:
+            self_p->field131 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 2:
+            case 3:
+            case 4:
+            case 6:
+            case 15:
+            case 16:
+            case 22:
+            case 23:
+            case 24:
+            case 25:
+            case 59:
+            case 67:
+            case 68:
+            case 78:
+            case 80:
+            case 81:
+            case 128:
+            case 129:
+            case 131:
+            case 150:
+            case 280:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+
+    pbtools_decoder_decode_repeated_string(
+        decoder_p,
+        &repeated_info_field4,
+        &self_p->field4);
+}
+
+int benchmark_message1_field15_alloc(
+    struct benchmark_message1_t *self_p)
+{
+    return (pbtools_sub_message_alloc(
+                (struct pbtools_message_base_t **)&self_p->field15_p,
+                self_p->base.heap_p,
+                sizeof(struct benchmark_sub_message_t),
+                (pbtools_message_init_t)benchmark_sub_message_init));
+}
+
+int benchmark_message1_field4_alloc(
+    struct benchmark_message1_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_string(
+                &self_p->base,
+                length,
+                &self_p->field4));
+}
+
+void benchmark_message1_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct benchmark_message1_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        benchmark_message1_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void benchmark_message1_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct benchmark_message1_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct benchmark_message1_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        benchmark_message1_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        benchmark_message1_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t benchmark_message1_view_fields[] = {
+    { 80, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 81, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 280, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 22, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, true },
+    { 59, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 16, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 150, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 23, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 24, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 25, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 15, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 78, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 67, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 68, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 128, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 129, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 131, PBTOOLS_WIRE_TYPE_VARINT, false }
+};
+
+void benchmark_message1_view_init(
+    struct benchmark_message1_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &benchmark_message1_view_fields[0],
+                      21,
+                      &self_p->offsets[0]);
+}
+
+int benchmark_message1_view_error(
+    struct benchmark_message1_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+bool benchmark_message1_view_get_field80(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 0, &decoder)) {
+        return (false);
+    }
+
+    return (pbtools_decoder_read_bool_unchecked(&decoder));
+}
+
+bool benchmark_message1_view_get_field81(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 1, &decoder)) {
+        return (false);
+    }
+
+    return (pbtools_decoder_read_bool_unchecked(&decoder));
+}
+
+int32_t benchmark_message1_view_get_field2(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 2, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t benchmark_message1_view_get_field3(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 3, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t benchmark_message1_view_get_field280(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 4, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t benchmark_message1_view_get_field6(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 5, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int64_t benchmark_message1_view_get_field22(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 6, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int64_unchecked(&decoder));
+}
+
+void benchmark_message1_view_field4_begin(
+    struct benchmark_message1_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 7);
+}
+
+bool benchmark_message1_view_field4_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct pbtools_bytes_t *value_p)
+{{
+    if (!pbtools_view_iterator_next(iterator_p)) {{
+        return (false);
+    }}
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, value_p);
+
+    return (true);
+}}
+
+bool benchmark_message1_view_get_field59(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 8, &decoder)) {
+        return (false);
+    }
+
+    return (pbtools_decoder_read_bool_unchecked(&decoder));
+}
+
+int32_t benchmark_message1_view_get_field16(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 9, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t benchmark_message1_view_get_field150(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 10, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t benchmark_message1_view_get_field23(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 11, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+bool benchmark_message1_view_get_field24(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 12, &decoder)) {
+        return (false);
+    }
+
+    return (pbtools_decoder_read_bool_unchecked(&decoder));
+}
+
+int32_t benchmark_message1_view_get_field25(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 13, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+bool benchmark_message1_view_get_field15(
+    struct benchmark_message1_view_t *self_p,
+    struct benchmark_sub_message_view_t *value_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+    bool found;
+
+    value.buf_p = NULL;
+    value.size = 0;
+    found = pbtools_view_seek(&self_p->base, 14, &decoder);
+
+    if (found) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    benchmark_sub_message_view_init(value_p, value.buf_p, value.size);
+
+    return (found);
+}
+
+bool benchmark_message1_view_get_field78(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 15, &decoder)) {
+        return (false);
+    }
+
+    return (pbtools_decoder_read_bool_unchecked(&decoder));
+}
+
+int32_t benchmark_message1_view_get_field67(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 16, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t benchmark_message1_view_get_field68(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 17, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t benchmark_message1_view_get_field128(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 18, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+struct pbtools_bytes_t benchmark_message1_view_get_field129(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+
+    value.buf_p = NULL;
+    value.size = 0;
+
+    if (pbtools_view_seek(&self_p->base, 19, &decoder)) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    return (value);
+}
+
+int32_t benchmark_message1_view_get_field131(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 20, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+struct benchmark_message1_t *
+benchmark_message1_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct benchmark_message1_t),
+                (pbtools_message_init_t)benchmark_message1_init));
+}
+
+int benchmark_message1_encode(
+    struct benchmark_message1_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)benchmark_message1_encode_inner));
+}
+
+int benchmark_message1_decode(
+    struct benchmark_message1_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)benchmark_message1_decode_inner));
+}
+
+int benchmark_message1_decode_padded(
+    struct benchmark_message1_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode_padded(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)benchmark_message1_decode_inner));
+}
+
+int benchmark_message1_decode_segments(
+    struct benchmark_message1_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)benchmark_message1_decode_inner));
+}
+
+void benchmark_message2_init(
+    struct benchmark_message2_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->field1 = 0;
+    self_p->field2 = 0;
+    self_p->field3 = 0;
+    self_p->field4_p = "";
+    self_p->field5 = 0;
+    self_p->field6 = 0;
+}
+
+void benchmark_message2_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct benchmark_message2_t *self_p)
+{
+    pbtools_encoder_write_bool(encoder_p, 6, self_p->field6);
+    pbtools_encoder_write_int32(encoder_p, 5, self_p->field5);
+    pbtools_encoder_write_string(encoder_p, 4, self_p->field4_p);
+    pbtools_encoder_write_sint32(encoder_p, 3, self_p->field3);
+    pbtools_encoder_write_uint64(encoder_p, 2, self_p->field2);
+    pbtools_encoder_write_enum(encoder_p, 1, self_p->field1);
+}
+
+void benchmark_message2_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message2_t *self_p)
+{
+    uint32_t key;
+    int wire_type;
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->field1 = pbtools_decoder_read_enum_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
+        field_2:
+            self_p->field2 = pbtools_decoder_read_uint64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_3;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_VARINT):
+        field_3:
+            self_p->field3 = pbtools_decoder_read_sint32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_4;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_4:
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->field4_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  5,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_5;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_VARINT):
+        field_5:
+            self_p->field5 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  6,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_6;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_VARINT):
+        field_6:
+            self_p->field6 = pbtools_decoder_read_bool_unchecked(decoder_p);
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+}
+
+void benchmark_message2_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct benchmark_message2_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        benchmark_message2_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void benchmark_message2_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct benchmark_message2_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct benchmark_message2_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        benchmark_message2_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        benchmark_message2_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t benchmark_message2_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 5, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6, PBTOOLS_WIRE_TYPE_VARINT, false }
+};
+
+void benchmark_message2_view_init(
+    struct benchmark_message2_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &benchmark_message2_view_fields[0],
+                      6,
+                      &self_p->offsets[0]);
+}
+
+int benchmark_message2_view_error(
+    struct benchmark_message2_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+enum benchmark_enum_e benchmark_message2_view_get_field1(
+    struct benchmark_message2_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 0, &decoder)) {
+        return ((enum benchmark_enum_e)0);
+    }
+
+    return ((enum benchmark_enum_e)pbtools_decoder_read_enum_unchecked(&decoder));
+}
+
+uint64_t benchmark_message2_view_get_field2(
+    struct benchmark_message2_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 1, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_uint64_unchecked(&decoder));
+}
+
+int32_t benchmark_message2_view_get_field3(
+    struct benchmark_message2_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 2, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_sint32_unchecked(&decoder));
+}
+
+struct pbtools_bytes_t benchmark_message2_view_get_field4(
+    struct benchmark_message2_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+
+    value.buf_p = NULL;
+    value.size = 0;
+
+    if (pbtools_view_seek(&self_p->base, 3, &decoder)) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    return (value);
+}
+
+int32_t benchmark_message2_view_get_field5(
+    struct benchmark_message2_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 4, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+bool benchmark_message2_view_get_field6(
+    struct benchmark_message2_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 5, &decoder)) {
+        return (false);
+    }
+
+    return (pbtools_decoder_read_bool_unchecked(&decoder));
+}
+
+struct benchmark_message2_t *
+benchmark_message2_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct benchmark_message2_t),
+                (pbtools_message_init_t)benchmark_message2_init));
+}
+
+int benchmark_message2_encode(
+    struct benchmark_message2_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)benchmark_message2_encode_inner));
+}
+
+int benchmark_message2_decode(
+    struct benchmark_message2_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)benchmark_message2_decode_inner));
+}
+
+int benchmark_message2_decode_padded(
+    struct benchmark_message2_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode_padded(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)benchmark_message2_decode_inner));
+}
+
+int benchmark_message2_decode_segments(
+    struct benchmark_message2_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)benchmark_message2_decode_inner));
+}
+
+void benchmark_message3_sub_message_init(
+    struct benchmark_message3_sub_message_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->field28 = 0;
+    self_p->field2 = 0;
+    self_p->field12 = 0;
+    self_p->field19_p = "";
+    self_p->field11 = 0;
+}
+
+void benchmark_message3_sub_message_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct benchmark_message3_sub_message_t *self_p)
+{
+    pbtools_encoder_write_int32(encoder_p, 11, self_p->field11);
+    pbtools_encoder_write_string(encoder_p, 19, self_p->field19_p);
+    pbtools_encoder_write_int32(encoder_p, 12, self_p->field12);
+    pbtools_encoder_write_int64(encoder_p, 2, self_p->field2);
+    pbtools_encoder_write_int32(encoder_p, 28, self_p->field28);
+}
+
+static const uint32_t benchmark_message3_sub_message_keys[8] = {
+    0,
+    0,
+    PBTOOLS_KEY(12, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    PBTOOLS_KEY(11, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(19, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(28, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT)
+};
+
+static const uint8_t benchmark_message3_sub_message_displacements[4] = {
+    0, 0, 0, 3
+};
+
+void benchmark_message3_sub_message_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message3_sub_message_t *self_p)
+{
+    uint32_t key;
+    uint32_t hash;
+    uint32_t slot;
+    int wire_type;
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+        hash = (key * 0x9e3779b1u);
+        slot = (((hash >> 27) & 0x7)
+                ^ benchmark_message3_sub_message_displacements[hash >> 30]);
+
+        if (benchmark_message3_sub_message_keys[slot] != key) {
+            slot = 8;
+        }
+
+        switch (slot) {
+
+        case 6:
+            self_p->field28 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
+
+            break;
+
+        case 7:
+        field_2:
+            self_p->field2 = pbtools_decoder_read_int64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  12,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_12;
+            }
+
+            break;
+
+        case 2:
+        field_12:
+            self_p->field12 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  19,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_19;
+            }
+
+            break;
+
+        case 5:
+        field_19:
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->field19_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  11,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_11;
+            }
+
+            break;
+
+        case 4:
+        field_11:
+            self_p->field11 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 2:
+            case 11:
+            case 12:
+            case 19:
+            case 28:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+}
+
+void benchmark_message3_sub_message_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct benchmark_message3_sub_message_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        benchmark_message3_sub_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void benchmark_message3_sub_message_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct benchmark_message3_sub_message_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct benchmark_message3_sub_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        benchmark_message3_sub_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        benchmark_message3_sub_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t benchmark_message3_sub_message_view_fields[] = {
+    { 28, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 12, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 19, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 11, PBTOOLS_WIRE_TYPE_VARINT, false }
+};
+
+void benchmark_message3_sub_message_view_init(
+    struct benchmark_message3_sub_message_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &benchmark_message3_sub_message_view_fields[0],
+                      5,
+                      &self_p->offsets[0]);
+}
+
+int benchmark_message3_sub_message_view_error(
+    struct benchmark_message3_sub_message_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+int32_t benchmark_message3_sub_message_view_get_field28(
+    struct benchmark_message3_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 0, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int64_t benchmark_message3_sub_message_view_get_field2(
+    struct benchmark_message3_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 1, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int64_unchecked(&decoder));
+}
+
+int32_t benchmark_message3_sub_message_view_get_field12(
+    struct benchmark_message3_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 2, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+struct pbtools_bytes_t benchmark_message3_sub_message_view_get_field19(
+    struct benchmark_message3_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+
+    value.buf_p = NULL;
+    value.size = 0;
+
+    if (pbtools_view_seek(&self_p->base, 3, &decoder)) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    return (value);
+}
+
+int32_t benchmark_message3_sub_message_view_get_field11(
+    struct benchmark_message3_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 4, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+void benchmark_message3_init(
+    struct benchmark_message3_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->field13.length = 0;
+}
+
+void benchmark_message3_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct benchmark_message3_t *self_p)
+{
+    benchmark_message3_sub_message_encode_repeated_inner(
+        encoder_p,
+        13,
+        &self_p->field13);
+}
+
+void benchmark_message3_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message3_t *self_p)
+{
+    uint32_t key;
+    int wire_type;
+    struct pbtools_repeated_info_t repeated_info_field13;
+
+    pbtools_repeated_info_init(&repeated_info_field13, 13);
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(13, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_13:
+            pbtools_repeated_info_decode(&repeated_info_field13,
+                                         decoder_p,
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  13,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_13;
+            }
+
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 13:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+
+    benchmark_message3_sub_message_decode_repeated_inner(
+        decoder_p,
+        &repeated_info_field13,
+        &self_p->field13);
+}
+
+int benchmark_message3_field13_alloc(
+    struct benchmark_message3_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated(
+                (struct pbtools_repeated_message_t *)&self_p->field13,
+                length,
+                self_p->base.heap_p,
+                sizeof(struct benchmark_message3_sub_message_t),
+                (pbtools_message_init_t)benchmark_message3_sub_message_init));
+}
+
+void benchmark_message3_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct benchmark_message3_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        benchmark_message3_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void benchmark_message3_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct benchmark_message3_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct benchmark_message3_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        benchmark_message3_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        benchmark_message3_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t benchmark_message3_view_fields[] = {
+    { 13, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, true }
+};
+
+void benchmark_message3_view_init(
+    struct benchmark_message3_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &benchmark_message3_view_fields[0],
+                      1,
+                      &self_p->offsets[0]);
+}
+
+int benchmark_message3_view_error(
+    struct benchmark_message3_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+void benchmark_message3_view_field13_begin(
+    struct benchmark_message3_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 0);
+}
+
+bool benchmark_message3_view_field13_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct benchmark_message3_sub_message_view_t *value_p)
+{
+    struct pbtools_bytes_t value;
+
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, &value);
+    benchmark_message3_sub_message_view_init(value_p, value.buf_p, value.size);
+
+    return (true);
+}
+
+struct benchmark_message3_t *
+benchmark_message3_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct benchmark_message3_t),
+                (pbtools_message_init_t)benchmark_message3_init));
+}
+
+int benchmark_message3_encode(
+    struct benchmark_message3_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)benchmark_message3_encode_inner));
+}
+
+int benchmark_message3_decode(
+    struct benchmark_message3_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)benchmark_message3_decode_inner));
+}
+
+int benchmark_message3_decode_padded(
+    struct benchmark_message3_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode_padded(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)benchmark_message3_decode_inner));
+}
+
+int benchmark_message3_decode_segments(
+    struct benchmark_message3_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)benchmark_message3_decode_inner));
+}
+
+static void benchmark_message3_sub_message_columns_alloc(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message3_sub_message_columns_t *columns_p,
+    int length)
+{
+    columns_p->length = length;
+    columns_p->field28.values_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        length,
+        sizeof(int32_t));
+    columns_p->field28.present_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        (length + 7) / 8,
+        sizeof(uint8_t));
+    columns_p->field2.values_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        length,
+        sizeof(int64_t));
+    columns_p->field2.present_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        (length + 7) / 8,
+        sizeof(uint8_t));
+    columns_p->field12.values_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        length,
+        sizeof(int32_t));
+    columns_p->field12.present_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        (length + 7) / 8,
+        sizeof(uint8_t));
+    columns_p->field11.values_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        length,
+        sizeof(int32_t));
+    columns_p->field11.present_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        (length + 7) / 8,
+        sizeof(uint8_t));
+}
+
+static void benchmark_message3_sub_message_decode_columns_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message3_sub_message_columns_t *columns_p,
+    int index)
+{
+    uint32_t key;
+    int wire_type;
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(28, PBTOOLS_WIRE_TYPE_VARINT):
+            columns_p->field28.values_p[index] = pbtools_decoder_read_int32_unchecked(decoder_p);
+            columns_p->field28.present_p[index / 8] |= (uint8_t)(1u << (index % 8));
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
+        field_2:
+            columns_p->field2.values_p[index] = pbtools_decoder_read_int64_unchecked(decoder_p);
+            columns_p->field2.present_p[index / 8] |= (uint8_t)(1u << (index % 8));
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  12,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_12;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(12, PBTOOLS_WIRE_TYPE_VARINT):
+        field_12:
+            columns_p->field12.values_p[index] = pbtools_decoder_read_int32_unchecked(decoder_p);
+            columns_p->field12.present_p[index / 8] |= (uint8_t)(1u << (index % 8));
+            break;
+
+        case PBTOOLS_KEY(11, PBTOOLS_WIRE_TYPE_VARINT):
+            columns_p->field11.values_p[index] = pbtools_decoder_read_int32_unchecked(decoder_p);
+            columns_p->field11.present_p[index / 8] |= (uint8_t)(1u << (index % 8));
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 2:
+            case 11:
+            case 12:
+            case 28:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+}
+
+static void benchmark_message3_sub_message_encode_columns_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    const struct benchmark_message3_sub_message_columns_t *columns_p)
+{
+    int index;
+    int pos;
+
+    for (index = columns_p->length - 1; index >= 0; index--) {
+        pos = encoder_p->pos;
+
+        if ((columns_p->field11.values_p != NULL)
+            && PBTOOLS_COLUMN_IS_PRESENT(
+                columns_p->field11.present_p,
+                index)) {
+            pbtools_encoder_write_int32(
+                encoder_p,
+                11,
+                columns_p->field11.values_p[index]);
+        }
+
+        if ((columns_p->field12.values_p != NULL)
+            && PBTOOLS_COLUMN_IS_PRESENT(
+                columns_p->field12.present_p,
+                index)) {
+            pbtools_encoder_write_int32(
+                encoder_p,
+                12,
+                columns_p->field12.values_p[index]);
+        }
+
+        if ((columns_p->field2.values_p != NULL)
+            && PBTOOLS_COLUMN_IS_PRESENT(
+                columns_p->field2.present_p,
+                index)) {
+            pbtools_encoder_write_int64(
+                encoder_p,
+                2,
+                columns_p->field2.values_p[index]);
+        }
+
+        if ((columns_p->field28.values_p != NULL)
+            && PBTOOLS_COLUMN_IS_PRESENT(
+                columns_p->field28.present_p,
+                index)) {
+            pbtools_encoder_write_int32(
+                encoder_p,
+                28,
+                columns_p->field28.values_p[index]);
+        }
+
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+int benchmark_message3_encode_columns(
+    struct benchmark_message3_t *self_p,
+    uint8_t *encoded_p,
+    size_t size,
+    const struct benchmark_message3_repeated_columns_t *columns_p)
+{
+    struct pbtools_repeated_columns_t columns[] = {
+        {
+            13,
+            columns_p->field13_p,
+            (pbtools_columns_alloc_t)benchmark_message3_sub_message_columns_alloc,
+            (pbtools_columns_decode_inner_t)benchmark_message3_sub_message_decode_columns_inner,
+            (pbtools_columns_encode_t)benchmark_message3_sub_message_encode_columns_inner
+        }
+    };
+
+    return (pbtools_message_encode_columns(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)benchmark_message3_encode_inner,
+                &columns[0],
+                1));
+}
+
+int benchmark_message3_decode_columns(
+    struct benchmark_message3_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct benchmark_message3_repeated_columns_t *columns_p)
+{
+    struct pbtools_repeated_columns_t columns[] = {
+        {
+            13,
+            columns_p->field13_p,
+            (pbtools_columns_alloc_t)benchmark_message3_sub_message_columns_alloc,
+            (pbtools_columns_decode_inner_t)benchmark_message3_sub_message_decode_columns_inner,
+            (pbtools_columns_encode_t)benchmark_message3_sub_message_encode_columns_inner
+        }
+    };
+
+    return (pbtools_message_decode_columns(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)benchmark_message3_decode_inner,
+                &columns[0],
+                1));
+}
+
+int benchmark_message_message1_alloc(
+    struct benchmark_message_t *self_p)
+{
+    self_p->oneof = benchmark_message_oneof_message1_e;
+
+    return (pbtools_sub_message_alloc(
+                (struct pbtools_message_base_t **)&self_p->message1_p,
+                self_p->base.heap_p,
+                sizeof(struct benchmark_message1_t),
+                (pbtools_message_init_t)benchmark_message1_init));
+}
+
+int benchmark_message_message2_alloc(
+    struct benchmark_message_t *self_p)
+{
+    self_p->oneof = benchmark_message_oneof_message2_e;
+
+    return (pbtools_sub_message_alloc(
+                (struct pbtools_message_base_t **)&self_p->message2_p,
+                self_p->base.heap_p,
+                sizeof(struct benchmark_message2_t),
+                (pbtools_message_init_t)benchmark_message2_init));
+}
+
+int benchmark_message_message3_alloc(
+    struct benchmark_message_t *self_p)
+{
+    self_p->oneof = benchmark_message_oneof_message3_e;
+
+    return (pbtools_sub_message_alloc(
+                (struct pbtools_message_base_t **)&self_p->message3_p,
+                self_p->base.heap_p,
+                sizeof(struct benchmark_message3_t),
+                (pbtools_message_init_t)benchmark_message3_init));
+}
+
+static void benchmark_message_message1_decode(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message_t *self_p)
+{
+    self_p->oneof = benchmark_message_oneof_message1_e;
+    pbtools_decoder_sub_message_decode_unchecked(
+        decoder_p,
+        (struct pbtools_message_base_t **)&self_p->message1_p,
+        sizeof(struct benchmark_message1_t),
+        (pbtools_message_init_t)benchmark_message1_init,
+        (pbtools_message_decode_inner_t)benchmark_message1_decode_inner);
+}
+
+static void benchmark_message_message2_decode(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message_t *self_p)
+{
+    self_p->oneof = benchmark_message_oneof_message2_e;
+    pbtools_decoder_sub_message_decode_unchecked(
+        decoder_p,
+        (struct pbtools_message_base_t **)&self_p->message2_p,
+        sizeof(struct benchmark_message2_t),
+        (pbtools_message_init_t)benchmark_message2_init,
+        (pbtools_message_decode_inner_t)benchmark_message2_decode_inner);
+}
+
+static void benchmark_message_message3_decode(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message_t *self_p)
+{
+    self_p->oneof = benchmark_message_oneof_message3_e;
+    pbtools_decoder_sub_message_decode_unchecked(
+        decoder_p,
+        (struct pbtools_message_base_t **)&self_p->message3_p,
+        sizeof(struct benchmark_message3_t),
+        (pbtools_message_init_t)benchmark_message3_init,
+        (pbtools_message_decode_inner_t)benchmark_message3_decode_inner);
+}
+
+void benchmark_message_init(
+    struct benchmark_message_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->oneof = 0;
+}
+
+void benchmark_message_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct benchmark_message_t *self_p)
+{
+    switch (self_p->oneof) {
+
+    case benchmark_message_oneof_message1_e:
+        pbtools_encoder_sub_message_encode_always(
+            encoder_p,
+            1,
+            &self_p->message1_p->base,
+            (pbtools_message_encode_inner_t)benchmark_message1_encode_inner);
+        break;
+
+    case benchmark_message_oneof_message2_e:
+        pbtools_encoder_sub_message_encode_always(
+            encoder_p,
+            2,
+            &self_p->message2_p->base,
+            (pbtools_message_encode_inner_t)benchmark_message2_encode_inner);
+        break;
+
+    case benchmark_message_oneof_message3_e:
+        pbtools_encoder_sub_message_encode_always(
+            encoder_p,
+            7,
+            &self_p->message3_p->base,
+            (pbtools_message_encode_inner_t)benchmark_message3_encode_inner);
+        break;
+
+    default:
+        break;
+    }
+}
+
+void benchmark_message_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message_t *self_p)
+{
+    uint32_t key;
+    int wire_type;
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            benchmark_message_message1_decode(
+                decoder_p,
+                self_p);
+            break;
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            benchmark_message_message2_decode(
+                decoder_p,
+                self_p);
+            break;
+
+        case PBTOOLS_KEY(7, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            benchmark_message_message3_decode(
+                decoder_p,
+                self_p);
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 7:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+}
+
+void benchmark_message_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct benchmark_message_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        benchmark_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void benchmark_message_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct benchmark_message_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct benchmark_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        benchmark_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        benchmark_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t benchmark_message_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 7, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false }
+};
+
+void benchmark_message_view_init(
+    struct benchmark_message_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &benchmark_message_view_fields[0],
+                      3,
+                      &self_p->offsets[0]);
+}
+
+int benchmark_message_view_error(
+    struct benchmark_message_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+enum benchmark_message_oneof_e benchmark_message_view_get_oneof(
+    struct benchmark_message_view_t *self_p)
+{
+    return ((enum benchmark_message_oneof_e)(
+                pbtools_view_last_field(&self_p->base,
+                                        0,
+                                        3) + 1));
+}
+
+bool benchmark_message_view_get_message1(
+    struct benchmark_message_view_t *self_p,
+    struct benchmark_message1_view_t *value_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+    bool found;
+
+    value.buf_p = NULL;
+    value.size = 0;
+    found = pbtools_view_seek(&self_p->base, 0, &decoder);
+
+    if (found) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    benchmark_message1_view_init(value_p, value.buf_p, value.size);
+
+    return (found);
+}
+
+bool benchmark_message_view_get_message2(
+    struct benchmark_message_view_t *self_p,
+    struct benchmark_message2_view_t *value_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+    bool found;
+
+    value.buf_p = NULL;
+    value.size = 0;
+    found = pbtools_view_seek(&self_p->base, 1, &decoder);
+
+    if (found) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    benchmark_message2_view_init(value_p, value.buf_p, value.size);
+
+    return (found);
+}
+
+bool benchmark_message_view_get_message3(
+    struct benchmark_message_view_t *self_p,
+    struct benchmark_message3_view_t *value_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+    bool found;
+
+    value.buf_p = NULL;
+    value.size = 0;
+    found = pbtools_view_seek(&self_p->base, 2, &decoder);
+
+    if (found) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    benchmark_message3_view_init(value_p, value.buf_p, value.size);
+
+    return (found);
+}
+
+struct benchmark_message_t *
+benchmark_message_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct benchmark_message_t),
+                (pbtools_message_init_t)benchmark_message_init));
+}
+
+int benchmark_message_encode(
+    struct benchmark_message_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)benchmark_message_encode_inner));
+}
+
+int benchmark_message_decode(
+    struct benchmark_message_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)benchmark_message_decode_inner));
+}
+
+int benchmark_message_decode_padded(
+    struct benchmark_message_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode_padded(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)benchmark_message_decode_inner));
+}
+
+int benchmark_message_decode_segments(
+    struct benchmark_message_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)benchmark_message_decode_inner));
+}
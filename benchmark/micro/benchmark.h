@@ -0,0 +1,811 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by pbtools.
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "pbtools.h"
+
+/**
+ * Enum benchmark.Enum.
+ */
+enum benchmark_enum_e {
+    benchmark_e0_e = 0,
+    benchmark_e1_e = 1,
+    benchmark_e2_e = 2,
+    benchmark_e3_e = 3,
+    benchmark_e5_e = 5
+};
+
+/**
+ * Message benchmark.SubMessage.
+ */
+struct benchmark_sub_message_repeated_t {
+    int length;
+    struct benchmark_sub_message_t *items_p;
+};
+
+struct benchmark_sub_message_t {
+    struct pbtools_message_base_t base;
+    uint32_t field1;
+    uint32_t field2;
+    int32_t field3;
+    char *field15_p;
+    struct pbtools_bytes_t field12;
+    int64_t field13;
+    int64_t field14;
+    uint64_t field21;
+    int32_t field22;
+    bool field206;
+    uint32_t field203;
+    int32_t field204;
+    char *field205_p;
+    uint64_t field207;
+    enum benchmark_enum_e field300;
+};
+
+/**
+ * View of an encoded benchmark.SubMessage.
+ */
+struct benchmark_sub_message_view_t {
+    struct pbtools_view_t base;
+    int offsets[15];
+};
+
+/**
+ * Message benchmark.Message1.
+ */
+struct benchmark_message1_repeated_t {
+    int length;
+    struct benchmark_message1_t *items_p;
+};
+
+struct benchmark_message1_t {
+    struct pbtools_message_base_t base;
+    bool field80;
+    bool field81;
+    int32_t field2;
+    int32_t field3;
+    int32_t field280;
+    int32_t field6;
+    int64_t field22;
+    struct pbtools_repeated_string_t field4;
+    bool field59;
+    int32_t field16;
+    int32_t field150;
+    int32_t field23;
+    bool field24;
+    int32_t field25;
+    struct benchmark_sub_message_t *field15_p;
+    bool field78;
+    int32_t field67;
+    int32_t field68;
+    int32_t field128;
+    char *field129_p;
+    int32_t field131;
+};
+
+/**
+ * View of an encoded benchmark.Message1.
+ */
+struct benchmark_message1_view_t {
+    struct pbtools_view_t base;
+    int offsets[21];
+};
+
+/**
+ * Message benchmark.Message2.
+ */
+struct benchmark_message2_repeated_t {
+    int length;
+    struct benchmark_message2_t *items_p;
+};
+
+struct benchmark_message2_t {
+    struct pbtools_message_base_t base;
+    enum benchmark_enum_e field1;
+    uint64_t field2;
+    int32_t field3;
+    char *field4_p;
+    int32_t field5;
+    bool field6;
+};
+
+/**
+ * View of an encoded benchmark.Message2.
+ */
+struct benchmark_message2_view_t {
+    struct pbtools_view_t base;
+    int offsets[6];
+};
+
+/**
+ * Message benchmark.Message3.SubMessage.
+ */
+struct benchmark_message3_sub_message_repeated_t {
+    int length;
+    struct benchmark_message3_sub_message_t *items_p;
+};
+
+struct benchmark_message3_sub_message_t {
+    struct pbtools_message_base_t base;
+    int32_t field28;
+    int64_t field2;
+    int32_t field12;
+    char *field19_p;
+    int32_t field11;
+};
+
+/**
+ * View of an encoded benchmark.Message3.SubMessage.
+ */
+struct benchmark_message3_sub_message_view_t {
+    struct pbtools_view_t base;
+    int offsets[5];
+};
+
+/**
+ * Message benchmark.Message3.
+ */
+struct benchmark_message3_repeated_t {
+    int length;
+    struct benchmark_message3_t *items_p;
+};
+
+struct benchmark_message3_t {
+    struct pbtools_message_base_t base;
+    struct benchmark_message3_sub_message_repeated_t field13;
+};
+
+/**
+ * View of an encoded benchmark.Message3.
+ */
+struct benchmark_message3_view_t {
+    struct pbtools_view_t base;
+    int offsets[1];
+};
+
+/**
+ * Columns of repeated benchmark.Message3.SubMessage items.
+ */
+struct benchmark_message3_sub_message_columns_t {
+    int length;
+    struct {
+        int32_t *values_p;
+        uint8_t *present_p;
+    } field28;
+    struct {
+        int64_t *values_p;
+        uint8_t *present_p;
+    } field2;
+    struct {
+        int32_t *values_p;
+        uint8_t *present_p;
+    } field12;
+    struct {
+        int32_t *values_p;
+        uint8_t *present_p;
+    } field11;
+};
+
+/**
+ * Columns of benchmark.Message3 repeated sub-message fields.
+ */
+struct benchmark_message3_repeated_columns_t {
+    struct benchmark_message3_sub_message_columns_t *field13_p;
+};
+
+/**
+ * Enum benchmark.Message.oneof.
+ */
+enum benchmark_message_oneof_e {
+    benchmark_message_oneof_none_e = 0,
+    benchmark_message_oneof_message1_e = 1,
+    benchmark_message_oneof_message2_e = 2,
+    benchmark_message_oneof_message3_e = 3
+};
+
+/**
+ * Message benchmark.Message.
+ */
+struct benchmark_message_repeated_t {
+    int length;
+    struct benchmark_message_t *items_p;
+};
+
+struct benchmark_message_t {
+    struct pbtools_message_base_t base;
+    enum benchmark_message_oneof_e oneof;
+    union {
+        struct benchmark_message1_t *message1_p;
+        struct benchmark_message2_t *message2_p;
+        struct benchmark_message3_t *message3_p;
+    };
+};
+
+/**
+ * View of an encoded benchmark.Message.
+ */
+struct benchmark_message_view_t {
+    struct pbtools_view_t base;
+    int offsets[3];
+};
+
+/**
+ * Fields of an encoded benchmark.SubMessage read on demand.
+ */
+void benchmark_sub_message_view_init(
+    struct benchmark_sub_message_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int benchmark_sub_message_view_error(
+    struct benchmark_sub_message_view_t *self_p);
+
+uint32_t benchmark_sub_message_view_get_field1(
+    struct benchmark_sub_message_view_t *self_p);
+
+uint32_t benchmark_sub_message_view_get_field2(
+    struct benchmark_sub_message_view_t *self_p);
+
+int32_t benchmark_sub_message_view_get_field3(
+    struct benchmark_sub_message_view_t *self_p);
+
+struct pbtools_bytes_t benchmark_sub_message_view_get_field15(
+    struct benchmark_sub_message_view_t *self_p);
+
+struct pbtools_bytes_t benchmark_sub_message_view_get_field12(
+    struct benchmark_sub_message_view_t *self_p);
+
+int64_t benchmark_sub_message_view_get_field13(
+    struct benchmark_sub_message_view_t *self_p);
+
+int64_t benchmark_sub_message_view_get_field14(
+    struct benchmark_sub_message_view_t *self_p);
+
+uint64_t benchmark_sub_message_view_get_field21(
+    struct benchmark_sub_message_view_t *self_p);
+
+int32_t benchmark_sub_message_view_get_field22(
+    struct benchmark_sub_message_view_t *self_p);
+
+bool benchmark_sub_message_view_get_field206(
+    struct benchmark_sub_message_view_t *self_p);
+
+uint32_t benchmark_sub_message_view_get_field203(
+    struct benchmark_sub_message_view_t *self_p);
+
+int32_t benchmark_sub_message_view_get_field204(
+    struct benchmark_sub_message_view_t *self_p);
+
+struct pbtools_bytes_t benchmark_sub_message_view_get_field205(
+    struct benchmark_sub_message_view_t *self_p);
+
+uint64_t benchmark_sub_message_view_get_field207(
+    struct benchmark_sub_message_view_t *self_p);
+
+enum benchmark_enum_e benchmark_sub_message_view_get_field300(
+    struct benchmark_sub_message_view_t *self_p);
+
+/**
+ * Encoding and decoding of benchmark.SubMessage.
+ */
+struct benchmark_sub_message_t *
+benchmark_sub_message_new(
+    void *workspace_p,
+    size_t size);
+
+int benchmark_sub_message_encode(
+    struct benchmark_sub_message_t *self_p,
+    uint8_t *encoded_p,
+    size_t size);
+
+int benchmark_sub_message_decode(
+    struct benchmark_sub_message_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int benchmark_sub_message_decode_padded(
+    struct benchmark_sub_message_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int benchmark_sub_message_decode_segments(
+    struct benchmark_sub_message_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+int benchmark_message1_field4_alloc(
+    struct benchmark_message1_t *self_p,
+    int length);
+
+int benchmark_message1_field15_alloc(
+    struct benchmark_message1_t *self_p);
+
+/**
+ * Fields of an encoded benchmark.Message1 read on demand.
+ */
+void benchmark_message1_view_init(
+    struct benchmark_message1_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int benchmark_message1_view_error(
+    struct benchmark_message1_view_t *self_p);
+
+bool benchmark_message1_view_get_field80(
+    struct benchmark_message1_view_t *self_p);
+
+bool benchmark_message1_view_get_field81(
+    struct benchmark_message1_view_t *self_p);
+
+int32_t benchmark_message1_view_get_field2(
+    struct benchmark_message1_view_t *self_p);
+
+int32_t benchmark_message1_view_get_field3(
+    struct benchmark_message1_view_t *self_p);
+
+int32_t benchmark_message1_view_get_field280(
+    struct benchmark_message1_view_t *self_p);
+
+int32_t benchmark_message1_view_get_field6(
+    struct benchmark_message1_view_t *self_p);
+
+int64_t benchmark_message1_view_get_field22(
+    struct benchmark_message1_view_t *self_p);
+
+void benchmark_message1_view_field4_begin(
+    struct benchmark_message1_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool benchmark_message1_view_field4_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct pbtools_bytes_t *value_p);
+
+bool benchmark_message1_view_get_field59(
+    struct benchmark_message1_view_t *self_p);
+
+int32_t benchmark_message1_view_get_field16(
+    struct benchmark_message1_view_t *self_p);
+
+int32_t benchmark_message1_view_get_field150(
+    struct benchmark_message1_view_t *self_p);
+
+int32_t benchmark_message1_view_get_field23(
+    struct benchmark_message1_view_t *self_p);
+
+bool benchmark_message1_view_get_field24(
+    struct benchmark_message1_view_t *self_p);
+
+int32_t benchmark_message1_view_get_field25(
+    struct benchmark_message1_view_t *self_p);
+
+bool benchmark_message1_view_get_field15(
+    struct benchmark_message1_view_t *self_p,
+    struct benchmark_sub_message_view_t *value_p);
+
+bool benchmark_message1_view_get_field78(
+    struct benchmark_message1_view_t *self_p);
+
+int32_t benchmark_message1_view_get_field67(
+    struct benchmark_message1_view_t *self_p);
+
+int32_t benchmark_message1_view_get_field68(
+    struct benchmark_message1_view_t *self_p);
+
+int32_t benchmark_message1_view_get_field128(
+    struct benchmark_message1_view_t *self_p);
+
+struct pbtools_bytes_t benchmark_message1_view_get_field129(
+    struct benchmark_message1_view_t *self_p);
+
+int32_t benchmark_message1_view_get_field131(
+    struct benchmark_message1_view_t *self_p);
+
+/**
+ * Encoding and decoding of benchmark.Message1.
+ */
+struct benchmark_message1_t *
+benchmark_message1_new(
+    void *workspace_p,
+    size_t size);
+
+int benchmark_message1_encode(
+    struct benchmark_message1_t *self_p,
+    uint8_t *encoded_p,
+    size_t size);
+
+int benchmark_message1_decode(
+    struct benchmark_message1_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int benchmark_message1_decode_padded(
+    struct benchmark_message1_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int benchmark_message1_decode_segments(
+    struct benchmark_message1_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+/**
+ * Fields of an encoded benchmark.Message2 read on demand.
+ */
+void benchmark_message2_view_init(
+    struct benchmark_message2_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int benchmark_message2_view_error(
+    struct benchmark_message2_view_t *self_p);
+
+enum benchmark_enum_e benchmark_message2_view_get_field1(
+    struct benchmark_message2_view_t *self_p);
+
+uint64_t benchmark_message2_view_get_field2(
+    struct benchmark_message2_view_t *self_p);
+
+int32_t benchmark_message2_view_get_field3(
+    struct benchmark_message2_view_t *self_p);
+
+struct pbtools_bytes_t benchmark_message2_view_get_field4(
+    struct benchmark_message2_view_t *self_p);
+
+int32_t benchmark_message2_view_get_field5(
+    struct benchmark_message2_view_t *self_p);
+
+bool benchmark_message2_view_get_field6(
+    struct benchmark_message2_view_t *self_p);
+
+/**
+ * Encoding and decoding of benchmark.Message2.
+ */
+struct benchmark_message2_t *
+benchmark_message2_new(
+    void *workspace_p,
+    size_t size);
+
+int benchmark_message2_encode(
+    struct benchmark_message2_t *self_p,
+    uint8_t *encoded_p,
+    size_t size);
+
+int benchmark_message2_decode(
+    struct benchmark_message2_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int benchmark_message2_decode_padded(
+    struct benchmark_message2_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int benchmark_message2_decode_segments(
+    struct benchmark_message2_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+int benchmark_message3_field13_alloc(
+    struct benchmark_message3_t *self_p,
+    int length);
+
+/**
+ * Fields of an encoded benchmark.Message3.SubMessage read on demand.
+ */
+void benchmark_message3_sub_message_view_init(
+    struct benchmark_message3_sub_message_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int benchmark_message3_sub_message_view_error(
+    struct benchmark_message3_sub_message_view_t *self_p);
+
+int32_t benchmark_message3_sub_message_view_get_field28(
+    struct benchmark_message3_sub_message_view_t *self_p);
+
+int64_t benchmark_message3_sub_message_view_get_field2(
+    struct benchmark_message3_sub_message_view_t *self_p);
+
+int32_t benchmark_message3_sub_message_view_get_field12(
+    struct benchmark_message3_sub_message_view_t *self_p);
+
+struct pbtools_bytes_t benchmark_message3_sub_message_view_get_field19(
+    struct benchmark_message3_sub_message_view_t *self_p);
+
+int32_t benchmark_message3_sub_message_view_get_field11(
+    struct benchmark_message3_sub_message_view_t *self_p);
+
+/**
+ * Fields of an encoded benchmark.Message3 read on demand.
+ */
+void benchmark_message3_view_init(
+    struct benchmark_message3_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int benchmark_message3_view_error(
+    struct benchmark_message3_view_t *self_p);
+
+void benchmark_message3_view_field13_begin(
+    struct benchmark_message3_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool benchmark_message3_view_field13_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct benchmark_message3_sub_message_view_t *value_p);
+
+/**
+ * Encoding and decoding of benchmark.Message3.
+ */
+struct benchmark_message3_t *
+benchmark_message3_new(
+    void *workspace_p,
+    size_t size);
+
+int benchmark_message3_encode(
+    struct benchmark_message3_t *self_p,
+    uint8_t *encoded_p,
+    size_t size);
+
+int benchmark_message3_decode(
+    struct benchmark_message3_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int benchmark_message3_decode_padded(
+    struct benchmark_message3_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int benchmark_message3_decode_segments(
+    struct benchmark_message3_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+int benchmark_message3_encode_columns(
+    struct benchmark_message3_t *self_p,
+    uint8_t *encoded_p,
+    size_t size,
+    const struct benchmark_message3_repeated_columns_t *columns_p);
+
+int benchmark_message3_decode_columns(
+    struct benchmark_message3_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct benchmark_message3_repeated_columns_t *columns_p);
+
+/**
+ * Fields of an encoded benchmark.Message read on demand.
+ */
+void benchmark_message_view_init(
+    struct benchmark_message_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int benchmark_message_view_error(
+    struct benchmark_message_view_t *self_p);
+
+enum benchmark_message_oneof_e benchmark_message_view_get_oneof(
+    struct benchmark_message_view_t *self_p);
+
+bool benchmark_message_view_get_message1(
+    struct benchmark_message_view_t *self_p,
+    struct benchmark_message1_view_t *value_p);
+
+bool benchmark_message_view_get_message2(
+    struct benchmark_message_view_t *self_p,
+    struct benchmark_message2_view_t *value_p);
+
+bool benchmark_message_view_get_message3(
+    struct benchmark_message_view_t *self_p,
+    struct benchmark_message3_view_t *value_p);
+
+int benchmark_message_message1_alloc(
+    struct benchmark_message_t *self_p);
+
+int benchmark_message_message2_alloc(
+    struct benchmark_message_t *self_p);
+
+int benchmark_message_message3_alloc(
+    struct benchmark_message_t *self_p);
+
+/**
+ * Encoding and decoding of benchmark.Message.
+ */
+struct benchmark_message_t *
+benchmark_message_new(
+    void *workspace_p,
+    size_t size);
+
+int benchmark_message_encode(
+    struct benchmark_message_t *self_p,
+    uint8_t *encoded_p,
+    size_t size);
+
+int benchmark_message_decode(
+    struct benchmark_message_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int benchmark_message_decode_padded(
+    struct benchmark_message_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int benchmark_message_decode_segments(
+    struct benchmark_message_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+/* Internal functions. Do not use! */
+
+void benchmark_sub_message_init(
+    struct benchmark_sub_message_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void benchmark_sub_message_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct benchmark_sub_message_t *self_p);
+
+void benchmark_sub_message_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_sub_message_t *self_p);
+
+void benchmark_sub_message_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct benchmark_sub_message_repeated_t *repeated_p);
+
+void benchmark_sub_message_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct benchmark_sub_message_repeated_t *repeated_p);
+
+void benchmark_message1_init(
+    struct benchmark_message1_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void benchmark_message1_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct benchmark_message1_t *self_p);
+
+void benchmark_message1_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message1_t *self_p);
+
+void benchmark_message1_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct benchmark_message1_repeated_t *repeated_p);
+
+void benchmark_message1_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct benchmark_message1_repeated_t *repeated_p);
+
+void benchmark_message2_init(
+    struct benchmark_message2_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void benchmark_message2_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct benchmark_message2_t *self_p);
+
+void benchmark_message2_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message2_t *self_p);
+
+void benchmark_message2_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct benchmark_message2_repeated_t *repeated_p);
+
+void benchmark_message2_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct benchmark_message2_repeated_t *repeated_p);
+
+void benchmark_message3_init(
+    struct benchmark_message3_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void benchmark_message3_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct benchmark_message3_t *self_p);
+
+void benchmark_message3_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message3_t *self_p);
+
+void benchmark_message3_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct benchmark_message3_repeated_t *repeated_p);
+
+void benchmark_message3_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct benchmark_message3_repeated_t *repeated_p);
+
+void benchmark_message3_sub_message_init(
+    struct benchmark_message3_sub_message_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void benchmark_message3_sub_message_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct benchmark_message3_sub_message_t *self_p);
+
+void benchmark_message3_sub_message_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message3_sub_message_t *self_p);
+
+void benchmark_message3_sub_message_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct benchmark_message3_sub_message_repeated_t *repeated_p);
+
+void benchmark_message3_sub_message_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct benchmark_message3_sub_message_repeated_t *repeated_p);
+
+void benchmark_message_init(
+    struct benchmark_message_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void benchmark_message_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct benchmark_message_t *self_p);
+
+void benchmark_message_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message_t *self_p);
+
+void benchmark_message_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct benchmark_message_repeated_t *repeated_p);
+
+void benchmark_message_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct benchmark_message_repeated_t *repeated_p);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,1057 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#if defined(__x86_64__)
+#    include <x86intrin.h>
+#endif
+
+#include "benchmark.h"
+#include "micro.h"
+
+struct benchmark_t {
+    const char *name_p;
+    void (*run)(int iterations);
+    /* Run fewer iterations of slow benchmarks. */
+    int divisor;
+};
+
+static uint8_t encoded[1 << 16];
+static uint8_t workspace[1 << 18];
+
+static double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((double)ts.tv_sec * 1e9 + (double)ts.tv_nsec);
+}
+
+static void fill_message_message1(struct benchmark_message_t *message_p)
+{
+    benchmark_message_message1_alloc(message_p);
+    message_p->message1_p->field80 = true;
+    message_p->message1_p->field2 = -336;
+    message_p->message1_p->field6 = 5000;
+    message_p->message1_p->field22 = 5;
+    benchmark_message1_field4_alloc(message_p->message1_p, 3);
+    message_p->message1_p->field4.items_pp[0] = "The first string";
+    message_p->message1_p->field4.items_pp[1] = "The second string";
+    message_p->message1_p->field4.items_pp[2] = "The third string";
+    benchmark_message1_field15_alloc(message_p->message1_p);
+    message_p->message1_p->field15_p->field1 = 0;
+    message_p->message1_p->field15_p->field3 = 9999;
+    message_p->message1_p->field15_p->field15_p = (
+        "Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! "
+        "Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! "
+        "Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! "
+        "Hello! Hello! Hello!");
+    message_p->message1_p->field15_p->field12.buf_p = (uint8_t *)(
+        "Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! "
+        "Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! "
+        "Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! "
+        "Hello! Hello! Hello!");
+    message_p->message1_p->field15_p->field12.size = 230;
+    message_p->message1_p->field15_p->field21 = 449932;
+    message_p->message1_p->field15_p->field204 = 1;
+    message_p->message1_p->field15_p->field300 = benchmark_e3_e;
+}
+
+static void message1_decode(int iterations)
+{
+    int i;
+    struct benchmark_message_t *message_p;
+    int size;
+
+    message_p = benchmark_message_new(&workspace[0], sizeof(workspace));
+    fill_message_message1(message_p);
+    size = benchmark_message_encode(message_p, &encoded[0], sizeof(encoded));
+    assert(size == 566);
+
+    for (i = 0; i < iterations; i++) {
+        message_p = benchmark_message_new(&workspace[0], sizeof(workspace));
+        size = benchmark_message_decode(message_p, &encoded[0], 566);
+        assert(size == 566);
+    }
+}
+
+/* A few fields read from a view of the encoded message instead of
+   decoding all of it. */
+static void message1_view(int iterations)
+{
+    int i;
+    struct benchmark_message_t *message_p;
+    struct benchmark_message_view_t view;
+    struct benchmark_message1_view_t message1;
+    struct benchmark_sub_message_view_t field15;
+    int size;
+
+    message_p = benchmark_message_new(&workspace[0], sizeof(workspace));
+    fill_message_message1(message_p);
+    size = benchmark_message_encode(message_p, &encoded[0], sizeof(encoded));
+    assert(size == 566);
+
+    for (i = 0; i < iterations; i++) {
+        benchmark_message_view_init(&view, &encoded[0], 566);
+        benchmark_message_view_get_message1(&view, &message1);
+        benchmark_message1_view_get_field15(&message1, &field15);
+        assert(benchmark_message1_view_get_field2(&message1) == -336);
+        assert(benchmark_sub_message_view_get_field21(&field15) == 449932);
+        assert(benchmark_message_view_error(&view) == 0);
+    }
+}
+
+/* Many small sub-messages, where most values are near the end of
+   their slice. */
+static void run_message3_decode(int iterations, bool padded)
+{
+    int i;
+    struct benchmark_message_t *message_p;
+    struct benchmark_message3_sub_message_t *item_p;
+    int size;
+    int encoded_size;
+
+    message_p = benchmark_message_new(&workspace[0], sizeof(workspace));
+    benchmark_message_message3_alloc(message_p);
+    benchmark_message3_field13_alloc(message_p->message3_p, 256);
+
+    for (i = 0; i < 256; i++) {
+        item_p = &message_p->message3_p->field13.items_p[i];
+        item_p->field28 = i;
+        item_p->field2 = (1000000 * i);
+        item_p->field12 = 12;
+        item_p->field19_p = "";
+        item_p->field11 = 11;
+    }
+
+    encoded_size = benchmark_message_encode(
+        message_p,
+        &encoded[0],
+        sizeof(encoded) - PBTOOLS_PADDING);
+    assert(encoded_size > 0);
+
+    for (i = 0; i < iterations; i++) {
+        message_p = benchmark_message_new(&workspace[0], sizeof(workspace));
+
+        if (padded) {
+            size = benchmark_message_decode_padded(message_p,
+                                                   &encoded[0],
+                                                   (size_t)encoded_size);
+        } else {
+            size = benchmark_message_decode(message_p,
+                                            &encoded[0],
+                                            (size_t)encoded_size);
+        }
+
+        assert(size == encoded_size);
+    }
+}
+
+static void message3_decode(int iterations)
+{
+    run_message3_decode(iterations, false);
+}
+
+static void message3_padded_decode(int iterations)
+{
+    run_message3_decode(iterations, true);
+}
+
+/* All fields of Message1 present, making decoding dominated by tags
+   rather than string copying. */
+static void message1_all_fields_decode(int iterations)
+{
+    int i;
+    struct benchmark_message_t *message_p;
+    struct benchmark_message1_t *message1_p;
+    struct benchmark_sub_message_t *sub_message_p;
+    int size;
+    int encoded_size;
+
+    message_p = benchmark_message_new(&workspace[0], sizeof(workspace));
+    benchmark_message_message1_alloc(message_p);
+    message1_p = message_p->message1_p;
+    message1_p->field80 = true;
+    message1_p->field81 = true;
+    message1_p->field2 = -336;
+    message1_p->field3 = 3;
+    message1_p->field280 = 280;
+    message1_p->field6 = 5000;
+    message1_p->field22 = 5;
+    benchmark_message1_field4_alloc(message1_p, 2);
+    message1_p->field4.items_pp[0] = "a";
+    message1_p->field4.items_pp[1] = "b";
+    message1_p->field59 = true;
+    message1_p->field16 = 16;
+    message1_p->field150 = 150;
+    message1_p->field23 = 23;
+    message1_p->field24 = true;
+    message1_p->field25 = 25;
+    benchmark_message1_field15_alloc(message1_p);
+    sub_message_p = message1_p->field15_p;
+    sub_message_p->field1 = 1;
+    sub_message_p->field2 = 2;
+    sub_message_p->field3 = 9999;
+    sub_message_p->field15_p = "c";
+    sub_message_p->field12.buf_p = (uint8_t *)"d";
+    sub_message_p->field12.size = 1;
+    sub_message_p->field13 = 13;
+    sub_message_p->field14 = 14;
+    sub_message_p->field21 = 449932;
+    sub_message_p->field22 = 22;
+    sub_message_p->field206 = true;
+    sub_message_p->field203 = 203;
+    sub_message_p->field204 = 1;
+    sub_message_p->field205_p = "e";
+    sub_message_p->field207 = 207;
+    sub_message_p->field300 = benchmark_e3_e;
+    message1_p->field78 = true;
+    message1_p->field67 = 67;
+    message1_p->field68 = 68;
+    message1_p->field128 = 128;
+    message1_p->field129_p = "f";
+    message1_p->field131 = 131;
+    encoded_size = benchmark_message_encode(message_p,
+                                            &encoded[0],
+                                            sizeof(encoded));
+    assert(encoded_size > 0);
+
+    for (i = 0; i < iterations; i++) {
+        message_p = benchmark_message_new(&workspace[0], sizeof(workspace));
+        size = benchmark_message_decode(message_p,
+                                        &encoded[0],
+                                        (size_t)encoded_size);
+        assert(size == encoded_size);
+    }
+}
+
+static void run_varints_decode(int iterations, int simd, uint64_t modulo)
+{
+    int i;
+    struct micro_varints_t *message_p;
+    int size;
+    int encoded_size;
+
+    pbtools_simd_select(simd);
+    message_p = micro_varints_new(&workspace[0], sizeof(workspace));
+    micro_varints_values_alloc(message_p, 1000);
+
+    for (i = 0; i < 1000; i++) {
+        message_p->values.items_p[i] = (
+            ((1ull << (7 * (i % 10))) + (uint64_t)i) % modulo);
+    }
+
+    encoded_size = micro_varints_encode(message_p,
+                                        &encoded[0],
+                                        sizeof(encoded));
+    assert(encoded_size > 0);
+
+    for (i = 0; i < iterations; i++) {
+        message_p = micro_varints_new(&workspace[0], sizeof(workspace));
+        size = micro_varints_decode(message_p, &encoded[0], encoded_size);
+        assert(size == encoded_size);
+    }
+
+    pbtools_simd_select(PBTOOLS_SIMD_AVX2);
+}
+
+static void varints_decode(int iterations)
+{
+    run_varints_decode(iterations, PBTOOLS_SIMD_AVX2, UINT64_MAX);
+}
+
+static void varints_decode_sse4_1(int iterations)
+{
+    run_varints_decode(iterations, PBTOOLS_SIMD_SSE4_1, UINT64_MAX);
+}
+
+static void varints_decode_no_simd(int iterations)
+{
+    run_varints_decode(iterations, PBTOOLS_SIMD_NONE, UINT64_MAX);
+}
+
+static void small_varints_decode(int iterations)
+{
+    run_varints_decode(iterations, PBTOOLS_SIMD_AVX2, 128);
+}
+
+static void small_varints_decode_no_simd(int iterations)
+{
+    run_varints_decode(iterations, PBTOOLS_SIMD_NONE, 128);
+}
+
+/* 1024 non-packed values spread round-robin over given number of
+   repeated fields. */
+static void run_interleaved_decode(int iterations, int fields)
+{
+    int i;
+    int field;
+    struct micro_interleaved_t *message_p;
+    int size;
+    int encoded_size;
+
+    encoded_size = 0;
+
+    for (i = 0; i < 1024; i++) {
+        field = (i % fields) + 1;
+
+        if (field < 16) {
+            encoded[encoded_size++] = (uint8_t)(field << 3);
+        } else {
+            encoded[encoded_size++] = (uint8_t)(0x80 | ((field << 3) & 0x7f));
+            encoded[encoded_size++] = (uint8_t)(field >> 4);
+        }
+
+        encoded[encoded_size++] = (uint8_t)(i & 0x7f);
+    }
+
+    for (i = 0; i < iterations; i++) {
+        message_p = micro_interleaved_new(&workspace[0], sizeof(workspace));
+        size = micro_interleaved_decode(message_p, &encoded[0], encoded_size);
+        assert(size == encoded_size);
+    }
+}
+
+static void interleaved_1_decode(int iterations)
+{
+    run_interleaved_decode(iterations, 1);
+}
+
+static void interleaved_8_decode(int iterations)
+{
+    run_interleaved_decode(iterations, 8);
+}
+
+static void interleaved_32_decode(int iterations)
+{
+    run_interleaved_decode(iterations, 32);
+}
+
+static int encode_varint(int size, uint64_t value)
+{
+    while (value >= 0x80) {
+        encoded[size++] = (uint8_t)(0x80 | (value & 0x7f));
+        value >>= 7;
+    }
+
+    encoded[size++] = (uint8_t)value;
+
+    return (size);
+}
+
+/* Given varint fields in reverse order, so all tags are dispatched
+   by the switch instead of being predicted. */
+static int encode_reversed_varint_fields(const int *field_numbers_p,
+                                         int length)
+{
+    int i;
+    int size;
+
+    size = 0;
+
+    for (i = length - 1; i >= 0; i--) {
+        size = encode_varint(size, (uint64_t)field_numbers_p[i] << 3);
+        size = encode_varint(size, (uint64_t)i);
+    }
+
+    return (size);
+}
+
+static void sub_message_reversed_decode(int iterations)
+{
+    int i;
+    struct benchmark_sub_message_t *message_p;
+    int size;
+    int encoded_size;
+    static const int field_numbers[] = {
+        1, 2, 3, 13, 14, 22, 204, 206, 207, 300
+    };
+
+    encoded_size = encode_reversed_varint_fields(
+        &field_numbers[0],
+        sizeof(field_numbers) / sizeof(field_numbers[0]));
+
+    for (i = 0; i < iterations; i++) {
+        message_p = benchmark_sub_message_new(&workspace[0],
+                                              sizeof(workspace));
+        size = benchmark_sub_message_decode(message_p,
+                                            &encoded[0],
+                                            (size_t)encoded_size);
+        assert(size == encoded_size);
+    }
+}
+
+static void sparse_reversed_decode(int iterations)
+{
+    int i;
+    struct micro_sparse_t *message_p;
+    int size;
+    int encoded_size;
+    int field_numbers[200];
+
+    for (i = 0; i < 200; i++) {
+        field_numbers[i] = (37 * i + 1);
+    }
+
+    encoded_size = encode_reversed_varint_fields(&field_numbers[0], 200);
+
+    for (i = 0; i < iterations; i++) {
+        message_p = micro_sparse_new(&workspace[0], sizeof(workspace));
+        size = micro_sparse_decode(message_p,
+                                   &encoded[0],
+                                   (size_t)encoded_size);
+        assert(size == encoded_size);
+    }
+}
+
+/* Fields unknown to the decoding schema, as sent by a producer using
+   a newer schema. Mostly varints of various lengths, with some packed
+   data in between. */
+static int encode_unknown_fields(void)
+{
+    int i;
+    int j;
+    int size;
+
+    size = 0;
+
+    for (i = 0; i < 1024; i++) {
+        if ((i % 16) == 15) {
+            /* Field 102, 64 bytes of packed data. */
+            encoded[size++] = 0xb2;
+            encoded[size++] = 0x06;
+            encoded[size++] = 64;
+
+            for (j = 0; j < 64; j++) {
+                encoded[size++] = (uint8_t)(0x80 | j);
+            }
+        } else {
+            /* Field 100 with a varint of 1 to 10 bytes. */
+            encoded[size++] = 0xa0;
+            encoded[size++] = 0x06;
+
+            for (j = 0; j < (i % 10); j++) {
+                encoded[size++] = 0xff;
+            }
+
+            encoded[size++] = 0x01;
+        }
+    }
+
+    return (size);
+}
+
+static void run_unknown_fields_skip(int iterations,
+                                    int simd,
+                                    const char *name_p)
+{
+    int i;
+    struct micro_varints_t *message_p;
+    int size;
+    int encoded_size;
+#if defined(__x86_64__)
+    uint64_t start;
+#endif
+
+    pbtools_simd_select(simd);
+    encoded_size = encode_unknown_fields();
+#if defined(__x86_64__)
+    start = __rdtsc();
+#endif
+
+    for (i = 0; i < iterations; i++) {
+        message_p = micro_varints_new(&workspace[0], sizeof(workspace));
+        size = micro_varints_decode(message_p, &encoded[0], encoded_size);
+        assert(size == encoded_size);
+    }
+
+#if defined(__x86_64__)
+    printf("%-32s %10.2f bytes/cycle\n",
+           name_p,
+           ((double)encoded_size * iterations) / (double)(__rdtsc() - start));
+#endif
+
+    pbtools_simd_select(PBTOOLS_SIMD_AVX2);
+}
+
+static void unknown_fields_skip(int iterations)
+{
+    run_unknown_fields_skip(iterations,
+                            PBTOOLS_SIMD_AVX2,
+                            "unknown_fields_skip");
+}
+
+static void unknown_fields_skip_no_simd(int iterations)
+{
+    run_unknown_fields_skip(iterations,
+                            PBTOOLS_SIMD_NONE,
+                            "unknown_fields_skip_no_simd");
+}
+
+static void run_floats(int iterations, int length, bool encode)
+{
+    int i;
+    struct micro_floats_t *message_p;
+    uint8_t *encoded_p;
+    uint8_t *workspace_p;
+    size_t size;
+    int encoded_size;
+    int res;
+
+    size = (sizeof(float) * (size_t)length + 16);
+    encoded_p = malloc(size);
+    workspace_p = malloc(size + 1024);
+    assert(encoded_p != NULL);
+    assert(workspace_p != NULL);
+    message_p = micro_floats_new(workspace_p, size + 1024);
+    micro_floats_values_alloc(message_p, length);
+
+    for (i = 0; i < length; i++) {
+        message_p->values.items_p[i] = (float)i;
+    }
+
+    encoded_size = micro_floats_encode(message_p, encoded_p, size);
+    assert(encoded_size > 0);
+
+    for (i = 0; i < iterations; i++) {
+        if (encode) {
+            res = micro_floats_encode(message_p, encoded_p, size);
+        } else {
+            message_p = micro_floats_new(workspace_p, size + 1024);
+            res = micro_floats_decode(message_p,
+                                      encoded_p,
+                                      (size_t)encoded_size);
+        }
+
+        assert(res == encoded_size);
+    }
+
+    free(encoded_p);
+    free(workspace_p);
+}
+
+/* Decode into given storage instead of the workspace if not NULL. */
+static void run_doubles_storage(int iterations,
+                                int length,
+                                bool encode,
+                                double *storage_p)
+{
+    int i;
+    struct micro_doubles_t *message_p;
+    uint8_t *encoded_p;
+    uint8_t *workspace_p;
+    size_t size;
+    int encoded_size;
+    int res;
+
+    size = (sizeof(double) * (size_t)length + 16);
+    encoded_p = malloc(size);
+    workspace_p = malloc(size + 1024);
+    assert(encoded_p != NULL);
+    assert(workspace_p != NULL);
+    message_p = micro_doubles_new(workspace_p, size + 1024);
+    micro_doubles_values_alloc(message_p, length);
+
+    for (i = 0; i < length; i++) {
+        message_p->values.items_p[i] = (double)i;
+    }
+
+    encoded_size = micro_doubles_encode(message_p, encoded_p, size);
+    assert(encoded_size > 0);
+
+    for (i = 0; i < iterations; i++) {
+        if (encode) {
+            res = micro_doubles_encode(message_p, encoded_p, size);
+        } else {
+            if (storage_p != NULL) {
+                /* Only the message is in the workspace. */
+                message_p = micro_doubles_new(workspace_p, 1024);
+                micro_doubles_values_set_storage(message_p, storage_p, length);
+            } else {
+                message_p = micro_doubles_new(workspace_p, size + 1024);
+            }
+
+            res = micro_doubles_decode(message_p,
+                                       encoded_p,
+                                       (size_t)encoded_size);
+        }
+
+        assert(res == encoded_size);
+    }
+
+    free(encoded_p);
+    free(workspace_p);
+}
+
+static void run_doubles(int iterations, int length, bool encode)
+{
+    run_doubles_storage(iterations, length, encode, NULL);
+}
+
+static void floats_1k_decode(int iterations)
+{
+    run_floats(iterations, 1 << 10, false);
+}
+
+static void floats_64k_decode(int iterations)
+{
+    run_floats(iterations, 1 << 16, false);
+}
+
+static void floats_1m_decode(int iterations)
+{
+    run_floats(iterations, 1 << 20, false);
+}
+
+static void floats_1k_encode(int iterations)
+{
+    run_floats(iterations, 1 << 10, true);
+}
+
+static void floats_64k_encode(int iterations)
+{
+    run_floats(iterations, 1 << 16, true);
+}
+
+static void floats_1m_encode(int iterations)
+{
+    run_floats(iterations, 1 << 20, true);
+}
+
+static void doubles_1k_decode(int iterations)
+{
+    run_doubles(iterations, 1 << 10, false);
+}
+
+static void doubles_64k_decode(int iterations)
+{
+    run_doubles(iterations, 1 << 16, false);
+}
+
+static void doubles_1m_decode(int iterations)
+{
+    run_doubles(iterations, 1 << 20, false);
+}
+
+static void doubles_1k_encode(int iterations)
+{
+    run_doubles(iterations, 1 << 10, true);
+}
+
+static void doubles_64k_encode(int iterations)
+{
+    run_doubles(iterations, 1 << 16, true);
+}
+
+static void doubles_1m_encode(int iterations)
+{
+    run_doubles(iterations, 1 << 20, true);
+}
+
+/* An almost 64 kB string of mostly ASCII text, validated as UTF-8 if
+   configured. */
+static void run_string_decode(int iterations, int simd)
+{
+    int i;
+    struct micro_string_t *message_p;
+    const char text[] = "The quick brown fox, \xc3\xa5\xc3\xa4\xc3\xb6 \xe2\x82\xac "
+        "\xf0\x9f\x98\x80, jumps over the lazy dog. ";
+    char *value_p;
+    size_t size;
+    int encoded_size;
+    int res;
+
+    pbtools_simd_select(simd);
+    size = (sizeof(encoded) - 16);
+    value_p = malloc(size + 1);
+    assert(value_p != NULL);
+
+    for (i = 0; i < (int)size; i++) {
+        value_p[i] = text[i % (int)(sizeof(text) - 1)];
+    }
+
+    /* Do not end with a partial sequence. */
+    while ((value_p[size - 1] & 0x80) != 0) {
+        value_p[size - 1] = '.';
+        size--;
+    }
+
+    value_p[size] = '\0';
+    message_p = micro_string_new(&workspace[0], sizeof(workspace));
+    message_p->value_p = value_p;
+    encoded_size = micro_string_encode(message_p,
+                                       &encoded[0],
+                                       sizeof(encoded));
+    assert(encoded_size > 0);
+
+    for (i = 0; i < iterations; i++) {
+        message_p = micro_string_new(&workspace[0], sizeof(workspace));
+        res = micro_string_decode(message_p,
+                                  &encoded[0],
+                                  (size_t)encoded_size);
+        assert(res == encoded_size);
+    }
+
+    free(value_p);
+    pbtools_simd_select(PBTOOLS_SIMD_AVX2);
+}
+
+static void string_64k_decode(int iterations)
+{
+    run_string_decode(iterations, PBTOOLS_SIMD_AVX2);
+}
+
+static void string_64k_decode_sse4_1(int iterations)
+{
+    run_string_decode(iterations, PBTOOLS_SIMD_SSE4_1);
+}
+
+static void string_64k_decode_no_simd(int iterations)
+{
+    run_string_decode(iterations, PBTOOLS_SIMD_NONE);
+}
+
+static void doubles_1m_decode_storage(int iterations)
+{
+    double *storage_p;
+
+    storage_p = malloc(sizeof(double) << 20);
+    assert(storage_p != NULL);
+    /* Fault in all pages, as a pre-allocated buffer would be. */
+    memset(storage_p, 0, sizeof(double) << 20);
+    run_doubles_storage(iterations, 1 << 20, false, storage_p);
+    free(storage_p);
+}
+
+static int records_encode(void)
+{
+    int i;
+    int size;
+    struct micro_records_t *message_p;
+    struct micro_record_t *item_p;
+
+    message_p = micro_records_new(&workspace[0], sizeof(workspace));
+    micro_records_records_alloc(message_p, 1000);
+
+    for (i = 0; i < 1000; i++) {
+        item_p = &message_p->records.items_p[i];
+        item_p->timestamp = (1600000000000 + i);
+        item_p->value = (double)i;
+        item_p->id = (i % 100);
+    }
+
+    size = micro_records_encode(message_p, &encoded[0], sizeof(encoded));
+    assert(size > 0);
+
+    return (size);
+}
+
+/* Records split into network buffer sized segments, decoded from the
+   segments, or after copying them to one buffer. */
+static void run_records_decode(int iterations, int segment_size, bool copy)
+{
+    int i;
+    int j;
+    struct micro_records_t *message_p;
+    struct pbtools_segment_t segments[64];
+    int number_of_segments;
+    static uint8_t linear[1 << 16];
+    int size;
+    int encoded_size;
+
+    encoded_size = records_encode();
+    number_of_segments = 0;
+
+    for (i = 0; i < encoded_size; i += segment_size) {
+        assert(number_of_segments < 64);
+        segments[number_of_segments].buf_p = &encoded[i];
+        segments[number_of_segments].size = (size_t)segment_size;
+
+        if (i + segment_size > encoded_size) {
+            segments[number_of_segments].size = (size_t)(encoded_size - i);
+        }
+
+        number_of_segments++;
+    }
+
+    for (i = 0; i < iterations; i++) {
+        message_p = micro_records_new(&workspace[0], sizeof(workspace));
+
+        if (copy) {
+            size = 0;
+
+            for (j = 0; j < number_of_segments; j++) {
+                memcpy(&linear[size], segments[j].buf_p, segments[j].size);
+                size += (int)segments[j].size;
+            }
+
+            size = micro_records_decode(message_p, &linear[0], (size_t)size);
+        } else {
+            size = micro_records_decode_segments(message_p,
+                                                 &segments[0],
+                                                 number_of_segments);
+        }
+
+        assert(size == encoded_size);
+    }
+}
+
+static void records_decode(int iterations)
+{
+    run_records_decode(iterations, sizeof(encoded), false);
+}
+
+static void records_segments_decode(int iterations)
+{
+    run_records_decode(iterations, 1500, false);
+}
+
+static void records_segments_copy_decode(int iterations)
+{
+    run_records_decode(iterations, 1500, true);
+}
+
+static double records_sum;
+
+/* Records decoded and the values of one id summed, either from the
+   items or from columns. */
+static void run_records_sum(int iterations, bool columns)
+{
+    int i;
+    int j;
+    struct micro_records_t *message_p;
+    struct micro_record_t *item_p;
+    struct micro_record_columns_t records;
+    struct micro_records_repeated_columns_t records_columns;
+    int size;
+    int encoded_size;
+
+    encoded_size = records_encode();
+    records_columns.records_p = &records;
+
+    for (i = 0; i < iterations; i++) {
+        message_p = micro_records_new(&workspace[0], sizeof(workspace));
+        records_sum = 0;
+
+        if (columns) {
+            size = micro_records_decode_columns(message_p,
+                                                &encoded[0],
+                                                (size_t)encoded_size,
+                                                &records_columns);
+
+            for (j = 0; j < records.length; j++) {
+                if (records.id.values_p[j] == 7) {
+                    records_sum += records.value.values_p[j];
+                }
+            }
+        } else {
+            size = micro_records_decode(message_p,
+                                        &encoded[0],
+                                        (size_t)encoded_size);
+
+            for (j = 0; j < message_p->records.length; j++) {
+                item_p = &message_p->records.items_p[j];
+
+                if (item_p->id == 7) {
+                    records_sum += item_p->value;
+                }
+            }
+        }
+
+        assert(size == encoded_size);
+        assert(records_sum == 4570.0);
+    }
+}
+
+/* Same sum as above read from views of the encoded records. */
+static void records_sum_view(int iterations)
+{
+    int i;
+    struct micro_records_view_t view;
+    struct micro_record_view_t record;
+    struct pbtools_view_iterator_t records;
+    int encoded_size;
+
+    encoded_size = records_encode();
+
+    for (i = 0; i < iterations; i++) {
+        micro_records_view_init(&view, &encoded[0], (size_t)encoded_size);
+        micro_records_view_records_begin(&view, &records);
+        records_sum = 0;
+
+        while (micro_records_view_records_next(&records, &record)) {
+            if (micro_record_view_get_id(&record) == 7) {
+                records_sum += micro_record_view_get_value(&record);
+            }
+        }
+
+        assert(micro_records_view_error(&view) == 0);
+        assert(records_sum == 4570.0);
+    }
+}
+
+static void records_sum_decode(int iterations)
+{
+    run_records_sum(iterations, false);
+}
+
+static void records_sum_decode_columns(int iterations)
+{
+    run_records_sum(iterations, true);
+}
+
+/* Records held as columns encoded, either after copying them into
+   items or directly from the columns. */
+static void run_records_encode(int iterations, bool columns)
+{
+    int i;
+    int j;
+    int size;
+    struct micro_records_t *message_p;
+    struct micro_record_t *item_p;
+    static int64_t timestamps[1000];
+    static double values[1000];
+    static int32_t ids[1000];
+    struct micro_record_columns_t records;
+    struct micro_records_repeated_columns_t records_columns;
+
+    for (i = 0; i < 1000; i++) {
+        timestamps[i] = (1600000000000 + i);
+        values[i] = (double)i;
+        ids[i] = (i % 100);
+    }
+
+    records.length = 1000;
+    records.timestamp.values_p = &timestamps[0];
+    records.timestamp.present_p = NULL;
+    records.value.values_p = &values[0];
+    records.value.present_p = NULL;
+    records.id.values_p = &ids[0];
+    records.id.present_p = NULL;
+    records_columns.records_p = &records;
+
+    for (i = 0; i < iterations; i++) {
+        message_p = micro_records_new(&workspace[0], sizeof(workspace));
+
+        if (columns) {
+            size = micro_records_encode_columns(message_p,
+                                                &encoded[0],
+                                                sizeof(encoded),
+                                                &records_columns);
+        } else {
+            micro_records_records_alloc(message_p, 1000);
+
+            for (j = 0; j < 1000; j++) {
+                item_p = &message_p->records.items_p[j];
+                item_p->timestamp = timestamps[j];
+                item_p->value = values[j];
+                item_p->id = ids[j];
+            }
+
+            size = micro_records_encode(message_p,
+                                        &encoded[0],
+                                        sizeof(encoded));
+        }
+
+        assert(size > 0);
+    }
+}
+
+static void records_items_encode(int iterations)
+{
+    run_records_encode(iterations, false);
+}
+
+static void records_columns_encode(int iterations)
+{
+    run_records_encode(iterations, true);
+}
+
+static const struct benchmark_t benchmarks[] = {
+    { "message1_decode", message1_decode, 1 },
+    { "message1_view", message1_view, 1 },
+    { "message1_all_fields_decode", message1_all_fields_decode, 1 },
+    { "message3_decode", message3_decode, 1 },
+    { "message3_padded_decode", message3_padded_decode, 1 },
+    { "varints_decode", varints_decode, 1 },
+    { "varints_decode_sse4_1", varints_decode_sse4_1, 1 },
+    { "varints_decode_no_simd", varints_decode_no_simd, 1 },
+    { "small_varints_decode", small_varints_decode, 1 },
+    { "small_varints_decode_no_simd", small_varints_decode_no_simd, 1 },
+    { "interleaved_1_decode", interleaved_1_decode, 1 },
+    { "interleaved_8_decode", interleaved_8_decode, 1 },
+    { "interleaved_32_decode", interleaved_32_decode, 1 },
+    { "sub_message_reversed_decode", sub_message_reversed_decode, 1 },
+    { "sparse_reversed_decode", sparse_reversed_decode, 1 },
+    { "unknown_fields_skip", unknown_fields_skip, 1 },
+    { "unknown_fields_skip_no_simd", unknown_fields_skip_no_simd, 1 },
+    { "floats_1k_decode", floats_1k_decode, 1 },
+    { "floats_64k_decode", floats_64k_decode, 64 },
+    { "floats_1m_decode", floats_1m_decode, 1024 },
+    { "floats_1k_encode", floats_1k_encode, 1 },
+    { "floats_64k_encode", floats_64k_encode, 64 },
+    { "floats_1m_encode", floats_1m_encode, 1024 },
+    { "doubles_1k_decode", doubles_1k_decode, 1 },
+    { "doubles_64k_decode", doubles_64k_decode, 64 },
+    { "doubles_1m_decode", doubles_1m_decode, 1024 },
+    { "doubles_1m_decode_storage", doubles_1m_decode_storage, 1024 },
+    { "doubles_1k_encode", doubles_1k_encode, 1 },
+    { "doubles_64k_encode", doubles_64k_encode, 64 },
+    { "doubles_1m_encode", doubles_1m_encode, 1024 },
+    { "string_64k_decode", string_64k_decode, 64 },
+    { "string_64k_decode_sse4_1", string_64k_decode_sse4_1, 64 },
+    { "string_64k_decode_no_simd", string_64k_decode_no_simd, 64 },
+    { "records_decode", records_decode, 16 },
+    { "records_segments_decode", records_segments_decode, 16 },
+    { "records_segments_copy_decode", records_segments_copy_decode, 16 },
+    { "records_sum_decode", records_sum_decode, 16 },
+    { "records_sum_decode_columns", records_sum_decode_columns, 16 },
+    { "records_sum_view", records_sum_view, 16 },
+    { "records_items_encode", records_items_encode, 16 },
+    { "records_columns_encode", records_columns_encode, 16 }
+};
+
+int main(int argc, const char *argv[])
+{
+    int iterations;
+    int divided_iterations;
+    size_t i;
+    double start;
+
+    if (argc < 2) {
+        return (1);
+    }
+
+    iterations = atoi(argv[1]);
+
+#if PBTOOLS_CONFIG_TRUSTED_INPUT == 1
+    printf("Trusted input:\n");
+#endif
+
+#if PBTOOLS_CONFIG_VALIDATE_UTF8 == 1
+    printf("Validate UTF-8:\n");
+#endif
+
+    for (i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++) {
+        if ((argc == 3) && (strcmp(argv[2], benchmarks[i].name_p) != 0)) {
+            continue;
+        }
+
+        divided_iterations = (iterations / benchmarks[i].divisor);
+
+        if (divided_iterations == 0) {
+            divided_iterations = 1;
+        }
+
+        start = now();
+        benchmarks[i].run(divided_iterations);
+        printf("%-32s %10.1f ns/iteration\n",
+               benchmarks[i].name_p,
+               (now() - start) / divided_iterations);
+    }
+
+    return (0);
+}
@@ -0,0 +1,9298 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by pbtools.
+ */
+
+#include <limits.h>
+#include "micro.h"
+
+#if CHAR_BIT != 8
+#    error "Number of bits in a char must be 8."
+#endif
+
+void micro_varints_init(
+    struct micro_varints_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->values.length = 0;
+}
+
+void micro_varints_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct micro_varints_t *self_p)
+{
+    pbtools_encoder_write_repeated_uint64(encoder_p, 1, &self_p->values);
+}
+
+void micro_varints_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct micro_varints_t *self_p)
+{
+    uint32_t key;
+    int wire_type;
+    struct pbtools_repeated_info_t repeated_info_values;
+
+    pbtools_repeated_info_init(&repeated_info_values, 1);
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_repeated_info_decode_uint64(
+                &repeated_info_values,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+            break;
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_uint64(
+                &repeated_info_values,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+
+    pbtools_decoder_decode_repeated_uint64(
+        decoder_p,
+        &repeated_info_values,
+        &self_p->values);
+}
+
+int micro_varints_values_alloc(
+    struct micro_varints_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_uint64(
+                &self_p->base,
+                length,
+                &self_p->values));
+}
+
+void micro_varints_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct micro_varints_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        micro_varints_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void micro_varints_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct micro_varints_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct micro_varints_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        micro_varints_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        micro_varints_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t micro_varints_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_VARINT, true }
+};
+
+void micro_varints_view_init(
+    struct micro_varints_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &micro_varints_view_fields[0],
+                      1,
+                      &self_p->offsets[0]);
+}
+
+int micro_varints_view_error(
+    struct micro_varints_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+void micro_varints_view_values_begin(
+    struct micro_varints_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 0);
+}
+
+bool micro_varints_view_values_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint64_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_uint64_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+struct micro_varints_t *
+micro_varints_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct micro_varints_t),
+                (pbtools_message_init_t)micro_varints_init));
+}
+
+int micro_varints_encode(
+    struct micro_varints_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)micro_varints_encode_inner));
+}
+
+int micro_varints_decode(
+    struct micro_varints_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)micro_varints_decode_inner));
+}
+
+int micro_varints_decode_padded(
+    struct micro_varints_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode_padded(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)micro_varints_decode_inner));
+}
+
+int micro_varints_decode_segments(
+    struct micro_varints_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)micro_varints_decode_inner));
+}
+
+int micro_varints_values_set_storage(
+    struct micro_varints_t *self_p,
+    uint64_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values,
+                items_p,
+                capacity));
+}
+
+void micro_interleaved_init(
+    struct micro_interleaved_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->values1.length = 0;
+    self_p->values2.length = 0;
+    self_p->values3.length = 0;
+    self_p->values4.length = 0;
+    self_p->values5.length = 0;
+    self_p->values6.length = 0;
+    self_p->values7.length = 0;
+    self_p->values8.length = 0;
+    self_p->values9.length = 0;
+    self_p->values10.length = 0;
+    self_p->values11.length = 0;
+    self_p->values12.length = 0;
+    self_p->values13.length = 0;
+    self_p->values14.length = 0;
+    self_p->values15.length = 0;
+    self_p->values16.length = 0;
+    self_p->values17.length = 0;
+    self_p->values18.length = 0;
+    self_p->values19.length = 0;
+    self_p->values20.length = 0;
+    self_p->values21.length = 0;
+    self_p->values22.length = 0;
+    self_p->values23.length = 0;
+    self_p->values24.length = 0;
+    self_p->values25.length = 0;
+    self_p->values26.length = 0;
+    self_p->values27.length = 0;
+    self_p->values28.length = 0;
+    self_p->values29.length = 0;
+    self_p->values30.length = 0;
+    self_p->values31.length = 0;
+    self_p->values32.length = 0;
+}
+
+void micro_interleaved_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct micro_interleaved_t *self_p)
+{
+    pbtools_encoder_write_repeated_int32(encoder_p, 32, &self_p->values32);
+    pbtools_encoder_write_repeated_int32(encoder_p, 31, &self_p->values31);
+    pbtools_encoder_write_repeated_int32(encoder_p, 30, &self_p->values30);
+    pbtools_encoder_write_repeated_int32(encoder_p, 29, &self_p->values29);
+    pbtools_encoder_write_repeated_int32(encoder_p, 28, &self_p->values28);
+    pbtools_encoder_write_repeated_int32(encoder_p, 27, &self_p->values27);
+    pbtools_encoder_write_repeated_int32(encoder_p, 26, &self_p->values26);
+    pbtools_encoder_write_repeated_int32(encoder_p, 25, &self_p->values25);
+    pbtools_encoder_write_repeated_int32(encoder_p, 24, &self_p->values24);
+    pbtools_encoder_write_repeated_int32(encoder_p, 23, &self_p->values23);
+    pbtools_encoder_write_repeated_int32(encoder_p, 22, &self_p->values22);
+    pbtools_encoder_write_repeated_int32(encoder_p, 21, &self_p->values21);
+    pbtools_encoder_write_repeated_int32(encoder_p, 20, &self_p->values20);
+    pbtools_encoder_write_repeated_int32(encoder_p, 19, &self_p->values19);
+    pbtools_encoder_write_repeated_int32(encoder_p, 18, &self_p->values18);
+    pbtools_encoder_write_repeated_int32(encoder_p, 17, &self_p->values17);
+    pbtools_encoder_write_repeated_int32(encoder_p, 16, &self_p->values16);
+    pbtools_encoder_write_repeated_int32(encoder_p, 15, &self_p->values15);
+    pbtools_encoder_write_repeated_int32(encoder_p, 14, &self_p->values14);
+    pbtools_encoder_write_repeated_int32(encoder_p, 13, &self_p->values13);
+    pbtools_encoder_write_repeated_int32(encoder_p, 12, &self_p->values12);
+    pbtools_encoder_write_repeated_int32(encoder_p, 11, &self_p->values11);
+    pbtools_encoder_write_repeated_int32(encoder_p, 10, &self_p->values10);
+    pbtools_encoder_write_repeated_int32(encoder_p, 9, &self_p->values9);
+    pbtools_encoder_write_repeated_int32(encoder_p, 8, &self_p->values8);
+    pbtools_encoder_write_repeated_int32(encoder_p, 7, &self_p->values7);
+    pbtools_encoder_write_repeated_int32(encoder_p, 6, &self_p->values6);
+    pbtools_encoder_write_repeated_int32(encoder_p, 5, &self_p->values5);
+    pbtools_encoder_write_repeated_int32(encoder_p, 4, &self_p->values4);
+    pbtools_encoder_write_repeated_int32(encoder_p, 3, &self_p->values3);
+    pbtools_encoder_write_repeated_int32(encoder_p, 2, &self_p->values2);
+    pbtools_encoder_write_repeated_int32(encoder_p, 1, &self_p->values1);
+}
+
+void micro_interleaved_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct micro_interleaved_t *self_p)
+{
+    uint32_t key;
+    int wire_type;
+    struct pbtools_repeated_info_t repeated_info_values1;
+    struct pbtools_repeated_info_t repeated_info_values2;
+    struct pbtools_repeated_info_t repeated_info_values3;
+    struct pbtools_repeated_info_t repeated_info_values4;
+    struct pbtools_repeated_info_t repeated_info_values5;
+    struct pbtools_repeated_info_t repeated_info_values6;
+    struct pbtools_repeated_info_t repeated_info_values7;
+    struct pbtools_repeated_info_t repeated_info_values8;
+    struct pbtools_repeated_info_t repeated_info_values9;
+    struct pbtools_repeated_info_t repeated_info_values10;
+    struct pbtools_repeated_info_t repeated_info_values11;
+    struct pbtools_repeated_info_t repeated_info_values12;
+    struct pbtools_repeated_info_t repeated_info_values13;
+    struct pbtools_repeated_info_t repeated_info_values14;
+    struct pbtools_repeated_info_t repeated_info_values15;
+    struct pbtools_repeated_info_t repeated_info_values16;
+    struct pbtools_repeated_info_t repeated_info_values17;
+    struct pbtools_repeated_info_t repeated_info_values18;
+    struct pbtools_repeated_info_t repeated_info_values19;
+    struct pbtools_repeated_info_t repeated_info_values20;
+    struct pbtools_repeated_info_t repeated_info_values21;
+    struct pbtools_repeated_info_t repeated_info_values22;
+    struct pbtools_repeated_info_t repeated_info_values23;
+    struct pbtools_repeated_info_t repeated_info_values24;
+    struct pbtools_repeated_info_t repeated_info_values25;
+    struct pbtools_repeated_info_t repeated_info_values26;
+    struct pbtools_repeated_info_t repeated_info_values27;
+    struct pbtools_repeated_info_t repeated_info_values28;
+    struct pbtools_repeated_info_t repeated_info_values29;
+    struct pbtools_repeated_info_t repeated_info_values30;
+    struct pbtools_repeated_info_t repeated_info_values31;
+    struct pbtools_repeated_info_t repeated_info_values32;
+
+    pbtools_repeated_info_init(&repeated_info_values1, 1);
+    pbtools_repeated_info_init(&repeated_info_values2, 2);
+    pbtools_repeated_info_init(&repeated_info_values3, 3);
+    pbtools_repeated_info_init(&repeated_info_values4, 4);
+    pbtools_repeated_info_init(&repeated_info_values5, 5);
+    pbtools_repeated_info_init(&repeated_info_values6, 6);
+    pbtools_repeated_info_init(&repeated_info_values7, 7);
+    pbtools_repeated_info_init(&repeated_info_values8, 8);
+    pbtools_repeated_info_init(&repeated_info_values9, 9);
+    pbtools_repeated_info_init(&repeated_info_values10, 10);
+    pbtools_repeated_info_init(&repeated_info_values11, 11);
+    pbtools_repeated_info_init(&repeated_info_values12, 12);
+    pbtools_repeated_info_init(&repeated_info_values13, 13);
+    pbtools_repeated_info_init(&repeated_info_values14, 14);
+    pbtools_repeated_info_init(&repeated_info_values15, 15);
+    pbtools_repeated_info_init(&repeated_info_values16, 16);
+    pbtools_repeated_info_init(&repeated_info_values17, 17);
+    pbtools_repeated_info_init(&repeated_info_values18, 18);
+    pbtools_repeated_info_init(&repeated_info_values19, 19);
+    pbtools_repeated_info_init(&repeated_info_values20, 20);
+    pbtools_repeated_info_init(&repeated_info_values21, 21);
+    pbtools_repeated_info_init(&repeated_info_values22, 22);
+    pbtools_repeated_info_init(&repeated_info_values23, 23);
+    pbtools_repeated_info_init(&repeated_info_values24, 24);
+    pbtools_repeated_info_init(&repeated_info_values25, 25);
+    pbtools_repeated_info_init(&repeated_info_values26, 26);
+    pbtools_repeated_info_init(&repeated_info_values27, 27);
+    pbtools_repeated_info_init(&repeated_info_values28, 28);
+    pbtools_repeated_info_init(&repeated_info_values29, 29);
+    pbtools_repeated_info_init(&repeated_info_values30, 30);
+    pbtools_repeated_info_init(&repeated_info_values31, 31);
+    pbtools_repeated_info_init(&repeated_info_values32, 32);
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values1,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_2;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values1,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_2:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values2,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_3;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values2,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_3:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values3,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_4;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values3,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_4:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values4,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  5,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_5;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values4,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_5:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values5,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  6,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_6;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values5,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_6:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values6,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  7,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_7;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values6,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(7, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_7:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values7,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  8,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_8;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(7, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values7,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(8, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_8:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values8,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  9,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_9;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(8, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values8,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(9, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_9:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values9,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  10,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_10;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(9, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values9,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(10, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_10:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values10,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  11,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_11;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(10, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values10,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(11, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_11:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values11,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  12,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_12;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(11, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values11,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(12, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_12:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values12,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  13,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_13;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(12, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values12,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(13, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_13:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values13,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  14,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_14;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(13, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values13,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(14, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_14:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values14,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  15,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_15;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(14, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values14,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(15, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_15:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values15,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  16,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_16;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(15, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values15,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(16, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_16:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values16,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  17,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_17;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(16, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values16,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(17, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_17:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values17,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  18,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_18;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(17, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values17,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(18, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_18:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values18,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  19,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_19;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(18, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values18,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(19, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_19:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values19,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  20,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_20;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(19, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values19,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(20, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_20:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values20,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  21,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_21;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(20, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values20,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(21, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_21:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values21,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  22,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_22;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(21, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values21,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(22, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_22:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values22,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  23,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_23;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(22, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values22,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(23, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_23:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values23,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  24,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_24;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(23, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values23,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(24, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_24:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values24,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  25,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_25;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(24, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values24,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(25, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_25:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values25,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  26,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_26;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(25, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values25,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(26, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_26:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values26,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  27,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_27;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(26, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values26,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(27, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_27:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values27,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  28,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_28;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(27, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values27,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(28, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_28:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values28,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  29,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_29;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(28, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values28,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(29, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_29:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values29,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  30,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_30;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(29, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values29,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(30, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_30:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values30,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  31,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_31;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(30, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values30,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(31, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_31:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values31,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  32,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_32;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(31, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values31,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(32, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_32:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values32,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+            break;
+
+        case PBTOOLS_KEY(32, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_values32,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+            case 7:
+            case 8:
+            case 9:
+            case 10:
+            case 11:
+            case 12:
+            case 13:
+            case 14:
+            case 15:
+            case 16:
+            case 17:
+            case 18:
+            case 19:
+            case 20:
+            case 21:
+            case 22:
+            case 23:
+            case 24:
+            case 25:
+            case 26:
+            case 27:
+            case 28:
+            case 29:
+            case 30:
+            case 31:
+            case 32:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values1,
+        &self_p->values1);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values2,
+        &self_p->values2);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values3,
+        &self_p->values3);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values4,
+        &self_p->values4);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values5,
+        &self_p->values5);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values6,
+        &self_p->values6);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values7,
+        &self_p->values7);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values8,
+        &self_p->values8);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values9,
+        &self_p->values9);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values10,
+        &self_p->values10);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values11,
+        &self_p->values11);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values12,
+        &self_p->values12);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values13,
+        &self_p->values13);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values14,
+        &self_p->values14);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values15,
+        &self_p->values15);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values16,
+        &self_p->values16);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values17,
+        &self_p->values17);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values18,
+        &self_p->values18);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values19,
+        &self_p->values19);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values20,
+        &self_p->values20);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values21,
+        &self_p->values21);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values22,
+        &self_p->values22);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values23,
+        &self_p->values23);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values24,
+        &self_p->values24);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values25,
+        &self_p->values25);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values26,
+        &self_p->values26);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values27,
+        &self_p->values27);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values28,
+        &self_p->values28);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values29,
+        &self_p->values29);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values30,
+        &self_p->values30);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values31,
+        &self_p->values31);
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_values32,
+        &self_p->values32);
+}
+
+int micro_interleaved_values1_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values1));
+}
+
+int micro_interleaved_values2_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values2));
+}
+
+int micro_interleaved_values3_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values3));
+}
+
+int micro_interleaved_values4_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values4));
+}
+
+int micro_interleaved_values5_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values5));
+}
+
+int micro_interleaved_values6_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values6));
+}
+
+int micro_interleaved_values7_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values7));
+}
+
+int micro_interleaved_values8_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values8));
+}
+
+int micro_interleaved_values9_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values9));
+}
+
+int micro_interleaved_values10_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values10));
+}
+
+int micro_interleaved_values11_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values11));
+}
+
+int micro_interleaved_values12_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values12));
+}
+
+int micro_interleaved_values13_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values13));
+}
+
+int micro_interleaved_values14_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values14));
+}
+
+int micro_interleaved_values15_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values15));
+}
+
+int micro_interleaved_values16_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values16));
+}
+
+int micro_interleaved_values17_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values17));
+}
+
+int micro_interleaved_values18_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values18));
+}
+
+int micro_interleaved_values19_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values19));
+}
+
+int micro_interleaved_values20_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values20));
+}
+
+int micro_interleaved_values21_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values21));
+}
+
+int micro_interleaved_values22_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values22));
+}
+
+int micro_interleaved_values23_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values23));
+}
+
+int micro_interleaved_values24_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values24));
+}
+
+int micro_interleaved_values25_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values25));
+}
+
+int micro_interleaved_values26_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values26));
+}
+
+int micro_interleaved_values27_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values27));
+}
+
+int micro_interleaved_values28_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values28));
+}
+
+int micro_interleaved_values29_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values29));
+}
+
+int micro_interleaved_values30_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values30));
+}
+
+int micro_interleaved_values31_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values31));
+}
+
+int micro_interleaved_values32_alloc(
+    struct micro_interleaved_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->values32));
+}
+
+void micro_interleaved_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct micro_interleaved_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        micro_interleaved_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void micro_interleaved_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct micro_interleaved_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct micro_interleaved_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        micro_interleaved_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        micro_interleaved_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t micro_interleaved_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 2, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 3, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 4, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 5, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 6, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 7, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 8, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 9, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 10, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 11, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 12, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 13, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 14, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 15, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 16, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 17, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 18, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 19, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 20, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 21, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 22, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 23, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 24, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 25, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 26, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 27, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 28, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 29, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 30, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 31, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 32, PBTOOLS_WIRE_TYPE_VARINT, true }
+};
+
+void micro_interleaved_view_init(
+    struct micro_interleaved_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &micro_interleaved_view_fields[0],
+                      32,
+                      &self_p->offsets[0]);
+}
+
+int micro_interleaved_view_error(
+    struct micro_interleaved_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+void micro_interleaved_view_values1_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 0);
+}
+
+bool micro_interleaved_view_values1_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values2_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 1);
+}
+
+bool micro_interleaved_view_values2_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values3_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 2);
+}
+
+bool micro_interleaved_view_values3_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values4_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 3);
+}
+
+bool micro_interleaved_view_values4_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values5_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 4);
+}
+
+bool micro_interleaved_view_values5_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values6_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 5);
+}
+
+bool micro_interleaved_view_values6_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values7_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 6);
+}
+
+bool micro_interleaved_view_values7_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values8_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 7);
+}
+
+bool micro_interleaved_view_values8_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values9_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 8);
+}
+
+bool micro_interleaved_view_values9_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values10_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 9);
+}
+
+bool micro_interleaved_view_values10_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values11_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 10);
+}
+
+bool micro_interleaved_view_values11_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values12_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 11);
+}
+
+bool micro_interleaved_view_values12_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values13_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 12);
+}
+
+bool micro_interleaved_view_values13_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values14_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 13);
+}
+
+bool micro_interleaved_view_values14_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values15_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 14);
+}
+
+bool micro_interleaved_view_values15_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values16_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 15);
+}
+
+bool micro_interleaved_view_values16_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values17_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 16);
+}
+
+bool micro_interleaved_view_values17_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values18_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 17);
+}
+
+bool micro_interleaved_view_values18_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values19_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 18);
+}
+
+bool micro_interleaved_view_values19_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values20_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 19);
+}
+
+bool micro_interleaved_view_values20_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values21_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 20);
+}
+
+bool micro_interleaved_view_values21_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values22_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 21);
+}
+
+bool micro_interleaved_view_values22_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values23_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 22);
+}
+
+bool micro_interleaved_view_values23_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values24_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 23);
+}
+
+bool micro_interleaved_view_values24_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values25_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 24);
+}
+
+bool micro_interleaved_view_values25_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values26_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 25);
+}
+
+bool micro_interleaved_view_values26_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values27_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 26);
+}
+
+bool micro_interleaved_view_values27_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values28_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 27);
+}
+
+bool micro_interleaved_view_values28_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values29_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 28);
+}
+
+bool micro_interleaved_view_values29_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values30_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 29);
+}
+
+bool micro_interleaved_view_values30_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values31_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 30);
+}
+
+bool micro_interleaved_view_values31_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void micro_interleaved_view_values32_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 31);
+}
+
+bool micro_interleaved_view_values32_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+struct micro_interleaved_t *
+micro_interleaved_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct micro_interleaved_t),
+                (pbtools_message_init_t)micro_interleaved_init));
+}
+
+int micro_interleaved_encode(
+    struct micro_interleaved_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)micro_interleaved_encode_inner));
+}
+
+int micro_interleaved_decode(
+    struct micro_interleaved_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)micro_interleaved_decode_inner));
+}
+
+int micro_interleaved_decode_padded(
+    struct micro_interleaved_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode_padded(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)micro_interleaved_decode_inner));
+}
+
+int micro_interleaved_decode_segments(
+    struct micro_interleaved_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)micro_interleaved_decode_inner));
+}
+
+int micro_interleaved_values1_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values1,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values2_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values2,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values3_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values3,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values4_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values4,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values5_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values5,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values6_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values6,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values7_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values7,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values8_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values8,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values9_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values9,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values10_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values10,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values11_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values11,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values12_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values12,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values13_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values13,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values14_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values14,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values15_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values15,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values16_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values16,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values17_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values17,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values18_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values18,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values19_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values19,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values20_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values20,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values21_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values21,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values22_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values22,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values23_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values23,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values24_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values24,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values25_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values25,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values26_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values26,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values27_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values27,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values28_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values28,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values29_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values29,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values30_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values30,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values31_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values31,
+                items_p,
+                capacity));
+}
+
+int micro_interleaved_values32_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values32,
+                items_p,
+                capacity));
+}
+
+void micro_floats_init(
+    struct micro_floats_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->values.length = 0;
+}
+
+void micro_floats_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct micro_floats_t *self_p)
+{
+    pbtools_encoder_write_repeated_float(encoder_p, 1, &self_p->values);
+}
+
+void micro_floats_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct micro_floats_t *self_p)
+{
+    uint32_t key;
+    int wire_type;
+    struct pbtools_repeated_info_t repeated_info_values;
+
+    pbtools_repeated_info_init(&repeated_info_values, 1);
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_repeated_info_decode_float(
+                &repeated_info_values,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+            break;
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_32_BIT):
+            pbtools_repeated_info_decode_float(
+                &repeated_info_values,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_32_BIT);
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+
+    pbtools_decoder_decode_repeated_float(
+        decoder_p,
+        &repeated_info_values,
+        &self_p->values);
+}
+
+int micro_floats_values_alloc(
+    struct micro_floats_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_float(
+                &self_p->base,
+                length,
+                &self_p->values));
+}
+
+void micro_floats_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct micro_floats_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        micro_floats_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void micro_floats_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct micro_floats_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct micro_floats_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        micro_floats_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        micro_floats_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t micro_floats_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_32_BIT, true }
+};
+
+void micro_floats_view_init(
+    struct micro_floats_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &micro_floats_view_fields[0],
+                      1,
+                      &self_p->offsets[0]);
+}
+
+int micro_floats_view_error(
+    struct micro_floats_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+void micro_floats_view_values_begin(
+    struct micro_floats_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 0);
+}
+
+bool micro_floats_view_values_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    float *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_float_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+struct micro_floats_t *
+micro_floats_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct micro_floats_t),
+                (pbtools_message_init_t)micro_floats_init));
+}
+
+int micro_floats_encode(
+    struct micro_floats_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)micro_floats_encode_inner));
+}
+
+int micro_floats_decode(
+    struct micro_floats_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)micro_floats_decode_inner));
+}
+
+int micro_floats_decode_padded(
+    struct micro_floats_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode_padded(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)micro_floats_decode_inner));
+}
+
+int micro_floats_decode_segments(
+    struct micro_floats_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)micro_floats_decode_inner));
+}
+
+int micro_floats_values_set_storage(
+    struct micro_floats_t *self_p,
+    float *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values,
+                items_p,
+                capacity));
+}
+
+void micro_doubles_init(
+    struct micro_doubles_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->values.length = 0;
+}
+
+void micro_doubles_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct micro_doubles_t *self_p)
+{
+    pbtools_encoder_write_repeated_double(encoder_p, 1, &self_p->values);
+}
+
+void micro_doubles_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct micro_doubles_t *self_p)
+{
+    uint32_t key;
+    int wire_type;
+    struct pbtools_repeated_info_t repeated_info_values;
+
+    pbtools_repeated_info_init(&repeated_info_values, 1);
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_repeated_info_decode_double(
+                &repeated_info_values,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+            break;
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_64_BIT):
+            pbtools_repeated_info_decode_double(
+                &repeated_info_values,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_64_BIT);
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+
+    pbtools_decoder_decode_repeated_double(
+        decoder_p,
+        &repeated_info_values,
+        &self_p->values);
+}
+
+int micro_doubles_values_alloc(
+    struct micro_doubles_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_double(
+                &self_p->base,
+                length,
+                &self_p->values));
+}
+
+void micro_doubles_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct micro_doubles_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        micro_doubles_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void micro_doubles_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct micro_doubles_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct micro_doubles_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        micro_doubles_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        micro_doubles_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t micro_doubles_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_64_BIT, true }
+};
+
+void micro_doubles_view_init(
+    struct micro_doubles_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &micro_doubles_view_fields[0],
+                      1,
+                      &self_p->offsets[0]);
+}
+
+int micro_doubles_view_error(
+    struct micro_doubles_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+void micro_doubles_view_values_begin(
+    struct micro_doubles_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 0);
+}
+
+bool micro_doubles_view_values_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    double *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_double_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+struct micro_doubles_t *
+micro_doubles_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct micro_doubles_t),
+                (pbtools_message_init_t)micro_doubles_init));
+}
+
+int micro_doubles_encode(
+    struct micro_doubles_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)micro_doubles_encode_inner));
+}
+
+int micro_doubles_decode(
+    struct micro_doubles_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)micro_doubles_decode_inner));
+}
+
+int micro_doubles_decode_padded(
+    struct micro_doubles_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode_padded(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)micro_doubles_decode_inner));
+}
+
+int micro_doubles_decode_segments(
+    struct micro_doubles_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)micro_doubles_decode_inner));
+}
+
+int micro_doubles_values_set_storage(
+    struct micro_doubles_t *self_p,
+    double *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->values,
+                items_p,
+                capacity));
+}
+
+void micro_sparse_init(
+    struct micro_sparse_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->field1 = 0;
+    self_p->field38 = 0;
+    self_p->field75 = 0;
+    self_p->field112 = 0;
+    self_p->field149 = 0;
+    self_p->field186 = 0;
+    self_p->field223 = 0;
+    self_p->field260 = 0;
+    self_p->field297 = 0;
+    self_p->field334 = 0;
+    self_p->field371 = 0;
+    self_p->field408 = 0;
+    self_p->field445 = 0;
+    self_p->field482 = 0;
+    self_p->field519 = 0;
+    self_p->field556 = 0;
+    self_p->field593 = 0;
+    self_p->field630 = 0;
+    self_p->field667 = 0;
+    self_p->field704 = 0;
+    self_p->field741 = 0;
+    self_p->field778 = 0;
+    self_p->field815 = 0;
+    self_p->field852 = 0;
+    self_p->field889 = 0;
+    self_p->field926 = 0;
+    self_p->field963 = 0;
+    self_p->field1000 = 0;
+    self_p->field1037 = 0;
+    self_p->field1074 = 0;
+    self_p->field1111 = 0;
+    self_p->field1148 = 0;
+    self_p->field1185 = 0;
+    self_p->field1222 = 0;
+    self_p->field1259 = 0;
+    self_p->field1296 = 0;
+    self_p->field1333 = 0;
+    self_p->field1370 = 0;
+    self_p->field1407 = 0;
+    self_p->field1444 = 0;
+    self_p->field1481 = 0;
+    self_p->field1518 = 0;
+    self_p->field1555 = 0;
+    self_p->field1592 = 0;
+    self_p->field1629 = 0;
+    self_p->field1666 = 0;
+    self_p->field1703 = 0;
+    self_p->field1740 = 0;
+    self_p->field1777 = 0;
+    self_p->field1814 = 0;
+    self_p->field1851 = 0;
+    self_p->field1888 = 0;
+    self_p->field1925 = 0;
+    self_p->field1962 = 0;
+    self_p->field1999 = 0;
+    self_p->field2036 = 0;
+    self_p->field2073 = 0;
+    self_p->field2110 = 0;
+    self_p->field2147 = 0;
+    self_p->field2184 = 0;
+    self_p->field2221 = 0;
+    self_p->field2258 = 0;
+    self_p->field2295 = 0;
+    self_p->field2332 = 0;
+    self_p->field2369 = 0;
+    self_p->field2406 = 0;
+    self_p->field2443 = 0;
+    self_p->field2480 = 0;
+    self_p->field2517 = 0;
+    self_p->field2554 = 0;
+    self_p->field2591 = 0;
+    self_p->field2628 = 0;
+    self_p->field2665 = 0;
+    self_p->field2702 = 0;
+    self_p->field2739 = 0;
+    self_p->field2776 = 0;
+    self_p->field2813 = 0;
+    self_p->field2850 = 0;
+    self_p->field2887 = 0;
+    self_p->field2924 = 0;
+    self_p->field2961 = 0;
+    self_p->field2998 = 0;
+    self_p->field3035 = 0;
+    self_p->field3072 = 0;
+    self_p->field3109 = 0;
+    self_p->field3146 = 0;
+    self_p->field3183 = 0;
+    self_p->field3220 = 0;
+    self_p->field3257 = 0;
+    self_p->field3294 = 0;
+    self_p->field3331 = 0;
+    self_p->field3368 = 0;
+    self_p->field3405 = 0;
+    self_p->field3442 = 0;
+    self_p->field3479 = 0;
+    self_p->field3516 = 0;
+    self_p->field3553 = 0;
+    self_p->field3590 = 0;
+    self_p->field3627 = 0;
+    self_p->field3664 = 0;
+    self_p->field3701 = 0;
+    self_p->field3738 = 0;
+    self_p->field3775 = 0;
+    self_p->field3812 = 0;
+    self_p->field3849 = 0;
+    self_p->field3886 = 0;
+    self_p->field3923 = 0;
+    self_p->field3960 = 0;
+    self_p->field3997 = 0;
+    self_p->field4034 = 0;
+    self_p->field4071 = 0;
+    self_p->field4108 = 0;
+    self_p->field4145 = 0;
+    self_p->field4182 = 0;
+    self_p->field4219 = 0;
+    self_p->field4256 = 0;
+    self_p->field4293 = 0;
+    self_p->field4330 = 0;
+    self_p->field4367 = 0;
+    self_p->field4404 = 0;
+    self_p->field4441 = 0;
+    self_p->field4478 = 0;
+    self_p->field4515 = 0;
+    self_p->field4552 = 0;
+    self_p->field4589 = 0;
+    self_p->field4626 = 0;
+    self_p->field4663 = 0;
+    self_p->field4700 = 0;
+    self_p->field4737 = 0;
+    self_p->field4774 = 0;
+    self_p->field4811 = 0;
+    self_p->field4848 = 0;
+    self_p->field4885 = 0;
+    self_p->field4922 = 0;
+    self_p->field4959 = 0;
+    self_p->field4996 = 0;
+    self_p->field5033 = 0;
+    self_p->field5070 = 0;
+    self_p->field5107 = 0;
+    self_p->field5144 = 0;
+    self_p->field5181 = 0;
+    self_p->field5218 = 0;
+    self_p->field5255 = 0;
+    self_p->field5292 = 0;
+    self_p->field5329 = 0;
+    self_p->field5366 = 0;
+    self_p->field5403 = 0;
+    self_p->field5440 = 0;
+    self_p->field5477 = 0;
+    self_p->field5514 = 0;
+    self_p->field5551 = 0;
+    self_p->field5588 = 0;
+    self_p->field5625 = 0;
+    self_p->field5662 = 0;
+    self_p->field5699 = 0;
+    self_p->field5736 = 0;
+    self_p->field5773 = 0;
+    self_p->field5810 = 0;
+    self_p->field5847 = 0;
+    self_p->field5884 = 0;
+    self_p->field5921 = 0;
+    self_p->field5958 = 0;
+    self_p->field5995 = 0;
+    self_p->field6032 = 0;
+    self_p->field6069 = 0;
+    self_p->field6106 = 0;
+    self_p->field6143 = 0;
+    self_p->field6180 = 0;
+    self_p->field6217 = 0;
+    self_p->field6254 = 0;
+    self_p->field6291 = 0;
+    self_p->field6328 = 0;
+    self_p->field6365 = 0;
+    self_p->field6402 = 0;
+    self_p->field6439 = 0;
+    self_p->field6476 = 0;
+    self_p->field6513 = 0;
+    self_p->field6550 = 0;
+    self_p->field6587 = 0;
+    self_p->field6624 = 0;
+    self_p->field6661 = 0;
+    self_p->field6698 = 0;
+    self_p->field6735 = 0;
+    self_p->field6772 = 0;
+    self_p->field6809 = 0;
+    self_p->field6846 = 0;
+    self_p->field6883 = 0;
+    self_p->field6920 = 0;
+    self_p->field6957 = 0;
+    self_p->field6994 = 0;
+    self_p->field7031 = 0;
+    self_p->field7068 = 0;
+    self_p->field7105 = 0;
+    self_p->field7142 = 0;
+    self_p->field7179 = 0;
+    self_p->field7216 = 0;
+    self_p->field7253 = 0;
+    self_p->field7290 = 0;
+    self_p->field7327 = 0;
+    self_p->field7364 = 0;
+}
+
+void micro_sparse_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct micro_sparse_t *self_p)
+{
+    pbtools_encoder_write_int32(encoder_p, 7364, self_p->field7364);
+    pbtools_encoder_write_int32(encoder_p, 7327, self_p->field7327);
+    pbtools_encoder_write_int32(encoder_p, 7290, self_p->field7290);
+    pbtools_encoder_write_int32(encoder_p, 7253, self_p->field7253);
+    pbtools_encoder_write_int32(encoder_p, 7216, self_p->field7216);
+    pbtools_encoder_write_int32(encoder_p, 7179, self_p->field7179);
+    pbtools_encoder_write_int32(encoder_p, 7142, self_p->field7142);
+    pbtools_encoder_write_int32(encoder_p, 7105, self_p->field7105);
+    pbtools_encoder_write_int32(encoder_p, 7068, self_p->field7068);
+    pbtools_encoder_write_int32(encoder_p, 7031, self_p->field7031);
+    pbtools_encoder_write_int32(encoder_p, 6994, self_p->field6994);
+    pbtools_encoder_write_int32(encoder_p, 6957, self_p->field6957);
+    pbtools_encoder_write_int32(encoder_p, 6920, self_p->field6920);
+    pbtools_encoder_write_int32(encoder_p, 6883, self_p->field6883);
+    pbtools_encoder_write_int32(encoder_p, 6846, self_p->field6846);
+    pbtools_encoder_write_int32(encoder_p, 6809, self_p->field6809);
+    pbtools_encoder_write_int32(encoder_p, 6772, self_p->field6772);
+    pbtools_encoder_write_int32(encoder_p, 6735, self_p->field6735);
+    pbtools_encoder_write_int32(encoder_p, 6698, self_p->field6698);
+    pbtools_encoder_write_int32(encoder_p, 6661, self_p->field6661);
+    pbtools_encoder_write_int32(encoder_p, 6624, self_p->field6624);
+    pbtools_encoder_write_int32(encoder_p, 6587, self_p->field6587);
+    pbtools_encoder_write_int32(encoder_p, 6550, self_p->field6550);
+    pbtools_encoder_write_int32(encoder_p, 6513, self_p->field6513);
+    pbtools_encoder_write_int32(encoder_p, 6476, self_p->field6476);
+    pbtools_encoder_write_int32(encoder_p, 6439, self_p->field6439);
+    pbtools_encoder_write_int32(encoder_p, 6402, self_p->field6402);
+    pbtools_encoder_write_int32(encoder_p, 6365, self_p->field6365);
+    pbtools_encoder_write_int32(encoder_p, 6328, self_p->field6328);
+    pbtools_encoder_write_int32(encoder_p, 6291, self_p->field6291);
+    pbtools_encoder_write_int32(encoder_p, 6254, self_p->field6254);
+    pbtools_encoder_write_int32(encoder_p, 6217, self_p->field6217);
+    pbtools_encoder_write_int32(encoder_p, 6180, self_p->field6180);
+    pbtools_encoder_write_int32(encoder_p, 6143, self_p->field6143);
+    pbtools_encoder_write_int32(encoder_p, 6106, self_p->field6106);
+    pbtools_encoder_write_int32(encoder_p, 6069, self_p->field6069);
+    pbtools_encoder_write_int32(encoder_p, 6032, self_p->field6032);
+    pbtools_encoder_write_int32(encoder_p, 5995, self_p->field5995);
+    pbtools_encoder_write_int32(encoder_p, 5958, self_p->field5958);
+    pbtools_encoder_write_int32(encoder_p, 5921, self_p->field5921);
+    pbtools_encoder_write_int32(encoder_p, 5884, self_p->field5884);
+    pbtools_encoder_write_int32(encoder_p, 5847, self_p->field5847);
+    pbtools_encoder_write_int32(encoder_p, 5810, self_p->field5810);
+    pbtools_encoder_write_int32(encoder_p, 5773, self_p->field5773);
+    pbtools_encoder_write_int32(encoder_p, 5736, self_p->field5736);
+    pbtools_encoder_write_int32(encoder_p, 5699, self_p->field5699);
+    pbtools_encoder_write_int32(encoder_p, 5662, self_p->field5662);
+    pbtools_encoder_write_int32(encoder_p, 5625, self_p->field5625);
+    pbtools_encoder_write_int32(encoder_p, 5588, self_p->field5588);
+    pbtools_encoder_write_int32(encoder_p, 5551, self_p->field5551);
+    pbtools_encoder_write_int32(encoder_p, 5514, self_p->field5514);
+    pbtools_encoder_write_int32(encoder_p, 5477, self_p->field5477);
+    pbtools_encoder_write_int32(encoder_p, 5440, self_p->field5440);
+    pbtools_encoder_write_int32(encoder_p, 5403, self_p->field5403);
+    pbtools_encoder_write_int32(encoder_p, 5366, self_p->field5366);
+    pbtools_encoder_write_int32(encoder_p, 5329, self_p->field5329);
+    pbtools_encoder_write_int32(encoder_p, 5292, self_p->field5292);
+    pbtools_encoder_write_int32(encoder_p, 5255, self_p->field5255);
+    pbtools_encoder_write_int32(encoder_p, 5218, self_p->field5218);
+    pbtools_encoder_write_int32(encoder_p, 5181, self_p->field5181);
+    pbtools_encoder_write_int32(encoder_p, 5144, self_p->field5144);
+    pbtools_encoder_write_int32(encoder_p, 5107, self_p->field5107);
+    pbtools_encoder_write_int32(encoder_p, 5070, self_p->field5070);
+    pbtools_encoder_write_int32(encoder_p, 5033, self_p->field5033);
+    pbtools_encoder_write_int32(encoder_p, 4996, self_p->field4996);
+    pbtools_encoder_write_int32(encoder_p, 4959, self_p->field4959);
+    pbtools_encoder_write_int32(encoder_p, 4922, self_p->field4922);
+    pbtools_encoder_write_int32(encoder_p, 4885, self_p->field4885);
+    pbtools_encoder_write_int32(encoder_p, 4848, self_p->field4848);
+    pbtools_encoder_write_int32(encoder_p, 4811, self_p->field4811);
+    pbtools_encoder_write_int32(encoder_p, 4774, self_p->field4774);
+    pbtools_encoder_write_int32(encoder_p, 4737, self_p->field4737);
+    pbtools_encoder_write_int32(encoder_p, 4700, self_p->field4700);
+    pbtools_encoder_write_int32(encoder_p, 4663, self_p->field4663);
+    pbtools_encoder_write_int32(encoder_p, 4626, self_p->field4626);
+    pbtools_encoder_write_int32(encoder_p, 4589, self_p->field4589);
+    pbtools_encoder_write_int32(encoder_p, 4552, self_p->field4552);
+    pbtools_encoder_write_int32(encoder_p, 4515, self_p->field4515);
+    pbtools_encoder_write_int32(encoder_p, 4478, self_p->field4478);
+    pbtools_encoder_write_int32(encoder_p, 4441, self_p->field4441);
+    pbtools_encoder_write_int32(encoder_p, 4404, self_p->field4404);
+    pbtools_encoder_write_int32(encoder_p, 4367, self_p->field4367);
+    pbtools_encoder_write_int32(encoder_p, 4330, self_p->field4330);
+    pbtools_encoder_write_int32(encoder_p, 4293, self_p->field4293);
+    pbtools_encoder_write_int32(encoder_p, 4256, self_p->field4256);
+    pbtools_encoder_write_int32(encoder_p, 4219, self_p->field4219);
+    pbtools_encoder_write_int32(encoder_p, 4182, self_p->field4182);
+    pbtools_encoder_write_int32(encoder_p, 4145, self_p->field4145);
+    pbtools_encoder_write_int32(encoder_p, 4108, self_p->field4108);
+    pbtools_encoder_write_int32(encoder_p, 4071, self_p->field4071);
+    pbtools_encoder_write_int32(encoder_p, 4034, self_p->field4034);
+    pbtools_encoder_write_int32(encoder_p, 3997, self_p->field3997);
+    pbtools_encoder_write_int32(encoder_p, 3960, self_p->field3960);
+    pbtools_encoder_write_int32(encoder_p, 3923, self_p->field3923);
+    pbtools_encoder_write_int32(encoder_p, 3886, self_p->field3886);
+    pbtools_encoder_write_int32(encoder_p, 3849, self_p->field3849);
+    pbtools_encoder_write_int32(encoder_p, 3812, self_p->field3812);
+    pbtools_encoder_write_int32(encoder_p, 3775, self_p->field3775);
+    pbtools_encoder_write_int32(encoder_p, 3738, self_p->field3738);
+    pbtools_encoder_write_int32(encoder_p, 3701, self_p->field3701);
+    pbtools_encoder_write_int32(encoder_p, 3664, self_p->field3664);
+    pbtools_encoder_write_int32(encoder_p, 3627, self_p->field3627);
+    pbtools_encoder_write_int32(encoder_p, 3590, self_p->field3590);
+    pbtools_encoder_write_int32(encoder_p, 3553, self_p->field3553);
+    pbtools_encoder_write_int32(encoder_p, 3516, self_p->field3516);
+    pbtools_encoder_write_int32(encoder_p, 3479, self_p->field3479);
+    pbtools_encoder_write_int32(encoder_p, 3442, self_p->field3442);
+    pbtools_encoder_write_int32(encoder_p, 3405, self_p->field3405);
+    pbtools_encoder_write_int32(encoder_p, 3368, self_p->field3368);
+    pbtools_encoder_write_int32(encoder_p, 3331, self_p->field3331);
+    pbtools_encoder_write_int32(encoder_p, 3294, self_p->field3294);
+    pbtools_encoder_write_int32(encoder_p, 3257, self_p->field3257);
+    pbtools_encoder_write_int32(encoder_p, 3220, self_p->field3220);
+    pbtools_encoder_write_int32(encoder_p, 3183, self_p->field3183);
+    pbtools_encoder_write_int32(encoder_p, 3146, self_p->field3146);
+    pbtools_encoder_write_int32(encoder_p, 3109, self_p->field3109);
+    pbtools_encoder_write_int32(encoder_p, 3072, self_p->field3072);
+    pbtools_encoder_write_int32(encoder_p, 3035, self_p->field3035);
+    pbtools_encoder_write_int32(encoder_p, 2998, self_p->field2998);
+    pbtools_encoder_write_int32(encoder_p, 2961, self_p->field2961);
+    pbtools_encoder_write_int32(encoder_p, 2924, self_p->field2924);
+    pbtools_encoder_write_int32(encoder_p, 2887, self_p->field2887);
+    pbtools_encoder_write_int32(encoder_p, 2850, self_p->field2850);
+    pbtools_encoder_write_int32(encoder_p, 2813, self_p->field2813);
+    pbtools_encoder_write_int32(encoder_p, 2776, self_p->field2776);
+    pbtools_encoder_write_int32(encoder_p, 2739, self_p->field2739);
+    pbtools_encoder_write_int32(encoder_p, 2702, self_p->field2702);
+    pbtools_encoder_write_int32(encoder_p, 2665, self_p->field2665);
+    pbtools_encoder_write_int32(encoder_p, 2628, self_p->field2628);
+    pbtools_encoder_write_int32(encoder_p, 2591, self_p->field2591);
+    pbtools_encoder_write_int32(encoder_p, 2554, self_p->field2554);
+    pbtools_encoder_write_int32(encoder_p, 2517, self_p->field2517);
+    pbtools_encoder_write_int32(encoder_p, 2480, self_p->field2480);
+    pbtools_encoder_write_int32(encoder_p, 2443, self_p->field2443);
+    pbtools_encoder_write_int32(encoder_p, 2406, self_p->field2406);
+    pbtools_encoder_write_int32(encoder_p, 2369, self_p->field2369);
+    pbtools_encoder_write_int32(encoder_p, 2332, self_p->field2332);
+    pbtools_encoder_write_int32(encoder_p, 2295, self_p->field2295);
+    pbtools_encoder_write_int32(encoder_p, 2258, self_p->field2258);
+    pbtools_encoder_write_int32(encoder_p, 2221, self_p->field2221);
+    pbtools_encoder_write_int32(encoder_p, 2184, self_p->field2184);
+    pbtools_encoder_write_int32(encoder_p, 2147, self_p->field2147);
+    pbtools_encoder_write_int32(encoder_p, 2110, self_p->field2110);
+    pbtools_encoder_write_int32(encoder_p, 2073, self_p->field2073);
+    pbtools_encoder_write_int32(encoder_p, 2036, self_p->field2036);
+    pbtools_encoder_write_int32(encoder_p, 1999, self_p->field1999);
+    pbtools_encoder_write_int32(encoder_p, 1962, self_p->field1962);
+    pbtools_encoder_write_int32(encoder_p, 1925, self_p->field1925);
+    pbtools_encoder_write_int32(encoder_p, 1888, self_p->field1888);
+    pbtools_encoder_write_int32(encoder_p, 1851, self_p->field1851);
+    pbtools_encoder_write_int32(encoder_p, 1814, self_p->field1814);
+    pbtools_encoder_write_int32(encoder_p, 1777, self_p->field1777);
+    pbtools_encoder_write_int32(encoder_p, 1740, self_p->field1740);
+    pbtools_encoder_write_int32(encoder_p, 1703, self_p->field1703);
+    pbtools_encoder_write_int32(encoder_p, 1666, self_p->field1666);
+    pbtools_encoder_write_int32(encoder_p, 1629, self_p->field1629);
+    pbtools_encoder_write_int32(encoder_p, 1592, self_p->field1592);
+    pbtools_encoder_write_int32(encoder_p, 1555, self_p->field1555);
+    pbtools_encoder_write_int32(encoder_p, 1518, self_p->field1518);
+    pbtools_encoder_write_int32(encoder_p, 1481, self_p->field1481);
+    pbtools_encoder_write_int32(encoder_p, 1444, self_p->field1444);
+    pbtools_encoder_write_int32(encoder_p, 1407, self_p->field1407);
+    pbtools_encoder_write_int32(encoder_p, 1370, self_p->field1370);
+    pbtools_encoder_write_int32(encoder_p, 1333, self_p->field1333);
+    pbtools_encoder_write_int32(encoder_p, 1296, self_p->field1296);
+    pbtools_encoder_write_int32(encoder_p, 1259, self_p->field1259);
+    pbtools_encoder_write_int32(encoder_p, 1222, self_p->field1222);
+    pbtools_encoder_write_int32(encoder_p, 1185, self_p->field1185);
+    pbtools_encoder_write_int32(encoder_p, 1148, self_p->field1148);
+    pbtools_encoder_write_int32(encoder_p, 1111, self_p->field1111);
+    pbtools_encoder_write_int32(encoder_p, 1074, self_p->field1074);
+    pbtools_encoder_write_int32(encoder_p, 1037, self_p->field1037);
+    pbtools_encoder_write_int32(encoder_p, 1000, self_p->field1000);
+    pbtools_encoder_write_int32(encoder_p, 963, self_p->field963);
+    pbtools_encoder_write_int32(encoder_p, 926, self_p->field926);
+    pbtools_encoder_write_int32(encoder_p, 889, self_p->field889);
+    pbtools_encoder_write_int32(encoder_p, 852, self_p->field852);
+    pbtools_encoder_write_int32(encoder_p, 815, self_p->field815);
+    pbtools_encoder_write_int32(encoder_p, 778, self_p->field778);
+    pbtools_encoder_write_int32(encoder_p, 741, self_p->field741);
+    pbtools_encoder_write_int32(encoder_p, 704, self_p->field704);
+    pbtools_encoder_write_int32(encoder_p, 667, self_p->field667);
+    pbtools_encoder_write_int32(encoder_p, 630, self_p->field630);
+    pbtools_encoder_write_int32(encoder_p, 593, self_p->field593);
+    pbtools_encoder_write_int32(encoder_p, 556, self_p->field556);
+    pbtools_encoder_write_int32(encoder_p, 519, self_p->field519);
+    pbtools_encoder_write_int32(encoder_p, 482, self_p->field482);
+    pbtools_encoder_write_int32(encoder_p, 445, self_p->field445);
+    pbtools_encoder_write_int32(encoder_p, 408, self_p->field408);
+    pbtools_encoder_write_int32(encoder_p, 371, self_p->field371);
+    pbtools_encoder_write_int32(encoder_p, 334, self_p->field334);
+    pbtools_encoder_write_int32(encoder_p, 297, self_p->field297);
+    pbtools_encoder_write_int32(encoder_p, 260, self_p->field260);
+    pbtools_encoder_write_int32(encoder_p, 223, self_p->field223);
+    pbtools_encoder_write_int32(encoder_p, 186, self_p->field186);
+    pbtools_encoder_write_int32(encoder_p, 149, self_p->field149);
+    pbtools_encoder_write_int32(encoder_p, 112, self_p->field112);
+    pbtools_encoder_write_int32(encoder_p, 75, self_p->field75);
+    pbtools_encoder_write_int32(encoder_p, 38, self_p->field38);
+    pbtools_encoder_write_int32(encoder_p, 1, self_p->field1);
+}
+
+static const uint32_t micro_sparse_keys[256] = {
+    PBTOOLS_KEY(4219, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    PBTOOLS_KEY(75, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(593, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1111, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1629, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2147, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2665, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3183, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3701, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(7327, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4737, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5255, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5773, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6809, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6291, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    0,
+    0,
+    0,
+    PBTOOLS_KEY(112, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(630, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1148, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1666, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2184, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2702, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3220, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3738, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4256, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4774, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5292, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5810, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6328, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6846, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(7364, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    0,
+    PBTOOLS_KEY(3775, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    PBTOOLS_KEY(149, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(667, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2221, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1703, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3257, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2739, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1185, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4293, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4811, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5329, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5847, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6365, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6883, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    0,
+    0,
+    0,
+    0,
+    PBTOOLS_KEY(186, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(704, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1222, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1740, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2258, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2776, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3294, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3812, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4330, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4848, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    PBTOOLS_KEY(5884, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6920, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6402, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5366, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    0,
+    PBTOOLS_KEY(1777, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    PBTOOLS_KEY(223, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(741, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1259, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2295, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2813, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3331, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3849, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4367, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4885, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5403, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5921, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6439, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6957, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    0,
+    0,
+    0,
+    0,
+    PBTOOLS_KEY(260, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(778, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1296, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2850, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2332, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3886, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5440, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4404, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3368, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4922, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    PBTOOLS_KEY(6476, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6994, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    PBTOOLS_KEY(5958, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1814, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    0,
+    PBTOOLS_KEY(297, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(815, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1333, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1851, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2369, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2887, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3405, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5995, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4441, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4959, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5477, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    PBTOOLS_KEY(6513, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    PBTOOLS_KEY(7031, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3923, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    PBTOOLS_KEY(1888, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    PBTOOLS_KEY(334, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(852, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1370, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2406, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2924, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3442, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3960, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4478, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4996, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5514, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6032, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6550, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(7068, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    0,
+    0,
+    0,
+    PBTOOLS_KEY(3997, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(371, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(889, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1407, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1925, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2443, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2961, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6069, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4515, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5033, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3479, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5551, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6587, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(7105, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    0,
+    0,
+    0,
+    0,
+    PBTOOLS_KEY(408, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(926, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1444, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1962, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2480, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2998, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3516, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4034, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4552, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5070, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5588, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6106, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6624, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(7142, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    0,
+    0,
+    PBTOOLS_KEY(2517, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(963, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(445, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    PBTOOLS_KEY(1481, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1999, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3035, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3553, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4071, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4589, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5107, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5625, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6143, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6661, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(7179, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    0,
+    0,
+    0,
+    0,
+    PBTOOLS_KEY(482, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1000, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1518, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2036, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2554, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3072, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6698, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4108, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4626, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5662, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5144, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6180, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(7216, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    PBTOOLS_KEY(3590, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    0,
+    PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(519, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1037, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1555, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2073, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2591, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3109, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3627, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4145, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4663, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5181, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5699, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6217, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6735, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(7253, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    0,
+    0,
+    0,
+    PBTOOLS_KEY(3664, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(556, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1074, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1592, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2110, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2628, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3146, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4182, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4700, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5218, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(5736, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6254, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6772, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(7290, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(38, PBTOOLS_WIRE_TYPE_VARINT),
+    0
+};
+
+static const uint8_t micro_sparse_displacements[128] = {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 2, 0, 0,
+    8, 0, 0, 0, 1, 0, 0, 2,
+    0, 0, 2, 0, 0, 0, 0, 0,
+    8, 0, 0, 0, 0, 2, 0, 0,
+    7, 0, 0, 0, 0, 0, 0, 7,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    8, 0, 0, 1, 0, 0, 3, 5,
+    0, 0, 1, 0, 0, 5, 0, 0,
+    0, 0, 0, 0, 4, 0, 0, 6,
+    0, 0, 0, 3, 0, 0, 0, 0,
+    14, 10, 0, 0, 12, 0, 0, 8,
+    0, 0, 0, 4, 4, 0, 0, 0
+};
+
+void micro_sparse_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct micro_sparse_t *self_p)
+{
+    uint32_t key;
+    uint32_t hash;
+    uint32_t slot;
+    int wire_type;
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+        hash = (key * 0x9e3779b1u);
+        slot = (((hash >> 17) & 0xff)
+                ^ micro_sparse_displacements[hash >> 25]);
+
+        if (micro_sparse_keys[slot] != key) {
+            slot = 256;
+        }
+
+        switch (slot) {
+
+        case 221:
+            self_p->field1 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  38,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_38;
+            }
+
+            break;
+
+        case 254:
+        field_38:
+            self_p->field38 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  75,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_75;
+            }
+
+            break;
+
+        case 2:
+        field_75:
+            self_p->field75 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  112,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_112;
+            }
+
+            break;
+
+        case 20:
+        field_112:
+            self_p->field112 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  149,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_149;
+            }
+
+            break;
+
+        case 39:
+        field_149:
+            self_p->field149 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  186,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_186;
+            }
+
+            break;
+
+        case 57:
+        field_186:
+            self_p->field186 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  223,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_223;
+            }
+
+            break;
+
+        case 76:
+        field_223:
+            self_p->field223 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  260,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_260;
+            }
+
+            break;
+
+        case 94:
+        field_260:
+            self_p->field260 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  297,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_297;
+            }
+
+            break;
+
+        case 112:
+        field_297:
+            self_p->field297 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  334,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_334;
+            }
+
+            break;
+
+        case 131:
+        field_334:
+            self_p->field334 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  371,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_371;
+            }
+
+            break;
+
+        case 149:
+        field_371:
+            self_p->field371 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  408,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_408;
+            }
+
+            break;
+
+        case 167:
+        field_408:
+            self_p->field408 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  445,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_445;
+            }
+
+            break;
+
+        case 186:
+        field_445:
+            self_p->field445 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  482,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_482;
+            }
+
+            break;
+
+        case 204:
+        field_482:
+            self_p->field482 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  519,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_519;
+            }
+
+            break;
+
+        case 222:
+        field_519:
+            self_p->field519 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  556,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_556;
+            }
+
+            break;
+
+        case 241:
+        field_556:
+            self_p->field556 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  593,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_593;
+            }
+
+            break;
+
+        case 3:
+        field_593:
+            self_p->field593 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  630,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_630;
+            }
+
+            break;
+
+        case 21:
+        field_630:
+            self_p->field630 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  667,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_667;
+            }
+
+            break;
+
+        case 40:
+        field_667:
+            self_p->field667 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  704,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_704;
+            }
+
+            break;
+
+        case 58:
+        field_704:
+            self_p->field704 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  741,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_741;
+            }
+
+            break;
+
+        case 77:
+        field_741:
+            self_p->field741 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  778,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_778;
+            }
+
+            break;
+
+        case 95:
+        field_778:
+            self_p->field778 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  815,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_815;
+            }
+
+            break;
+
+        case 113:
+        field_815:
+            self_p->field815 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  852,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_852;
+            }
+
+            break;
+
+        case 132:
+        field_852:
+            self_p->field852 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  889,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_889;
+            }
+
+            break;
+
+        case 150:
+        field_889:
+            self_p->field889 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  926,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_926;
+            }
+
+            break;
+
+        case 168:
+        field_926:
+            self_p->field926 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  963,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_963;
+            }
+
+            break;
+
+        case 185:
+        field_963:
+            self_p->field963 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1000,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1000;
+            }
+
+            break;
+
+        case 205:
+        field_1000:
+            self_p->field1000 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1037,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1037;
+            }
+
+            break;
+
+        case 223:
+        field_1037:
+            self_p->field1037 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1074,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1074;
+            }
+
+            break;
+
+        case 242:
+        field_1074:
+            self_p->field1074 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1111,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1111;
+            }
+
+            break;
+
+        case 4:
+        field_1111:
+            self_p->field1111 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1148,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1148;
+            }
+
+            break;
+
+        case 22:
+        field_1148:
+            self_p->field1148 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1185,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1185;
+            }
+
+            break;
+
+        case 45:
+        field_1185:
+            self_p->field1185 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1222,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1222;
+            }
+
+            break;
+
+        case 59:
+        field_1222:
+            self_p->field1222 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1259,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1259;
+            }
+
+            break;
+
+        case 78:
+        field_1259:
+            self_p->field1259 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1296,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1296;
+            }
+
+            break;
+
+        case 96:
+        field_1296:
+            self_p->field1296 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1333,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1333;
+            }
+
+            break;
+
+        case 114:
+        field_1333:
+            self_p->field1333 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1370,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1370;
+            }
+
+            break;
+
+        case 133:
+        field_1370:
+            self_p->field1370 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1407,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1407;
+            }
+
+            break;
+
+        case 151:
+        field_1407:
+            self_p->field1407 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1444,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1444;
+            }
+
+            break;
+
+        case 169:
+        field_1444:
+            self_p->field1444 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1481,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1481;
+            }
+
+            break;
+
+        case 188:
+        field_1481:
+            self_p->field1481 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1518,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1518;
+            }
+
+            break;
+
+        case 206:
+        field_1518:
+            self_p->field1518 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1555,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1555;
+            }
+
+            break;
+
+        case 224:
+        field_1555:
+            self_p->field1555 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1592,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1592;
+            }
+
+            break;
+
+        case 243:
+        field_1592:
+            self_p->field1592 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1629,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1629;
+            }
+
+            break;
+
+        case 5:
+        field_1629:
+            self_p->field1629 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1666,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1666;
+            }
+
+            break;
+
+        case 23:
+        field_1666:
+            self_p->field1666 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1703,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1703;
+            }
+
+            break;
+
+        case 42:
+        field_1703:
+            self_p->field1703 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1740,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1740;
+            }
+
+            break;
+
+        case 60:
+        field_1740:
+            self_p->field1740 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1777,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1777;
+            }
+
+            break;
+
+        case 74:
+        field_1777:
+            self_p->field1777 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1814,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1814;
+            }
+
+            break;
+
+        case 109:
+        field_1814:
+            self_p->field1814 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1851,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1851;
+            }
+
+            break;
+
+        case 115:
+        field_1851:
+            self_p->field1851 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1888,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1888;
+            }
+
+            break;
+
+        case 129:
+        field_1888:
+            self_p->field1888 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1925,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1925;
+            }
+
+            break;
+
+        case 152:
+        field_1925:
+            self_p->field1925 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1962,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1962;
+            }
+
+            break;
+
+        case 170:
+        field_1962:
+            self_p->field1962 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1999,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_1999;
+            }
+
+            break;
+
+        case 189:
+        field_1999:
+            self_p->field1999 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2036,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2036;
+            }
+
+            break;
+
+        case 207:
+        field_2036:
+            self_p->field2036 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 225:
+            self_p->field2073 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 244:
+            self_p->field2110 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 6:
+            self_p->field2147 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 24:
+            self_p->field2184 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 41:
+            self_p->field2221 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 61:
+            self_p->field2258 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 79:
+            self_p->field2295 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 98:
+            self_p->field2332 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 116:
+            self_p->field2369 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 134:
+            self_p->field2406 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 153:
+            self_p->field2443 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 171:
+            self_p->field2480 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 184:
+            self_p->field2517 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 208:
+            self_p->field2554 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 226:
+            self_p->field2591 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 245:
+            self_p->field2628 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 7:
+            self_p->field2665 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 25:
+            self_p->field2702 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 44:
+            self_p->field2739 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 62:
+            self_p->field2776 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 80:
+            self_p->field2813 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 97:
+            self_p->field2850 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 117:
+            self_p->field2887 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 135:
+            self_p->field2924 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 154:
+            self_p->field2961 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 172:
+            self_p->field2998 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 190:
+            self_p->field3035 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 209:
+            self_p->field3072 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 227:
+            self_p->field3109 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 246:
+            self_p->field3146 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 8:
+            self_p->field3183 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 26:
+            self_p->field3220 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 43:
+            self_p->field3257 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 63:
+            self_p->field3294 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 81:
+            self_p->field3331 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 102:
+            self_p->field3368 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 118:
+            self_p->field3405 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 136:
+            self_p->field3442 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 158:
+            self_p->field3479 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 173:
+            self_p->field3516 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 191:
+            self_p->field3553 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 218:
+            self_p->field3590 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 228:
+            self_p->field3627 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 240:
+            self_p->field3664 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 9:
+            self_p->field3701 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 27:
+            self_p->field3738 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 37:
+            self_p->field3775 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 64:
+            self_p->field3812 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 82:
+            self_p->field3849 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 99:
+            self_p->field3886 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 127:
+            self_p->field3923 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 137:
+            self_p->field3960 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 148:
+            self_p->field3997 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 174:
+            self_p->field4034 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 192:
+            self_p->field4071 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 211:
+            self_p->field4108 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 229:
+            self_p->field4145 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 247:
+            self_p->field4182 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 0:
+            self_p->field4219 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 28:
+            self_p->field4256 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 46:
+            self_p->field4293 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 65:
+            self_p->field4330 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 83:
+            self_p->field4367 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 101:
+            self_p->field4404 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 120:
+            self_p->field4441 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 138:
+            self_p->field4478 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 156:
+            self_p->field4515 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 175:
+            self_p->field4552 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 193:
+            self_p->field4589 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 212:
+            self_p->field4626 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 230:
+            self_p->field4663 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 248:
+            self_p->field4700 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 11:
+            self_p->field4737 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 29:
+            self_p->field4774 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 47:
+            self_p->field4811 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 66:
+            self_p->field4848 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 84:
+            self_p->field4885 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 103:
+            self_p->field4922 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 121:
+            self_p->field4959 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 139:
+            self_p->field4996 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 157:
+            self_p->field5033 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 176:
+            self_p->field5070 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 194:
+            self_p->field5107 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 214:
+            self_p->field5144 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 231:
+            self_p->field5181 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 249:
+            self_p->field5218 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 12:
+            self_p->field5255 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 30:
+            self_p->field5292 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 48:
+            self_p->field5329 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 71:
+            self_p->field5366 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 85:
+            self_p->field5403 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 100:
+            self_p->field5440 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 122:
+            self_p->field5477 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 140:
+            self_p->field5514 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 159:
+            self_p->field5551 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 177:
+            self_p->field5588 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 195:
+            self_p->field5625 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 213:
+            self_p->field5662 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 232:
+            self_p->field5699 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 250:
+            self_p->field5736 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 13:
+            self_p->field5773 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 31:
+            self_p->field5810 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 49:
+            self_p->field5847 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 68:
+            self_p->field5884 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 86:
+            self_p->field5921 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 108:
+            self_p->field5958 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 119:
+            self_p->field5995 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 141:
+            self_p->field6032 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 155:
+            self_p->field6069 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 178:
+            self_p->field6106 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 196:
+            self_p->field6143 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 215:
+            self_p->field6180 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 233:
+            self_p->field6217 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 251:
+            self_p->field6254 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 15:
+            self_p->field6291 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 32:
+            self_p->field6328 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 50:
+            self_p->field6365 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 70:
+            self_p->field6402 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 87:
+            self_p->field6439 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 105:
+            self_p->field6476 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 124:
+            self_p->field6513 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 142:
+            self_p->field6550 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 160:
+            self_p->field6587 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 179:
+            self_p->field6624 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 197:
+            self_p->field6661 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 210:
+            self_p->field6698 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 234:
+            self_p->field6735 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 252:
+            self_p->field6772 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 14:
+            self_p->field6809 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 33:
+            self_p->field6846 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 51:
+            self_p->field6883 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 69:
+            self_p->field6920 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 88:
+            self_p->field6957 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 106:
+            self_p->field6994 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 126:
+            self_p->field7031 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 143:
+            self_p->field7068 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 161:
+            self_p->field7105 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 180:
+            self_p->field7142 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 198:
+            self_p->field7179 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 216:
+            self_p->field7216 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 235:
+            self_p->field7253 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 253:
+            self_p->field7290 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 10:
+            self_p->field7327 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case 34:
+            self_p->field7364 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 38:
+            case 75:
+            case 112:
+            case 149:
+            case 186:
+            case 223:
+            case 260:
+            case 297:
+            case 334:
+            case 371:
+            case 408:
+            case 445:
+            case 482:
+            case 519:
+            case 556:
+            case 593:
+            case 630:
+            case 667:
+            case 704:
+            case 741:
+            case 778:
+            case 815:
+            case 852:
+            case 889:
+            case 926:
+            case 963:
+            case 1000:
+            case 1037:
+            case 1074:
+            case 1111:
+            case 1148:
+            case 1185:
+            case 1222:
+            case 1259:
+            case 1296:
+            case 1333:
+            case 1370:
+            case 1407:
+            case 1444:
+            case 1481:
+            case 1518:
+            case 1555:
+            case 1592:
+            case 1629:
+            case 1666:
+            case 1703:
+            case 1740:
+            case 1777:
+            case 1814:
+            case 1851:
+            case 1888:
+            case 1925:
+            case 1962:
+            case 1999:
+            case 2036:
+            case 2073:
+            case 2110:
+            case 2147:
+            case 2184:
+            case 2221:
+            case 2258:
+            case 2295:
+            case 2332:
+            case 2369:
+            case 2406:
+            case 2443:
+            case 2480:
+            case 2517:
+            case 2554:
+            case 2591:
+            case 2628:
+            case 2665:
+            case 2702:
+            case 2739:
+            case 2776:
+            case 2813:
+            case 2850:
+            case 2887:
+            case 2924:
+            case 2961:
+            case 2998:
+            case 3035:
+            case 3072:
+            case 3109:
+            case 3146:
+            case 3183:
+            case 3220:
+            case 3257:
+            case 3294:
+            case 3331:
+            case 3368:
+            case 3405:
+            case 3442:
+            case 3479:
+            case 3516:
+            case 3553:
+            case 3590:
+            case 3627:
+            case 3664:
+            case 3701:
+            case 3738:
+            case 3775:
+            case 3812:
+            case 3849:
+            case 3886:
+            case 3923:
+            case 3960:
+            case 3997:
+            case 4034:
+            case 4071:
+            case 4108:
+            case 4145:
+            case 4182:
+            case 4219:
+            case 4256:
+            case 4293:
+            case 4330:
+            case 4367:
+            case 4404:
+            case 4441:
+            case 4478:
+            case 4515:
+            case 4552:
+            case 4589:
+            case 4626:
+            case 4663:
+            case 4700:
+            case 4737:
+            case 4774:
+            case 4811:
+            case 4848:
+            case 4885:
+            case 4922:
+            case 4959:
+            case 4996:
+            case 5033:
+            case 5070:
+            case 5107:
+            case 5144:
+            case 5181:
+            case 5218:
+            case 5255:
+            case 5292:
+            case 5329:
+            case 5366:
+            case 5403:
+            case 5440:
+            case 5477:
+            case 5514:
+            case 5551:
+            case 5588:
+            case 5625:
+            case 5662:
+            case 5699:
+            case 5736:
+            case 5773:
+            case 5810:
+            case 5847:
+            case 5884:
+            case 5921:
+            case 5958:
+            case 5995:
+            case 6032:
+            case 6069:
+            case 6106:
+            case 6143:
+            case 6180:
+            case 6217:
+            case 6254:
+            case 6291:
+            case 6328:
+            case 6365:
+            case 6402:
+            case 6439:
+            case 6476:
+            case 6513:
+            case 6550:
+            case 6587:
+            case 6624:
+            case 6661:
+            case 6698:
+            case 6735:
+            case 6772:
+            case 6809:
+            case 6846:
+            case 6883:
+            case 6920:
+            case 6957:
+            case 6994:
+            case 7031:
+            case 7068:
+            case 7105:
+            case 7142:
+            case 7179:
+            case 7216:
+            case 7253:
+            case 7290:
+            case 7327:
+            case 7364:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+}
+
+void micro_sparse_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct micro_sparse_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        micro_sparse_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void micro_sparse_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct micro_sparse_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct micro_sparse_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        micro_sparse_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        micro_sparse_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t micro_sparse_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 38, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 75, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 112, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 149, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 186, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 223, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 260, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 297, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 334, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 371, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 408, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 445, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 482, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 519, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 556, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 593, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 630, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 667, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 704, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 741, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 778, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 815, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 852, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 889, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 926, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 963, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1000, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1037, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1074, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1111, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1148, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1185, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1222, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1259, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1296, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1333, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1370, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1407, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1444, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1481, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1518, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1555, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1592, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1629, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1666, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1703, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1740, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1777, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1814, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1851, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1888, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1925, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1962, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1999, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2036, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2073, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2110, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2147, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2184, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2221, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2258, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2295, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2332, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2369, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2406, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2443, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2480, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2517, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2554, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2591, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2628, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2665, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2702, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2739, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2776, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2813, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2850, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2887, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2924, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2961, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2998, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3035, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3072, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3109, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3146, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3183, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3220, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3257, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3294, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3331, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3368, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3405, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3442, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3479, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3516, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3553, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3590, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3627, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3664, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3701, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3738, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3775, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3812, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3849, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3886, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3923, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3960, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3997, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4034, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4071, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4108, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4145, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4182, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4219, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4256, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4293, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4330, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4367, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4404, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4441, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4478, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4515, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4552, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4589, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4626, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4663, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4700, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4737, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4774, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4811, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4848, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4885, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4922, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4959, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4996, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5033, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5070, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5107, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5144, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5181, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5218, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5255, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5292, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5329, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5366, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5403, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5440, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5477, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5514, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5551, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5588, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5625, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5662, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5699, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5736, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5773, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5810, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5847, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5884, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5921, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5958, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5995, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6032, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6069, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6106, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6143, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6180, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6217, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6254, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6291, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6328, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6365, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6402, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6439, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6476, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6513, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6550, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6587, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6624, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6661, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6698, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6735, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6772, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6809, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6846, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6883, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6920, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6957, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6994, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 7031, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 7068, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 7105, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 7142, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 7179, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 7216, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 7253, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 7290, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 7327, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 7364, PBTOOLS_WIRE_TYPE_VARINT, false }
+};
+
+void micro_sparse_view_init(
+    struct micro_sparse_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &micro_sparse_view_fields[0],
+                      200,
+                      &self_p->offsets[0]);
+}
+
+int micro_sparse_view_error(
+    struct micro_sparse_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+int32_t micro_sparse_view_get_field1(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 0, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field38(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 1, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field75(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 2, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field112(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 3, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field149(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 4, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field186(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 5, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field223(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 6, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field260(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 7, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field297(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 8, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field334(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 9, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field371(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 10, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field408(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 11, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field445(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 12, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field482(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 13, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field519(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 14, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field556(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 15, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field593(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 16, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field630(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 17, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field667(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 18, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field704(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 19, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field741(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 20, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field778(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 21, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field815(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 22, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field852(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 23, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field889(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 24, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field926(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 25, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field963(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 26, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1000(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 27, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1037(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 28, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1074(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 29, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1111(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 30, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1148(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 31, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1185(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 32, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1222(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 33, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1259(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 34, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1296(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 35, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1333(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 36, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1370(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 37, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1407(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 38, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1444(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 39, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1481(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 40, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1518(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 41, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1555(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 42, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1592(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 43, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1629(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 44, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1666(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 45, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1703(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 46, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1740(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 47, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1777(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 48, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1814(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 49, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1851(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 50, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1888(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 51, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1925(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 52, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1962(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 53, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field1999(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 54, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2036(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 55, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2073(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 56, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2110(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 57, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2147(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 58, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2184(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 59, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2221(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 60, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2258(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 61, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2295(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 62, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2332(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 63, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2369(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 64, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2406(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 65, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2443(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 66, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2480(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 67, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2517(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 68, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2554(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 69, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2591(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 70, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2628(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 71, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2665(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 72, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2702(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 73, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2739(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 74, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2776(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 75, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2813(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 76, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2850(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 77, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2887(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 78, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2924(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 79, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2961(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 80, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field2998(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 81, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3035(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 82, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3072(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 83, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3109(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 84, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3146(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 85, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3183(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 86, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3220(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 87, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3257(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 88, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3294(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 89, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3331(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 90, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3368(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 91, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3405(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 92, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3442(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 93, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3479(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 94, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3516(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 95, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3553(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 96, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3590(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 97, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3627(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 98, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3664(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 99, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3701(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 100, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3738(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 101, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3775(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 102, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3812(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 103, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3849(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 104, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3886(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 105, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3923(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 106, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3960(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 107, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field3997(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 108, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4034(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 109, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4071(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 110, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4108(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 111, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4145(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 112, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4182(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 113, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4219(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 114, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4256(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 115, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4293(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 116, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4330(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 117, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4367(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 118, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4404(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 119, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4441(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 120, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4478(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 121, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4515(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 122, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4552(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 123, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4589(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 124, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4626(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 125, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4663(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 126, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4700(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 127, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4737(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 128, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4774(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 129, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4811(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 130, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4848(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 131, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4885(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 132, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4922(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 133, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4959(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 134, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field4996(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 135, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5033(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 136, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5070(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 137, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5107(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 138, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5144(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 139, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5181(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 140, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5218(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 141, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5255(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 142, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5292(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 143, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5329(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 144, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5366(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 145, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5403(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 146, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5440(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 147, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5477(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 148, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5514(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 149, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5551(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 150, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5588(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 151, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5625(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 152, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5662(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 153, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5699(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 154, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5736(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 155, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5773(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 156, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5810(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 157, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5847(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 158, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5884(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 159, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5921(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 160, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5958(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 161, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field5995(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 162, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6032(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 163, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6069(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 164, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6106(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 165, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6143(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 166, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6180(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 167, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6217(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 168, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6254(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 169, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6291(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 170, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6328(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 171, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6365(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 172, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6402(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 173, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6439(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 174, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6476(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 175, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6513(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 176, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6550(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 177, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6587(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 178, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6624(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 179, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6661(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 180, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6698(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 181, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6735(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 182, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6772(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 183, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6809(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 184, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6846(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 185, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6883(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 186, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6920(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 187, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6957(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 188, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field6994(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 189, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field7031(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 190, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field7068(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 191, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field7105(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 192, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field7142(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 193, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field7179(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 194, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field7216(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 195, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field7253(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 196, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field7290(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 197, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field7327(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 198, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t micro_sparse_view_get_field7364(
+    struct micro_sparse_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 199, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+struct micro_sparse_t *
+micro_sparse_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct micro_sparse_t),
+                (pbtools_message_init_t)micro_sparse_init));
+}
+
+int micro_sparse_encode(
+    struct micro_sparse_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)micro_sparse_encode_inner));
+}
+
+int micro_sparse_decode(
+    struct micro_sparse_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)micro_sparse_decode_inner));
+}
+
+int micro_sparse_decode_padded(
+    struct micro_sparse_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode_padded(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)micro_sparse_decode_inner));
+}
+
+int micro_sparse_decode_segments(
+    struct micro_sparse_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)micro_sparse_decode_inner));
+}
+
+void micro_string_init(
+    struct micro_string_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->value_p = "";
+}
+
+void micro_string_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct micro_string_t *self_p)
+{
+    pbtools_encoder_write_string(encoder_p, 1, self_p->value_p);
+}
+
+void micro_string_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct micro_string_t *self_p)
+{
+    uint32_t key;
+    int wire_type;
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->value_p);
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+}
+
+void micro_string_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct micro_string_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        micro_string_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void micro_string_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct micro_string_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct micro_string_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        micro_string_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        micro_string_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t micro_string_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false }
+};
+
+void micro_string_view_init(
+    struct micro_string_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &micro_string_view_fields[0],
+                      1,
+                      &self_p->offsets[0]);
+}
+
+int micro_string_view_error(
+    struct micro_string_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+struct pbtools_bytes_t micro_string_view_get_value(
+    struct micro_string_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+
+    value.buf_p = NULL;
+    value.size = 0;
+
+    if (pbtools_view_seek(&self_p->base, 0, &decoder)) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    return (value);
+}
+
+struct micro_string_t *
+micro_string_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct micro_string_t),
+                (pbtools_message_init_t)micro_string_init));
+}
+
+int micro_string_encode(
+    struct micro_string_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)micro_string_encode_inner));
+}
+
+int micro_string_decode(
+    struct micro_string_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)micro_string_decode_inner));
+}
+
+int micro_string_decode_padded(
+    struct micro_string_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode_padded(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)micro_string_decode_inner));
+}
+
+int micro_string_decode_segments(
+    struct micro_string_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)micro_string_decode_inner));
+}
+
+void micro_record_init(
+    struct micro_record_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->timestamp = 0;
+    self_p->value = 0;
+    self_p->id = 0;
+}
+
+void micro_record_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct micro_record_t *self_p)
+{
+    pbtools_encoder_write_int32(encoder_p, 3, self_p->id);
+    pbtools_encoder_write_double(encoder_p, 2, self_p->value);
+    pbtools_encoder_write_int64(encoder_p, 1, self_p->timestamp);
+}
+
+void micro_record_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct micro_record_t *self_p)
+{
+    uint32_t key;
+    int wire_type;
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->timestamp = pbtools_decoder_read_int64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_64_BIT)) {
+                goto field_2;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_64_BIT):
+        field_2:
+            self_p->value = pbtools_decoder_read_double_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_3;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_VARINT):
+        field_3:
+            self_p->id = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+}
+
+void micro_record_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct micro_record_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        micro_record_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void micro_record_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct micro_record_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct micro_record_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        micro_record_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        micro_record_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t micro_record_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2, PBTOOLS_WIRE_TYPE_64_BIT, false },
+    { 3, PBTOOLS_WIRE_TYPE_VARINT, false }
+};
+
+void micro_record_view_init(
+    struct micro_record_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &micro_record_view_fields[0],
+                      3,
+                      &self_p->offsets[0]);
+}
+
+int micro_record_view_error(
+    struct micro_record_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+int64_t micro_record_view_get_timestamp(
+    struct micro_record_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 0, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int64_unchecked(&decoder));
+}
+
+double micro_record_view_get_value(
+    struct micro_record_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 1, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_double_unchecked(&decoder));
+}
+
+int32_t micro_record_view_get_id(
+    struct micro_record_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 2, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+struct micro_record_t *
+micro_record_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct micro_record_t),
+                (pbtools_message_init_t)micro_record_init));
+}
+
+int micro_record_encode(
+    struct micro_record_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)micro_record_encode_inner));
+}
+
+int micro_record_decode(
+    struct micro_record_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)micro_record_decode_inner));
+}
+
+int micro_record_decode_padded(
+    struct micro_record_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode_padded(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)micro_record_decode_inner));
+}
+
+int micro_record_decode_segments(
+    struct micro_record_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)micro_record_decode_inner));
+}
+
+void micro_records_init(
+    struct micro_records_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->records.length = 0;
+}
+
+void micro_records_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct micro_records_t *self_p)
+{
+    micro_record_encode_repeated_inner(
+        encoder_p,
+        1,
+        &self_p->records);
+}
+
+void micro_records_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct micro_records_t *self_p)
+{
+    uint32_t key;
+    int wire_type;
+    struct pbtools_repeated_info_t repeated_info_records;
+
+    pbtools_repeated_info_init(&repeated_info_records, 1);
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_1:
+            pbtools_repeated_info_decode(&repeated_info_records,
+                                         decoder_p,
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_1;
+            }
+
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+
+    micro_record_decode_repeated_inner(
+        decoder_p,
+        &repeated_info_records,
+        &self_p->records);
+}
+
+int micro_records_records_alloc(
+    struct micro_records_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated(
+                (struct pbtools_repeated_message_t *)&self_p->records,
+                length,
+                self_p->base.heap_p,
+                sizeof(struct micro_record_t),
+                (pbtools_message_init_t)micro_record_init));
+}
+
+void micro_records_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct micro_records_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        micro_records_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void micro_records_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct micro_records_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct micro_records_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        micro_records_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        micro_records_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t micro_records_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, true }
+};
+
+void micro_records_view_init(
+    struct micro_records_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &micro_records_view_fields[0],
+                      1,
+                      &self_p->offsets[0]);
+}
+
+int micro_records_view_error(
+    struct micro_records_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+void micro_records_view_records_begin(
+    struct micro_records_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 0);
+}
+
+bool micro_records_view_records_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct micro_record_view_t *value_p)
+{
+    struct pbtools_bytes_t value;
+
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, &value);
+    micro_record_view_init(value_p, value.buf_p, value.size);
+
+    return (true);
+}
+
+struct micro_records_t *
+micro_records_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct micro_records_t),
+                (pbtools_message_init_t)micro_records_init));
+}
+
+int micro_records_encode(
+    struct micro_records_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)micro_records_encode_inner));
+}
+
+int micro_records_decode(
+    struct micro_records_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)micro_records_decode_inner));
+}
+
+int micro_records_decode_padded(
+    struct micro_records_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode_padded(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)micro_records_decode_inner));
+}
+
+int micro_records_decode_segments(
+    struct micro_records_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)micro_records_decode_inner));
+}
+
+static void micro_record_columns_alloc(
+    struct pbtools_decoder_t *decoder_p,
+    struct micro_record_columns_t *columns_p,
+    int length)
+{
+    columns_p->length = length;
+    columns_p->timestamp.values_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        length,
+        sizeof(int64_t));
+    columns_p->timestamp.present_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        (length + 7) / 8,
+        sizeof(uint8_t));
+    columns_p->value.values_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        length,
+        sizeof(double));
+    columns_p->value.present_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        (length + 7) / 8,
+        sizeof(uint8_t));
+    columns_p->id.values_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        length,
+        sizeof(int32_t));
+    columns_p->id.present_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        (length + 7) / 8,
+        sizeof(uint8_t));
+}
+
+static void micro_record_decode_columns_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct micro_record_columns_t *columns_p,
+    int index)
+{
+    uint32_t key;
+    int wire_type;
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            columns_p->timestamp.values_p[index] = pbtools_decoder_read_int64_unchecked(decoder_p);
+            columns_p->timestamp.present_p[index / 8] |= (uint8_t)(1u << (index % 8));
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_64_BIT)) {
+                goto field_2;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_64_BIT):
+        field_2:
+            columns_p->value.values_p[index] = pbtools_decoder_read_double_unchecked(decoder_p);
+            columns_p->value.present_p[index / 8] |= (uint8_t)(1u << (index % 8));
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_3;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_VARINT):
+        field_3:
+            columns_p->id.values_p[index] = pbtools_decoder_read_int32_unchecked(decoder_p);
+            columns_p->id.present_p[index / 8] |= (uint8_t)(1u << (index % 8));
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+}
+
+static void micro_record_encode_columns_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    const struct micro_record_columns_t *columns_p)
+{
+    int index;
+    int pos;
+
+    for (index = columns_p->length - 1; index >= 0; index--) {
+        pos = encoder_p->pos;
+
+        if ((columns_p->id.values_p != NULL)
+            && PBTOOLS_COLUMN_IS_PRESENT(
+                columns_p->id.present_p,
+                index)) {
+            pbtools_encoder_write_int32(
+                encoder_p,
+                3,
+                columns_p->id.values_p[index]);
+        }
+
+        if ((columns_p->value.values_p != NULL)
+            && PBTOOLS_COLUMN_IS_PRESENT(
+                columns_p->value.present_p,
+                index)) {
+            pbtools_encoder_write_double(
+                encoder_p,
+                2,
+                columns_p->value.values_p[index]);
+        }
+
+        if ((columns_p->timestamp.values_p != NULL)
+            && PBTOOLS_COLUMN_IS_PRESENT(
+                columns_p->timestamp.present_p,
+                index)) {
+            pbtools_encoder_write_int64(
+                encoder_p,
+                1,
+                columns_p->timestamp.values_p[index]);
+        }
+
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+int micro_records_encode_columns(
+    struct micro_records_t *self_p,
+    uint8_t *encoded_p,
+    size_t size,
+    const struct micro_records_repeated_columns_t *columns_p)
+{
+    struct pbtools_repeated_columns_t columns[] = {
+        {
+            1,
+            columns_p->records_p,
+            (pbtools_columns_alloc_t)micro_record_columns_alloc,
+            (pbtools_columns_decode_inner_t)micro_record_decode_columns_inner,
+            (pbtools_columns_encode_t)micro_record_encode_columns_inner
+        }
+    };
+
+    return (pbtools_message_encode_columns(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)micro_records_encode_inner,
+                &columns[0],
+                1));
+}
+
+int micro_records_decode_columns(
+    struct micro_records_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct micro_records_repeated_columns_t *columns_p)
+{
+    struct pbtools_repeated_columns_t columns[] = {
+        {
+            1,
+            columns_p->records_p,
+            (pbtools_columns_alloc_t)micro_record_columns_alloc,
+            (pbtools_columns_decode_inner_t)micro_record_decode_columns_inner,
+            (pbtools_columns_encode_t)micro_record_encode_columns_inner
+        }
+    };
+
+    return (pbtools_message_decode_columns(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)micro_records_decode_inner,
+                &columns[0],
+                1));
+}
@@ -0,0 +1,2191 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by pbtools.
+ */
+
+#ifndef MICRO_H
+#define MICRO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "pbtools.h"
+
+/**
+ * Message micro.Varints.
+ */
+struct micro_varints_repeated_t {
+    int length;
+    struct micro_varints_t *items_p;
+};
+
+struct micro_varints_t {
+    struct pbtools_message_base_t base;
+    struct pbtools_repeated_uint64_t values;
+};
+
+/**
+ * View of an encoded micro.Varints.
+ */
+struct micro_varints_view_t {
+    struct pbtools_view_t base;
+    int offsets[1];
+};
+
+/**
+ * Message micro.Interleaved.
+ */
+struct micro_interleaved_repeated_t {
+    int length;
+    struct micro_interleaved_t *items_p;
+};
+
+struct micro_interleaved_t {
+    struct pbtools_message_base_t base;
+    struct pbtools_repeated_int32_t values1;
+    struct pbtools_repeated_int32_t values2;
+    struct pbtools_repeated_int32_t values3;
+    struct pbtools_repeated_int32_t values4;
+    struct pbtools_repeated_int32_t values5;
+    struct pbtools_repeated_int32_t values6;
+    struct pbtools_repeated_int32_t values7;
+    struct pbtools_repeated_int32_t values8;
+    struct pbtools_repeated_int32_t values9;
+    struct pbtools_repeated_int32_t values10;
+    struct pbtools_repeated_int32_t values11;
+    struct pbtools_repeated_int32_t values12;
+    struct pbtools_repeated_int32_t values13;
+    struct pbtools_repeated_int32_t values14;
+    struct pbtools_repeated_int32_t values15;
+    struct pbtools_repeated_int32_t values16;
+    struct pbtools_repeated_int32_t values17;
+    struct pbtools_repeated_int32_t values18;
+    struct pbtools_repeated_int32_t values19;
+    struct pbtools_repeated_int32_t values20;
+    struct pbtools_repeated_int32_t values21;
+    struct pbtools_repeated_int32_t values22;
+    struct pbtools_repeated_int32_t values23;
+    struct pbtools_repeated_int32_t values24;
+    struct pbtools_repeated_int32_t values25;
+    struct pbtools_repeated_int32_t values26;
+    struct pbtools_repeated_int32_t values27;
+    struct pbtools_repeated_int32_t values28;
+    struct pbtools_repeated_int32_t values29;
+    struct pbtools_repeated_int32_t values30;
+    struct pbtools_repeated_int32_t values31;
+    struct pbtools_repeated_int32_t values32;
+};
+
+/**
+ * View of an encoded micro.Interleaved.
+ */
+struct micro_interleaved_view_t {
+    struct pbtools_view_t base;
+    int offsets[32];
+};
+
+/**
+ * Message micro.Floats.
+ */
+struct micro_floats_repeated_t {
+    int length;
+    struct micro_floats_t *items_p;
+};
+
+struct micro_floats_t {
+    struct pbtools_message_base_t base;
+    struct pbtools_repeated_float_t values;
+};
+
+/**
+ * View of an encoded micro.Floats.
+ */
+struct micro_floats_view_t {
+    struct pbtools_view_t base;
+    int offsets[1];
+};
+
+/**
+ * Message micro.Doubles.
+ */
+struct micro_doubles_repeated_t {
+    int length;
+    struct micro_doubles_t *items_p;
+};
+
+struct micro_doubles_t {
+    struct pbtools_message_base_t base;
+    struct pbtools_repeated_double_t values;
+};
+
+/**
+ * View of an encoded micro.Doubles.
+ */
+struct micro_doubles_view_t {
+    struct pbtools_view_t base;
+    int offsets[1];
+};
+
+/**
+ * Message micro.Sparse.
+ */
+struct micro_sparse_repeated_t {
+    int length;
+    struct micro_sparse_t *items_p;
+};
+
+struct micro_sparse_t {
+    struct pbtools_message_base_t base;
+    int32_t field1;
+    int32_t field38;
+    int32_t field75;
+    int32_t field112;
+    int32_t field149;
+    int32_t field186;
+    int32_t field223;
+    int32_t field260;
+    int32_t field297;
+    int32_t field334;
+    int32_t field371;
+    int32_t field408;
+    int32_t field445;
+    int32_t field482;
+    int32_t field519;
+    int32_t field556;
+    int32_t field593;
+    int32_t field630;
+    int32_t field667;
+    int32_t field704;
+    int32_t field741;
+    int32_t field778;
+    int32_t field815;
+    int32_t field852;
+    int32_t field889;
+    int32_t field926;
+    int32_t field963;
+    int32_t field1000;
+    int32_t field1037;
+    int32_t field1074;
+    int32_t field1111;
+    int32_t field1148;
+    int32_t field1185;
+    int32_t field1222;
+    int32_t field1259;
+    int32_t field1296;
+    int32_t field1333;
+    int32_t field1370;
+    int32_t field1407;
+    int32_t field1444;
+    int32_t field1481;
+    int32_t field1518;
+    int32_t field1555;
+    int32_t field1592;
+    int32_t field1629;
+    int32_t field1666;
+    int32_t field1703;
+    int32_t field1740;
+    int32_t field1777;
+    int32_t field1814;
+    int32_t field1851;
+    int32_t field1888;
+    int32_t field1925;
+    int32_t field1962;
+    int32_t field1999;
+    int32_t field2036;
+    int32_t field2073;
+    int32_t field2110;
+    int32_t field2147;
+    int32_t field2184;
+    int32_t field2221;
+    int32_t field2258;
+    int32_t field2295;
+    int32_t field2332;
+    int32_t field2369;
+    int32_t field2406;
+    int32_t field2443;
+    int32_t field2480;
+    int32_t field2517;
+    int32_t field2554;
+    int32_t field2591;
+    int32_t field2628;
+    int32_t field2665;
+    int32_t field2702;
+    int32_t field2739;
+    int32_t field2776;
+    int32_t field2813;
+    int32_t field2850;
+    int32_t field2887;
+    int32_t field2924;
+    int32_t field2961;
+    int32_t field2998;
+    int32_t field3035;
+    int32_t field3072;
+    int32_t field3109;
+    int32_t field3146;
+    int32_t field3183;
+    int32_t field3220;
+    int32_t field3257;
+    int32_t field3294;
+    int32_t field3331;
+    int32_t field3368;
+    int32_t field3405;
+    int32_t field3442;
+    int32_t field3479;
+    int32_t field3516;
+    int32_t field3553;
+    int32_t field3590;
+    int32_t field3627;
+    int32_t field3664;
+    int32_t field3701;
+    int32_t field3738;
+    int32_t field3775;
+    int32_t field3812;
+    int32_t field3849;
+    int32_t field3886;
+    int32_t field3923;
+    int32_t field3960;
+    int32_t field3997;
+    int32_t field4034;
+    int32_t field4071;
+    int32_t field4108;
+    int32_t field4145;
+    int32_t field4182;
+    int32_t field4219;
+    int32_t field4256;
+    int32_t field4293;
+    int32_t field4330;
+    int32_t field4367;
+    int32_t field4404;
+    int32_t field4441;
+    int32_t field4478;
+    int32_t field4515;
+    int32_t field4552;
+    int32_t field4589;
+    int32_t field4626;
+    int32_t field4663;
+    int32_t field4700;
+    int32_t field4737;
+    int32_t field4774;
+    int32_t field4811;
+    int32_t field4848;
+    int32_t field4885;
+    int32_t field4922;
+    int32_t field4959;
+    int32_t field4996;
+    int32_t field5033;
+    int32_t field5070;
+    int32_t field5107;
+    int32_t field5144;
+    int32_t field5181;
+    int32_t field5218;
+    int32_t field5255;
+    int32_t field5292;
+    int32_t field5329;
+    int32_t field5366;
+    int32_t field5403;
+    int32_t field5440;
+    int32_t field5477;
+    int32_t field5514;
+    int32_t field5551;
+    int32_t field5588;
+    int32_t field5625;
+    int32_t field5662;
+    int32_t field5699;
+    int32_t field5736;
+    int32_t field5773;
+    int32_t field5810;
+    int32_t field5847;
+    int32_t field5884;
+    int32_t field5921;
+    int32_t field5958;
+    int32_t field5995;
+    int32_t field6032;
+    int32_t field6069;
+    int32_t field6106;
+    int32_t field6143;
+    int32_t field6180;
+    int32_t field6217;
+    int32_t field6254;
+    int32_t field6291;
+    int32_t field6328;
+    int32_t field6365;
+    int32_t field6402;
+    int32_t field6439;
+    int32_t field6476;
+    int32_t field6513;
+    int32_t field6550;
+    int32_t field6587;
+    int32_t field6624;
+    int32_t field6661;
+    int32_t field6698;
+    int32_t field6735;
+    int32_t field6772;
+    int32_t field6809;
+    int32_t field6846;
+    int32_t field6883;
+    int32_t field6920;
+    int32_t field6957;
+    int32_t field6994;
+    int32_t field7031;
+    int32_t field7068;
+    int32_t field7105;
+    int32_t field7142;
+    int32_t field7179;
+    int32_t field7216;
+    int32_t field7253;
+    int32_t field7290;
+    int32_t field7327;
+    int32_t field7364;
+};
+
+/**
+ * View of an encoded micro.Sparse.
+ */
+struct micro_sparse_view_t {
+    struct pbtools_view_t base;
+    int offsets[200];
+};
+
+/**
+ * Message micro.String.
+ */
+struct micro_string_repeated_t {
+    int length;
+    struct micro_string_t *items_p;
+};
+
+struct micro_string_t {
+    struct pbtools_message_base_t base;
+    char *value_p;
+};
+
+/**
+ * View of an encoded micro.String.
+ */
+struct micro_string_view_t {
+    struct pbtools_view_t base;
+    int offsets[1];
+};
+
+/**
+ * Message micro.Record.
+ */
+struct micro_record_repeated_t {
+    int length;
+    struct micro_record_t *items_p;
+};
+
+struct micro_record_t {
+    struct pbtools_message_base_t base;
+    int64_t timestamp;
+    double value;
+    int32_t id;
+};
+
+/**
+ * View of an encoded micro.Record.
+ */
+struct micro_record_view_t {
+    struct pbtools_view_t base;
+    int offsets[3];
+};
+
+/**
+ * Message micro.Records.
+ */
+struct micro_records_repeated_t {
+    int length;
+    struct micro_records_t *items_p;
+};
+
+struct micro_records_t {
+    struct pbtools_message_base_t base;
+    struct micro_record_repeated_t records;
+};
+
+/**
+ * View of an encoded micro.Records.
+ */
+struct micro_records_view_t {
+    struct pbtools_view_t base;
+    int offsets[1];
+};
+
+/**
+ * Columns of repeated micro.Record items.
+ */
+struct micro_record_columns_t {
+    int length;
+    struct {
+        int64_t *values_p;
+        uint8_t *present_p;
+    } timestamp;
+    struct {
+        double *values_p;
+        uint8_t *present_p;
+    } value;
+    struct {
+        int32_t *values_p;
+        uint8_t *present_p;
+    } id;
+};
+
+/**
+ * Columns of micro.Records repeated sub-message fields.
+ */
+struct micro_records_repeated_columns_t {
+    struct micro_record_columns_t *records_p;
+};
+
+int micro_varints_values_alloc(
+    struct micro_varints_t *self_p,
+    int length);
+
+/**
+ * Fields of an encoded micro.Varints read on demand.
+ */
+void micro_varints_view_init(
+    struct micro_varints_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_varints_view_error(
+    struct micro_varints_view_t *self_p);
+
+void micro_varints_view_values_begin(
+    struct micro_varints_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_varints_view_values_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint64_t *value_p);
+
+/**
+ * Encoding and decoding of micro.Varints.
+ */
+struct micro_varints_t *
+micro_varints_new(
+    void *workspace_p,
+    size_t size);
+
+int micro_varints_encode(
+    struct micro_varints_t *self_p,
+    uint8_t *encoded_p,
+    size_t size);
+
+int micro_varints_decode(
+    struct micro_varints_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_varints_decode_padded(
+    struct micro_varints_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_varints_decode_segments(
+    struct micro_varints_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+int micro_varints_values_set_storage(
+    struct micro_varints_t *self_p,
+    uint64_t *items_p,
+    int capacity);
+
+int micro_interleaved_values1_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values2_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values3_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values4_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values5_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values6_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values7_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values8_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values9_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values10_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values11_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values12_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values13_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values14_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values15_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values16_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values17_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values18_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values19_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values20_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values21_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values22_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values23_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values24_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values25_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values26_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values27_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values28_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values29_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values30_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values31_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+int micro_interleaved_values32_alloc(
+    struct micro_interleaved_t *self_p,
+    int length);
+
+/**
+ * Fields of an encoded micro.Interleaved read on demand.
+ */
+void micro_interleaved_view_init(
+    struct micro_interleaved_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_interleaved_view_error(
+    struct micro_interleaved_view_t *self_p);
+
+void micro_interleaved_view_values1_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values1_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values2_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values2_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values3_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values3_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values4_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values4_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values5_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values5_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values6_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values6_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values7_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values7_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values8_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values8_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values9_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values9_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values10_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values10_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values11_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values11_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values12_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values12_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values13_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values13_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values14_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values14_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values15_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values15_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values16_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values16_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values17_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values17_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values18_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values18_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values19_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values19_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values20_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values20_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values21_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values21_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values22_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values22_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values23_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values23_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values24_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values24_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values25_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values25_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values26_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values26_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values27_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values27_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values28_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values28_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values29_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values29_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values30_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values30_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values31_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values31_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void micro_interleaved_view_values32_begin(
+    struct micro_interleaved_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_interleaved_view_values32_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+/**
+ * Encoding and decoding of micro.Interleaved.
+ */
+struct micro_interleaved_t *
+micro_interleaved_new(
+    void *workspace_p,
+    size_t size);
+
+int micro_interleaved_encode(
+    struct micro_interleaved_t *self_p,
+    uint8_t *encoded_p,
+    size_t size);
+
+int micro_interleaved_decode(
+    struct micro_interleaved_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_interleaved_decode_padded(
+    struct micro_interleaved_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_interleaved_decode_segments(
+    struct micro_interleaved_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+int micro_interleaved_values1_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values2_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values3_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values4_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values5_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values6_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values7_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values8_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values9_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values10_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values11_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values12_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values13_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values14_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values15_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values16_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values17_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values18_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values19_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values20_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values21_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values22_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values23_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values24_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values25_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values26_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values27_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values28_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values29_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values30_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values31_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_interleaved_values32_set_storage(
+    struct micro_interleaved_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int micro_floats_values_alloc(
+    struct micro_floats_t *self_p,
+    int length);
+
+/**
+ * Fields of an encoded micro.Floats read on demand.
+ */
+void micro_floats_view_init(
+    struct micro_floats_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_floats_view_error(
+    struct micro_floats_view_t *self_p);
+
+void micro_floats_view_values_begin(
+    struct micro_floats_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_floats_view_values_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    float *value_p);
+
+/**
+ * Encoding and decoding of micro.Floats.
+ */
+struct micro_floats_t *
+micro_floats_new(
+    void *workspace_p,
+    size_t size);
+
+int micro_floats_encode(
+    struct micro_floats_t *self_p,
+    uint8_t *encoded_p,
+    size_t size);
+
+int micro_floats_decode(
+    struct micro_floats_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_floats_decode_padded(
+    struct micro_floats_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_floats_decode_segments(
+    struct micro_floats_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+int micro_floats_values_set_storage(
+    struct micro_floats_t *self_p,
+    float *items_p,
+    int capacity);
+
+int micro_doubles_values_alloc(
+    struct micro_doubles_t *self_p,
+    int length);
+
+/**
+ * Fields of an encoded micro.Doubles read on demand.
+ */
+void micro_doubles_view_init(
+    struct micro_doubles_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_doubles_view_error(
+    struct micro_doubles_view_t *self_p);
+
+void micro_doubles_view_values_begin(
+    struct micro_doubles_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_doubles_view_values_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    double *value_p);
+
+/**
+ * Encoding and decoding of micro.Doubles.
+ */
+struct micro_doubles_t *
+micro_doubles_new(
+    void *workspace_p,
+    size_t size);
+
+int micro_doubles_encode(
+    struct micro_doubles_t *self_p,
+    uint8_t *encoded_p,
+    size_t size);
+
+int micro_doubles_decode(
+    struct micro_doubles_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_doubles_decode_padded(
+    struct micro_doubles_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_doubles_decode_segments(
+    struct micro_doubles_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+int micro_doubles_values_set_storage(
+    struct micro_doubles_t *self_p,
+    double *items_p,
+    int capacity);
+
+/**
+ * Fields of an encoded micro.Sparse read on demand.
+ */
+void micro_sparse_view_init(
+    struct micro_sparse_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_sparse_view_error(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field38(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field75(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field112(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field149(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field186(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field223(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field260(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field297(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field334(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field371(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field408(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field445(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field482(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field519(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field556(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field593(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field630(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field667(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field704(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field741(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field778(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field815(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field852(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field889(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field926(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field963(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1000(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1037(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1074(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1111(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1148(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1185(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1222(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1259(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1296(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1333(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1370(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1407(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1444(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1481(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1518(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1555(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1592(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1629(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1666(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1703(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1740(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1777(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1814(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1851(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1888(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1925(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1962(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field1999(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2036(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2073(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2110(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2147(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2184(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2221(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2258(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2295(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2332(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2369(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2406(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2443(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2480(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2517(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2554(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2591(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2628(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2665(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2702(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2739(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2776(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2813(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2850(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2887(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2924(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2961(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field2998(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3035(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3072(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3109(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3146(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3183(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3220(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3257(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3294(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3331(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3368(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3405(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3442(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3479(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3516(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3553(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3590(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3627(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3664(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3701(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3738(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3775(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3812(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3849(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3886(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3923(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3960(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field3997(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4034(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4071(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4108(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4145(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4182(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4219(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4256(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4293(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4330(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4367(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4404(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4441(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4478(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4515(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4552(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4589(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4626(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4663(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4700(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4737(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4774(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4811(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4848(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4885(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4922(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4959(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field4996(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5033(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5070(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5107(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5144(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5181(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5218(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5255(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5292(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5329(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5366(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5403(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5440(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5477(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5514(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5551(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5588(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5625(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5662(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5699(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5736(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5773(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5810(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5847(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5884(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5921(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5958(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field5995(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6032(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6069(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6106(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6143(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6180(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6217(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6254(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6291(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6328(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6365(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6402(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6439(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6476(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6513(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6550(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6587(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6624(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6661(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6698(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6735(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6772(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6809(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6846(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6883(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6920(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6957(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field6994(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field7031(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field7068(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field7105(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field7142(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field7179(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field7216(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field7253(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field7290(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field7327(
+    struct micro_sparse_view_t *self_p);
+
+int32_t micro_sparse_view_get_field7364(
+    struct micro_sparse_view_t *self_p);
+
+/**
+ * Encoding and decoding of micro.Sparse.
+ */
+struct micro_sparse_t *
+micro_sparse_new(
+    void *workspace_p,
+    size_t size);
+
+int micro_sparse_encode(
+    struct micro_sparse_t *self_p,
+    uint8_t *encoded_p,
+    size_t size);
+
+int micro_sparse_decode(
+    struct micro_sparse_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_sparse_decode_padded(
+    struct micro_sparse_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_sparse_decode_segments(
+    struct micro_sparse_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+/**
+ * Fields of an encoded micro.String read on demand.
+ */
+void micro_string_view_init(
+    struct micro_string_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_string_view_error(
+    struct micro_string_view_t *self_p);
+
+struct pbtools_bytes_t micro_string_view_get_value(
+    struct micro_string_view_t *self_p);
+
+/**
+ * Encoding and decoding of micro.String.
+ */
+struct micro_string_t *
+micro_string_new(
+    void *workspace_p,
+    size_t size);
+
+int micro_string_encode(
+    struct micro_string_t *self_p,
+    uint8_t *encoded_p,
+    size_t size);
+
+int micro_string_decode(
+    struct micro_string_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_string_decode_padded(
+    struct micro_string_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_string_decode_segments(
+    struct micro_string_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+/**
+ * Fields of an encoded micro.Record read on demand.
+ */
+void micro_record_view_init(
+    struct micro_record_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_record_view_error(
+    struct micro_record_view_t *self_p);
+
+int64_t micro_record_view_get_timestamp(
+    struct micro_record_view_t *self_p);
+
+double micro_record_view_get_value(
+    struct micro_record_view_t *self_p);
+
+int32_t micro_record_view_get_id(
+    struct micro_record_view_t *self_p);
+
+/**
+ * Encoding and decoding of micro.Record.
+ */
+struct micro_record_t *
+micro_record_new(
+    void *workspace_p,
+    size_t size);
+
+int micro_record_encode(
+    struct micro_record_t *self_p,
+    uint8_t *encoded_p,
+    size_t size);
+
+int micro_record_decode(
+    struct micro_record_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_record_decode_padded(
+    struct micro_record_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_record_decode_segments(
+    struct micro_record_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+int micro_records_records_alloc(
+    struct micro_records_t *self_p,
+    int length);
+
+/**
+ * Fields of an encoded micro.Records read on demand.
+ */
+void micro_records_view_init(
+    struct micro_records_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_records_view_error(
+    struct micro_records_view_t *self_p);
+
+void micro_records_view_records_begin(
+    struct micro_records_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool micro_records_view_records_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct micro_record_view_t *value_p);
+
+/**
+ * Encoding and decoding of micro.Records.
+ */
+struct micro_records_t *
+micro_records_new(
+    void *workspace_p,
+    size_t size);
+
+int micro_records_encode(
+    struct micro_records_t *self_p,
+    uint8_t *encoded_p,
+    size_t size);
+
+int micro_records_decode(
+    struct micro_records_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_records_decode_padded(
+    struct micro_records_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int micro_records_decode_segments(
+    struct micro_records_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+int micro_records_encode_columns(
+    struct micro_records_t *self_p,
+    uint8_t *encoded_p,
+    size_t size,
+    const struct micro_records_repeated_columns_t *columns_p);
+
+int micro_records_decode_columns(
+    struct micro_records_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct micro_records_repeated_columns_t *columns_p);
+
+/* Internal functions. Do not use! */
+
+void micro_varints_init(
+    struct micro_varints_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void micro_varints_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct micro_varints_t *self_p);
+
+void micro_varints_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct micro_varints_t *self_p);
+
+void micro_varints_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct micro_varints_repeated_t *repeated_p);
+
+void micro_varints_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct micro_varints_repeated_t *repeated_p);
+
+void micro_interleaved_init(
+    struct micro_interleaved_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void micro_interleaved_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct micro_interleaved_t *self_p);
+
+void micro_interleaved_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct micro_interleaved_t *self_p);
+
+void micro_interleaved_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct micro_interleaved_repeated_t *repeated_p);
+
+void micro_interleaved_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct micro_interleaved_repeated_t *repeated_p);
+
+void micro_floats_init(
+    struct micro_floats_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void micro_floats_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct micro_floats_t *self_p);
+
+void micro_floats_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct micro_floats_t *self_p);
+
+void micro_floats_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct micro_floats_repeated_t *repeated_p);
+
+void micro_floats_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct micro_floats_repeated_t *repeated_p);
+
+void micro_doubles_init(
+    struct micro_doubles_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void micro_doubles_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct micro_doubles_t *self_p);
+
+void micro_doubles_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct micro_doubles_t *self_p);
+
+void micro_doubles_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct micro_doubles_repeated_t *repeated_p);
+
+void micro_doubles_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct micro_doubles_repeated_t *repeated_p);
+
+void micro_sparse_init(
+    struct micro_sparse_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void micro_sparse_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct micro_sparse_t *self_p);
+
+void micro_sparse_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct micro_sparse_t *self_p);
+
+void micro_sparse_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct micro_sparse_repeated_t *repeated_p);
+
+void micro_sparse_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct micro_sparse_repeated_t *repeated_p);
+
+void micro_string_init(
+    struct micro_string_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void micro_string_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct micro_string_t *self_p);
+
+void micro_string_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct micro_string_t *self_p);
+
+void micro_string_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct micro_string_repeated_t *repeated_p);
+
+void micro_string_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct micro_string_repeated_t *repeated_p);
+
+void micro_record_init(
+    struct micro_record_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void micro_record_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct micro_record_t *self_p);
+
+void micro_record_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct micro_record_t *self_p);
+
+void micro_record_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct micro_record_repeated_t *repeated_p);
+
+void micro_record_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct micro_record_repeated_t *repeated_p);
+
+void micro_records_init(
+    struct micro_records_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void micro_records_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct micro_records_t *self_p);
+
+void micro_records_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct micro_records_t *self_p);
+
+void micro_records_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct micro_records_repeated_t *repeated_p);
+
+void micro_records_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct micro_records_repeated_t *repeated_p);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
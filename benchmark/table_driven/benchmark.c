@@ -0,0 +1,2634 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by pbtools.
+ */
+
+#include <limits.h>
+#include "benchmark.h"
+
+#if CHAR_BIT != 8
+#    error "Number of bits in a char must be 8."
+#endif
+
+static const struct pbtools_field_info_t benchmark_sub_message_fields[] = {
+    {
+        1,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_UINT32,
+        0,
+        0,
+        offsetof(struct benchmark_sub_message_t, field1),
+        0,
+        NULL
+    },
+    {
+        2,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_UINT32,
+        0,
+        0,
+        offsetof(struct benchmark_sub_message_t, field2),
+        0,
+        NULL
+    },
+    {
+        3,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct benchmark_sub_message_t, field3),
+        0,
+        NULL
+    },
+    {
+        15,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_STRING,
+        0,
+        0,
+        offsetof(struct benchmark_sub_message_t, field15_p),
+        0,
+        NULL
+    },
+    {
+        12,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_BYTES,
+        0,
+        0,
+        offsetof(struct benchmark_sub_message_t, field12),
+        0,
+        NULL
+    },
+    {
+        13,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT64,
+        0,
+        0,
+        offsetof(struct benchmark_sub_message_t, field13),
+        0,
+        NULL
+    },
+    {
+        14,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT64,
+        0,
+        0,
+        offsetof(struct benchmark_sub_message_t, field14),
+        0,
+        NULL
+    },
+    {
+        21,
+        PBTOOLS_WIRE_TYPE_64_BIT,
+        PBTOOLS_FIELD_KIND_FIXED64,
+        0,
+        0,
+        offsetof(struct benchmark_sub_message_t, field21),
+        0,
+        NULL
+    },
+    {
+        22,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct benchmark_sub_message_t, field22),
+        0,
+        NULL
+    },
+    {
+        206,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_BOOL,
+        0,
+        0,
+        offsetof(struct benchmark_sub_message_t, field206),
+        0,
+        NULL
+    },
+    {
+        203,
+        PBTOOLS_WIRE_TYPE_32_BIT,
+        PBTOOLS_FIELD_KIND_FIXED32,
+        0,
+        0,
+        offsetof(struct benchmark_sub_message_t, field203),
+        0,
+        NULL
+    },
+    {
+        204,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct benchmark_sub_message_t, field204),
+        0,
+        NULL
+    },
+    {
+        205,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_STRING,
+        0,
+        0,
+        offsetof(struct benchmark_sub_message_t, field205_p),
+        0,
+        NULL
+    },
+    {
+        207,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_UINT64,
+        0,
+        0,
+        offsetof(struct benchmark_sub_message_t, field207),
+        0,
+        NULL
+    },
+    {
+        300,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_ENUM,
+        0,
+        0,
+        offsetof(struct benchmark_sub_message_t, field300),
+        0,
+        NULL
+    }
+};
+
+static const uint16_t benchmark_sub_message_sorted_indexes[] = {
+    0,
+    1,
+    2,
+    4,
+    5,
+    6,
+    3,
+    7,
+    8,
+    10,
+    11,
+    12,
+    9,
+    13,
+    14
+};
+
+const struct pbtools_message_info_t benchmark_sub_message_info = {
+    sizeof(struct benchmark_sub_message_t),
+    (pbtools_message_init_t)benchmark_sub_message_init,
+    (pbtools_message_encode_inner_t)benchmark_sub_message_encode_inner,
+    (pbtools_message_decode_inner_t)benchmark_sub_message_decode_inner,
+    15,
+    &benchmark_sub_message_fields[0],
+    &benchmark_sub_message_sorted_indexes[0],
+    0,
+    NULL
+};
+
+void benchmark_sub_message_init(
+    struct benchmark_sub_message_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->field1 = 0;
+    self_p->field2 = 0;
+    self_p->field3 = 0;
+    self_p->field15_p = "";
+    pbtools_bytes_init(&self_p->field12);
+    self_p->field13 = 0;
+    self_p->field14 = 0;
+    self_p->field21 = 0;
+    self_p->field22 = 0;
+    self_p->field206 = 0;
+    self_p->field203 = 0;
+    self_p->field204 = 0;
+    self_p->field205_p = "";
+    self_p->field207 = 0;
+    self_p->field300 = 0;
+}
+
+void benchmark_sub_message_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct benchmark_sub_message_t *self_p)
+{
+    pbtools_message_info_encode_inner(encoder_p, &self_p->base, &benchmark_sub_message_info);
+}
+
+void benchmark_sub_message_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_sub_message_t *self_p)
+{
+    pbtools_message_info_decode_inner(decoder_p,
+                                      &self_p->base,
+                                      &benchmark_sub_message_info,
+                                      NULL);
+}
+
+void benchmark_sub_message_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct benchmark_sub_message_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        benchmark_sub_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void benchmark_sub_message_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct benchmark_sub_message_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct benchmark_sub_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        benchmark_sub_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        benchmark_sub_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t benchmark_sub_message_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 15, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 12, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 13, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 14, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 21, PBTOOLS_WIRE_TYPE_64_BIT, false },
+    { 22, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 206, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 203, PBTOOLS_WIRE_TYPE_32_BIT, false },
+    { 204, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 205, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 207, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 300, PBTOOLS_WIRE_TYPE_VARINT, false }
+};
+
+void benchmark_sub_message_view_init(
+    struct benchmark_sub_message_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &benchmark_sub_message_view_fields[0],
+                      15,
+                      &self_p->offsets[0]);
+}
+
+int benchmark_sub_message_view_error(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+uint32_t benchmark_sub_message_view_get_field1(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 0, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_uint32_unchecked(&decoder));
+}
+
+uint32_t benchmark_sub_message_view_get_field2(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 1, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_uint32_unchecked(&decoder));
+}
+
+int32_t benchmark_sub_message_view_get_field3(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 2, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+struct pbtools_bytes_t benchmark_sub_message_view_get_field15(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+
+    value.buf_p = NULL;
+    value.size = 0;
+
+    if (pbtools_view_seek(&self_p->base, 3, &decoder)) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    return (value);
+}
+
+struct pbtools_bytes_t benchmark_sub_message_view_get_field12(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+
+    value.buf_p = NULL;
+    value.size = 0;
+
+    if (pbtools_view_seek(&self_p->base, 4, &decoder)) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    return (value);
+}
+
+int64_t benchmark_sub_message_view_get_field13(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 5, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int64_unchecked(&decoder));
+}
+
+int64_t benchmark_sub_message_view_get_field14(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 6, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int64_unchecked(&decoder));
+}
+
+uint64_t benchmark_sub_message_view_get_field21(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 7, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_fixed64_unchecked(&decoder));
+}
+
+int32_t benchmark_sub_message_view_get_field22(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 8, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+bool benchmark_sub_message_view_get_field206(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 9, &decoder)) {
+        return (false);
+    }
+
+    return (pbtools_decoder_read_bool_unchecked(&decoder));
+}
+
+uint32_t benchmark_sub_message_view_get_field203(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 10, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_fixed32_unchecked(&decoder));
+}
+
+int32_t benchmark_sub_message_view_get_field204(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 11, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+struct pbtools_bytes_t benchmark_sub_message_view_get_field205(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+
+    value.buf_p = NULL;
+    value.size = 0;
+
+    if (pbtools_view_seek(&self_p->base, 12, &decoder)) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    return (value);
+}
+
+uint64_t benchmark_sub_message_view_get_field207(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 13, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_uint64_unchecked(&decoder));
+}
+
+enum benchmark_enum_e benchmark_sub_message_view_get_field300(
+    struct benchmark_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 14, &decoder)) {
+        return ((enum benchmark_enum_e)0);
+    }
+
+    return ((enum benchmark_enum_e)pbtools_decoder_read_enum_unchecked(&decoder));
+}
+
+struct benchmark_sub_message_t *
+benchmark_sub_message_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct benchmark_sub_message_t),
+                (pbtools_message_init_t)benchmark_sub_message_init));
+}
+
+int benchmark_sub_message_encode(
+    struct benchmark_sub_message_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)benchmark_sub_message_encode_inner));
+}
+
+int benchmark_sub_message_decode(
+    struct benchmark_sub_message_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)benchmark_sub_message_decode_inner));
+}
+
+int benchmark_sub_message_validate(
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_validate(encoded_p,
+                                     size,
+                                     &benchmark_sub_message_info));
+}
+
+int benchmark_sub_message_decode_masked(
+    struct benchmark_sub_message_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_field_mask_t *mask_p)
+{
+    return (pbtools_message_decode_masked(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)benchmark_sub_message_decode_inner,
+                mask_p));
+}
+
+int benchmark_sub_message_decode_limited(
+    struct benchmark_sub_message_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_decode_limits_t *limits_p)
+{
+    return (pbtools_message_decode_limited(&self_p->base,
+                                           encoded_p,
+                                           size,
+                                           &benchmark_sub_message_info,
+                                           limits_p));
+}
+
+void benchmark_sub_message_decoder_init(
+    struct pbtools_stream_decoder_t *decoder_p,
+    struct benchmark_sub_message_t *self_p)
+{
+    pbtools_stream_decoder_init(decoder_p,
+                                &self_p->base,
+                                &benchmark_sub_message_info);
+}
+
+int benchmark_sub_message_decoder_feed(
+    struct pbtools_stream_decoder_t *decoder_p,
+    const uint8_t *chunk_p,
+    size_t size)
+{
+    return (pbtools_stream_decoder_feed(decoder_p, chunk_p, size));
+}
+
+int benchmark_sub_message_decoder_finish(
+    struct pbtools_stream_decoder_t *decoder_p)
+{
+    return (pbtools_stream_decoder_finish(decoder_p));
+}
+
+static const struct pbtools_field_info_t benchmark_message1_fields[] = {
+    {
+        80,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_BOOL,
+        0,
+        0,
+        offsetof(struct benchmark_message1_t, field80),
+        0,
+        NULL
+    },
+    {
+        81,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_BOOL,
+        0,
+        0,
+        offsetof(struct benchmark_message1_t, field81),
+        0,
+        NULL
+    },
+    {
+        2,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct benchmark_message1_t, field2),
+        0,
+        NULL
+    },
+    {
+        3,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct benchmark_message1_t, field3),
+        0,
+        NULL
+    },
+    {
+        280,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct benchmark_message1_t, field280),
+        0,
+        NULL
+    },
+    {
+        6,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct benchmark_message1_t, field6),
+        0,
+        NULL
+    },
+    {
+        22,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT64,
+        0,
+        0,
+        offsetof(struct benchmark_message1_t, field22),
+        0,
+        NULL
+    },
+    {
+        4,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_STRING,
+        PBTOOLS_FIELD_FLAG_REPEATED,
+        0,
+        offsetof(struct benchmark_message1_t, field4),
+        0,
+        NULL
+    },
+    {
+        59,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_BOOL,
+        0,
+        0,
+        offsetof(struct benchmark_message1_t, field59),
+        0,
+        NULL
+    },
+    {
+        16,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct benchmark_message1_t, field16),
+        0,
+        NULL
+    },
+    {
+        150,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct benchmark_message1_t, field150),
+        0,
+        NULL
+    },
+    {
+        23,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct benchmark_message1_t, field23),
+        0,
+        NULL
+    },
+    {
+        24,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_BOOL,
+        0,
+        0,
+        offsetof(struct benchmark_message1_t, field24),
+        0,
+        NULL
+    },
+    {
+        25,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct benchmark_message1_t, field25),
+        0,
+        NULL
+    },
+    {
+        15,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_MESSAGE,
+        0,
+        0,
+        offsetof(struct benchmark_message1_t, field15_p),
+        0,
+        &benchmark_sub_message_info
+    },
+    {
+        78,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_BOOL,
+        0,
+        0,
+        offsetof(struct benchmark_message1_t, field78),
+        0,
+        NULL
+    },
+    {
+        67,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct benchmark_message1_t, field67),
+        0,
+        NULL
+    },
+    {
+        68,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct benchmark_message1_t, field68),
+        0,
+        NULL
+    },
+    {
+        128,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct benchmark_message1_t, field128),
+        0,
+        NULL
+    },
+    {
+        129,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_STRING,
+        0,
+        0,
+        offsetof(struct benchmark_message1_t, field129_p),
+        0,
+        NULL
+    },
+    {
+        131,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct benchmark_message1_t, field131),
+        0,
+        NULL
+    }
+};
+
+static const uint16_t benchmark_message1_sorted_indexes[] = {
+    2,
+    3,
+    7,
+    5,
+    14,
+    9,
+    6,
+    11,
+    12,
+    13,
+    8,
+    16,
+    17,
+    15,
+    0,
+    1,
+    18,
+    19,
+    20,
+    10,
+    4
+};
+
+const struct pbtools_message_info_t benchmark_message1_info = {
+    sizeof(struct benchmark_message1_t),
+    (pbtools_message_init_t)benchmark_message1_init,
+    (pbtools_message_encode_inner_t)benchmark_message1_encode_inner,
+    (pbtools_message_decode_inner_t)benchmark_message1_decode_inner,
+    21,
+    &benchmark_message1_fields[0],
+    &benchmark_message1_sorted_indexes[0],
+    0,
+    NULL
+};
+
+void benchmark_message1_init(
+    struct benchmark_message1_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->field80 = 0;
+    self_p->field81 = 0;
+    self_p->field2 = 0;
+    self_p->field3 = 0;
+    self_p->field280 = 0;
+    self_p->field6 = 0;
+    self_p->field22 = 0;
+    self_p->field4.length = 0;
+    self_p->field59 = 0;
+    self_p->field16 = 0;
+    self_p->field150 = 0;
+    self_p->field23 = 0;
+    self_p->field24 = 0;
+    self_p->field25 = 0;
+    self_p->field15_p = NULL;
+    self_p->field78 = 0;
+    self_p->field67 = 0;
+    self_p->field68 = 0;
+    self_p->field128 = 0;
+    self_p->field129_p = "";
+    self_p->field131 = 0;
+}
+
+void benchmark_message1_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct benchmark_message1_t *self_p)
+{
+    pbtools_message_info_encode_inner(encoder_p, &self_p->base, &benchmark_message1_info);
+}
+
+void benchmark_message1_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message1_t *self_p)
+{
+    struct pbtools_repeated_info_t repeated_infos[1];
+
+    pbtools_message_info_decode_inner(decoder_p,
+                                      &self_p->base,
+                                      &benchmark_message1_info,
+                                      &repeated_infos[0]);
+}
+
+int benchmark_message1_field15_alloc(
+    struct benchmark_message1_t *self_p)
+{
+    return (pbtools_sub_message_alloc(
+                (struct pbtools_message_base_t **)&self_p->field15_p,
+                self_p->base.heap_p,
+                sizeof(struct benchmark_sub_message_t),
+                (pbtools_message_init_t)benchmark_sub_message_init));
+}
+
+int benchmark_message1_field4_alloc(
+    struct benchmark_message1_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_string(
+                &self_p->base,
+                length,
+                &self_p->field4));
+}
+
+void benchmark_message1_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct benchmark_message1_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        benchmark_message1_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void benchmark_message1_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct benchmark_message1_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct benchmark_message1_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        benchmark_message1_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        benchmark_message1_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t benchmark_message1_view_fields[] = {
+    { 80, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 81, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 280, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 22, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, true },
+    { 59, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 16, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 150, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 23, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 24, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 25, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 15, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 78, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 67, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 68, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 128, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 129, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 131, PBTOOLS_WIRE_TYPE_VARINT, false }
+};
+
+void benchmark_message1_view_init(
+    struct benchmark_message1_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &benchmark_message1_view_fields[0],
+                      21,
+                      &self_p->offsets[0]);
+}
+
+int benchmark_message1_view_error(
+    struct benchmark_message1_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+bool benchmark_message1_view_get_field80(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 0, &decoder)) {
+        return (false);
+    }
+
+    return (pbtools_decoder_read_bool_unchecked(&decoder));
+}
+
+bool benchmark_message1_view_get_field81(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 1, &decoder)) {
+        return (false);
+    }
+
+    return (pbtools_decoder_read_bool_unchecked(&decoder));
+}
+
+int32_t benchmark_message1_view_get_field2(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 2, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t benchmark_message1_view_get_field3(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 3, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t benchmark_message1_view_get_field280(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 4, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t benchmark_message1_view_get_field6(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 5, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int64_t benchmark_message1_view_get_field22(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 6, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int64_unchecked(&decoder));
+}
+
+void benchmark_message1_view_field4_begin(
+    struct benchmark_message1_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 7);
+}
+
+bool benchmark_message1_view_field4_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct pbtools_bytes_t *value_p)
+{{
+    if (!pbtools_view_iterator_next(iterator_p)) {{
+        return (false);
+    }}
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, value_p);
+
+    return (true);
+}}
+
+bool benchmark_message1_view_get_field59(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 8, &decoder)) {
+        return (false);
+    }
+
+    return (pbtools_decoder_read_bool_unchecked(&decoder));
+}
+
+int32_t benchmark_message1_view_get_field16(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 9, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t benchmark_message1_view_get_field150(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 10, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t benchmark_message1_view_get_field23(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 11, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+bool benchmark_message1_view_get_field24(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 12, &decoder)) {
+        return (false);
+    }
+
+    return (pbtools_decoder_read_bool_unchecked(&decoder));
+}
+
+int32_t benchmark_message1_view_get_field25(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 13, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+bool benchmark_message1_view_get_field15(
+    struct benchmark_message1_view_t *self_p,
+    struct benchmark_sub_message_view_t *value_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+    bool found;
+
+    value.buf_p = NULL;
+    value.size = 0;
+    found = pbtools_view_seek(&self_p->base, 14, &decoder);
+
+    if (found) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    benchmark_sub_message_view_init(value_p, value.buf_p, value.size);
+
+    return (found);
+}
+
+bool benchmark_message1_view_get_field78(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 15, &decoder)) {
+        return (false);
+    }
+
+    return (pbtools_decoder_read_bool_unchecked(&decoder));
+}
+
+int32_t benchmark_message1_view_get_field67(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 16, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t benchmark_message1_view_get_field68(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 17, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int32_t benchmark_message1_view_get_field128(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 18, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+struct pbtools_bytes_t benchmark_message1_view_get_field129(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+
+    value.buf_p = NULL;
+    value.size = 0;
+
+    if (pbtools_view_seek(&self_p->base, 19, &decoder)) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    return (value);
+}
+
+int32_t benchmark_message1_view_get_field131(
+    struct benchmark_message1_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 20, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+struct benchmark_message1_t *
+benchmark_message1_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct benchmark_message1_t),
+                (pbtools_message_init_t)benchmark_message1_init));
+}
+
+int benchmark_message1_encode(
+    struct benchmark_message1_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)benchmark_message1_encode_inner));
+}
+
+int benchmark_message1_decode(
+    struct benchmark_message1_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)benchmark_message1_decode_inner));
+}
+
+int benchmark_message1_validate(
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_validate(encoded_p,
+                                     size,
+                                     &benchmark_message1_info));
+}
+
+int benchmark_message1_decode_masked(
+    struct benchmark_message1_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_field_mask_t *mask_p)
+{
+    return (pbtools_message_decode_masked(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)benchmark_message1_decode_inner,
+                mask_p));
+}
+
+int benchmark_message1_decode_limited(
+    struct benchmark_message1_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_decode_limits_t *limits_p)
+{
+    return (pbtools_message_decode_limited(&self_p->base,
+                                           encoded_p,
+                                           size,
+                                           &benchmark_message1_info,
+                                           limits_p));
+}
+
+void benchmark_message1_decoder_init(
+    struct pbtools_stream_decoder_t *decoder_p,
+    struct benchmark_message1_t *self_p)
+{
+    pbtools_stream_decoder_init(decoder_p,
+                                &self_p->base,
+                                &benchmark_message1_info);
+}
+
+int benchmark_message1_decoder_feed(
+    struct pbtools_stream_decoder_t *decoder_p,
+    const uint8_t *chunk_p,
+    size_t size)
+{
+    return (pbtools_stream_decoder_feed(decoder_p, chunk_p, size));
+}
+
+int benchmark_message1_decoder_finish(
+    struct pbtools_stream_decoder_t *decoder_p)
+{
+    return (pbtools_stream_decoder_finish(decoder_p));
+}
+
+static const struct pbtools_field_info_t benchmark_message2_fields[] = {
+    {
+        1,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_ENUM,
+        0,
+        0,
+        offsetof(struct benchmark_message2_t, field1),
+        0,
+        NULL
+    },
+    {
+        2,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_UINT64,
+        0,
+        0,
+        offsetof(struct benchmark_message2_t, field2),
+        0,
+        NULL
+    },
+    {
+        3,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_SINT32,
+        0,
+        0,
+        offsetof(struct benchmark_message2_t, field3),
+        0,
+        NULL
+    },
+    {
+        4,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_STRING,
+        0,
+        0,
+        offsetof(struct benchmark_message2_t, field4_p),
+        0,
+        NULL
+    },
+    {
+        5,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct benchmark_message2_t, field5),
+        0,
+        NULL
+    },
+    {
+        6,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_BOOL,
+        0,
+        0,
+        offsetof(struct benchmark_message2_t, field6),
+        0,
+        NULL
+    }
+};
+
+const struct pbtools_message_info_t benchmark_message2_info = {
+    sizeof(struct benchmark_message2_t),
+    (pbtools_message_init_t)benchmark_message2_init,
+    (pbtools_message_encode_inner_t)benchmark_message2_encode_inner,
+    (pbtools_message_decode_inner_t)benchmark_message2_decode_inner,
+    6,
+    &benchmark_message2_fields[0],
+    NULL,
+    0,
+    NULL
+};
+
+void benchmark_message2_init(
+    struct benchmark_message2_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->field1 = 0;
+    self_p->field2 = 0;
+    self_p->field3 = 0;
+    self_p->field4_p = "";
+    self_p->field5 = 0;
+    self_p->field6 = 0;
+}
+
+void benchmark_message2_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct benchmark_message2_t *self_p)
+{
+    pbtools_message_info_encode_inner(encoder_p, &self_p->base, &benchmark_message2_info);
+}
+
+void benchmark_message2_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message2_t *self_p)
+{
+    pbtools_message_info_decode_inner(decoder_p,
+                                      &self_p->base,
+                                      &benchmark_message2_info,
+                                      NULL);
+}
+
+void benchmark_message2_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct benchmark_message2_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        benchmark_message2_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void benchmark_message2_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct benchmark_message2_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct benchmark_message2_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        benchmark_message2_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        benchmark_message2_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t benchmark_message2_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 5, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 6, PBTOOLS_WIRE_TYPE_VARINT, false }
+};
+
+void benchmark_message2_view_init(
+    struct benchmark_message2_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &benchmark_message2_view_fields[0],
+                      6,
+                      &self_p->offsets[0]);
+}
+
+int benchmark_message2_view_error(
+    struct benchmark_message2_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+enum benchmark_enum_e benchmark_message2_view_get_field1(
+    struct benchmark_message2_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 0, &decoder)) {
+        return ((enum benchmark_enum_e)0);
+    }
+
+    return ((enum benchmark_enum_e)pbtools_decoder_read_enum_unchecked(&decoder));
+}
+
+uint64_t benchmark_message2_view_get_field2(
+    struct benchmark_message2_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 1, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_uint64_unchecked(&decoder));
+}
+
+int32_t benchmark_message2_view_get_field3(
+    struct benchmark_message2_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 2, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_sint32_unchecked(&decoder));
+}
+
+struct pbtools_bytes_t benchmark_message2_view_get_field4(
+    struct benchmark_message2_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+
+    value.buf_p = NULL;
+    value.size = 0;
+
+    if (pbtools_view_seek(&self_p->base, 3, &decoder)) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    return (value);
+}
+
+int32_t benchmark_message2_view_get_field5(
+    struct benchmark_message2_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 4, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+bool benchmark_message2_view_get_field6(
+    struct benchmark_message2_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 5, &decoder)) {
+        return (false);
+    }
+
+    return (pbtools_decoder_read_bool_unchecked(&decoder));
+}
+
+struct benchmark_message2_t *
+benchmark_message2_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct benchmark_message2_t),
+                (pbtools_message_init_t)benchmark_message2_init));
+}
+
+int benchmark_message2_encode(
+    struct benchmark_message2_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)benchmark_message2_encode_inner));
+}
+
+int benchmark_message2_decode(
+    struct benchmark_message2_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)benchmark_message2_decode_inner));
+}
+
+int benchmark_message2_validate(
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_validate(encoded_p,
+                                     size,
+                                     &benchmark_message2_info));
+}
+
+int benchmark_message2_decode_masked(
+    struct benchmark_message2_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_field_mask_t *mask_p)
+{
+    return (pbtools_message_decode_masked(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)benchmark_message2_decode_inner,
+                mask_p));
+}
+
+int benchmark_message2_decode_limited(
+    struct benchmark_message2_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_decode_limits_t *limits_p)
+{
+    return (pbtools_message_decode_limited(&self_p->base,
+                                           encoded_p,
+                                           size,
+                                           &benchmark_message2_info,
+                                           limits_p));
+}
+
+void benchmark_message2_decoder_init(
+    struct pbtools_stream_decoder_t *decoder_p,
+    struct benchmark_message2_t *self_p)
+{
+    pbtools_stream_decoder_init(decoder_p,
+                                &self_p->base,
+                                &benchmark_message2_info);
+}
+
+int benchmark_message2_decoder_feed(
+    struct pbtools_stream_decoder_t *decoder_p,
+    const uint8_t *chunk_p,
+    size_t size)
+{
+    return (pbtools_stream_decoder_feed(decoder_p, chunk_p, size));
+}
+
+int benchmark_message2_decoder_finish(
+    struct pbtools_stream_decoder_t *decoder_p)
+{
+    return (pbtools_stream_decoder_finish(decoder_p));
+}
+
+static const struct pbtools_field_info_t benchmark_message3_sub_message_fields[] = {
+    {
+        28,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct benchmark_message3_sub_message_t, field28),
+        0,
+        NULL
+    },
+    {
+        2,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT64,
+        0,
+        0,
+        offsetof(struct benchmark_message3_sub_message_t, field2),
+        0,
+        NULL
+    },
+    {
+        12,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct benchmark_message3_sub_message_t, field12),
+        0,
+        NULL
+    },
+    {
+        19,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_STRING,
+        0,
+        0,
+        offsetof(struct benchmark_message3_sub_message_t, field19_p),
+        0,
+        NULL
+    },
+    {
+        11,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct benchmark_message3_sub_message_t, field11),
+        0,
+        NULL
+    }
+};
+
+static const uint16_t benchmark_message3_sub_message_sorted_indexes[] = {
+    1,
+    4,
+    2,
+    3,
+    0
+};
+
+const struct pbtools_message_info_t benchmark_message3_sub_message_info = {
+    sizeof(struct benchmark_message3_sub_message_t),
+    (pbtools_message_init_t)benchmark_message3_sub_message_init,
+    (pbtools_message_encode_inner_t)benchmark_message3_sub_message_encode_inner,
+    (pbtools_message_decode_inner_t)benchmark_message3_sub_message_decode_inner,
+    5,
+    &benchmark_message3_sub_message_fields[0],
+    &benchmark_message3_sub_message_sorted_indexes[0],
+    0,
+    NULL
+};
+
+void benchmark_message3_sub_message_init(
+    struct benchmark_message3_sub_message_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->field28 = 0;
+    self_p->field2 = 0;
+    self_p->field12 = 0;
+    self_p->field19_p = "";
+    self_p->field11 = 0;
+}
+
+void benchmark_message3_sub_message_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct benchmark_message3_sub_message_t *self_p)
+{
+    pbtools_message_info_encode_inner(encoder_p, &self_p->base, &benchmark_message3_sub_message_info);
+}
+
+void benchmark_message3_sub_message_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message3_sub_message_t *self_p)
+{
+    pbtools_message_info_decode_inner(decoder_p,
+                                      &self_p->base,
+                                      &benchmark_message3_sub_message_info,
+                                      NULL);
+}
+
+void benchmark_message3_sub_message_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct benchmark_message3_sub_message_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        benchmark_message3_sub_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void benchmark_message3_sub_message_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct benchmark_message3_sub_message_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct benchmark_message3_sub_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        benchmark_message3_sub_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        benchmark_message3_sub_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t benchmark_message3_sub_message_view_fields[] = {
+    { 28, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 12, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 19, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 11, PBTOOLS_WIRE_TYPE_VARINT, false }
+};
+
+void benchmark_message3_sub_message_view_init(
+    struct benchmark_message3_sub_message_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &benchmark_message3_sub_message_view_fields[0],
+                      5,
+                      &self_p->offsets[0]);
+}
+
+int benchmark_message3_sub_message_view_error(
+    struct benchmark_message3_sub_message_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+int32_t benchmark_message3_sub_message_view_get_field28(
+    struct benchmark_message3_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 0, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+int64_t benchmark_message3_sub_message_view_get_field2(
+    struct benchmark_message3_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 1, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int64_unchecked(&decoder));
+}
+
+int32_t benchmark_message3_sub_message_view_get_field12(
+    struct benchmark_message3_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 2, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+struct pbtools_bytes_t benchmark_message3_sub_message_view_get_field19(
+    struct benchmark_message3_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+
+    value.buf_p = NULL;
+    value.size = 0;
+
+    if (pbtools_view_seek(&self_p->base, 3, &decoder)) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    return (value);
+}
+
+int32_t benchmark_message3_sub_message_view_get_field11(
+    struct benchmark_message3_sub_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 4, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+static const struct pbtools_field_info_t benchmark_message3_fields[] = {
+    {
+        13,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_MESSAGE,
+        PBTOOLS_FIELD_FLAG_REPEATED,
+        0,
+        offsetof(struct benchmark_message3_t, field13),
+        0,
+        &benchmark_message3_sub_message_info
+    }
+};
+
+const struct pbtools_message_info_t benchmark_message3_info = {
+    sizeof(struct benchmark_message3_t),
+    (pbtools_message_init_t)benchmark_message3_init,
+    (pbtools_message_encode_inner_t)benchmark_message3_encode_inner,
+    (pbtools_message_decode_inner_t)benchmark_message3_decode_inner,
+    1,
+    &benchmark_message3_fields[0],
+    NULL,
+    0,
+    NULL
+};
+
+void benchmark_message3_init(
+    struct benchmark_message3_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->field13.length = 0;
+}
+
+void benchmark_message3_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct benchmark_message3_t *self_p)
+{
+    pbtools_message_info_encode_inner(encoder_p, &self_p->base, &benchmark_message3_info);
+}
+
+void benchmark_message3_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message3_t *self_p)
+{
+    struct pbtools_repeated_info_t repeated_infos[1];
+
+    pbtools_message_info_decode_inner(decoder_p,
+                                      &self_p->base,
+                                      &benchmark_message3_info,
+                                      &repeated_infos[0]);
+}
+
+int benchmark_message3_field13_alloc(
+    struct benchmark_message3_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated(
+                (struct pbtools_repeated_message_t *)&self_p->field13,
+                length,
+                self_p->base.heap_p,
+                sizeof(struct benchmark_message3_sub_message_t),
+                (pbtools_message_init_t)benchmark_message3_sub_message_init));
+}
+
+void benchmark_message3_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct benchmark_message3_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        benchmark_message3_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void benchmark_message3_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct benchmark_message3_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct benchmark_message3_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        benchmark_message3_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        benchmark_message3_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t benchmark_message3_view_fields[] = {
+    { 13, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, true }
+};
+
+void benchmark_message3_view_init(
+    struct benchmark_message3_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &benchmark_message3_view_fields[0],
+                      1,
+                      &self_p->offsets[0]);
+}
+
+int benchmark_message3_view_error(
+    struct benchmark_message3_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+void benchmark_message3_view_field13_begin(
+    struct benchmark_message3_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 0);
+}
+
+bool benchmark_message3_view_field13_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct benchmark_message3_sub_message_view_t *value_p)
+{
+    struct pbtools_bytes_t value;
+
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, &value);
+    benchmark_message3_sub_message_view_init(value_p, value.buf_p, value.size);
+
+    return (true);
+}
+
+struct benchmark_message3_t *
+benchmark_message3_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct benchmark_message3_t),
+                (pbtools_message_init_t)benchmark_message3_init));
+}
+
+int benchmark_message3_encode(
+    struct benchmark_message3_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)benchmark_message3_encode_inner));
+}
+
+int benchmark_message3_decode(
+    struct benchmark_message3_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)benchmark_message3_decode_inner));
+}
+
+int benchmark_message3_validate(
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_validate(encoded_p,
+                                     size,
+                                     &benchmark_message3_info));
+}
+
+int benchmark_message3_decode_masked(
+    struct benchmark_message3_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_field_mask_t *mask_p)
+{
+    return (pbtools_message_decode_masked(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)benchmark_message3_decode_inner,
+                mask_p));
+}
+
+int benchmark_message3_decode_limited(
+    struct benchmark_message3_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_decode_limits_t *limits_p)
+{
+    return (pbtools_message_decode_limited(&self_p->base,
+                                           encoded_p,
+                                           size,
+                                           &benchmark_message3_info,
+                                           limits_p));
+}
+
+void benchmark_message3_decoder_init(
+    struct pbtools_stream_decoder_t *decoder_p,
+    struct benchmark_message3_t *self_p)
+{
+    pbtools_stream_decoder_init(decoder_p,
+                                &self_p->base,
+                                &benchmark_message3_info);
+}
+
+int benchmark_message3_decoder_feed(
+    struct pbtools_stream_decoder_t *decoder_p,
+    const uint8_t *chunk_p,
+    size_t size)
+{
+    return (pbtools_stream_decoder_feed(decoder_p, chunk_p, size));
+}
+
+int benchmark_message3_decoder_finish(
+    struct pbtools_stream_decoder_t *decoder_p)
+{
+    return (pbtools_stream_decoder_finish(decoder_p));
+}
+
+int benchmark_message_message1_alloc(
+    struct benchmark_message_t *self_p)
+{
+    self_p->oneof = benchmark_message_oneof_message1_e;
+
+    return (pbtools_sub_message_alloc(
+                (struct pbtools_message_base_t **)&self_p->message1_p,
+                self_p->base.heap_p,
+                sizeof(struct benchmark_message1_t),
+                (pbtools_message_init_t)benchmark_message1_init));
+}
+
+int benchmark_message_message2_alloc(
+    struct benchmark_message_t *self_p)
+{
+    self_p->oneof = benchmark_message_oneof_message2_e;
+
+    return (pbtools_sub_message_alloc(
+                (struct pbtools_message_base_t **)&self_p->message2_p,
+                self_p->base.heap_p,
+                sizeof(struct benchmark_message2_t),
+                (pbtools_message_init_t)benchmark_message2_init));
+}
+
+int benchmark_message_message3_alloc(
+    struct benchmark_message_t *self_p)
+{
+    self_p->oneof = benchmark_message_oneof_message3_e;
+
+    return (pbtools_sub_message_alloc(
+                (struct pbtools_message_base_t **)&self_p->message3_p,
+                self_p->base.heap_p,
+                sizeof(struct benchmark_message3_t),
+                (pbtools_message_init_t)benchmark_message3_init));
+}
+
+static void benchmark_message_message1_decode(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message_t *self_p)
+{
+    self_p->oneof = benchmark_message_oneof_message1_e;
+    pbtools_decoder_sub_message_decode_unchecked(
+        decoder_p,
+        (struct pbtools_message_base_t **)&self_p->message1_p,
+        sizeof(struct benchmark_message1_t),
+        (pbtools_message_init_t)benchmark_message1_init,
+        (pbtools_message_decode_inner_t)benchmark_message1_decode_inner);
+}
+
+static void benchmark_message_message2_decode(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message_t *self_p)
+{
+    self_p->oneof = benchmark_message_oneof_message2_e;
+    pbtools_decoder_sub_message_decode_unchecked(
+        decoder_p,
+        (struct pbtools_message_base_t **)&self_p->message2_p,
+        sizeof(struct benchmark_message2_t),
+        (pbtools_message_init_t)benchmark_message2_init,
+        (pbtools_message_decode_inner_t)benchmark_message2_decode_inner);
+}
+
+static void benchmark_message_message3_decode(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message_t *self_p)
+{
+    self_p->oneof = benchmark_message_oneof_message3_e;
+    pbtools_decoder_sub_message_decode_unchecked(
+        decoder_p,
+        (struct pbtools_message_base_t **)&self_p->message3_p,
+        sizeof(struct benchmark_message3_t),
+        (pbtools_message_init_t)benchmark_message3_init,
+        (pbtools_message_decode_inner_t)benchmark_message3_decode_inner);
+}
+
+void benchmark_message_init(
+    struct benchmark_message_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->oneof = 0;
+}
+
+void benchmark_message_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct benchmark_message_t *self_p)
+{
+    switch (self_p->oneof) {
+
+    case benchmark_message_oneof_message1_e:
+        pbtools_encoder_sub_message_encode_always(
+            encoder_p,
+            1,
+            &self_p->message1_p->base,
+            (pbtools_message_encode_inner_t)benchmark_message1_encode_inner);
+        break;
+
+    case benchmark_message_oneof_message2_e:
+        pbtools_encoder_sub_message_encode_always(
+            encoder_p,
+            2,
+            &self_p->message2_p->base,
+            (pbtools_message_encode_inner_t)benchmark_message2_encode_inner);
+        break;
+
+    case benchmark_message_oneof_message3_e:
+        pbtools_encoder_sub_message_encode_always(
+            encoder_p,
+            7,
+            &self_p->message3_p->base,
+            (pbtools_message_encode_inner_t)benchmark_message3_encode_inner);
+        break;
+
+    default:
+        break;
+    }
+}
+
+void benchmark_message_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct benchmark_message_t *self_p)
+{
+    uint32_t key;
+    int wire_type;
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            benchmark_message_message1_decode(
+                decoder_p,
+                self_p);
+            break;
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            benchmark_message_message2_decode(
+                decoder_p,
+                self_p);
+            break;
+
+        case PBTOOLS_KEY(7, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            benchmark_message_message3_decode(
+                decoder_p,
+                self_p);
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 7:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+}
+
+static const struct pbtools_field_info_t benchmark_message_validate_fields[] = {
+    {
+        1,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_MESSAGE,
+        0,
+        0,
+        0,
+        0,
+        &benchmark_message1_info
+    },
+    {
+        2,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_MESSAGE,
+        0,
+        0,
+        0,
+        0,
+        &benchmark_message2_info
+    },
+    {
+        7,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_MESSAGE,
+        0,
+        0,
+        0,
+        0,
+        &benchmark_message3_info
+    }
+};
+
+const struct pbtools_message_info_t benchmark_message_info = {
+    sizeof(struct benchmark_message_t),
+    (pbtools_message_init_t)benchmark_message_init,
+    (pbtools_message_encode_inner_t)benchmark_message_encode_inner,
+    (pbtools_message_decode_inner_t)benchmark_message_decode_inner,
+    0,
+    NULL,
+    NULL,
+    3,
+    &benchmark_message_validate_fields[0]
+};
+
+void benchmark_message_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct benchmark_message_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        benchmark_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void benchmark_message_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct benchmark_message_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct benchmark_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        benchmark_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        benchmark_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t benchmark_message_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 7, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false }
+};
+
+void benchmark_message_view_init(
+    struct benchmark_message_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &benchmark_message_view_fields[0],
+                      3,
+                      &self_p->offsets[0]);
+}
+
+int benchmark_message_view_error(
+    struct benchmark_message_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+enum benchmark_message_oneof_e benchmark_message_view_get_oneof(
+    struct benchmark_message_view_t *self_p)
+{
+    return ((enum benchmark_message_oneof_e)(
+                pbtools_view_last_field(&self_p->base,
+                                        0,
+                                        3) + 1));
+}
+
+bool benchmark_message_view_get_message1(
+    struct benchmark_message_view_t *self_p,
+    struct benchmark_message1_view_t *value_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+    bool found;
+
+    value.buf_p = NULL;
+    value.size = 0;
+    found = pbtools_view_seek(&self_p->base, 0, &decoder);
+
+    if (found) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    benchmark_message1_view_init(value_p, value.buf_p, value.size);
+
+    return (found);
+}
+
+bool benchmark_message_view_get_message2(
+    struct benchmark_message_view_t *self_p,
+    struct benchmark_message2_view_t *value_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+    bool found;
+
+    value.buf_p = NULL;
+    value.size = 0;
+    found = pbtools_view_seek(&self_p->base, 1, &decoder);
+
+    if (found) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    benchmark_message2_view_init(value_p, value.buf_p, value.size);
+
+    return (found);
+}
+
+bool benchmark_message_view_get_message3(
+    struct benchmark_message_view_t *self_p,
+    struct benchmark_message3_view_t *value_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+    bool found;
+
+    value.buf_p = NULL;
+    value.size = 0;
+    found = pbtools_view_seek(&self_p->base, 2, &decoder);
+
+    if (found) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    benchmark_message3_view_init(value_p, value.buf_p, value.size);
+
+    return (found);
+}
+
+struct benchmark_message_t *
+benchmark_message_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct benchmark_message_t),
+                (pbtools_message_init_t)benchmark_message_init));
+}
+
+int benchmark_message_encode(
+    struct benchmark_message_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)benchmark_message_encode_inner));
+}
+
+int benchmark_message_decode(
+    struct benchmark_message_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)benchmark_message_decode_inner));
+}
@@ -0,0 +1,211 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "benchmark.h"
+
+struct benchmark_t {
+    const char *name_p;
+    void (*run)(int iterations);
+};
+
+static uint8_t encoded[1 << 12];
+static uint8_t workspace[1 << 14];
+
+/* Field 2, field 6 and field 3 of field 15. */
+static const int sub_message_field_numbers[] = { 3 };
+
+static const struct pbtools_field_mask_t sub_message_mask = {
+    1, &sub_message_field_numbers[0], NULL
+};
+
+static const int message1_field_numbers[] = { 2, 6, 15 };
+
+static const struct pbtools_field_mask_t *const message1_sub_masks[] = {
+    NULL, NULL, &sub_message_mask
+};
+
+static const struct pbtools_field_mask_t message1_mask = {
+    3, &message1_field_numbers[0], &message1_sub_masks[0]
+};
+
+static double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((double)ts.tv_sec * 1e9 + (double)ts.tv_nsec);
+}
+
+static int encode_message1(void)
+{
+    struct benchmark_message1_t *message1_p;
+    struct benchmark_sub_message_t *sub_message_p;
+    int size;
+
+    message1_p = benchmark_message1_new(&workspace[0], sizeof(workspace));
+    message1_p->field80 = true;
+    message1_p->field81 = true;
+    message1_p->field2 = -336;
+    message1_p->field3 = 3;
+    message1_p->field280 = 280;
+    message1_p->field6 = 5000;
+    message1_p->field22 = 5;
+    benchmark_message1_field4_alloc(message1_p, 3);
+    message1_p->field4.items_pp[0] = "The first string";
+    message1_p->field4.items_pp[1] = "The second string";
+    message1_p->field4.items_pp[2] = "The third string";
+    message1_p->field59 = true;
+    message1_p->field16 = 16;
+    message1_p->field150 = 150;
+    message1_p->field23 = 23;
+    message1_p->field24 = true;
+    message1_p->field25 = 25;
+    benchmark_message1_field15_alloc(message1_p);
+    sub_message_p = message1_p->field15_p;
+    sub_message_p->field1 = 1;
+    sub_message_p->field2 = 2;
+    sub_message_p->field3 = 9999;
+    sub_message_p->field15_p = (
+        "Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! "
+        "Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! "
+        "Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! "
+        "Hello! Hello! Hello!");
+    sub_message_p->field12.buf_p = (uint8_t *)sub_message_p->field15_p;
+    sub_message_p->field12.size = 230;
+    sub_message_p->field13 = 13;
+    sub_message_p->field14 = 14;
+    sub_message_p->field21 = 449932;
+    sub_message_p->field22 = 22;
+    sub_message_p->field206 = true;
+    sub_message_p->field203 = 203;
+    sub_message_p->field204 = 1;
+    sub_message_p->field205_p = "e";
+    sub_message_p->field207 = 207;
+    sub_message_p->field300 = benchmark_e3_e;
+    message1_p->field78 = true;
+    message1_p->field67 = 67;
+    message1_p->field68 = 68;
+    message1_p->field128 = 128;
+    message1_p->field129_p = "f";
+    message1_p->field131 = 131;
+    size = benchmark_message1_encode(message1_p,
+                                     &encoded[0],
+                                     sizeof(encoded));
+    assert(size > 0);
+
+    return (size);
+}
+
+static void message1_decode(int iterations)
+{
+    int i;
+    struct benchmark_message1_t *message1_p;
+    int size;
+    int encoded_size;
+
+    encoded_size = encode_message1();
+
+    for (i = 0; i < iterations; i++) {
+        message1_p = benchmark_message1_new(&workspace[0], sizeof(workspace));
+        size = benchmark_message1_decode(message1_p,
+                                         &encoded[0],
+                                         (size_t)encoded_size);
+        assert(size == encoded_size);
+    }
+}
+
+static void message1_masked_decode(int iterations)
+{
+    int i;
+    struct benchmark_message1_t *message1_p;
+    int size;
+    int encoded_size;
+
+    encoded_size = encode_message1();
+
+    for (i = 0; i < iterations; i++) {
+        message1_p = benchmark_message1_new(&workspace[0], sizeof(workspace));
+        size = benchmark_message1_decode_masked(message1_p,
+                                                &encoded[0],
+                                                (size_t)encoded_size,
+                                                &message1_mask);
+        assert(size == encoded_size);
+        assert(message1_p->field15_p->field3 == 9999);
+    }
+}
+
+static void message1_limited_decode(int iterations)
+{
+    int i;
+    struct benchmark_message1_t *message1_p;
+    int size;
+    int encoded_size;
+    struct pbtools_decode_limits_t limits;
+
+    encoded_size = encode_message1();
+    limits.max_depth = 16;
+    limits.max_repeated_length = 1024;
+    limits.max_heap_size = sizeof(workspace);
+
+    for (i = 0; i < iterations; i++) {
+        message1_p = benchmark_message1_new(&workspace[0], sizeof(workspace));
+        size = benchmark_message1_decode_limited(message1_p,
+                                                 &encoded[0],
+                                                 (size_t)encoded_size,
+                                                 &limits);
+        assert(size == encoded_size);
+    }
+}
+
+static void message1_validate(int iterations)
+{
+    int i;
+    int size;
+    int encoded_size;
+
+    encoded_size = encode_message1();
+
+    for (i = 0; i < iterations; i++) {
+        size = benchmark_message1_validate(&encoded[0], (size_t)encoded_size);
+        assert(size == encoded_size);
+    }
+}
+
+static const struct benchmark_t benchmarks[] = {
+    { "message1_decode", message1_decode },
+    { "message1_masked_decode", message1_masked_decode },
+    { "message1_limited_decode", message1_limited_decode },
+    { "message1_validate", message1_validate }
+};
+
+int main(int argc, const char *argv[])
+{
+    int iterations;
+    size_t i;
+    double start;
+
+    if (argc < 2) {
+        return (1);
+    }
+
+    iterations = atoi(argv[1]);
+
+    for (i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++) {
+        if ((argc == 3) && (strcmp(argv[2], benchmarks[i].name_p) != 0)) {
+            continue;
+        }
+
+        start = now();
+        benchmarks[i].run(iterations);
+        printf("%-32s %10.1f ns/iteration\n",
+               benchmarks[i].name_p,
+               (now() - start) / iterations);
+    }
+
+    return (0);
+}
@@ -31,6 +31,7 @@
 extern "C" {
 #endif
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
@@ -49,6 +50,55 @@ extern "C" {
 #    define PBTOOLS_CONFIG_64BIT                                1
 #endif
 
+/* Copy packed fixed size values (fixed32, float, etc.) as a whole
+   if 1, as they are stored as on the wire. Only correct on little
+   endian targets. */
+#ifndef PBTOOLS_CONFIG_LITTLE_ENDIAN
+#    if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#        define PBTOOLS_CONFIG_LITTLE_ENDIAN                    1
+#    else
+#        define PBTOOLS_CONFIG_LITTLE_ENDIAN                    0
+#    endif
+#endif
+
+/* Only check length delimited slices against the buffer if 1, and
+   read varints and fixed size values within them without bounds
+   checks. Only for input known to be well formed, for example
+   produced by a trusted process, as malformed input may be read past
+   the end of the buffer. */
+#ifndef PBTOOLS_CONFIG_TRUSTED_INPUT
+#    define PBTOOLS_CONFIG_TRUSTED_INPUT                        0
+#endif
+
+/* Use SIMD instructions, selected at runtime, if 1. Only available
+   on x86_64 with GCC and Clang. */
+#ifndef PBTOOLS_CONFIG_SIMD
+#    if defined(__x86_64__) && defined(__GNUC__)
+#        define PBTOOLS_CONFIG_SIMD                             1
+#    else
+#        define PBTOOLS_CONFIG_SIMD                             0
+#    endif
+#endif
+
+/* Check that decoded strings are valid UTF-8 if 1, as required for
+   proto3 string fields. Decoding fails with PBTOOLS_BAD_UTF8
+   otherwise. */
+#ifndef PBTOOLS_CONFIG_VALIDATE_UTF8
+#    define PBTOOLS_CONFIG_VALIDATE_UTF8                        0
+#endif
+
+/* Maximum number of nested sub-messages and packed fields of the
+   streaming decoder, including the top level message. */
+#ifndef PBTOOLS_CONFIG_STREAM_DEPTH
+#    define PBTOOLS_CONFIG_STREAM_DEPTH                         16
+#endif
+
+/* Maximum number of nested sub-messages when validating, including
+   the top level message. */
+#ifndef PBTOOLS_CONFIG_VALIDATE_DEPTH
+#    define PBTOOLS_CONFIG_VALIDATE_DEPTH                       32
+#endif
+
 /* Errors. */
 #define PBTOOLS_BAD_WIRE_TYPE                                   1
 #define PBTOOLS_OUT_OF_DATA                                     2
@@ -58,6 +108,20 @@ extern "C" {
 #define PBTOOLS_VARINT_OVERFLOW                                 6
 #define PBTOOLS_SEEK_OVERFLOW                                   7
 #define PBTOOLS_LENGTH_DELIMITED_OVERFLOW                       8
+#define PBTOOLS_NESTING_TOO_DEEP                                9
+#define PBTOOLS_REPEATED_FIELD_TOO_LONG                        10
+#define PBTOOLS_MEMORY_LIMIT_EXCEEDED                          11
+#define PBTOOLS_BAD_UTF8                                       12
+#define PBTOOLS_STORAGE_OVERFLOW                               13
+
+/* Number of readable bytes required after encoded messages given to
+   pbtools_message_decode_padded(). */
+#define PBTOOLS_PADDING                                         16
+
+/* SIMD instruction sets. */
+#define PBTOOLS_SIMD_NONE                                       0
+#define PBTOOLS_SIMD_SSE4_1                                     1
+#define PBTOOLS_SIMD_AVX2                                       2
 
 /* Wire types. */
 #define PBTOOLS_WIRE_TYPE_VARINT                                0
@@ -65,10 +129,63 @@ extern "C" {
 #define PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED                      2
 #define PBTOOLS_WIRE_TYPE_32_BIT                                5
 
+/* A tag as read by pbtools_decoder_read_key(). */
+#define PBTOOLS_KEY(field_number, wire_type)                    \
+    (((uint32_t)(field_number) << 3) | (uint32_t)(wire_type))
+
+/* Value at given index of a column is present. All values are present
+   if there is no presence bitmap. */
+#define PBTOOLS_COLUMN_IS_PRESENT(present_p, index)                     \
+    (((present_p) == NULL)                                              \
+     || (((present_p)[(index) / 8] & (1u << ((index) % 8))) != 0))
+
+struct pbtools_repeated_info_t;
+
+/* Fields to decode of a table driven message. Other fields are
+   skipped without being allocated. */
+struct pbtools_field_mask_t {
+    int number_of_fields;
+    const int *field_numbers_p;
+    /* Masks of sub-message fields, in field numbers order. Sub-messages
+       are decoded completely if NULL, or if their mask is NULL. */
+    const struct pbtools_field_mask_t *const *sub_masks_pp;
+};
+
 struct pbtools_heap_t {
     char *buf_p;
     int size;
     int pos;
+    /* Repeated fields with runs in temporary memory. */
+    struct pbtools_repeated_info_t *repeated_infos_p;
+    /* Field mask of the message being decoded, or NULL. */
+    const struct pbtools_field_mask_t *mask_p;
+    /* Number of sub-messages being decoded, and limits. */
+    int depth;
+    int max_depth;
+    int max_repeated_length;
+    /* Temporary memory above this offset is not freed with runs. */
+    int pinned_size;
+    /* Repeated fields of the top level message given to callbacks
+       item by item, or NULL. */
+    const struct pbtools_decode_callbacks_t *callbacks_p;
+    /* Caller provided storage of repeated scalar fields, or NULL. */
+    struct pbtools_repeated_storage_t *storages_p;
+    /* Segments of the top level message being decoded, or NULL. */
+    struct pbtools_segments_t *segments_p;
+    /* Repeated fields of the top level message decoded into columns,
+       or NULL. */
+    const struct pbtools_decode_columns_t *columns_p;
+};
+
+/* Limits of pbtools_message_decode_limited(). */
+struct pbtools_decode_limits_t {
+    /* Maximum number of nested sub-messages, including the top level
+       message. */
+    int max_depth;
+    /* Maximum number of items of a repeated field. */
+    int max_repeated_length;
+    /* Maximum number of workspace bytes used by the decoder. */
+    size_t max_heap_size;
 };
 
 struct pbtools_encoder_t {
@@ -82,6 +199,36 @@ struct pbtools_decoder_t {
     int size;
     int pos;
     struct pbtools_heap_t *heap_p;
+    /* At least PBTOOLS_PADDING readable bytes follow the buffer. */
+    bool padded;
+};
+
+/* Consecutive occurrences of a repeated field, as offsets into the
+   buffer of the message decoder they were found in. */
+struct pbtools_repeated_run_t {
+    const uint8_t *buf_p;
+    int begin;
+    int end;
+    int wire_type;
+    struct pbtools_repeated_run_t *next_p;
+};
+
+/* Part of an encoded message. */
+struct pbtools_segment_t {
+    const uint8_t *buf_p;
+    size_t size;
+};
+
+/* The top level message decoder continues with the next chunk of
+   complete fields when it reaches the end of the current one. */
+struct pbtools_segments_t {
+    const struct pbtools_segment_t *segments_p;
+    int length;
+    /* Position of the next chunk. */
+    int index;
+    size_t offset;
+    size_t left;
+    struct pbtools_decoder_t *decoder_p;
 };
 
 struct pbtools_repeated_info_t {
@@ -89,6 +236,36 @@ struct pbtools_repeated_info_t {
     int length;
     int tag;
     int wire_type;
+    int size;
+    struct pbtools_repeated_run_t run;
+    struct pbtools_repeated_run_t *last_run_p;
+    int heap_size;
+    struct pbtools_repeated_info_t *next_p;
+};
+
+/* Decodes items of a repeated sub-message field one at a time, so
+   that generated code can call the item decoder directly. */
+struct pbtools_repeated_iterator_t {
+    struct pbtools_decoder_t *decoder_p;
+    struct pbtools_repeated_info_t *repeated_info_p;
+    struct pbtools_repeated_run_t *run_p;
+    bool scanning;
+    bool final;
+    bool decoding;
+    /* Number of stored items, which is also the index of the item
+       being decoded. Always zero if items are given to a callback. */
+    int length;
+    /* Number of decoded items. */
+    int decoded;
+    int heap_size;
+    struct pbtools_repeated_info_t *repeated_infos_p;
+    /* Callback given each item decoded into a scratch item, or
+       NULL. */
+    const struct pbtools_repeated_callback_t *callback_p;
+    /* Columns each item is decoded into, or NULL. */
+    const struct pbtools_repeated_columns_t *columns_p;
+    struct pbtools_repeated_message_t *repeated_p;
+    int heap_pos;
 };
 
 struct pbtools_bytes_t {
@@ -100,6 +277,16 @@ struct pbtools_message_base_t {
     struct pbtools_heap_t *heap_p;
 };
 
+/* A sub-message decoded on first access. */
+struct pbtools_lazy_message_t {
+    struct pbtools_message_base_t *message_p;
+    /* Points into the encoded buffer if not yet decoded. */
+    const uint8_t *encoded_p;
+    /* Size of the encoded sub-message, or a negative error code if
+       decoding failed. */
+    int size;
+};
+
 struct pbtools_repeated_int32_t {
     int length;
     int32_t *items_p;
@@ -157,6 +344,100 @@ struct pbtools_repeated_message_t {
 typedef void (*pbtools_message_init_t)(void *self_p,
                                        struct pbtools_heap_t *heap_p);
 
+/* Called with each decoded item of a repeated sub-message field. The
+   item and all memory it refers to are freed when the callback
+   returns. */
+typedef void (*pbtools_item_callback_t)(void *arg_p, const void *item_p);
+
+struct pbtools_repeated_callback_t {
+    int field_number;
+    size_t item_size;
+    pbtools_message_init_t init;
+    /* Items are stored in the message as usual if NULL. */
+    pbtools_item_callback_t callback;
+};
+
+struct pbtools_decode_callbacks_t {
+    const struct pbtools_repeated_callback_t *callbacks_p;
+    int length;
+    void *arg_p;
+};
+
+/* Allocates columns of given number of items, or aborts given
+   decoder. */
+typedef void (*pbtools_columns_alloc_t)(struct pbtools_decoder_t *decoder_p,
+                                        void *columns_p,
+                                        int length);
+
+/* Decodes an item into the columns at given index. */
+typedef void (*pbtools_columns_decode_inner_t)(
+    struct pbtools_decoder_t *decoder_p,
+    void *columns_p,
+    int index);
+
+/* Encodes all rows of the columns as items of given field. */
+typedef void (*pbtools_columns_encode_t)(struct pbtools_encoder_t *encoder_p,
+                                         int field_number,
+                                         const void *columns_p);
+
+/* Generated columns structs begin with the number of items, followed
+   by a values array and a presence bitmap per scalar field. */
+struct pbtools_repeated_columns_t {
+    int field_number;
+    /* Items are stored in the message as usual if NULL. */
+    void *columns_p;
+    pbtools_columns_alloc_t alloc;
+    pbtools_columns_decode_inner_t decode_inner;
+    pbtools_columns_encode_t encode;
+};
+
+struct pbtools_decode_columns_t {
+    const struct pbtools_repeated_columns_t *columns_p;
+    int length;
+};
+
+struct pbtools_view_field_t {
+    int field_number;
+    /* Item wire type of repeated fields. */
+    int wire_type;
+    bool repeated;
+};
+
+/* An encoded message read on demand. The message is scanned once on
+   first access, finding the last occurrence of each field, or the
+   first of repeated fields, and checking their wire types. */
+struct pbtools_view_t {
+    const uint8_t *buf_p;
+    int size;
+    /* Zero if not yet scanned, one if scanned and a negative error
+       code if malformed. */
+    int state;
+    const struct pbtools_view_field_t *fields_p;
+    int number_of_fields;
+    /* Offset of the value of each field, or of the tag of the first
+       item of repeated fields. -1 if not present. */
+    int *offsets_p;
+};
+
+/* Items of a repeated field of a view. */
+struct pbtools_view_iterator_t {
+    struct pbtools_view_t *view_p;
+    struct pbtools_decoder_t decoder;
+    int field_number;
+    int wire_type;
+    /* Size of the message if iterating a packed run. */
+    int size;
+};
+
+/* Items of a repeated scalar field are decoded into given buffer
+   instead of the workspace. */
+struct pbtools_repeated_storage_t {
+    struct pbtools_repeated_message_t *repeated_p;
+    void *items_p;
+    int capacity;
+    struct pbtools_repeated_storage_t *next_p;
+};
+
 typedef void (*pbtools_message_encode_inner_t)(
     struct pbtools_encoder_t *encoder_p,
     void *self_p);
@@ -165,6 +446,112 @@ typedef void (*pbtools_message_decode_inner_t)(
     struct pbtools_decoder_t *decoder_p,
     void *self_p);
 
+/* Field kinds in message tables. */
+#define PBTOOLS_FIELD_KIND_INT32                                0
+#define PBTOOLS_FIELD_KIND_INT64                                1
+#define PBTOOLS_FIELD_KIND_SINT32                               2
+#define PBTOOLS_FIELD_KIND_SINT64                               3
+#define PBTOOLS_FIELD_KIND_UINT32                               4
+#define PBTOOLS_FIELD_KIND_UINT64                               5
+#define PBTOOLS_FIELD_KIND_FIXED32                              6
+#define PBTOOLS_FIELD_KIND_FIXED64                              7
+#define PBTOOLS_FIELD_KIND_SFIXED32                             8
+#define PBTOOLS_FIELD_KIND_SFIXED64                             9
+#define PBTOOLS_FIELD_KIND_FLOAT                               10
+#define PBTOOLS_FIELD_KIND_DOUBLE                              11
+#define PBTOOLS_FIELD_KIND_BOOL                                12
+#define PBTOOLS_FIELD_KIND_ENUM                                13
+#define PBTOOLS_FIELD_KIND_STRING                              14
+#define PBTOOLS_FIELD_KIND_BYTES                               15
+#define PBTOOLS_FIELD_KIND_BYTES_VIEW                          16
+#define PBTOOLS_FIELD_KIND_MESSAGE                             17
+
+/* Field flags in message tables. */
+#define PBTOOLS_FIELD_FLAG_OPTIONAL                          0x01
+#define PBTOOLS_FIELD_FLAG_REPEATED                          0x02
+
+struct pbtools_message_info_t;
+
+/* A field in a message table. */
+struct pbtools_field_info_t {
+    int field_number;
+    /* Wire type the field is encoded with. */
+    uint8_t wire_type;
+    uint8_t kind;
+    uint8_t flags;
+    /* Index in the repeated infos array given when decoding. */
+    uint8_t repeated_index;
+    /* Offset of the value in the message struct. */
+    uint32_t offset;
+    /* Offset of is_present of optional fields. */
+    uint32_t presence_offset;
+    /* Sub-message kind only. */
+    const struct pbtools_message_info_t *message_info_p;
+};
+
+/* A message table. Sub-messages are encoded and decoded with the
+   functions, whether they use a table or not. */
+struct pbtools_message_info_t {
+    size_t size;
+    pbtools_message_init_t init;
+    pbtools_message_encode_inner_t encode_inner;
+    pbtools_message_decode_inner_t decode_inner;
+    int number_of_fields;
+    const struct pbtools_field_info_t *fields_p;
+    /* Field indexes in field number order, or NULL if the fields
+       already are. */
+    const uint16_t *sorted_indexes_p;
+    /* Fields of messages without a table, oneof members included,
+       checked by validation as the generated decoder does. Offsets
+       are not used. */
+    int number_of_validate_fields;
+    const struct pbtools_field_info_t *validate_fields_p;
+};
+
+struct pbtools_stream_item_t;
+
+/* Items of a repeated field received so far, in temporary memory. */
+struct pbtools_stream_repeated_t {
+    int length;
+    struct pbtools_stream_item_t *head_p;
+    struct pbtools_stream_item_t *tail_p;
+};
+
+/* A message or a packed repeated field being decoded. */
+struct pbtools_stream_frame_t {
+    struct pbtools_message_base_t *message_p;
+    const struct pbtools_message_info_t *info_p;
+    struct pbtools_stream_repeated_t *repeateds_p;
+    /* Packed repeated field of the message in the frame below, or
+       NULL. */
+    const struct pbtools_field_info_t *packed_field_p;
+    /* Number of bytes left, or -1 for the top level message. */
+    int left;
+    /* Heap size to restore when done. */
+    int heap_size;
+};
+
+/* Decodes a message fed in chunks, keeping its state between
+   calls. */
+struct pbtools_stream_decoder_t {
+    struct pbtools_heap_t *heap_p;
+    /* Number of bytes fed, or negative error code. */
+    int pos;
+    int state;
+    /* Field being decoded, or NULL if skipped. */
+    const struct pbtools_field_info_t *field_p;
+    int wire_type;
+    uint64_t value;
+    int shift;
+    /* Destination and number of bytes left of length delimited
+       values. */
+    uint8_t *buf_p;
+    int left;
+    struct pbtools_message_base_t *message_p;
+    int depth;
+    struct pbtools_stream_frame_t frames[PBTOOLS_CONFIG_STREAM_DEPTH];
+};
+
 void pbtools_encoder_write_int32(struct pbtools_encoder_t *self_p,
                                  int field_number,
                                  int32_t value);
@@ -385,6 +772,19 @@ bool pbtools_decoder_available(struct pbtools_decoder_t *self_p);
 int pbtools_decoder_read_tag(struct pbtools_decoder_t *self_p,
                              int *wire_type_p);
 
+/* Read given tag if it is next in the encoded data, encoded in one
+   or two bytes. Returns true if found, otherwise nothing is read and
+   false is returned. */
+bool pbtools_decoder_read_expected_tag(struct pbtools_decoder_t *self_p,
+                                       int field_number,
+                                       int wire_type);
+
+/* Read a tag and return it as is, that is the field number and wire
+   type combined as by PBTOOLS_KEY(). */
+uint32_t pbtools_decoder_read_key(struct pbtools_decoder_t *self_p);
+
+void pbtools_decoder_abort(struct pbtools_decoder_t *self_p, int error);
+
 int32_t pbtools_decoder_read_int32(struct pbtools_decoder_t *self_p,
                                    int wire_type);
 
@@ -439,6 +839,66 @@ void pbtools_decoder_read_bytes(struct pbtools_decoder_t *self_p,
                                 int wire_type,
                                 struct pbtools_bytes_t *bytes_p);
 
+/* Point into the encoded buffer instead of copying to the
+   workspace. The encoded buffer must outlive the message and its
+   contents must not be modified through the view. */
+void pbtools_decoder_read_bytes_view(struct pbtools_decoder_t *self_p,
+                                     int wire_type,
+                                     struct pbtools_bytes_t *bytes_p);
+
+/* Readers of values whose wire type is already known to be the
+   expected one, typically from dispatching on the key. */
+int32_t pbtools_decoder_read_int32_unchecked(struct pbtools_decoder_t *self_p);
+
+int64_t pbtools_decoder_read_int64_unchecked(struct pbtools_decoder_t *self_p);
+
+int32_t pbtools_decoder_read_sint32_unchecked(
+    struct pbtools_decoder_t *self_p);
+
+int64_t pbtools_decoder_read_sint64_unchecked(
+    struct pbtools_decoder_t *self_p);
+
+uint32_t pbtools_decoder_read_uint32_unchecked(
+    struct pbtools_decoder_t *self_p);
+
+uint64_t pbtools_decoder_read_uint64_unchecked(
+    struct pbtools_decoder_t *self_p);
+
+uint32_t pbtools_decoder_read_fixed32_unchecked(
+    struct pbtools_decoder_t *self_p);
+
+uint64_t pbtools_decoder_read_fixed64_unchecked(
+    struct pbtools_decoder_t *self_p);
+
+int32_t pbtools_decoder_read_sfixed32_unchecked(
+    struct pbtools_decoder_t *self_p);
+
+int64_t pbtools_decoder_read_sfixed64_unchecked(
+    struct pbtools_decoder_t *self_p);
+
+#if PBTOOLS_CONFIG_FLOAT == 1
+
+float pbtools_decoder_read_float_unchecked(struct pbtools_decoder_t *self_p);
+
+double pbtools_decoder_read_double_unchecked(
+    struct pbtools_decoder_t *self_p);
+
+#endif
+
+bool pbtools_decoder_read_bool_unchecked(struct pbtools_decoder_t *self_p);
+
+int pbtools_decoder_read_enum_unchecked(struct pbtools_decoder_t *self_p);
+
+void pbtools_decoder_read_string_unchecked(struct pbtools_decoder_t *self_p,
+                                           char **value_pp);
+
+void pbtools_decoder_read_bytes_unchecked(struct pbtools_decoder_t *self_p,
+                                          struct pbtools_bytes_t *bytes_p);
+
+void pbtools_decoder_read_bytes_view_unchecked(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_bytes_t *bytes_p);
+
 int pbtools_alloc_repeated_int32(struct pbtools_message_base_t *self_p,
                                  int length,
                                  struct pbtools_repeated_int32_t *repeated_p);
@@ -638,6 +1098,11 @@ void pbtools_decoder_decode_repeated_bytes(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct pbtools_repeated_bytes_t *repeated_p);
 
+void pbtools_decoder_decode_repeated_bytes_view(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct pbtools_repeated_bytes_t *repeated_p);
+
 void pbtools_decoder_skip_field(struct pbtools_decoder_t *self_p,
                                 int wire_type);
 
@@ -658,6 +1123,111 @@ int pbtools_message_decode(struct pbtools_message_base_t *self_p,
                            size_t size,
                            pbtools_message_decode_inner_t message_decode_inner);
 
+/* At least PBTOOLS_PADDING readable bytes must follow given encoded
+   message. They are read, but not decoded. */
+int pbtools_message_decode_padded(
+    struct pbtools_message_base_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    pbtools_message_decode_inner_t message_decode_inner);
+
+/* Decode a message split into given segments, for example a chain of
+   network buffers or a wrapped ring buffer. Fields within a segment
+   are decoded in place, and only fields crossing a segment boundary
+   are copied to the workspace. Returns number of decoded bytes or
+   negative error code. */
+int pbtools_message_decode_segments(
+    struct pbtools_message_base_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length,
+    pbtools_message_decode_inner_t message_decode_inner);
+
+/* Only fields in given mask are decoded. */
+int pbtools_message_decode_masked(
+    struct pbtools_message_base_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    pbtools_message_decode_inner_t message_decode_inner,
+    const struct pbtools_field_mask_t *mask_p);
+
+/* Items of given repeated sub-message fields of the top level message
+   are decoded one at a time into a scratch item and given to their
+   callback instead of being stored in the message, so the workspace
+   does not grow with the number of items. */
+int pbtools_message_decode_callbacks(
+    struct pbtools_message_base_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    pbtools_message_decode_inner_t message_decode_inner,
+    const struct pbtools_repeated_callback_t *callbacks_p,
+    int number_of_callbacks,
+    void *arg_p);
+
+/* Scalar fields of items of given repeated sub-message fields of the
+   top level message are decoded into columns, one array per field,
+   instead of being stored in the message. Other fields of the items
+   are skipped. */
+int pbtools_message_decode_columns(
+    struct pbtools_message_base_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    pbtools_message_decode_inner_t message_decode_inner,
+    const struct pbtools_repeated_columns_t *columns_p,
+    int number_of_columns);
+
+/* Rows of given columns are encoded as items of their repeated
+   sub-message field of the top level message, after any items in the
+   message. */
+int pbtools_message_encode_columns(
+    struct pbtools_message_base_t *self_p,
+    uint8_t *encoded_p,
+    size_t size,
+    pbtools_message_encode_inner_t message_encode_inner,
+    const struct pbtools_repeated_columns_t *columns_p,
+    int number_of_columns);
+
+/* Allocate a zeroed column of given number of values, or abort
+   decoding. */
+void *pbtools_decoder_alloc_column(struct pbtools_decoder_t *self_p,
+                                   int length,
+                                   size_t value_size);
+
+/* Returns true if given bit of a presence bitmap is set, as
+   PBTOOLS_COLUMN_IS_PRESENT(). */
+bool pbtools_column_is_present(const uint8_t *present_p, int index);
+
+void pbtools_view_init(struct pbtools_view_t *self_p,
+                       const uint8_t *buf_p,
+                       size_t size,
+                       const struct pbtools_view_field_t *fields_p,
+                       int number_of_fields,
+                       int *offsets_p);
+
+/* Returns zero if the message is well formed, otherwise a negative
+   error code. Getters return default values if it is not. */
+int pbtools_view_get_error(struct pbtools_view_t *self_p);
+
+/* Initialize given decoder at the value of field at given
+   index. Returns false if the field is not present. */
+bool pbtools_view_seek(struct pbtools_view_t *self_p,
+                       int index,
+                       struct pbtools_decoder_t *decoder_p);
+
+/* Returns the index, relative to given index, of the field in given
+   range found last in the message, or -1 if none is present. */
+int pbtools_view_last_field(struct pbtools_view_t *self_p,
+                            int index,
+                            int number_of_fields);
+
+void pbtools_view_iterator_init(struct pbtools_view_iterator_t *self_p,
+                                struct pbtools_view_t *view_p,
+                                int index);
+
+/* Seek the decoder of given iterator to the value of the next item,
+   in a packed run or not. Returns false when there are no more items
+   or on malformed input, which is then the error of the view. */
+bool pbtools_view_iterator_next(struct pbtools_view_iterator_t *self_p);
+
 int pbtools_sub_message_alloc(
     struct pbtools_message_base_t **message_pp,
     struct pbtools_heap_t *heap_p,
@@ -671,6 +1241,17 @@ int pbtools_alloc_repeated(
     size_t item_size,
     pbtools_message_init_t message_init);
 
+/* Decode items of given repeated scalar field directly into given
+   buffer of capacity items. The number of decoded items is stored in
+   the length member of the field as usual. Decoding fails with
+   PBTOOLS_STORAGE_OVERFLOW if there are more than capacity items. Must
+   be called after the message is created and before it is decoded. */
+int pbtools_repeated_set_storage(
+    struct pbtools_message_base_t *self_p,
+    struct pbtools_repeated_message_t *repeated_p,
+    void *items_p,
+    int capacity);
+
 void pbtools_encode_repeated_inner(
     struct pbtools_encoder_t *encoder_p,
     int field_number,
@@ -686,6 +1267,29 @@ void pbtools_decode_repeated_inner(
     pbtools_message_init_t message_init,
     pbtools_message_decode_inner_t message_decode_inner);
 
+/* Write the key and length of a sub-message encoded after given
+   position. */
+void pbtools_encoder_write_sub_message_length(
+    struct pbtools_encoder_t *self_p,
+    int field_number,
+    int pos);
+
+/* Allocate the items of given repeated field, but do not initialize
+   them. */
+void pbtools_repeated_iterator_init(
+    struct pbtools_repeated_iterator_t *self_p,
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct pbtools_repeated_message_t *repeated_p,
+    size_t item_size);
+
+/* Initialize given decoder to decode the next item, at index
+   self_p->length, once the previous item has been decoded with the
+   same decoder. Returns false when there are no more items. */
+bool pbtools_repeated_iterator_next(
+    struct pbtools_repeated_iterator_t *self_p,
+    struct pbtools_decoder_t *decoder_p);
+
 void pbtools_encoder_sub_message_encode(
     struct pbtools_encoder_t *self_p,
     int field_number,
@@ -706,8 +1310,107 @@ void pbtools_decoder_sub_message_decode(
     pbtools_message_init_t message_init,
     pbtools_message_decode_inner_t decode_inner);
 
+void pbtools_decoder_sub_message_decode_unchecked(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_message_base_t **message_pp,
+    size_t sub_message_size,
+    pbtools_message_init_t message_init,
+    pbtools_message_decode_inner_t decode_inner);
+
+void pbtools_lazy_message_init(struct pbtools_lazy_message_t *self_p);
+
+int pbtools_lazy_message_alloc(struct pbtools_lazy_message_t *self_p,
+                               struct pbtools_heap_t *heap_p,
+                               size_t sub_message_size,
+                               pbtools_message_init_t message_init);
+
+/* Decode the sub-message if not already done. The encoded buffer
+   must outlive the message. Returns NULL if not present or if
+   decoding fails. A sub-message that fails to decode is dropped and
+   not decoded again. */
+void *pbtools_lazy_message_get(struct pbtools_lazy_message_t *self_p,
+                               struct pbtools_heap_t *heap_p,
+                               size_t sub_message_size,
+                               pbtools_message_init_t message_init,
+                               pbtools_message_decode_inner_t decode_inner);
+
+/* The encoded sub-message is copied as is if not decoded. */
+void pbtools_encoder_lazy_message_encode(
+    struct pbtools_encoder_t *self_p,
+    int field_number,
+    struct pbtools_lazy_message_t *lazy_p,
+    pbtools_message_encode_inner_t encode_inner);
+
+void pbtools_decoder_read_lazy_message(struct pbtools_decoder_t *self_p,
+                                       int wire_type,
+                                       struct pbtools_lazy_message_t *lazy_p);
+
+void pbtools_decoder_read_lazy_message_unchecked(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_lazy_message_t *lazy_p);
+
+/* Encode given message using its table. */
+void pbtools_message_info_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct pbtools_message_base_t *message_p,
+    const struct pbtools_message_info_t *info_p);
+
+/* Decode given message using its table. Repeated infos must have
+   room for all repeated fields in the message, and may be NULL if
+   there are none. */
+void pbtools_message_info_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_message_base_t *message_p,
+    const struct pbtools_message_info_t *info_p,
+    struct pbtools_repeated_info_t *repeated_infos_p);
+
+/* Start decoding given message using its table. The message must
+   not be used until finished. */
+void pbtools_stream_decoder_init(struct pbtools_stream_decoder_t *self_p,
+                                 struct pbtools_message_base_t *message_p,
+                                 const struct pbtools_message_info_t *info_p);
+
+/* Decode given chunk. Values are copied to the workspace, so the
+   chunk may be reused when this function returns. Returns zero or
+   negative error code. */
+int pbtools_stream_decoder_feed(struct pbtools_stream_decoder_t *self_p,
+                                const uint8_t *chunk_p,
+                                size_t size);
+
+/* Finish decoding after the last chunk. Returns number of bytes
+   decoded or negative error code. */
+int pbtools_stream_decoder_finish(struct pbtools_stream_decoder_t *self_p);
+
+/* Check that given encoded message is well formed without decoding
+   it. Returns number of bytes validated or negative error code. */
+int pbtools_message_validate(const uint8_t *encoded_p,
+                             size_t size,
+                             const struct pbtools_message_info_t *info_p);
+
+/* Decode given message using its table and an explicit stack instead
+   of recursion. Decoding is aborted as soon as a limit is
+   exceeded. Sub-messages without a table are decoded by their code,
+   still within the limits. Returns number of bytes decoded or
+   negative error code. */
+int pbtools_message_decode_limited(
+    struct pbtools_message_base_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_message_info_t *info_p,
+    const struct pbtools_decode_limits_t *limits_p);
+
 const char *pbtools_error_code_to_string(int code);
 
+/* Select SIMD instruction set used when decoding packed varints,
+   skipping varints and validating UTF-8, limited to what the CPU
+   supports. Returns the selected instruction set. The best supported
+   is selected when the library is loaded. Must not be called while
+   other threads are decoding. */
+int pbtools_simd_select(int simd);
+
+/* Returns true if given buffer is valid UTF-8. */
+bool pbtools_utf8_is_valid(const uint8_t *buf_p, size_t size);
+
 void pbtools_repeated_info_init(struct pbtools_repeated_info_t *self_p,
                                 int tag);
 
@@ -28,18 +28,9 @@
 #include <stdalign.h>
 #include "pbtools.h"
 
-typedef void (*repeated_item_read_t)(struct pbtools_decoder_t *self_p,
-                                     void *items_p,
-                                     int index);
-
-typedef void (*repeated_item_write_t)(struct pbtools_encoder_t *self_p,
-                                      int index,
-                                      void *items_p);
-
-typedef int (*decoder_read_repeated_t)(struct pbtools_decoder_t *self_p,
-                                       int wire_type,
-                                       void *items_p,
-                                       int index);
+#if PBTOOLS_CONFIG_SIMD == 1
+#    include <immintrin.h>
+#endif
 
 static void *decoder_heap_alloc(struct pbtools_decoder_t *self_p,
                                 size_t size,
@@ -55,6 +46,8 @@ static void decoder_init_slice(struct pbtools_decoder_t *self_p,
 static void decoder_seek(struct pbtools_decoder_t *self_p,
                          int offset);
 
+static bool heap_free_runs(struct pbtools_heap_t *self_p);
+
 static struct pbtools_heap_t *heap_new(void *buf_p,
                                        size_t size)
 {
@@ -65,6 +58,16 @@ static struct pbtools_heap_t *heap_new(void *buf_p,
         heap_p->buf_p = buf_p;
         heap_p->size = (int)size;
         heap_p->pos = sizeof(*heap_p);
+        heap_p->repeated_infos_p = NULL;
+        heap_p->mask_p = NULL;
+        heap_p->depth = 0;
+        heap_p->max_depth = INT_MAX;
+        heap_p->max_repeated_length = INT_MAX;
+        heap_p->pinned_size = INT_MAX;
+        heap_p->callbacks_p = NULL;
+        heap_p->storages_p = NULL;
+        heap_p->segments_p = NULL;
+        heap_p->columns_p = NULL;
     } else {
         heap_p = NULL;
     }
@@ -107,6 +110,33 @@ static void *heap_alloc(struct pbtools_heap_t *self_p,
     return ((void *)addr);
 }
 
+/* Allocate temporary memory from the end of the heap. It is freed by
+   restoring the heap size. */
+static void *heap_alloc_top(struct pbtools_heap_t *self_p,
+                            size_t size,
+                            size_t alignment)
+{
+    uintptr_t addr;
+    int left;
+
+    left = (self_p->size - self_p->pos);
+
+    if ((int)size > left) {
+        return (NULL);
+    }
+
+    addr = (uintptr_t)&self_p->buf_p[self_p->size - (int)size];
+    addr &= ~((uintptr_t)alignment - 1);
+
+    if (addr < (uintptr_t)&self_p->buf_p[self_p->pos]) {
+        return (NULL);
+    }
+
+    self_p->size = (int)(addr - (uintptr_t)self_p->buf_p);
+
+    return ((void *)addr);
+}
+
 static void encoder_init(struct pbtools_encoder_t *self_p,
                          uint8_t *buf_p,
                          size_t  size)
@@ -594,115 +624,72 @@ void pbtools_encoder_write_bytes_always(struct pbtools_encoder_t *self_p,
                                        value_p->size);
 }
 
-static void encoder_write_repeated(struct pbtools_encoder_t *self_p,
-                                   int field_number,
-                                   struct pbtools_repeated_message_t *repeated_p,
-                                   repeated_item_write_t item_write)
+/* Write the key and length of a packed field, or nothing if no
+   items were written after given position. */
+static void encoder_write_packed_length(struct pbtools_encoder_t *self_p,
+                                        int field_number,
+                                        int pos)
 {
-    int i;
-    int pos;
-
-    if (repeated_p->length == 0) {
+    if (self_p->pos == pos) {
         return;
     }
 
-    pos = self_p->pos;
-
-    for (i = repeated_p->length - 1; i >= 0; i--) {
-        item_write(self_p, i, repeated_p->items_p);
-    }
-
     encoder_write_tagged_varint(self_p,
                                 field_number,
                                 PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
                                 (uint64_t)(pos - self_p->pos));
 }
 
-static void write_repeated_int32(struct pbtools_encoder_t *self_p,
-                                 int index,
-                                 int32_t *items_p)
-{
-    encoder_write_varint(self_p, (uint64_t)(int64_t)items_p[index]);
-}
-
-static void write_repeated_int64(struct pbtools_encoder_t *self_p,
-                                  int index,
-                                  int64_t *items_p)
-{
-    encoder_write_varint(self_p, (uint64_t)items_p[index]);
-}
-
-static void write_repeated_sint32(struct pbtools_encoder_t *self_p,
-                                  int index,
-                                  int32_t *items_p)
-{
-    encoder_write_varint(self_p, sint32_encode(items_p[index]));
-}
-
-static void write_repeated_sint64(struct pbtools_encoder_t *self_p,
-                                  int index,
-                                  int64_t *items_p)
-{
-    encoder_write_varint(self_p, sint64_encode(items_p[index]));
-}
-
-static void write_repeated_uint32(struct pbtools_encoder_t *self_p,
-                                  int index,
-                                  uint32_t *items_p)
+/* Items of fixed size are written as a whole if possible. */
+static void encoder_write_repeated_fixed(
+    struct pbtools_encoder_t *self_p,
+    int field_number,
+    struct pbtools_repeated_message_t *repeated_p,
+    size_t item_size)
 {
-    encoder_write_varint(self_p, (uint64_t)items_p[index]);
-}
+#if PBTOOLS_CONFIG_LITTLE_ENDIAN == 1
+    size_t size;
 
-static void write_repeated_uint64(struct pbtools_encoder_t *self_p,
-                                  int index,
-                                  uint64_t *items_p)
-{
-    encoder_write_varint(self_p, items_p[index]);
-}
+    if (repeated_p->length == 0) {
+        return;
+    }
 
-static void write_repeated_32bit(struct pbtools_encoder_t *self_p,
-                                 int index,
-                                 uint32_t *items_p)
-{
-    encoder_write_32_bit_value(self_p, items_p[index]);
-}
+    size = (item_size * (size_t)repeated_p->length);
 
-static void write_repeated_64bit(struct pbtools_encoder_t *self_p,
-                                 int index,
-                                 uint64_t *items_p)
-{
-    encoder_write_64_bit_value(self_p, items_p[index]);
-}
+    if (size > INT_MAX) {
+        encoder_abort(self_p, PBTOOLS_ENCODE_BUFFER_FULL);
 
-static void write_repeated_float(struct pbtools_encoder_t *self_p,
-                                 int index,
-                                 float *items_p)
-{
-    uint32_t data;
+        return;
+    }
 
-    memcpy(&data, &items_p[index], sizeof(data));
-    encoder_write_32_bit_value(self_p, data);
-}
+    encoder_write(self_p, (uint8_t *)repeated_p->items_p, (int)size);
+    encoder_write_tagged_varint(self_p,
+                                field_number,
+                                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+                                (uint64_t)size);
+#else
+    int i;
+    int pos;
+    const uint8_t *item_p;
+    uint32_t value_32;
+    uint64_t value_64;
 
-static void write_repeated_double(struct pbtools_encoder_t *self_p,
-                                  int index,
-                                  double *items_p)
-{
-    uint64_t data;
+    pos = self_p->pos;
 
-    memcpy(&data, &items_p[index], sizeof(data));
-    encoder_write_64_bit_value(self_p, data);
-}
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        item_p = ((const uint8_t *)repeated_p->items_p + (size_t)i * item_size);
 
-static void write_repeated_bool(struct pbtools_encoder_t *self_p,
-                                int index,
-                                bool *items_p)
-{
-    if (items_p[index]) {
-        encoder_write_varint(self_p, 1);
-    } else {
-        encoder_write_varint(self_p, 0);
+        if (item_size == 4) {
+            memcpy(&value_32, item_p, sizeof(value_32));
+            encoder_write_32_bit_value(self_p, value_32);
+        } else {
+            memcpy(&value_64, item_p, sizeof(value_64));
+            encoder_write_64_bit_value(self_p, value_64);
+        }
     }
+
+    encoder_write_packed_length(self_p, field_number, pos);
+#endif
 }
 
 void pbtools_encoder_write_repeated_int32(
@@ -710,11 +697,16 @@ void pbtools_encoder_write_repeated_int32(
     int field_number,
     struct pbtools_repeated_int32_t *repeated_p)
 {
-    encoder_write_repeated(
-        self_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        (repeated_item_write_t)write_repeated_int32);
+    int i;
+    int pos;
+
+    pos = self_p->pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        encoder_write_varint(self_p, (uint64_t)(int64_t)repeated_p->items_p[i]);
+    }
+
+    encoder_write_packed_length(self_p, field_number, pos);
 }
 
 void pbtools_encoder_write_repeated_int64(
@@ -722,11 +714,16 @@ void pbtools_encoder_write_repeated_int64(
     int field_number,
     struct pbtools_repeated_int64_t *repeated_p)
 {
-    encoder_write_repeated(
-        self_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        (repeated_item_write_t)write_repeated_int64);
+    int i;
+    int pos;
+
+    pos = self_p->pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        encoder_write_varint(self_p, (uint64_t)repeated_p->items_p[i]);
+    }
+
+    encoder_write_packed_length(self_p, field_number, pos);
 }
 
 void pbtools_encoder_write_repeated_sint32(
@@ -734,11 +731,16 @@ void pbtools_encoder_write_repeated_sint32(
     int field_number,
     struct pbtools_repeated_int32_t *repeated_p)
 {
-    encoder_write_repeated(
-        self_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        (repeated_item_write_t)write_repeated_sint32);
+    int i;
+    int pos;
+
+    pos = self_p->pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        encoder_write_varint(self_p, sint32_encode(repeated_p->items_p[i]));
+    }
+
+    encoder_write_packed_length(self_p, field_number, pos);
 }
 
 void pbtools_encoder_write_repeated_sint64(
@@ -746,11 +748,16 @@ void pbtools_encoder_write_repeated_sint64(
     int field_number,
     struct pbtools_repeated_int64_t *repeated_p)
 {
-    encoder_write_repeated(
-        self_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        (repeated_item_write_t)write_repeated_sint64);
+    int i;
+    int pos;
+
+    pos = self_p->pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        encoder_write_varint(self_p, sint64_encode(repeated_p->items_p[i]));
+    }
+
+    encoder_write_packed_length(self_p, field_number, pos);
 }
 
 void pbtools_encoder_write_repeated_uint32(
@@ -758,11 +765,16 @@ void pbtools_encoder_write_repeated_uint32(
     int field_number,
     struct pbtools_repeated_uint32_t *repeated_p)
 {
-    encoder_write_repeated(
-        self_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        (repeated_item_write_t)write_repeated_uint32);
+    int i;
+    int pos;
+
+    pos = self_p->pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        encoder_write_varint(self_p, (uint64_t)repeated_p->items_p[i]);
+    }
+
+    encoder_write_packed_length(self_p, field_number, pos);
 }
 
 void pbtools_encoder_write_repeated_uint64(
@@ -770,11 +782,16 @@ void pbtools_encoder_write_repeated_uint64(
     int field_number,
     struct pbtools_repeated_uint64_t *repeated_p)
 {
-    encoder_write_repeated(
-        self_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        (repeated_item_write_t)write_repeated_uint64);
+    int i;
+    int pos;
+
+    pos = self_p->pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        encoder_write_varint(self_p, repeated_p->items_p[i]);
+    }
+
+    encoder_write_packed_length(self_p, field_number, pos);
 }
 
 void pbtools_encoder_write_repeated_fixed32(
@@ -782,10 +799,11 @@ void pbtools_encoder_write_repeated_fixed32(
     int field_number,
     struct pbtools_repeated_uint32_t *repeated_p)
 {
-    encoder_write_repeated(self_p,
-                           field_number,
-                           (struct pbtools_repeated_message_t *)repeated_p,
-                           (repeated_item_write_t)write_repeated_32bit);
+    encoder_write_repeated_fixed(
+        self_p,
+        field_number,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(uint32_t));
 }
 
 void pbtools_encoder_write_repeated_fixed64(
@@ -793,10 +811,11 @@ void pbtools_encoder_write_repeated_fixed64(
     int field_number,
     struct pbtools_repeated_uint64_t *repeated_p)
 {
-    encoder_write_repeated(self_p,
-                           field_number,
-                           (struct pbtools_repeated_message_t *)repeated_p,
-                           (repeated_item_write_t)write_repeated_64bit);
+    encoder_write_repeated_fixed(
+        self_p,
+        field_number,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(uint64_t));
 }
 
 void pbtools_encoder_write_repeated_sfixed32(
@@ -804,10 +823,11 @@ void pbtools_encoder_write_repeated_sfixed32(
     int field_number,
     struct pbtools_repeated_int32_t *repeated_p)
 {
-    encoder_write_repeated(self_p,
-                           field_number,
-                           (struct pbtools_repeated_message_t *)repeated_p,
-                           (repeated_item_write_t)write_repeated_32bit);
+    encoder_write_repeated_fixed(
+        self_p,
+        field_number,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(int32_t));
 }
 
 void pbtools_encoder_write_repeated_sfixed64(
@@ -815,10 +835,11 @@ void pbtools_encoder_write_repeated_sfixed64(
     int field_number,
     struct pbtools_repeated_int64_t *repeated_p)
 {
-    encoder_write_repeated(self_p,
-                           field_number,
-                           (struct pbtools_repeated_message_t *)repeated_p,
-                           (repeated_item_write_t)write_repeated_64bit);
+    encoder_write_repeated_fixed(
+        self_p,
+        field_number,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(int64_t));
 }
 
 #if PBTOOLS_CONFIG_FLOAT == 1
@@ -828,10 +849,11 @@ void pbtools_encoder_write_repeated_float(
     int field_number,
     struct pbtools_repeated_float_t *repeated_p)
 {
-    encoder_write_repeated(self_p,
-                           field_number,
-                           (struct pbtools_repeated_message_t *)repeated_p,
-                           (repeated_item_write_t)write_repeated_float);
+    encoder_write_repeated_fixed(
+        self_p,
+        field_number,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(float));
 }
 
 void pbtools_encoder_write_repeated_double(
@@ -839,10 +861,11 @@ void pbtools_encoder_write_repeated_double(
     int field_number,
     struct pbtools_repeated_double_t *repeated_p)
 {
-    encoder_write_repeated(self_p,
-                           field_number,
-                           (struct pbtools_repeated_message_t *)repeated_p,
-                           (repeated_item_write_t)write_repeated_double);
+    encoder_write_repeated_fixed(
+        self_p,
+        field_number,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(double));
 }
 
 #endif
@@ -852,10 +875,16 @@ void pbtools_encoder_write_repeated_bool(
     int field_number,
     struct pbtools_repeated_bool_t *repeated_p)
 {
-    encoder_write_repeated(self_p,
-                           field_number,
-                           (struct pbtools_repeated_message_t *)repeated_p,
-                           (repeated_item_write_t)write_repeated_bool);
+    int i;
+    int pos;
+
+    pos = self_p->pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        encoder_write_varint(self_p, repeated_p->items_p[i] ? 1 : 0);
+    }
+
+    encoder_write_packed_length(self_p, field_number, pos);
 }
 
 void pbtools_encoder_write_repeated_string(
@@ -901,6 +930,7 @@ static void decoder_init(struct pbtools_decoder_t *self_p,
     self_p->size = (int)size;
     self_p->pos = 0;
     self_p->heap_p = heap_p;
+    self_p->padded = false;
 }
 
 static int decoder_get_result(struct pbtools_decoder_t *self_p)
@@ -925,6 +955,10 @@ static void *decoder_heap_alloc(struct pbtools_decoder_t *self_p,
 
     buf_p = heap_alloc(self_p->heap_p, size, alignment);
 
+    if ((buf_p == NULL) && heap_free_runs(self_p->heap_p)) {
+        buf_p = heap_alloc(self_p->heap_p, size, alignment);
+    }
+
     if (buf_p == NULL) {
         decoder_abort(self_p, PBTOOLS_OUT_OF_MEMORY);
     }
@@ -932,1646 +966,6341 @@ static void *decoder_heap_alloc(struct pbtools_decoder_t *self_p,
     return (buf_p);
 }
 
-static int decoder_left(struct pbtools_decoder_t *self_p)
+/* Size of the varint at the beginning of given buffer, or zero if it
+   does not end within it. */
+static size_t scan_varint(const uint8_t *buf_p,
+                          size_t size,
+                          uint64_t *value_p)
 {
-    return (self_p->size - self_p->pos);
-}
+    size_t i;
+    uint64_t value;
 
-static void repeated_info_init_decode(struct pbtools_repeated_info_t *self_p,
-                                      struct pbtools_decoder_t *decoder_p,
-                                      int wire_type)
-{
-    if (self_p->length == 0) {
-        decoder_init_slice(&self_p->decoder, decoder_p, decoder_left(decoder_p));
-        self_p->wire_type = wire_type;
+    if ((size > 0) && (buf_p[0] < 0x80)) {
+        *value_p = buf_p[0];
+
+        return (1);
     }
-}
 
-bool pbtools_decoder_available(struct pbtools_decoder_t *self_p)
-{
-    return (self_p->pos < self_p->size);
-}
+    if (size > 10) {
+        size = 10;
+    }
 
-static uint8_t decoder_get(struct pbtools_decoder_t *self_p)
-{
-    uint8_t value;
+    value = 0;
 
-    if (pbtools_decoder_available(self_p)) {
-        value = self_p->buf_p[self_p->pos];
-        self_p->pos++;
-    } else {
-        decoder_abort(self_p, PBTOOLS_OUT_OF_DATA);
-        value = 0;
-    }
+    for (i = 0; i < size; i++) {
+        value |= ((uint64_t)(buf_p[i] & 0x7f) << (7 * i));
 
-    return (value);
-}
+        if ((buf_p[i] & 0x80) == 0) {
+            *value_p = value;
 
-static void decoder_read(struct pbtools_decoder_t *self_p,
-                         uint8_t *buf_p,
-                         size_t size)
-{
-    if ((self_p->size - self_p->pos) >= (int)size) {
-        memcpy(buf_p, &self_p->buf_p[self_p->pos], size);
-        self_p->pos += (int)size;
-    } else {
-        memset(buf_p, 0, size);
-        decoder_abort(self_p, PBTOOLS_OUT_OF_DATA);
+            return (i + 1);
+        }
     }
+
+    return (0);
 }
 
-static uint64_t decoder_read_varint(struct pbtools_decoder_t *self_p)
+/* Size of the field at the beginning of given buffer, which may be
+   bigger than the buffer. Returns false if its tag or length does not
+   end within the buffer, or if it is malformed. */
+static bool scan_field_size(const uint8_t *buf_p,
+                            size_t size,
+                            uint64_t *field_size_p)
 {
+    size_t pos;
+    size_t varint_size;
     uint64_t value;
-    uint8_t byte;
-    int offset;
-
-    value = 0;
-    offset = 0;
 
-    do {
-        byte = decoder_get(self_p);
-        value |= (((uint64_t)byte & 0x7f) << offset);
-        offset += 7;
-    } while ((offset < 64) && (byte & 0x80));
+    pos = scan_varint(buf_p, size, &value);
 
-    if (byte & 0x80) {
-        decoder_abort(self_p, PBTOOLS_VARINT_OVERFLOW);
-        value = 0;
+    if (pos == 0) {
+        return (false);
     }
 
-    return (value);
-}
+    switch (value & 7) {
 
-static uint64_t read_varint_check_wire_type(
-    struct pbtools_decoder_t *self_p,
-    int wire_type,
-    int expected_wire_type)
-{
-    if (wire_type != expected_wire_type) {
-        decoder_abort(self_p, PBTOOLS_BAD_WIRE_TYPE);
+    case PBTOOLS_WIRE_TYPE_VARINT:
+        varint_size = scan_varint(&buf_p[pos], size - pos, &value);
+        *field_size_p = (pos + varint_size);
 
-        return (0);
-    }
+        return (varint_size > 0);
 
-    return (decoder_read_varint(self_p));
-}
+    case PBTOOLS_WIRE_TYPE_64_BIT:
+        *field_size_p = (pos + 8);
 
-static uint64_t read_varint_check_wire_type_varint(
-    struct pbtools_decoder_t *self_p,
-    int wire_type)
-{
-    return (read_varint_check_wire_type(
-                self_p,
-                wire_type,
-                PBTOOLS_WIRE_TYPE_VARINT));
-}
+        return (true);
 
-static uint64_t decoder_read_length_delimited(struct pbtools_decoder_t *self_p,
-                                              int wire_type)
-{
-    uint64_t length;
+    case PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED:
+        varint_size = scan_varint(&buf_p[pos], size - pos, &value);
+        *field_size_p = (pos + varint_size + value);
 
-    length = read_varint_check_wire_type(
-        self_p,
-        wire_type,
-        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+        return ((varint_size > 0) && (value < INT_MAX));
 
-    if (length >= INT_MAX) {
-        decoder_abort(self_p, PBTOOLS_LENGTH_DELIMITED_OVERFLOW);
-        length = 0;
-    }
+    case PBTOOLS_WIRE_TYPE_32_BIT:
+        *field_size_p = (pos + 4);
 
-    return (length);
+        return (true);
+
+    default:
+        return (false);
+    }
 }
 
-int pbtools_decoder_read_tag(struct pbtools_decoder_t *self_p,
-                             int *wire_type_p)
+/* Copy given number of bytes from the position of the next chunk, and
+   optionally move the position past them. */
+static void segments_read(struct pbtools_segments_t *self_p,
+                          uint8_t *buf_p,
+                          size_t size,
+                          bool advance)
 {
-    uint32_t value;
-    int field_number;
+    const struct pbtools_segment_t *segment_p;
+    int index;
+    size_t offset;
+    size_t chunk_size;
 
-    value = (uint32_t)decoder_read_varint(self_p);
-    field_number = (int)(value >> 3);
-    *wire_type_p = (value & 0x7);
+    index = self_p->index;
+    offset = self_p->offset;
 
-    if (field_number == 0) {
-        decoder_abort(self_p, PBTOOLS_BAD_FIELD_NUMBER);
+    if (advance) {
+        self_p->left -= size;
     }
 
-    return (field_number);
-}
+    while (size > 0) {
+        segment_p = &self_p->segments_p[index];
+        chunk_size = (segment_p->size - offset);
 
-int32_t pbtools_decoder_read_int32(struct pbtools_decoder_t *self_p,
-                                   int wire_type)
-{
-    return ((int32_t)pbtools_decoder_read_int64(self_p, wire_type));
-}
+        if (chunk_size > size) {
+            chunk_size = size;
+        }
 
-int64_t pbtools_decoder_read_int64(struct pbtools_decoder_t *self_p,
-                                   int wire_type)
-{
-    return ((int64_t)read_varint_check_wire_type_varint(
-                self_p,
-                wire_type));
-}
+        if (chunk_size > 0) {
+            memcpy(buf_p, &segment_p->buf_p[offset], chunk_size);
+            buf_p += chunk_size;
+            size -= chunk_size;
+            offset += chunk_size;
+        }
 
-int32_t pbtools_decoder_read_sint32(struct pbtools_decoder_t *self_p,
-                                    int wire_type)
-{
-    return ((int32_t)pbtools_decoder_read_sint64(self_p, wire_type));
-}
+        if (offset == segment_p->size) {
+            index++;
+            offset = 0;
+        }
+    }
 
-int64_t pbtools_decoder_read_sint64(struct pbtools_decoder_t *self_p,
-                                    int wire_type)
-{
-    return (sint64_decode(read_varint_check_wire_type_varint(self_p,
-                                                             wire_type)));
+    if (advance) {
+        self_p->index = index;
+        self_p->offset = offset;
+    }
 }
 
-uint32_t pbtools_decoder_read_uint32(struct pbtools_decoder_t *self_p,
-                                     int wire_type)
+/* Copy a field crossing a segment boundary to the workspace. If it
+   cannot be found the rest of the message is copied instead, and the
+   decoder reports the error. */
+static void segments_copy_field(struct pbtools_segments_t *self_p,
+                                struct pbtools_decoder_t *decoder_p)
 {
-    return ((uint32_t)pbtools_decoder_read_uint64(self_p, wire_type));
-}
+    uint8_t header[20];
+    uint8_t *buf_p;
+    size_t size;
+    uint64_t field_size;
 
-uint64_t pbtools_decoder_read_uint64(struct pbtools_decoder_t *self_p,
-                                     int wire_type)
-{
-    return (read_varint_check_wire_type_varint(self_p, wire_type));
-}
+    size = self_p->left;
 
-static uint32_t decoder_read_32_bit_value(struct pbtools_decoder_t *self_p)
-{
-    uint32_t value;
-    uint8_t buf[4];
+    if (size > sizeof(header)) {
+        size = sizeof(header);
+    }
 
-    decoder_read(self_p, &buf[0], sizeof(buf));
-    value = ((uint32_t)buf[0] << 0);
-    value |= ((uint32_t)buf[1] << 8);
-    value |= ((uint32_t)buf[2] << 16);
-    value |= ((uint32_t)buf[3] << 24);
+    segments_read(self_p, &header[0], size, false);
 
-    return (value);
-}
+    if (scan_field_size(&header[0], size, &field_size)
+        && (field_size <= self_p->left)) {
+        size = (size_t)field_size;
+    } else {
+        size = self_p->left;
+    }
 
-uint32_t pbtools_decoder_read_fixed32(struct pbtools_decoder_t *self_p,
-                                      int wire_type)
-{
-    if (wire_type != PBTOOLS_WIRE_TYPE_32_BIT) {
-        decoder_abort(self_p, PBTOOLS_BAD_WIRE_TYPE);
+    buf_p = decoder_heap_alloc(decoder_p, size, 1);
 
-        return (0);
+    if (buf_p == NULL) {
+        return;
     }
 
-    return (decoder_read_32_bit_value(self_p));
+    segments_read(self_p, buf_p, size, true);
+    decoder_init(decoder_p, buf_p, size, decoder_p->heap_p);
 }
 
-static uint64_t decoder_read_64_bit_value(struct pbtools_decoder_t *self_p)
+/* Move given decoder to the next chunk, which is either all complete
+   fields at the beginning of the rest of the current segment, or a
+   copy of a field crossing a segment boundary. Returns false if there
+   are no more fields. */
+static bool segments_next_chunk(struct pbtools_segments_t *self_p,
+                                struct pbtools_decoder_t *decoder_p)
 {
-    uint64_t value;
-    uint8_t buf[8];
+    const struct pbtools_segment_t *segment_p;
+    const uint8_t *buf_p;
+    size_t size;
+    size_t offset;
+    uint64_t field_size;
 
-    decoder_read(self_p, &buf[0], sizeof(buf));
-    value = ((uint64_t)buf[0] << 0);
-    value |= ((uint64_t)buf[1] << 8);
-    value |= ((uint64_t)buf[2] << 16);
-    value |= ((uint64_t)buf[3] << 24);
-    value |= ((uint64_t)buf[4] << 32);
-    value |= ((uint64_t)buf[5] << 40);
-    value |= ((uint64_t)buf[6] << 48);
-    value |= ((uint64_t)buf[7] << 56);
+    if (self_p->left == 0) {
+        return (false);
+    }
 
-    return (value);
-}
+    segment_p = &self_p->segments_p[self_p->index];
 
-uint64_t pbtools_decoder_read_fixed64(struct pbtools_decoder_t *self_p,
-                                      int wire_type)
-{
-    if (wire_type != PBTOOLS_WIRE_TYPE_64_BIT) {
-        decoder_abort(self_p, PBTOOLS_BAD_WIRE_TYPE);
+    while (self_p->offset == segment_p->size) {
+        self_p->index++;
+        self_p->offset = 0;
+        segment_p++;
+    }
 
-        return (0);
+    buf_p = &segment_p->buf_p[self_p->offset];
+    size = (segment_p->size - self_p->offset);
+    offset = 0;
+
+    while (scan_field_size(&buf_p[offset], size - offset, &field_size)
+           && (field_size <= (size - offset))) {
+        offset += (size_t)field_size;
     }
 
-    return (decoder_read_64_bit_value(self_p));
-}
+    if (offset > 0) {
+        decoder_init(decoder_p, buf_p, offset, decoder_p->heap_p);
+        self_p->offset += offset;
+        self_p->left -= offset;
+    } else {
+        segments_copy_field(self_p, decoder_p);
+    }
 
-int32_t pbtools_decoder_read_sfixed32(struct pbtools_decoder_t *self_p,
-                                      int wire_type)
-{
-    return ((int32_t)pbtools_decoder_read_fixed32(self_p, wire_type));
+    return (decoder_p->pos < decoder_p->size);
 }
 
-int64_t pbtools_decoder_read_sfixed64(struct pbtools_decoder_t *self_p,
-                                      int wire_type)
+static bool decoder_is_top_level_of_segments(struct pbtools_decoder_t *self_p)
 {
-    return ((int64_t)pbtools_decoder_read_fixed64(self_p, wire_type));
+    return ((self_p->heap_p != NULL)
+            && (self_p->heap_p->segments_p != NULL)
+            && (self_p->heap_p->segments_p->decoder_p == self_p));
 }
 
-#if PBTOOLS_CONFIG_FLOAT == 1
-
-float pbtools_decoder_read_float(struct pbtools_decoder_t *self_p,
-                                 int wire_type)
+static bool decoder_next_chunk(struct pbtools_decoder_t *self_p)
 {
-    uint32_t data;
-    float value;
+    if ((self_p->pos < 0) || !decoder_is_top_level_of_segments(self_p)) {
+        return (false);
+    }
 
-    data = pbtools_decoder_read_fixed32(self_p, wire_type);
-    memcpy(&value, &data, sizeof(value));
+    return (segments_next_chunk(self_p->heap_p->segments_p, self_p));
+}
 
-    return (value);
+static int decoder_left(struct pbtools_decoder_t *self_p)
+{
+    return (self_p->size - self_p->pos);
 }
 
-double pbtools_decoder_read_double(struct pbtools_decoder_t *self_p,
-                                   int wire_type)
+/* Items are decoded once all fields in the message are known. The
+   first occurrence of a field creates a decoder for the rest of the
+   message, and all occurrences are recorded as runs in it, so items
+   can be decoded without scanning the message once per repeated
+   field. Runs are stored in temporary memory, and the rest of the
+   message is scanned instead if it is needed for anything else. */
+static void repeated_info_init_decode(struct pbtools_repeated_info_t *self_p,
+                                      struct pbtools_decoder_t *decoder_p,
+                                      int wire_type)
 {
-    uint64_t data;
-    double value;
+    struct pbtools_repeated_run_t *run_p;
+    struct pbtools_heap_t *heap_p;
+    int heap_size;
 
-    data = pbtools_decoder_read_fixed64(self_p, wire_type);
-    memcpy(&value, &data, sizeof(value));
+    if (self_p->length == 0) {
+        self_p->decoder = *decoder_p;
+        self_p->wire_type = wire_type;
+        self_p->size = decoder_p->size;
+        self_p->run.buf_p = decoder_p->buf_p;
+        self_p->run.begin = decoder_p->pos;
+        self_p->run.end = decoder_p->pos;
+        self_p->run.wire_type = wire_type;
+        self_p->run.next_p = NULL;
+
+        if (self_p->heap_size != -2) {
+            self_p->last_run_p = &self_p->run;
+        }
+    } else if ((self_p->last_run_p != NULL) && (decoder_p->pos >= 0)) {
+        /* Extend the last run if at most a tag separates them. */
+        if ((decoder_p->buf_p == self_p->last_run_p->buf_p)
+            && ((decoder_p->pos - self_p->last_run_p->end) <= 5)) {
+            return;
+        }
 
-    return (value);
-}
+        heap_p = decoder_p->heap_p;
+        heap_size = heap_p->size;
+        run_p = heap_alloc_top(heap_p,
+                               sizeof(*run_p),
+                               alignof(struct pbtools_repeated_run_t));
 
-#endif
+        if (run_p == NULL) {
+            self_p->last_run_p = NULL;
 
-bool pbtools_decoder_read_bool(struct pbtools_decoder_t *self_p,
-                               int wire_type)
-{
-    return (pbtools_decoder_read_int32(self_p, wire_type) != 0);
-}
+            /* The rest of the message is not contiguous. */
+            if (decoder_is_top_level_of_segments(decoder_p)) {
+                decoder_abort(decoder_p, PBTOOLS_OUT_OF_MEMORY);
+            }
 
-int pbtools_decoder_read_enum(struct pbtools_decoder_t *self_p,
-                              int wire_type)
-{
-    return (pbtools_decoder_read_int32(self_p, wire_type));
-}
+            return;
+        }
 
-void pbtools_decoder_read_string(struct pbtools_decoder_t *self_p,
-                                 int wire_type,
-                                 char **value_pp)
-{
-    uint64_t size;
+        if (self_p->heap_size == -1) {
+            self_p->heap_size = heap_size;
+            self_p->next_p = heap_p->repeated_infos_p;
+            heap_p->repeated_infos_p = self_p;
+        }
 
-    size = decoder_read_length_delimited(self_p, wire_type);
-    *value_pp = decoder_heap_alloc(self_p,
-                                   size + 1,
-                                   alignof(char));
+        run_p->buf_p = decoder_p->buf_p;
+        run_p->begin = decoder_p->pos;
+        run_p->wire_type = wire_type;
+        run_p->next_p = NULL;
+        self_p->last_run_p->next_p = run_p;
+        self_p->last_run_p = run_p;
+    }
+}
 
-    if (*value_pp == NULL) {
+static void repeated_info_end_decode(struct pbtools_repeated_info_t *self_p,
+                                     struct pbtools_decoder_t *decoder_p)
+{
+    if (self_p->last_run_p == NULL) {
         return;
     }
 
-    decoder_read(self_p, (uint8_t *)*value_pp, size);
-    (*value_pp)[size] = '\0';
+    if (decoder_p->pos >= 0) {
+        self_p->last_run_p->end = decoder_p->pos;
+    } else {
+        self_p->last_run_p = NULL;
+    }
 }
 
-void pbtools_decoder_read_bytes(struct pbtools_decoder_t *self_p,
-                                int wire_type,
-                                struct pbtools_bytes_t *bytes_p)
+/* Move the decoder to the beginning of given run and store the next
+   run in it. Returns false if there is no such run, and if runs are
+   not recorded the rest of the message is scanned instead. */
+static bool repeated_info_seek_run(struct pbtools_repeated_info_t *self_p,
+                                   struct pbtools_repeated_run_t **run_pp)
 {
-    uint64_t size;
+    struct pbtools_repeated_run_t *run_p;
 
-    size = decoder_read_length_delimited(self_p, wire_type);
-    bytes_p->size = size;
-    bytes_p->buf_p = decoder_heap_alloc(self_p,
-                                        bytes_p->size,
-                                        alignof(uint8_t));
+    run_p = *run_pp;
 
-    if (bytes_p->buf_p == NULL) {
-        return;
+    if ((run_p == NULL) || (self_p->decoder.pos < 0)) {
+        return (false);
     }
 
-    decoder_read(self_p, bytes_p->buf_p, bytes_p->size);
+    if (self_p->last_run_p == NULL) {
+        self_p->decoder.size = self_p->size;
+        *run_pp = NULL;
+
+        return (run_p == &self_p->run);
+    }
+
+    self_p->decoder.buf_p = run_p->buf_p;
+    self_p->decoder.pos = run_p->begin;
+    self_p->decoder.size = run_p->end;
+    self_p->wire_type = run_p->wire_type;
+    *run_pp = run_p->next_p;
+
+    return (true);
 }
 
-static void repeated_info_decode_varint(struct pbtools_repeated_info_t *self_p,
-                                        struct pbtools_decoder_t *decoder_p,
-                                        int wire_type)
+/* Free all temporary memory used by runs. Their fields scan the rest
+   of the message instead. Returns true if any memory was freed. */
+static bool heap_free_runs(struct pbtools_heap_t *self_p)
 {
+    struct pbtools_repeated_info_t *repeated_info_p;
     int size;
-    struct pbtools_decoder_t decoder;
 
-    repeated_info_init_decode(self_p, decoder_p, wire_type);
+    /* Runs of the top level message cannot be replaced by scanning
+       the rest of it. */
+    if (self_p->segments_p != NULL) {
+        return (false);
+    }
 
-    /* Accept both packed and not packed. */
-    switch (wire_type) {
+    size = self_p->size;
+    repeated_info_p = self_p->repeated_infos_p;
 
-    case PBTOOLS_WIRE_TYPE_VARINT:
-        (void)decoder_read_varint(decoder_p);
-        self_p->length++;
-        break;
+    while (repeated_info_p != NULL) {
+        if (repeated_info_p->heap_size > size) {
+            size = repeated_info_p->heap_size;
+        }
 
-    case PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED:
-        size = (int)decoder_read_length_delimited(decoder_p, wire_type);
-        decoder_init_slice(&decoder, decoder_p, size);
+        repeated_info_p->last_run_p = NULL;
+        repeated_info_p->heap_size = -2;
+        repeated_info_p = repeated_info_p->next_p;
+    }
 
-        while (pbtools_decoder_available(&decoder)) {
-            (void)decoder_read_varint(&decoder);
-            self_p->length++;
-        }
+    self_p->repeated_infos_p = NULL;
 
-        decoder_seek(decoder_p, decoder_get_result(&decoder));
-        break;
+    if (size > self_p->pinned_size) {
+        size = self_p->pinned_size;
+    }
 
-    default:
-        decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
-        break;
+    if (size <= self_p->size) {
+        return (false);
     }
-}
 
-static void repeated_info_decode_32bit(struct pbtools_repeated_info_t *self_p,
-                                       struct pbtools_decoder_t *decoder_p,
-                                       int wire_type)
-{
-    int size;
+    self_p->size = size;
 
-    repeated_info_init_decode(self_p, decoder_p, wire_type);
+    return (true);
+}
 
-    /* Accept both packed and not packed. */
-    switch (wire_type) {
+bool pbtools_decoder_available(struct pbtools_decoder_t *self_p)
+{
+    if (self_p->pos < self_p->size) {
+        return (true);
+    }
 
-    case PBTOOLS_WIRE_TYPE_32_BIT:
-        decoder_seek(decoder_p, 4);
-        self_p->length++;
-        break;
+    return (decoder_next_chunk(self_p));
+}
 
-    case PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED:
-        size = (int)decoder_read_length_delimited(decoder_p, wire_type);
-        self_p->length += (size / 4);
-        decoder_seek(decoder_p, size);
-        break;
-
-    default:
-        decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
-        break;
+static void decoder_read(struct pbtools_decoder_t *self_p,
+                         uint8_t *buf_p,
+                         size_t size)
+{
+    if ((self_p->size - self_p->pos) >= (int)size) {
+        memcpy(buf_p, &self_p->buf_p[self_p->pos], size);
+        self_p->pos += (int)size;
+    } else {
+        memset(buf_p, 0, size);
+        decoder_abort(self_p, PBTOOLS_OUT_OF_DATA);
     }
 }
 
-static void repeated_info_decode_64bit(struct pbtools_repeated_info_t *self_p,
-                                       struct pbtools_decoder_t *decoder_p,
-                                       int wire_type)
-{
-    int size;
-
-    repeated_info_init_decode(self_p, decoder_p, wire_type);
-
-    /* Accept both packed and not packed. */
-    switch (wire_type) {
-
-    case PBTOOLS_WIRE_TYPE_64_BIT:
-        decoder_seek(decoder_p, 8);
-        self_p->length++;
-        break;
+#if PBTOOLS_CONFIG_TRUSTED_INPUT == 0
 
-    case PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED:
-        size = (int)decoder_read_length_delimited(decoder_p, wire_type);
-        self_p->length += (size / 8);
-        decoder_seek(decoder_p, size);
-        break;
+static uint8_t decoder_get(struct pbtools_decoder_t *self_p)
+{
+    uint8_t value;
 
-    default:
-        decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
-        break;
+    if (self_p->pos < self_p->size) {
+        value = self_p->buf_p[self_p->pos];
+        self_p->pos++;
+    } else {
+        decoder_abort(self_p, PBTOOLS_OUT_OF_DATA);
+        value = 0;
     }
-}
-
-static void repeated_info_decode_length_delimited(
-    struct pbtools_repeated_info_t *self_p,
-    struct pbtools_decoder_t *decoder_p,
-    int wire_type)
-{
-    int size;
 
-    repeated_info_init_decode(self_p, decoder_p, wire_type);
-    size = (int)decoder_read_length_delimited(decoder_p, wire_type);
-    decoder_seek(decoder_p, size);
-    self_p->length++;
+    return (value);
 }
 
-static int decoder_read_repeated(struct pbtools_decoder_t *self_p,
-                                 int wire_type,
-                                 void *items_p,
-                                 repeated_item_read_t item_read,
-                                 int item_wire_type)
+static uint64_t decoder_read_varint_slow(struct pbtools_decoder_t *self_p)
 {
-    int size;
-    struct pbtools_decoder_t decoder;
-    int index;
-
-    index = 0;
+    uint64_t value;
+    uint8_t byte;
+    int offset;
 
-    /* Accept both packed and not packed. */
-    if (wire_type == item_wire_type) {
-        item_read(self_p, items_p, index);
-        index++;
-    } else if (wire_type == PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED) {
-        size = (int)decoder_read_length_delimited(self_p, wire_type);
-        decoder_init_slice(&decoder, self_p, size);
+    value = 0;
+    offset = 0;
 
-        while (pbtools_decoder_available(&decoder)) {
-            item_read(&decoder, items_p, index);
-            index++;
-        }
+    do {
+        byte = decoder_get(self_p);
+        value |= (((uint64_t)byte & 0x7f) << offset);
+        offset += 7;
+    } while ((offset < 64) && (byte & 0x80));
 
-        decoder_seek(self_p, decoder_get_result(&decoder));
-    } else {
-        decoder_abort(self_p, PBTOOLS_BAD_WIRE_TYPE);
+    if (byte & 0x80) {
+        decoder_abort(self_p, PBTOOLS_VARINT_OVERFLOW);
+        value = 0;
     }
 
-    return (index);
-}
-
-static int decoder_read_repeated_varint(struct pbtools_decoder_t *self_p,
-                                        int wire_type,
-                                        void *items_p,
-                                        repeated_item_read_t item_read)
-{
-    return (decoder_read_repeated(self_p,
-                                  wire_type,
-                                  items_p,
-                                  item_read,
-                                  PBTOOLS_WIRE_TYPE_VARINT));
-}
-
-static int decoder_read_repeated_32_bit(struct pbtools_decoder_t *self_p,
-                                        int wire_type,
-                                        void *items_p,
-                                        repeated_item_read_t item_read)
-{
-    return (decoder_read_repeated(self_p,
-                                  wire_type,
-                                  items_p,
-                                  item_read,
-                                  PBTOOLS_WIRE_TYPE_32_BIT));
+    return (value);
 }
 
-static int decoder_read_repeated_64_bit(struct pbtools_decoder_t *self_p,
-                                        int wire_type,
-                                        void *items_p,
-                                        repeated_item_read_t item_read)
-{
-    return (decoder_read_repeated(self_p,
-                                  wire_type,
-                                  items_p,
-                                  item_read,
-                                  PBTOOLS_WIRE_TYPE_64_BIT));
-}
+#endif
 
-static int calloc_repeated(struct pbtools_message_base_t *self_p,
-                           int length,
-                           struct pbtools_repeated_message_t *repeated_p,
-                           size_t item_size)
+/* Only one bounds check if the longest possible varint (10 bytes)
+   fits in the buffer or is followed by padding, otherwise decode it
+   byte by byte. Padded input is checked against the end of the buffer
+   once the end of the varint is found. No bounds check at all for
+   trusted input. */
+static uint64_t decoder_read_varint(struct pbtools_decoder_t *self_p)
 {
-    size_t size;
-
-    size = (item_size * (size_t)length);
-    repeated_p->items_p = heap_alloc(self_p->heap_p, size, alignof(uint64_t));
+    const uint8_t *buf_p;
+    uint64_t value;
+    int left;
+    int i;
 
-    if (repeated_p->items_p == NULL) {
-        return (-1);
+#if PBTOOLS_CONFIG_TRUSTED_INPUT == 1
+    /* Well formed varints end within the buffer. */
+    if (self_p->pos < 0) {
+        return (0);
     }
 
-    memset(repeated_p->items_p, 0, size);
-    repeated_p->length = length;
-
-    return (0);
-}
+    left = 10;
+#else
+    left = decoder_left(self_p);
 
-static int alloc_repeated_int32(struct pbtools_message_base_t *self_p,
-                                int length,
-                                struct pbtools_repeated_int32_t *repeated_p)
-{
-    return (calloc_repeated(self_p,
-                            length,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(*repeated_p->items_p)));
-}
+    if ((left < 10) && !(self_p->padded && (left > 0))) {
+        return (decoder_read_varint_slow(self_p));
+    }
+#endif
 
-static int alloc_repeated_uint32(struct pbtools_message_base_t *self_p,
-                                 int length,
-                                 struct pbtools_repeated_uint32_t *repeated_p)
-{
-    return (calloc_repeated(self_p,
-                            length,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(*repeated_p->items_p)));
-}
+    buf_p = &self_p->buf_p[self_p->pos];
 
-static int alloc_repeated_int64(struct pbtools_message_base_t *self_p,
-                                int length,
-                                struct pbtools_repeated_int64_t *repeated_p)
-{
-    return (calloc_repeated(self_p,
-                            length,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(*repeated_p->items_p)));
-}
+    if ((buf_p[0] & 0x80) == 0) {
+        self_p->pos++;
 
-static int alloc_repeated_uint64(struct pbtools_message_base_t *self_p,
-                                 int length,
-                                 struct pbtools_repeated_uint64_t *repeated_p)
-{
-    return (calloc_repeated(self_p,
-                            length,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(*repeated_p->items_p)));
-}
+        return (buf_p[0]);
+    }
 
-static bool are_more_items_to_decode(struct pbtools_repeated_info_t *repeated_info_p,
-                                     int pos)
-{
-    return (pbtools_decoder_available(&repeated_info_p->decoder)
-            && (pos < repeated_info_p->length));
-}
+    value = (buf_p[0] & 0x7f);
 
-static void decoder_decode_repeated(
-    struct pbtools_decoder_t *self_p,
-    struct pbtools_repeated_info_t *repeated_info_p,
-    struct pbtools_repeated_message_t *repeated_p,
-    size_t item_size,
-    decoder_read_repeated_t read_repeated)
-{
-    int res;
-    int wire_type;
-    int tag;
-    int index;
+    if (((buf_p[1] & 0x80) == 0) && (left >= 2)) {
+        self_p->pos += 2;
 
-    if (repeated_info_p->length == 0) {
-        return;
+        return (value | ((uint64_t)buf_p[1] << 7));
     }
 
-    repeated_p->items_p = decoder_heap_alloc(
-        self_p,
-        item_size * (size_t)repeated_info_p->length,
-        alignof(uint64_t));
+    value |= ((uint64_t)(buf_p[1] & 0x7f) << 7);
 
-    if (repeated_p->items_p == NULL) {
-        return;
+    if (left > 10) {
+        left = 10;
     }
 
-    repeated_p->length = repeated_info_p->length;
-    index = read_repeated(&repeated_info_p->decoder,
-                          repeated_info_p->wire_type,
-                          repeated_p->items_p,
-                          0);
+    for (i = 2; i < left; i++) {
+        value |= ((uint64_t)(buf_p[i] & 0x7f) << (7 * i));
 
-    while (are_more_items_to_decode(repeated_info_p, index)) {
-        tag = pbtools_decoder_read_tag(&repeated_info_p->decoder, &wire_type);
+        if ((buf_p[i] & 0x80) == 0) {
+            self_p->pos += (i + 1);
 
-        if (tag == repeated_info_p->tag) {
-            index += read_repeated(&repeated_info_p->decoder,
-                                   wire_type,
-                                   repeated_p->items_p,
-                                   index);
-        } else {
-            pbtools_decoder_skip_field(&repeated_info_p->decoder, wire_type);
+            return (value);
         }
     }
 
-    res = decoder_get_result(&repeated_info_p->decoder);
+    decoder_abort(self_p,
+                  (left < 10
+                   ? PBTOOLS_OUT_OF_DATA
+                   : PBTOOLS_VARINT_OVERFLOW));
 
-    if (res < 0) {
-        decoder_abort(self_p, -res);
-    }
+    return (0);
 }
 
-static void read_repeated_int32_item(struct pbtools_decoder_t *self_p,
-                                     int32_t *items_p,
-                                     int index)
-{
-    items_p[index] = (int32_t)(int64_t)decoder_read_varint(self_p);
-}
+#if PBTOOLS_CONFIG_SIMD == 1
+static int simd = PBTOOLS_SIMD_NONE;
+#endif
 
-static void read_repeated_int64_item(struct pbtools_decoder_t *self_p,
-                                     int64_t *items_p,
-                                     int index)
+/* Skip a varint without decoding it. Its end is found with one vector
+   compare if a vector can be loaded, that is, if at least 16 bytes
+   are left or the input is padded. */
+static void decoder_skip_varint(struct pbtools_decoder_t *self_p)
 {
-    items_p[index] = (int64_t)decoder_read_varint(self_p);
-}
+    const uint8_t *buf_p;
+    int left;
+    int i;
+#if PBTOOLS_CONFIG_SIMD == 1
+    uint32_t ends;
+#endif
 
-static void read_repeated_sint32_item(struct pbtools_decoder_t *self_p,
-                                      int32_t *items_p,
-                                      int index)
-{
-    items_p[index] = sint32_decode(decoder_read_varint(self_p));
-}
+    buf_p = &self_p->buf_p[self_p->pos];
+    left = decoder_left(self_p);
+
+#if PBTOOLS_CONFIG_SIMD == 1
+    if (((left >= 16) || (self_p->padded && (left > 0)))
+        && (simd != PBTOOLS_SIMD_NONE)) {
+        ends = ~(uint32_t)_mm_movemask_epi8(
+            _mm_loadu_si128((const __m128i *)buf_p));
+        ends &= 0x3ff;
+
+        if (ends == 0) {
+            decoder_abort(self_p,
+                          (left < 10
+                           ? PBTOOLS_OUT_OF_DATA
+                           : PBTOOLS_VARINT_OVERFLOW));
+        } else if (__builtin_ctz(ends) >= left) {
+            decoder_abort(self_p, PBTOOLS_OUT_OF_DATA);
+        } else {
+            self_p->pos += (__builtin_ctz(ends) + 1);
+        }
 
+        return;
+    }
+#endif
 
-static void read_repeated_sint64_item(struct pbtools_decoder_t *self_p,
-                                      int64_t *items_p,
-                                      int index)
-{
-    items_p[index] = sint64_decode(decoder_read_varint(self_p));
-}
+    for (i = 0; i < 10; i++) {
+        if (i == left) {
+            decoder_abort(self_p, PBTOOLS_OUT_OF_DATA);
 
-static void read_repeated_uint32_item(struct pbtools_decoder_t *self_p,
-                                      uint32_t *items_p,
-                                      int index)
-{
-    items_p[index] = (uint32_t)decoder_read_varint(self_p);
-}
+            return;
+        }
 
-static void read_repeated_uint64_item(struct pbtools_decoder_t *self_p,
-                                      uint64_t *items_p,
-                                      int index)
-{
-    items_p[index] = decoder_read_varint(self_p);
-}
+        if ((buf_p[i] & 0x80) == 0) {
+            self_p->pos += (i + 1);
 
-static void read_repeated_fixed32_item(struct pbtools_decoder_t *self_p,
-                                       uint32_t *items_p,
-                                       int index)
-{
-    items_p[index] = decoder_read_32_bit_value(self_p);
-}
+            return;
+        }
+    }
 
-static void read_repeated_fixed64_item(struct pbtools_decoder_t *self_p,
-                                       uint64_t *items_p,
-                                       int index)
-{
-    items_p[index] = decoder_read_64_bit_value(self_p);
+    decoder_abort(self_p, PBTOOLS_VARINT_OVERFLOW);
 }
 
-static void read_repeated_sfixed32_item(struct pbtools_decoder_t *self_p,
-                                        int32_t *items_p,
-                                        int index)
+static uint64_t read_varint_check_wire_type(
+    struct pbtools_decoder_t *self_p,
+    int wire_type,
+    int expected_wire_type)
 {
-    items_p[index] = (int32_t)decoder_read_32_bit_value(self_p);
-}
+    if (wire_type != expected_wire_type) {
+        decoder_abort(self_p, PBTOOLS_BAD_WIRE_TYPE);
 
-static void read_repeated_sfixed64_item(struct pbtools_decoder_t *self_p,
-                                        int64_t *items_p,
-                                        int index)
-{
-    items_p[index] = (int64_t)decoder_read_64_bit_value(self_p);
-}
+        return (0);
+    }
 
-static void read_repeated_bool_item(struct pbtools_decoder_t *self_p,
-                                    bool *items_p,
-                                    int index)
-{
-    items_p[index] = (bool)decoder_read_varint(self_p);
+    return (decoder_read_varint(self_p));
 }
 
-static void read_repeated_float_item(struct pbtools_decoder_t *self_p,
-                                     float *items_p,
-                                     int index)
+static uint64_t read_varint_check_wire_type_varint(
+    struct pbtools_decoder_t *self_p,
+    int wire_type)
 {
-    uint32_t data;
-
-    data = (uint32_t)decoder_read_32_bit_value(self_p);
-    memcpy(&items_p[index], &data, sizeof(data));
+    return (read_varint_check_wire_type(
+                self_p,
+                wire_type,
+                PBTOOLS_WIRE_TYPE_VARINT));
 }
 
-static void read_repeated_double_item(struct pbtools_decoder_t *self_p,
-                                      double *items_p,
-                                      int index)
+static uint64_t decoder_read_length_delimited(struct pbtools_decoder_t *self_p,
+                                              int wire_type)
 {
-    uint64_t data;
+    uint64_t length;
 
-    data = (uint64_t)decoder_read_64_bit_value(self_p);
-    memcpy(&items_p[index], &data, sizeof(data));
-}
+    length = read_varint_check_wire_type(
+        self_p,
+        wire_type,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
 
-static int read_repeated_int32(struct pbtools_decoder_t *self_p,
-                               int wire_type,
-                               int32_t *items_p,
-                               int index)
-{
-    return (decoder_read_repeated_varint(
-                self_p,
-                wire_type,
-                &items_p[index],
-                (repeated_item_read_t)read_repeated_int32_item));
+    if (length >= INT_MAX) {
+        decoder_abort(self_p, PBTOOLS_LENGTH_DELIMITED_OVERFLOW);
+        length = 0;
+    }
+
+    return (length);
 }
 
-static int read_repeated_int64(struct pbtools_decoder_t *self_p,
-                               int wire_type,
-                               int64_t *items_p,
-                               int index)
+int pbtools_decoder_read_tag(struct pbtools_decoder_t *self_p,
+                             int *wire_type_p)
 {
-    return (decoder_read_repeated_varint(
-                self_p,
-                wire_type,
-                &items_p[index],
-                (repeated_item_read_t)read_repeated_int64_item));
+    uint32_t value;
+    int field_number;
+
+    value = (uint32_t)decoder_read_varint(self_p);
+    field_number = (int)(value >> 3);
+    *wire_type_p = (value & 0x7);
+
+    if (field_number == 0) {
+        decoder_abort(self_p, PBTOOLS_BAD_FIELD_NUMBER);
+    }
+
+    return (field_number);
 }
 
-static int read_repeated_uint32(struct pbtools_decoder_t *self_p,
-                                int wire_type,
-                                uint32_t *items_p,
-                                int index)
+static bool decoder_read_expected_tag(struct pbtools_decoder_t *self_p,
+                                      int field_number,
+                                      int wire_type)
 {
-    return (decoder_read_repeated_varint(
-                self_p,
-                wire_type,
-                &items_p[index],
-                (repeated_item_read_t)read_repeated_uint32_item));
+    const uint8_t *buf_p;
+    uint32_t key;
+    int left;
+
+    key = (((uint32_t)field_number << 3) | (uint32_t)wire_type);
+    buf_p = self_p->buf_p;
+    left = decoder_left(self_p);
+
+    if (key < 0x80) {
+        if ((left < 1) || (buf_p[self_p->pos] != key)) {
+            return (false);
+        }
+
+        self_p->pos++;
+    } else if (key < 0x4000) {
+        if ((left < 2)
+            || (buf_p[self_p->pos] != (0x80 | (key & 0x7f)))
+            || (buf_p[self_p->pos + 1] != (key >> 7))) {
+            return (false);
+        }
+
+        self_p->pos += 2;
+    } else {
+        return (false);
+    }
+
+    return (true);
 }
 
-static int read_repeated_uint64(struct pbtools_decoder_t *self_p,
-                                int wire_type,
-                                uint64_t *items_p,
-                                int index)
+bool pbtools_decoder_read_expected_tag(struct pbtools_decoder_t *self_p,
+                                       int field_number,
+                                       int wire_type)
 {
-    return (decoder_read_repeated_varint(
-                self_p,
-                wire_type,
-                &items_p[index],
-                (repeated_item_read_t)read_repeated_uint64_item));
+    return (decoder_read_expected_tag(self_p, field_number, wire_type));
 }
 
-static int read_repeated_sint32(struct pbtools_decoder_t *self_p,
-                                int wire_type,
-                                int32_t *items_p,
-                                int index)
+uint32_t pbtools_decoder_read_key(struct pbtools_decoder_t *self_p)
 {
-    return (decoder_read_repeated_varint(
-                self_p,
-                wire_type,
-                &items_p[index],
-                (repeated_item_read_t)read_repeated_sint32_item));
+    uint32_t key;
+
+    key = (uint32_t)decoder_read_varint(self_p);
+
+    if (key < 8) {
+        decoder_abort(self_p, PBTOOLS_BAD_FIELD_NUMBER);
+    }
+
+    return (key);
 }
 
-static int read_repeated_sint64(struct pbtools_decoder_t *self_p,
-                                int wire_type,
-                                int64_t *items_p,
-                                int index)
+void pbtools_decoder_abort(struct pbtools_decoder_t *self_p, int error)
 {
-    return (decoder_read_repeated_varint(
-                self_p,
-                wire_type,
-                &items_p[index],
-                (repeated_item_read_t)read_repeated_sint64_item));
+    decoder_abort(self_p, error);
 }
 
-static int read_repeated_fixed32(struct pbtools_decoder_t *self_p,
-                                 int wire_type,
-                                 uint32_t *items_p,
-                                 int index)
+int32_t pbtools_decoder_read_int32(struct pbtools_decoder_t *self_p,
+                                   int wire_type)
 {
-    return (decoder_read_repeated_32_bit(
-                self_p,
-                wire_type,
-                &items_p[index],
-                (repeated_item_read_t)read_repeated_fixed32_item));
+    return ((int32_t)pbtools_decoder_read_int64(self_p, wire_type));
 }
 
-static int read_repeated_fixed64(struct pbtools_decoder_t *self_p,
-                                 int wire_type,
-                                 uint64_t *items_p,
-                                 int index)
+int64_t pbtools_decoder_read_int64(struct pbtools_decoder_t *self_p,
+                                   int wire_type)
 {
-    return (decoder_read_repeated_64_bit(
+    return ((int64_t)read_varint_check_wire_type_varint(
                 self_p,
-                wire_type,
-                &items_p[index],
-                (repeated_item_read_t)read_repeated_fixed64_item));
+                wire_type));
 }
 
-static int read_repeated_sfixed32(struct pbtools_decoder_t *self_p,
-                                  int wire_type,
-                                  int32_t *items_p,
-                                  int index)
+int32_t pbtools_decoder_read_sint32(struct pbtools_decoder_t *self_p,
+                                    int wire_type)
 {
-    return (decoder_read_repeated_32_bit(
-                self_p,
-                wire_type,
-                &items_p[index],
-                (repeated_item_read_t)read_repeated_sfixed32_item));
+    return ((int32_t)pbtools_decoder_read_sint64(self_p, wire_type));
 }
 
-static int read_repeated_sfixed64(struct pbtools_decoder_t *self_p,
-                                  int wire_type,
-                                  int64_t *items_p,
-                                  int index)
+int64_t pbtools_decoder_read_sint64(struct pbtools_decoder_t *self_p,
+                                    int wire_type)
 {
-    return (decoder_read_repeated_64_bit(
-                self_p,
-                wire_type,
-                &items_p[index],
-                (repeated_item_read_t)read_repeated_sfixed64_item));
+    return (sint64_decode(read_varint_check_wire_type_varint(self_p,
+                                                             wire_type)));
 }
 
-static int read_repeated_float(struct pbtools_decoder_t *self_p,
-                               int wire_type,
-                               float *items_p,
-                               int index)
+uint32_t pbtools_decoder_read_uint32(struct pbtools_decoder_t *self_p,
+                                     int wire_type)
 {
-    return (decoder_read_repeated_32_bit(
-                self_p,
-                wire_type,
-                &items_p[index],
-                (repeated_item_read_t)read_repeated_float_item));
+    return ((uint32_t)pbtools_decoder_read_uint64(self_p, wire_type));
 }
 
-static int read_repeated_double(struct pbtools_decoder_t *self_p,
-                                int wire_type,
-                                double *items_p,
-                                int index)
+uint64_t pbtools_decoder_read_uint64(struct pbtools_decoder_t *self_p,
+                                     int wire_type)
 {
-    return (decoder_read_repeated_64_bit(
-                self_p,
-                wire_type,
-                &items_p[index],
-                (repeated_item_read_t)read_repeated_double_item));
+    return (read_varint_check_wire_type_varint(self_p, wire_type));
 }
 
-static int read_repeated_bool(struct pbtools_decoder_t *self_p,
-                              int wire_type,
-                              bool *items_p,
-                              int index)
+/* Read a fixed size value. Trusted input is not checked against the
+   end of the buffer. */
+static void decoder_read_value(struct pbtools_decoder_t *self_p,
+                               uint8_t *buf_p,
+                               size_t size)
 {
-    return (decoder_read_repeated_varint(
-                self_p,
-                wire_type,
-                &items_p[index],
-                (repeated_item_read_t)read_repeated_bool_item));
+#if PBTOOLS_CONFIG_TRUSTED_INPUT == 1
+    if (self_p->pos < 0) {
+        memset(buf_p, 0, size);
+    } else {
+        memcpy(buf_p, &self_p->buf_p[self_p->pos], size);
+        self_p->pos += (int)size;
+    }
+#else
+    decoder_read(self_p, buf_p, size);
+#endif
 }
 
-static int read_repeated_string(struct pbtools_decoder_t *self_p,
-                                int wire_type,
-                                char **items_pp,
-                                int index)
+static uint32_t decoder_read_32_bit_value(struct pbtools_decoder_t *self_p)
 {
-    pbtools_decoder_read_string(self_p, wire_type, &items_pp[index]);
+    uint32_t value;
+    uint8_t buf[4];
 
-    return (1);
+    decoder_read_value(self_p, &buf[0], sizeof(buf));
+    value = ((uint32_t)buf[0] << 0);
+    value |= ((uint32_t)buf[1] << 8);
+    value |= ((uint32_t)buf[2] << 16);
+    value |= ((uint32_t)buf[3] << 24);
+
+    return (value);
 }
 
-static int read_repeated_bytes(struct pbtools_decoder_t *self_p,
-                               int wire_type,
-                               struct pbtools_bytes_t *items_p,
-                               int index)
+uint32_t pbtools_decoder_read_fixed32(struct pbtools_decoder_t *self_p,
+                                      int wire_type)
 {
-    pbtools_decoder_read_bytes(self_p, wire_type, &items_p[index]);
+    if (wire_type != PBTOOLS_WIRE_TYPE_32_BIT) {
+        decoder_abort(self_p, PBTOOLS_BAD_WIRE_TYPE);
 
-    return (1);
-}
+        return (0);
+    }
 
-int pbtools_alloc_repeated_int32(struct pbtools_message_base_t *self_p,
-                                 int length,
-                                 struct pbtools_repeated_int32_t *repeated_p)
-{
-    return (alloc_repeated_int32(self_p, length, repeated_p));
+    return (decoder_read_32_bit_value(self_p));
 }
 
-void pbtools_repeated_info_decode_int32(struct pbtools_repeated_info_t *self_p,
-                                        struct pbtools_decoder_t *decoder_p,
-                                        int wire_type)
+static uint64_t decoder_read_64_bit_value(struct pbtools_decoder_t *self_p)
 {
-    repeated_info_decode_varint(self_p, decoder_p, wire_type);
-}
+    uint64_t value;
+    uint8_t buf[8];
 
-void pbtools_decoder_decode_repeated_int32(
-    struct pbtools_decoder_t *self_p,
-    struct pbtools_repeated_info_t *repeated_info_p,
-    struct pbtools_repeated_int32_t *repeated_p)
-{
-    decoder_decode_repeated(self_p,
-                            repeated_info_p,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(int32_t),
-                            (decoder_read_repeated_t)read_repeated_int32);
-}
+    decoder_read_value(self_p, &buf[0], sizeof(buf));
+    value = ((uint64_t)buf[0] << 0);
+    value |= ((uint64_t)buf[1] << 8);
+    value |= ((uint64_t)buf[2] << 16);
+    value |= ((uint64_t)buf[3] << 24);
+    value |= ((uint64_t)buf[4] << 32);
+    value |= ((uint64_t)buf[5] << 40);
+    value |= ((uint64_t)buf[6] << 48);
+    value |= ((uint64_t)buf[7] << 56);
 
-int pbtools_alloc_repeated_int64(struct pbtools_message_base_t *self_p,
-                                 int length,
-                                 struct pbtools_repeated_int64_t *repeated_p)
-{
-    return (alloc_repeated_int64(self_p, length, repeated_p));
+    return (value);
 }
 
-void pbtools_repeated_info_decode_int64(struct pbtools_repeated_info_t *self_p,
-                                        struct pbtools_decoder_t *decoder_p,
-                                        int wire_type)
+uint64_t pbtools_decoder_read_fixed64(struct pbtools_decoder_t *self_p,
+                                      int wire_type)
 {
-    repeated_info_decode_varint(self_p, decoder_p, wire_type);
-}
+    if (wire_type != PBTOOLS_WIRE_TYPE_64_BIT) {
+        decoder_abort(self_p, PBTOOLS_BAD_WIRE_TYPE);
 
-void pbtools_decoder_decode_repeated_int64(
-    struct pbtools_decoder_t *self_p,
-    struct pbtools_repeated_info_t *repeated_info_p,
-    struct pbtools_repeated_int64_t *repeated_p)
-{
-    decoder_decode_repeated(self_p,
-                            repeated_info_p,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(int64_t),
-                            (decoder_read_repeated_t)read_repeated_int64);
-}
+        return (0);
+    }
 
-int pbtools_alloc_repeated_uint32(struct pbtools_message_base_t *self_p,
-                                  int length,
-                                  struct pbtools_repeated_uint32_t *repeated_p)
-{
-    return (alloc_repeated_uint32(self_p, length, repeated_p));
+    return (decoder_read_64_bit_value(self_p));
 }
 
-void pbtools_repeated_info_decode_uint32(struct pbtools_repeated_info_t *self_p,
-                                         struct pbtools_decoder_t *decoder_p,
-                                         int wire_type)
+int32_t pbtools_decoder_read_sfixed32(struct pbtools_decoder_t *self_p,
+                                      int wire_type)
 {
-    repeated_info_decode_varint(self_p, decoder_p, wire_type);
+    return ((int32_t)pbtools_decoder_read_fixed32(self_p, wire_type));
 }
 
-void pbtools_decoder_decode_repeated_uint32(
-    struct pbtools_decoder_t *self_p,
-    struct pbtools_repeated_info_t *repeated_info_p,
-    struct pbtools_repeated_uint32_t *repeated_p)
+int64_t pbtools_decoder_read_sfixed64(struct pbtools_decoder_t *self_p,
+                                      int wire_type)
 {
-    decoder_decode_repeated(self_p,
-                            repeated_info_p,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(uint32_t),
-                            (decoder_read_repeated_t)read_repeated_uint32);
+    return ((int64_t)pbtools_decoder_read_fixed64(self_p, wire_type));
 }
 
-int pbtools_alloc_repeated_uint64(struct pbtools_message_base_t *self_p,
-                                  int length,
-                                  struct pbtools_repeated_uint64_t *repeated_p)
+#if PBTOOLS_CONFIG_FLOAT == 1
+
+float pbtools_decoder_read_float(struct pbtools_decoder_t *self_p,
+                                 int wire_type)
 {
-    return (alloc_repeated_uint64(self_p, length, repeated_p));
+    uint32_t data;
+    float value;
+
+    data = pbtools_decoder_read_fixed32(self_p, wire_type);
+    memcpy(&value, &data, sizeof(value));
+
+    return (value);
 }
 
-void pbtools_repeated_info_decode_uint64(struct pbtools_repeated_info_t *self_p,
-                                         struct pbtools_decoder_t *decoder_p,
-                                         int wire_type)
+double pbtools_decoder_read_double(struct pbtools_decoder_t *self_p,
+                                   int wire_type)
 {
-    repeated_info_decode_varint(self_p, decoder_p, wire_type);
+    uint64_t data;
+    double value;
+
+    data = pbtools_decoder_read_fixed64(self_p, wire_type);
+    memcpy(&value, &data, sizeof(value));
+
+    return (value);
 }
 
-void pbtools_decoder_decode_repeated_uint64(
-    struct pbtools_decoder_t *self_p,
-    struct pbtools_repeated_info_t *repeated_info_p,
-    struct pbtools_repeated_uint64_t *repeated_p)
+#endif
+
+bool pbtools_decoder_read_bool(struct pbtools_decoder_t *self_p,
+                               int wire_type)
 {
-    decoder_decode_repeated(self_p,
-                            repeated_info_p,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(uint64_t),
-                            (decoder_read_repeated_t)read_repeated_uint64);
+    return (pbtools_decoder_read_int32(self_p, wire_type) != 0);
 }
 
-int pbtools_alloc_repeated_sint32(struct pbtools_message_base_t *self_p,
-                                  int length,
-                                  struct pbtools_repeated_int32_t *repeated_p)
+int pbtools_decoder_read_enum(struct pbtools_decoder_t *self_p,
+                              int wire_type)
 {
-    return (alloc_repeated_int32(self_p, length, repeated_p));
+    return (pbtools_decoder_read_int32(self_p, wire_type));
 }
 
-void pbtools_repeated_info_decode_sint32(struct pbtools_repeated_info_t *self_p,
-                                         struct pbtools_decoder_t *decoder_p,
-                                         int wire_type)
+static void decoder_read_string(struct pbtools_decoder_t *self_p,
+                                int wire_type,
+                                char **value_pp)
 {
-    repeated_info_decode_varint(self_p, decoder_p, wire_type);
-}
+    uint64_t size;
 
-void pbtools_decoder_decode_repeated_sint32(
-    struct pbtools_decoder_t *self_p,
-    struct pbtools_repeated_info_t *repeated_info_p,
-    struct pbtools_repeated_int32_t *repeated_p)
-{
-    decoder_decode_repeated(self_p,
-                            repeated_info_p,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(int32_t),
-                            (decoder_read_repeated_t)read_repeated_sint32);
+    size = decoder_read_length_delimited(self_p, wire_type);
+    *value_pp = decoder_heap_alloc(self_p,
+                                   size + 1,
+                                   alignof(char));
+
+    if (*value_pp == NULL) {
+        return;
+    }
+
+#if PBTOOLS_CONFIG_VALIDATE_UTF8 == 1
+    if ((size <= (uint64_t)decoder_left(self_p))
+        && !pbtools_utf8_is_valid(&self_p->buf_p[self_p->pos], size)) {
+        (*value_pp)[0] = '\0';
+        decoder_abort(self_p, PBTOOLS_BAD_UTF8);
+
+        return;
+    }
+#endif
+
+    decoder_read(self_p, (uint8_t *)*value_pp, size);
+    (*value_pp)[size] = '\0';
 }
 
-int pbtools_alloc_repeated_sint64(struct pbtools_message_base_t *self_p,
-                                  int length,
-                                  struct pbtools_repeated_int64_t *repeated_p)
+static void decoder_read_bytes(struct pbtools_decoder_t *self_p,
+                               int wire_type,
+                               struct pbtools_bytes_t *bytes_p)
 {
-    return (alloc_repeated_int64(self_p, length, repeated_p));
+    uint64_t size;
+
+    size = decoder_read_length_delimited(self_p, wire_type);
+    bytes_p->size = size;
+    bytes_p->buf_p = decoder_heap_alloc(self_p,
+                                        bytes_p->size,
+                                        alignof(uint8_t));
+
+    if (bytes_p->buf_p == NULL) {
+        return;
+    }
+
+    decoder_read(self_p, bytes_p->buf_p, bytes_p->size);
 }
 
-void pbtools_repeated_info_decode_sint64(struct pbtools_repeated_info_t *self_p,
-                                         struct pbtools_decoder_t *decoder_p,
-                                         int wire_type)
+static void decoder_read_bytes_view(struct pbtools_decoder_t *self_p,
+                                    int wire_type,
+                                    struct pbtools_bytes_t *bytes_p)
 {
-    repeated_info_decode_varint(self_p, decoder_p, wire_type);
+    uint64_t size;
+
+    size = decoder_read_length_delimited(self_p, wire_type);
+
+    if (self_p->pos < 0) {
+        return;
+    }
+
+    if ((uint64_t)decoder_left(self_p) >= size) {
+        bytes_p->buf_p = (uint8_t *)&self_p->buf_p[self_p->pos];
+        bytes_p->size = size;
+        self_p->pos += (int)size;
+    } else {
+        decoder_abort(self_p, PBTOOLS_OUT_OF_DATA);
+    }
 }
 
-void pbtools_decoder_decode_repeated_sint64(
-    struct pbtools_decoder_t *self_p,
-    struct pbtools_repeated_info_t *repeated_info_p,
-    struct pbtools_repeated_int64_t *repeated_p)
+void pbtools_decoder_read_string(struct pbtools_decoder_t *self_p,
+                                 int wire_type,
+                                 char **value_pp)
 {
-    decoder_decode_repeated(self_p,
-                            repeated_info_p,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(int64_t),
-                            (decoder_read_repeated_t)read_repeated_sint64);
+    decoder_read_string(self_p, wire_type, value_pp);
 }
 
-int pbtools_alloc_repeated_fixed32(struct pbtools_message_base_t *self_p,
-                                   int length,
-                                   struct pbtools_repeated_uint32_t *repeated_p)
+void pbtools_decoder_read_bytes(struct pbtools_decoder_t *self_p,
+                                int wire_type,
+                                struct pbtools_bytes_t *bytes_p)
 {
-    return (alloc_repeated_uint32(self_p, length, repeated_p));
+    decoder_read_bytes(self_p, wire_type, bytes_p);
 }
 
-void pbtools_repeated_info_decode_fixed32(struct pbtools_repeated_info_t *self_p,
-                                          struct pbtools_decoder_t *decoder_p,
-                                          int wire_type)
+void pbtools_decoder_read_bytes_view(struct pbtools_decoder_t *self_p,
+                                     int wire_type,
+                                     struct pbtools_bytes_t *bytes_p)
 {
-    repeated_info_decode_32bit(self_p, decoder_p, wire_type);
+    decoder_read_bytes_view(self_p, wire_type, bytes_p);
 }
 
-void pbtools_decoder_decode_repeated_fixed32(
-    struct pbtools_decoder_t *self_p,
-    struct pbtools_repeated_info_t *repeated_info_p,
-    struct pbtools_repeated_uint32_t *repeated_p)
+int32_t pbtools_decoder_read_int32_unchecked(struct pbtools_decoder_t *self_p)
 {
-    decoder_decode_repeated(self_p,
-                            repeated_info_p,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(uint32_t),
-                            (decoder_read_repeated_t)read_repeated_fixed32);
+    return ((int32_t)decoder_read_varint(self_p));
 }
 
-int pbtools_alloc_repeated_fixed64(struct pbtools_message_base_t *self_p,
-                                   int length,
-                                   struct pbtools_repeated_uint64_t *repeated_p)
+int64_t pbtools_decoder_read_int64_unchecked(struct pbtools_decoder_t *self_p)
 {
-    return (alloc_repeated_uint64(self_p, length, repeated_p));
+    return ((int64_t)decoder_read_varint(self_p));
 }
 
-void pbtools_repeated_info_decode_fixed64(struct pbtools_repeated_info_t *self_p,
-                                          struct pbtools_decoder_t *decoder_p,
-                                          int wire_type)
+int32_t pbtools_decoder_read_sint32_unchecked(
+    struct pbtools_decoder_t *self_p)
 {
-    repeated_info_decode_64bit(self_p, decoder_p, wire_type);
+    return ((int32_t)sint64_decode(decoder_read_varint(self_p)));
 }
 
-void pbtools_decoder_decode_repeated_fixed64(
-    struct pbtools_decoder_t *self_p,
-    struct pbtools_repeated_info_t *repeated_info_p,
-    struct pbtools_repeated_uint64_t *repeated_p)
+int64_t pbtools_decoder_read_sint64_unchecked(
+    struct pbtools_decoder_t *self_p)
 {
-    decoder_decode_repeated(self_p,
-                            repeated_info_p,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(uint64_t),
-                            (decoder_read_repeated_t)read_repeated_fixed64);
+    return (sint64_decode(decoder_read_varint(self_p)));
 }
 
-int pbtools_alloc_repeated_sfixed32(struct pbtools_message_base_t *self_p,
-                                    int length,
-                                    struct pbtools_repeated_int32_t *repeated_p)
+uint32_t pbtools_decoder_read_uint32_unchecked(
+    struct pbtools_decoder_t *self_p)
 {
-    return (alloc_repeated_int32(self_p, length, repeated_p));
+    return ((uint32_t)decoder_read_varint(self_p));
 }
 
-void pbtools_repeated_info_decode_sfixed32(struct pbtools_repeated_info_t *self_p,
-                                           struct pbtools_decoder_t *decoder_p,
-                                           int wire_type)
+uint64_t pbtools_decoder_read_uint64_unchecked(
+    struct pbtools_decoder_t *self_p)
 {
-    repeated_info_decode_32bit(self_p, decoder_p, wire_type);
+    return (decoder_read_varint(self_p));
 }
 
-void pbtools_decoder_decode_repeated_sfixed32(
-    struct pbtools_decoder_t *self_p,
-    struct pbtools_repeated_info_t *repeated_info_p,
-    struct pbtools_repeated_int32_t *repeated_p)
+uint32_t pbtools_decoder_read_fixed32_unchecked(
+    struct pbtools_decoder_t *self_p)
 {
-    decoder_decode_repeated(self_p,
-                            repeated_info_p,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(int32_t),
-                            (decoder_read_repeated_t)read_repeated_sfixed32);
+    return (decoder_read_32_bit_value(self_p));
 }
 
-int pbtools_alloc_repeated_sfixed64(struct pbtools_message_base_t *self_p,
-                                    int length,
-                                    struct pbtools_repeated_int64_t *repeated_p)
+uint64_t pbtools_decoder_read_fixed64_unchecked(
+    struct pbtools_decoder_t *self_p)
 {
-    return (alloc_repeated_int64(self_p, length, repeated_p));
+    return (decoder_read_64_bit_value(self_p));
 }
 
-void pbtools_repeated_info_decode_sfixed64(struct pbtools_repeated_info_t *self_p,
-                                           struct pbtools_decoder_t *decoder_p,
-                                           int wire_type)
+int32_t pbtools_decoder_read_sfixed32_unchecked(
+    struct pbtools_decoder_t *self_p)
 {
-    repeated_info_decode_64bit(self_p, decoder_p, wire_type);
+    return ((int32_t)decoder_read_32_bit_value(self_p));
 }
 
-void pbtools_decoder_decode_repeated_sfixed64(
-    struct pbtools_decoder_t *self_p,
-    struct pbtools_repeated_info_t *repeated_info_p,
-    struct pbtools_repeated_int64_t *repeated_p)
+int64_t pbtools_decoder_read_sfixed64_unchecked(
+    struct pbtools_decoder_t *self_p)
 {
-    decoder_decode_repeated(self_p,
-                            repeated_info_p,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(int64_t),
-                            (decoder_read_repeated_t)read_repeated_sfixed64);
+    return ((int64_t)decoder_read_64_bit_value(self_p));
 }
 
 #if PBTOOLS_CONFIG_FLOAT == 1
 
-int pbtools_alloc_repeated_float(struct pbtools_message_base_t *self_p,
-                                 int length,
-                                 struct pbtools_repeated_float_t *repeated_p)
+float pbtools_decoder_read_float_unchecked(struct pbtools_decoder_t *self_p)
 {
-    return (calloc_repeated(self_p,
-                            length,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(*repeated_p->items_p)));
+    uint32_t data;
+    float value;
+
+    data = decoder_read_32_bit_value(self_p);
+    memcpy(&value, &data, sizeof(value));
+
+    return (value);
 }
 
-void pbtools_repeated_info_decode_float(struct pbtools_repeated_info_t *self_p,
-                                        struct pbtools_decoder_t *decoder_p,
-                                        int wire_type)
+double pbtools_decoder_read_double_unchecked(struct pbtools_decoder_t *self_p)
 {
-    repeated_info_decode_32bit(self_p, decoder_p, wire_type);
+    uint64_t data;
+    double value;
+
+    data = decoder_read_64_bit_value(self_p);
+    memcpy(&value, &data, sizeof(value));
+
+    return (value);
 }
 
-void pbtools_decoder_decode_repeated_float(
-    struct pbtools_decoder_t *self_p,
-    struct pbtools_repeated_info_t *repeated_info_p,
-    struct pbtools_repeated_float_t *repeated_p)
+#endif
+
+bool pbtools_decoder_read_bool_unchecked(struct pbtools_decoder_t *self_p)
 {
-    decoder_decode_repeated(self_p,
-                            repeated_info_p,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(float),
-                            (decoder_read_repeated_t)read_repeated_float);
+    return (pbtools_decoder_read_int32_unchecked(self_p) != 0);
 }
 
-int pbtools_alloc_repeated_double(struct pbtools_message_base_t *self_p,
-                                  int length,
-                                  struct pbtools_repeated_double_t *repeated_p)
+int pbtools_decoder_read_enum_unchecked(struct pbtools_decoder_t *self_p)
 {
-    return (calloc_repeated(self_p,
-                            length,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(*repeated_p->items_p)));
+    return (pbtools_decoder_read_int32_unchecked(self_p));
 }
 
-void pbtools_repeated_info_decode_double(struct pbtools_repeated_info_t *self_p,
-                                         struct pbtools_decoder_t *decoder_p,
-                                         int wire_type)
+void pbtools_decoder_read_string_unchecked(struct pbtools_decoder_t *self_p,
+                                           char **value_pp)
 {
-    repeated_info_decode_64bit(self_p, decoder_p, wire_type);
+    decoder_read_string(self_p, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, value_pp);
 }
 
-void pbtools_decoder_decode_repeated_double(
+void pbtools_decoder_read_bytes_unchecked(struct pbtools_decoder_t *self_p,
+                                          struct pbtools_bytes_t *bytes_p)
+{
+    decoder_read_bytes(self_p, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, bytes_p);
+}
+
+void pbtools_decoder_read_bytes_view_unchecked(
     struct pbtools_decoder_t *self_p,
-    struct pbtools_repeated_info_t *repeated_info_p,
-    struct pbtools_repeated_double_t *repeated_p)
+    struct pbtools_bytes_t *bytes_p)
 {
-    decoder_decode_repeated(self_p,
-                            repeated_info_p,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(double),
-                            (decoder_read_repeated_t)read_repeated_double);
+    decoder_read_bytes_view(self_p,
+                            PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+                            bytes_p);
 }
 
-#endif
+typedef void (*packed_varints_store_t)(void *items_p,
+                                       int index,
+                                       const uint64_t *values_p,
+                                       int length);
 
-int pbtools_alloc_repeated_bool(struct pbtools_message_base_t *self_p,
-                                int length,
-                                struct pbtools_repeated_bool_t *repeated_p)
+/* Maximum number of values decoded and stored at a time. */
+#define PACKED_VARINTS_BLOCK_SIZE                               64
+
+#if PBTOOLS_CONFIG_SIMD == 1
+
+typedef int (*packed_varints_count_t)(const uint8_t *buf_p, int size);
+
+typedef int (*packed_varints_decode_t)(const uint8_t *buf_p,
+                                       int size,
+                                       int *pos_p,
+                                       uint64_t *values_p);
+
+static packed_varints_count_t packed_varints_count;
+static packed_varints_decode_t packed_varints_decode;
+
+/* Remove continuation bits from a varint of at most 8 bytes. */
+static uint64_t varint_compact(const uint8_t *buf_p, int length)
 {
-    return (calloc_repeated(self_p,
-                            length,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(*repeated_p->items_p)));
+    uint64_t value;
+
+    memcpy(&value, buf_p, sizeof(value));
+
+    if (length < 8) {
+        value &= ((1ull << (8 * length)) - 1);
+    }
+
+    value = (((value & 0x7f007f007f007f00ull) >> 1)
+             | (value & 0x007f007f007f007full));
+    value = (((value & 0x3fff00003fff0000ull) >> 2)
+             | (value & 0x00003fff00003fffull));
+    value = (((value & 0x0fffffff00000000ull) >> 4)
+             | (value & 0x000000000fffffffull));
+
+    return (value);
 }
 
-void pbtools_repeated_info_decode_bool(struct pbtools_repeated_info_t *self_p,
-                                       struct pbtools_decoder_t *decoder_p,
-                                       int wire_type)
+static uint64_t varint_decode_long(const uint8_t *buf_p, int length)
 {
-    repeated_info_decode_varint(self_p, decoder_p, wire_type);
+    uint64_t value;
+    int i;
+
+    value = 0;
+
+    for (i = 0; i < length; i++) {
+        value |= ((uint64_t)(buf_p[i] & 0x7f) << (7 * i));
+    }
+
+    return (value);
 }
 
-void pbtools_decoder_decode_repeated_bool(
-    struct pbtools_decoder_t *self_p,
-    struct pbtools_repeated_info_t *repeated_info_p,
-    struct pbtools_repeated_bool_t *repeated_p)
+/* Returns true if given mask has at least 10 consecutive continuation
+   bits, that is, a varint overflow. */
+static bool has_varint_overflow(uint64_t mask)
 {
-    decoder_decode_repeated(self_p,
-                            repeated_info_p,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(bool),
-                            (decoder_read_repeated_t)read_repeated_bool);
+    int i;
+
+    for (i = 0; i < 9; i++) {
+        mask &= (mask >> 1);
+    }
+
+    return (mask != 0);
 }
 
-int pbtools_alloc_repeated_string(struct pbtools_message_base_t *self_p,
-                                  int length,
-                                  struct pbtools_repeated_string_t *repeated_p)
+/* Count varints in the tail not covered by full chunks. Returns -1 if
+   the slice is malformed, to let the scalar decoder find the error. */
+static int packed_varints_count_tail(const uint8_t *buf_p,
+                                     int size,
+                                     int pos,
+                                     int count)
 {
-    int pos;
+    int run;
 
-    repeated_p->items_pp = heap_alloc(self_p->heap_p,
-                                      sizeof(*repeated_p->items_pp) * (size_t)length,
-                                      alignof(uint64_t));
+    run = 0;
 
-    if (repeated_p->items_pp == NULL) {
-        return (-1);
+    while ((run < pos) && (buf_p[pos - run - 1] & 0x80)) {
+        run++;
     }
 
-    for (pos = 0; pos < length; pos++) {
-        repeated_p->items_pp[pos] = "";
+    for (; pos < size; pos++) {
+        if (buf_p[pos] & 0x80) {
+            run++;
+
+            if (run == 10) {
+                return (-1);
+            }
+        } else {
+            count++;
+            run = 0;
+        }
     }
 
-    repeated_p->length = length;
+    if (run > 0) {
+        return (-1);
+    }
 
-    return (0);
+    return (count);
 }
 
-void pbtools_repeated_info_decode_string(struct pbtools_repeated_info_t *self_p,
+/* Decode all varints ending in a chunk of given width, where mask has
+   one bit set per continuation byte. Returns number of decoded
+   values, or -1 on overflow. */
+static int packed_varints_decode_chunk(const uint8_t *buf_p,
+                                       uint32_t mask,
+                                       int width,
+                                       int *pos_p,
+                                       uint64_t *values_p)
+{
+    uint32_t ends;
+    int start;
+    int end;
+    int length;
+    int count;
+
+    ends = ~mask;
+
+    if (width < 32) {
+        ends &= ((1u << width) - 1);
+    }
+
+    if (ends == 0) {
+        return (-1);
+    }
+
+    start = 0;
+    count = 0;
+
+    while (ends != 0) {
+        end = __builtin_ctz(ends);
+        length = (end - start + 1);
+
+        if (length <= 8) {
+            values_p[count] = varint_compact(&buf_p[start], length);
+        } else if (length <= 10) {
+            values_p[count] = varint_decode_long(&buf_p[start], length);
+        } else {
+            return (-1);
+        }
+
+        count++;
+        start = (end + 1);
+        ends &= (ends - 1);
+    }
+
+    *pos_p += start;
+
+    return (count);
+}
+
+__attribute__((target("sse4.1")))
+static int packed_varints_count_sse4_1(const uint8_t *buf_p, int size)
+{
+    uint64_t masks;
+    uint32_t mask;
+    int count;
+    int pos;
+
+    masks = 0;
+    count = 0;
+
+    for (pos = 0; (size - pos) >= 16; pos += 16) {
+        mask = (uint32_t)_mm_movemask_epi8(
+            _mm_loadu_si128((const __m128i *)&buf_p[pos]));
+        masks = ((masks >> 16) | ((uint64_t)mask << 16));
+
+        if (has_varint_overflow(masks)) {
+            return (-1);
+        }
+
+        count += (16 - __builtin_popcount(mask));
+    }
+
+    return (packed_varints_count_tail(buf_p, size, pos, count));
+}
+
+/* Both vector loads and compacting varints read up to 8 bytes after
+   the chunk, so keep that much away from the end. */
+__attribute__((target("sse4.1")))
+static int packed_varints_decode_sse4_1(const uint8_t *buf_p,
+                                        int size,
+                                        int *pos_p,
+                                        uint64_t *values_p)
+{
+    __m128i chunk;
+    uint32_t mask;
+    int length;
+    int res;
+    int i;
+
+    length = 0;
+
+    while (((size - *pos_p) >= 24)
+           && (length <= (PACKED_VARINTS_BLOCK_SIZE - 16))) {
+        chunk = _mm_loadu_si128((const __m128i *)&buf_p[*pos_p]);
+        mask = (uint32_t)_mm_movemask_epi8(chunk);
+
+        if (mask == 0) {
+            /* 16 one byte varints. */
+            for (i = 0; i < 16; i += 2) {
+                _mm_storeu_si128((__m128i *)&values_p[length + i],
+                                 _mm_cvtepu8_epi64(chunk));
+                chunk = _mm_srli_si128(chunk, 2);
+            }
+
+            *pos_p += 16;
+            res = 16;
+        } else {
+            res = packed_varints_decode_chunk(&buf_p[*pos_p],
+                                              mask,
+                                              16,
+                                              pos_p,
+                                              &values_p[length]);
+
+            if (res < 0) {
+                return (res);
+            }
+        }
+
+        length += res;
+    }
+
+    return (length);
+}
+
+__attribute__((target("avx2")))
+static int packed_varints_count_avx2(const uint8_t *buf_p, int size)
+{
+    uint64_t masks;
+    uint32_t mask;
+    int count;
+    int pos;
+
+    masks = 0;
+    count = 0;
+
+    for (pos = 0; (size - pos) >= 32; pos += 32) {
+        mask = (uint32_t)_mm256_movemask_epi8(
+            _mm256_loadu_si256((const __m256i *)&buf_p[pos]));
+        masks = ((masks >> 32) | ((uint64_t)mask << 32));
+
+        if (has_varint_overflow(masks)) {
+            return (-1);
+        }
+
+        count += (32 - __builtin_popcount(mask));
+    }
+
+    return (packed_varints_count_tail(buf_p, size, pos, count));
+}
+
+__attribute__((target("avx2")))
+static int packed_varints_decode_avx2(const uint8_t *buf_p,
+                                      int size,
+                                      int *pos_p,
+                                      uint64_t *values_p)
+{
+    __m256i chunk;
+    __m128i half;
+    uint32_t mask;
+    int length;
+    int res;
+    int i;
+
+    length = 0;
+
+    while (((size - *pos_p) >= 40)
+           && (length <= (PACKED_VARINTS_BLOCK_SIZE - 32))) {
+        chunk = _mm256_loadu_si256((const __m256i *)&buf_p[*pos_p]);
+        mask = (uint32_t)_mm256_movemask_epi8(chunk);
+
+        if (mask == 0) {
+            /* 32 one byte varints. */
+            half = _mm256_castsi256_si128(chunk);
+
+            for (i = 0; i < 16; i += 4) {
+                _mm256_storeu_si256((__m256i *)&values_p[length + i],
+                                    _mm256_cvtepu8_epi64(half));
+                half = _mm_srli_si128(half, 4);
+            }
+
+            half = _mm256_extracti128_si256(chunk, 1);
+
+            for (i = 16; i < 32; i += 4) {
+                _mm256_storeu_si256((__m256i *)&values_p[length + i],
+                                    _mm256_cvtepu8_epi64(half));
+                half = _mm_srli_si128(half, 4);
+            }
+
+            *pos_p += 32;
+            res = 32;
+        } else {
+            res = packed_varints_decode_chunk(&buf_p[*pos_p],
+                                              mask,
+                                              32,
+                                              pos_p,
+                                              &values_p[length]);
+
+            if (res < 0) {
+                return (res);
+            }
+        }
+
+        length += res;
+    }
+
+    return (length);
+}
+
+/* The best supported instruction set is selected once when the
+   library is loaded, before any thread can decode, so the selection
+   is never written while it is read. */
+__attribute__((constructor))
+static void simd_select_default(void)
+{
+    (void)pbtools_simd_select(PBTOOLS_SIMD_AVX2);
+}
+
+/* Count varints in given packed slice. Returns -1 if it could not be
+   done quickly. */
+static int decoder_count_packed_varints(struct pbtools_decoder_t *self_p)
+{
+    if (packed_varints_count == NULL) {
+        return (-1);
+    }
+
+    return (packed_varints_count(&self_p->buf_p[self_p->pos],
+                                 decoder_left(self_p)));
+}
+
+/* Decode as many varints as possible in blocks, leaving the tail to
+   the scalar item reader. */
+static int decoder_read_packed_varints(struct pbtools_decoder_t *self_p,
+                                       void *items_p,
+                                       packed_varints_store_t store)
+{
+    uint64_t values[PACKED_VARINTS_BLOCK_SIZE];
+    int index;
+    int length;
+
+    if (packed_varints_decode == NULL) {
+        return (0);
+    }
+
+    index = 0;
+
+    while (true) {
+        length = packed_varints_decode(self_p->buf_p,
+                                       self_p->size,
+                                       &self_p->pos,
+                                       &values[0]);
+
+        if (length <= 0) {
+            break;
+        }
+
+        store(items_p, index, &values[0], length);
+        index += length;
+    }
+
+    if (length < 0) {
+        decoder_abort(self_p, PBTOOLS_VARINT_OVERFLOW);
+    }
+
+    return (index);
+}
+
+#endif
+
+/* Validate UTF-8 one byte sequence at a time, skipping eight ASCII
+   bytes at a time. */
+static bool utf8_is_valid_scalar(const uint8_t *buf_p, size_t size)
+{
+    uint64_t word;
+    uint32_t code_point;
+    uint32_t minimum;
+    size_t length;
+    size_t i;
+    size_t j;
+
+    i = 0;
+
+    while (i < size) {
+        if ((size - i) >= 8) {
+            memcpy(&word, &buf_p[i], sizeof(word));
+
+            if ((word & 0x8080808080808080ull) == 0) {
+                i += 8;
+                continue;
+            }
+        }
+
+        code_point = buf_p[i];
+
+        if (code_point < 0x80) {
+            i++;
+            continue;
+        } else if ((code_point & 0xe0) == 0xc0) {
+            length = 2;
+            minimum = 0x80;
+            code_point &= 0x1f;
+        } else if ((code_point & 0xf0) == 0xe0) {
+            length = 3;
+            minimum = 0x800;
+            code_point &= 0x0f;
+        } else if ((code_point & 0xf8) == 0xf0) {
+            length = 4;
+            minimum = 0x10000;
+            code_point &= 0x07;
+        } else {
+            return (false);
+        }
+
+        if ((size - i) < length) {
+            return (false);
+        }
+
+        for (j = 1; j < length; j++) {
+            if ((buf_p[i + j] & 0xc0) != 0x80) {
+                return (false);
+            }
+
+            code_point = ((code_point << 6) | (buf_p[i + j] & 0x3fu));
+        }
+
+        if ((code_point < minimum)
+            || (code_point > 0x10ffff)
+            || ((code_point >= 0xd800) && (code_point <= 0xdfff))) {
+            return (false);
+        }
+
+        i += length;
+    }
+
+    return (true);
+}
+
+#if PBTOOLS_CONFIG_SIMD == 1
+
+typedef bool (*utf8_is_valid_t)(const uint8_t *buf_p, size_t size);
+
+static utf8_is_valid_t utf8_is_valid_simd;
+
+/* Error bits of the UTF-8 lookup tables below. Each table is indexed
+   by a nibble of the first or second byte of every byte pair, and an
+   error is found if the bits of all three lookups intersect. See
+   "Validating UTF-8 In Less Than One Instruction Per Byte" by John
+   Keiser and Daniel Lemire. */
+#define UTF8_TOO_SHORT                                       0x01
+#define UTF8_TOO_LONG                                        0x02
+#define UTF8_OVERLONG_3                                      0x04
+#define UTF8_TOO_LARGE                                       0x08
+#define UTF8_SURROGATE                                       0x10
+#define UTF8_OVERLONG_2                                      0x20
+#define UTF8_TOO_LARGE_1000                                  0x40
+#define UTF8_OVERLONG_4                                      0x40
+#define UTF8_TWO_CONTS                                       0x80
+#define UTF8_CARRY (UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS)
+
+static const uint8_t utf8_byte_1_high_table[16] = {
+    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+    UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+    UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+    UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4
+};
+
+static const uint8_t utf8_byte_1_low_table[16] = {
+    UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+    UTF8_CARRY | UTF8_OVERLONG_2,
+    UTF8_CARRY,
+    UTF8_CARRY,
+    UTF8_CARRY | UTF8_TOO_LARGE,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000
+};
+
+static const uint8_t utf8_byte_2_high_table[16] = {
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3
+    | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3
+    | UTF8_TOO_LARGE,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE
+    | UTF8_TOO_LARGE,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE
+    | UTF8_TOO_LARGE,
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT
+};
+
+/* Marks the last bytes of a block that starts a sequence that does
+   not fit in it. */
+static const uint8_t utf8_incomplete_table[16] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0 - 1, 0xe0 - 1, 0xc0 - 1
+};
+
+/* Returns error bits of given 16 bytes, preceded by the previous
+   16. */
+__attribute__((target("sse4.1")))
+static __m128i utf8_check_block_sse4_1(__m128i input,
+                                       __m128i *prev_input_p,
+                                       __m128i *prev_incomplete_p)
+{
+    const __m128i byte_1_high_table = _mm_loadu_si128(
+        (const __m128i *)&utf8_byte_1_high_table[0]);
+    const __m128i byte_1_low_table = _mm_loadu_si128(
+        (const __m128i *)&utf8_byte_1_low_table[0]);
+    const __m128i byte_2_high_table = _mm_loadu_si128(
+        (const __m128i *)&utf8_byte_2_high_table[0]);
+    const __m128i incomplete_table = _mm_loadu_si128(
+        (const __m128i *)&utf8_incomplete_table[0]);
+    const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+    __m128i prev_input;
+    __m128i prev1;
+    __m128i prev2;
+    __m128i prev3;
+    __m128i special_cases;
+    __m128i must_be_2_3_continuation;
+
+    prev_input = *prev_input_p;
+    *prev_input_p = input;
+
+    /* A sequence started in the previous block must continue in
+       this. */
+    if (_mm_movemask_epi8(input) == 0) {
+        return (*prev_incomplete_p);
+    }
+
+    *prev_incomplete_p = _mm_subs_epu8(input, incomplete_table);
+    prev1 = _mm_alignr_epi8(input, prev_input, 15);
+    special_cases = _mm_and_si128(
+        _mm_and_si128(
+            _mm_shuffle_epi8(byte_1_high_table,
+                             _mm_and_si128(_mm_srli_epi16(prev1, 4),
+                                           nibble_mask)),
+            _mm_shuffle_epi8(byte_1_low_table,
+                             _mm_and_si128(prev1, nibble_mask))),
+        _mm_shuffle_epi8(byte_2_high_table,
+                         _mm_and_si128(_mm_srli_epi16(input, 4),
+                                       nibble_mask)));
+
+    /* Third and fourth bytes of three and four byte sequences. */
+    prev2 = _mm_alignr_epi8(input, prev_input, 14);
+    prev3 = _mm_alignr_epi8(input, prev_input, 13);
+    must_be_2_3_continuation = _mm_and_si128(
+        _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8((char)(0xe0 - 0x80))),
+                     _mm_subs_epu8(prev3, _mm_set1_epi8((char)(0xf0 - 0x80)))),
+        _mm_set1_epi8((char)0x80));
+
+    return (_mm_xor_si128(must_be_2_3_continuation, special_cases));
+}
+
+__attribute__((target("sse4.1")))
+static bool utf8_is_valid_sse4_1(const uint8_t *buf_p, size_t size)
+{
+    __m128i prev_input;
+    __m128i prev_incomplete;
+    __m128i error;
+    uint8_t tail[16];
+    size_t i;
+
+    prev_input = _mm_setzero_si128();
+    prev_incomplete = _mm_setzero_si128();
+    error = _mm_setzero_si128();
+
+    for (i = 0; (size - i) >= 16; i += 16) {
+        error = _mm_or_si128(
+            error,
+            utf8_check_block_sse4_1(
+                _mm_loadu_si128((const __m128i *)&buf_p[i]),
+                &prev_input,
+                &prev_incomplete));
+    }
+
+    /* The tail is padded with zeros. */
+    if (i < size) {
+        memset(&tail[0], 0, sizeof(tail));
+        memcpy(&tail[0], &buf_p[i], size - i);
+        error = _mm_or_si128(
+            error,
+            utf8_check_block_sse4_1(
+                _mm_loadu_si128((const __m128i *)&tail[0]),
+                &prev_input,
+                &prev_incomplete));
+    }
+
+    error = _mm_or_si128(error, prev_incomplete);
+
+    return (_mm_testz_si128(error, error) == 1);
+}
+
+/* Returns error bits of given 32 bytes, preceded by the previous
+   32. */
+__attribute__((target("avx2")))
+static __m256i utf8_check_block_avx2(__m256i input,
+                                     __m256i *prev_input_p,
+                                     __m256i *prev_incomplete_p)
+{
+    const __m256i byte_1_high_table = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i *)&utf8_byte_1_high_table[0]));
+    const __m256i byte_1_low_table = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i *)&utf8_byte_1_low_table[0]));
+    const __m256i byte_2_high_table = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i *)&utf8_byte_2_high_table[0]));
+    const __m256i incomplete_table = _mm256_inserti128_si256(
+        _mm256_set1_epi8(-1),
+        _mm_loadu_si128((const __m128i *)&utf8_incomplete_table[0]),
+        1);
+    const __m256i nibble_mask = _mm256_set1_epi8(0x0f);
+    __m256i prev_input;
+    __m256i prev1;
+    __m256i prev2;
+    __m256i prev3;
+    __m256i special_cases;
+    __m256i must_be_2_3_continuation;
+
+    prev_input = *prev_input_p;
+    *prev_input_p = input;
+
+    if (_mm256_movemask_epi8(input) == 0) {
+        return (*prev_incomplete_p);
+    }
+
+    *prev_incomplete_p = _mm256_subs_epu8(input, incomplete_table);
+
+    /* Previous high lane and current low lane. */
+    prev_input = _mm256_permute2x128_si256(prev_input, input, 0x21);
+    prev1 = _mm256_alignr_epi8(input, prev_input, 15);
+    special_cases = _mm256_and_si256(
+        _mm256_and_si256(
+            _mm256_shuffle_epi8(byte_1_high_table,
+                                _mm256_and_si256(_mm256_srli_epi16(prev1, 4),
+                                                 nibble_mask)),
+            _mm256_shuffle_epi8(byte_1_low_table,
+                                _mm256_and_si256(prev1, nibble_mask))),
+        _mm256_shuffle_epi8(byte_2_high_table,
+                            _mm256_and_si256(_mm256_srli_epi16(input, 4),
+                                             nibble_mask)));
+    prev2 = _mm256_alignr_epi8(input, prev_input, 14);
+    prev3 = _mm256_alignr_epi8(input, prev_input, 13);
+    must_be_2_3_continuation = _mm256_and_si256(
+        _mm256_or_si256(
+            _mm256_subs_epu8(prev2, _mm256_set1_epi8((char)(0xe0 - 0x80))),
+            _mm256_subs_epu8(prev3, _mm256_set1_epi8((char)(0xf0 - 0x80)))),
+        _mm256_set1_epi8((char)0x80));
+
+    return (_mm256_xor_si256(must_be_2_3_continuation, special_cases));
+}
+
+__attribute__((target("avx2")))
+static bool utf8_is_valid_avx2(const uint8_t *buf_p, size_t size)
+{
+    __m256i prev_input;
+    __m256i prev_incomplete;
+    __m256i error;
+    uint8_t tail[32];
+    size_t i;
+
+    prev_input = _mm256_setzero_si256();
+    prev_incomplete = _mm256_setzero_si256();
+    error = _mm256_setzero_si256();
+
+    for (i = 0; (size - i) >= 32; i += 32) {
+        error = _mm256_or_si256(
+            error,
+            utf8_check_block_avx2(
+                _mm256_loadu_si256((const __m256i *)&buf_p[i]),
+                &prev_input,
+                &prev_incomplete));
+    }
+
+    if (i < size) {
+        memset(&tail[0], 0, sizeof(tail));
+        memcpy(&tail[0], &buf_p[i], size - i);
+        error = _mm256_or_si256(
+            error,
+            utf8_check_block_avx2(
+                _mm256_loadu_si256((const __m256i *)&tail[0]),
+                &prev_input,
+                &prev_incomplete));
+    }
+
+    error = _mm256_or_si256(error, prev_incomplete);
+
+    return (_mm256_testz_si256(error, error) == 1);
+}
+
+#endif
+
+bool pbtools_utf8_is_valid(const uint8_t *buf_p, size_t size)
+{
+#if PBTOOLS_CONFIG_SIMD == 1
+    /* Short strings are faster validated one byte at a time. */
+    if (size >= 16) {
+        if (utf8_is_valid_simd != NULL) {
+            return (utf8_is_valid_simd(buf_p, size));
+        }
+    }
+#endif
+
+    return (utf8_is_valid_scalar(buf_p, size));
+}
+
+int pbtools_simd_select(int simd_wanted)
+{
+#if PBTOOLS_CONFIG_SIMD == 1
+    __builtin_cpu_init();
+
+    if ((simd_wanted >= PBTOOLS_SIMD_AVX2)
+        && __builtin_cpu_supports("avx2")) {
+        simd = PBTOOLS_SIMD_AVX2;
+        packed_varints_count = packed_varints_count_avx2;
+        packed_varints_decode = packed_varints_decode_avx2;
+        utf8_is_valid_simd = utf8_is_valid_avx2;
+    } else if ((simd_wanted >= PBTOOLS_SIMD_SSE4_1)
+               && __builtin_cpu_supports("sse4.1")) {
+        simd = PBTOOLS_SIMD_SSE4_1;
+        packed_varints_count = packed_varints_count_sse4_1;
+        packed_varints_decode = packed_varints_decode_sse4_1;
+        utf8_is_valid_simd = utf8_is_valid_sse4_1;
+    } else {
+        simd = PBTOOLS_SIMD_NONE;
+        packed_varints_count = NULL;
+        packed_varints_decode = NULL;
+        utf8_is_valid_simd = NULL;
+    }
+
+    return (simd);
+#else
+    (void)simd_wanted;
+
+    return (PBTOOLS_SIMD_NONE);
+#endif
+}
+
+static void repeated_info_decode_varint(struct pbtools_repeated_info_t *self_p,
+                                        struct pbtools_decoder_t *decoder_p,
+                                        int wire_type)
+{
+    int size;
+    struct pbtools_decoder_t decoder;
+#if PBTOOLS_CONFIG_SIMD == 1
+    int length;
+#endif
+
+    repeated_info_init_decode(self_p, decoder_p, wire_type);
+
+    /* Accept both packed and not packed. */
+    switch (wire_type) {
+
+    case PBTOOLS_WIRE_TYPE_VARINT:
+        decoder_skip_varint(decoder_p);
+        self_p->length++;
+        break;
+
+    case PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED:
+        size = (int)decoder_read_length_delimited(decoder_p, wire_type);
+        decoder_init_slice(&decoder, decoder_p, size);
+#if PBTOOLS_CONFIG_SIMD == 1
+        length = decoder_count_packed_varints(&decoder);
+
+        if (length >= 0) {
+            self_p->length += length;
+            decoder.pos = decoder.size;
+        }
+#endif
+
+        while (pbtools_decoder_available(&decoder)) {
+            decoder_skip_varint(&decoder);
+            self_p->length++;
+        }
+
+        decoder_seek(decoder_p, decoder_get_result(&decoder));
+        break;
+
+    default:
+        decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+        break;
+    }
+
+    repeated_info_end_decode(self_p, decoder_p);
+}
+
+static void repeated_info_decode_32bit(struct pbtools_repeated_info_t *self_p,
+                                       struct pbtools_decoder_t *decoder_p,
+                                       int wire_type)
+{
+    int size;
+
+    repeated_info_init_decode(self_p, decoder_p, wire_type);
+
+    /* Accept both packed and not packed. */
+    switch (wire_type) {
+
+    case PBTOOLS_WIRE_TYPE_32_BIT:
+        decoder_seek(decoder_p, 4);
+        self_p->length++;
+        break;
+
+    case PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED:
+        size = (int)decoder_read_length_delimited(decoder_p, wire_type);
+        self_p->length += (size / 4);
+        decoder_seek(decoder_p, size);
+        break;
+
+    default:
+        decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+        break;
+    }
+
+    repeated_info_end_decode(self_p, decoder_p);
+}
+
+static void repeated_info_decode_64bit(struct pbtools_repeated_info_t *self_p,
+                                       struct pbtools_decoder_t *decoder_p,
+                                       int wire_type)
+{
+    int size;
+
+    repeated_info_init_decode(self_p, decoder_p, wire_type);
+
+    /* Accept both packed and not packed. */
+    switch (wire_type) {
+
+    case PBTOOLS_WIRE_TYPE_64_BIT:
+        decoder_seek(decoder_p, 8);
+        self_p->length++;
+        break;
+
+    case PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED:
+        size = (int)decoder_read_length_delimited(decoder_p, wire_type);
+        self_p->length += (size / 8);
+        decoder_seek(decoder_p, size);
+        break;
+
+    default:
+        decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+        break;
+    }
+
+    repeated_info_end_decode(self_p, decoder_p);
+}
+
+static void repeated_info_decode_length_delimited(
+    struct pbtools_repeated_info_t *self_p,
+    struct pbtools_decoder_t *decoder_p,
+    int wire_type)
+{
+    int size;
+
+    repeated_info_init_decode(self_p, decoder_p, wire_type);
+    size = (int)decoder_read_length_delimited(decoder_p, wire_type);
+    decoder_seek(decoder_p, size);
+    self_p->length++;
+    repeated_info_end_decode(self_p, decoder_p);
+}
+
+/* Read a packed slice of varints, or one not packed varint. The
+   values are stored in blocks by given type specific function. */
+static int decoder_read_repeated_varint(struct pbtools_decoder_t *self_p,
+                                        int wire_type,
+                                        void *items_p,
+                                        packed_varints_store_t store)
+{
+    uint64_t values[PACKED_VARINTS_BLOCK_SIZE];
+    int size;
+    struct pbtools_decoder_t decoder;
+    int index;
+    int length;
+
+    if (wire_type == PBTOOLS_WIRE_TYPE_VARINT) {
+        values[0] = decoder_read_varint(self_p);
+        store(items_p, 0, &values[0], 1);
+
+        return (1);
+    }
+
+    if (wire_type != PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED) {
+        decoder_abort(self_p, PBTOOLS_BAD_WIRE_TYPE);
+
+        return (0);
+    }
+
+    size = (int)decoder_read_length_delimited(self_p, wire_type);
+    decoder_init_slice(&decoder, self_p, size);
+#if PBTOOLS_CONFIG_SIMD == 1
+    index = decoder_read_packed_varints(&decoder, items_p, store);
+#else
+    index = 0;
+#endif
+    length = 0;
+
+    while (pbtools_decoder_available(&decoder)) {
+        values[length] = decoder_read_varint(&decoder);
+        length++;
+
+        if (length == PACKED_VARINTS_BLOCK_SIZE) {
+            store(items_p, index, &values[0], length);
+            index += length;
+            length = 0;
+        }
+    }
+
+    store(items_p, index, &values[0], length);
+    index += length;
+    decoder_seek(self_p, decoder_get_result(&decoder));
+
+    return (index);
+}
+
+/* Read a fixed size value as stored in memory. Fixed size types of
+   the same size only differ in how the bits are interpreted. */
+static void decoder_read_fixed_item(struct pbtools_decoder_t *self_p,
+                                    uint8_t *item_p,
+                                    int item_size)
+{
+    uint32_t value_32;
+    uint64_t value_64;
+
+    if (item_size == 4) {
+        value_32 = decoder_read_32_bit_value(self_p);
+        memcpy(item_p, &value_32, sizeof(value_32));
+    } else {
+        value_64 = decoder_read_64_bit_value(self_p);
+        memcpy(item_p, &value_64, sizeof(value_64));
+    }
+}
+
+static int fixed_item_size(int item_wire_type)
+{
+    int item_size;
+
+    if (item_wire_type == PBTOOLS_WIRE_TYPE_32_BIT) {
+        item_size = 4;
+    } else {
+        item_size = 8;
+    }
+
+    return (item_size);
+}
+
+/* A partial item at the end of a packed fixed size slice is dropped
+   if there are no full items, and is an error otherwise. */
+static bool packed_fixed_size_is_valid(int size, int item_wire_type)
+{
+    int item_size;
+
+    item_size = fixed_item_size(item_wire_type);
+
+    return ((size < item_size) || ((size % item_size) == 0));
+}
+
+#if PBTOOLS_CONFIG_LITTLE_ENDIAN == 1
+
+/* Read a packed slice of fixed size items as a whole. */
+static int decoder_read_packed_fixed(struct pbtools_decoder_t *self_p,
+                                     void *items_p,
+                                     int item_size)
+{
+    int size;
+    int length;
+
+    size = (int)decoder_read_length_delimited(self_p,
+                                              PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+    if (self_p->pos < 0) {
+        return (0);
+    }
+
+    if (size > decoder_left(self_p)) {
+        decoder_abort(self_p, PBTOOLS_OUT_OF_DATA);
+
+        return (0);
+    }
+
+    length = (size / item_size);
+    memcpy(items_p, &self_p->buf_p[self_p->pos], (size_t)(length * item_size));
+    self_p->pos += size;
+
+    /* A partial item at the end, which is dropped if there are no
+       full items. */
+    if ((length > 0) && ((size % item_size) != 0)) {
+        decoder_abort(self_p, PBTOOLS_OUT_OF_DATA);
+    }
+
+    return (length);
+}
+
+#else
+
+static int decoder_read_packed_fixed(struct pbtools_decoder_t *self_p,
+                                     void *items_p,
+                                     int item_size)
+{
+    int size;
+    struct pbtools_decoder_t decoder;
+    int index;
+
+    size = (int)decoder_read_length_delimited(self_p,
+                                              PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+    /* A partial item without full items is dropped. */
+    if (size < item_size) {
+        decoder_seek(self_p, size);
+
+        return (0);
+    }
+
+    decoder_init_slice(&decoder, self_p, size);
+    index = 0;
+
+    while (pbtools_decoder_available(&decoder)) {
+        decoder_read_fixed_item(&decoder,
+                                (uint8_t *)items_p + index * item_size,
+                                item_size);
+        index++;
+    }
+
+    decoder_seek(self_p, decoder_get_result(&decoder));
+
+    return (index);
+}
+
+#endif
+
+/* Read a packed slice of fixed size values, or one not packed
+   value. */
+static int decoder_read_repeated_fixed(struct pbtools_decoder_t *self_p,
+                                       int wire_type,
+                                       void *items_p,
+                                       int item_wire_type,
+                                       int item_size)
+{
+    if (wire_type == item_wire_type) {
+        decoder_read_fixed_item(self_p, items_p, item_size);
+
+        return (1);
+    } else if (wire_type == PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED) {
+        return (decoder_read_packed_fixed(self_p, items_p, item_size));
+    } else {
+        decoder_abort(self_p, PBTOOLS_BAD_WIRE_TYPE);
+
+        return (0);
+    }
+}
+
+
+static int calloc_repeated(struct pbtools_message_base_t *self_p,
+                           int length,
+                           struct pbtools_repeated_message_t *repeated_p,
+                           size_t item_size)
+{
+    size_t size;
+
+    size = (item_size * (size_t)length);
+    repeated_p->items_p = heap_alloc(self_p->heap_p, size, alignof(uint64_t));
+
+    if (repeated_p->items_p == NULL) {
+        return (-1);
+    }
+
+    memset(repeated_p->items_p, 0, size);
+    repeated_p->length = length;
+
+    return (0);
+}
+
+static int alloc_repeated_int32(struct pbtools_message_base_t *self_p,
+                                int length,
+                                struct pbtools_repeated_int32_t *repeated_p)
+{
+    return (calloc_repeated(self_p,
+                            length,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            sizeof(*repeated_p->items_p)));
+}
+
+static int alloc_repeated_uint32(struct pbtools_message_base_t *self_p,
+                                 int length,
+                                 struct pbtools_repeated_uint32_t *repeated_p)
+{
+    return (calloc_repeated(self_p,
+                            length,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            sizeof(*repeated_p->items_p)));
+}
+
+static int alloc_repeated_int64(struct pbtools_message_base_t *self_p,
+                                int length,
+                                struct pbtools_repeated_int64_t *repeated_p)
+{
+    return (calloc_repeated(self_p,
+                            length,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            sizeof(*repeated_p->items_p)));
+}
+
+static int alloc_repeated_uint64(struct pbtools_message_base_t *self_p,
+                                 int length,
+                                 struct pbtools_repeated_uint64_t *repeated_p)
+{
+    return (calloc_repeated(self_p,
+                            length,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            sizeof(*repeated_p->items_p)));
+}
+
+static bool are_more_items_to_decode(struct pbtools_repeated_info_t *repeated_info_p,
+                                     int pos)
+{
+    return (pbtools_decoder_available(&repeated_info_p->decoder)
+            && (pos < repeated_info_p->length));
+}
+
+/* How to read items of a repeated field. */
+struct repeated_type_t {
+    int kind;
+    size_t item_size;
+    packed_varints_store_t store;
+};
+
+#define REPEATED_KIND_VARINT                                    0
+#define REPEATED_KIND_32_BIT                                    1
+#define REPEATED_KIND_64_BIT                                    2
+#define REPEATED_KIND_STRING                                    3
+#define REPEATED_KIND_BYTES                                     4
+#define REPEATED_KIND_BYTES_VIEW                                5
+
+/* Read one item, or a packed slice of items, at given index. Returns
+   the number of read items. */
+static int decoder_read_repeated_items(struct pbtools_decoder_t *self_p,
+                                       int wire_type,
+                                       void *items_p,
+                                       int index,
+                                       const struct repeated_type_t *type_p)
+{
+    void *item_p;
+
+    item_p = ((char *)items_p + (size_t)index * type_p->item_size);
+
+    switch (type_p->kind) {
+
+    case REPEATED_KIND_VARINT:
+        return (decoder_read_repeated_varint(self_p,
+                                             wire_type,
+                                             item_p,
+                                             type_p->store));
+
+    case REPEATED_KIND_32_BIT:
+        return (decoder_read_repeated_fixed(self_p,
+                                            wire_type,
+                                            item_p,
+                                            PBTOOLS_WIRE_TYPE_32_BIT,
+                                            4));
+
+    case REPEATED_KIND_64_BIT:
+        return (decoder_read_repeated_fixed(self_p,
+                                            wire_type,
+                                            item_p,
+                                            PBTOOLS_WIRE_TYPE_64_BIT,
+                                            8));
+
+    case REPEATED_KIND_STRING:
+        decoder_read_string(self_p, wire_type, item_p);
+        break;
+
+    case REPEATED_KIND_BYTES:
+        decoder_read_bytes(self_p, wire_type, item_p);
+        break;
+
+    default:
+        decoder_read_bytes_view(self_p, wire_type, item_p);
+        break;
+    }
+
+    return (1);
+}
+
+
+/* Read items of given repeated field until the end of its decoder. */
+static int decoder_read_repeated_tagged(
+    struct pbtools_repeated_info_t *repeated_info_p,
+    void *items_p,
+    int index,
+    const struct repeated_type_t *type_p)
+{
+    int wire_type;
+    int tag;
+
+    while (are_more_items_to_decode(repeated_info_p, index)) {
+        tag = pbtools_decoder_read_tag(&repeated_info_p->decoder, &wire_type);
+
+        if (tag == repeated_info_p->tag) {
+            index += decoder_read_repeated_items(&repeated_info_p->decoder,
+                                                 wire_type,
+                                                 items_p,
+                                                 index,
+                                                 type_p);
+        } else {
+            pbtools_decoder_skip_field(&repeated_info_p->decoder, wire_type);
+        }
+    }
+
+    return (index);
+}
+
+/* Abort if given repeated field has more items than allowed, before
+   they are allocated. */
+static bool decoder_is_repeated_too_long(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_repeated_info_t *repeated_info_p)
+{
+    if (repeated_info_p->length > self_p->heap_p->max_repeated_length) {
+        decoder_abort(self_p, PBTOOLS_REPEATED_FIELD_TOO_LONG);
+
+        return (true);
+    }
+
+    return (false);
+}
+
+static struct pbtools_repeated_storage_t *heap_find_storage(
+    struct pbtools_heap_t *self_p,
+    struct pbtools_repeated_message_t *repeated_p)
+{
+    struct pbtools_repeated_storage_t *storage_p;
+
+    storage_p = self_p->storages_p;
+
+    while (storage_p != NULL) {
+        if (storage_p->repeated_p == repeated_p) {
+            break;
+        }
+
+        storage_p = storage_p->next_p;
+    }
+
+    return (storage_p);
+}
+
+static void decoder_decode_repeated(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct pbtools_repeated_message_t *repeated_p,
+    const struct repeated_type_t *type_p)
+{
+    int res;
+    int index;
+    struct pbtools_repeated_run_t *run_p;
+    struct pbtools_repeated_storage_t *storage_p;
+
+    if ((repeated_info_p->length == 0)
+        || decoder_is_repeated_too_long(self_p, repeated_info_p)) {
+        return;
+    }
+
+    storage_p = heap_find_storage(self_p->heap_p, repeated_p);
+
+    if (storage_p != NULL) {
+        if (repeated_info_p->length > storage_p->capacity) {
+            decoder_abort(self_p, PBTOOLS_STORAGE_OVERFLOW);
+
+            return;
+        }
+
+        repeated_p->items_p = storage_p->items_p;
+    } else {
+        repeated_p->items_p = decoder_heap_alloc(
+            self_p,
+            type_p->item_size * (size_t)repeated_info_p->length,
+            alignof(uint64_t));
+
+        if (repeated_p->items_p == NULL) {
+            return;
+        }
+    }
+
+    repeated_p->length = repeated_info_p->length;
+    run_p = &repeated_info_p->run;
+    index = 0;
+
+    while (repeated_info_seek_run(repeated_info_p, &run_p)
+           && (index < repeated_info_p->length)) {
+        index += decoder_read_repeated_items(&repeated_info_p->decoder,
+                                             repeated_info_p->wire_type,
+                                             repeated_p->items_p,
+                                             index,
+                                             type_p);
+        index = decoder_read_repeated_tagged(repeated_info_p,
+                                             repeated_p->items_p,
+                                             index,
+                                             type_p);
+    }
+
+    /* Scan the rest of the message if runs were freed. */
+    (void)decoder_read_repeated_tagged(repeated_info_p,
+                                       repeated_p->items_p,
+                                       index,
+                                       type_p);
+
+    res = decoder_get_result(&repeated_info_p->decoder);
+
+    if (res < 0) {
+        decoder_abort(self_p, -res);
+    }
+}
+
+static void store_packed_int32s(int32_t *items_p,
+                                int index,
+                                const uint64_t *values_p,
+                                int length)
+{
+    int i;
+
+    for (i = 0; i < length; i++) {
+        items_p[index + i] = (int32_t)(int64_t)values_p[i];
+    }
+}
+
+static void store_packed_int64s(int64_t *items_p,
+                                int index,
+                                const uint64_t *values_p,
+                                int length)
+{
+    int i;
+
+    for (i = 0; i < length; i++) {
+        items_p[index + i] = (int64_t)values_p[i];
+    }
+}
+
+static void store_packed_sint32s(int32_t *items_p,
+                                 int index,
+                                 const uint64_t *values_p,
+                                 int length)
+{
+    int i;
+
+    for (i = 0; i < length; i++) {
+        items_p[index + i] = sint32_decode(values_p[i]);
+    }
+}
+
+static void store_packed_sint64s(int64_t *items_p,
+                                 int index,
+                                 const uint64_t *values_p,
+                                 int length)
+{
+    int i;
+
+    for (i = 0; i < length; i++) {
+        items_p[index + i] = sint64_decode(values_p[i]);
+    }
+}
+
+static void store_packed_uint32s(uint32_t *items_p,
+                                 int index,
+                                 const uint64_t *values_p,
+                                 int length)
+{
+    int i;
+
+    for (i = 0; i < length; i++) {
+        items_p[index + i] = (uint32_t)values_p[i];
+    }
+}
+
+static void store_packed_uint64s(uint64_t *items_p,
+                                 int index,
+                                 const uint64_t *values_p,
+                                 int length)
+{
+    memcpy(&items_p[index], values_p, sizeof(*values_p) * (size_t)length);
+}
+
+static void store_packed_bools(bool *items_p,
+                               int index,
+                               const uint64_t *values_p,
+                               int length)
+{
+    int i;
+
+    for (i = 0; i < length; i++) {
+        items_p[index + i] = (values_p[i] != 0);
+    }
+}
+
+static const struct repeated_type_t repeated_int32_type = {
+    REPEATED_KIND_VARINT,
+    sizeof(int32_t),
+    (packed_varints_store_t)store_packed_int32s
+};
+
+static const struct repeated_type_t repeated_int64_type = {
+    REPEATED_KIND_VARINT,
+    sizeof(int64_t),
+    (packed_varints_store_t)store_packed_int64s
+};
+
+static const struct repeated_type_t repeated_uint32_type = {
+    REPEATED_KIND_VARINT,
+    sizeof(uint32_t),
+    (packed_varints_store_t)store_packed_uint32s
+};
+
+static const struct repeated_type_t repeated_uint64_type = {
+    REPEATED_KIND_VARINT,
+    sizeof(uint64_t),
+    (packed_varints_store_t)store_packed_uint64s
+};
+
+static const struct repeated_type_t repeated_sint32_type = {
+    REPEATED_KIND_VARINT,
+    sizeof(int32_t),
+    (packed_varints_store_t)store_packed_sint32s
+};
+
+static const struct repeated_type_t repeated_sint64_type = {
+    REPEATED_KIND_VARINT,
+    sizeof(int64_t),
+    (packed_varints_store_t)store_packed_sint64s
+};
+
+static const struct repeated_type_t repeated_bool_type = {
+    REPEATED_KIND_VARINT,
+    sizeof(bool),
+    (packed_varints_store_t)store_packed_bools
+};
+
+static const struct repeated_type_t repeated_32_bit_type = {
+    REPEATED_KIND_32_BIT,
+    4,
+    NULL
+};
+
+static const struct repeated_type_t repeated_64_bit_type = {
+    REPEATED_KIND_64_BIT,
+    8,
+    NULL
+};
+
+static const struct repeated_type_t repeated_string_type = {
+    REPEATED_KIND_STRING,
+    sizeof(char *),
+    NULL
+};
+
+static const struct repeated_type_t repeated_bytes_type = {
+    REPEATED_KIND_BYTES,
+    sizeof(struct pbtools_bytes_t),
+    NULL
+};
+
+static const struct repeated_type_t repeated_bytes_view_type = {
+    REPEATED_KIND_BYTES_VIEW,
+    sizeof(struct pbtools_bytes_t),
+    NULL
+};
+
+
+int pbtools_alloc_repeated_int32(struct pbtools_message_base_t *self_p,
+                                 int length,
+                                 struct pbtools_repeated_int32_t *repeated_p)
+{
+    return (alloc_repeated_int32(self_p, length, repeated_p));
+}
+
+void pbtools_repeated_info_decode_int32(struct pbtools_repeated_info_t *self_p,
+                                        struct pbtools_decoder_t *decoder_p,
+                                        int wire_type)
+{
+    repeated_info_decode_varint(self_p, decoder_p, wire_type);
+}
+
+void pbtools_decoder_decode_repeated_int32(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct pbtools_repeated_int32_t *repeated_p)
+{
+    decoder_decode_repeated(self_p,
+                            repeated_info_p,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            &repeated_int32_type);
+}
+
+int pbtools_alloc_repeated_int64(struct pbtools_message_base_t *self_p,
+                                 int length,
+                                 struct pbtools_repeated_int64_t *repeated_p)
+{
+    return (alloc_repeated_int64(self_p, length, repeated_p));
+}
+
+void pbtools_repeated_info_decode_int64(struct pbtools_repeated_info_t *self_p,
+                                        struct pbtools_decoder_t *decoder_p,
+                                        int wire_type)
+{
+    repeated_info_decode_varint(self_p, decoder_p, wire_type);
+}
+
+void pbtools_decoder_decode_repeated_int64(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct pbtools_repeated_int64_t *repeated_p)
+{
+    decoder_decode_repeated(self_p,
+                            repeated_info_p,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            &repeated_int64_type);
+}
+
+int pbtools_alloc_repeated_uint32(struct pbtools_message_base_t *self_p,
+                                  int length,
+                                  struct pbtools_repeated_uint32_t *repeated_p)
+{
+    return (alloc_repeated_uint32(self_p, length, repeated_p));
+}
+
+void pbtools_repeated_info_decode_uint32(struct pbtools_repeated_info_t *self_p,
+                                         struct pbtools_decoder_t *decoder_p,
+                                         int wire_type)
+{
+    repeated_info_decode_varint(self_p, decoder_p, wire_type);
+}
+
+void pbtools_decoder_decode_repeated_uint32(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct pbtools_repeated_uint32_t *repeated_p)
+{
+    decoder_decode_repeated(self_p,
+                            repeated_info_p,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            &repeated_uint32_type);
+}
+
+int pbtools_alloc_repeated_uint64(struct pbtools_message_base_t *self_p,
+                                  int length,
+                                  struct pbtools_repeated_uint64_t *repeated_p)
+{
+    return (alloc_repeated_uint64(self_p, length, repeated_p));
+}
+
+void pbtools_repeated_info_decode_uint64(struct pbtools_repeated_info_t *self_p,
+                                         struct pbtools_decoder_t *decoder_p,
+                                         int wire_type)
+{
+    repeated_info_decode_varint(self_p, decoder_p, wire_type);
+}
+
+void pbtools_decoder_decode_repeated_uint64(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct pbtools_repeated_uint64_t *repeated_p)
+{
+    decoder_decode_repeated(self_p,
+                            repeated_info_p,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            &repeated_uint64_type);
+}
+
+int pbtools_alloc_repeated_sint32(struct pbtools_message_base_t *self_p,
+                                  int length,
+                                  struct pbtools_repeated_int32_t *repeated_p)
+{
+    return (alloc_repeated_int32(self_p, length, repeated_p));
+}
+
+void pbtools_repeated_info_decode_sint32(struct pbtools_repeated_info_t *self_p,
+                                         struct pbtools_decoder_t *decoder_p,
+                                         int wire_type)
+{
+    repeated_info_decode_varint(self_p, decoder_p, wire_type);
+}
+
+void pbtools_decoder_decode_repeated_sint32(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct pbtools_repeated_int32_t *repeated_p)
+{
+    decoder_decode_repeated(self_p,
+                            repeated_info_p,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            &repeated_sint32_type);
+}
+
+int pbtools_alloc_repeated_sint64(struct pbtools_message_base_t *self_p,
+                                  int length,
+                                  struct pbtools_repeated_int64_t *repeated_p)
+{
+    return (alloc_repeated_int64(self_p, length, repeated_p));
+}
+
+void pbtools_repeated_info_decode_sint64(struct pbtools_repeated_info_t *self_p,
+                                         struct pbtools_decoder_t *decoder_p,
+                                         int wire_type)
+{
+    repeated_info_decode_varint(self_p, decoder_p, wire_type);
+}
+
+void pbtools_decoder_decode_repeated_sint64(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct pbtools_repeated_int64_t *repeated_p)
+{
+    decoder_decode_repeated(self_p,
+                            repeated_info_p,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            &repeated_sint64_type);
+}
+
+int pbtools_alloc_repeated_fixed32(struct pbtools_message_base_t *self_p,
+                                   int length,
+                                   struct pbtools_repeated_uint32_t *repeated_p)
+{
+    return (alloc_repeated_uint32(self_p, length, repeated_p));
+}
+
+void pbtools_repeated_info_decode_fixed32(struct pbtools_repeated_info_t *self_p,
+                                          struct pbtools_decoder_t *decoder_p,
+                                          int wire_type)
+{
+    repeated_info_decode_32bit(self_p, decoder_p, wire_type);
+}
+
+void pbtools_decoder_decode_repeated_fixed32(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct pbtools_repeated_uint32_t *repeated_p)
+{
+    decoder_decode_repeated(self_p,
+                            repeated_info_p,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            &repeated_32_bit_type);
+}
+
+int pbtools_alloc_repeated_fixed64(struct pbtools_message_base_t *self_p,
+                                   int length,
+                                   struct pbtools_repeated_uint64_t *repeated_p)
+{
+    return (alloc_repeated_uint64(self_p, length, repeated_p));
+}
+
+void pbtools_repeated_info_decode_fixed64(struct pbtools_repeated_info_t *self_p,
+                                          struct pbtools_decoder_t *decoder_p,
+                                          int wire_type)
+{
+    repeated_info_decode_64bit(self_p, decoder_p, wire_type);
+}
+
+void pbtools_decoder_decode_repeated_fixed64(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct pbtools_repeated_uint64_t *repeated_p)
+{
+    decoder_decode_repeated(self_p,
+                            repeated_info_p,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            &repeated_64_bit_type);
+}
+
+int pbtools_alloc_repeated_sfixed32(struct pbtools_message_base_t *self_p,
+                                    int length,
+                                    struct pbtools_repeated_int32_t *repeated_p)
+{
+    return (alloc_repeated_int32(self_p, length, repeated_p));
+}
+
+void pbtools_repeated_info_decode_sfixed32(struct pbtools_repeated_info_t *self_p,
+                                           struct pbtools_decoder_t *decoder_p,
+                                           int wire_type)
+{
+    repeated_info_decode_32bit(self_p, decoder_p, wire_type);
+}
+
+void pbtools_decoder_decode_repeated_sfixed32(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct pbtools_repeated_int32_t *repeated_p)
+{
+    decoder_decode_repeated(self_p,
+                            repeated_info_p,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            &repeated_32_bit_type);
+}
+
+int pbtools_alloc_repeated_sfixed64(struct pbtools_message_base_t *self_p,
+                                    int length,
+                                    struct pbtools_repeated_int64_t *repeated_p)
+{
+    return (alloc_repeated_int64(self_p, length, repeated_p));
+}
+
+void pbtools_repeated_info_decode_sfixed64(struct pbtools_repeated_info_t *self_p,
+                                           struct pbtools_decoder_t *decoder_p,
+                                           int wire_type)
+{
+    repeated_info_decode_64bit(self_p, decoder_p, wire_type);
+}
+
+void pbtools_decoder_decode_repeated_sfixed64(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct pbtools_repeated_int64_t *repeated_p)
+{
+    decoder_decode_repeated(self_p,
+                            repeated_info_p,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            &repeated_64_bit_type);
+}
+
+#if PBTOOLS_CONFIG_FLOAT == 1
+
+int pbtools_alloc_repeated_float(struct pbtools_message_base_t *self_p,
+                                 int length,
+                                 struct pbtools_repeated_float_t *repeated_p)
+{
+    return (calloc_repeated(self_p,
+                            length,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            sizeof(*repeated_p->items_p)));
+}
+
+void pbtools_repeated_info_decode_float(struct pbtools_repeated_info_t *self_p,
+                                        struct pbtools_decoder_t *decoder_p,
+                                        int wire_type)
+{
+    repeated_info_decode_32bit(self_p, decoder_p, wire_type);
+}
+
+void pbtools_decoder_decode_repeated_float(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct pbtools_repeated_float_t *repeated_p)
+{
+    decoder_decode_repeated(self_p,
+                            repeated_info_p,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            &repeated_32_bit_type);
+}
+
+int pbtools_alloc_repeated_double(struct pbtools_message_base_t *self_p,
+                                  int length,
+                                  struct pbtools_repeated_double_t *repeated_p)
+{
+    return (calloc_repeated(self_p,
+                            length,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            sizeof(*repeated_p->items_p)));
+}
+
+void pbtools_repeated_info_decode_double(struct pbtools_repeated_info_t *self_p,
+                                         struct pbtools_decoder_t *decoder_p,
+                                         int wire_type)
+{
+    repeated_info_decode_64bit(self_p, decoder_p, wire_type);
+}
+
+void pbtools_decoder_decode_repeated_double(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct pbtools_repeated_double_t *repeated_p)
+{
+    decoder_decode_repeated(self_p,
+                            repeated_info_p,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            &repeated_64_bit_type);
+}
+
+#endif
+
+int pbtools_alloc_repeated_bool(struct pbtools_message_base_t *self_p,
+                                int length,
+                                struct pbtools_repeated_bool_t *repeated_p)
+{
+    return (calloc_repeated(self_p,
+                            length,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            sizeof(*repeated_p->items_p)));
+}
+
+void pbtools_repeated_info_decode_bool(struct pbtools_repeated_info_t *self_p,
+                                       struct pbtools_decoder_t *decoder_p,
+                                       int wire_type)
+{
+    repeated_info_decode_varint(self_p, decoder_p, wire_type);
+}
+
+void pbtools_decoder_decode_repeated_bool(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct pbtools_repeated_bool_t *repeated_p)
+{
+    decoder_decode_repeated(self_p,
+                            repeated_info_p,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            &repeated_bool_type);
+}
+
+int pbtools_alloc_repeated_string(struct pbtools_message_base_t *self_p,
+                                  int length,
+                                  struct pbtools_repeated_string_t *repeated_p)
+{
+    int pos;
+
+    repeated_p->items_pp = heap_alloc(self_p->heap_p,
+                                      sizeof(*repeated_p->items_pp) * (size_t)length,
+                                      alignof(uint64_t));
+
+    if (repeated_p->items_pp == NULL) {
+        return (-1);
+    }
+
+    for (pos = 0; pos < length; pos++) {
+        repeated_p->items_pp[pos] = "";
+    }
+
+    repeated_p->length = length;
+
+    return (0);
+}
+
+void pbtools_repeated_info_decode_string(struct pbtools_repeated_info_t *self_p,
                                          struct pbtools_decoder_t *decoder_p,
                                          int wire_type)
 {
-    repeated_info_decode_length_delimited(self_p, decoder_p, wire_type);
+    repeated_info_decode_length_delimited(self_p, decoder_p, wire_type);
+}
+
+void pbtools_decoder_decode_repeated_string(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct pbtools_repeated_string_t *repeated_p)
+{
+    decoder_decode_repeated(self_p,
+                            repeated_info_p,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            &repeated_string_type);
+}
+
+int pbtools_alloc_repeated_bytes(struct pbtools_message_base_t *self_p,
+                                 int length,
+                                 struct pbtools_repeated_bytes_t *repeated_p)
+{
+    return (calloc_repeated(self_p,
+                            length,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            sizeof(*repeated_p->items_p)));
+}
+
+void pbtools_repeated_info_decode_bytes(struct pbtools_repeated_info_t *self_p,
+                                        struct pbtools_decoder_t *decoder_p,
+                                        int wire_type)
+{
+    repeated_info_decode_length_delimited(self_p, decoder_p, wire_type);
+}
+
+void pbtools_decoder_decode_repeated_bytes(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct pbtools_repeated_bytes_t *repeated_p)
+{
+    decoder_decode_repeated(self_p,
+                            repeated_info_p,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            &repeated_bytes_type);
+}
+
+void pbtools_decoder_decode_repeated_bytes_view(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct pbtools_repeated_bytes_t *repeated_p)
+{
+    decoder_decode_repeated(self_p,
+                            repeated_info_p,
+                            (struct pbtools_repeated_message_t *)repeated_p,
+                            &repeated_bytes_view_type);
+}
+
+static void decoder_init_slice(struct pbtools_decoder_t *self_p,
+                               struct pbtools_decoder_t *parent_p,
+                               int size)
+{
+    self_p->buf_p = &parent_p->buf_p[parent_p->pos];
+
+    if (size <= (parent_p->size - parent_p->pos)) {
+        self_p->size = size;
+        self_p->pos = 0;
+    } else {
+        self_p->size = -PBTOOLS_OUT_OF_DATA;
+        self_p->pos = -PBTOOLS_OUT_OF_DATA;
+    }
+
+    self_p->heap_p = parent_p->heap_p;
+    self_p->padded = parent_p->padded;
+}
+
+static void decoder_seek(struct pbtools_decoder_t *self_p,
+                         int offset)
+{
+    if (self_p->pos < 0) {
+        return;
+    }
+
+    if (offset < 0) {
+        decoder_abort(self_p, -offset);
+    } else if (((unsigned int)self_p->pos + (unsigned int)offset) > INT_MAX) {
+        decoder_abort(self_p, PBTOOLS_SEEK_OVERFLOW);
+    } else {
+        self_p->pos += offset;
+
+        if (self_p->pos > self_p->size) {
+            decoder_abort(self_p, PBTOOLS_OUT_OF_DATA);
+        }
+    }
+}
+
+void pbtools_decoder_skip_field(struct pbtools_decoder_t *self_p,
+                                int wire_type)
+{
+    uint64_t value;
+
+    switch (wire_type) {
+
+    case PBTOOLS_WIRE_TYPE_VARINT:
+        decoder_skip_varint(self_p);
+        break;
+
+    case PBTOOLS_WIRE_TYPE_64_BIT:
+        decoder_seek(self_p, 8);
+        break;
+
+    case PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED:
+        value = decoder_read_length_delimited(self_p, wire_type);
+        decoder_seek(self_p, (int)(int64_t)value);
+        break;
+
+    case PBTOOLS_WIRE_TYPE_32_BIT:
+        decoder_seek(self_p, 4);
+        break;
+
+    default:
+        decoder_abort(self_p, PBTOOLS_BAD_WIRE_TYPE);
+        break;
+    }
+}
+
+void pbtools_bytes_init(struct pbtools_bytes_t *self_p)
+{
+    self_p->size = 0;
+}
+
+void *pbtools_message_new(
+    void *workspace_p,
+    size_t size,
+    size_t message_size,
+    pbtools_message_init_t message_init)
+{
+    struct pbtools_message_base_t *self_p;
+    struct pbtools_heap_t *heap_p;
+
+    heap_p = heap_new(workspace_p, size);
+
+    if (heap_p == NULL) {
+        return (NULL);
+    }
+
+    self_p = heap_alloc(heap_p,
+                        message_size,
+                        alignof(struct pbtools_message_base_t));
+
+    if (self_p != NULL) {
+        message_init(self_p, heap_p);
+    }
+
+    return (self_p);
+}
+
+int pbtools_message_encode(
+    struct pbtools_message_base_t *self_p,
+    uint8_t *encoded_p,
+    size_t size,
+    pbtools_message_encode_inner_t message_encode_inner)
+{
+    struct pbtools_encoder_t encoder;
+
+    encoder_init(&encoder, encoded_p, size);
+    message_encode_inner(&encoder, self_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+/* Temporary memory allocated while decoding a message is freed when
+   done. */
+static void decoder_decode_inner(
+    struct pbtools_decoder_t *self_p,
+    void *message_p,
+    pbtools_message_decode_inner_t message_decode_inner)
+{
+    struct pbtools_heap_t *heap_p;
+    int heap_size;
+    struct pbtools_repeated_info_t *repeated_infos_p;
+
+    heap_p = self_p->heap_p;
+
+    if (heap_p->depth >= heap_p->max_depth) {
+        decoder_abort(self_p, PBTOOLS_NESTING_TOO_DEEP);
+
+        return;
+    }
+
+    heap_p->depth++;
+    heap_size = heap_p->size;
+    repeated_infos_p = heap_p->repeated_infos_p;
+    message_decode_inner(self_p, message_p);
+
+    if (heap_p->size < heap_size) {
+        heap_p->size = heap_size;
+    }
+
+    heap_p->repeated_infos_p = repeated_infos_p;
+    heap_p->depth--;
+}
+
+int pbtools_message_decode(
+    struct pbtools_message_base_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    pbtools_message_decode_inner_t message_decode_inner)
+{
+    struct pbtools_decoder_t decoder;
+
+    decoder_init(&decoder, encoded_p, size, self_p->heap_p);
+    decoder_decode_inner(&decoder, self_p, message_decode_inner);
+
+    return (decoder_get_result(&decoder));
+}
+
+int pbtools_message_decode_padded(
+    struct pbtools_message_base_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    pbtools_message_decode_inner_t message_decode_inner)
+{
+    struct pbtools_decoder_t decoder;
+
+    decoder_init(&decoder, encoded_p, size, self_p->heap_p);
+    decoder.padded = true;
+    decoder_decode_inner(&decoder, self_p, message_decode_inner);
+
+    return (decoder_get_result(&decoder));
+}
+
+int pbtools_message_decode_segments(
+    struct pbtools_message_base_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length,
+    pbtools_message_decode_inner_t message_decode_inner)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_segments_t segments;
+    int i;
+    int res;
+
+    segments.segments_p = segments_p;
+    segments.length = length;
+    segments.index = 0;
+    segments.offset = 0;
+    segments.left = 0;
+    segments.decoder_p = &decoder;
+
+    for (i = 0; i < length; i++) {
+        segments.left += segments_p[i].size;
+    }
+
+    if (segments.left > INT_MAX) {
+        return (-PBTOOLS_LENGTH_DELIMITED_OVERFLOW);
+    }
+
+    res = (int)segments.left;
+    decoder_init(&decoder, NULL, 0, self_p->heap_p);
+    self_p->heap_p->segments_p = &segments;
+    (void)segments_next_chunk(&segments, &decoder);
+    decoder_decode_inner(&decoder, self_p, message_decode_inner);
+    self_p->heap_p->segments_p = NULL;
+
+    if (decoder_get_result(&decoder) < 0) {
+        res = decoder_get_result(&decoder);
+    }
+
+    return (res);
+}
+
+int pbtools_message_decode_masked(
+    struct pbtools_message_base_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    pbtools_message_decode_inner_t message_decode_inner,
+    const struct pbtools_field_mask_t *mask_p)
+{
+    int res;
+
+    self_p->heap_p->mask_p = mask_p;
+    res = pbtools_message_decode(self_p,
+                                 encoded_p,
+                                 size,
+                                 message_decode_inner);
+    self_p->heap_p->mask_p = NULL;
+
+    return (res);
+}
+
+int pbtools_message_decode_callbacks(
+    struct pbtools_message_base_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    pbtools_message_decode_inner_t message_decode_inner,
+    const struct pbtools_repeated_callback_t *callbacks_p,
+    int number_of_callbacks,
+    void *arg_p)
+{
+    struct pbtools_decode_callbacks_t callbacks;
+    int res;
+
+    callbacks.callbacks_p = callbacks_p;
+    callbacks.length = number_of_callbacks;
+    callbacks.arg_p = arg_p;
+    self_p->heap_p->callbacks_p = &callbacks;
+    res = pbtools_message_decode(self_p,
+                                 encoded_p,
+                                 size,
+                                 message_decode_inner);
+    self_p->heap_p->callbacks_p = NULL;
+
+    return (res);
+}
+
+int pbtools_message_decode_columns(
+    struct pbtools_message_base_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    pbtools_message_decode_inner_t message_decode_inner,
+    const struct pbtools_repeated_columns_t *columns_p,
+    int number_of_columns)
+{
+    struct pbtools_decode_columns_t columns;
+    int res;
+    int i;
+
+    /* Columns of fields not in the message are empty. */
+    for (i = 0; i < number_of_columns; i++) {
+        if (columns_p[i].columns_p != NULL) {
+            *(int *)columns_p[i].columns_p = 0;
+        }
+    }
+
+    columns.columns_p = columns_p;
+    columns.length = number_of_columns;
+    self_p->heap_p->columns_p = &columns;
+    res = pbtools_message_decode(self_p,
+                                 encoded_p,
+                                 size,
+                                 message_decode_inner);
+    self_p->heap_p->columns_p = NULL;
+
+    return (res);
+}
+
+int pbtools_message_encode_columns(
+    struct pbtools_message_base_t *self_p,
+    uint8_t *encoded_p,
+    size_t size,
+    pbtools_message_encode_inner_t message_encode_inner,
+    const struct pbtools_repeated_columns_t *columns_p,
+    int number_of_columns)
+{
+    struct pbtools_encoder_t encoder;
+    int i;
+
+    encoder_init(&encoder, encoded_p, size);
+
+    /* Fields may be in any order, so rows are encoded last. */
+    for (i = number_of_columns - 1; i >= 0; i--) {
+        if (columns_p[i].columns_p != NULL) {
+            columns_p[i].encode(&encoder,
+                                columns_p[i].field_number,
+                                columns_p[i].columns_p);
+        }
+    }
+
+    message_encode_inner(&encoder, self_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+void *pbtools_decoder_alloc_column(struct pbtools_decoder_t *self_p,
+                                   int length,
+                                   size_t value_size)
+{
+    void *buf_p;
+    size_t size;
+
+    size = (value_size * (size_t)length);
+    buf_p = decoder_heap_alloc(self_p, size, alignof(uint64_t));
+
+    if (buf_p != NULL) {
+        memset(buf_p, 0, size);
+    }
+
+    return (buf_p);
+}
+
+bool pbtools_column_is_present(const uint8_t *present_p, int index)
+{
+    return (PBTOOLS_COLUMN_IS_PRESENT(present_p, index));
+}
+
+void pbtools_view_init(struct pbtools_view_t *self_p,
+                       const uint8_t *buf_p,
+                       size_t size,
+                       const struct pbtools_view_field_t *fields_p,
+                       int number_of_fields,
+                       int *offsets_p)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (int)size;
+    self_p->state = 0;
+    self_p->fields_p = fields_p;
+    self_p->number_of_fields = number_of_fields;
+    self_p->offsets_p = offsets_p;
+}
+
+/* Fields are usually found in declaration order, so the search
+   starts after the previously found field. */
+static int view_find_field(struct pbtools_view_t *self_p,
+                           int field_number,
+                           int *hint_p)
+{
+    int i;
+    int index;
+
+    index = *hint_p;
+
+    for (i = 0; i < self_p->number_of_fields; i++) {
+        if (index == self_p->number_of_fields) {
+            index = 0;
+        }
+
+        if (self_p->fields_p[index].field_number == field_number) {
+            *hint_p = (index + 1);
+
+            return (index);
+        }
+
+        index++;
+    }
+
+    return (-1);
+}
+
+/* Skip given field, with fast paths for one byte varints and
+   lengths. */
+static void view_skip_field(struct pbtools_decoder_t *decoder_p,
+                            int wire_type)
+{
+    int value;
+
+    if (decoder_p->pos < decoder_p->size) {
+        value = decoder_p->buf_p[decoder_p->pos];
+
+        if (value < 0x80) {
+            if (wire_type == PBTOOLS_WIRE_TYPE_VARINT) {
+                decoder_p->pos++;
+
+                return;
+            } else if (wire_type == PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED) {
+                decoder_seek(decoder_p, 1 + value);
+
+                return;
+            }
+        }
+    }
+
+    pbtools_decoder_skip_field(decoder_p, wire_type);
+}
+
+static void view_scan(struct pbtools_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+    const struct pbtools_view_field_t *field_p;
+    int field_number;
+    int wire_type;
+    int index;
+    int hint;
+    int pos;
+    int value;
+
+    for (index = 0; index < self_p->number_of_fields; index++) {
+        self_p->offsets_p[index] = -1;
+    }
+
+    decoder_init(&decoder, self_p->buf_p, (size_t)self_p->size, NULL);
+    hint = 0;
+
+    while (decoder.pos < decoder.size) {
+        pos = decoder.pos;
+        value = decoder.buf_p[pos];
+
+        if ((value < 0x80) && (value >= 8)) {
+            field_number = (value >> 3);
+            wire_type = (value & 0x7);
+            decoder.pos++;
+        } else {
+            field_number = pbtools_decoder_read_tag(&decoder, &wire_type);
+        }
+
+        index = view_find_field(self_p, field_number, &hint);
+
+        if (index >= 0) {
+            field_p = &self_p->fields_p[index];
+
+            if (field_p->repeated) {
+                if (self_p->offsets_p[index] == -1) {
+                    self_p->offsets_p[index] = pos;
+                }
+            } else if (wire_type == field_p->wire_type) {
+                self_p->offsets_p[index] = decoder.pos;
+            } else {
+                decoder_abort(&decoder, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+            }
+        }
+
+        view_skip_field(&decoder, wire_type);
+    }
+
+    if (decoder.pos < 0) {
+        self_p->state = decoder.pos;
+    } else {
+        self_p->state = 1;
+    }
+}
+
+int pbtools_view_get_error(struct pbtools_view_t *self_p)
+{
+    if (self_p->state == 0) {
+        view_scan(self_p);
+    }
+
+    if (self_p->state < 0) {
+        return (self_p->state);
+    }
+
+    return (0);
+}
+
+bool pbtools_view_seek(struct pbtools_view_t *self_p,
+                       int index,
+                       struct pbtools_decoder_t *decoder_p)
+{
+    if (pbtools_view_get_error(self_p) != 0) {
+        return (false);
+    }
+
+    if (self_p->offsets_p[index] == -1) {
+        return (false);
+    }
+
+    decoder_init(decoder_p, self_p->buf_p, (size_t)self_p->size, NULL);
+    decoder_p->pos = self_p->offsets_p[index];
+
+    return (true);
+}
+
+int pbtools_view_last_field(struct pbtools_view_t *self_p,
+                            int index,
+                            int number_of_fields)
+{
+    int i;
+    int last;
+
+    last = -1;
+
+    if (pbtools_view_get_error(self_p) != 0) {
+        return (last);
+    }
+
+    for (i = 0; i < number_of_fields; i++) {
+        if (self_p->offsets_p[index + i] == -1) {
+            continue;
+        }
+
+        if ((last == -1)
+            || (self_p->offsets_p[index + i] > self_p->offsets_p[index + last])) {
+            last = i;
+        }
+    }
+
+    return (last);
+}
+
+void pbtools_view_iterator_init(struct pbtools_view_iterator_t *self_p,
+                                struct pbtools_view_t *view_p,
+                                int index)
+{
+    self_p->view_p = view_p;
+    decoder_init(&self_p->decoder, view_p->buf_p, (size_t)view_p->size, NULL);
+    self_p->field_number = view_p->fields_p[index].field_number;
+    self_p->wire_type = view_p->fields_p[index].wire_type;
+    self_p->size = -1;
+
+    if (pbtools_view_get_error(view_p) != 0) {
+        decoder_abort(&self_p->decoder, -view_p->state);
+    } else if (view_p->offsets_p[index] == -1) {
+        self_p->decoder.pos = self_p->decoder.size;
+    } else {
+        self_p->decoder.pos = view_p->offsets_p[index];
+    }
+}
+
+bool pbtools_view_iterator_next(struct pbtools_view_iterator_t *self_p)
+{
+    struct pbtools_decoder_t *decoder_p;
+    int field_number;
+    int wire_type;
+    int size;
+
+    decoder_p = &self_p->decoder;
+
+    /* The decoder is limited to the packed run being iterated. */
+    if (self_p->size != -1) {
+        if (decoder_p->pos < decoder_p->size) {
+            return (true);
+        }
+
+        if (decoder_p->pos < 0) {
+            self_p->view_p->state = decoder_p->pos;
+
+            return (false);
+        }
+
+        decoder_p->size = self_p->size;
+        self_p->size = -1;
+    }
+
+    while (decoder_p->pos < decoder_p->size) {
+        field_number = pbtools_decoder_read_tag(decoder_p, &wire_type);
+
+        if (field_number == self_p->field_number) {
+            if (wire_type == self_p->wire_type) {
+                return (true);
+            }
+
+            if (wire_type != PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED) {
+                decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+            }
+
+            size = (int)decoder_read_length_delimited(decoder_p, wire_type);
+
+            if (size > (decoder_p->size - decoder_p->pos)) {
+                decoder_abort(decoder_p, PBTOOLS_OUT_OF_DATA);
+            } else if ((self_p->wire_type != PBTOOLS_WIRE_TYPE_VARINT)
+                       && (size < fixed_item_size(self_p->wire_type))) {
+                /* A partial item without full items is dropped. */
+                decoder_seek(decoder_p, size);
+            } else if (size > 0) {
+                self_p->size = decoder_p->size;
+                decoder_p->size = (decoder_p->pos + size);
+
+                return (true);
+            }
+        } else {
+            pbtools_decoder_skip_field(decoder_p, wire_type);
+        }
+    }
+
+    if (decoder_p->pos < 0) {
+        self_p->view_p->state = decoder_p->pos;
+    }
+
+    return (false);
+}
+
+int pbtools_sub_message_alloc(
+    struct pbtools_message_base_t **message_pp,
+    struct pbtools_heap_t *heap_p,
+    size_t sub_message_size,
+    pbtools_message_init_t message_init)
+{
+    struct pbtools_message_base_t *message_p;
+
+    message_p = heap_alloc(heap_p,
+                           sub_message_size,
+                           alignof(struct pbtools_message_base_t));
+
+    if (message_p == NULL) {
+        return (-1);
+    }
+
+    message_init(message_p, heap_p);
+    *message_pp = message_p;
+
+    return (0);
+}
+
+int pbtools_repeated_set_storage(
+    struct pbtools_message_base_t *self_p,
+    struct pbtools_repeated_message_t *repeated_p,
+    void *items_p,
+    int capacity)
+{
+    struct pbtools_repeated_storage_t *storage_p;
+
+    storage_p = heap_alloc(self_p->heap_p,
+                           sizeof(*storage_p),
+                           alignof(struct pbtools_repeated_storage_t));
+
+    if (storage_p == NULL) {
+        return (-1);
+    }
+
+    storage_p->repeated_p = repeated_p;
+    storage_p->items_p = items_p;
+    storage_p->capacity = capacity;
+    storage_p->next_p = self_p->heap_p->storages_p;
+    self_p->heap_p->storages_p = storage_p;
+
+    return (0);
+}
+
+int pbtools_alloc_repeated(
+    struct pbtools_repeated_message_t *repeated_p,
+    int length,
+    struct pbtools_heap_t *heap_p,
+    size_t item_size,
+    pbtools_message_init_t message_init)
+{
+    int i;
+    char *item_p;
+
+    repeated_p->items_p = heap_alloc(heap_p,
+                                     item_size * (size_t)length,
+                                     alignof(uint64_t));
+
+    if (repeated_p->items_p == NULL) {
+        return (-1);
+    }
+
+    item_p = repeated_p->items_p;
+
+    for (i = 0; i < length; i++) {
+        message_init(item_p, heap_p);
+        item_p += item_size;
+    }
+
+    repeated_p->length = length;
+
+    return (0);
+}
+
+void pbtools_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct pbtools_repeated_message_t *repeated_p,
+    size_t item_size,
+    pbtools_message_encode_inner_t message_encode_inner)
+{
+    int i;
+    int pos;
+    char *item_p;
+
+    item_p = repeated_p->items_p;
+    item_p += ((size_t)repeated_p->length * item_size);
+
+    for (i = 0; i < repeated_p->length; i++) {
+        item_p -= item_size;
+        pos = encoder_p->pos;
+        message_encode_inner(encoder_p, item_p);
+        encoder_write_length_delimited(encoder_p,
+                                       field_number,
+                                       (uint64_t)(pos - encoder_p->pos));
+    }
+}
+
+void pbtools_encoder_write_sub_message_length(
+    struct pbtools_encoder_t *self_p,
+    int field_number,
+    int pos)
+{
+    encoder_write_length_delimited(self_p,
+                                   field_number,
+                                   (uint64_t)(pos - self_p->pos));
+}
+
+static const struct pbtools_repeated_callback_t *heap_find_callback(
+    struct pbtools_heap_t *heap_p,
+    int field_number)
+{
+    const struct pbtools_repeated_callback_t *callback_p;
+    int i;
+
+    for (i = 0; i < heap_p->callbacks_p->length; i++) {
+        callback_p = &heap_p->callbacks_p->callbacks_p[i];
+
+        if (callback_p->field_number == field_number) {
+            if (callback_p->callback == NULL) {
+                break;
+            }
+
+            return (callback_p);
+        }
+    }
+
+    return (NULL);
+}
+
+static const struct pbtools_repeated_columns_t *heap_find_columns(
+    struct pbtools_heap_t *heap_p,
+    int field_number)
+{
+    const struct pbtools_repeated_columns_t *columns_p;
+    int i;
+
+    for (i = 0; i < heap_p->columns_p->length; i++) {
+        columns_p = &heap_p->columns_p->columns_p[i];
+
+        if (columns_p->field_number == field_number) {
+            if (columns_p->columns_p == NULL) {
+                break;
+            }
+
+            return (columns_p);
+        }
+    }
+
+    return (NULL);
+}
+
+void pbtools_repeated_iterator_init(
+    struct pbtools_repeated_iterator_t *self_p,
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct pbtools_repeated_message_t *repeated_p,
+    size_t item_size)
+{
+    struct pbtools_heap_t *heap_p;
+    size_t size;
+
+    self_p->decoder_p = decoder_p;
+    self_p->repeated_info_p = repeated_info_p;
+    self_p->run_p = &repeated_info_p->run;
+    self_p->scanning = false;
+    self_p->final = true;
+    self_p->decoding = false;
+    self_p->length = 0;
+    self_p->decoded = 0;
+    self_p->callback_p = NULL;
+    self_p->columns_p = NULL;
+
+    if ((repeated_info_p->length == 0)
+        || decoder_is_repeated_too_long(decoder_p, repeated_info_p)) {
+        return;
+    }
+
+    heap_p = repeated_info_p->decoder.heap_p;
+
+    if ((heap_p->callbacks_p != NULL) && (heap_p->depth == 1)) {
+        self_p->callback_p = heap_find_callback(heap_p, repeated_info_p->tag);
+
+        if (self_p->callback_p != NULL) {
+            self_p->repeated_p = repeated_p;
+            self_p->heap_pos = heap_p->pos;
+            repeated_p->length = 0;
+            self_p->final = false;
+
+            return;
+        }
+    }
+
+    if ((heap_p->columns_p != NULL) && (heap_p->depth == 1)) {
+        self_p->columns_p = heap_find_columns(heap_p, repeated_info_p->tag);
+
+        if (self_p->columns_p != NULL) {
+            repeated_p->length = 0;
+            self_p->columns_p->alloc(decoder_p,
+                                     self_p->columns_p->columns_p,
+                                     repeated_info_p->length);
+            self_p->final = (decoder_get_result(decoder_p) < 0);
+
+            return;
+        }
+    }
+
+    size = (item_size * (size_t)repeated_info_p->length);
+    repeated_p->items_p = heap_alloc(heap_p, size, alignof(uint64_t));
+
+    if ((repeated_p->items_p == NULL) && heap_free_runs(heap_p)) {
+        repeated_p->items_p = heap_alloc(heap_p, size, alignof(uint64_t));
+    }
+
+    if (repeated_p->items_p == NULL) {
+        repeated_p->length = 0;
+        decoder_abort(decoder_p, PBTOOLS_OUT_OF_MEMORY);
+
+        return;
+    }
+
+    repeated_p->length = repeated_info_p->length;
+    self_p->final = false;
+}
+
+/* Allocate and initialize the scratch item at the same position for
+   every item. */
+static bool repeated_iterator_begin_callback_item(
+    struct pbtools_repeated_iterator_t *self_p)
+{
+    struct pbtools_heap_t *heap_p;
+    const struct pbtools_repeated_callback_t *callback_p;
+
+    heap_p = self_p->repeated_info_p->decoder.heap_p;
+    callback_p = self_p->callback_p;
+    self_p->repeated_p->items_p = heap_alloc(heap_p,
+                                             callback_p->item_size,
+                                             alignof(uint64_t));
+
+    if ((self_p->repeated_p->items_p == NULL) && heap_free_runs(heap_p)) {
+        self_p->repeated_p->items_p = heap_alloc(heap_p,
+                                                 callback_p->item_size,
+                                                 alignof(uint64_t));
+    }
+
+    if (self_p->repeated_p->items_p == NULL) {
+        decoder_abort(self_p->decoder_p, PBTOOLS_OUT_OF_MEMORY);
+
+        return (false);
+    }
+
+    callback_p->init(self_p->repeated_p->items_p, heap_p);
+
+    return (true);
+}
+
+/* Give the decoded item to the callback and free it. */
+static void repeated_iterator_end_callback_item(
+    struct pbtools_repeated_iterator_t *self_p,
+    struct pbtools_decoder_t *decoder_p)
+{
+    struct pbtools_heap_t *heap_p;
+
+    heap_p = decoder_p->heap_p;
+
+    if (decoder_get_result(decoder_p) >= 0) {
+        self_p->callback_p->callback(heap_p->callbacks_p->arg_p,
+                                     self_p->repeated_p->items_p);
+    }
+
+    self_p->repeated_p->items_p = NULL;
+    heap_p->pos = self_p->heap_pos;
+}
+
+static void repeated_iterator_begin_item(
+    struct pbtools_repeated_iterator_t *self_p,
+    struct pbtools_decoder_t *decoder_p)
+{
+    struct pbtools_decoder_t *repeated_decoder_p;
+    struct pbtools_heap_t *heap_p;
+    int size;
+
+    repeated_decoder_p = &self_p->repeated_info_p->decoder;
+    size = (int)decoder_read_length_delimited(repeated_decoder_p,
+                                              PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+    decoder_init_slice(decoder_p, repeated_decoder_p, size);
+    heap_p = decoder_p->heap_p;
+    self_p->heap_size = heap_p->size;
+    self_p->repeated_infos_p = heap_p->repeated_infos_p;
+
+    if (heap_p->depth >= heap_p->max_depth) {
+        decoder_abort(decoder_p, PBTOOLS_NESTING_TOO_DEEP);
+    }
+
+    heap_p->depth++;
+}
+
+static void repeated_iterator_end_item(
+    struct pbtools_repeated_iterator_t *self_p,
+    struct pbtools_decoder_t *decoder_p)
+{
+    struct pbtools_heap_t *heap_p;
+
+    heap_p = decoder_p->heap_p;
+
+    if (heap_p->size < self_p->heap_size) {
+        heap_p->size = self_p->heap_size;
+    }
+
+    heap_p->repeated_infos_p = self_p->repeated_infos_p;
+    heap_p->depth--;
+    decoder_seek(&self_p->repeated_info_p->decoder,
+                 decoder_get_result(decoder_p));
+    self_p->decoded++;
+
+    if (self_p->callback_p != NULL) {
+        repeated_iterator_end_callback_item(self_p, decoder_p);
+    } else if (self_p->columns_p == NULL) {
+        self_p->length++;
+    }
+}
+
+/* The first item of each run is found at its beginning, while
+   following items are found by scanning the rest of the run. The rest
+   of the message is scanned once the runs are done, as runs may have
+   been freed. */
+static bool repeated_iterator_seek_item(
+    struct pbtools_repeated_iterator_t *self_p)
+{
+    struct pbtools_repeated_info_t *repeated_info_p;
+    int wire_type;
+    int tag;
+
+    repeated_info_p = self_p->repeated_info_p;
+
+    while (true) {
+        if (self_p->scanning) {
+            while (are_more_items_to_decode(repeated_info_p, self_p->decoded)) {
+                tag = pbtools_decoder_read_tag(&repeated_info_p->decoder,
+                                               &wire_type);
+
+                if (tag == repeated_info_p->tag) {
+                    return (true);
+                }
+
+                pbtools_decoder_skip_field(&repeated_info_p->decoder,
+                                           wire_type);
+            }
+        }
+
+        if (self_p->final) {
+            return (false);
+        }
+
+        self_p->scanning = true;
+
+        if (repeated_info_seek_run(repeated_info_p, &self_p->run_p)
+            && (self_p->decoded < repeated_info_p->length)) {
+            return (true);
+        }
+
+        self_p->final = true;
+    }
+}
+
+bool pbtools_repeated_iterator_next(
+    struct pbtools_repeated_iterator_t *self_p,
+    struct pbtools_decoder_t *decoder_p)
+{
+    int res;
+
+    if (self_p->decoding) {
+        repeated_iterator_end_item(self_p, decoder_p);
+        self_p->decoding = false;
+    }
+
+    while (repeated_iterator_seek_item(self_p)) {
+        if ((self_p->callback_p != NULL)
+            && !repeated_iterator_begin_callback_item(self_p)) {
+            return (false);
+        }
+
+        repeated_iterator_begin_item(self_p, decoder_p);
+
+        if (self_p->columns_p == NULL) {
+            self_p->decoding = true;
+
+            return (true);
+        }
+
+        /* Items decoded into columns are never given to the caller. */
+        self_p->columns_p->decode_inner(decoder_p,
+                                        self_p->columns_p->columns_p,
+                                        self_p->decoded);
+        repeated_iterator_end_item(self_p, decoder_p);
+    }
+
+    res = decoder_get_result(&self_p->repeated_info_p->decoder);
+
+    if (res < 0) {
+        decoder_abort(self_p->decoder_p, -res);
+    }
+
+    return (false);
+}
+
+void pbtools_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct pbtools_repeated_message_t *repeated_p,
+    size_t item_size,
+    pbtools_message_init_t message_init,
+    pbtools_message_decode_inner_t message_decode_inner)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    char *items_p;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(&iterator,
+                                   decoder_p,
+                                   repeated_info_p,
+                                   repeated_p,
+                                   item_size);
+    items_p = repeated_p->items_p;
+
+    for (i = 0; i < repeated_p->length; i++) {
+        message_init(&items_p[(size_t)i * item_size],
+                     repeated_info_p->decoder.heap_p);
+    }
+
+    /* Items are allocated one at a time if given to a callback. */
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        items_p = repeated_p->items_p;
+        message_decode_inner(&decoder,
+                             &items_p[(size_t)iterator.length * item_size]);
+    }
+}
+
+void pbtools_encoder_sub_message_encode(
+    struct pbtools_encoder_t *self_p,
+    int field_number,
+    struct pbtools_message_base_t *message_p,
+    pbtools_message_encode_inner_t encode_inner)
+{
+    int pos;
+
+    if (message_p != NULL) {
+        pos = self_p->pos;
+        encode_inner(self_p, message_p);
+        encoder_write_length_delimited(self_p,
+                                       field_number,
+                                       (uint64_t)(pos - self_p->pos));
+    }
+}
+
+void pbtools_encoder_sub_message_encode_always(
+    struct pbtools_encoder_t *self_p,
+    int field_number,
+    struct pbtools_message_base_t *message_p,
+    pbtools_message_encode_inner_t encode_inner)
+{
+    int pos;
+
+    pos = self_p->pos;
+    encode_inner(self_p, message_p);
+    encoder_write_tagged_varint_always(self_p,
+                                       field_number,
+                                       PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+                                       (uint64_t)(pos - self_p->pos));
+}
+
+static void decoder_sub_message_decode(
+    struct pbtools_decoder_t *self_p,
+    int wire_type,
+    struct pbtools_message_base_t **message_pp,
+    size_t sub_message_size,
+    pbtools_message_init_t message_init,
+    pbtools_message_decode_inner_t decode_inner)
+{
+    struct pbtools_message_base_t *message_p;
+    int size;
+    struct pbtools_decoder_t decoder;
+
+    message_p = decoder_heap_alloc(
+        self_p,
+        sub_message_size,
+        alignof(struct pbtools_message_base_t));
+
+    if (message_p == NULL) {
+        return;
+    }
+
+    message_init(message_p, self_p->heap_p);
+    size = (int)decoder_read_length_delimited(self_p, wire_type);
+    decoder_init_slice(&decoder, self_p, size);
+    decoder_decode_inner(&decoder, message_p, decode_inner);
+    decoder_seek(self_p, decoder_get_result(&decoder));
+    *message_pp = message_p;
+}
+
+void pbtools_decoder_sub_message_decode(
+    struct pbtools_decoder_t *self_p,
+    int wire_type,
+    struct pbtools_message_base_t **message_pp,
+    size_t sub_message_size,
+    pbtools_message_init_t message_init,
+    pbtools_message_decode_inner_t decode_inner)
+{
+    decoder_sub_message_decode(self_p,
+                               wire_type,
+                               message_pp,
+                               sub_message_size,
+                               message_init,
+                               decode_inner);
+}
+
+void pbtools_decoder_sub_message_decode_unchecked(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_message_base_t **message_pp,
+    size_t sub_message_size,
+    pbtools_message_init_t message_init,
+    pbtools_message_decode_inner_t decode_inner)
+{
+    decoder_sub_message_decode(self_p,
+                               PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+                               message_pp,
+                               sub_message_size,
+                               message_init,
+                               decode_inner);
+}
+
+void pbtools_lazy_message_init(struct pbtools_lazy_message_t *self_p)
+{
+    self_p->message_p = NULL;
+    self_p->encoded_p = NULL;
+    self_p->size = 0;
+}
+
+int pbtools_lazy_message_alloc(struct pbtools_lazy_message_t *self_p,
+                               struct pbtools_heap_t *heap_p,
+                               size_t sub_message_size,
+                               pbtools_message_init_t message_init)
+{
+    self_p->encoded_p = NULL;
+
+    return (pbtools_sub_message_alloc(&self_p->message_p,
+                                      heap_p,
+                                      sub_message_size,
+                                      message_init));
+}
+
+void *pbtools_lazy_message_get(struct pbtools_lazy_message_t *self_p,
+                               struct pbtools_heap_t *heap_p,
+                               size_t sub_message_size,
+                               pbtools_message_init_t message_init,
+                               pbtools_message_decode_inner_t decode_inner)
+{
+    struct pbtools_message_base_t *message_p;
+    struct pbtools_decoder_t decoder;
+    int res;
+
+    if (self_p->encoded_p == NULL) {
+        return (self_p->message_p);
+    }
+
+    res = pbtools_sub_message_alloc(&message_p,
+                                    heap_p,
+                                    sub_message_size,
+                                    message_init);
+
+    if (res != 0) {
+        return (NULL);
+    }
+
+    decoder_init(&decoder, self_p->encoded_p, (size_t)self_p->size, heap_p);
+    decoder_decode_inner(&decoder, message_p, decode_inner);
+
+    self_p->encoded_p = NULL;
+
+    /* Keep the error instead of decoding again on every access. */
+    if (decoder_get_result(&decoder) < 0) {
+        self_p->size = decoder_get_result(&decoder);
+
+        return (NULL);
+    }
+
+    self_p->message_p = message_p;
+
+    return (message_p);
+}
+
+void pbtools_encoder_lazy_message_encode(
+    struct pbtools_encoder_t *self_p,
+    int field_number,
+    struct pbtools_lazy_message_t *lazy_p,
+    pbtools_message_encode_inner_t encode_inner)
+{
+    if (lazy_p->encoded_p != NULL) {
+        encoder_write(self_p, (uint8_t *)lazy_p->encoded_p, lazy_p->size);
+        encoder_write_length_delimited(self_p,
+                                       field_number,
+                                       (uint64_t)lazy_p->size);
+    } else {
+        pbtools_encoder_sub_message_encode(self_p,
+                                           field_number,
+                                           lazy_p->message_p,
+                                           encode_inner);
+    }
+}
+
+static void decoder_read_lazy_message(struct pbtools_decoder_t *self_p,
+                                      int wire_type,
+                                      struct pbtools_lazy_message_t *lazy_p)
+{
+    int size;
+
+    size = (int)decoder_read_length_delimited(self_p, wire_type);
+
+    if (self_p->pos < 0) {
+        return;
+    }
+
+    if (size > decoder_left(self_p)) {
+        decoder_abort(self_p, PBTOOLS_OUT_OF_DATA);
+
+        return;
+    }
+
+    lazy_p->message_p = NULL;
+    lazy_p->encoded_p = &self_p->buf_p[self_p->pos];
+    lazy_p->size = size;
+    self_p->pos += size;
+}
+
+void pbtools_decoder_read_lazy_message(struct pbtools_decoder_t *self_p,
+                                       int wire_type,
+                                       struct pbtools_lazy_message_t *lazy_p)
+{
+    decoder_read_lazy_message(self_p, wire_type, lazy_p);
+}
+
+void pbtools_decoder_read_lazy_message_unchecked(
+    struct pbtools_decoder_t *self_p,
+    struct pbtools_lazy_message_t *lazy_p)
+{
+    decoder_read_lazy_message(self_p,
+                              PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+                              lazy_p);
+}
+
+static void *message_field(struct pbtools_message_base_t *message_p,
+                           uint32_t offset)
+{
+    return ((char *)message_p + offset);
+}
+
+/* Non-optional fields are not encoded if they have their default
+   value. Sub-messages are encoded if allocated. */
+static bool field_has_default_value(const struct pbtools_field_info_t *field_p,
+                                    void *value_p)
+{
+    bool res;
+
+    switch (field_p->kind) {
+
+    case PBTOOLS_FIELD_KIND_INT64:
+    case PBTOOLS_FIELD_KIND_SINT64:
+    case PBTOOLS_FIELD_KIND_UINT64:
+    case PBTOOLS_FIELD_KIND_FIXED64:
+    case PBTOOLS_FIELD_KIND_SFIXED64:
+        res = (*(uint64_t *)value_p == 0);
+        break;
+
+    case PBTOOLS_FIELD_KIND_BOOL:
+        res = !*(bool *)value_p;
+        break;
+
+    case PBTOOLS_FIELD_KIND_STRING:
+        res = (**(char **)value_p == '\0');
+        break;
+
+    case PBTOOLS_FIELD_KIND_BYTES:
+    case PBTOOLS_FIELD_KIND_BYTES_VIEW:
+        res = (((struct pbtools_bytes_t *)value_p)->size == 0);
+        break;
+
+    case PBTOOLS_FIELD_KIND_MESSAGE:
+        res = (*(struct pbtools_message_base_t **)value_p == NULL);
+        break;
+
+#if PBTOOLS_CONFIG_FLOAT == 1
+    case PBTOOLS_FIELD_KIND_DOUBLE:
+        res = (memcmp(value_p, &(uint64_t){ 0 }, sizeof(double)) == 0);
+        break;
+
+    case PBTOOLS_FIELD_KIND_FLOAT:
+        res = (memcmp(value_p, &(uint32_t){ 0 }, sizeof(float)) == 0);
+        break;
+#endif
+
+    default:
+        res = (*(uint32_t *)value_p == 0);
+        break;
+    }
+
+    return (res);
+}
+
+static void message_info_encode_value(struct pbtools_encoder_t *encoder_p,
+                                      const struct pbtools_field_info_t *field_p,
+                                      void *value_p)
+{
+    int field_number;
+
+    field_number = field_p->field_number;
+
+    switch (field_p->kind) {
+
+    case PBTOOLS_FIELD_KIND_INT32:
+    case PBTOOLS_FIELD_KIND_ENUM:
+        encoder_write_tagged_varint_always(encoder_p,
+                                           field_number,
+                                           PBTOOLS_WIRE_TYPE_VARINT,
+                                           (uint64_t)*(int32_t *)value_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_INT64:
+    case PBTOOLS_FIELD_KIND_UINT64:
+        encoder_write_tagged_varint_always(encoder_p,
+                                           field_number,
+                                           PBTOOLS_WIRE_TYPE_VARINT,
+                                           *(uint64_t *)value_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_SINT32:
+        encoder_write_tagged_varint_always(encoder_p,
+                                           field_number,
+                                           PBTOOLS_WIRE_TYPE_VARINT,
+                                           sint64_encode(*(int32_t *)value_p));
+        break;
+
+    case PBTOOLS_FIELD_KIND_SINT64:
+        encoder_write_tagged_varint_always(encoder_p,
+                                           field_number,
+                                           PBTOOLS_WIRE_TYPE_VARINT,
+                                           sint64_encode(*(int64_t *)value_p));
+        break;
+
+    case PBTOOLS_FIELD_KIND_UINT32:
+        encoder_write_tagged_varint_always(encoder_p,
+                                           field_number,
+                                           PBTOOLS_WIRE_TYPE_VARINT,
+                                           *(uint32_t *)value_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_FIXED32:
+        pbtools_encoder_write_fixed32_always(encoder_p,
+                                             field_number,
+                                             *(uint32_t *)value_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_FIXED64:
+        pbtools_encoder_write_fixed64_always(encoder_p,
+                                             field_number,
+                                             *(uint64_t *)value_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_SFIXED32:
+        pbtools_encoder_write_sfixed32_always(encoder_p,
+                                              field_number,
+                                              *(int32_t *)value_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_SFIXED64:
+        pbtools_encoder_write_sfixed64_always(encoder_p,
+                                              field_number,
+                                              *(int64_t *)value_p);
+        break;
+
+#if PBTOOLS_CONFIG_FLOAT == 1
+    case PBTOOLS_FIELD_KIND_FLOAT:
+        pbtools_encoder_write_float_always(encoder_p,
+                                           field_number,
+                                           *(float *)value_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_DOUBLE:
+        pbtools_encoder_write_double_always(encoder_p,
+                                            field_number,
+                                            *(double *)value_p);
+        break;
+#endif
+
+    case PBTOOLS_FIELD_KIND_BOOL:
+        encoder_write_tagged_varint_always(encoder_p,
+                                           field_number,
+                                           PBTOOLS_WIRE_TYPE_VARINT,
+                                           *(bool *)value_p ? 1 : 0);
+        break;
+
+    case PBTOOLS_FIELD_KIND_STRING:
+        pbtools_encoder_write_string_always(encoder_p,
+                                            field_number,
+                                            *(char **)value_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_BYTES:
+    case PBTOOLS_FIELD_KIND_BYTES_VIEW:
+        pbtools_encoder_write_bytes_always(encoder_p,
+                                           field_number,
+                                           (struct pbtools_bytes_t *)value_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_MESSAGE:
+        pbtools_encoder_sub_message_encode_always(
+            encoder_p,
+            field_number,
+            *(struct pbtools_message_base_t **)value_p,
+            field_p->message_info_p->encode_inner);
+        break;
+
+    default:
+        break;
+    }
+}
+
+static void message_info_encode_repeated(
+    struct pbtools_encoder_t *encoder_p,
+    const struct pbtools_field_info_t *field_p,
+    void *repeated_p)
+{
+    int field_number;
+
+    field_number = field_p->field_number;
+
+    switch (field_p->kind) {
+
+    case PBTOOLS_FIELD_KIND_INT32:
+    case PBTOOLS_FIELD_KIND_ENUM:
+        pbtools_encoder_write_repeated_int32(encoder_p,
+                                             field_number,
+                                             repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_INT64:
+        pbtools_encoder_write_repeated_int64(encoder_p,
+                                             field_number,
+                                             repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_SINT32:
+        pbtools_encoder_write_repeated_sint32(encoder_p,
+                                              field_number,
+                                              repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_SINT64:
+        pbtools_encoder_write_repeated_sint64(encoder_p,
+                                              field_number,
+                                              repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_UINT32:
+        pbtools_encoder_write_repeated_uint32(encoder_p,
+                                              field_number,
+                                              repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_UINT64:
+        pbtools_encoder_write_repeated_uint64(encoder_p,
+                                              field_number,
+                                              repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_FIXED32:
+        pbtools_encoder_write_repeated_fixed32(encoder_p,
+                                               field_number,
+                                               repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_FIXED64:
+        pbtools_encoder_write_repeated_fixed64(encoder_p,
+                                               field_number,
+                                               repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_SFIXED32:
+        pbtools_encoder_write_repeated_sfixed32(encoder_p,
+                                                field_number,
+                                                repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_SFIXED64:
+        pbtools_encoder_write_repeated_sfixed64(encoder_p,
+                                                field_number,
+                                                repeated_p);
+        break;
+
+#if PBTOOLS_CONFIG_FLOAT == 1
+    case PBTOOLS_FIELD_KIND_FLOAT:
+        pbtools_encoder_write_repeated_float(encoder_p,
+                                             field_number,
+                                             repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_DOUBLE:
+        pbtools_encoder_write_repeated_double(encoder_p,
+                                              field_number,
+                                              repeated_p);
+        break;
+#endif
+
+    case PBTOOLS_FIELD_KIND_BOOL:
+        pbtools_encoder_write_repeated_bool(encoder_p,
+                                            field_number,
+                                            repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_STRING:
+        pbtools_encoder_write_repeated_string(encoder_p,
+                                              field_number,
+                                              repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_BYTES:
+    case PBTOOLS_FIELD_KIND_BYTES_VIEW:
+        pbtools_encoder_write_repeated_bytes(encoder_p,
+                                             field_number,
+                                             repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_MESSAGE:
+        pbtools_encode_repeated_inner(encoder_p,
+                                      field_number,
+                                      repeated_p,
+                                      field_p->message_info_p->size,
+                                      field_p->message_info_p->encode_inner);
+        break;
+
+    default:
+        break;
+    }
+}
+
+void pbtools_message_info_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct pbtools_message_base_t *message_p,
+    const struct pbtools_message_info_t *info_p)
+{
+    const struct pbtools_field_info_t *field_p;
+    void *value_p;
+    int i;
+
+    /* Last field first as the encoder writes back to front. */
+    for (i = info_p->number_of_fields - 1; i >= 0; i--) {
+        field_p = &info_p->fields_p[i];
+        value_p = message_field(message_p, field_p->offset);
+
+        if (field_p->flags & PBTOOLS_FIELD_FLAG_REPEATED) {
+            message_info_encode_repeated(encoder_p, field_p, value_p);
+        } else if (field_p->flags & PBTOOLS_FIELD_FLAG_OPTIONAL) {
+            if (*(bool *)message_field(message_p, field_p->presence_offset)) {
+                message_info_encode_value(encoder_p, field_p, value_p);
+            }
+        } else if (!field_has_default_value(field_p, value_p)) {
+            message_info_encode_value(encoder_p, field_p, value_p);
+        }
+    }
+}
+
+static int field_mask_find(const struct pbtools_field_mask_t *self_p,
+                           int field_number)
+{
+    int i;
+
+    for (i = 0; i < self_p->number_of_fields; i++) {
+        if (self_p->field_numbers_p[i] == field_number) {
+            return (i);
+        }
+    }
+
+    return (-1);
+}
+
+/* Returns the mask of given sub-message field, or NULL to decode it
+   completely. Sub-messages without a table get no mask, as it would
+   be used by their own sub-messages. */
+static const struct pbtools_field_mask_t *field_mask_sub_mask(
+    const struct pbtools_field_mask_t *self_p,
+    const struct pbtools_field_info_t *field_p)
+{
+    int index;
+
+    if ((self_p == NULL)
+        || (self_p->sub_masks_pp == NULL)
+        || (field_p->message_info_p->fields_p == NULL)) {
+        return (NULL);
+    }
+
+    index = field_mask_find(self_p, field_p->field_number);
+
+    if (index < 0) {
+        return (NULL);
+    }
+
+    return (self_p->sub_masks_pp[index]);
+}
+
+static void message_info_decode_value(struct pbtools_decoder_t *decoder_p,
+                                      int wire_type,
+                                      const struct pbtools_field_info_t *field_p,
+                                      void *value_p)
+{
+    const struct pbtools_message_info_t *info_p;
+    const struct pbtools_field_mask_t *mask_p;
+    struct pbtools_heap_t *heap_p;
+
+    switch (field_p->kind) {
+
+    case PBTOOLS_FIELD_KIND_INT32:
+    case PBTOOLS_FIELD_KIND_UINT32:
+    case PBTOOLS_FIELD_KIND_ENUM:
+        *(uint32_t *)value_p = (uint32_t)read_varint_check_wire_type_varint(
+            decoder_p,
+            wire_type);
+        break;
+
+    case PBTOOLS_FIELD_KIND_INT64:
+    case PBTOOLS_FIELD_KIND_UINT64:
+        *(uint64_t *)value_p = read_varint_check_wire_type_varint(decoder_p,
+                                                                  wire_type);
+        break;
+
+    case PBTOOLS_FIELD_KIND_SINT32:
+        *(int32_t *)value_p = (int32_t)sint64_decode(
+            read_varint_check_wire_type_varint(decoder_p, wire_type));
+        break;
+
+    case PBTOOLS_FIELD_KIND_SINT64:
+        *(int64_t *)value_p = sint64_decode(
+            read_varint_check_wire_type_varint(decoder_p, wire_type));
+        break;
+
+    case PBTOOLS_FIELD_KIND_FIXED32:
+        *(uint32_t *)value_p = pbtools_decoder_read_fixed32(decoder_p,
+                                                            wire_type);
+        break;
+
+    case PBTOOLS_FIELD_KIND_FIXED64:
+        *(uint64_t *)value_p = pbtools_decoder_read_fixed64(decoder_p,
+                                                            wire_type);
+        break;
+
+    case PBTOOLS_FIELD_KIND_SFIXED32:
+        *(int32_t *)value_p = pbtools_decoder_read_sfixed32(decoder_p,
+                                                            wire_type);
+        break;
+
+    case PBTOOLS_FIELD_KIND_SFIXED64:
+        *(int64_t *)value_p = pbtools_decoder_read_sfixed64(decoder_p,
+                                                            wire_type);
+        break;
+
+#if PBTOOLS_CONFIG_FLOAT == 1
+    case PBTOOLS_FIELD_KIND_FLOAT:
+        *(float *)value_p = pbtools_decoder_read_float(decoder_p, wire_type);
+        break;
+
+    case PBTOOLS_FIELD_KIND_DOUBLE:
+        *(double *)value_p = pbtools_decoder_read_double(decoder_p, wire_type);
+        break;
+#endif
+
+    case PBTOOLS_FIELD_KIND_BOOL:
+        *(bool *)value_p = (read_varint_check_wire_type_varint(decoder_p,
+                                                               wire_type)
+                            != 0);
+        break;
+
+    case PBTOOLS_FIELD_KIND_STRING:
+        pbtools_decoder_read_string(decoder_p, wire_type, value_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_BYTES:
+        pbtools_decoder_read_bytes(decoder_p, wire_type, value_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_BYTES_VIEW:
+        pbtools_decoder_read_bytes_view(decoder_p, wire_type, value_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_MESSAGE:
+        info_p = field_p->message_info_p;
+        heap_p = decoder_p->heap_p;
+        mask_p = heap_p->mask_p;
+        heap_p->mask_p = field_mask_sub_mask(mask_p, field_p);
+        pbtools_decoder_sub_message_decode(decoder_p,
+                                           wire_type,
+                                           value_p,
+                                           info_p->size,
+                                           info_p->init,
+                                           info_p->decode_inner);
+        heap_p->mask_p = mask_p;
+        break;
+
+    default:
+        pbtools_decoder_skip_field(decoder_p, wire_type);
+        break;
+    }
+}
+
+static void message_info_decode_repeated_item(
+    struct pbtools_decoder_t *decoder_p,
+    int wire_type,
+    const struct pbtools_field_info_t *field_p,
+    struct pbtools_repeated_info_t *repeated_info_p)
+{
+    switch (field_p->kind) {
+
+    case PBTOOLS_FIELD_KIND_FIXED32:
+    case PBTOOLS_FIELD_KIND_SFIXED32:
+    case PBTOOLS_FIELD_KIND_FLOAT:
+        repeated_info_decode_32bit(repeated_info_p, decoder_p, wire_type);
+        break;
+
+    case PBTOOLS_FIELD_KIND_FIXED64:
+    case PBTOOLS_FIELD_KIND_SFIXED64:
+    case PBTOOLS_FIELD_KIND_DOUBLE:
+        repeated_info_decode_64bit(repeated_info_p, decoder_p, wire_type);
+        break;
+
+    case PBTOOLS_FIELD_KIND_STRING:
+    case PBTOOLS_FIELD_KIND_BYTES:
+    case PBTOOLS_FIELD_KIND_BYTES_VIEW:
+    case PBTOOLS_FIELD_KIND_MESSAGE:
+        repeated_info_decode_length_delimited(repeated_info_p,
+                                              decoder_p,
+                                              wire_type);
+        break;
+
+    default:
+        repeated_info_decode_varint(repeated_info_p, decoder_p, wire_type);
+        break;
+    }
+}
+
+static void message_info_decode_repeated(
+    struct pbtools_decoder_t *decoder_p,
+    const struct pbtools_field_info_t *field_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    void *repeated_p)
+{
+    const struct pbtools_message_info_t *info_p;
+    const struct pbtools_field_mask_t *mask_p;
+    struct pbtools_heap_t *heap_p;
+
+    switch (field_p->kind) {
+
+    case PBTOOLS_FIELD_KIND_INT32:
+    case PBTOOLS_FIELD_KIND_ENUM:
+        pbtools_decoder_decode_repeated_int32(decoder_p,
+                                              repeated_info_p,
+                                              repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_INT64:
+        pbtools_decoder_decode_repeated_int64(decoder_p,
+                                              repeated_info_p,
+                                              repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_SINT32:
+        pbtools_decoder_decode_repeated_sint32(decoder_p,
+                                               repeated_info_p,
+                                               repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_SINT64:
+        pbtools_decoder_decode_repeated_sint64(decoder_p,
+                                               repeated_info_p,
+                                               repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_UINT32:
+        pbtools_decoder_decode_repeated_uint32(decoder_p,
+                                               repeated_info_p,
+                                               repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_UINT64:
+        pbtools_decoder_decode_repeated_uint64(decoder_p,
+                                               repeated_info_p,
+                                               repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_FIXED32:
+        pbtools_decoder_decode_repeated_fixed32(decoder_p,
+                                                repeated_info_p,
+                                                repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_FIXED64:
+        pbtools_decoder_decode_repeated_fixed64(decoder_p,
+                                                repeated_info_p,
+                                                repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_SFIXED32:
+        pbtools_decoder_decode_repeated_sfixed32(decoder_p,
+                                                 repeated_info_p,
+                                                 repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_SFIXED64:
+        pbtools_decoder_decode_repeated_sfixed64(decoder_p,
+                                                 repeated_info_p,
+                                                 repeated_p);
+        break;
+
+#if PBTOOLS_CONFIG_FLOAT == 1
+    case PBTOOLS_FIELD_KIND_FLOAT:
+        pbtools_decoder_decode_repeated_float(decoder_p,
+                                              repeated_info_p,
+                                              repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_DOUBLE:
+        pbtools_decoder_decode_repeated_double(decoder_p,
+                                               repeated_info_p,
+                                               repeated_p);
+        break;
+#endif
+
+    case PBTOOLS_FIELD_KIND_BOOL:
+        pbtools_decoder_decode_repeated_bool(decoder_p,
+                                             repeated_info_p,
+                                             repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_STRING:
+        pbtools_decoder_decode_repeated_string(decoder_p,
+                                               repeated_info_p,
+                                               repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_BYTES:
+        pbtools_decoder_decode_repeated_bytes(decoder_p,
+                                              repeated_info_p,
+                                              repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_BYTES_VIEW:
+        pbtools_decoder_decode_repeated_bytes_view(decoder_p,
+                                                   repeated_info_p,
+                                                   repeated_p);
+        break;
+
+    case PBTOOLS_FIELD_KIND_MESSAGE:
+        info_p = field_p->message_info_p;
+        heap_p = decoder_p->heap_p;
+        mask_p = heap_p->mask_p;
+        heap_p->mask_p = field_mask_sub_mask(mask_p, field_p);
+        pbtools_decode_repeated_inner(decoder_p,
+                                      repeated_info_p,
+                                      repeated_p,
+                                      info_p->size,
+                                      info_p->init,
+                                      info_p->decode_inner);
+        heap_p->mask_p = mask_p;
+        break;
+
+    default:
+        break;
+    }
+}
+
+/* Binary search for given field number in field number order. */
+static int message_info_find_field(const struct pbtools_message_info_t *info_p,
+                                   int field_number)
+{
+    int low;
+    int high;
+    int middle;
+    int index;
+
+    low = 0;
+    high = (info_p->number_of_fields - 1);
+
+    while (low <= high) {
+        middle = ((low + high) / 2);
+
+        if (info_p->sorted_indexes_p != NULL) {
+            index = info_p->sorted_indexes_p[middle];
+        } else {
+            index = middle;
+        }
+
+        if (info_p->fields_p[index].field_number < field_number) {
+            low = (middle + 1);
+        } else if (info_p->fields_p[index].field_number > field_number) {
+            high = (middle - 1);
+        } else {
+            return (index);
+        }
+    }
+
+    return (-1);
+}
+
+/* Repeated fields that are not packed are usually followed by
+   another item. */
+static bool field_is_followed_by_itself(
+    const struct pbtools_field_info_t *field_p)
+{
+    return ((field_p->flags & PBTOOLS_FIELD_FLAG_REPEATED)
+            && (field_p->kind >= PBTOOLS_FIELD_KIND_STRING));
+}
+
+static void message_info_init_repeated_infos(
+    const struct pbtools_message_info_t *info_p,
+    struct pbtools_repeated_info_t *repeated_infos_p)
+{
+    const struct pbtools_field_info_t *fields_p;
+    int i;
+
+    fields_p = info_p->fields_p;
+
+    for (i = 0; i < info_p->number_of_fields; i++) {
+        if (fields_p[i].flags & PBTOOLS_FIELD_FLAG_REPEATED) {
+            pbtools_repeated_info_init(
+                &repeated_infos_p[fields_p[i].repeated_index],
+                fields_p[i].field_number);
+        }
+    }
+}
+
+/* Sub-messages with a table are decoded without recursion by the
+   limited decoder. */
+static bool field_is_table_message(const struct pbtools_field_info_t *field_p)
+{
+    return ((field_p->kind == PBTOOLS_FIELD_KIND_MESSAGE)
+            && (field_p->message_info_p->fields_p != NULL));
+}
+
+/* Decode fields until the end of the message, starting with the field
+   at given index. If wire_type_p is not NULL, sub-messages with a
+   table are not decoded, but returned with their wire type so that
+   the caller can decode them. Returns NULL when done. */
+static const struct pbtools_field_info_t *message_info_decode_fields(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_message_base_t *message_p,
+    const struct pbtools_message_info_t *info_p,
+    struct pbtools_repeated_info_t *repeated_infos_p,
+    int *index_p,
+    int *wire_type_p)
+{
+    const struct pbtools_field_info_t *fields_p;
+    const struct pbtools_field_info_t *field_p;
+    const struct pbtools_field_mask_t *mask_p;
+    int number_of_fields;
+    int wire_type;
+    int index;
+
+    fields_p = info_p->fields_p;
+    number_of_fields = info_p->number_of_fields;
+    mask_p = decoder_p->heap_p->mask_p;
+
+    /* Fields are expected in table order. The tag of the expected
+       field is compared to the encoded bytes, and the table is only
+       searched on a miss. */
+    index = *index_p;
+
+    while (pbtools_decoder_available(decoder_p)) {
+        field_p = &fields_p[index];
+
+        if (decoder_read_expected_tag(decoder_p,
+                                      field_p->field_number,
+                                      field_p->wire_type)) {
+            wire_type = field_p->wire_type;
+        } else {
+            index = message_info_find_field(
+                info_p,
+                pbtools_decoder_read_tag(decoder_p, &wire_type));
+
+            if (index < 0) {
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                index = 0;
+                continue;
+            }
+
+            field_p = &fields_p[index];
+        }
+
+        if (!field_is_followed_by_itself(field_p)) {
+            index++;
+
+            if (index == number_of_fields) {
+                index = 0;
+            }
+        }
+
+        if ((mask_p != NULL)
+            && (field_mask_find(mask_p, field_p->field_number) < 0)) {
+            pbtools_decoder_skip_field(decoder_p, wire_type);
+        } else if (field_p->flags & PBTOOLS_FIELD_FLAG_REPEATED) {
+            message_info_decode_repeated_item(
+                decoder_p,
+                wire_type,
+                field_p,
+                &repeated_infos_p[field_p->repeated_index]);
+        } else {
+            if (field_p->flags & PBTOOLS_FIELD_FLAG_OPTIONAL) {
+                *(bool *)message_field(message_p,
+                                       field_p->presence_offset) = true;
+            }
+
+            if ((wire_type_p != NULL) && field_is_table_message(field_p)) {
+                *index_p = index;
+                *wire_type_p = wire_type;
+
+                return (field_p);
+            }
+
+            message_info_decode_value(decoder_p,
+                                      wire_type,
+                                      field_p,
+                                      message_field(message_p,
+                                                    field_p->offset));
+        }
+    }
+
+    return (NULL);
+}
+
+void pbtools_message_info_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_message_base_t *message_p,
+    const struct pbtools_message_info_t *info_p,
+    struct pbtools_repeated_info_t *repeated_infos_p)
+{
+    const struct pbtools_field_info_t *field_p;
+    int index;
+    int i;
+
+    message_info_init_repeated_infos(info_p, repeated_infos_p);
+    index = 0;
+    (void)message_info_decode_fields(decoder_p,
+                                     message_p,
+                                     info_p,
+                                     repeated_infos_p,
+                                     &index,
+                                     NULL);
+
+    for (i = 0; i < info_p->number_of_fields; i++) {
+        field_p = &info_p->fields_p[i];
+
+        if (field_p->flags & PBTOOLS_FIELD_FLAG_REPEATED) {
+            message_info_decode_repeated(
+                decoder_p,
+                field_p,
+                &repeated_infos_p[field_p->repeated_index],
+                message_field(message_p, field_p->offset));
+        }
+    }
+}
+
+/* A message being decoded by the limited decoder. Frames are
+   allocated in temporary memory, followed by the repeated infos of
+   the message. */
+struct decode_frame_t {
+    struct decode_frame_t *parent_p;
+    struct pbtools_decoder_t *decoder_p;
+    struct pbtools_message_base_t *message_p;
+    const struct pbtools_message_info_t *info_p;
+    struct pbtools_repeated_info_t *repeated_infos_p;
+    /* Field to expect when scanning, or repeated field to decode when
+       done scanning. */
+    int index;
+    bool scanning;
+    /* Items of the repeated field at index are being decoded. */
+    bool iterating;
+    struct pbtools_repeated_iterator_t iterator;
+    /* Decoder of the sub-message in the next frame. */
+    struct pbtools_decoder_t sub_decoder;
+    /* Depth of items is counted by the iterator. */
+    bool item;
+    /* Heap state to restore when done. */
+    int heap_size;
+    int pinned_size;
+    struct pbtools_repeated_info_t *repeated_infos_heap_p;
+    const struct pbtools_field_mask_t *mask_p;
+};
+
+static int message_info_number_of_repeated_infos(
+    const struct pbtools_message_info_t *info_p)
+{
+    int i;
+    int number_of_repeated_infos;
+
+    number_of_repeated_infos = 0;
+
+    for (i = 0; i < info_p->number_of_fields; i++) {
+        if (info_p->fields_p[i].flags & PBTOOLS_FIELD_FLAG_REPEATED) {
+            if (info_p->fields_p[i].repeated_index >= number_of_repeated_infos) {
+                number_of_repeated_infos = (info_p->fields_p[i].repeated_index
+                                            + 1);
+            }
+        }
+    }
+
+    return (number_of_repeated_infos);
+}
+
+/* Start decoding given message in a new frame. Returns NULL and
+   aborts given decoder if too deep or out of memory. */
+static struct decode_frame_t *decode_frame_push(
+    struct decode_frame_t *parent_p,
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_message_base_t *message_p,
+    const struct pbtools_message_info_t *info_p,
+    const struct pbtools_field_mask_t *mask_p,
+    bool item)
+{
+    struct decode_frame_t *frame_p;
+    struct pbtools_heap_t *heap_p;
+    size_t size;
+    int heap_size;
+
+    heap_p = decoder_p->heap_p;
+
+    if (!item && (heap_p->depth >= heap_p->max_depth)) {
+        decoder_abort(decoder_p, PBTOOLS_NESTING_TOO_DEEP);
+
+        return (NULL);
+    }
+
+    heap_size = heap_p->size;
+    size = (sizeof(*frame_p)
+            + (sizeof(struct pbtools_repeated_info_t)
+               * (size_t)message_info_number_of_repeated_infos(info_p)));
+    frame_p = heap_alloc_top(heap_p, size, alignof(struct decode_frame_t));
+
+    if (frame_p == NULL) {
+        decoder_abort(decoder_p, PBTOOLS_OUT_OF_MEMORY);
+
+        return (NULL);
+    }
+
+    if (!item) {
+        heap_p->depth++;
+    }
+
+    frame_p->parent_p = parent_p;
+    frame_p->decoder_p = decoder_p;
+    frame_p->message_p = message_p;
+    frame_p->info_p = info_p;
+    frame_p->repeated_infos_p = (struct pbtools_repeated_info_t *)&frame_p[1];
+    frame_p->index = 0;
+    frame_p->scanning = true;
+    frame_p->iterating = false;
+    frame_p->item = item;
+    frame_p->heap_size = heap_size;
+    frame_p->pinned_size = heap_p->pinned_size;
+    frame_p->repeated_infos_heap_p = heap_p->repeated_infos_p;
+    frame_p->mask_p = heap_p->mask_p;
+    heap_p->pinned_size = heap_p->size;
+    heap_p->mask_p = mask_p;
+    message_info_init_repeated_infos(info_p, frame_p->repeated_infos_p);
+
+    return (frame_p);
+}
+
+/* Free given frame and its temporary memory. Returns the parent
+   frame. */
+static struct decode_frame_t *decode_frame_pop(struct decode_frame_t *frame_p)
+{
+    struct pbtools_heap_t *heap_p;
+    struct decode_frame_t *parent_p;
+
+    heap_p = frame_p->decoder_p->heap_p;
+    parent_p = frame_p->parent_p;
+
+    if (!frame_p->item) {
+        heap_p->depth--;
+    }
+
+    heap_p->mask_p = frame_p->mask_p;
+    heap_p->repeated_infos_p = frame_p->repeated_infos_heap_p;
+    heap_p->pinned_size = frame_p->pinned_size;
+
+    if (heap_p->size < frame_p->heap_size) {
+        heap_p->size = frame_p->heap_size;
+    }
+
+    if (parent_p != NULL) {
+        if (frame_p->item) {
+            parent_p->iterating = true;
+        } else {
+            decoder_seek(parent_p->decoder_p,
+                         decoder_get_result(frame_p->decoder_p));
+        }
+    }
+
+    return (parent_p);
+}
+
+static struct decode_frame_t *decode_frame_push_sub_message(
+    struct decode_frame_t *frame_p,
+    const struct pbtools_field_info_t *field_p,
+    int wire_type)
+{
+    const struct pbtools_message_info_t *info_p;
+    struct pbtools_decoder_t *decoder_p;
+    struct pbtools_message_base_t *message_p;
+    struct decode_frame_t *sub_frame_p;
+    int size;
+
+    info_p = field_p->message_info_p;
+    decoder_p = frame_p->decoder_p;
+    message_p = decoder_heap_alloc(decoder_p,
+                                   info_p->size,
+                                   alignof(struct pbtools_message_base_t));
+
+    if (message_p == NULL) {
+        return (frame_p);
+    }
+
+    info_p->init(message_p, decoder_p->heap_p);
+    size = (int)decoder_read_length_delimited(decoder_p, wire_type);
+    decoder_init_slice(&frame_p->sub_decoder, decoder_p, size);
+    *(struct pbtools_message_base_t **)message_field(frame_p->message_p,
+                                                     field_p->offset) = message_p;
+    sub_frame_p = decode_frame_push(frame_p,
+                                    &frame_p->sub_decoder,
+                                    message_p,
+                                    info_p,
+                                    field_mask_sub_mask(decoder_p->heap_p->mask_p,
+                                                        field_p),
+                                    false);
+
+    if (sub_frame_p == NULL) {
+        decoder_seek(decoder_p, decoder_get_result(&frame_p->sub_decoder));
+
+        return (frame_p);
+    }
+
+    return (sub_frame_p);
+}
+
+/* Decode the next item of the repeated sub-message field at index in
+   a new frame. */
+static struct decode_frame_t *decode_frame_push_item(
+    struct decode_frame_t *frame_p)
+{
+    const struct pbtools_field_info_t *field_p;
+    struct pbtools_repeated_message_t *repeated_p;
+    struct decode_frame_t *item_frame_p;
+    char *item_p;
+
+    field_p = &frame_p->info_p->fields_p[frame_p->index];
+
+    if (!pbtools_repeated_iterator_next(&frame_p->iterator,
+                                        &frame_p->sub_decoder)) {
+        frame_p->iterating = false;
+        frame_p->index++;
+
+        return (frame_p);
+    }
+
+    if (frame_p->sub_decoder.pos < 0) {
+        return (frame_p);
+    }
+
+    repeated_p = message_field(frame_p->message_p, field_p->offset);
+    item_p = repeated_p->items_p;
+    item_p += ((size_t)frame_p->iterator.length
+               * field_p->message_info_p->size);
+    item_frame_p = decode_frame_push(
+        frame_p,
+        &frame_p->sub_decoder,
+        (struct pbtools_message_base_t *)item_p,
+        field_p->message_info_p,
+        field_mask_sub_mask(frame_p->decoder_p->heap_p->mask_p, field_p),
+        true);
+
+    if (item_frame_p == NULL) {
+        return (frame_p);
+    }
+
+    frame_p->iterating = false;
+
+    return (item_frame_p);
+}
+
+static void decode_frame_begin_items(struct decode_frame_t *frame_p,
+                                     const struct pbtools_field_info_t *field_p)
+{
+    const struct pbtools_message_info_t *info_p;
+    struct pbtools_repeated_message_t *repeated_p;
+    char *item_p;
+    int i;
+
+    info_p = field_p->message_info_p;
+    repeated_p = message_field(frame_p->message_p, field_p->offset);
+    pbtools_repeated_iterator_init(
+        &frame_p->iterator,
+        frame_p->decoder_p,
+        &frame_p->repeated_infos_p[field_p->repeated_index],
+        repeated_p,
+        info_p->size);
+    item_p = repeated_p->items_p;
+
+    for (i = 0; i < repeated_p->length; i++) {
+        info_p->init(item_p, frame_p->decoder_p->heap_p);
+        item_p += info_p->size;
+    }
+
+    frame_p->iterating = true;
+}
+
+/* Decode given frame until a sub-message is found or the message is
+   done. Returns the frame to continue with. */
+static struct decode_frame_t *decode_frame_run(struct decode_frame_t *frame_p)
+{
+    const struct pbtools_field_info_t *field_p;
+    int wire_type;
+
+    if (frame_p->scanning) {
+        field_p = message_info_decode_fields(frame_p->decoder_p,
+                                             frame_p->message_p,
+                                             frame_p->info_p,
+                                             frame_p->repeated_infos_p,
+                                             &frame_p->index,
+                                             &wire_type);
+
+        if (field_p != NULL) {
+            return (decode_frame_push_sub_message(frame_p, field_p, wire_type));
+        }
+
+        frame_p->scanning = false;
+        frame_p->index = 0;
+    }
+
+    if (frame_p->iterating) {
+        return (decode_frame_push_item(frame_p));
+    }
+
+    while (frame_p->index < frame_p->info_p->number_of_fields) {
+        field_p = &frame_p->info_p->fields_p[frame_p->index];
+
+        if (field_p->flags & PBTOOLS_FIELD_FLAG_REPEATED) {
+            if (field_is_table_message(field_p)) {
+                if (frame_p->repeated_infos_p[field_p->repeated_index].length > 0) {
+                    decode_frame_begin_items(frame_p, field_p);
+
+                    return (frame_p);
+                }
+            } else {
+                message_info_decode_repeated(
+                    frame_p->decoder_p,
+                    field_p,
+                    &frame_p->repeated_infos_p[field_p->repeated_index],
+                    message_field(frame_p->message_p, field_p->offset));
+            }
+        }
+
+        frame_p->index++;
+    }
+
+    return (decode_frame_pop(frame_p));
+}
+
+int pbtools_message_decode_limited(
+    struct pbtools_message_base_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_message_info_t *info_p,
+    const struct pbtools_decode_limits_t *limits_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_heap_t *heap_p;
+    struct pbtools_heap_t heap;
+    struct decode_frame_t *frame_p;
+    bool limited;
+    int res;
+
+    heap_p = self_p->heap_p;
+    heap = *heap_p;
+    heap_p->max_depth = limits_p->max_depth;
+    heap_p->max_repeated_length = limits_p->max_repeated_length;
+
+    /* Hide memory above the limit from the decoder. */
+    limited = ((size_t)(heap_p->size - heap_p->pos) > limits_p->max_heap_size);
+
+    if (limited) {
+        heap_p->size = (heap_p->pos + (int)limits_p->max_heap_size);
+    }
+
+    decoder_init(&decoder, encoded_p, size, heap_p);
+    frame_p = decode_frame_push(NULL, &decoder, self_p, info_p, NULL, false);
+
+    while (frame_p != NULL) {
+        frame_p = decode_frame_run(frame_p);
+    }
+
+    heap_p->size = heap.size;
+    heap_p->max_depth = heap.max_depth;
+    heap_p->max_repeated_length = heap.max_repeated_length;
+    res = decoder_get_result(&decoder);
+
+    if (limited && (res == -PBTOOLS_OUT_OF_MEMORY)) {
+        res = -PBTOOLS_MEMORY_LIMIT_EXCEEDED;
+    }
+
+    return (res);
+}
+
+#define STREAM_STATE_TAG                                        0
+#define STREAM_STATE_VARINT                                     1
+#define STREAM_STATE_FIXED                                      2
+#define STREAM_STATE_LENGTH                                     3
+#define STREAM_STATE_COPY                                       4
+
+struct pbtools_stream_item_t {
+    struct pbtools_stream_item_t *next_p;
+    /* Followed by the item. */
+    uint64_t data[];
+};
+
+static size_t field_item_size(const struct pbtools_field_info_t *field_p)
+{
+    size_t size;
+
+    switch (field_p->kind) {
+
+    case PBTOOLS_FIELD_KIND_INT64:
+    case PBTOOLS_FIELD_KIND_SINT64:
+    case PBTOOLS_FIELD_KIND_UINT64:
+    case PBTOOLS_FIELD_KIND_FIXED64:
+    case PBTOOLS_FIELD_KIND_SFIXED64:
+    case PBTOOLS_FIELD_KIND_DOUBLE:
+        size = sizeof(uint64_t);
+        break;
+
+    case PBTOOLS_FIELD_KIND_BOOL:
+        size = sizeof(bool);
+        break;
+
+    case PBTOOLS_FIELD_KIND_STRING:
+        size = sizeof(char *);
+        break;
+
+    case PBTOOLS_FIELD_KIND_BYTES:
+    case PBTOOLS_FIELD_KIND_BYTES_VIEW:
+        size = sizeof(struct pbtools_bytes_t);
+        break;
+
+    case PBTOOLS_FIELD_KIND_MESSAGE:
+        size = field_p->message_info_p->size;
+        break;
+
+    default:
+        size = sizeof(uint32_t);
+        break;
+    }
+
+    return (size);
+}
+
+/* Wire type of a single item, also for repeated fields. */
+static int field_item_wire_type(const struct pbtools_field_info_t *field_p)
+{
+    int wire_type;
+
+    switch (field_p->kind) {
+
+    case PBTOOLS_FIELD_KIND_FIXED32:
+    case PBTOOLS_FIELD_KIND_SFIXED32:
+    case PBTOOLS_FIELD_KIND_FLOAT:
+        wire_type = PBTOOLS_WIRE_TYPE_32_BIT;
+        break;
+
+    case PBTOOLS_FIELD_KIND_FIXED64:
+    case PBTOOLS_FIELD_KIND_SFIXED64:
+    case PBTOOLS_FIELD_KIND_DOUBLE:
+        wire_type = PBTOOLS_WIRE_TYPE_64_BIT;
+        break;
+
+    case PBTOOLS_FIELD_KIND_STRING:
+    case PBTOOLS_FIELD_KIND_BYTES:
+    case PBTOOLS_FIELD_KIND_BYTES_VIEW:
+    case PBTOOLS_FIELD_KIND_MESSAGE:
+        wire_type = PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED;
+        break;
+
+    default:
+        wire_type = PBTOOLS_WIRE_TYPE_VARINT;
+        break;
+    }
+
+    return (wire_type);
+}
+
+static void stream_abort(struct pbtools_stream_decoder_t *self_p,
+                         int error)
+{
+    if (self_p->pos >= 0) {
+        self_p->pos = -error;
+    }
+}
+
+static void *stream_alloc(struct pbtools_stream_decoder_t *self_p,
+                          size_t size,
+                          size_t alignment)
+{
+    void *buf_p;
+
+    buf_p = heap_alloc(self_p->heap_p, size, alignment);
+
+    if (buf_p == NULL) {
+        stream_abort(self_p, PBTOOLS_OUT_OF_MEMORY);
+    }
+
+    return (buf_p);
+}
+
+static struct pbtools_stream_frame_t *stream_frame(
+    struct pbtools_stream_decoder_t *self_p)
+{
+    return (&self_p->frames[self_p->depth - 1]);
+}
+
+static void stream_next(struct pbtools_stream_decoder_t *self_p)
+{
+    self_p->state = STREAM_STATE_TAG;
+    self_p->value = 0;
+    self_p->shift = 0;
+}
+
+static void stream_push(struct pbtools_stream_decoder_t *self_p,
+                        struct pbtools_message_base_t *message_p,
+                        const struct pbtools_message_info_t *info_p,
+                        const struct pbtools_field_info_t *packed_field_p,
+                        int left)
+{
+    struct pbtools_stream_frame_t *frame_p;
+    int number_of_repeateds;
+    size_t size;
+    int i;
+
+    if (self_p->depth == PBTOOLS_CONFIG_STREAM_DEPTH) {
+        stream_abort(self_p, PBTOOLS_NESTING_TOO_DEEP);
+
+        return;
+    }
+
+    frame_p = &self_p->frames[self_p->depth];
+    frame_p->message_p = message_p;
+    frame_p->info_p = info_p;
+    frame_p->repeateds_p = NULL;
+    frame_p->packed_field_p = packed_field_p;
+    frame_p->left = left;
+    frame_p->heap_size = self_p->heap_p->size;
+
+    if (info_p != NULL) {
+        number_of_repeateds = 0;
+
+        for (i = 0; i < info_p->number_of_fields; i++) {
+            if (info_p->fields_p[i].flags & PBTOOLS_FIELD_FLAG_REPEATED) {
+                number_of_repeateds = (info_p->fields_p[i].repeated_index + 1);
+            }
+        }
+
+        if (number_of_repeateds > 0) {
+            size = (sizeof(*frame_p->repeateds_p) * (size_t)number_of_repeateds);
+            frame_p->repeateds_p = heap_alloc_top(
+                self_p->heap_p,
+                size,
+                alignof(struct pbtools_stream_repeated_t));
+
+            if (frame_p->repeateds_p == NULL) {
+                stream_abort(self_p, PBTOOLS_OUT_OF_MEMORY);
+
+                return;
+            }
+
+            memset(frame_p->repeateds_p, 0, size);
+        }
+    }
+
+    self_p->depth++;
+}
+
+/* Repeated items are moved from temporary memory to arrays in the
+   workspace. */
+static void stream_finalize_repeateds(struct pbtools_stream_decoder_t *self_p,
+                                      struct pbtools_stream_frame_t *frame_p)
+{
+    const struct pbtools_field_info_t *field_p;
+    struct pbtools_stream_repeated_t *repeated_p;
+    struct pbtools_repeated_message_t *items_p;
+    struct pbtools_stream_item_t *item_p;
+    uint8_t *buf_p;
+    size_t item_size;
+    int i;
+
+    for (i = 0; i < frame_p->info_p->number_of_fields; i++) {
+        field_p = &frame_p->info_p->fields_p[i];
+
+        if ((field_p->flags & PBTOOLS_FIELD_FLAG_REPEATED) == 0) {
+            continue;
+        }
+
+        repeated_p = &frame_p->repeateds_p[field_p->repeated_index];
+
+        if (repeated_p->length == 0) {
+            continue;
+        }
+
+        item_size = field_item_size(field_p);
+        buf_p = stream_alloc(self_p,
+                             item_size * (size_t)repeated_p->length,
+                             alignof(uint64_t));
+
+        if (buf_p == NULL) {
+            return;
+        }
+
+        items_p = message_field(frame_p->message_p, field_p->offset);
+        items_p->length = repeated_p->length;
+        items_p->items_p = buf_p;
+
+        for (item_p = repeated_p->head_p;
+             item_p != NULL;
+             item_p = item_p->next_p) {
+            memcpy(buf_p, &item_p->data[0], item_size);
+            buf_p += item_size;
+        }
+    }
 }
 
-void pbtools_decoder_decode_repeated_string(
-    struct pbtools_decoder_t *self_p,
-    struct pbtools_repeated_info_t *repeated_info_p,
-    struct pbtools_repeated_string_t *repeated_p)
+static void stream_pop(struct pbtools_stream_decoder_t *self_p)
 {
-    decoder_decode_repeated(self_p,
-                            repeated_info_p,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(char *),
-                            (decoder_read_repeated_t)read_repeated_string);
+    struct pbtools_stream_frame_t *frame_p;
+
+    frame_p = stream_frame(self_p);
+
+    /* Items of packed fields belong to the message below. */
+    if (frame_p->info_p != NULL) {
+        stream_finalize_repeateds(self_p, frame_p);
+        self_p->heap_p->size = frame_p->heap_size;
+    }
+
+    self_p->depth--;
 }
 
-int pbtools_alloc_repeated_bytes(struct pbtools_message_base_t *self_p,
-                                 int length,
-                                 struct pbtools_repeated_bytes_t *repeated_p)
+/* Returns where to store the value of current field, in a new item
+   if repeated. */
+static void *stream_field_value(struct pbtools_stream_decoder_t *self_p)
 {
-    return (calloc_repeated(self_p,
-                            length,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(*repeated_p->items_p)));
+    const struct pbtools_field_info_t *field_p;
+    struct pbtools_stream_frame_t *frame_p;
+    struct pbtools_stream_repeated_t *repeated_p;
+    struct pbtools_stream_item_t *item_p;
+
+    field_p = self_p->field_p;
+    frame_p = stream_frame(self_p);
+
+    if (frame_p->packed_field_p != NULL) {
+        frame_p--;
+    }
+
+    if (field_p->flags & PBTOOLS_FIELD_FLAG_REPEATED) {
+        item_p = heap_alloc_top(self_p->heap_p,
+                                sizeof(*item_p) + field_item_size(field_p),
+                                alignof(struct pbtools_stream_item_t));
+
+        if (item_p == NULL) {
+            stream_abort(self_p, PBTOOLS_OUT_OF_MEMORY);
+
+            return (NULL);
+        }
+
+        item_p->next_p = NULL;
+        repeated_p = &frame_p->repeateds_p[field_p->repeated_index];
+
+        if (repeated_p->tail_p == NULL) {
+            repeated_p->head_p = item_p;
+        } else {
+            repeated_p->tail_p->next_p = item_p;
+        }
+
+        repeated_p->tail_p = item_p;
+        repeated_p->length++;
+
+        return (&item_p->data[0]);
+    }
+
+    if (field_p->flags & PBTOOLS_FIELD_FLAG_OPTIONAL) {
+        *(bool *)message_field(frame_p->message_p,
+                               field_p->presence_offset) = true;
+    }
+
+    return (message_field(frame_p->message_p, field_p->offset));
 }
 
-void pbtools_repeated_info_decode_bytes(struct pbtools_repeated_info_t *self_p,
-                                        struct pbtools_decoder_t *decoder_p,
-                                        int wire_type)
+static void stream_store_scalar(struct pbtools_stream_decoder_t *self_p)
 {
-    repeated_info_decode_length_delimited(self_p, decoder_p, wire_type);
+    void *value_p;
+    uint64_t value;
+    uint32_t value_32;
+
+    if (self_p->field_p == NULL) {
+        return;
+    }
+
+    value_p = stream_field_value(self_p);
+
+    if (value_p == NULL) {
+        return;
+    }
+
+    value = self_p->value;
+
+    switch (self_p->field_p->kind) {
+
+    case PBTOOLS_FIELD_KIND_INT64:
+    case PBTOOLS_FIELD_KIND_UINT64:
+    case PBTOOLS_FIELD_KIND_FIXED64:
+    case PBTOOLS_FIELD_KIND_SFIXED64:
+    case PBTOOLS_FIELD_KIND_DOUBLE:
+        memcpy(value_p, &value, sizeof(value));
+        break;
+
+    case PBTOOLS_FIELD_KIND_SINT32:
+        *(int32_t *)value_p = (int32_t)sint64_decode(value);
+        break;
+
+    case PBTOOLS_FIELD_KIND_SINT64:
+        *(int64_t *)value_p = sint64_decode(value);
+        break;
+
+    case PBTOOLS_FIELD_KIND_BOOL:
+        *(bool *)value_p = (value != 0);
+        break;
+
+    default:
+        value_32 = (uint32_t)value;
+        memcpy(value_p, &value_32, sizeof(value_32));
+        break;
+    }
 }
 
-void pbtools_decoder_decode_repeated_bytes(
-    struct pbtools_decoder_t *self_p,
-    struct pbtools_repeated_info_t *repeated_info_p,
-    struct pbtools_repeated_bytes_t *repeated_p)
+static void stream_begin_value(struct pbtools_stream_decoder_t *self_p,
+                               const struct pbtools_field_info_t *field_p,
+                               int wire_type)
 {
-    decoder_decode_repeated(self_p,
-                            repeated_info_p,
-                            (struct pbtools_repeated_message_t *)repeated_p,
-                            sizeof(*repeated_p->items_p),
-                            (decoder_read_repeated_t)read_repeated_bytes);
+    self_p->field_p = field_p;
+    self_p->wire_type = wire_type;
+    self_p->value = 0;
+    self_p->shift = 0;
+
+    switch (wire_type) {
+
+    case PBTOOLS_WIRE_TYPE_VARINT:
+        self_p->state = STREAM_STATE_VARINT;
+        break;
+
+    case PBTOOLS_WIRE_TYPE_64_BIT:
+        self_p->state = STREAM_STATE_FIXED;
+        self_p->left = 8;
+        break;
+
+    case PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED:
+        self_p->state = STREAM_STATE_LENGTH;
+        break;
+
+    case PBTOOLS_WIRE_TYPE_32_BIT:
+        self_p->state = STREAM_STATE_FIXED;
+        self_p->left = 4;
+        break;
+
+    default:
+        stream_abort(self_p, PBTOOLS_BAD_WIRE_TYPE);
+        break;
+    }
 }
 
-static void decoder_init_slice(struct pbtools_decoder_t *self_p,
-                               struct pbtools_decoder_t *parent_p,
-                               int size)
+static void stream_begin_field(struct pbtools_stream_decoder_t *self_p)
 {
-    self_p->buf_p = &parent_p->buf_p[parent_p->pos];
+    const struct pbtools_message_info_t *info_p;
+    const struct pbtools_field_info_t *field_p;
+    uint32_t key;
+    int wire_type;
+    int index;
 
-    if (size <= (parent_p->size - parent_p->pos)) {
-        self_p->size = size;
-        self_p->pos = 0;
+    key = (uint32_t)self_p->value;
+    wire_type = (int)(key & 0x7);
+
+    if ((key >> 3) == 0) {
+        stream_abort(self_p, PBTOOLS_BAD_FIELD_NUMBER);
+
+        return;
+    }
+
+    info_p = stream_frame(self_p)->info_p;
+    index = message_info_find_field(info_p, (int)(key >> 3));
+
+    if (index >= 0) {
+        field_p = &info_p->fields_p[index];
+
+        if ((wire_type != field_item_wire_type(field_p))
+            && ((wire_type != PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)
+                || ((field_p->flags & PBTOOLS_FIELD_FLAG_REPEATED) == 0))) {
+            stream_abort(self_p, PBTOOLS_BAD_WIRE_TYPE);
+
+            return;
+        }
     } else {
-        self_p->size = -PBTOOLS_OUT_OF_DATA;
-        self_p->pos = -PBTOOLS_OUT_OF_DATA;
+        field_p = NULL;
     }
 
-    self_p->heap_p = parent_p->heap_p;
+    stream_begin_value(self_p, field_p, wire_type);
 }
 
-static void decoder_seek(struct pbtools_decoder_t *self_p,
-                         int offset)
+static void stream_end_length_delimited(struct pbtools_stream_decoder_t *self_p)
 {
-    if (self_p->pos < 0) {
+    struct pbtools_decoder_t decoder;
+    int res;
+
+    if (self_p->message_p != NULL) {
+        decoder_init(&decoder,
+                     self_p->buf_p,
+                     (size_t)self_p->value,
+                     self_p->heap_p);
+        decoder_decode_inner(&decoder,
+                             self_p->message_p,
+                             self_p->field_p->message_info_p->decode_inner);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            stream_abort(self_p, -res);
+        }
+    }
+#if PBTOOLS_CONFIG_VALIDATE_UTF8 == 1
+    else if ((self_p->buf_p != NULL)
+             && (self_p->field_p->kind == PBTOOLS_FIELD_KIND_STRING)
+             && !pbtools_utf8_is_valid(self_p->buf_p,
+                                       (size_t)self_p->value)) {
+        self_p->buf_p[0] = '\0';
+        stream_abort(self_p, PBTOOLS_BAD_UTF8);
+    }
+#endif
+
+    stream_next(self_p);
+}
+
+static void stream_begin_message(struct pbtools_stream_decoder_t *self_p)
+{
+    const struct pbtools_message_info_t *info_p;
+    const struct pbtools_field_info_t *field_p;
+    struct pbtools_message_base_t *message_p;
+    void *value_p;
+
+    field_p = self_p->field_p;
+    info_p = field_p->message_info_p;
+    value_p = stream_field_value(self_p);
+
+    if (value_p == NULL) {
         return;
     }
 
-    if (offset < 0) {
-        decoder_abort(self_p, -offset);
-    } else if (((unsigned int)self_p->pos + (unsigned int)offset) > INT_MAX) {
-        decoder_abort(self_p, PBTOOLS_SEEK_OVERFLOW);
+    if (field_p->flags & PBTOOLS_FIELD_FLAG_REPEATED) {
+        message_p = value_p;
     } else {
-        self_p->pos += offset;
+        message_p = stream_alloc(self_p,
+                                 info_p->size,
+                                 alignof(struct pbtools_message_base_t));
 
-        if (self_p->pos > self_p->size) {
-            decoder_abort(self_p, PBTOOLS_OUT_OF_DATA);
+        if (message_p == NULL) {
+            return;
         }
+
+        *(struct pbtools_message_base_t **)value_p = message_p;
+    }
+
+    info_p->init(message_p, self_p->heap_p);
+
+    if (info_p->fields_p != NULL) {
+        stream_push(self_p, message_p, info_p, NULL, self_p->left);
+        stream_next(self_p);
+    } else {
+        /* Messages without a table are decoded when all their bytes
+           have been received. The bytes are kept, as strings and
+           bytes may point into them. */
+        self_p->buf_p = stream_alloc(self_p, (size_t)self_p->left, 1);
+        self_p->message_p = message_p;
     }
 }
 
-void pbtools_decoder_skip_field(struct pbtools_decoder_t *self_p,
-                                int wire_type)
+static void stream_begin_length_delimited(
+    struct pbtools_stream_decoder_t *self_p)
 {
-    uint64_t value;
+    const struct pbtools_field_info_t *field_p;
+    struct pbtools_stream_frame_t *frame_p;
+    struct pbtools_bytes_t *bytes_p;
+    uint8_t *buf_p;
+    void *value_p;
+    int size;
 
-    switch (wire_type) {
+    if (self_p->value >= INT_MAX) {
+        stream_abort(self_p, PBTOOLS_LENGTH_DELIMITED_OVERFLOW);
+
+        return;
+    }
+
+    size = (int)self_p->value;
+    frame_p = stream_frame(self_p);
+
+    if (frame_p->left >= 0) {
+        if (size > frame_p->left) {
+            stream_abort(self_p, PBTOOLS_OUT_OF_DATA);
+
+            return;
+        }
+
+        frame_p->left -= size;
+    }
+
+    self_p->state = STREAM_STATE_COPY;
+    self_p->buf_p = NULL;
+    self_p->left = size;
+    self_p->message_p = NULL;
+    field_p = self_p->field_p;
+
+    if (field_p == NULL) {
+        return;
+    }
+
+    switch (field_p->kind) {
+
+    case PBTOOLS_FIELD_KIND_STRING:
+        buf_p = stream_alloc(self_p, (size_t)size + 1, 1);
+        value_p = stream_field_value(self_p);
+
+        if ((buf_p != NULL) && (value_p != NULL)) {
+            buf_p[size] = '\0';
+            *(char **)value_p = (char *)buf_p;
+            self_p->buf_p = buf_p;
+        }
 
-    case PBTOOLS_WIRE_TYPE_VARINT:
-        (void)decoder_read_varint(self_p);
         break;
 
-    case PBTOOLS_WIRE_TYPE_64_BIT:
-        decoder_seek(self_p, 8);
+    case PBTOOLS_FIELD_KIND_BYTES:
+    case PBTOOLS_FIELD_KIND_BYTES_VIEW:
+        buf_p = stream_alloc(self_p, (size_t)size, 1);
+        bytes_p = stream_field_value(self_p);
+
+        if ((buf_p != NULL) && (bytes_p != NULL)) {
+            bytes_p->buf_p = buf_p;
+            bytes_p->size = (size_t)size;
+            self_p->buf_p = buf_p;
+        }
+
+        break;
+
+    case PBTOOLS_FIELD_KIND_MESSAGE:
+        stream_begin_message(self_p);
         break;
 
-    case PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED:
-        value = decoder_read_length_delimited(self_p, wire_type);
-        decoder_seek(self_p, (int)(int64_t)value);
-        break;
+    default:
+        if ((field_item_wire_type(field_p) != PBTOOLS_WIRE_TYPE_VARINT)
+            && !packed_fixed_size_is_valid(size,
+                                           field_item_wire_type(field_p))) {
+            stream_abort(self_p, PBTOOLS_OUT_OF_DATA);
+
+            return;
+        }
+
+        stream_push(self_p, NULL, NULL, field_p, size);
+        stream_next(self_p);
+        break;
+    }
+}
+
+/* A partial fixed size item in a packed field without full items is
+   dropped. */
+static void stream_begin_packed_item(struct pbtools_stream_decoder_t *self_p,
+                                     struct pbtools_stream_frame_t *frame_p)
+{
+    const struct pbtools_field_info_t *field_p;
+
+    field_p = frame_p->packed_field_p;
+    stream_begin_value(self_p, field_p, field_item_wire_type(field_p));
+
+    if ((self_p->state == STREAM_STATE_FIXED)
+        && (self_p->left > frame_p->left)) {
+        self_p->state = STREAM_STATE_COPY;
+        self_p->buf_p = NULL;
+        self_p->message_p = NULL;
+        self_p->left = frame_p->left;
+        frame_p->left = 0;
+    }
+}
+
+/* Returns true if the varint is complete. */
+static bool stream_read_varint_byte(struct pbtools_stream_decoder_t *self_p,
+                                    uint8_t byte)
+{
+    if (self_p->shift > 63) {
+        stream_abort(self_p, PBTOOLS_VARINT_OVERFLOW);
+
+        return (false);
+    }
+
+    self_p->value |= ((uint64_t)(byte & 0x7f) << self_p->shift);
+    self_p->shift += 7;
+
+    return ((byte & 0x80) == 0);
+}
+
+static void stream_read_byte(struct pbtools_stream_decoder_t *self_p,
+                             uint8_t byte)
+{
+    switch (self_p->state) {
+
+    case STREAM_STATE_TAG:
+        if (stream_read_varint_byte(self_p, byte)) {
+            stream_begin_field(self_p);
+        }
+
+        break;
+
+    case STREAM_STATE_VARINT:
+        if (stream_read_varint_byte(self_p, byte)) {
+            stream_store_scalar(self_p);
+            stream_next(self_p);
+        }
+
+        break;
+
+    case STREAM_STATE_FIXED:
+        self_p->value |= ((uint64_t)byte << self_p->shift);
+        self_p->shift += 8;
+        self_p->left--;
+
+        if (self_p->left == 0) {
+            stream_store_scalar(self_p);
+            stream_next(self_p);
+        }
+
+        break;
+
+    default:
+        if (stream_read_varint_byte(self_p, byte)) {
+            stream_begin_length_delimited(self_p);
+        }
+
+        break;
+    }
+}
+
+void pbtools_stream_decoder_init(struct pbtools_stream_decoder_t *self_p,
+                                 struct pbtools_message_base_t *message_p,
+                                 const struct pbtools_message_info_t *info_p)
+{
+    self_p->heap_p = message_p->heap_p;
+    self_p->pos = 0;
+    self_p->field_p = NULL;
+    self_p->message_p = NULL;
+    self_p->depth = 0;
+    stream_next(self_p);
+    stream_push(self_p, message_p, info_p, NULL, -1);
+}
+
+int pbtools_stream_decoder_feed(struct pbtools_stream_decoder_t *self_p,
+                                const uint8_t *chunk_p,
+                                size_t size)
+{
+    struct pbtools_stream_frame_t *frame_p;
+    const uint8_t *end_p;
+    int left;
+
+    if (self_p->pos < 0) {
+        return (self_p->pos);
+    }
+
+    if (size > (size_t)(INT_MAX - self_p->pos)) {
+        stream_abort(self_p, PBTOOLS_SEEK_OVERFLOW);
+    }
+
+    end_p = &chunk_p[size];
+
+    while (self_p->pos >= 0) {
+        frame_p = stream_frame(self_p);
+
+        /* Between fields. */
+        if ((self_p->state == STREAM_STATE_TAG) && (self_p->shift == 0)) {
+            if (frame_p->left == 0) {
+                stream_pop(self_p);
+                continue;
+            }
+
+            if (frame_p->packed_field_p != NULL) {
+                stream_begin_packed_item(self_p, frame_p);
+            }
+        }
+
+        if (self_p->state == STREAM_STATE_COPY) {
+            if (self_p->left > 0) {
+                if (chunk_p == end_p) {
+                    break;
+                }
+
+                left = (int)(end_p - chunk_p);
+
+                if (left > self_p->left) {
+                    left = self_p->left;
+                }
 
-    case PBTOOLS_WIRE_TYPE_32_BIT:
-        decoder_seek(self_p, 4);
-        break;
+                if (self_p->buf_p != NULL) {
+                    memcpy(&self_p->buf_p[(int)self_p->value - self_p->left],
+                           chunk_p,
+                           (size_t)left);
+                }
 
-    default:
-        decoder_abort(self_p, PBTOOLS_BAD_WIRE_TYPE);
-        break;
-    }
-}
+                chunk_p += left;
+                self_p->left -= left;
+            }
 
-void pbtools_bytes_init(struct pbtools_bytes_t *self_p)
-{
-    self_p->size = 0;
-}
+            if (self_p->left == 0) {
+                stream_end_length_delimited(self_p);
+            }
+        } else {
+            if (chunk_p == end_p) {
+                break;
+            }
 
-void *pbtools_message_new(
-    void *workspace_p,
-    size_t size,
-    size_t message_size,
-    pbtools_message_init_t message_init)
-{
-    struct pbtools_message_base_t *self_p;
-    struct pbtools_heap_t *heap_p;
+            if (frame_p->left == 0) {
+                stream_abort(self_p, PBTOOLS_OUT_OF_DATA);
+                break;
+            }
 
-    heap_p = heap_new(workspace_p, size);
+            if (frame_p->left > 0) {
+                frame_p->left--;
+            }
 
-    if (heap_p == NULL) {
-        return (NULL);
+            stream_read_byte(self_p, *chunk_p);
+            chunk_p++;
+        }
     }
 
-    self_p = heap_alloc(heap_p,
-                        message_size,
-                        alignof(struct pbtools_message_base_t));
-
-    if (self_p != NULL) {
-        message_init(self_p, heap_p);
+    if (self_p->pos >= 0) {
+        self_p->pos += (int)size;
     }
 
-    return (self_p);
+    return (self_p->pos < 0 ? self_p->pos : 0);
 }
 
-int pbtools_message_encode(
-    struct pbtools_message_base_t *self_p,
-    uint8_t *encoded_p,
-    size_t size,
-    pbtools_message_encode_inner_t message_encode_inner)
+int pbtools_stream_decoder_finish(struct pbtools_stream_decoder_t *self_p)
 {
-    struct pbtools_encoder_t encoder;
+    if (self_p->pos < 0) {
+        return (self_p->pos);
+    }
 
-    encoder_init(&encoder, encoded_p, size);
-    message_encode_inner(&encoder, self_p);
+    if ((self_p->depth != 1)
+        || (self_p->state != STREAM_STATE_TAG)
+        || (self_p->shift != 0)) {
+        return (-PBTOOLS_OUT_OF_DATA);
+    }
 
-    return (encoder_get_result(&encoder));
+    stream_pop(self_p);
+
+    return (self_p->pos);
 }
 
-int pbtools_message_decode(
-    struct pbtools_message_base_t *self_p,
-    const uint8_t *encoded_p,
-    size_t size,
-    pbtools_message_decode_inner_t message_decode_inner)
+static void message_info_validate(struct pbtools_decoder_t *decoder_p,
+                                  const struct pbtools_message_info_t *info_p,
+                                  int depth);
+
+static void validate_sub_message(struct pbtools_decoder_t *decoder_p,
+                                 const struct pbtools_message_info_t *info_p,
+                                 int depth)
 {
     struct pbtools_decoder_t decoder;
+    int size;
 
-    decoder_init(&decoder, encoded_p, size, self_p->heap_p);
-    message_decode_inner(&decoder, self_p);
+    if (depth == PBTOOLS_CONFIG_VALIDATE_DEPTH) {
+        decoder_abort(decoder_p, PBTOOLS_NESTING_TOO_DEEP);
 
-    return (decoder_get_result(&decoder));
+        return;
+    }
+
+    size = (int)decoder_read_length_delimited(
+        decoder_p,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+    decoder_init_slice(&decoder, decoder_p, size);
+    message_info_validate(&decoder, info_p, depth + 1);
+    decoder_seek(decoder_p, decoder_get_result(&decoder));
 }
 
-int pbtools_sub_message_alloc(
-    struct pbtools_message_base_t **message_pp,
-    struct pbtools_heap_t *heap_p,
-    size_t sub_message_size,
-    pbtools_message_init_t message_init)
+/* Packed varints must fill the slice exactly, while a partial fixed
+   size item at the end is only accepted without full items, as when
+   decoding. */
+static void validate_packed(struct pbtools_decoder_t *decoder_p,
+                            int item_wire_type)
 {
-    struct pbtools_message_base_t *message_p;
+    struct pbtools_decoder_t decoder;
+    int size;
 
-    message_p = heap_alloc(heap_p,
-                           sub_message_size,
-                           alignof(struct pbtools_message_base_t));
+    size = (int)decoder_read_length_delimited(
+        decoder_p,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
 
-    if (message_p == NULL) {
-        return (-1);
-    }
+    if (item_wire_type == PBTOOLS_WIRE_TYPE_VARINT) {
+        decoder_init_slice(&decoder, decoder_p, size);
 
-    message_init(message_p, heap_p);
-    *message_pp = message_p;
+        while (pbtools_decoder_available(&decoder)) {
+            decoder_skip_varint(&decoder);
+        }
 
-    return (0);
+        decoder_seek(decoder_p, decoder_get_result(&decoder));
+    } else if (packed_fixed_size_is_valid(size, item_wire_type)) {
+        decoder_seek(decoder_p, size);
+    } else {
+        decoder_abort(decoder_p, PBTOOLS_OUT_OF_DATA);
+    }
 }
 
-int pbtools_alloc_repeated(
-    struct pbtools_repeated_message_t *repeated_p,
-    int length,
-    struct pbtools_heap_t *heap_p,
-    size_t item_size,
-    pbtools_message_init_t message_init)
+#if PBTOOLS_CONFIG_VALIDATE_UTF8 == 1
+static void validate_string(struct pbtools_decoder_t *decoder_p)
 {
-    int i;
-    char *item_p;
-
-    repeated_p->items_p = heap_alloc(heap_p,
-                                     item_size * (size_t)length,
-                                     alignof(uint64_t));
+    uint64_t size;
 
-    if (repeated_p->items_p == NULL) {
-        return (-1);
-    }
+    size = decoder_read_length_delimited(decoder_p,
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
 
-    item_p = repeated_p->items_p;
+    if ((size <= (uint64_t)decoder_left(decoder_p))
+        && !pbtools_utf8_is_valid(&decoder_p->buf_p[decoder_p->pos], size)) {
+        decoder_abort(decoder_p, PBTOOLS_BAD_UTF8);
 
-    for (i = 0; i < length; i++) {
-        message_init(item_p, heap_p);
-        item_p += item_size;
+        return;
     }
 
-    repeated_p->length = length;
-
-    return (0);
+    decoder_seek(decoder_p, (int)size);
 }
+#endif
 
-void pbtools_encode_repeated_inner(
-    struct pbtools_encoder_t *encoder_p,
-    int field_number,
-    struct pbtools_repeated_message_t *repeated_p,
-    size_t item_size,
-    pbtools_message_encode_inner_t message_encode_inner)
+static void validate_field(struct pbtools_decoder_t *decoder_p,
+                           int wire_type,
+                           const struct pbtools_field_info_t *field_p,
+                           int depth)
 {
-    int i;
-    int pos;
-    char *item_p;
+    int item_wire_type;
 
-    item_p = repeated_p->items_p;
-    item_p += ((size_t)repeated_p->length * item_size);
+    item_wire_type = field_item_wire_type(field_p);
 
-    for (i = 0; i < repeated_p->length; i++) {
-        item_p -= item_size;
-        pos = encoder_p->pos;
-        message_encode_inner(encoder_p, item_p);
-        encoder_write_length_delimited(encoder_p,
-                                       field_number,
-                                       (uint64_t)(pos - encoder_p->pos));
+    if (wire_type == item_wire_type) {
+        if (field_p->kind == PBTOOLS_FIELD_KIND_MESSAGE) {
+            validate_sub_message(decoder_p, field_p->message_info_p, depth);
+#if PBTOOLS_CONFIG_VALIDATE_UTF8 == 1
+        } else if (field_p->kind == PBTOOLS_FIELD_KIND_STRING) {
+            validate_string(decoder_p);
+#endif
+        } else {
+            pbtools_decoder_skip_field(decoder_p, wire_type);
+        }
+    } else if ((field_p->flags & PBTOOLS_FIELD_FLAG_REPEATED)
+               && (wire_type == PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+        validate_packed(decoder_p, item_wire_type);
+    } else {
+        decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
     }
 }
 
-static void decode_repeated_inner_item(
-    struct pbtools_repeated_info_t *repeated_info_p,
-    size_t item_size,
-    pbtools_message_decode_inner_t message_decode_inner,
-    char **item_pp,
-    int *length_p)
+/* Messages without a table are decoded by generated code, which
+   skips unknown fields and rejects known fields of another wire
+   type. */
+static void message_info_validate_code(
+    struct pbtools_decoder_t *decoder_p,
+    const struct pbtools_message_info_t *info_p,
+    int depth)
 {
-    int size;
-    struct pbtools_decoder_t decoder;
+    const struct pbtools_field_info_t *field_p;
+    int field_number;
+    int wire_type;
+    int i;
 
-    size = (int)decoder_read_length_delimited(&repeated_info_p->decoder,
-                                              PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
-    decoder_init_slice(&decoder, &repeated_info_p->decoder, size);
-    message_decode_inner(&decoder, *item_pp);
-    decoder_seek(&repeated_info_p->decoder, decoder_get_result(&decoder));
-    *item_pp += item_size;
-    (*length_p)++;
+    while (pbtools_decoder_available(decoder_p)) {
+        field_number = pbtools_decoder_read_tag(decoder_p, &wire_type);
+        field_p = NULL;
+
+        for (i = 0; i < info_p->number_of_validate_fields; i++) {
+            if (info_p->validate_fields_p[i].field_number == field_number) {
+                field_p = &info_p->validate_fields_p[i];
+                break;
+            }
+        }
+
+        if (field_p == NULL) {
+            pbtools_decoder_skip_field(decoder_p, wire_type);
+        } else {
+            validate_field(decoder_p, wire_type, field_p, depth);
+        }
+    }
 }
 
-void pbtools_decode_repeated_inner(
-    struct pbtools_decoder_t *decoder_p,
-    struct pbtools_repeated_info_t *repeated_info_p,
-    struct pbtools_repeated_message_t *repeated_p,
-    size_t item_size,
-    pbtools_message_init_t message_init,
-    pbtools_message_decode_inner_t message_decode_inner)
+/* Walks the fields like pbtools_message_info_decode_inner(), but
+   nothing is stored. */
+static void message_info_validate(struct pbtools_decoder_t *decoder_p,
+                                  const struct pbtools_message_info_t *info_p,
+                                  int depth)
 {
-    int res;
+    const struct pbtools_field_info_t *fields_p;
+    const struct pbtools_field_info_t *field_p;
+    int number_of_fields;
     int wire_type;
-    int tag;
-    int length;
-    char *item_p;
+    int index;
 
-    if (repeated_info_p->length == 0) {
-        return;
-    }
+    fields_p = info_p->fields_p;
+    number_of_fields = info_p->number_of_fields;
 
-    res = pbtools_alloc_repeated(repeated_p,
-                                 repeated_info_p->length,
-                                 repeated_info_p->decoder.heap_p,
-                                 item_size,
-                                 message_init);
+    if (fields_p == NULL) {
+        message_info_validate_code(decoder_p, info_p, depth);
 
-    if (res != 0) {
         return;
     }
 
-    length = 0;
-    item_p = repeated_p->items_p;
-    decode_repeated_inner_item(repeated_info_p,
-                               item_size,
-                               message_decode_inner,
-                               &item_p,
-                               &length);
+    index = 0;
 
-    while (are_more_items_to_decode(repeated_info_p, length)) {
-        tag = pbtools_decoder_read_tag(&repeated_info_p->decoder, &wire_type);
+    while (pbtools_decoder_available(decoder_p)) {
+        field_p = &fields_p[index];
 
-        if (tag == repeated_info_p->tag) {
-            decode_repeated_inner_item(repeated_info_p,
-                                       item_size,
-                                       message_decode_inner,
-                                       &item_p,
-                                       &length);
+        if (decoder_read_expected_tag(decoder_p,
+                                      field_p->field_number,
+                                      field_p->wire_type)) {
+            wire_type = field_p->wire_type;
         } else {
-            pbtools_decoder_skip_field(&repeated_info_p->decoder, wire_type);
-        }
-    }
+            index = message_info_find_field(
+                info_p,
+                pbtools_decoder_read_tag(decoder_p, &wire_type));
+
+            if (index < 0) {
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                index = 0;
+                continue;
+            }
 
-    res = decoder_get_result(&repeated_info_p->decoder);
+            field_p = &fields_p[index];
+        }
 
-    if (res < 0) {
-        decoder_abort(decoder_p, -res);
-    }
-}
+        validate_field(decoder_p, wire_type, field_p, depth);
 
-void pbtools_encoder_sub_message_encode(
-    struct pbtools_encoder_t *self_p,
-    int field_number,
-    struct pbtools_message_base_t *message_p,
-    pbtools_message_encode_inner_t encode_inner)
-{
-    int pos;
+        if (!field_is_followed_by_itself(field_p)) {
+            index++;
 
-    if (message_p != NULL) {
-        pos = self_p->pos;
-        encode_inner(self_p, message_p);
-        encoder_write_length_delimited(self_p,
-                                       field_number,
-                                       (uint64_t)(pos - self_p->pos));
+            if (index == number_of_fields) {
+                index = 0;
+            }
+        }
     }
 }
 
-void pbtools_encoder_sub_message_encode_always(
-    struct pbtools_encoder_t *self_p,
-    int field_number,
-    struct pbtools_message_base_t *message_p,
-    pbtools_message_encode_inner_t encode_inner)
-{
-    int pos;
-
-    pos = self_p->pos;
-    encode_inner(self_p, message_p);
-    encoder_write_tagged_varint_always(self_p,
-                                       field_number,
-                                       PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
-                                       (uint64_t)(pos - self_p->pos));
-}
-
-void pbtools_decoder_sub_message_decode(
-    struct pbtools_decoder_t *self_p,
-    int wire_type,
-    struct pbtools_message_base_t **message_pp,
-    size_t sub_message_size,
-    pbtools_message_init_t message_init,
-    pbtools_message_decode_inner_t decode_inner)
+int pbtools_message_validate(const uint8_t *encoded_p,
+                             size_t size,
+                             const struct pbtools_message_info_t *info_p)
 {
-    struct pbtools_message_base_t *message_p;
-    int size;
     struct pbtools_decoder_t decoder;
 
-    message_p = decoder_heap_alloc(
-        self_p,
-        sub_message_size,
-        alignof(struct pbtools_message_base_t));
-
-    if (message_p == NULL) {
-        return;
-    }
+    decoder_init(&decoder, encoded_p, size, NULL);
+    message_info_validate(&decoder, info_p, 1);
 
-    message_init(message_p, self_p->heap_p);
-    size = (int)decoder_read_length_delimited(self_p, wire_type);
-    decoder_init_slice(&decoder, self_p, size);
-    decode_inner(&decoder, message_p);
-    decoder_seek(self_p, decoder_get_result(&decoder));
-    *message_pp = message_p;
+    return (decoder_get_result(&decoder));
 }
 
 void pbtools_repeated_info_init(struct pbtools_repeated_info_t *self_p,
@@ -2579,6 +7308,8 @@ void pbtools_repeated_info_init(struct pbtools_repeated_info_t *self_p,
 {
     self_p->length = 0;
     self_p->tag = tag;
+    self_p->last_run_p = NULL;
+    self_p->heap_size = -1;
 }
 
 void pbtools_repeated_info_decode(struct pbtools_repeated_info_t *self_p,
@@ -2634,6 +7365,26 @@ const char *pbtools_error_code_to_string(int code)
         string_p = "Length delimited overflow";
         break;
 
+    case PBTOOLS_NESTING_TOO_DEEP:
+        string_p = "Nesting too deep";
+        break;
+
+    case PBTOOLS_REPEATED_FIELD_TOO_LONG:
+        string_p = "Repeated field too long";
+        break;
+
+    case PBTOOLS_MEMORY_LIMIT_EXCEEDED:
+        string_p = "Memory limit exceeded";
+        break;
+
+    case PBTOOLS_BAD_UTF8:
+        string_p = "Bad UTF-8";
+        break;
+
+    case PBTOOLS_STORAGE_OVERFLOW:
+        string_p = "Storage overflow";
+        break;
+
     default:
         string_p = "Unknown error";
         break;
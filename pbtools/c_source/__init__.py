@@ -120,6 +120,50 @@ struct {message.full_name_snake_case}_repeated_t {{
 }};\
 '''
 
+CALLBACKS_STRUCT_FMT = '''\
+/**
+ * Callbacks of {message.full_name} repeated sub-message fields.
+ */
+struct {message.full_name_snake_case}_callbacks_t {{
+{members}
+}};
+'''
+
+CALLBACKS_MEMBER_FMT = '''\
+    void (*on_{field.name_snake_case})(
+        void *arg_p,
+        const struct {field.full_type_snake_case}_t *item_p);\
+'''
+
+COLUMNS_STRUCT_FMT = '''\
+/**
+ * Columns of repeated {message.full_name} items.
+ */
+struct {message.full_name_snake_case}_columns_t {{
+    int length;
+{members}}};
+'''
+
+COLUMNS_MEMBER_FMT = '''\
+    struct {{
+        {type} *values_p;
+        uint8_t *present_p;
+    }} {field.name_snake_case};
+'''
+
+REPEATED_COLUMNS_STRUCT_FMT = '''\
+/**
+ * Columns of {message.full_name} repeated sub-message fields.
+ */
+struct {message.full_name_snake_case}_repeated_columns_t {{
+{members}
+}};
+'''
+
+REPEATED_COLUMNS_MEMBER_FMT = '''\
+    struct {field.full_type_snake_case}_columns_t *{field.name_snake_case}_p;\
+'''
+
 ENUM_FMT = '''\
 /**
  * Enum {full_name}.
@@ -160,6 +204,88 @@ int {message.full_name_snake_case}_decode(
     size_t size);
 '''
 
+DECODE_PADDED_DECLARATION_FMT = '''\
+int {message.full_name_snake_case}_decode_padded(
+    struct {message.full_name_snake_case}_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+'''
+
+DECODE_SEGMENTS_DECLARATION_FMT = '''\
+int {message.full_name_snake_case}_decode_segments(
+    struct {message.full_name_snake_case}_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+'''
+
+VALIDATE_DECLARATION_FMT = '''\
+int {message.full_name_snake_case}_validate(
+    const uint8_t *encoded_p,
+    size_t size);
+'''
+
+DECODE_MASKED_DECLARATION_FMT = '''\
+int {message.full_name_snake_case}_decode_masked(
+    struct {message.full_name_snake_case}_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_field_mask_t *mask_p);
+'''
+
+DECODE_LIMITED_DECLARATION_FMT = '''\
+int {message.full_name_snake_case}_decode_limited(
+    struct {message.full_name_snake_case}_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_decode_limits_t *limits_p);
+'''
+
+DECODE_CALLBACKS_DECLARATION_FMT = '''\
+int {message.full_name_snake_case}_decode_callbacks(
+    struct {message.full_name_snake_case}_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct {message.full_name_snake_case}_callbacks_t *callbacks_p,
+    void *arg_p);
+'''
+
+DECODE_COLUMNS_DECLARATION_FMT = '''\
+int {message.full_name_snake_case}_decode_columns(
+    struct {message.full_name_snake_case}_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct {message.full_name_snake_case}_repeated_columns_t *columns_p);
+'''
+
+ENCODE_COLUMNS_DECLARATION_FMT = '''\
+int {message.full_name_snake_case}_encode_columns(
+    struct {message.full_name_snake_case}_t *self_p,
+    uint8_t *encoded_p,
+    size_t size,
+    const struct {message.full_name_snake_case}_repeated_columns_t *columns_p);
+'''
+
+STREAM_DECODER_DECLARATION_FMT = '''\
+void {message.full_name_snake_case}_decoder_init(
+    struct pbtools_stream_decoder_t *decoder_p,
+    struct {message.full_name_snake_case}_t *self_p);
+
+int {message.full_name_snake_case}_decoder_feed(
+    struct pbtools_stream_decoder_t *decoder_p,
+    const uint8_t *chunk_p,
+    size_t size);
+
+int {message.full_name_snake_case}_decoder_finish(
+    struct pbtools_stream_decoder_t *decoder_p);
+'''
+
+SET_STORAGE_DECLARATION_FMT = '''\
+int {message.full_name_snake_case}_{field.name_snake_case}_set_storage(
+    struct {message.full_name_snake_case}_t *self_p,
+    {item_type} *items_p,
+    int capacity);
+'''
+
 REPEATED_DECLARATION_FMT = '''\
 int {message.full_name_snake_case}_{field.name_snake_case}_alloc(
     struct {message.full_name_snake_case}_t *self_p,
@@ -171,6 +297,12 @@ int {message.full_name_snake_case}_{field.name_snake_case}_alloc(
     struct {message.full_name_snake_case}_t *self_p);
 '''
 
+LAZY_SUB_MESSAGE_GET_DECLARATION_FMT = '''\
+struct {field.full_type_snake_case}_t *
+{message.full_name_snake_case}_{field.name_snake_case}_get(
+    struct {message.full_name_snake_case}_t *self_p);
+'''
+
 MESSAGE_DECLARATIONS_FMT = '''\
 void {message.full_name_snake_case}_init(
     struct {message.full_name_snake_case}_t *self_p,
@@ -221,19 +353,25 @@ void {name}_encode_inner(
 {encode_body}\
 }}
 
+{decode_tables}\
 void {name}_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct {name}_t *self_p)
 {{
 {unused_decode}\
+    uint32_t key;
+{decode_variables}\
     int wire_type;
 {repeated_infos}
     while (pbtools_decoder_available(decoder_p)) {{
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {{
+        key = pbtools_decoder_read_key(decoder_p);
+{decode_dispatch}
+        switch ({decode_switch}) {{
 
 {decode_body}
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+{decode_default}\
             break;
         }}
     }}
@@ -241,6 +379,136 @@ void {name}_decode_inner(
 }}
 '''
 
+DECODE_HASH_TABLES_FMT = '''\
+static const uint32_t {name}_keys[{size}] = {{
+{keys}
+}};
+
+static const {displacement_type} {name}_displacements[{number_of_buckets}] = {{
+{displacements}
+}};
+
+'''
+
+DECODE_HASH_VARIABLES = '''\
+    uint32_t hash;
+    uint32_t slot;
+'''
+
+DECODE_HASH_DISPATCH_FMT = '''\
+        hash = (key * {multiplier}u);
+        slot = (((hash >> {slot_shift}) & {slot_mask})
+                ^ {name}_displacements[hash >> {bucket_shift}]);
+
+        if ({name}_keys[slot] != key) {{
+            slot = {size};
+        }}
+'''
+
+TABLE_MESSAGE_DEFINITIONS_FMT = '''\
+static const struct pbtools_field_info_t {name}_fields[] = {{
+{fields}
+}};
+
+{sorted_indexes}\
+const struct pbtools_message_info_t {name}_info = {{
+    sizeof(struct {name}_t),
+    (pbtools_message_init_t){name}_init,
+    (pbtools_message_encode_inner_t){name}_encode_inner,
+    (pbtools_message_decode_inner_t){name}_decode_inner,
+    {number_of_fields},
+    &{name}_fields[0],
+    {sorted_indexes_p},
+    0,
+    NULL
+}};
+
+void {name}_init(
+    struct {name}_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{{
+    self_p->base.heap_p = heap_p;
+{members_init}
+}}
+
+void {name}_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct {name}_t *self_p)
+{{
+    pbtools_message_info_encode_inner(encoder_p, &self_p->base, &{name}_info);
+}}
+
+void {name}_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct {name}_t *self_p)
+{{
+{repeated_infos}\
+    pbtools_message_info_decode_inner(decoder_p,
+                                      &self_p->base,
+                                      &{name}_info,
+                                      {repeated_infos_p});
+}}
+'''
+
+TABLE_FIELD_FMT = '''\
+    {{
+        {field.field_number},
+        {wire_type},
+        PBTOOLS_FIELD_KIND_{kind},
+        {flags},
+        {repeated_index},
+        offsetof(struct {name}_t, {member}),
+        {presence_offset},
+        {message_info}
+    }}\
+'''
+
+MESSAGE_INFO_DEFINITION_FMT = '''\
+{validate_fields}\
+const struct pbtools_message_info_t {name}_info = {{
+    sizeof(struct {name}_t),
+    (pbtools_message_init_t){name}_init,
+    (pbtools_message_encode_inner_t){name}_encode_inner,
+    (pbtools_message_decode_inner_t){name}_decode_inner,
+    0,
+    NULL,
+    NULL,
+    {number_of_validate_fields},
+    {validate_fields_p}
+}};
+'''
+
+SORTED_INDEXES_FMT = '''\
+static const uint16_t {name}_sorted_indexes[] = {{
+{indexes}
+}};
+
+'''
+
+VALIDATE_FIELDS_FMT = '''\
+static const struct pbtools_field_info_t {name}_validate_fields[] = {{
+{fields}
+}};
+
+'''
+
+VALIDATE_FIELD_FMT = '''\
+    {{
+        {field.field_number},
+        {wire_type},
+        PBTOOLS_FIELD_KIND_{kind},
+        {flags},
+        0,
+        0,
+        0,
+        {message_info}
+    }}\
+'''
+
+MESSAGE_INFO_DECLARATION_FMT = '''\
+extern const struct pbtools_message_info_t {message.full_name_snake_case}_info;
+'''
+
 ENCODE_MEMBER_FMT = '''\
     pbtools_encoder_write_{field.full_type_snake_case}(\
 encoder_p, {field.field_number}, {ref}self_p->{field.name_snake_case});
@@ -283,6 +551,14 @@ ENCODE_SUB_MESSAGE_MEMBER_FMT = '''\
         (pbtools_message_encode_inner_t){field.full_type_snake_case}_encode_inner);
 '''
 
+ENCODE_LAZY_SUB_MESSAGE_MEMBER_FMT = '''\
+    pbtools_encoder_lazy_message_encode(
+        encoder_p,
+        {field.field_number},
+        &self_p->{field.name_snake_case},
+        (pbtools_message_encode_inner_t){field.full_type_snake_case}_encode_inner);
+'''
+
 ENCODE_ENUM_FMT = '''\
     pbtools_encoder_write_enum(encoder_p, {field.field_number}, \
 self_p->{field.name_snake_case});
@@ -348,136 +624,164 @@ ENCODE_ONEOF_FMT = '''\
     }}
 '''
 
+DECODE_CASE_FMT = '''\
+        case {case}:
+{label}{member}{prediction}            break;
+'''
+
+DECODE_DEFAULT_FMT = '''
+            switch (key >> 3) {{
+
+{cases}
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }}
+
+'''
+
+DECODE_DEFAULT_SKIP_FMT = '''\
+            pbtools_decoder_skip_field(decoder_p, wire_type);
+'''
+
+DECODE_CASE_LABEL_FMT = '''\
+        field_{field.field_number}:
+'''
+
+DECODE_EXPECTED_TAG_FMT = '''
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  {field.field_number},
+                                                  {wire_type})) {{
+                goto field_{field.field_number};
+            }}
+
+'''
+
 DECODE_MEMBER_FMT = '''\
-        case {field.field_number}:
             self_p->{field.name_snake_case} = \
-pbtools_decoder_read_{field.full_type_snake_case}(decoder_p, wire_type);
-            break;
+pbtools_decoder_read_{field.full_type_snake_case}_unchecked(decoder_p);
 '''
 
 DECODE_OPTIONAL_MEMBER_FMT = '''\
-        case {field.field_number}:
             self_p->{field.name_snake_case}.is_present = true;
             self_p->{field.name_snake_case}.value = \
-pbtools_decoder_read_{field.full_type_snake_case}(decoder_p, wire_type);
-            break;
+pbtools_decoder_read_{field.full_type_snake_case}_unchecked(decoder_p);
 '''
 
 DECODE_MEMBER_BYTES_FMT = '''\
-        case {field.field_number}:
-            pbtools_decoder_read_bytes(\
-decoder_p, wire_type, &self_p->{field.name_snake_case});
-            break;
+            pbtools_decoder_read_bytes_unchecked(\
+decoder_p, &self_p->{field.name_snake_case});
 '''
 
 DECODE_OPTIONAL_MEMBER_BYTES_FMT = '''\
-        case {field.field_number}:
             self_p->{field.name_snake_case}.is_present = true;
-            pbtools_decoder_read_bytes(\
-decoder_p, wire_type, &self_p->{field.name_snake_case}.value);
-            break;
+            pbtools_decoder_read_bytes_unchecked(\
+decoder_p, &self_p->{field.name_snake_case}.value);
+'''
+
+DECODE_MEMBER_BYTES_VIEW_FMT = '''\
+            pbtools_decoder_read_bytes_view_unchecked(\
+decoder_p, &self_p->{field.name_snake_case});
+'''
+
+DECODE_OPTIONAL_MEMBER_BYTES_VIEW_FMT = '''\
+            self_p->{field.name_snake_case}.is_present = true;
+            pbtools_decoder_read_bytes_view_unchecked(\
+decoder_p, &self_p->{field.name_snake_case}.value);
 '''
 
 DECODE_MEMBER_STRING_FMT = '''\
-        case {field.field_number}:
-            pbtools_decoder_read_string(\
-decoder_p, wire_type, &self_p->{field.name_snake_case}_p);
-            break;
+            pbtools_decoder_read_string_unchecked(\
+decoder_p, &self_p->{field.name_snake_case}_p);
 '''
 
 DECODE_OPTIONAL_MEMBER_STRING_FMT = '''\
-        case {field.field_number}:
             self_p->{field.name_snake_case}.is_present = true;
-            pbtools_decoder_read_string(\
-decoder_p, wire_type, &self_p->{field.name_snake_case}.value_p);
-            break;
+            pbtools_decoder_read_string_unchecked(\
+decoder_p, &self_p->{field.name_snake_case}.value_p);
 '''
 
 DECODE_REPEATED_SCALAR_VALUE_FMT = '''\
-        case {field.field_number}:
             pbtools_repeated_info_decode_{field.type}(
                 &repeated_info_{field.name_snake_case},
                 decoder_p,
-                wire_type);
-            break;
+                {wire_type});
 '''
 
 DECODE_REPEATED_ENUM_FMT = '''\
-        case {field.field_number}:
             pbtools_repeated_info_decode_int32(
                 &repeated_info_{field.name_snake_case},
                 decoder_p,
-                wire_type);
-            break;
+                {wire_type});
 '''
 
 DECODE_REPEATED_FIELD_FMT = '''\
-        case {field.field_number}:
             pbtools_repeated_info_decode(&repeated_info_{field.name_snake_case},
                                          decoder_p,
-                                         wire_type);
-            break;
+                                         {wire_type});
 '''
 
 DECODE_SUB_MESSAGE_MEMBER_FMT = '''\
-        case {field.field_number}:
-            pbtools_decoder_sub_message_decode(
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->{field.name_snake_case}_p,
                 sizeof(struct {field.full_type_snake_case}_t),
                 (pbtools_message_init_t){field.full_type_snake_case}_init,
                 (pbtools_message_decode_inner_t){field.full_type_snake_case}_decode_inner);
-            break;
+'''
+
+DECODE_LAZY_SUB_MESSAGE_MEMBER_FMT = '''\
+            pbtools_decoder_read_lazy_message_unchecked(
+                decoder_p,
+                &self_p->{field.name_snake_case});
 '''
 
 DECODE_ENUM_FMT = '''\
-        case {field.field_number}:
-            self_p->{field.name_snake_case} = pbtools_decoder_read_enum(\
-decoder_p, wire_type);
-            break;
+            self_p->{field.name_snake_case} = \
+pbtools_decoder_read_enum_unchecked(decoder_p);
 '''
 
 DECODE_OPTIONAL_ENUM_FMT = '''\
-        case {field.field_number}:
             self_p->{field.name_snake_case}.is_present = true;
-            self_p->{field.name_snake_case}.value = pbtools_decoder_read_enum(\
-decoder_p, wire_type);
-            break;
+            self_p->{field.name_snake_case}.value = \
+pbtools_decoder_read_enum_unchecked(decoder_p);
 '''
 
 DECODE_ONEOF_FMT = '''\
-        case {field.field_number}:
+        case {case}:
             {message.full_name_snake_case}_{field.name_snake_case}_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 '''
 
 DECODE_ONEOF_MEMBER_BYTES_FMT = '''\
-    pbtools_decoder_read_bytes(decoder_p,
-                               wire_type,
-                               &self_p->{field.name_snake_case});
+    pbtools_decoder_read_bytes_unchecked(decoder_p,
+                                         &self_p->{field.name_snake_case});
+'''
+
+DECODE_ONEOF_MEMBER_BYTES_VIEW_FMT = '''\
+    pbtools_decoder_read_bytes_view_unchecked(
+        decoder_p,
+        &self_p->{field.name_snake_case});
 '''
 
 DECODE_ONEOF_MEMBER_STRING_FMT = '''\
-    pbtools_decoder_read_string(decoder_p,
-                                wire_type,
-                                &self_p->{field.name_snake_case}_p);
+    pbtools_decoder_read_string_unchecked(decoder_p,
+                                          &self_p->{field.name_snake_case}_p);
 '''
 
 DECODE_ONEOF_MEMBER_FMT = '''\
     self_p->{field.name_snake_case} = \
-pbtools_decoder_read_{field.full_type_snake_case}(
-        decoder_p,
-        wire_type);
+pbtools_decoder_read_{field.full_type_snake_case}_unchecked(decoder_p);
 '''
 
 DECODE_ONEOF_ENUM_FMT = '''\
-    self_p->{field.name_snake_case} = pbtools_decoder_read_enum(
-        decoder_p,
-        wire_type);
+    self_p->{field.name_snake_case} = \
+pbtools_decoder_read_enum_unchecked(decoder_p);
 '''
 
 INIT_ONEOF_FIELD_FMT = '''\
@@ -508,7 +812,6 @@ int {message.full_name_snake_case}_{field.name_snake_case}_alloc(
 DECODE_ONEOF_FIELD_FMT = '''\
 static void {message.full_name_snake_case}_{field.name_snake_case}_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct {message.full_name_snake_case}_t *self_p)
 {{
     {message.full_name_snake_case}_{field.name_snake_case}_init(self_p);
@@ -519,14 +822,12 @@ static void {message.full_name_snake_case}_{field.name_snake_case}_decode(
 DECODE_ONEOF_SUB_MESSAGE_FIELD_FMT = '''\
 static void {message.full_name_snake_case}_{field.name_snake_case}_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct {message.full_name_snake_case}_t *self_p)
 {{
     self_p->{oneof.name_snake_case} = \
 {oneof.full_name_snake_case}_{field.name_snake_case}_e;
-    pbtools_decoder_sub_message_decode(
+    pbtools_decoder_sub_message_decode_unchecked(
         decoder_p,
-        wire_type,
         (struct pbtools_message_base_t **)&self_p->{field.name_snake_case}_p,
         sizeof(struct {field.full_type_snake_case}_t),
         (pbtools_message_init_t){field.full_type_snake_case}_init,
@@ -574,118 +875,846 @@ int {message.full_name_snake_case}_decode(
 }}
 '''
 
-REPEATED_DEFINITION_FMT = '''\
-int {message.full_name_snake_case}_{field.name_snake_case}_alloc(
+DECODE_PADDED_DEFINITION_FMT = '''\
+int {message.full_name_snake_case}_decode_padded(
+    struct {message.full_name_snake_case}_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{{
+    return (pbtools_message_decode_padded(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)\
+{message.full_name_snake_case}_decode_inner));
+}}
+'''
+
+DECODE_SEGMENTS_DEFINITION_FMT = '''\
+int {message.full_name_snake_case}_decode_segments(
     struct {message.full_name_snake_case}_t *self_p,
+    const struct pbtools_segment_t *segments_p,
     int length)
 {{
-    return (pbtools_alloc_repeated_{field.full_type_snake_case}(
+    return (pbtools_message_decode_segments(
                 &self_p->base,
+                segments_p,
                 length,
-                &self_p->{field.name_snake_case}));
+                (pbtools_message_decode_inner_t)\
+{message.full_name_snake_case}_decode_inner));
 }}
 '''
 
-SUB_MESSAGE_ALLOC_DEFINITION_FMT = '''\
-int {message.full_name_snake_case}_{field.name_snake_case}_alloc(
-    struct {message.full_name_snake_case}_t *self_p)
+VALIDATE_DEFINITION_FMT = '''\
+int {message.full_name_snake_case}_validate(
+    const uint8_t *encoded_p,
+    size_t size)
 {{
-    return (pbtools_sub_message_alloc(
-                (struct pbtools_message_base_t **)&self_p->{field.name_snake_case}_p,
-                self_p->base.heap_p,
-                sizeof(struct {field.full_type_snake_case}_t),
-                (pbtools_message_init_t){field.full_type_snake_case}_init));
+    return (pbtools_message_validate(encoded_p,
+                                     size,
+                                     &{message.full_name_snake_case}_info));
 }}
 '''
 
-REPEATED_ENUM_DEFINITION_FMT = '''\
-int {message.full_name_snake_case}_{field.name_snake_case}_alloc(
+DECODE_MASKED_DEFINITION_FMT = '''\
+int {message.full_name_snake_case}_decode_masked(
     struct {message.full_name_snake_case}_t *self_p,
-    int length)
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_field_mask_t *mask_p)
 {{
-    return (pbtools_alloc_repeated_int32(
+    return (pbtools_message_decode_masked(
                 &self_p->base,
-                length,
-                &self_p->{field.name_snake_case}));
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)\
+{message.full_name_snake_case}_decode_inner,
+                mask_p));
 }}
 '''
 
-REPEATED_MESSAGE_DEFINITION_ALLOC_FMT = '''\
-int {message.full_name_snake_case}_{field.name_snake_case}_alloc(
+DECODE_LIMITED_DEFINITION_FMT = '''\
+int {message.full_name_snake_case}_decode_limited(
     struct {message.full_name_snake_case}_t *self_p,
-    int length)
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_decode_limits_t *limits_p)
 {{
-    return (pbtools_alloc_repeated(
-                (struct pbtools_repeated_message_t *)&self_p->{field.name_snake_case},
-                length,
-                self_p->base.heap_p,
-                sizeof(struct {field.full_type_snake_case}_t),
-                (pbtools_message_init_t){field.full_type_snake_case}_init));
+    return (pbtools_message_decode_limited(&self_p->base,
+                                           encoded_p,
+                                           size,
+                                           &{message.full_name_snake_case}_info,
+                                           limits_p));
 }}
 '''
 
-REPEATED_MESSAGE_DEFINITION_FMT = '''\
-void {message.full_name_snake_case}_encode_repeated_inner(
-    struct pbtools_encoder_t *encoder_p,
-    int field_number,
-    struct {message.full_name_snake_case}_repeated_t *repeated_p)
+DECODE_CALLBACKS_DEFINITION_FMT = '''\
+int {message.full_name_snake_case}_decode_callbacks(
+    struct {message.full_name_snake_case}_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct {message.full_name_snake_case}_callbacks_t *callbacks_p,
+    void *arg_p)
 {{
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct {message.full_name_snake_case}_t),
-        (pbtools_message_encode_inner_t){message.full_name_snake_case}_encode_inner);
+    struct pbtools_repeated_callback_t callbacks[] = {{
+{callbacks}
+    }};
+
+    return (pbtools_message_decode_callbacks(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)\
+{message.full_name_snake_case}_decode_inner,
+                &callbacks[0],
+                {number_of_callbacks},
+                arg_p));
 }}
+'''
 
-void {message.full_name_snake_case}_decode_repeated_inner(
+DECODE_CALLBACK_FMT = '''\
+        {{
+            {field.field_number},
+            sizeof(struct {field.full_type_snake_case}_t),
+            (pbtools_message_init_t){field.full_type_snake_case}_init,
+            (pbtools_item_callback_t)callbacks_p->on_{field.name_snake_case}
+        }}'''
+
+COLUMNS_DEFINITIONS_FMT = '''\
+static void {name}_columns_alloc(
     struct pbtools_decoder_t *decoder_p,
-    struct pbtools_repeated_info_t *repeated_info_p,
-    struct {message.full_name_snake_case}_repeated_t *repeated_p)
+    struct {name}_columns_t *columns_p,
+    int length)
 {{
-    pbtools_decode_repeated_inner(
-        decoder_p,
-        repeated_info_p,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct {message.full_name_snake_case}_t),
-        (pbtools_message_init_t){message.full_name_snake_case}_init,
-        (pbtools_message_decode_inner_t){message.full_name_snake_case}_decode_inner);
+{unused_alloc}\
+    columns_p->length = length;
+{allocs}\
 }}
-'''
 
-REPEATED_FINALIZER_FMT = '''\
-    pbtools_decoder_decode_repeated_{field.full_type_snake_case}(
-        decoder_p,
-        &repeated_info_{field.name_snake_case},
-        &self_p->{field.name_snake_case});\
-'''
-
-REPEATED_ENUM_FINALIZER_FMT = '''\
+static void {name}_decode_columns_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct {name}_columns_t *columns_p,
+    int index)
+{{
+{unused_decode}\
+    uint32_t key;
+    int wire_type;
+
+    while (pbtools_decoder_available(decoder_p)) {{
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {{
+
+{decode_body}
+        default:
+            wire_type = (int)(key & 0x7);
+{decode_default}\
+            break;
+        }}
+    }}
+}}
+
+static void {name}_encode_columns_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    const struct {name}_columns_t *columns_p)
+{{
+    int index;
+    int pos;
+
+    for (index = columns_p->length - 1; index >= 0; index--) {{
+        pos = encoder_p->pos;
+{encode_body}\
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }}
+}}
+'''
+
+COLUMN_ALLOC_FMT = '''\
+    columns_p->{field.name_snake_case}.values_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        length,
+        sizeof({type}));
+    columns_p->{field.name_snake_case}.present_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        (length + 7) / 8,
+        sizeof(uint8_t));
+'''
+
+DECODE_COLUMN_FMT = '''\
+        case PBTOOLS_KEY({field.field_number}, {wire_type}):
+{label}\
+            columns_p->{field.name_snake_case}.values_p[index] = \
+pbtools_decoder_read_{read_type}_unchecked(decoder_p);
+            columns_p->{field.name_snake_case}.present_p[index / 8] |= \
+(uint8_t)(1u << (index % 8));
+{prediction}\
+            break;
+'''
+
+ENCODE_COLUMN_FMT = '''\
+        if ((columns_p->{field.name_snake_case}.values_p != NULL)
+            && PBTOOLS_COLUMN_IS_PRESENT(
+                columns_p->{field.name_snake_case}.present_p,
+                index)) {{
+            pbtools_encoder_write_{write_type}(
+                encoder_p,
+                {field.field_number},
+                columns_p->{field.name_snake_case}.values_p[index]);
+        }}
+'''
+
+ENCODE_COLUMNS_DEFINITION_FMT = '''\
+int {message.full_name_snake_case}_encode_columns(
+    struct {message.full_name_snake_case}_t *self_p,
+    uint8_t *encoded_p,
+    size_t size,
+    const struct {message.full_name_snake_case}_repeated_columns_t *columns_p)
+{{
+    struct pbtools_repeated_columns_t columns[] = {{
+{columns}
+    }};
+
+    return (pbtools_message_encode_columns(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)\
+{message.full_name_snake_case}_encode_inner,
+                &columns[0],
+                {number_of_columns}));
+}}
+'''
+
+DECODE_COLUMNS_DEFINITION_FMT = '''\
+int {message.full_name_snake_case}_decode_columns(
+    struct {message.full_name_snake_case}_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct {message.full_name_snake_case}_repeated_columns_t *columns_p)
+{{
+    struct pbtools_repeated_columns_t columns[] = {{
+{columns}
+    }};
+
+    return (pbtools_message_decode_columns(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)\
+{message.full_name_snake_case}_decode_inner,
+                &columns[0],
+                {number_of_columns}));
+}}
+'''
+
+REPEATED_COLUMNS_FMT = '''\
+        {{
+            {field.field_number},
+            columns_p->{field.name_snake_case}_p,
+            (pbtools_columns_alloc_t){field.full_type_snake_case}_columns_alloc,
+            (pbtools_columns_decode_inner_t)\
+{field.full_type_snake_case}_decode_columns_inner,
+            (pbtools_columns_encode_t)\
+{field.full_type_snake_case}_encode_columns_inner
+        }}'''
+
+STREAM_DECODER_DEFINITION_FMT = '''\
+void {message.full_name_snake_case}_decoder_init(
+    struct pbtools_stream_decoder_t *decoder_p,
+    struct {message.full_name_snake_case}_t *self_p)
+{{
+    pbtools_stream_decoder_init(decoder_p,
+                                &self_p->base,
+                                &{message.full_name_snake_case}_info);
+}}
+
+int {message.full_name_snake_case}_decoder_feed(
+    struct pbtools_stream_decoder_t *decoder_p,
+    const uint8_t *chunk_p,
+    size_t size)
+{{
+    return (pbtools_stream_decoder_feed(decoder_p, chunk_p, size));
+}}
+
+int {message.full_name_snake_case}_decoder_finish(
+    struct pbtools_stream_decoder_t *decoder_p)
+{{
+    return (pbtools_stream_decoder_finish(decoder_p));
+}}
+'''
+
+REPEATED_DEFINITION_FMT = '''\
+int {message.full_name_snake_case}_{field.name_snake_case}_alloc(
+    struct {message.full_name_snake_case}_t *self_p,
+    int length)
+{{
+    return (pbtools_alloc_repeated_{field.full_type_snake_case}(
+                &self_p->base,
+                length,
+                &self_p->{field.name_snake_case}));
+}}
+'''
+
+SET_STORAGE_DEFINITION_FMT = '''\
+int {message.full_name_snake_case}_{field.name_snake_case}_set_storage(
+    struct {message.full_name_snake_case}_t *self_p,
+    {item_type} *items_p,
+    int capacity)
+{{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->{field.name_snake_case},
+                items_p,
+                capacity));
+}}
+'''
+
+SUB_MESSAGE_ALLOC_DEFINITION_FMT = '''\
+int {message.full_name_snake_case}_{field.name_snake_case}_alloc(
+    struct {message.full_name_snake_case}_t *self_p)
+{{
+    return (pbtools_sub_message_alloc(
+                (struct pbtools_message_base_t **)&self_p->{field.name_snake_case}_p,
+                self_p->base.heap_p,
+                sizeof(struct {field.full_type_snake_case}_t),
+                (pbtools_message_init_t){field.full_type_snake_case}_init));
+}}
+'''
+
+LAZY_SUB_MESSAGE_DEFINITION_FMT = '''\
+int {message.full_name_snake_case}_{field.name_snake_case}_alloc(
+    struct {message.full_name_snake_case}_t *self_p)
+{{
+    return (pbtools_lazy_message_alloc(
+                &self_p->{field.name_snake_case},
+                self_p->base.heap_p,
+                sizeof(struct {field.full_type_snake_case}_t),
+                (pbtools_message_init_t){field.full_type_snake_case}_init));
+}}
+
+struct {field.full_type_snake_case}_t *
+{message.full_name_snake_case}_{field.name_snake_case}_get(
+    struct {message.full_name_snake_case}_t *self_p)
+{{
+    return (pbtools_lazy_message_get(
+                &self_p->{field.name_snake_case},
+                self_p->base.heap_p,
+                sizeof(struct {field.full_type_snake_case}_t),
+                (pbtools_message_init_t){field.full_type_snake_case}_init,
+                (pbtools_message_decode_inner_t){field.full_type_snake_case}_decode_inner));
+}}
+'''
+
+REPEATED_ENUM_DEFINITION_FMT = '''\
+int {message.full_name_snake_case}_{field.name_snake_case}_alloc(
+    struct {message.full_name_snake_case}_t *self_p,
+    int length)
+{{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->{field.name_snake_case}));
+}}
+'''
+
+REPEATED_MESSAGE_DEFINITION_ALLOC_FMT = '''\
+int {message.full_name_snake_case}_{field.name_snake_case}_alloc(
+    struct {message.full_name_snake_case}_t *self_p,
+    int length)
+{{
+    return (pbtools_alloc_repeated(
+                (struct pbtools_repeated_message_t *)&self_p->{field.name_snake_case},
+                length,
+                self_p->base.heap_p,
+                sizeof(struct {field.full_type_snake_case}_t),
+                (pbtools_message_init_t){field.full_type_snake_case}_init));
+}}
+'''
+
+REPEATED_MESSAGE_DEFINITION_FMT = '''\
+void {message.full_name_snake_case}_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct {message.full_name_snake_case}_repeated_t *repeated_p)
+{{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {{
+        pos = encoder_p->pos;
+        {message.full_name_snake_case}_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }}
+}}
+
+void {message.full_name_snake_case}_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct {message.full_name_snake_case}_repeated_t *repeated_p)
+{{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {{
+        return;
+    }}
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct {message.full_name_snake_case}_t));
+
+    for (i = 0; i < repeated_p->length; i++) {{
+        {message.full_name_snake_case}_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }}
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {{
+        {message.full_name_snake_case}_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }}
+}}
+'''
+
+REPEATED_FINALIZER_FMT = '''\
+    pbtools_decoder_decode_repeated_{field.full_type_snake_case}(
+        decoder_p,
+        &repeated_info_{field.name_snake_case},
+        &self_p->{field.name_snake_case});\
+'''
+
+REPEATED_BYTES_VIEW_FINALIZER_FMT = '''\
+    pbtools_decoder_decode_repeated_bytes_view(
+        decoder_p,
+        &repeated_info_{field.name_snake_case},
+        &self_p->{field.name_snake_case});\
+'''
+
+REPEATED_ENUM_FINALIZER_FMT = '''\
     pbtools_decoder_decode_repeated_int32(
         decoder_p,
         &repeated_info_{field.name_snake_case},
         &self_p->{field.name_snake_case});\
 '''
 
-REPEATED_MESSAGE_FINALIZER_FMT = '''\
-    {field.full_type_snake_case}_decode_repeated_inner(
-        decoder_p,
-        &repeated_info_{field.name_snake_case},
-        &self_p->{field.name_snake_case});\
-'''
+REPEATED_MESSAGE_FINALIZER_FMT = '''\
+    {field.full_type_snake_case}_decode_repeated_inner(
+        decoder_p,
+        &repeated_info_{field.name_snake_case},
+        &self_p->{field.name_snake_case});\
+'''
+
+VIEW_STRUCT_FMT = '''\
+/**
+ * View of an encoded {message.full_name}.
+ */
+struct {message.full_name_snake_case}_view_t {{
+    struct pbtools_view_t base;
+    int offsets[{number_of_offsets}];
+}};
+'''
+
+VIEW_DECLARATION_FMT = '''\
+/**
+ * Fields of an encoded {message.full_name} read on demand.
+ */
+void {message.full_name_snake_case}_view_init(
+    struct {message.full_name_snake_case}_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int {message.full_name_snake_case}_view_error(
+    struct {message.full_name_snake_case}_view_t *self_p);
+'''
+
+VIEW_FIELDS_FMT = '''\
+static const struct pbtools_view_field_t {message.full_name_snake_case}_view_fields[] = {{
+{fields}
+}};
+'''
+
+VIEW_DEFINITION_FMT = '''\
+void {message.full_name_snake_case}_view_init(
+    struct {message.full_name_snake_case}_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      {fields},
+                      {number_of_fields},
+                      &self_p->offsets[0]);
+}}
+
+int {message.full_name_snake_case}_view_error(
+    struct {message.full_name_snake_case}_view_t *self_p)
+{{
+    return (pbtools_view_get_error(&self_p->base));
+}}
+'''
+
+VIEW_GET_SIGNATURE_FMT = '''\
+{type} {message.full_name_snake_case}_view_get_{field.name_snake_case}(
+    struct {message.full_name_snake_case}_view_t *self_p)\
+'''
+
+VIEW_GET_BODY_FMT = '''\
+{{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, {index}, &decoder)) {{
+        return ({default});
+    }}
+
+    return ({read});
+}}
+'''
+
+VIEW_HAS_SIGNATURE_FMT = '''\
+bool {message.full_name_snake_case}_view_has_{field.name_snake_case}(
+    struct {message.full_name_snake_case}_view_t *self_p)\
+'''
+
+VIEW_HAS_BODY_FMT = '''\
+{{
+    struct pbtools_decoder_t decoder;
+
+    return (pbtools_view_seek(&self_p->base, {index}, &decoder));
+}}
+'''
+
+VIEW_GET_BYTES_BODY_FMT = '''\
+{{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+
+    value.buf_p = NULL;
+    value.size = 0;
+
+    if (pbtools_view_seek(&self_p->base, {index}, &decoder)) {{
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }}
+
+    return (value);
+}}
+'''
+
+VIEW_GET_SUB_MESSAGE_SIGNATURE_FMT = '''\
+bool {message.full_name_snake_case}_view_get_{field.name_snake_case}(
+    struct {message.full_name_snake_case}_view_t *self_p,
+    struct {field.full_type_snake_case}_view_t *value_p)\
+'''
+
+VIEW_GET_SUB_MESSAGE_BODY_FMT = '''\
+{{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+    bool found;
+
+    value.buf_p = NULL;
+    value.size = 0;
+    found = pbtools_view_seek(&self_p->base, {index}, &decoder);
+
+    if (found) {{
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }}
+
+    {field.full_type_snake_case}_view_init(value_p, value.buf_p, value.size);
+
+    return (found);
+}}
+'''
+
+VIEW_GET_ONEOF_SIGNATURE_FMT = '''\
+enum {oneof.full_name_snake_case}_e {message.full_name_snake_case}_view_get_{oneof.name_snake_case}(
+    struct {message.full_name_snake_case}_view_t *self_p)\
+'''
+
+VIEW_GET_ONEOF_BODY_FMT = '''\
+{{
+    return ((enum {oneof.full_name_snake_case}_e)(
+                pbtools_view_last_field(&self_p->base,
+                                        {index},
+                                        {number_of_fields}) + 1));
+}}
+'''
+
+VIEW_BEGIN_SIGNATURE_FMT = '''\
+void {message.full_name_snake_case}_view_{field.name_snake_case}_begin(
+    struct {message.full_name_snake_case}_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)\
+'''
+
+VIEW_BEGIN_BODY_FMT = '''\
+{{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, {index});
+}}
+'''
+
+VIEW_NEXT_SIGNATURE_FMT = '''\
+bool {message.full_name_snake_case}_view_{field.name_snake_case}_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    {type} *value_p)\
+'''
+
+VIEW_NEXT_BODY_FMT = '''\
+{{
+    if (!pbtools_view_iterator_next(iterator_p)) {{
+        return (false);
+    }}
+
+    *value_p = {read};
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {{
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }}
+
+    return (true);
+}}
+'''
+
+VIEW_NEXT_BYTES_BODY_FMT = '''\
+{{
+    if (!pbtools_view_iterator_next(iterator_p)) {{
+        return (false);
+    }}
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, value_p);
+
+    return (true);
+}}
+'''
+
+VIEW_NEXT_SUB_MESSAGE_BODY_FMT = '''\
+{{
+    struct pbtools_bytes_t value;
+
+    if (!pbtools_view_iterator_next(iterator_p)) {{
+        return (false);
+    }}
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, &value);
+    {field.full_type_snake_case}_view_init(value_p, value.buf_p, value.size);
+
+    return (true);
+}}
+'''
+
+OPTIONAL_STRUCT_MEMBER_FMT = '''\
+    struct {{
+        bool is_present;
+        {type}{value_name_snake_case};
+    }} {name_snake_case};\
+'''
+
+
+VARINT_TYPES = [
+    'int32',
+    'int64',
+    'uint32',
+    'uint64',
+    'sint32',
+    'sint64',
+    'bool'
+]
+
+FIXED_32_BIT_TYPES = ['fixed32', 'sfixed32', 'float']
+
+FIXED_64_BIT_TYPES = ['fixed64', 'sfixed64', 'double']
+
+
+def is_packed(field):
+    if field.type_kind == 'enum':
+        return True
+
+    return field.type not in ['string', 'bytes'] and field.type_kind != 'message'
+
+
+def wire_type(field):
+    if field.repeated:
+        return 'PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED'
+    else:
+        return item_wire_type(field)
+
+
+def item_wire_type(field):
+    if field.type_kind == 'enum' or field.type in VARINT_TYPES:
+        return 'PBTOOLS_WIRE_TYPE_VARINT'
+    elif field.type in FIXED_32_BIT_TYPES:
+        return 'PBTOOLS_WIRE_TYPE_32_BIT'
+    elif field.type in FIXED_64_BIT_TYPES:
+        return 'PBTOOLS_WIRE_TYPE_64_BIT'
+    else:
+        return 'PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED'
+
+
+WIRE_TYPES = {
+    'PBTOOLS_WIRE_TYPE_VARINT': 0,
+    'PBTOOLS_WIRE_TYPE_64_BIT': 1,
+    'PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED': 2,
+    'PBTOOLS_WIRE_TYPE_32_BIT': 5
+}
+
+
+def key(field, wire_type):
+    return (field.field_number << 3) | WIRE_TYPES[wire_type]
+
+
+def decode_case(field, wire_type, perfect_hash):
+    if perfect_hash is None:
+        return f'PBTOOLS_KEY({field.field_number}, {wire_type})'
+    else:
+        return str(perfect_hash.slot(key(field, wire_type)))
+
+
+def generate_decode_hash_tables(name, perfect_hash):
+    wire_types = {value: wire_type for wire_type, value in WIRE_TYPES.items()}
+    keys = []
+
+    for slot_key in perfect_hash.slots:
+        if slot_key is None:
+            keys.append('    0')
+        else:
+            field_number = (slot_key >> 3)
+            wire_type = wire_types[slot_key & 0x7]
+            keys.append(f'    PBTOOLS_KEY({field_number}, {wire_type})')
+
+    displacements = []
+
+    for i in range(0, len(perfect_hash.displacements), 8):
+        line = ', '.join([
+            str(displacement)
+            for displacement in perfect_hash.displacements[i:i + 8]
+        ])
+        displacements.append(f'    {line}')
+
+    if perfect_hash.size <= 256:
+        displacement_type = 'uint8_t'
+    else:
+        displacement_type = 'uint16_t'
+
+    return DECODE_HASH_TABLES_FMT.format(
+        name=name,
+        size=perfect_hash.size,
+        keys=',\n'.join(keys),
+        displacement_type=displacement_type,
+        number_of_buckets=len(perfect_hash.displacements),
+        displacements=',\n'.join(displacements))
+
 
-OPTIONAL_STRUCT_MEMBER_FMT = '''\
-    struct {{
-        bool is_present;
-        {type}{value_name_snake_case};
-    }} {name_snake_case};\
-'''
+def is_sparse(keys):
+    """Returns True if a switch on given keys is not compiled to a jump
+    table, which GCC and Clang only do for somewhat dense cases.
+
+    """
+
+    if len(keys) < 4:
+        return False
+
+    return max(keys) - min(keys) + 1 > 8 * len(keys)
+
+
+class PerfectHash:
+    """A perfect hash of keys by hash and displace. The top bits of the
+    key times the multiplier selects a bucket with a displacement,
+    which is xor:ed with the following bits to give the slot.
+
+    """
+
+    def __init__(self, keys):
+        slot_bits = max(len(keys) - 1, 1).bit_length()
+        multiplier = 0x9e3779b1
+
+        while True:
+            for _ in range(256):
+                bucket_bits = max(slot_bits - 1, 1)
+
+                if self.displace(keys, multiplier, slot_bits, bucket_bits):
+                    return
+
+                multiplier = ((multiplier * 1103515245 + 12345) & 0xffffffff)
+                multiplier |= 1
+
+            slot_bits += 1
+
+    def displace(self, keys, multiplier, slot_bits, bucket_bits):
+        size = (1 << slot_bits)
+        bucket_shift = 32 - bucket_bits
+        slot_shift = bucket_shift - slot_bits
+        buckets = [[] for _ in range(1 << bucket_bits)]
+
+        for key in keys:
+            value = ((key * multiplier) & 0xffffffff)
+            buckets[value >> bucket_shift].append(
+                (key, (value >> slot_shift) & (size - 1)))
+
+        slots = size * [None]
+        displacements = len(buckets) * [0]
+        order = sorted(range(len(buckets)), key=lambda i: -len(buckets[i]))
+
+        for i in order:
+            for displacement in range(size):
+                bucket_slots = [
+                    slot ^ displacement for _, slot in buckets[i]
+                ]
+
+                if len(set(bucket_slots)) != len(bucket_slots):
+                    continue
+
+                if all(slots[slot] is None for slot in bucket_slots):
+                    break
+            else:
+                return False
+
+            displacements[i] = displacement
+
+            for (key, _), slot in zip(buckets[i], bucket_slots):
+                slots[slot] = key
+
+        self.multiplier = multiplier
+        self.size = size
+        self.slot_shift = slot_shift
+        self.bucket_shift = bucket_shift
+        self.slots = slots
+        self.displacements = displacements
+
+        return True
+
+    def slot(self, key):
+        return self.slots.index(key)
 
 
 class Options:
 
-    def __init__(self, enums_upper_case=False):
+    def __init__(self,
+                 enums_upper_case=False,
+                 zero_copy=False,
+                 lazy_sub_messages=False,
+                 table_driven=False,
+                 padded_input=False,
+                 callbacks=False,
+                 caller_storage=False,
+                 segmented_input=False,
+                 columns=False,
+                 views=False):
         self.enums_upper_case = enums_upper_case
+        self.zero_copy = zero_copy
+        self.lazy_sub_messages = lazy_sub_messages
+        self.table_driven = table_driven
+        self.padded_input = padded_input
+        self.callbacks = callbacks
+        self.caller_storage = caller_storage
+        self.segmented_input = segmented_input
+        self.columns = columns
+        self.views = views
 
 
 class Generator:
@@ -698,6 +1727,21 @@ class Generator:
         self.parsed = parsed
         self.header_name = header_name
         self.enums_upper_case = options.enums_upper_case
+        self.zero_copy = options.zero_copy
+        self.lazy_sub_messages = options.lazy_sub_messages
+        self.table_driven = options.table_driven
+        self.padded_input = options.padded_input
+        self.callbacks = options.callbacks
+        self.caller_storage = options.caller_storage
+        self.segmented_input = options.segmented_input
+        self.columns = options.columns
+        self.views = options.views
+
+        # Views into the encoded buffer can't be null terminated, so
+        # strings are bytes in zero copy mode.
+        if self.zero_copy:
+            for message in self.messages:
+                self.make_strings_bytes(message)
 
     @property
     def messages(self):
@@ -707,6 +1751,42 @@ class Generator:
     def package(self):
         return self.parsed.package
 
+    def is_lazy(self, field):
+        if field.type_kind != 'message' or field.repeated:
+            return False
+
+        return self.lazy_sub_messages or field.lazy
+
+    def is_table_driven(self, message):
+        """Messages with oneofs or lazy sub-messages are not supported by
+        the table interpreter and are always generated as code.
+
+        """
+
+        if not self.table_driven:
+            return False
+
+        if not message.fields or message.oneofs:
+            return False
+
+        if len(message.repeated_fields) > 255:
+            return False
+
+        return not any(self.is_lazy(field) for field in message.fields)
+
+    def make_strings_bytes(self, message):
+        for field in message.fields:
+            if field.type == 'string':
+                field.type = 'bytes'
+
+        for oneof in message.oneofs:
+            for field in oneof.fields:
+                if field.type == 'string':
+                    field.type = 'bytes'
+
+        for sub_message in message.messages:
+            self.make_strings_bytes(sub_message)
+
     def generate_struct_member_fmt(self, type, name_snake_case, type_kind):
         if type in ['int32', 'int64', 'uint32', 'uint64']:
             type = f'{type}_t '
@@ -779,126 +1859,565 @@ class Generator:
         else:
             type = f'struct {type}_repeated_t'
 
-        return f'    {type} {name_snake_case};'
+        return f'    {type} {name_snake_case};'
+
+    def generate_struct_members(self, message):
+        members = []
+
+        for field in message.fields:
+            if field.repeated:
+                member = self.generate_repeated_struct_member_fmt(
+                    field.full_type_snake_case,
+                    field.name_snake_case,
+                    field.type_kind)
+            elif field.optional:
+                member = self.generate_optional_struct_member_fmt(
+                    field.full_type_snake_case,
+                    field.name_snake_case,
+                    field.type_kind)
+            elif self.is_lazy(field):
+                member = (f'    struct pbtools_lazy_message_t '
+                          f'{field.name_snake_case};')
+            else:
+                member = self.generate_struct_member_fmt(
+                    field.full_type_snake_case,
+                    field.name_snake_case,
+                    field.type_kind)
+
+            members.append(member)
+
+        for oneof in message.oneofs:
+            members.append(
+                ONEOF_FMT.format(oneof=oneof,
+                                 members=self.generate_oneof_members(oneof)))
+
+        members = '\n'.join(members)
+
+        if members:
+            members += '\n'
+
+        return members
+
+    def generate_repeated_struct(self, message):
+        return REPEATED_MESSAGE_STRUCT_FMT.format(message=message)
+
+    def generate_enum_members(self, enum):
+        lines = []
+
+        for field in enum.fields:
+            line = ENUM_MEMBER_FMT.format(enum=enum, field=field)
+
+            if self.enums_upper_case:
+                line = line.upper()
+
+            lines.append(line)
+
+        return ',\n'.join(lines)
+
+    def generate_enum_type(self, enum):
+        return [
+            ENUM_FMT.format(full_name=enum.full_name,
+                            name=enum.full_name_snake_case,
+                            members=self.generate_enum_members(enum))
+        ]
+
+    def generate_oneof_members(self, oneof):
+        members = []
+
+        for field in oneof.fields:
+            member = self.generate_struct_member_fmt(
+                field.full_type_snake_case,
+                field.name_snake_case,
+                field.type_kind)
+            members.append(f'    {member}')
+
+        return '\n'.join(members)
+
+    def generate_oneof_choices(self, oneof):
+        members = [
+            f'    {oneof.full_name_snake_case}_none_e = 0'
+        ]
+
+        for i, field in enumerate(oneof.fields, 1):
+            members.append(
+                f'    {oneof.full_name_snake_case}_{field.name_snake_case}_e = {i}')
+
+        return ENUM_FMT.format(full_name=oneof.full_name,
+                               name=f'{oneof.full_name_snake_case}',
+                               members=',\n'.join(members))
+
+    def generate_oneof_type(self, oneof):
+        types = [self.generate_oneof_choices(oneof)]
+
+        return ['\n'.join(types)]
+
+    def generate_message_types(self, message):
+        types = []
+
+        for enum in message.enums:
+            types += self.generate_enum_type(enum)
+
+        for sub_message in message.messages:
+            types += self.generate_message_types(sub_message)
+
+        for oneof in message.oneofs:
+            types += self.generate_oneof_type(oneof)
+
+        types.append(
+            MESSAGE_STRUCT_FMT.format(
+                message=message,
+                repeated_struct=self.generate_repeated_struct(message),
+                members=self.generate_struct_members(message)))
+
+        if self.views:
+            types.append(
+                VIEW_STRUCT_FMT.format(
+                    message=message,
+                    number_of_offsets=max(len(self.view_fields(message)), 1)))
+
+        return types
+
+    def generate_types(self):
+        types = []
+
+        for enum in self.parsed.enums:
+            types += self.generate_enum_type(enum)
+
+        columns = set()
+
+        for message in self.messages:
+            types += self.generate_message_types(message)
+            types += self.generate_callbacks_type(message)
+            types += self.generate_columns_types(message, columns)
+
+        return '\n'.join(types)
+
+    def repeated_message_fields(self, message):
+        return [
+            field
+            for field in message.repeated_fields
+            if field.type_kind == 'message'
+        ]
+
+    def callback_fields(self, message):
+        if not self.callbacks:
+            return []
+
+        return self.repeated_message_fields(message)
+
+    def storage_fields(self, message):
+        if not self.caller_storage:
+            return []
+
+        return [
+            field
+            for field in message.repeated_fields
+            if is_packed(field)
+        ]
+
+    def storage_item_type(self, field):
+        if field.type_kind == 'enum':
+            return 'int32_t'
+        elif field.type in ['sint32', 'sint64']:
+            return f'{field.type[1:]}_t'
+        elif field.type in ['fixed32', 'fixed64']:
+            return f'uint{field.type[5:]}_t'
+        elif field.type in ['sfixed32', 'sfixed64']:
+            return f'int{field.type[6:]}_t'
+        elif field.type in ['float', 'double', 'bool']:
+            return field.type
+        else:
+            return f'{field.type}_t'
+
+    def generate_set_storages(self, message, fmt):
+        return [
+            fmt.format(message=message,
+                       field=field,
+                       item_type=self.storage_item_type(field))
+            for field in self.storage_fields(message)
+        ]
+
+    def generate_callbacks_type(self, message):
+        fields = self.callback_fields(message)
+
+        if not fields:
+            return []
+
+        members = [
+            CALLBACKS_MEMBER_FMT.format(field=field)
+            for field in fields
+        ]
+
+        return [
+            CALLBACKS_STRUCT_FMT.format(message=message,
+                                        members='\n'.join(members))
+        ]
+
+    def find_message(self, full_name_snake_case, messages=None):
+        if messages is None:
+            messages = self.messages
+
+        for message in messages:
+            if message.full_name_snake_case == full_name_snake_case:
+                return message
+
+            found = self.find_message(full_name_snake_case, message.messages)
+
+            if found is not None:
+                return found
+
+        return None
+
+    def repeated_columns_fields(self, message):
+        """Repeated sub-message fields that may be decoded into columns,
+        which requires their item type to be defined in this file.
+
+        """
+
+        if not self.columns:
+            return []
+
+        return [
+            field
+            for field in self.repeated_message_fields(message)
+            if self.find_message(field.full_type_snake_case) is not None
+        ]
+
+    def column_fields(self, message):
+        return [
+            field
+            for field in message.fields
+            if (not field.repeated
+                and is_packed(field)
+                and field.type_kind in ['scalar-value-type', 'enum'])
+        ]
+
+    def column_value_type(self, field):
+        if field.type_kind == 'enum':
+            return f'enum {field.full_type_snake_case}_e'
+        else:
+            return self.storage_item_type(field)
+
+    def column_items(self, message, generated):
+        """Item types of columns of given message not already in given
+        set, which is updated.
+
+        """
+
+        items = []
+
+        for field in self.repeated_columns_fields(message):
+            if field.full_type_snake_case in generated:
+                continue
+
+            generated.add(field.full_type_snake_case)
+            items.append(self.find_message(field.full_type_snake_case))
+
+        return items
+
+    def generate_columns_types(self, message, generated):
+        fields = self.repeated_columns_fields(message)
+
+        if not fields:
+            return []
+
+        types = []
+
+        for item in self.column_items(message, generated):
+            members = [
+                COLUMNS_MEMBER_FMT.format(field=field,
+                                          type=self.column_value_type(field))
+                for field in self.column_fields(item)
+            ]
+            types.append(COLUMNS_STRUCT_FMT.format(message=item,
+                                                   members=''.join(members)))
+
+        members = [
+            REPEATED_COLUMNS_MEMBER_FMT.format(field=field)
+            for field in fields
+        ]
+        types.append(
+            REPEATED_COLUMNS_STRUCT_FMT.format(message=message,
+                                               members='\n'.join(members)))
+
+        return types
+
+    def generate_columns_definitions(self, item):
+        fields = self.column_fields(item)
+        allocs = []
+        members = []
+
+        expected = {
+            field: next_field
+            for field, next_field in self.expected_next_fields(item).items()
+            if field in fields and next_field in fields
+        }
+        expected_fields = list(expected.values())
+
+        for field in fields:
+            if field.type_kind == 'enum':
+                read_type = 'enum'
+            else:
+                read_type = field.full_type_snake_case
+
+            if field in expected_fields:
+                label = DECODE_CASE_LABEL_FMT.format(field=field)
+            else:
+                label = ''
+
+            if field in expected:
+                next_field = expected[field]
+                prediction = DECODE_EXPECTED_TAG_FMT.format(
+                    field=next_field,
+                    wire_type=item_wire_type(next_field))
+            else:
+                prediction = ''
+
+            allocs.append(
+                COLUMN_ALLOC_FMT.format(field=field,
+                                        type=self.column_value_type(field)))
+            members.append(
+                DECODE_COLUMN_FMT.format(field=field,
+                                         wire_type=item_wire_type(field),
+                                         read_type=read_type,
+                                         label=label,
+                                         prediction=prediction))
+
+        encodes = []
+
+        for field in reversed(fields):
+            if field.type_kind == 'enum':
+                write_type = 'enum'
+            else:
+                write_type = field.full_type_snake_case
+
+            if field.optional:
+                write_type += '_always'
+
+            encodes.append(ENCODE_COLUMN_FMT.format(field=field,
+                                                    write_type=write_type))
+
+        if fields:
+            unused_alloc = ''
+            unused_decode = ''
+            cases = [
+                f'            case {field.field_number}:'
+                for field in sorted(fields, key=lambda f: f.field_number)
+            ]
+            decode_default = DECODE_DEFAULT_FMT.format(cases='\n'.join(cases))
+        else:
+            unused_alloc = '    (void)decoder_p;\n\n'
+            unused_decode = '    (void)columns_p;\n    (void)index;\n\n'
+            decode_default = DECODE_DEFAULT_SKIP_FMT
+
+        return COLUMNS_DEFINITIONS_FMT.format(
+            name=item.full_name_snake_case,
+            unused_alloc=unused_alloc,
+            allocs=''.join(allocs),
+            unused_decode=unused_decode,
+            decode_body='\n'.join(members),
+            decode_default=decode_default,
+            encode_body=''.join(['\n' + encode for encode in encodes]
+                                + ['\n'] * bool(encodes)))
+
+    def generate_decode_columns_definitions(self, message, generated):
+        fields = self.repeated_columns_fields(message)
+
+        if not fields:
+            return []
+
+        definitions = [
+            self.generate_columns_definitions(item)
+            for item in self.column_items(message, generated)
+        ]
+        columns = ',\n'.join([
+            REPEATED_COLUMNS_FMT.format(field=field)
+            for field in fields
+        ])
+        definitions.append(
+            ENCODE_COLUMNS_DEFINITION_FMT.format(
+                message=message,
+                columns=columns,
+                number_of_columns=len(fields)))
+        definitions.append(
+            DECODE_COLUMNS_DEFINITION_FMT.format(
+                message=message,
+                columns=columns,
+                number_of_columns=len(fields)))
+
+        return definitions
 
-    def generate_struct_members(self, message):
-        members = []
+    def view_fields(self, message):
+        """Fields of given message in view offset order, oneof fields
+        last.
 
-        for field in message.fields:
-            if field.repeated:
-                member = self.generate_repeated_struct_member_fmt(
-                    field.full_type_snake_case,
-                    field.name_snake_case,
-                    field.type_kind)
-            elif field.optional:
-                member = self.generate_optional_struct_member_fmt(
-                    field.full_type_snake_case,
-                    field.name_snake_case,
-                    field.type_kind)
-            else:
-                member = self.generate_struct_member_fmt(
-                    field.full_type_snake_case,
-                    field.name_snake_case,
-                    field.type_kind)
+        """
 
-            members.append(member)
+        fields = list(message.fields)
 
         for oneof in message.oneofs:
-            members.append(
-                ONEOF_FMT.format(oneof=oneof,
-                                 members=self.generate_oneof_members(oneof)))
+            fields += oneof.fields
 
-        members = '\n'.join(members)
+        return fields
 
-        if members:
-            members += '\n'
+    def view_read(self, field, decoder):
+        if field.type_kind == 'enum':
+            return (f'(enum {field.full_type_snake_case}_e)'
+                    f'pbtools_decoder_read_enum_unchecked({decoder})')
+        else:
+            return (f'pbtools_decoder_read_{field.full_type_snake_case}'
+                    f'_unchecked({decoder})')
+
+    def view_value_type(self, field):
+        if field.type_kind == 'message':
+            return f'struct {field.full_type_snake_case}_view_t'
+        elif field.type in ['string', 'bytes']:
+            return 'struct pbtools_bytes_t'
+        else:
+            return self.column_value_type(field)
+
+    def generate_view_field_functions(self, message, field, index, oneof=None):
+        if oneof is None and field.repeated:
+            return [
+                (VIEW_BEGIN_SIGNATURE_FMT.format(message=message, field=field),
+                 VIEW_BEGIN_BODY_FMT.format(index=index)),
+                self.generate_view_next_function(message, field)
+            ]
 
-        return members
+        if field.type_kind == 'message':
+            return [
+                (VIEW_GET_SUB_MESSAGE_SIGNATURE_FMT.format(message=message,
+                                                           field=field),
+                 VIEW_GET_SUB_MESSAGE_BODY_FMT.format(field=field,
+                                                      index=index))
+            ]
 
-    def generate_repeated_struct(self, message):
-        return REPEATED_MESSAGE_STRUCT_FMT.format(message=message)
+        signature = VIEW_GET_SIGNATURE_FMT.format(
+            type=self.view_value_type(field),
+            message=message,
+            field=field)
 
-    def generate_enum_members(self, enum):
-        lines = []
+        if field.type in ['string', 'bytes']:
+            functions = [
+                (signature, VIEW_GET_BYTES_BODY_FMT.format(index=index))
+            ]
+        else:
+            if field.type == 'bool':
+                default = 'false'
+            elif field.type_kind == 'enum':
+                default = f'(enum {field.full_type_snake_case}_e)0'
+            else:
+                default = '0'
+
+            functions = [
+                (signature,
+                 VIEW_GET_BODY_FMT.format(index=index,
+                                          default=default,
+                                          read=self.view_read(field,
+                                                              '&decoder')))
+            ]
 
-        for field in enum.fields:
-            line = ENUM_MEMBER_FMT.format(enum=enum, field=field)
+        if oneof is None and field.optional:
+            functions.append(
+                (VIEW_HAS_SIGNATURE_FMT.format(message=message, field=field),
+                 VIEW_HAS_BODY_FMT.format(index=index)))
 
-            if self.enums_upper_case:
-                line = line.upper()
+        return functions
 
-            lines.append(line)
+    def generate_view_next_function(self, message, field):
+        signature = VIEW_NEXT_SIGNATURE_FMT.format(
+            message=message,
+            field=field,
+            type=self.view_value_type(field))
 
-        return ',\n'.join(lines)
+        if field.type_kind == 'message':
+            body = VIEW_NEXT_SUB_MESSAGE_BODY_FMT.format(field=field)
+        elif field.type in ['string', 'bytes']:
+            body = VIEW_NEXT_BYTES_BODY_FMT
+        else:
+            body = VIEW_NEXT_BODY_FMT.format(
+                read=self.view_read(field, '&iterator_p->decoder'))
 
-    def generate_enum_type(self, enum):
-        return [
-            ENUM_FMT.format(full_name=enum.full_name,
-                            name=enum.full_name_snake_case,
-                            members=self.generate_enum_members(enum))
-        ]
+        return (signature, body)
 
-    def generate_oneof_members(self, oneof):
-        members = []
+    def generate_view_functions(self, message):
+        """Signatures and bodies of view functions of given message.
 
-        for field in oneof.fields:
-            member = self.generate_struct_member_fmt(
-                field.full_type_snake_case,
-                field.name_snake_case,
-                field.type_kind)
-            members.append(f'    {member}')
+        """
 
-        return '\n'.join(members)
+        functions = []
+        index = 0
 
-    def generate_oneof_choices(self, oneof):
-        members = [
-            f'    {oneof.full_name_snake_case}_none_e = 0'
-        ]
+        for field in message.fields:
+            functions += self.generate_view_field_functions(message,
+                                                            field,
+                                                            index)
+            index += 1
 
-        for i, field in enumerate(oneof.fields, 1):
-            members.append(
-                f'    {oneof.full_name_snake_case}_{field.name_snake_case}_e = {i}')
+        for oneof in message.oneofs:
+            functions.append(
+                (VIEW_GET_ONEOF_SIGNATURE_FMT.format(message=message,
+                                                     oneof=oneof),
+                 VIEW_GET_ONEOF_BODY_FMT.format(
+                     oneof=oneof,
+                     index=index,
+                     number_of_fields=len(oneof.fields))))
 
-        return ENUM_FMT.format(full_name=oneof.full_name,
-                               name=f'{oneof.full_name_snake_case}',
-                               members=',\n'.join(members))
+            for field in oneof.fields:
+                functions += self.generate_view_field_functions(message,
+                                                                field,
+                                                                index,
+                                                                oneof)
+                index += 1
 
-    def generate_oneof_type(self, oneof):
-        types = [self.generate_oneof_choices(oneof)]
+        return functions
 
-        return ['\n'.join(types)]
+    def generate_view_declarations(self, message):
+        if not self.views:
+            return []
 
-    def generate_message_types(self, message):
-        types = []
+        declarations = [VIEW_DECLARATION_FMT.format(message=message)]
 
-        for enum in message.enums:
-            types += self.generate_enum_type(enum)
+        for signature, _ in self.generate_view_functions(message):
+            declarations.append(f'{signature};\n')
 
-        for sub_message in message.messages:
-            types += self.generate_message_types(sub_message)
+        return declarations
 
-        for oneof in message.oneofs:
-            types += self.generate_oneof_type(oneof)
+    def generate_view_definitions(self, message):
+        if not self.views:
+            return []
 
-        types += [
-            MESSAGE_STRUCT_FMT.format(
-                message=message,
-                repeated_struct=self.generate_repeated_struct(message),
-                members=self.generate_struct_members(message))
-        ]
+        fields = self.view_fields(message)
+        definitions = []
 
-        return types
+        if fields:
+            members = []
 
-    def generate_types(self):
-        types = []
+            for field in fields:
+                if field in message.repeated_fields:
+                    repeated = 'true'
+                else:
+                    repeated = 'false'
 
-        for enum in self.parsed.enums:
-            types += self.generate_enum_type(enum)
+                members.append(f'    {{ {field.field_number}, '
+                               f'{item_wire_type(field)}, {repeated} }}')
 
-        for message in self.messages:
-            types += self.generate_message_types(message)
+            definitions.append(
+                VIEW_FIELDS_FMT.format(message=message,
+                                       fields=',\n'.join(members)))
+            fields_p = f'&{message.full_name_snake_case}_view_fields[0]'
+        else:
+            fields_p = 'NULL'
 
-        return '\n'.join(types)
+        definitions.append(
+            VIEW_DEFINITION_FMT.format(message=message,
+                                       fields=fields_p,
+                                       number_of_fields=len(fields)))
+
+        for signature, body in self.generate_view_functions(message):
+            definitions.append(f'{signature}\n{body}')
+
+        return definitions
 
     def generate_declarations(self):
         declarations = []
@@ -918,11 +2437,19 @@ class Generator:
                     SUB_MESSAGE_ALLOC_DECLARATION_FMT.format(message=message,
                                                              field=field))
 
+                if self.is_lazy(field):
+                    declarations.append(
+                        LAZY_SUB_MESSAGE_GET_DECLARATION_FMT.format(
+                            message=message,
+                            field=field))
+
         for sub_message in message.messages:
             self.generate_message_declarations(sub_message,
                                                declarations,
                                                public=False)
 
+        declarations += self.generate_view_declarations(message)
+
         for oneof in message.oneofs:
             for field in oneof.fields:
                 if field.type_kind == 'message':
@@ -940,6 +2467,38 @@ class Generator:
             declarations.append(
                 MESSAGE_DECLARATION_FMT.format(message=message))
 
+            if self.padded_input:
+                declarations.append(
+                    DECODE_PADDED_DECLARATION_FMT.format(message=message))
+
+            if self.segmented_input:
+                declarations.append(
+                    DECODE_SEGMENTS_DECLARATION_FMT.format(message=message))
+
+            if self.callback_fields(message):
+                declarations.append(
+                    DECODE_CALLBACKS_DECLARATION_FMT.format(message=message))
+
+            if self.repeated_columns_fields(message):
+                declarations.append(
+                    ENCODE_COLUMNS_DECLARATION_FMT.format(message=message))
+                declarations.append(
+                    DECODE_COLUMNS_DECLARATION_FMT.format(message=message))
+
+            declarations += self.generate_set_storages(
+                message,
+                SET_STORAGE_DECLARATION_FMT)
+
+            if self.is_table_driven(message):
+                declarations.append(
+                    VALIDATE_DECLARATION_FMT.format(message=message))
+                declarations.append(
+                    DECODE_MASKED_DECLARATION_FMT.format(message=message))
+                declarations.append(
+                    DECODE_LIMITED_DECLARATION_FMT.format(message=message))
+                declarations.append(
+                    STREAM_DECODER_DECLARATION_FMT.format(message=message))
+
     def generate_internal_declarations(self):
         declarations = []
 
@@ -952,6 +2511,10 @@ class Generator:
     def generate_internal_message_declarations(self, message, declarations):
         declarations.append(MESSAGE_DECLARATIONS_FMT.format(message=message))
 
+        if self.table_driven:
+            declarations.append(
+                MESSAGE_INFO_DECLARATION_FMT.format(message=message))
+
         for sub_message in message.messages:
             self.generate_internal_message_declarations(sub_message,
                                                         declarations)
@@ -979,6 +2542,8 @@ class Generator:
                         fmt = ENCODE_REPEATED_ENUM_FMT
                     else:
                         fmt = ENCODE_REPEATED_MESSAGE_MEMBER_FMT
+                elif self.is_lazy(field):
+                    fmt = ENCODE_LAZY_SUB_MESSAGE_MEMBER_FMT
                 elif field.type_kind == 'message':
                     fmt = ENCODE_SUB_MESSAGE_MEMBER_FMT
                 else:
@@ -1003,8 +2568,36 @@ class Generator:
 
         return ''.join(members)
 
-    def generate_message_decode_body(self, message):
+    def expected_next_fields(self, message):
+        """Returns a dictionary of the field expected to follow each field
+        in the encoded data. Fields are encoded in declaration order,
+        except repeated fields that are not packed, which are usually
+        followed by another item.
+
+        """
+
+        expected = {}
+
+        for field, next_field in zip(message.fields, message.fields[1:]):
+            if field.repeated and not is_packed(field):
+                next_field = field
+
+            if next_field.field_number < 2048:
+                expected[field] = next_field
+
+        if message.fields:
+            field = message.fields[-1]
+
+            if field.repeated and not is_packed(field):
+                if field.field_number < 2048:
+                    expected[field] = field
+
+        return expected
+
+    def generate_message_decode_body(self, message, perfect_hash):
         members = []
+        expected = self.expected_next_fields(message)
+        expected_fields = list(expected.values())
 
         for field in message.fields:
             if field.repeated:
@@ -1015,7 +2608,12 @@ class Generator:
                 else:
                     fmt = DECODE_REPEATED_FIELD_FMT
             elif field.type == 'bytes':
-                if field.optional:
+                if self.zero_copy:
+                    if field.optional:
+                        fmt = DECODE_OPTIONAL_MEMBER_BYTES_VIEW_FMT
+                    else:
+                        fmt = DECODE_MEMBER_BYTES_VIEW_FMT
+                elif field.optional:
                     fmt = DECODE_OPTIONAL_MEMBER_BYTES_FMT
                 else:
                     fmt = DECODE_MEMBER_BYTES_FMT
@@ -1029,6 +2627,8 @@ class Generator:
                     fmt = DECODE_OPTIONAL_MEMBER_FMT
                 else:
                     fmt = DECODE_MEMBER_FMT
+            elif self.is_lazy(field):
+                fmt = DECODE_LAZY_SUB_MESSAGE_MEMBER_FMT
             elif field.type_kind == 'message':
                 fmt = DECODE_SUB_MESSAGE_MEMBER_FMT
             else:
@@ -1037,17 +2637,91 @@ class Generator:
                 else:
                     fmt = DECODE_ENUM_FMT
 
-            members.append(fmt.format(field=field))
+            if field in expected_fields:
+                label = DECODE_CASE_LABEL_FMT.format(field=field)
+            else:
+                label = ''
+
+            if field in expected:
+                next_field = expected[field]
+                prediction = DECODE_EXPECTED_TAG_FMT.format(
+                    field=next_field,
+                    wire_type=wire_type(next_field))
+            else:
+                prediction = ''
+
+            members.append(
+                DECODE_CASE_FMT.format(
+                    field=field,
+                    case=decode_case(field, wire_type(field), perfect_hash),
+                    label=label,
+                    member=fmt.format(field=field,
+                                      wire_type=wire_type(field)),
+                    prediction=prediction))
+
+            # Repeated scalar values may also be encoded one by one.
+            if field.repeated and is_packed(field):
+                members.append(
+                    DECODE_CASE_FMT.format(
+                        field=field,
+                        case=decode_case(field,
+                                         item_wire_type(field),
+                                         perfect_hash),
+                        label='',
+                        member=fmt.format(field=field,
+                                          wire_type=item_wire_type(field)),
+                        prediction=''))
 
         for oneof in message.oneofs:
             for field in oneof.fields:
                 members.append(
-                    DECODE_ONEOF_FMT.format(message=message,
-                                            oneof=oneof,
-                                            field=field))
+                    DECODE_ONEOF_FMT.format(
+                        message=message,
+                        oneof=oneof,
+                        field=field,
+                        case=decode_case(field,
+                                         item_wire_type(field),
+                                         perfect_hash)))
 
         return '\n'.join(members)
 
+    def generate_message_decode_keys(self, message):
+        keys = []
+
+        for field in message.fields:
+            keys.append(key(field, wire_type(field)))
+
+            if field.repeated and is_packed(field):
+                keys.append(key(field, item_wire_type(field)))
+
+        for oneof in message.oneofs:
+            for field in oneof.fields:
+                keys.append(key(field, item_wire_type(field)))
+
+        return keys
+
+    def generate_message_decode_default(self, message):
+        """Fields with unexpected wire types are errors, while unknown
+        fields are skipped.
+
+        """
+
+        field_numbers = [field.field_number for field in message.fields]
+
+        for oneof in message.oneofs:
+            for field in oneof.fields:
+                field_numbers.append(field.field_number)
+
+        if not field_numbers:
+            return DECODE_DEFAULT_SKIP_FMT
+
+        cases = [
+            f'            case {field_number}:'
+            for field_number in sorted(field_numbers)
+        ]
+
+        return DECODE_DEFAULT_FMT.format(cases='\n'.join(cases))
+
     def generate_message_members_init(self, message):
         members = []
 
@@ -1064,6 +2738,8 @@ class Generator:
                 member = f'    self_p->{name}_p = "";'
             elif field.type_kind == 'scalar-value-type':
                 member = f'    self_p->{name} = 0;'
+            elif self.is_lazy(field):
+                member = f'    pbtools_lazy_message_init(&self_p->{name});'
             elif field.type_kind == 'message':
                 member = f'    self_p->{name}_p = NULL;'
             else:
@@ -1103,9 +2779,12 @@ class Generator:
             if field.type_kind != 'message':
                 continue
 
-            allocs.append(
-                SUB_MESSAGE_ALLOC_DEFINITION_FMT.format(message=message,
-                                                        field=field))
+            if self.is_lazy(field):
+                fmt = LAZY_SUB_MESSAGE_DEFINITION_FMT
+            else:
+                fmt = SUB_MESSAGE_ALLOC_DEFINITION_FMT
+
+            allocs.append(fmt.format(message=message, field=field))
 
         return '\n'.join(allocs)
 
@@ -1113,7 +2792,9 @@ class Generator:
         finalizers = []
 
         for field in message.repeated_fields:
-            if field.type_kind == 'scalar-value-type':
+            if self.zero_copy and field.type == 'bytes':
+                fmt = REPEATED_BYTES_VIEW_FINALIZER_FMT
+            elif field.type_kind == 'scalar-value-type':
                 fmt = REPEATED_FINALIZER_FMT
             elif field.type_kind == 'enum':
                 fmt = REPEATED_ENUM_FINALIZER_FMT
@@ -1148,12 +2829,15 @@ class Generator:
     def generate_definitions(self):
         declarations = []
         definitions = []
+        columns = set()
 
         for message in self.messages:
             self.generate_message_definitions(message,
                                               declarations,
                                               definitions,
                                               public=True)
+            definitions += self.generate_decode_columns_definitions(message,
+                                                                    columns)
 
         return '\n'.join(declarations + definitions)
 
@@ -1225,7 +2909,10 @@ class Generator:
                                                               field=field))
             else:
                 if field.type == 'bytes':
-                    fmt = DECODE_ONEOF_MEMBER_BYTES_FMT
+                    if self.zero_copy:
+                        fmt = DECODE_ONEOF_MEMBER_BYTES_VIEW_FMT
+                    else:
+                        fmt = DECODE_ONEOF_MEMBER_BYTES_FMT
                 elif field.type == 'string':
                     fmt = DECODE_ONEOF_MEMBER_STRING_FMT
                 elif field.type_kind == 'scalar-value-type':
@@ -1247,21 +2934,30 @@ class Generator:
         self.generate_oneof_init_and_alloc_definitions(message, oneof, definitions)
         self.generate_oneof_decode_definitions(message, oneof, definitions)
 
-    def generate_message_definitions(self,
-                                     message,
-                                     declarations,
-                                     definitions,
-                                     public):
-        for oneof in message.oneofs:
-            self.generate_oneof_definitions(message, oneof, definitions)
-
-        for sub_message in message.messages:
-            self.generate_message_definitions(sub_message,
-                                              declarations,
-                                              definitions,
-                                              public=False)
+    def generate_code_message_definitions(self, message, definitions):
+        name = message.full_name_snake_case
+        keys = self.generate_message_decode_keys(message)
+
+        if is_sparse(keys):
+            perfect_hash = PerfectHash(keys)
+            decode_tables = generate_decode_hash_tables(name, perfect_hash)
+            decode_variables = DECODE_HASH_VARIABLES
+            decode_dispatch = DECODE_HASH_DISPATCH_FMT.format(
+                name=name,
+                multiplier=f'0x{perfect_hash.multiplier:08x}',
+                slot_shift=perfect_hash.slot_shift,
+                slot_mask=f'0x{perfect_hash.size - 1:x}',
+                bucket_shift=perfect_hash.bucket_shift,
+                size=perfect_hash.size)
+            decode_switch = 'slot'
+        else:
+            perfect_hash = None
+            decode_tables = ''
+            decode_variables = ''
+            decode_dispatch = ''
+            decode_switch = 'key'
 
-        decode_body = self.generate_message_decode_body(message)
+        decode_body = self.generate_message_decode_body(message, perfect_hash)
 
         if decode_body:
             unused_decode = ''
@@ -1273,11 +2969,204 @@ class Generator:
                 name=message.full_name_snake_case,
                 encode_body=self.generate_message_encode_body(message),
                 decode_body=decode_body,
+                decode_default=self.generate_message_decode_default(message),
+                decode_tables=decode_tables,
+                decode_variables=decode_variables,
+                decode_dispatch=decode_dispatch,
+                decode_switch=decode_switch,
                 unused_decode=unused_decode,
                 repeated_infos=self.generate_repeated_infos(message),
                 members_init=self.generate_message_members_init(message),
                 finalizers=self.generate_repeated_finalizers(message)))
 
+        if self.table_driven:
+            definitions.append(self.generate_message_info(message))
+
+    def generate_message_info(self, message):
+        """Info of a message decoded by generated code, with the fields
+        checked when validating.
+
+        """
+
+        name = message.full_name_snake_case
+        fields = []
+
+        for field in message.fields:
+            if field.repeated:
+                flags = 'PBTOOLS_FIELD_FLAG_REPEATED'
+            else:
+                flags = '0'
+
+            fields.append(
+                self.generate_validate_field(field,
+                                             flags,
+                                             self.is_lazy(field)))
+
+        for oneof in message.oneofs:
+            for field in oneof.fields:
+                fields.append(self.generate_validate_field(field, '0', False))
+
+        if fields:
+            validate_fields = VALIDATE_FIELDS_FMT.format(
+                name=name,
+                fields=',\n'.join(fields))
+            validate_fields_p = f'&{name}_validate_fields[0]'
+        else:
+            validate_fields = ''
+            validate_fields_p = 'NULL'
+
+        return MESSAGE_INFO_DEFINITION_FMT.format(
+            name=name,
+            validate_fields=validate_fields,
+            number_of_validate_fields=len(fields),
+            validate_fields_p=validate_fields_p)
+
+    def generate_validate_field(self, field, flags, lazy):
+        message_info = 'NULL'
+
+        if field.type_kind == 'enum':
+            kind = 'ENUM'
+        elif field.type_kind == 'message':
+            # Lazy sub-messages are not decoded with their parent.
+            if lazy:
+                kind = 'BYTES'
+            else:
+                kind = 'MESSAGE'
+                message_info = f'&{field.full_type_snake_case}_info'
+        else:
+            kind = field.type.upper()
+
+        if flags == '0':
+            field_wire_type = item_wire_type(field)
+        else:
+            field_wire_type = wire_type(field)
+
+        return VALIDATE_FIELD_FMT.format(field=field,
+                                         wire_type=field_wire_type,
+                                         kind=kind,
+                                         flags=flags,
+                                         message_info=message_info)
+
+    def generate_table_fields(self, message):
+        fields = []
+        repeated_index = 0
+
+        for field in message.fields:
+            name = field.name_snake_case
+            presence_offset = '0'
+            message_info = 'NULL'
+
+            if field.type_kind == 'enum':
+                kind = 'ENUM'
+            elif field.type_kind == 'message':
+                kind = 'MESSAGE'
+                message_info = f'&{field.full_type_snake_case}_info'
+            elif self.zero_copy and field.type == 'bytes':
+                kind = 'BYTES_VIEW'
+            else:
+                kind = field.type.upper()
+
+            if field.repeated:
+                flags = 'PBTOOLS_FIELD_FLAG_REPEATED'
+                member = name
+                index = repeated_index
+                repeated_index += 1
+            else:
+                index = 0
+
+                if field.type == 'string' or field.type_kind == 'message':
+                    suffix = '_p'
+                else:
+                    suffix = ''
+
+                if field.optional:
+                    flags = 'PBTOOLS_FIELD_FLAG_OPTIONAL'
+                    member = f'{name}.value{suffix}'
+                    presence_offset = (
+                        f'offsetof(struct {message.full_name_snake_case}_t, '
+                        f'{name}.is_present)')
+                else:
+                    flags = '0'
+                    member = f'{name}{suffix}'
+
+            fields.append(
+                TABLE_FIELD_FMT.format(field=field,
+                                       wire_type=wire_type(field),
+                                       kind=kind,
+                                       flags=flags,
+                                       repeated_index=index,
+                                       name=message.full_name_snake_case,
+                                       member=member,
+                                       presence_offset=presence_offset,
+                                       message_info=message_info))
+
+        return ',\n'.join(fields)
+
+    def generate_table_sorted_indexes(self, message):
+        """Field indexes in field number order, searched when a field is
+        not in table order. Not needed if the table already is in field
+        number order.
+
+        """
+
+        indexes = sorted(range(len(message.fields)),
+                         key=lambda i: message.fields[i].field_number)
+
+        if indexes == sorted(indexes):
+            return '', 'NULL'
+
+        name = message.full_name_snake_case
+        sorted_indexes = SORTED_INDEXES_FMT.format(
+            name=name,
+            indexes=',\n'.join([f'    {index}' for index in indexes]))
+
+        return sorted_indexes, f'&{name}_sorted_indexes[0]'
+
+    def generate_table_message_definitions(self, message):
+        number_of_repeated_fields = len(message.repeated_fields)
+
+        if number_of_repeated_fields > 0:
+            repeated_infos = (
+                f'    struct pbtools_repeated_info_t '
+                f'repeated_infos[{number_of_repeated_fields}];\n\n')
+            repeated_infos_p = '&repeated_infos[0]'
+        else:
+            repeated_infos = ''
+            repeated_infos_p = 'NULL'
+
+        sorted_indexes, sorted_indexes_p = (
+            self.generate_table_sorted_indexes(message))
+
+        return TABLE_MESSAGE_DEFINITIONS_FMT.format(
+            name=message.full_name_snake_case,
+            fields=self.generate_table_fields(message),
+            sorted_indexes=sorted_indexes,
+            number_of_fields=len(message.fields),
+            sorted_indexes_p=sorted_indexes_p,
+            members_init=self.generate_message_members_init(message),
+            repeated_infos=repeated_infos,
+            repeated_infos_p=repeated_infos_p)
+
+    def generate_message_definitions(self,
+                                     message,
+                                     declarations,
+                                     definitions,
+                                     public):
+        for oneof in message.oneofs:
+            self.generate_oneof_definitions(message, oneof, definitions)
+
+        for sub_message in message.messages:
+            self.generate_message_definitions(sub_message,
+                                              declarations,
+                                              definitions,
+                                              public=False)
+
+        if self.is_table_driven(message):
+            definitions.append(
+                self.generate_table_message_definitions(message))
+        else:
+            self.generate_code_message_definitions(message, definitions)
+
         sub_messages = self.generate_sub_message_definitions(message)
 
         if sub_messages:
@@ -1288,9 +3177,46 @@ class Generator:
         if repeated:
             definitions.append(repeated)
 
+        definitions += self.generate_view_definitions(message)
+
         if public:
             definitions.append(MESSAGE_DEFINITION_FMT.format(message=message))
 
+            if self.padded_input:
+                definitions.append(
+                    DECODE_PADDED_DEFINITION_FMT.format(message=message))
+
+            if self.segmented_input:
+                definitions.append(
+                    DECODE_SEGMENTS_DEFINITION_FMT.format(message=message))
+
+            fields = self.callback_fields(message)
+
+            if fields:
+                callbacks = [
+                    DECODE_CALLBACK_FMT.format(field=field)
+                    for field in fields
+                ]
+                definitions.append(
+                    DECODE_CALLBACKS_DEFINITION_FMT.format(
+                        message=message,
+                        callbacks=',\n'.join(callbacks),
+                        number_of_callbacks=len(fields)))
+
+            definitions += self.generate_set_storages(
+                message,
+                SET_STORAGE_DEFINITION_FMT)
+
+            if self.is_table_driven(message):
+                definitions.append(
+                    VALIDATE_DEFINITION_FMT.format(message=message))
+                definitions.append(
+                    DECODE_MASKED_DEFINITION_FMT.format(message=message))
+                definitions.append(
+                    DECODE_LIMITED_DEFINITION_FMT.format(message=message))
+                definitions.append(
+                    STREAM_DECODER_DEFINITION_FMT.format(message=message))
+
     def generate_includes(self):
         includes = []
 
@@ -380,10 +380,17 @@ class Oneof:
 
 class MessageField(Field):
 
-    def __init__(self, type, name, field_number, repeated, optional):
+    def __init__(self,
+                 type,
+                 name,
+                 field_number,
+                 repeated,
+                 optional,
+                 lazy=False):
         super().__init__(type, name, field_number)
         self.repeated = repeated
         self.optional = optional
+        self.lazy = lazy
 
     @classmethod
     def from_field_tokens(cls, tokens):
@@ -398,7 +405,8 @@ class MessageField(Field):
                    tokens[2],
                    int(tokens[4]),
                    repeated,
-                   optional)
+                   optional,
+                   is_option_true(tokens[5], 'lazy'))
 
 
 class Message:
@@ -784,6 +792,15 @@ def load_options(tokens):
     ]
 
 
+def is_option_true(tokens, name):
+    if tokens:
+        for option_name, _, value in tokens[0][1]:
+            if option_name[0] == name and value == ('bool', 'true'):
+                return True
+
+    return False
+
+
 def load_messages(tokens, namespace):
     return [
         Message(message, namespace)
@@ -6,7 +6,16 @@ from ..c_source import Options
 
 
 def _do_generate_c_source(args):
-    options = Options(args.enums_upper_case)
+    options = Options(args.enums_upper_case,
+                      args.zero_copy,
+                      args.lazy_sub_messages,
+                      args.table_driven,
+                      args.padded_input,
+                      args.callbacks,
+                      args.caller_storage,
+                      args.segmented_input,
+                      args.columns,
+                      args.views)
     generate_files(args.infiles,
                    args.import_path,
                    args.output_directory,
@@ -34,4 +43,54 @@ def add_subparser(subparsers):
         '--enums-upper-case',
         action='store_true',
         help='Use upper case for generated enums.')
+    subparser.add_argument(
+        '--zero-copy',
+        action='store_true',
+        help=('Decode strings and bytes as views into the encoded buffer '
+              'instead of copying them. Strings are bytes in C. The encoded '
+              'buffer must outlive decoded messages.'))
+    subparser.add_argument(
+        '--lazy-sub-messages',
+        action='store_true',
+        help=('Decode all sub-message fields on first access, not only '
+              'fields with the lazy option. The encoded buffer must outlive '
+              'decoded messages.'))
+    subparser.add_argument(
+        '--table-driven',
+        action='store_true',
+        help=('Encode and decode messages using compact field tables and an '
+              'interpreter instead of generated code per message. Messages '
+              'with oneofs or lazy sub-messages are always generated as '
+              'code.'))
+    subparser.add_argument(
+        '--padded-input',
+        action='store_true',
+        help=('Generate <message>_decode_padded() to decode messages followed '
+              'by at least PBTOOLS_PADDING readable bytes.'))
+    subparser.add_argument(
+        '--callbacks',
+        action='store_true',
+        help=('Generate <message>_decode_callbacks() to decode items of '
+              'repeated sub-message fields one at a time.'))
+    subparser.add_argument(
+        '--caller-storage',
+        action='store_true',
+        help=('Generate <message>_<field>_set_storage() to decode items of '
+              'repeated scalar fields into caller provided buffers.'))
+    subparser.add_argument(
+        '--segmented-input',
+        action='store_true',
+        help=('Generate <message>_decode_segments() to decode messages split '
+              'into several buffers.'))
+    subparser.add_argument(
+        '--columns',
+        action='store_true',
+        help=('Generate <message>_decode_columns() and '
+              '<message>_encode_columns() to decode and encode items of '
+              'repeated sub-message fields as columns.'))
+    subparser.add_argument(
+        '--views',
+        action='store_true',
+        help=('Generate views to read fields of encoded messages on demand, '
+              'without a workspace.'))
     subparser.set_defaults(func=_do_generate_c_source)
@@ -54,17 +54,32 @@ void add_and_remove_fields_version1_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct add_and_remove_fields_version1_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 1:
-            self_p->v1 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->v1 = pbtools_decoder_read_int32_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -75,12 +90,14 @@ void add_and_remove_fields_version1_encode_repeated_inner(
     int field_number,
     struct add_and_remove_fields_version1_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct add_and_remove_fields_version1_t),
-        (pbtools_message_encode_inner_t)add_and_remove_fields_version1_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        add_and_remove_fields_version1_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void add_and_remove_fields_version1_decode_repeated_inner(
@@ -88,13 +105,30 @@ void add_and_remove_fields_version1_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct add_and_remove_fields_version1_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct add_and_remove_fields_version1_t),
-        (pbtools_message_init_t)add_and_remove_fields_version1_init,
-        (pbtools_message_decode_inner_t)add_and_remove_fields_version1_decode_inner);
+        sizeof(struct add_and_remove_fields_version1_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        add_and_remove_fields_version1_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        add_and_remove_fields_version1_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct add_and_remove_fields_version1_t *
@@ -156,25 +190,58 @@ void add_and_remove_fields_version2_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct add_and_remove_fields_version2_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->v1 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
 
-        case 1:
-            self_p->v1 = pbtools_decoder_read_int32(decoder_p, wire_type);
             break;
 
-        case 2:
-            self_p->v2 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
+        field_2:
+            self_p->v2 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_3;
+            }
+
             break;
 
-        case 3:
-            self_p->v3 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_VARINT):
+        field_3:
+            self_p->v3 = pbtools_decoder_read_int32_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -185,12 +252,14 @@ void add_and_remove_fields_version2_encode_repeated_inner(
     int field_number,
     struct add_and_remove_fields_version2_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct add_and_remove_fields_version2_t),
-        (pbtools_message_encode_inner_t)add_and_remove_fields_version2_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        add_and_remove_fields_version2_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void add_and_remove_fields_version2_decode_repeated_inner(
@@ -198,13 +267,30 @@ void add_and_remove_fields_version2_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct add_and_remove_fields_version2_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct add_and_remove_fields_version2_t),
-        (pbtools_message_init_t)add_and_remove_fields_version2_init,
-        (pbtools_message_decode_inner_t)add_and_remove_fields_version2_decode_inner);
+        sizeof(struct add_and_remove_fields_version2_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        add_and_remove_fields_version2_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        add_and_remove_fields_version2_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct add_and_remove_fields_version2_t *
@@ -264,21 +350,45 @@ void add_and_remove_fields_version3_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct add_and_remove_fields_version3_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->v3 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_4;
+            }
 
-        case 3:
-            self_p->v3 = pbtools_decoder_read_int32(decoder_p, wire_type);
             break;
 
-        case 4:
-            self_p->v4 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_VARINT):
+        field_4:
+            self_p->v4 = pbtools_decoder_read_int32_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 3:
+            case 4:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -289,12 +399,14 @@ void add_and_remove_fields_version3_encode_repeated_inner(
     int field_number,
     struct add_and_remove_fields_version3_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct add_and_remove_fields_version3_t),
-        (pbtools_message_encode_inner_t)add_and_remove_fields_version3_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        add_and_remove_fields_version3_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void add_and_remove_fields_version3_decode_repeated_inner(
@@ -302,13 +414,30 @@ void add_and_remove_fields_version3_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct add_and_remove_fields_version3_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct add_and_remove_fields_version3_t),
-        (pbtools_message_init_t)add_and_remove_fields_version3_init,
-        (pbtools_message_decode_inner_t)add_and_remove_fields_version3_decode_inner);
+        sizeof(struct add_and_remove_fields_version3_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        add_and_remove_fields_version3_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        add_and_remove_fields_version3_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct add_and_remove_fields_version3_t *
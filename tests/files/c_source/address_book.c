@@ -56,21 +56,45 @@ void address_book_person_phone_number_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct address_book_person_phone_number_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->number_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
 
-        case 1:
-            pbtools_decoder_read_string(decoder_p, wire_type, &self_p->number_p);
             break;
 
-        case 2:
-            self_p->type = pbtools_decoder_read_enum(decoder_p, wire_type);
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
+        field_2:
+            self_p->type = pbtools_decoder_read_enum_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -81,12 +105,14 @@ void address_book_person_phone_number_encode_repeated_inner(
     int field_number,
     struct address_book_person_phone_number_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct address_book_person_phone_number_t),
-        (pbtools_message_encode_inner_t)address_book_person_phone_number_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        address_book_person_phone_number_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void address_book_person_phone_number_decode_repeated_inner(
@@ -94,13 +120,82 @@ void address_book_person_phone_number_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct address_book_person_phone_number_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct address_book_person_phone_number_t),
-        (pbtools_message_init_t)address_book_person_phone_number_init,
-        (pbtools_message_decode_inner_t)address_book_person_phone_number_decode_inner);
+        sizeof(struct address_book_person_phone_number_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        address_book_person_phone_number_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        address_book_person_phone_number_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t address_book_person_phone_number_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 2, PBTOOLS_WIRE_TYPE_VARINT, false }
+};
+
+void address_book_person_phone_number_view_init(
+    struct address_book_person_phone_number_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &address_book_person_phone_number_view_fields[0],
+                      2,
+                      &self_p->offsets[0]);
+}
+
+int address_book_person_phone_number_view_error(
+    struct address_book_person_phone_number_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+struct pbtools_bytes_t address_book_person_phone_number_view_get_number(
+    struct address_book_person_phone_number_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+
+    value.buf_p = NULL;
+    value.size = 0;
+
+    if (pbtools_view_seek(&self_p->base, 0, &decoder)) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    return (value);
+}
+
+enum address_book_person_phone_type_e address_book_person_phone_number_view_get_type(
+    struct address_book_person_phone_number_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 1, &decoder)) {
+        return ((enum address_book_person_phone_type_e)0);
+    }
+
+    return ((enum address_book_person_phone_type_e)pbtools_decoder_read_enum_unchecked(&decoder));
 }
 
 void address_book_person_init(
@@ -131,34 +226,83 @@ void address_book_person_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct address_book_person_t *self_p)
 {
+    uint32_t key;
     int wire_type;
     struct pbtools_repeated_info_t repeated_info_phones;
 
     pbtools_repeated_info_init(&repeated_info_phones, 4);
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->name_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
 
-        case 1:
-            pbtools_decoder_read_string(decoder_p, wire_type, &self_p->name_p);
             break;
 
-        case 2:
-            self_p->id = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
+        field_2:
+            self_p->id = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_3;
+            }
+
             break;
 
-        case 3:
-            pbtools_decoder_read_string(decoder_p, wire_type, &self_p->email_p);
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_3:
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->email_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_4;
+            }
+
             break;
 
-        case 4:
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_4:
             pbtools_repeated_info_decode(&repeated_info_phones,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_4;
+            }
+
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -186,12 +330,14 @@ void address_book_person_encode_repeated_inner(
     int field_number,
     struct address_book_person_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct address_book_person_t),
-        (pbtools_message_encode_inner_t)address_book_person_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        address_book_person_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void address_book_person_decode_repeated_inner(
@@ -199,13 +345,123 @@ void address_book_person_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct address_book_person_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct address_book_person_t),
-        (pbtools_message_init_t)address_book_person_init,
-        (pbtools_message_decode_inner_t)address_book_person_decode_inner);
+        sizeof(struct address_book_person_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        address_book_person_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        address_book_person_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t address_book_person_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 2, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, true }
+};
+
+void address_book_person_view_init(
+    struct address_book_person_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &address_book_person_view_fields[0],
+                      4,
+                      &self_p->offsets[0]);
+}
+
+int address_book_person_view_error(
+    struct address_book_person_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+struct pbtools_bytes_t address_book_person_view_get_name(
+    struct address_book_person_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+
+    value.buf_p = NULL;
+    value.size = 0;
+
+    if (pbtools_view_seek(&self_p->base, 0, &decoder)) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    return (value);
+}
+
+int32_t address_book_person_view_get_id(
+    struct address_book_person_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 1, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+struct pbtools_bytes_t address_book_person_view_get_email(
+    struct address_book_person_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+
+    value.buf_p = NULL;
+    value.size = 0;
+
+    if (pbtools_view_seek(&self_p->base, 2, &decoder)) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    return (value);
+}
+
+void address_book_person_view_phones_begin(
+    struct address_book_person_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 3);
+}
+
+bool address_book_person_view_phones_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct address_book_person_phone_number_view_t *value_p)
+{
+    struct pbtools_bytes_t value;
+
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, &value);
+    address_book_person_phone_number_view_init(value_p, value.buf_p, value.size);
+
+    return (true);
 }
 
 struct address_book_person_t *
@@ -244,6 +500,172 @@ int address_book_person_decode(
                 (pbtools_message_decode_inner_t)address_book_person_decode_inner));
 }
 
+int address_book_person_decode_segments(
+    struct address_book_person_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)address_book_person_decode_inner));
+}
+
+int address_book_person_decode_callbacks(
+    struct address_book_person_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct address_book_person_callbacks_t *callbacks_p,
+    void *arg_p)
+{
+    struct pbtools_repeated_callback_t callbacks[] = {
+        {
+            4,
+            sizeof(struct address_book_person_phone_number_t),
+            (pbtools_message_init_t)address_book_person_phone_number_init,
+            (pbtools_item_callback_t)callbacks_p->on_phones
+        }
+    };
+
+    return (pbtools_message_decode_callbacks(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)address_book_person_decode_inner,
+                &callbacks[0],
+                1,
+                arg_p));
+}
+
+static void address_book_person_phone_number_columns_alloc(
+    struct pbtools_decoder_t *decoder_p,
+    struct address_book_person_phone_number_columns_t *columns_p,
+    int length)
+{
+    columns_p->length = length;
+    columns_p->type.values_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        length,
+        sizeof(enum address_book_person_phone_type_e));
+    columns_p->type.present_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        (length + 7) / 8,
+        sizeof(uint8_t));
+}
+
+static void address_book_person_phone_number_decode_columns_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct address_book_person_phone_number_columns_t *columns_p,
+    int index)
+{
+    uint32_t key;
+    int wire_type;
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
+            columns_p->type.values_p[index] = pbtools_decoder_read_enum_unchecked(decoder_p);
+            columns_p->type.present_p[index / 8] |= (uint8_t)(1u << (index % 8));
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 2:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+}
+
+static void address_book_person_phone_number_encode_columns_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    const struct address_book_person_phone_number_columns_t *columns_p)
+{
+    int index;
+    int pos;
+
+    for (index = columns_p->length - 1; index >= 0; index--) {
+        pos = encoder_p->pos;
+
+        if ((columns_p->type.values_p != NULL)
+            && PBTOOLS_COLUMN_IS_PRESENT(
+                columns_p->type.present_p,
+                index)) {
+            pbtools_encoder_write_enum(
+                encoder_p,
+                2,
+                columns_p->type.values_p[index]);
+        }
+
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+int address_book_person_encode_columns(
+    struct address_book_person_t *self_p,
+    uint8_t *encoded_p,
+    size_t size,
+    const struct address_book_person_repeated_columns_t *columns_p)
+{
+    struct pbtools_repeated_columns_t columns[] = {
+        {
+            4,
+            columns_p->phones_p,
+            (pbtools_columns_alloc_t)address_book_person_phone_number_columns_alloc,
+            (pbtools_columns_decode_inner_t)address_book_person_phone_number_decode_columns_inner,
+            (pbtools_columns_encode_t)address_book_person_phone_number_encode_columns_inner
+        }
+    };
+
+    return (pbtools_message_encode_columns(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)address_book_person_encode_inner,
+                &columns[0],
+                1));
+}
+
+int address_book_person_decode_columns(
+    struct address_book_person_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct address_book_person_repeated_columns_t *columns_p)
+{
+    struct pbtools_repeated_columns_t columns[] = {
+        {
+            4,
+            columns_p->phones_p,
+            (pbtools_columns_alloc_t)address_book_person_phone_number_columns_alloc,
+            (pbtools_columns_decode_inner_t)address_book_person_phone_number_decode_columns_inner,
+            (pbtools_columns_encode_t)address_book_person_phone_number_encode_columns_inner
+        }
+    };
+
+    return (pbtools_message_decode_columns(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)address_book_person_decode_inner,
+                &columns[0],
+                1));
+}
+
 void address_book_address_book_init(
     struct address_book_address_book_t *self_p,
     struct pbtools_heap_t *heap_p)
@@ -266,22 +688,45 @@ void address_book_address_book_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct address_book_address_book_t *self_p)
 {
+    uint32_t key;
     int wire_type;
     struct pbtools_repeated_info_t repeated_info_people;
 
     pbtools_repeated_info_init(&repeated_info_people, 1);
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
 
-        case 1:
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_1:
             pbtools_repeated_info_decode(&repeated_info_people,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_1;
+            }
+
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -309,12 +754,14 @@ void address_book_address_book_encode_repeated_inner(
     int field_number,
     struct address_book_address_book_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct address_book_address_book_t),
-        (pbtools_message_encode_inner_t)address_book_address_book_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        address_book_address_book_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void address_book_address_book_decode_repeated_inner(
@@ -322,13 +769,76 @@ void address_book_address_book_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct address_book_address_book_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct address_book_address_book_t),
-        (pbtools_message_init_t)address_book_address_book_init,
-        (pbtools_message_decode_inner_t)address_book_address_book_decode_inner);
+        sizeof(struct address_book_address_book_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        address_book_address_book_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        address_book_address_book_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t address_book_address_book_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, true }
+};
+
+void address_book_address_book_view_init(
+    struct address_book_address_book_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &address_book_address_book_view_fields[0],
+                      1,
+                      &self_p->offsets[0]);
+}
+
+int address_book_address_book_view_error(
+    struct address_book_address_book_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+void address_book_address_book_view_people_begin(
+    struct address_book_address_book_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 0);
+}
+
+bool address_book_address_book_view_people_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct address_book_person_view_t *value_p)
+{
+    struct pbtools_bytes_t value;
+
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, &value);
+    address_book_person_view_init(value_p, value.buf_p, value.size);
+
+    return (true);
 }
 
 struct address_book_address_book_t *
@@ -366,3 +876,169 @@ int address_book_address_book_decode(
                 size,
                 (pbtools_message_decode_inner_t)address_book_address_book_decode_inner));
 }
+
+int address_book_address_book_decode_segments(
+    struct address_book_address_book_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)address_book_address_book_decode_inner));
+}
+
+int address_book_address_book_decode_callbacks(
+    struct address_book_address_book_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct address_book_address_book_callbacks_t *callbacks_p,
+    void *arg_p)
+{
+    struct pbtools_repeated_callback_t callbacks[] = {
+        {
+            1,
+            sizeof(struct address_book_person_t),
+            (pbtools_message_init_t)address_book_person_init,
+            (pbtools_item_callback_t)callbacks_p->on_people
+        }
+    };
+
+    return (pbtools_message_decode_callbacks(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)address_book_address_book_decode_inner,
+                &callbacks[0],
+                1,
+                arg_p));
+}
+
+static void address_book_person_columns_alloc(
+    struct pbtools_decoder_t *decoder_p,
+    struct address_book_person_columns_t *columns_p,
+    int length)
+{
+    columns_p->length = length;
+    columns_p->id.values_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        length,
+        sizeof(int32_t));
+    columns_p->id.present_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        (length + 7) / 8,
+        sizeof(uint8_t));
+}
+
+static void address_book_person_decode_columns_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct address_book_person_columns_t *columns_p,
+    int index)
+{
+    uint32_t key;
+    int wire_type;
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
+            columns_p->id.values_p[index] = pbtools_decoder_read_int32_unchecked(decoder_p);
+            columns_p->id.present_p[index / 8] |= (uint8_t)(1u << (index % 8));
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 2:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+}
+
+static void address_book_person_encode_columns_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    const struct address_book_person_columns_t *columns_p)
+{
+    int index;
+    int pos;
+
+    for (index = columns_p->length - 1; index >= 0; index--) {
+        pos = encoder_p->pos;
+
+        if ((columns_p->id.values_p != NULL)
+            && PBTOOLS_COLUMN_IS_PRESENT(
+                columns_p->id.present_p,
+                index)) {
+            pbtools_encoder_write_int32(
+                encoder_p,
+                2,
+                columns_p->id.values_p[index]);
+        }
+
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+int address_book_address_book_encode_columns(
+    struct address_book_address_book_t *self_p,
+    uint8_t *encoded_p,
+    size_t size,
+    const struct address_book_address_book_repeated_columns_t *columns_p)
+{
+    struct pbtools_repeated_columns_t columns[] = {
+        {
+            1,
+            columns_p->people_p,
+            (pbtools_columns_alloc_t)address_book_person_columns_alloc,
+            (pbtools_columns_decode_inner_t)address_book_person_decode_columns_inner,
+            (pbtools_columns_encode_t)address_book_person_encode_columns_inner
+        }
+    };
+
+    return (pbtools_message_encode_columns(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)address_book_address_book_encode_inner,
+                &columns[0],
+                1));
+}
+
+int address_book_address_book_decode_columns(
+    struct address_book_address_book_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct address_book_address_book_repeated_columns_t *columns_p)
+{
+    struct pbtools_repeated_columns_t columns[] = {
+        {
+            1,
+            columns_p->people_p,
+            (pbtools_columns_alloc_t)address_book_person_columns_alloc,
+            (pbtools_columns_decode_inner_t)address_book_person_decode_columns_inner,
+            (pbtools_columns_encode_t)address_book_person_encode_columns_inner
+        }
+    };
+
+    return (pbtools_message_decode_columns(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)address_book_address_book_decode_inner,
+                &columns[0],
+                1));
+}
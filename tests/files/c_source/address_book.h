@@ -60,6 +60,14 @@ struct address_book_person_phone_number_t {
     enum address_book_person_phone_type_e type;
 };
 
+/**
+ * View of an encoded address_book.Person.PhoneNumber.
+ */
+struct address_book_person_phone_number_view_t {
+    struct pbtools_view_t base;
+    int offsets[2];
+};
+
 /**
  * Message address_book.Person.
  */
@@ -76,6 +84,41 @@ struct address_book_person_t {
     struct address_book_person_phone_number_repeated_t phones;
 };
 
+/**
+ * View of an encoded address_book.Person.
+ */
+struct address_book_person_view_t {
+    struct pbtools_view_t base;
+    int offsets[4];
+};
+
+/**
+ * Callbacks of address_book.Person repeated sub-message fields.
+ */
+struct address_book_person_callbacks_t {
+    void (*on_phones)(
+        void *arg_p,
+        const struct address_book_person_phone_number_t *item_p);
+};
+
+/**
+ * Columns of repeated address_book.Person.PhoneNumber items.
+ */
+struct address_book_person_phone_number_columns_t {
+    int length;
+    struct {
+        enum address_book_person_phone_type_e *values_p;
+        uint8_t *present_p;
+    } type;
+};
+
+/**
+ * Columns of address_book.Person repeated sub-message fields.
+ */
+struct address_book_person_repeated_columns_t {
+    struct address_book_person_phone_number_columns_t *phones_p;
+};
+
 /**
  * Message address_book.AddressBook.
  */
@@ -89,10 +132,90 @@ struct address_book_address_book_t {
     struct address_book_person_repeated_t people;
 };
 
+/**
+ * View of an encoded address_book.AddressBook.
+ */
+struct address_book_address_book_view_t {
+    struct pbtools_view_t base;
+    int offsets[1];
+};
+
+/**
+ * Callbacks of address_book.AddressBook repeated sub-message fields.
+ */
+struct address_book_address_book_callbacks_t {
+    void (*on_people)(
+        void *arg_p,
+        const struct address_book_person_t *item_p);
+};
+
+/**
+ * Columns of repeated address_book.Person items.
+ */
+struct address_book_person_columns_t {
+    int length;
+    struct {
+        int32_t *values_p;
+        uint8_t *present_p;
+    } id;
+};
+
+/**
+ * Columns of address_book.AddressBook repeated sub-message fields.
+ */
+struct address_book_address_book_repeated_columns_t {
+    struct address_book_person_columns_t *people_p;
+};
+
 int address_book_person_phones_alloc(
     struct address_book_person_t *self_p,
     int length);
 
+/**
+ * Fields of an encoded address_book.Person.PhoneNumber read on demand.
+ */
+void address_book_person_phone_number_view_init(
+    struct address_book_person_phone_number_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int address_book_person_phone_number_view_error(
+    struct address_book_person_phone_number_view_t *self_p);
+
+struct pbtools_bytes_t address_book_person_phone_number_view_get_number(
+    struct address_book_person_phone_number_view_t *self_p);
+
+enum address_book_person_phone_type_e address_book_person_phone_number_view_get_type(
+    struct address_book_person_phone_number_view_t *self_p);
+
+/**
+ * Fields of an encoded address_book.Person read on demand.
+ */
+void address_book_person_view_init(
+    struct address_book_person_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int address_book_person_view_error(
+    struct address_book_person_view_t *self_p);
+
+struct pbtools_bytes_t address_book_person_view_get_name(
+    struct address_book_person_view_t *self_p);
+
+int32_t address_book_person_view_get_id(
+    struct address_book_person_view_t *self_p);
+
+struct pbtools_bytes_t address_book_person_view_get_email(
+    struct address_book_person_view_t *self_p);
+
+void address_book_person_view_phones_begin(
+    struct address_book_person_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool address_book_person_view_phones_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct address_book_person_phone_number_view_t *value_p);
+
 /**
  * Encoding and decoding of address_book.Person.
  */
@@ -111,10 +234,53 @@ int address_book_person_decode(
     const uint8_t *encoded_p,
     size_t size);
 
+int address_book_person_decode_segments(
+    struct address_book_person_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+int address_book_person_decode_callbacks(
+    struct address_book_person_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct address_book_person_callbacks_t *callbacks_p,
+    void *arg_p);
+
+int address_book_person_encode_columns(
+    struct address_book_person_t *self_p,
+    uint8_t *encoded_p,
+    size_t size,
+    const struct address_book_person_repeated_columns_t *columns_p);
+
+int address_book_person_decode_columns(
+    struct address_book_person_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct address_book_person_repeated_columns_t *columns_p);
+
 int address_book_address_book_people_alloc(
     struct address_book_address_book_t *self_p,
     int length);
 
+/**
+ * Fields of an encoded address_book.AddressBook read on demand.
+ */
+void address_book_address_book_view_init(
+    struct address_book_address_book_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int address_book_address_book_view_error(
+    struct address_book_address_book_view_t *self_p);
+
+void address_book_address_book_view_people_begin(
+    struct address_book_address_book_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool address_book_address_book_view_people_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct address_book_person_view_t *value_p);
+
 /**
  * Encoding and decoding of address_book.AddressBook.
  */
@@ -133,6 +299,30 @@ int address_book_address_book_decode(
     const uint8_t *encoded_p,
     size_t size);
 
+int address_book_address_book_decode_segments(
+    struct address_book_address_book_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+int address_book_address_book_decode_callbacks(
+    struct address_book_address_book_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct address_book_address_book_callbacks_t *callbacks_p,
+    void *arg_p);
+
+int address_book_address_book_encode_columns(
+    struct address_book_address_book_t *self_p,
+    uint8_t *encoded_p,
+    size_t size,
+    const struct address_book_address_book_repeated_columns_t *columns_p);
+
+int address_book_address_book_decode_columns(
+    struct address_book_address_book_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct address_book_address_book_repeated_columns_t *columns_p);
+
 /* Internal functions. Do not use! */
 
 void address_book_person_init(
@@ -78,77 +78,250 @@ void benchmark_sub_message_encode_inner(
     pbtools_encoder_write_uint32(encoder_p, 1, self_p->field1);
 }
 
+static const uint32_t benchmark_sub_message_keys[16] = {
+    PBTOOLS_KEY(300, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(204, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(13, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(21, PBTOOLS_WIRE_TYPE_64_BIT),
+    0,
+    PBTOOLS_KEY(206, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(14, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(22, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(207, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(12, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(15, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(205, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(203, PBTOOLS_WIRE_TYPE_32_BIT)
+};
+
+static const uint8_t benchmark_sub_message_displacements[8] = {
+    1, 2, 5, 7, 0, 11, 0, 1
+};
+
 void benchmark_sub_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct benchmark_sub_message_t *self_p)
 {
+    uint32_t key;
+    uint32_t hash;
+    uint32_t slot;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+        hash = (key * 0x7d99c885u);
+        slot = (((hash >> 25) & 0xf)
+                ^ benchmark_sub_message_displacements[hash >> 29]);
+
+        if (benchmark_sub_message_keys[slot] != key) {
+            slot = 16;
+        }
+
+        switch (slot) {
+
+        case 7:
+            self_p->field1 = pbtools_decoder_read_uint32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
 
-        case 1:
-            self_p->field1 = pbtools_decoder_read_uint32(decoder_p, wire_type);
             break;
 
-        case 2:
-            self_p->field2 = pbtools_decoder_read_uint32(decoder_p, wire_type);
+        case 12:
+        field_2:
+            self_p->field2 = pbtools_decoder_read_uint32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_3;
+            }
+
             break;
 
         case 3:
-            self_p->field3 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        field_3:
+            self_p->field3 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  15,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_15;
+            }
+
             break;
 
-        case 15:
-            pbtools_decoder_read_string(decoder_p, wire_type, &self_p->field15_p);
+        case 13:
+        field_15:
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->field15_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  12,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_12;
+            }
+
             break;
 
-        case 12:
-            pbtools_decoder_read_bytes(decoder_p, wire_type, &self_p->field12);
+        case 11:
+        field_12:
+            pbtools_decoder_read_bytes_unchecked(decoder_p, &self_p->field12);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  13,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_13;
+            }
+
             break;
 
-        case 13:
-            self_p->field13 = pbtools_decoder_read_int64(decoder_p, wire_type);
+        case 2:
+        field_13:
+            self_p->field13 = pbtools_decoder_read_int64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  14,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_14;
+            }
+
             break;
 
-        case 14:
-            self_p->field14 = pbtools_decoder_read_int64(decoder_p, wire_type);
+        case 8:
+        field_14:
+            self_p->field14 = pbtools_decoder_read_int64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  21,
+                                                  PBTOOLS_WIRE_TYPE_64_BIT)) {
+                goto field_21;
+            }
+
             break;
 
-        case 21:
-            self_p->field21 = pbtools_decoder_read_fixed64(decoder_p, wire_type);
+        case 4:
+        field_21:
+            self_p->field21 = pbtools_decoder_read_fixed64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  22,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_22;
+            }
+
             break;
 
-        case 22:
-            self_p->field22 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case 9:
+        field_22:
+            self_p->field22 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  206,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_206;
+            }
+
             break;
 
-        case 206:
-            self_p->field206 = pbtools_decoder_read_bool(decoder_p, wire_type);
+        case 6:
+        field_206:
+            self_p->field206 = pbtools_decoder_read_bool_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  203,
+                                                  PBTOOLS_WIRE_TYPE_32_BIT)) {
+                goto field_203;
+            }
+
             break;
 
-        case 203:
-            self_p->field203 = pbtools_decoder_read_fixed32(decoder_p, wire_type);
+        case 15:
+        field_203:
+            self_p->field203 = pbtools_decoder_read_fixed32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  204,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_204;
+            }
+
             break;
 
-        case 204:
-            self_p->field204 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case 1:
+        field_204:
+            self_p->field204 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  205,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_205;
+            }
+
             break;
 
-        case 205:
-            pbtools_decoder_read_string(decoder_p, wire_type, &self_p->field205_p);
+        case 14:
+        field_205:
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->field205_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  207,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_207;
+            }
+
             break;
 
-        case 207:
-            self_p->field207 = pbtools_decoder_read_uint64(decoder_p, wire_type);
+        case 10:
+        field_207:
+            self_p->field207 = pbtools_decoder_read_uint64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  300,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_300;
+            }
+
             break;
 
-        case 300:
-            self_p->field300 = pbtools_decoder_read_enum(decoder_p, wire_type);
+        case 0:
+        field_300:
+            self_p->field300 = pbtools_decoder_read_enum_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 12:
+            case 13:
+            case 14:
+            case 15:
+            case 21:
+            case 22:
+            case 203:
+            case 204:
+            case 205:
+            case 206:
+            case 207:
+            case 300:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -159,12 +332,14 @@ void benchmark_sub_message_encode_repeated_inner(
     int field_number,
     struct benchmark_sub_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct benchmark_sub_message_t),
-        (pbtools_message_encode_inner_t)benchmark_sub_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        benchmark_sub_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void benchmark_sub_message_decode_repeated_inner(
@@ -172,13 +347,30 @@ void benchmark_sub_message_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct benchmark_sub_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct benchmark_sub_message_t),
-        (pbtools_message_init_t)benchmark_sub_message_init,
-        (pbtools_message_decode_inner_t)benchmark_sub_message_decode_inner);
+        sizeof(struct benchmark_sub_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        benchmark_sub_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        benchmark_sub_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct benchmark_sub_message_t *
@@ -276,113 +468,355 @@ void benchmark_message1_encode_inner(
     pbtools_encoder_write_bool(encoder_p, 80, self_p->field80);
 }
 
+static const uint32_t benchmark_message1_keys[32] = {
+    PBTOOLS_KEY(67, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    0,
+    0,
+    PBTOOLS_KEY(22, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(131, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(150, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(68, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(280, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(59, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(15, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(78, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(23, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    0,
+    0,
+    PBTOOLS_KEY(24, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(80, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(25, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(16, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(81, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(129, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    0,
+    PBTOOLS_KEY(128, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    0,
+    0,
+    0
+};
+
+static const uint8_t benchmark_message1_displacements[16] = {
+    1, 0, 0, 2, 8, 0, 1, 0,
+    0, 0, 0, 0, 8, 0, 3, 0
+};
+
 void benchmark_message1_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct benchmark_message1_t *self_p)
 {
+    uint32_t key;
+    uint32_t hash;
+    uint32_t slot;
     int wire_type;
     struct pbtools_repeated_info_t repeated_info_field4;
 
     pbtools_repeated_info_init(&repeated_info_field4, 4);
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+        hash = (key * 0x9e3779b1u);
+        slot = (((hash >> 23) & 0x1f)
+                ^ benchmark_message1_displacements[hash >> 28]);
 
-        case 80:
-            self_p->field80 = pbtools_decoder_read_bool(decoder_p, wire_type);
-            break;
+        if (benchmark_message1_keys[slot] != key) {
+            slot = 32;
+        }
+
+        switch (slot) {
+
+        case 21:
+            self_p->field80 = pbtools_decoder_read_bool_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  81,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_81;
+            }
 
-        case 81:
-            self_p->field81 = pbtools_decoder_read_bool(decoder_p, wire_type);
             break;
 
-        case 2:
-            self_p->field2 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case 24:
+        field_81:
+            self_p->field81 = pbtools_decoder_read_bool_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
+
             break;
 
-        case 3:
-            self_p->field3 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case 5:
+        field_2:
+            self_p->field2 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_3;
+            }
+
             break;
 
-        case 280:
-            self_p->field280 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case 10:
+        field_3:
+            self_p->field3 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  280,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_280;
+            }
+
             break;
 
-        case 6:
-            self_p->field6 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case 11:
+        field_280:
+            self_p->field280 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  6,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_6;
+            }
+
             break;
 
-        case 22:
-            self_p->field22 = pbtools_decoder_read_int64(decoder_p, wire_type);
+        case 20:
+        field_6:
+            self_p->field6 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  22,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_22;
+            }
+
             break;
 
         case 4:
+        field_22:
+            self_p->field22 = pbtools_decoder_read_int64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_4;
+            }
+
+            break;
+
+        case 7:
+        field_4:
             pbtools_repeated_info_decode_string(
                 &repeated_info_field4,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_4;
+            }
+
             break;
 
-        case 59:
-            self_p->field59 = pbtools_decoder_read_bool(decoder_p, wire_type);
+        case 12:
+            self_p->field59 = pbtools_decoder_read_bool_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  16,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_16;
+            }
+
             break;
 
-        case 16:
-            self_p->field16 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case 23:
+        field_16:
+            self_p->field16 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  150,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_150;
+            }
+
             break;
 
-        case 150:
-            self_p->field150 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case 8:
+        field_150:
+            self_p->field150 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  23,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_23;
+            }
+
             break;
 
-        case 23:
-            self_p->field23 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case 15:
+        field_23:
+            self_p->field23 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  24,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_24;
+            }
+
             break;
 
-        case 24:
-            self_p->field24 = pbtools_decoder_read_bool(decoder_p, wire_type);
+        case 19:
+        field_24:
+            self_p->field24 = pbtools_decoder_read_bool_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  25,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_25;
+            }
+
             break;
 
-        case 25:
-            self_p->field25 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case 22:
+        field_25:
+            self_p->field25 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  15,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_15;
+            }
+
             break;
 
-        case 15:
-            pbtools_decoder_sub_message_decode(
+        case 13:
+        field_15:
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->field15_p,
                 sizeof(struct benchmark_sub_message_t),
                 (pbtools_message_init_t)benchmark_sub_message_init,
                 (pbtools_message_decode_inner_t)benchmark_sub_message_decode_inner);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  78,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_78;
+            }
+
             break;
 
-        case 78:
-            self_p->field78 = pbtools_decoder_read_bool(decoder_p, wire_type);
+        case 14:
+        field_78:
+            self_p->field78 = pbtools_decoder_read_bool_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  67,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_67;
+            }
+
             break;
 
-        case 67:
-            self_p->field67 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case 0:
+        field_67:
+            self_p->field67 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  68,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_68;
+            }
+
             break;
 
-        case 68:
-            self_p->field68 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case 9:
+        field_68:
+            self_p->field68 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  128,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_128;
+            }
+
             break;
 
-        case 128:
-            self_p->field128 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case 27:
+        field_128:
+            self_p->field128 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  129,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_129;
+            }
+
             break;
 
-        case 129:
-            pbtools_decoder_read_string(decoder_p, wire_type, &self_p->field129_p);
+        case 25:
+        field_129:
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->field129_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  131,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_131;
+            }
+
             break;
 
-        case 131:
-            self_p->field131 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case 6:
+        field_131:
+            self_p->field131 = pbtools_decoder_read_int32_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 2:
+            case 3:
+            case 4:
+            case 6:
+            case 15:
+            case 16:
+            case 22:
+            case 23:
+            case 24:
+            case 25:
+            case 59:
+            case 67:
+            case 68:
+            case 78:
+            case 80:
+            case 81:
+            case 128:
+            case 129:
+            case 131:
+            case 150:
+            case 280:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -418,12 +852,14 @@ void benchmark_message1_encode_repeated_inner(
     int field_number,
     struct benchmark_message1_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct benchmark_message1_t),
-        (pbtools_message_encode_inner_t)benchmark_message1_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        benchmark_message1_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void benchmark_message1_decode_repeated_inner(
@@ -431,13 +867,30 @@ void benchmark_message1_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct benchmark_message1_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct benchmark_message1_t),
-        (pbtools_message_init_t)benchmark_message1_init,
-        (pbtools_message_decode_inner_t)benchmark_message1_decode_inner);
+        sizeof(struct benchmark_message1_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        benchmark_message1_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        benchmark_message1_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct benchmark_message1_t *
@@ -505,37 +958,97 @@ void benchmark_message2_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct benchmark_message2_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->field1 = pbtools_decoder_read_enum_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
 
-        case 1:
-            self_p->field1 = pbtools_decoder_read_enum(decoder_p, wire_type);
             break;
 
-        case 2:
-            self_p->field2 = pbtools_decoder_read_uint64(decoder_p, wire_type);
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
+        field_2:
+            self_p->field2 = pbtools_decoder_read_uint64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_3;
+            }
+
             break;
 
-        case 3:
-            self_p->field3 = pbtools_decoder_read_sint32(decoder_p, wire_type);
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_VARINT):
+        field_3:
+            self_p->field3 = pbtools_decoder_read_sint32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_4;
+            }
+
             break;
 
-        case 4:
-            pbtools_decoder_read_string(decoder_p, wire_type, &self_p->field4_p);
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_4:
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->field4_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  5,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_5;
+            }
+
             break;
 
-        case 5:
-            self_p->field5 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_VARINT):
+        field_5:
+            self_p->field5 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  6,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_6;
+            }
+
             break;
 
-        case 6:
-            self_p->field6 = pbtools_decoder_read_bool(decoder_p, wire_type);
+        case PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_VARINT):
+        field_6:
+            self_p->field6 = pbtools_decoder_read_bool_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -546,12 +1059,14 @@ void benchmark_message2_encode_repeated_inner(
     int field_number,
     struct benchmark_message2_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct benchmark_message2_t),
-        (pbtools_message_encode_inner_t)benchmark_message2_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        benchmark_message2_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void benchmark_message2_decode_repeated_inner(
@@ -559,13 +1074,30 @@ void benchmark_message2_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct benchmark_message2_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct benchmark_message2_t),
-        (pbtools_message_init_t)benchmark_message2_init,
-        (pbtools_message_decode_inner_t)benchmark_message2_decode_inner);
+        sizeof(struct benchmark_message2_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        benchmark_message2_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        benchmark_message2_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct benchmark_message2_t *
@@ -627,37 +1159,112 @@ void benchmark_message3_sub_message_encode_inner(
     pbtools_encoder_write_int32(encoder_p, 28, self_p->field28);
 }
 
+static const uint32_t benchmark_message3_sub_message_keys[8] = {
+    0,
+    0,
+    PBTOOLS_KEY(12, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    PBTOOLS_KEY(11, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(19, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(28, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT)
+};
+
+static const uint8_t benchmark_message3_sub_message_displacements[4] = {
+    0, 0, 0, 3
+};
+
 void benchmark_message3_sub_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct benchmark_message3_sub_message_t *self_p)
 {
+    uint32_t key;
+    uint32_t hash;
+    uint32_t slot;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+        hash = (key * 0x9e3779b1u);
+        slot = (((hash >> 27) & 0x7)
+                ^ benchmark_message3_sub_message_displacements[hash >> 30]);
+
+        if (benchmark_message3_sub_message_keys[slot] != key) {
+            slot = 8;
+        }
+
+        switch (slot) {
+
+        case 6:
+            self_p->field28 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
 
-        case 28:
-            self_p->field28 = pbtools_decoder_read_int32(decoder_p, wire_type);
             break;
 
-        case 2:
-            self_p->field2 = pbtools_decoder_read_int64(decoder_p, wire_type);
+        case 7:
+        field_2:
+            self_p->field2 = pbtools_decoder_read_int64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  12,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_12;
+            }
+
             break;
 
-        case 12:
-            self_p->field12 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case 2:
+        field_12:
+            self_p->field12 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  19,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_19;
+            }
+
             break;
 
-        case 19:
-            pbtools_decoder_read_string(decoder_p, wire_type, &self_p->field19_p);
+        case 5:
+        field_19:
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->field19_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  11,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_11;
+            }
+
             break;
 
-        case 11:
-            self_p->field11 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case 4:
+        field_11:
+            self_p->field11 = pbtools_decoder_read_int32_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 2:
+            case 11:
+            case 12:
+            case 19:
+            case 28:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -668,12 +1275,14 @@ void benchmark_message3_sub_message_encode_repeated_inner(
     int field_number,
     struct benchmark_message3_sub_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct benchmark_message3_sub_message_t),
-        (pbtools_message_encode_inner_t)benchmark_message3_sub_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        benchmark_message3_sub_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void benchmark_message3_sub_message_decode_repeated_inner(
@@ -681,13 +1290,30 @@ void benchmark_message3_sub_message_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct benchmark_message3_sub_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct benchmark_message3_sub_message_t),
-        (pbtools_message_init_t)benchmark_message3_sub_message_init,
-        (pbtools_message_decode_inner_t)benchmark_message3_sub_message_decode_inner);
+        sizeof(struct benchmark_message3_sub_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        benchmark_message3_sub_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        benchmark_message3_sub_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 void benchmark_message3_init(
@@ -712,22 +1338,45 @@ void benchmark_message3_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct benchmark_message3_t *self_p)
 {
+    uint32_t key;
     int wire_type;
     struct pbtools_repeated_info_t repeated_info_field13;
 
     pbtools_repeated_info_init(&repeated_info_field13, 13);
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 13:
+        switch (key) {
+
+        case PBTOOLS_KEY(13, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_13:
             pbtools_repeated_info_decode(&repeated_info_field13,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  13,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_13;
+            }
+
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 13:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -755,12 +1404,14 @@ void benchmark_message3_encode_repeated_inner(
     int field_number,
     struct benchmark_message3_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct benchmark_message3_t),
-        (pbtools_message_encode_inner_t)benchmark_message3_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        benchmark_message3_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void benchmark_message3_decode_repeated_inner(
@@ -768,13 +1419,30 @@ void benchmark_message3_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct benchmark_message3_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct benchmark_message3_t),
-        (pbtools_message_init_t)benchmark_message3_init,
-        (pbtools_message_decode_inner_t)benchmark_message3_decode_inner);
+        sizeof(struct benchmark_message3_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        benchmark_message3_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        benchmark_message3_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct benchmark_message3_t *
@@ -851,13 +1519,11 @@ int benchmark_message_message3_alloc(
 
 static void benchmark_message_message1_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct benchmark_message_t *self_p)
 {
     self_p->oneof = benchmark_message_oneof_message1_e;
-    pbtools_decoder_sub_message_decode(
+    pbtools_decoder_sub_message_decode_unchecked(
         decoder_p,
-        wire_type,
         (struct pbtools_message_base_t **)&self_p->message1_p,
         sizeof(struct benchmark_message1_t),
         (pbtools_message_init_t)benchmark_message1_init,
@@ -866,13 +1532,11 @@ static void benchmark_message_message1_decode(
 
 static void benchmark_message_message2_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct benchmark_message_t *self_p)
 {
     self_p->oneof = benchmark_message_oneof_message2_e;
-    pbtools_decoder_sub_message_decode(
+    pbtools_decoder_sub_message_decode_unchecked(
         decoder_p,
-        wire_type,
         (struct pbtools_message_base_t **)&self_p->message2_p,
         sizeof(struct benchmark_message2_t),
         (pbtools_message_init_t)benchmark_message2_init,
@@ -881,13 +1545,11 @@ static void benchmark_message_message2_decode(
 
 static void benchmark_message_message3_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct benchmark_message_t *self_p)
 {
     self_p->oneof = benchmark_message_oneof_message3_e;
-    pbtools_decoder_sub_message_decode(
+    pbtools_decoder_sub_message_decode_unchecked(
         decoder_p,
-        wire_type,
         (struct pbtools_message_base_t **)&self_p->message3_p,
         sizeof(struct benchmark_message3_t),
         (pbtools_message_init_t)benchmark_message3_init,
@@ -941,34 +1603,48 @@ void benchmark_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct benchmark_message_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 1:
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
             benchmark_message_message1_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
-        case 2:
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
             benchmark_message_message2_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
-        case 7:
+        case PBTOOLS_KEY(7, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
             benchmark_message_message3_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 7:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -979,12 +1655,14 @@ void benchmark_message_encode_repeated_inner(
     int field_number,
     struct benchmark_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct benchmark_message_t),
-        (pbtools_message_encode_inner_t)benchmark_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        benchmark_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void benchmark_message_decode_repeated_inner(
@@ -992,13 +1670,30 @@ void benchmark_message_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct benchmark_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct benchmark_message_t),
-        (pbtools_message_init_t)benchmark_message_init,
-        (pbtools_message_decode_inner_t)benchmark_message_decode_inner);
+        sizeof(struct benchmark_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        benchmark_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        benchmark_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct benchmark_message_t *
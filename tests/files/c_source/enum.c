@@ -54,17 +54,32 @@ void enum_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct enum_message_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 1:
-            self_p->value = pbtools_decoder_read_enum(decoder_p, wire_type);
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->value = pbtools_decoder_read_enum_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -75,12 +90,14 @@ void enum_message_encode_repeated_inner(
     int field_number,
     struct enum_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct enum_message_t),
-        (pbtools_message_encode_inner_t)enum_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        enum_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void enum_message_decode_repeated_inner(
@@ -88,13 +105,30 @@ void enum_message_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct enum_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct enum_message_t),
-        (pbtools_message_init_t)enum_message_init,
-        (pbtools_message_decode_inner_t)enum_message_decode_inner);
+        sizeof(struct enum_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        enum_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        enum_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct enum_message_t *
@@ -154,21 +188,45 @@ void enum_message2_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct enum_message2_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->outer = pbtools_decoder_read_enum_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
 
-        case 1:
-            self_p->outer = pbtools_decoder_read_enum(decoder_p, wire_type);
             break;
 
-        case 2:
-            self_p->inner = pbtools_decoder_read_enum(decoder_p, wire_type);
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
+        field_2:
+            self_p->inner = pbtools_decoder_read_enum_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -179,12 +237,14 @@ void enum_message2_encode_repeated_inner(
     int field_number,
     struct enum_message2_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct enum_message2_t),
-        (pbtools_message_encode_inner_t)enum_message2_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        enum_message2_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void enum_message2_decode_repeated_inner(
@@ -192,13 +252,30 @@ void enum_message2_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct enum_message2_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct enum_message2_t),
-        (pbtools_message_init_t)enum_message2_init,
-        (pbtools_message_decode_inner_t)enum_message2_decode_inner);
+        sizeof(struct enum_message2_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        enum_message2_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        enum_message2_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct enum_message2_t *
@@ -256,17 +333,32 @@ void enum_limits_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct enum_limits_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
 
-        case 1:
-            self_p->value = pbtools_decoder_read_enum(decoder_p, wire_type);
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->value = pbtools_decoder_read_enum_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -277,12 +369,14 @@ void enum_limits_encode_repeated_inner(
     int field_number,
     struct enum_limits_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct enum_limits_t),
-        (pbtools_message_encode_inner_t)enum_limits_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        enum_limits_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void enum_limits_decode_repeated_inner(
@@ -290,13 +384,30 @@ void enum_limits_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct enum_limits_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct enum_limits_t),
-        (pbtools_message_init_t)enum_limits_init,
-        (pbtools_message_decode_inner_t)enum_limits_decode_inner);
+        sizeof(struct enum_limits_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        enum_limits_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        enum_limits_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct enum_limits_t *
@@ -354,17 +465,32 @@ void enum_allow_alias_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct enum_allow_alias_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 1:
-            self_p->value = pbtools_decoder_read_enum(decoder_p, wire_type);
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->value = pbtools_decoder_read_enum_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -375,12 +501,14 @@ void enum_allow_alias_encode_repeated_inner(
     int field_number,
     struct enum_allow_alias_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct enum_allow_alias_t),
-        (pbtools_message_encode_inner_t)enum_allow_alias_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        enum_allow_alias_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void enum_allow_alias_decode_repeated_inner(
@@ -388,13 +516,30 @@ void enum_allow_alias_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct enum_allow_alias_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct enum_allow_alias_t),
-        (pbtools_message_init_t)enum_allow_alias_init,
-        (pbtools_message_decode_inner_t)enum_allow_alias_decode_inner);
+        sizeof(struct enum_allow_alias_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        enum_allow_alias_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        enum_allow_alias_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct enum_allow_alias_t *
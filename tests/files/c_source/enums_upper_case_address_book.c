@@ -56,21 +56,45 @@ void address_book_person_phone_number_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct address_book_person_phone_number_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->number_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
 
-        case 1:
-            pbtools_decoder_read_string(decoder_p, wire_type, &self_p->number_p);
             break;
 
-        case 2:
-            self_p->type = pbtools_decoder_read_enum(decoder_p, wire_type);
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
+        field_2:
+            self_p->type = pbtools_decoder_read_enum_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -81,12 +105,14 @@ void address_book_person_phone_number_encode_repeated_inner(
     int field_number,
     struct address_book_person_phone_number_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct address_book_person_phone_number_t),
-        (pbtools_message_encode_inner_t)address_book_person_phone_number_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        address_book_person_phone_number_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void address_book_person_phone_number_decode_repeated_inner(
@@ -94,13 +120,30 @@ void address_book_person_phone_number_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct address_book_person_phone_number_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct address_book_person_phone_number_t),
-        (pbtools_message_init_t)address_book_person_phone_number_init,
-        (pbtools_message_decode_inner_t)address_book_person_phone_number_decode_inner);
+        sizeof(struct address_book_person_phone_number_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        address_book_person_phone_number_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        address_book_person_phone_number_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 void address_book_person_init(
@@ -131,34 +174,83 @@ void address_book_person_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct address_book_person_t *self_p)
 {
+    uint32_t key;
     int wire_type;
     struct pbtools_repeated_info_t repeated_info_phones;
 
     pbtools_repeated_info_init(&repeated_info_phones, 4);
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->name_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
 
-        case 1:
-            pbtools_decoder_read_string(decoder_p, wire_type, &self_p->name_p);
             break;
 
-        case 2:
-            self_p->id = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
+        field_2:
+            self_p->id = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_3;
+            }
+
             break;
 
-        case 3:
-            pbtools_decoder_read_string(decoder_p, wire_type, &self_p->email_p);
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_3:
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->email_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_4;
+            }
+
             break;
 
-        case 4:
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_4:
             pbtools_repeated_info_decode(&repeated_info_phones,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_4;
+            }
+
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -186,12 +278,14 @@ void address_book_person_encode_repeated_inner(
     int field_number,
     struct address_book_person_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct address_book_person_t),
-        (pbtools_message_encode_inner_t)address_book_person_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        address_book_person_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void address_book_person_decode_repeated_inner(
@@ -199,13 +293,30 @@ void address_book_person_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct address_book_person_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct address_book_person_t),
-        (pbtools_message_init_t)address_book_person_init,
-        (pbtools_message_decode_inner_t)address_book_person_decode_inner);
+        sizeof(struct address_book_person_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        address_book_person_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        address_book_person_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct address_book_person_t *
@@ -266,22 +377,45 @@ void address_book_address_book_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct address_book_address_book_t *self_p)
 {
+    uint32_t key;
     int wire_type;
     struct pbtools_repeated_info_t repeated_info_people;
 
     pbtools_repeated_info_init(&repeated_info_people, 1);
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 1:
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_1:
             pbtools_repeated_info_decode(&repeated_info_people,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_1;
+            }
+
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -309,12 +443,14 @@ void address_book_address_book_encode_repeated_inner(
     int field_number,
     struct address_book_address_book_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct address_book_address_book_t),
-        (pbtools_message_encode_inner_t)address_book_address_book_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        address_book_address_book_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void address_book_address_book_decode_repeated_inner(
@@ -322,13 +458,30 @@ void address_book_address_book_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct address_book_address_book_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct address_book_address_book_t),
-        (pbtools_message_init_t)address_book_address_book_init,
-        (pbtools_message_decode_inner_t)address_book_address_book_decode_inner);
+        sizeof(struct address_book_address_book_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        address_book_address_book_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        address_book_address_book_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct address_book_address_book_t *
@@ -54,17 +54,32 @@ void field_names_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct field_names_message_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 1:
-            self_p->my_value = pbtools_decoder_read_bool(decoder_p, wire_type);
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->my_value = pbtools_decoder_read_bool_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -75,12 +90,14 @@ void field_names_message_encode_repeated_inner(
     int field_number,
     struct field_names_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct field_names_message_t),
-        (pbtools_message_encode_inner_t)field_names_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        field_names_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void field_names_message_decode_repeated_inner(
@@ -88,13 +105,30 @@ void field_names_message_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct field_names_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct field_names_message_t),
-        (pbtools_message_init_t)field_names_message_init,
-        (pbtools_message_decode_inner_t)field_names_message_decode_inner);
+        sizeof(struct field_names_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        field_names_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        field_names_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct field_names_message_t *
@@ -188,79 +222,209 @@ void field_names_message_camel_case_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct field_names_message_camel_case_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->my_int32 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
 
-        case 1:
-            self_p->my_int32 = pbtools_decoder_read_int32(decoder_p, wire_type);
             break;
 
-        case 2:
-            self_p->my_int64 = pbtools_decoder_read_int64(decoder_p, wire_type);
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
+        field_2:
+            self_p->my_int64 = pbtools_decoder_read_int64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_3;
+            }
+
             break;
 
-        case 3:
-            self_p->my_sint32 = pbtools_decoder_read_sint32(decoder_p, wire_type);
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_VARINT):
+        field_3:
+            self_p->my_sint32 = pbtools_decoder_read_sint32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_4;
+            }
+
             break;
 
-        case 4:
-            self_p->my_sint64 = pbtools_decoder_read_sint64(decoder_p, wire_type);
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_VARINT):
+        field_4:
+            self_p->my_sint64 = pbtools_decoder_read_sint64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  5,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_5;
+            }
+
             break;
 
-        case 5:
-            self_p->my_uint32 = pbtools_decoder_read_uint32(decoder_p, wire_type);
+        case PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_VARINT):
+        field_5:
+            self_p->my_uint32 = pbtools_decoder_read_uint32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  6,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_6;
+            }
+
             break;
 
-        case 6:
-            self_p->my_uint64 = pbtools_decoder_read_uint64(decoder_p, wire_type);
+        case PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_VARINT):
+        field_6:
+            self_p->my_uint64 = pbtools_decoder_read_uint64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  7,
+                                                  PBTOOLS_WIRE_TYPE_32_BIT)) {
+                goto field_7;
+            }
+
             break;
 
-        case 7:
-            self_p->my_fixed32 = pbtools_decoder_read_fixed32(decoder_p, wire_type);
+        case PBTOOLS_KEY(7, PBTOOLS_WIRE_TYPE_32_BIT):
+        field_7:
+            self_p->my_fixed32 = pbtools_decoder_read_fixed32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  8,
+                                                  PBTOOLS_WIRE_TYPE_64_BIT)) {
+                goto field_8;
+            }
+
             break;
 
-        case 8:
-            self_p->my_fixed64 = pbtools_decoder_read_fixed64(decoder_p, wire_type);
+        case PBTOOLS_KEY(8, PBTOOLS_WIRE_TYPE_64_BIT):
+        field_8:
+            self_p->my_fixed64 = pbtools_decoder_read_fixed64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  9,
+                                                  PBTOOLS_WIRE_TYPE_32_BIT)) {
+                goto field_9;
+            }
+
             break;
 
-        case 9:
-            self_p->my_sfixed32 = pbtools_decoder_read_sfixed32(decoder_p, wire_type);
+        case PBTOOLS_KEY(9, PBTOOLS_WIRE_TYPE_32_BIT):
+        field_9:
+            self_p->my_sfixed32 = pbtools_decoder_read_sfixed32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  10,
+                                                  PBTOOLS_WIRE_TYPE_64_BIT)) {
+                goto field_10;
+            }
+
             break;
 
-        case 10:
-            self_p->my_sfixed64 = pbtools_decoder_read_sfixed64(decoder_p, wire_type);
+        case PBTOOLS_KEY(10, PBTOOLS_WIRE_TYPE_64_BIT):
+        field_10:
+            self_p->my_sfixed64 = pbtools_decoder_read_sfixed64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  11,
+                                                  PBTOOLS_WIRE_TYPE_32_BIT)) {
+                goto field_11;
+            }
+
             break;
 
-        case 11:
-            self_p->my_float = pbtools_decoder_read_float(decoder_p, wire_type);
+        case PBTOOLS_KEY(11, PBTOOLS_WIRE_TYPE_32_BIT):
+        field_11:
+            self_p->my_float = pbtools_decoder_read_float_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  12,
+                                                  PBTOOLS_WIRE_TYPE_64_BIT)) {
+                goto field_12;
+            }
+
             break;
 
-        case 12:
-            self_p->my_double = pbtools_decoder_read_double(decoder_p, wire_type);
+        case PBTOOLS_KEY(12, PBTOOLS_WIRE_TYPE_64_BIT):
+        field_12:
+            self_p->my_double = pbtools_decoder_read_double_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  13,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_13;
+            }
+
             break;
 
-        case 13:
-            self_p->my_bool = pbtools_decoder_read_bool(decoder_p, wire_type);
+        case PBTOOLS_KEY(13, PBTOOLS_WIRE_TYPE_VARINT):
+        field_13:
+            self_p->my_bool = pbtools_decoder_read_bool_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  14,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_14;
+            }
+
             break;
 
-        case 14:
-            pbtools_decoder_read_string(decoder_p, wire_type, &self_p->my_string_p);
+        case PBTOOLS_KEY(14, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_14:
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->my_string_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  15,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_15;
+            }
+
             break;
 
-        case 15:
-            pbtools_decoder_read_bytes(decoder_p, wire_type, &self_p->my_bytes);
+        case PBTOOLS_KEY(15, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_15:
+            pbtools_decoder_read_bytes_unchecked(decoder_p, &self_p->my_bytes);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  16,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_16;
+            }
+
             break;
 
-        case 16:
-            self_p->my_enum = pbtools_decoder_read_enum(decoder_p, wire_type);
+        case PBTOOLS_KEY(16, PBTOOLS_WIRE_TYPE_VARINT):
+        field_16:
+            self_p->my_enum = pbtools_decoder_read_enum_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  17,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_17;
+            }
+
             break;
 
-        case 17:
-            pbtools_decoder_sub_message_decode(
+        case PBTOOLS_KEY(17, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_17:
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->my_message_p,
                 sizeof(struct field_names_message_t),
                 (pbtools_message_init_t)field_names_message_init,
@@ -268,7 +432,35 @@ void field_names_message_camel_case_decode_inner(
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+            case 7:
+            case 8:
+            case 9:
+            case 10:
+            case 11:
+            case 12:
+            case 13:
+            case 14:
+            case 15:
+            case 16:
+            case 17:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -289,12 +481,14 @@ void field_names_message_camel_case_encode_repeated_inner(
     int field_number,
     struct field_names_message_camel_case_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct field_names_message_camel_case_t),
-        (pbtools_message_encode_inner_t)field_names_message_camel_case_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        field_names_message_camel_case_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void field_names_message_camel_case_decode_repeated_inner(
@@ -302,13 +496,30 @@ void field_names_message_camel_case_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct field_names_message_camel_case_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct field_names_message_camel_case_t),
-        (pbtools_message_init_t)field_names_message_camel_case_init,
-        (pbtools_message_decode_inner_t)field_names_message_camel_case_decode_inner);
+        sizeof(struct field_names_message_camel_case_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        field_names_message_camel_case_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        field_names_message_camel_case_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct field_names_message_camel_case_t *
@@ -402,79 +613,209 @@ void field_names_message_pascal_case_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct field_names_message_pascal_case_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->my_int32 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
 
-        case 1:
-            self_p->my_int32 = pbtools_decoder_read_int32(decoder_p, wire_type);
             break;
 
-        case 2:
-            self_p->my_int64 = pbtools_decoder_read_int64(decoder_p, wire_type);
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
+        field_2:
+            self_p->my_int64 = pbtools_decoder_read_int64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_3;
+            }
+
             break;
 
-        case 3:
-            self_p->my_sint32 = pbtools_decoder_read_sint32(decoder_p, wire_type);
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_VARINT):
+        field_3:
+            self_p->my_sint32 = pbtools_decoder_read_sint32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_4;
+            }
+
             break;
 
-        case 4:
-            self_p->my_sint64 = pbtools_decoder_read_sint64(decoder_p, wire_type);
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_VARINT):
+        field_4:
+            self_p->my_sint64 = pbtools_decoder_read_sint64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  5,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_5;
+            }
+
             break;
 
-        case 5:
-            self_p->my_uint32 = pbtools_decoder_read_uint32(decoder_p, wire_type);
+        case PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_VARINT):
+        field_5:
+            self_p->my_uint32 = pbtools_decoder_read_uint32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  6,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_6;
+            }
+
             break;
 
-        case 6:
-            self_p->my_uint64 = pbtools_decoder_read_uint64(decoder_p, wire_type);
+        case PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_VARINT):
+        field_6:
+            self_p->my_uint64 = pbtools_decoder_read_uint64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  7,
+                                                  PBTOOLS_WIRE_TYPE_32_BIT)) {
+                goto field_7;
+            }
+
             break;
 
-        case 7:
-            self_p->my_fixed32 = pbtools_decoder_read_fixed32(decoder_p, wire_type);
+        case PBTOOLS_KEY(7, PBTOOLS_WIRE_TYPE_32_BIT):
+        field_7:
+            self_p->my_fixed32 = pbtools_decoder_read_fixed32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  8,
+                                                  PBTOOLS_WIRE_TYPE_64_BIT)) {
+                goto field_8;
+            }
+
             break;
 
-        case 8:
-            self_p->my_fixed64 = pbtools_decoder_read_fixed64(decoder_p, wire_type);
+        case PBTOOLS_KEY(8, PBTOOLS_WIRE_TYPE_64_BIT):
+        field_8:
+            self_p->my_fixed64 = pbtools_decoder_read_fixed64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  9,
+                                                  PBTOOLS_WIRE_TYPE_32_BIT)) {
+                goto field_9;
+            }
+
             break;
 
-        case 9:
-            self_p->my_sfixed32 = pbtools_decoder_read_sfixed32(decoder_p, wire_type);
+        case PBTOOLS_KEY(9, PBTOOLS_WIRE_TYPE_32_BIT):
+        field_9:
+            self_p->my_sfixed32 = pbtools_decoder_read_sfixed32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  10,
+                                                  PBTOOLS_WIRE_TYPE_64_BIT)) {
+                goto field_10;
+            }
+
             break;
 
-        case 10:
-            self_p->my_sfixed64 = pbtools_decoder_read_sfixed64(decoder_p, wire_type);
+        case PBTOOLS_KEY(10, PBTOOLS_WIRE_TYPE_64_BIT):
+        field_10:
+            self_p->my_sfixed64 = pbtools_decoder_read_sfixed64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  11,
+                                                  PBTOOLS_WIRE_TYPE_32_BIT)) {
+                goto field_11;
+            }
+
             break;
 
-        case 11:
-            self_p->my_float = pbtools_decoder_read_float(decoder_p, wire_type);
+        case PBTOOLS_KEY(11, PBTOOLS_WIRE_TYPE_32_BIT):
+        field_11:
+            self_p->my_float = pbtools_decoder_read_float_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  12,
+                                                  PBTOOLS_WIRE_TYPE_64_BIT)) {
+                goto field_12;
+            }
+
             break;
 
-        case 12:
-            self_p->my_double = pbtools_decoder_read_double(decoder_p, wire_type);
+        case PBTOOLS_KEY(12, PBTOOLS_WIRE_TYPE_64_BIT):
+        field_12:
+            self_p->my_double = pbtools_decoder_read_double_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  13,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_13;
+            }
+
             break;
 
-        case 13:
-            self_p->my_bool = pbtools_decoder_read_bool(decoder_p, wire_type);
+        case PBTOOLS_KEY(13, PBTOOLS_WIRE_TYPE_VARINT):
+        field_13:
+            self_p->my_bool = pbtools_decoder_read_bool_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  14,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_14;
+            }
+
             break;
 
-        case 14:
-            pbtools_decoder_read_string(decoder_p, wire_type, &self_p->my_string_p);
+        case PBTOOLS_KEY(14, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_14:
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->my_string_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  15,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_15;
+            }
+
             break;
 
-        case 15:
-            pbtools_decoder_read_bytes(decoder_p, wire_type, &self_p->my_bytes);
+        case PBTOOLS_KEY(15, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_15:
+            pbtools_decoder_read_bytes_unchecked(decoder_p, &self_p->my_bytes);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  16,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_16;
+            }
+
             break;
 
-        case 16:
-            self_p->my_enum = pbtools_decoder_read_enum(decoder_p, wire_type);
+        case PBTOOLS_KEY(16, PBTOOLS_WIRE_TYPE_VARINT):
+        field_16:
+            self_p->my_enum = pbtools_decoder_read_enum_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  17,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_17;
+            }
+
             break;
 
-        case 17:
-            pbtools_decoder_sub_message_decode(
+        case PBTOOLS_KEY(17, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_17:
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->my_message_p,
                 sizeof(struct field_names_message_t),
                 (pbtools_message_init_t)field_names_message_init,
@@ -482,7 +823,35 @@ void field_names_message_pascal_case_decode_inner(
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+            case 7:
+            case 8:
+            case 9:
+            case 10:
+            case 11:
+            case 12:
+            case 13:
+            case 14:
+            case 15:
+            case 16:
+            case 17:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -503,12 +872,14 @@ void field_names_message_pascal_case_encode_repeated_inner(
     int field_number,
     struct field_names_message_pascal_case_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct field_names_message_pascal_case_t),
-        (pbtools_message_encode_inner_t)field_names_message_pascal_case_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        field_names_message_pascal_case_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void field_names_message_pascal_case_decode_repeated_inner(
@@ -516,13 +887,30 @@ void field_names_message_pascal_case_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct field_names_message_pascal_case_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct field_names_message_pascal_case_t),
-        (pbtools_message_init_t)field_names_message_pascal_case_init,
-        (pbtools_message_decode_inner_t)field_names_message_pascal_case_decode_inner);
+        sizeof(struct field_names_message_pascal_case_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        field_names_message_pascal_case_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        field_names_message_pascal_case_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct field_names_message_pascal_case_t *
@@ -615,6 +1003,7 @@ void field_names_repeated_message_camel_case_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct field_names_repeated_message_camel_case_t *self_p)
 {
+    uint32_t key;
     int wire_type;
     struct pbtools_repeated_info_t repeated_info_my_int32;
     struct pbtools_repeated_info_t repeated_info_my_int64;
@@ -653,128 +1042,390 @@ void field_names_repeated_message_camel_case_decode_inner(
     pbtools_repeated_info_init(&repeated_info_my_message, 17);
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 1:
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
             pbtools_repeated_info_decode_int32(
                 &repeated_info_my_int32,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_2;
+            }
+
             break;
 
-        case 2:
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_my_int32,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_2:
+            pbtools_repeated_info_decode_int64(
+                &repeated_info_my_int64,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_3;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
             pbtools_repeated_info_decode_int64(
                 &repeated_info_my_int64,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
             break;
 
-        case 3:
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_3:
             pbtools_repeated_info_decode_sint32(
                 &repeated_info_my_sint32,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_4;
+            }
+
             break;
 
-        case 4:
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_sint32(
+                &repeated_info_my_sint32,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_4:
             pbtools_repeated_info_decode_sint64(
                 &repeated_info_my_sint64,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  5,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_5;
+            }
+
             break;
 
-        case 5:
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_sint64(
+                &repeated_info_my_sint64,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_5:
+            pbtools_repeated_info_decode_uint32(
+                &repeated_info_my_uint32,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  6,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_6;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_VARINT):
             pbtools_repeated_info_decode_uint32(
                 &repeated_info_my_uint32,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
             break;
 
-        case 6:
+        case PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_6:
             pbtools_repeated_info_decode_uint64(
                 &repeated_info_my_uint64,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  7,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_7;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_uint64(
+                &repeated_info_my_uint64,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(7, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_7:
+            pbtools_repeated_info_decode_fixed32(
+                &repeated_info_my_fixed32,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  8,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_8;
+            }
+
             break;
 
-        case 7:
+        case PBTOOLS_KEY(7, PBTOOLS_WIRE_TYPE_32_BIT):
             pbtools_repeated_info_decode_fixed32(
                 &repeated_info_my_fixed32,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_32_BIT);
+            break;
+
+        case PBTOOLS_KEY(8, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_8:
+            pbtools_repeated_info_decode_fixed64(
+                &repeated_info_my_fixed64,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  9,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_9;
+            }
+
             break;
 
-        case 8:
+        case PBTOOLS_KEY(8, PBTOOLS_WIRE_TYPE_64_BIT):
             pbtools_repeated_info_decode_fixed64(
                 &repeated_info_my_fixed64,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_64_BIT);
             break;
 
-        case 9:
+        case PBTOOLS_KEY(9, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_9:
             pbtools_repeated_info_decode_sfixed32(
                 &repeated_info_my_sfixed32,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  10,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_10;
+            }
+
             break;
 
-        case 10:
+        case PBTOOLS_KEY(9, PBTOOLS_WIRE_TYPE_32_BIT):
+            pbtools_repeated_info_decode_sfixed32(
+                &repeated_info_my_sfixed32,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_32_BIT);
+            break;
+
+        case PBTOOLS_KEY(10, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_10:
             pbtools_repeated_info_decode_sfixed64(
                 &repeated_info_my_sfixed64,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  11,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_11;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(10, PBTOOLS_WIRE_TYPE_64_BIT):
+            pbtools_repeated_info_decode_sfixed64(
+                &repeated_info_my_sfixed64,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_64_BIT);
+            break;
+
+        case PBTOOLS_KEY(11, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_11:
+            pbtools_repeated_info_decode_float(
+                &repeated_info_my_float,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  12,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_12;
+            }
+
             break;
 
-        case 11:
+        case PBTOOLS_KEY(11, PBTOOLS_WIRE_TYPE_32_BIT):
             pbtools_repeated_info_decode_float(
                 &repeated_info_my_float,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_32_BIT);
+            break;
+
+        case PBTOOLS_KEY(12, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_12:
+            pbtools_repeated_info_decode_double(
+                &repeated_info_my_double,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  13,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_13;
+            }
+
             break;
 
-        case 12:
+        case PBTOOLS_KEY(12, PBTOOLS_WIRE_TYPE_64_BIT):
             pbtools_repeated_info_decode_double(
                 &repeated_info_my_double,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_64_BIT);
+            break;
+
+        case PBTOOLS_KEY(13, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_13:
+            pbtools_repeated_info_decode_bool(
+                &repeated_info_my_bool,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  14,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_14;
+            }
+
             break;
 
-        case 13:
+        case PBTOOLS_KEY(13, PBTOOLS_WIRE_TYPE_VARINT):
             pbtools_repeated_info_decode_bool(
                 &repeated_info_my_bool,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
             break;
 
-        case 14:
+        case PBTOOLS_KEY(14, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_14:
             pbtools_repeated_info_decode_string(
                 &repeated_info_my_string,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  14,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_14;
+            }
+
             break;
 
-        case 15:
+        case PBTOOLS_KEY(15, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_15:
             pbtools_repeated_info_decode_bytes(
                 &repeated_info_my_bytes,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  15,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_15;
+            }
+
             break;
 
-        case 16:
+        case PBTOOLS_KEY(16, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
             pbtools_repeated_info_decode_int32(
                 &repeated_info_my_enum,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  17,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_17;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(16, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_my_enum,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
             break;
 
-        case 17:
+        case PBTOOLS_KEY(17, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_17:
             pbtools_repeated_info_decode(&repeated_info_my_message,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  17,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_17;
+            }
+
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+            case 7:
+            case 8:
+            case 9:
+            case 10:
+            case 11:
+            case 12:
+            case 13:
+            case 14:
+            case 15:
+            case 16:
+            case 17:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -1026,12 +1677,14 @@ void field_names_repeated_message_camel_case_encode_repeated_inner(
     int field_number,
     struct field_names_repeated_message_camel_case_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct field_names_repeated_message_camel_case_t),
-        (pbtools_message_encode_inner_t)field_names_repeated_message_camel_case_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        field_names_repeated_message_camel_case_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void field_names_repeated_message_camel_case_decode_repeated_inner(
@@ -1039,13 +1692,30 @@ void field_names_repeated_message_camel_case_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct field_names_repeated_message_camel_case_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct field_names_repeated_message_camel_case_t),
-        (pbtools_message_init_t)field_names_repeated_message_camel_case_init,
-        (pbtools_message_decode_inner_t)field_names_repeated_message_camel_case_decode_inner);
+        sizeof(struct field_names_repeated_message_camel_case_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        field_names_repeated_message_camel_case_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        field_names_repeated_message_camel_case_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct field_names_repeated_message_camel_case_t *
@@ -1138,6 +1808,7 @@ void field_names_repeated_message_pascal_case_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct field_names_repeated_message_pascal_case_t *self_p)
 {
+    uint32_t key;
     int wire_type;
     struct pbtools_repeated_info_t repeated_info_my_int32;
     struct pbtools_repeated_info_t repeated_info_my_int64;
@@ -1176,128 +1847,390 @@ void field_names_repeated_message_pascal_case_decode_inner(
     pbtools_repeated_info_init(&repeated_info_my_message, 17);
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_my_int32,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_2;
+            }
+
+            break;
 
-        case 1:
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
             pbtools_repeated_info_decode_int32(
                 &repeated_info_my_int32,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_2:
+            pbtools_repeated_info_decode_int64(
+                &repeated_info_my_int64,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_3;
+            }
+
             break;
 
-        case 2:
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
             pbtools_repeated_info_decode_int64(
                 &repeated_info_my_int64,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_3:
+            pbtools_repeated_info_decode_sint32(
+                &repeated_info_my_sint32,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_4;
+            }
+
             break;
 
-        case 3:
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_VARINT):
             pbtools_repeated_info_decode_sint32(
                 &repeated_info_my_sint32,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
             break;
 
-        case 4:
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_4:
             pbtools_repeated_info_decode_sint64(
                 &repeated_info_my_sint64,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  5,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_5;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_sint64(
+                &repeated_info_my_sint64,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
             break;
 
-        case 5:
+        case PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_5:
             pbtools_repeated_info_decode_uint32(
                 &repeated_info_my_uint32,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  6,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_6;
+            }
+
             break;
 
-        case 6:
+        case PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_uint32(
+                &repeated_info_my_uint32,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_6:
             pbtools_repeated_info_decode_uint64(
                 &repeated_info_my_uint64,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  7,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_7;
+            }
+
             break;
 
-        case 7:
+        case PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_uint64(
+                &repeated_info_my_uint64,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(7, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_7:
             pbtools_repeated_info_decode_fixed32(
                 &repeated_info_my_fixed32,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  8,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_8;
+            }
+
             break;
 
-        case 8:
+        case PBTOOLS_KEY(7, PBTOOLS_WIRE_TYPE_32_BIT):
+            pbtools_repeated_info_decode_fixed32(
+                &repeated_info_my_fixed32,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_32_BIT);
+            break;
+
+        case PBTOOLS_KEY(8, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_8:
+            pbtools_repeated_info_decode_fixed64(
+                &repeated_info_my_fixed64,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  9,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_9;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(8, PBTOOLS_WIRE_TYPE_64_BIT):
             pbtools_repeated_info_decode_fixed64(
                 &repeated_info_my_fixed64,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_64_BIT);
             break;
 
-        case 9:
+        case PBTOOLS_KEY(9, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_9:
             pbtools_repeated_info_decode_sfixed32(
                 &repeated_info_my_sfixed32,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  10,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_10;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(9, PBTOOLS_WIRE_TYPE_32_BIT):
+            pbtools_repeated_info_decode_sfixed32(
+                &repeated_info_my_sfixed32,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_32_BIT);
             break;
 
-        case 10:
+        case PBTOOLS_KEY(10, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_10:
             pbtools_repeated_info_decode_sfixed64(
                 &repeated_info_my_sfixed64,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  11,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_11;
+            }
+
             break;
 
-        case 11:
+        case PBTOOLS_KEY(10, PBTOOLS_WIRE_TYPE_64_BIT):
+            pbtools_repeated_info_decode_sfixed64(
+                &repeated_info_my_sfixed64,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_64_BIT);
+            break;
+
+        case PBTOOLS_KEY(11, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_11:
+            pbtools_repeated_info_decode_float(
+                &repeated_info_my_float,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  12,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_12;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(11, PBTOOLS_WIRE_TYPE_32_BIT):
             pbtools_repeated_info_decode_float(
                 &repeated_info_my_float,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_32_BIT);
             break;
 
-        case 12:
+        case PBTOOLS_KEY(12, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_12:
             pbtools_repeated_info_decode_double(
                 &repeated_info_my_double,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  13,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_13;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(12, PBTOOLS_WIRE_TYPE_64_BIT):
+            pbtools_repeated_info_decode_double(
+                &repeated_info_my_double,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_64_BIT);
+            break;
+
+        case PBTOOLS_KEY(13, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_13:
+            pbtools_repeated_info_decode_bool(
+                &repeated_info_my_bool,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  14,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_14;
+            }
+
             break;
 
-        case 13:
+        case PBTOOLS_KEY(13, PBTOOLS_WIRE_TYPE_VARINT):
             pbtools_repeated_info_decode_bool(
                 &repeated_info_my_bool,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
             break;
 
-        case 14:
+        case PBTOOLS_KEY(14, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_14:
             pbtools_repeated_info_decode_string(
                 &repeated_info_my_string,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  14,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_14;
+            }
+
             break;
 
-        case 15:
+        case PBTOOLS_KEY(15, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_15:
             pbtools_repeated_info_decode_bytes(
                 &repeated_info_my_bytes,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  15,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_15;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(16, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_my_enum,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  17,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_17;
+            }
+
             break;
 
-        case 16:
+        case PBTOOLS_KEY(16, PBTOOLS_WIRE_TYPE_VARINT):
             pbtools_repeated_info_decode_int32(
                 &repeated_info_my_enum,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
             break;
 
-        case 17:
+        case PBTOOLS_KEY(17, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_17:
             pbtools_repeated_info_decode(&repeated_info_my_message,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  17,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_17;
+            }
+
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+            case 7:
+            case 8:
+            case 9:
+            case 10:
+            case 11:
+            case 12:
+            case 13:
+            case 14:
+            case 15:
+            case 16:
+            case 17:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -1549,12 +2482,14 @@ void field_names_repeated_message_pascal_case_encode_repeated_inner(
     int field_number,
     struct field_names_repeated_message_pascal_case_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct field_names_repeated_message_pascal_case_t),
-        (pbtools_message_encode_inner_t)field_names_repeated_message_pascal_case_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        field_names_repeated_message_pascal_case_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void field_names_repeated_message_pascal_case_decode_repeated_inner(
@@ -1562,13 +2497,30 @@ void field_names_repeated_message_pascal_case_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct field_names_repeated_message_pascal_case_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct field_names_repeated_message_pascal_case_t),
-        (pbtools_message_init_t)field_names_repeated_message_pascal_case_init,
-        (pbtools_message_decode_inner_t)field_names_repeated_message_pascal_case_decode_inner);
+        sizeof(struct field_names_repeated_message_pascal_case_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        field_names_repeated_message_pascal_case_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        field_names_repeated_message_pascal_case_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct field_names_repeated_message_pascal_case_t *
@@ -1678,13 +2630,11 @@ void field_names_message_one_of_my_bytes_init(
 
 static void field_names_message_one_of_camel_case_message_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct field_names_message_one_of_t *self_p)
 {
     self_p->one_of = field_names_message_one_of_one_of_camel_case_message_e;
-    pbtools_decoder_sub_message_decode(
+    pbtools_decoder_sub_message_decode_unchecked(
         decoder_p,
-        wire_type,
         (struct pbtools_message_base_t **)&self_p->camel_case_message_p,
         sizeof(struct field_names_message_camel_case_t),
         (pbtools_message_init_t)field_names_message_camel_case_init,
@@ -1693,13 +2643,11 @@ static void field_names_message_one_of_camel_case_message_decode(
 
 static void field_names_message_one_of_pascal_case_message_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct field_names_message_one_of_t *self_p)
 {
     self_p->one_of = field_names_message_one_of_one_of_pascal_case_message_e;
-    pbtools_decoder_sub_message_decode(
+    pbtools_decoder_sub_message_decode_unchecked(
         decoder_p,
-        wire_type,
         (struct pbtools_message_base_t **)&self_p->pascal_case_message_p,
         sizeof(struct field_names_message_pascal_case_t),
         (pbtools_message_init_t)field_names_message_pascal_case_init,
@@ -1708,13 +2656,11 @@ static void field_names_message_one_of_pascal_case_message_decode(
 
 static void field_names_message_one_of_camel_case_message_repeated_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct field_names_message_one_of_t *self_p)
 {
     self_p->one_of = field_names_message_one_of_one_of_camel_case_message_repeated_e;
-    pbtools_decoder_sub_message_decode(
+    pbtools_decoder_sub_message_decode_unchecked(
         decoder_p,
-        wire_type,
         (struct pbtools_message_base_t **)&self_p->camel_case_message_repeated_p,
         sizeof(struct field_names_repeated_message_camel_case_t),
         (pbtools_message_init_t)field_names_repeated_message_camel_case_init,
@@ -1723,13 +2669,11 @@ static void field_names_message_one_of_camel_case_message_repeated_decode(
 
 static void field_names_message_one_of_pascal_case_message_repeated_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct field_names_message_one_of_t *self_p)
 {
     self_p->one_of = field_names_message_one_of_one_of_pascal_case_message_repeated_e;
-    pbtools_decoder_sub_message_decode(
+    pbtools_decoder_sub_message_decode_unchecked(
         decoder_p,
-        wire_type,
         (struct pbtools_message_base_t **)&self_p->pascal_case_message_repeated_p,
         sizeof(struct field_names_repeated_message_pascal_case_t),
         (pbtools_message_init_t)field_names_repeated_message_pascal_case_init,
@@ -1738,35 +2682,28 @@ static void field_names_message_one_of_pascal_case_message_repeated_decode(
 
 static void field_names_message_one_of_my_int32_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct field_names_message_one_of_t *self_p)
 {
     field_names_message_one_of_my_int32_init(self_p);
-    self_p->my_int32 = pbtools_decoder_read_int32(
-        decoder_p,
-        wire_type);
+    self_p->my_int32 = pbtools_decoder_read_int32_unchecked(decoder_p);
 }
 
 static void field_names_message_one_of_my_string_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct field_names_message_one_of_t *self_p)
 {
     field_names_message_one_of_my_string_init(self_p);
-    pbtools_decoder_read_string(decoder_p,
-                                wire_type,
-                                &self_p->my_string_p);
+    pbtools_decoder_read_string_unchecked(decoder_p,
+                                          &self_p->my_string_p);
 }
 
 static void field_names_message_one_of_my_bytes_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct field_names_message_one_of_t *self_p)
 {
     field_names_message_one_of_my_bytes_init(self_p);
-    pbtools_decoder_read_bytes(decoder_p,
-                               wire_type,
-                               &self_p->my_bytes);
+    pbtools_decoder_read_bytes_unchecked(decoder_p,
+                                         &self_p->my_bytes);
 }
 
 void field_names_message_one_of_init(
@@ -1845,62 +2782,76 @@ void field_names_message_one_of_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct field_names_message_one_of_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
 
-        case 1:
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
             field_names_message_one_of_camel_case_message_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
-        case 2:
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
             field_names_message_one_of_pascal_case_message_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
-        case 3:
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
             field_names_message_one_of_camel_case_message_repeated_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
-        case 4:
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
             field_names_message_one_of_pascal_case_message_repeated_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
-        case 5:
+        case PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_VARINT):
             field_names_message_one_of_my_int32_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
-        case 6:
+        case PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
             field_names_message_one_of_my_string_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
-        case 7:
+        case PBTOOLS_KEY(7, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
             field_names_message_one_of_my_bytes_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+            case 7:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -1911,12 +2862,14 @@ void field_names_message_one_of_encode_repeated_inner(
     int field_number,
     struct field_names_message_one_of_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct field_names_message_one_of_t),
-        (pbtools_message_encode_inner_t)field_names_message_one_of_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        field_names_message_one_of_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void field_names_message_one_of_decode_repeated_inner(
@@ -1924,13 +2877,30 @@ void field_names_message_one_of_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct field_names_message_one_of_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct field_names_message_one_of_t),
-        (pbtools_message_init_t)field_names_message_one_of_init,
-        (pbtools_message_decode_inner_t)field_names_message_one_of_decode_inner);
+        sizeof(struct field_names_message_one_of_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        field_names_message_one_of_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        field_names_message_one_of_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct field_names_message_one_of_t *
@@ -70,24 +70,19 @@ void fuzzer_everything_oneof_bytes_init(
 
 static void fuzzer_everything_oneof_uint32_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct fuzzer_everything_t *self_p)
 {
     fuzzer_everything_oneof_uint32_init(self_p);
-    self_p->oneof_uint32 = pbtools_decoder_read_uint32(
-        decoder_p,
-        wire_type);
+    self_p->oneof_uint32 = pbtools_decoder_read_uint32_unchecked(decoder_p);
 }
 
 static void fuzzer_everything_oneof_nested_message_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct fuzzer_everything_t *self_p)
 {
     self_p->oneof_field = fuzzer_everything_oneof_field_oneof_nested_message_e;
-    pbtools_decoder_sub_message_decode(
+    pbtools_decoder_sub_message_decode_unchecked(
         decoder_p,
-        wire_type,
         (struct pbtools_message_base_t **)&self_p->oneof_nested_message_p,
         sizeof(struct fuzzer_everything_nested_message_t),
         (pbtools_message_init_t)fuzzer_everything_nested_message_init,
@@ -96,24 +91,20 @@ static void fuzzer_everything_oneof_nested_message_decode(
 
 static void fuzzer_everything_oneof_string_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct fuzzer_everything_t *self_p)
 {
     fuzzer_everything_oneof_string_init(self_p);
-    pbtools_decoder_read_string(decoder_p,
-                                wire_type,
-                                &self_p->oneof_string_p);
+    pbtools_decoder_read_string_unchecked(decoder_p,
+                                          &self_p->oneof_string_p);
 }
 
 static void fuzzer_everything_oneof_bytes_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct fuzzer_everything_t *self_p)
 {
     fuzzer_everything_oneof_bytes_init(self_p);
-    pbtools_decoder_read_bytes(decoder_p,
-                               wire_type,
-                               &self_p->oneof_bytes);
+    pbtools_decoder_read_bytes_unchecked(decoder_p,
+                                         &self_p->oneof_bytes);
 }
 
 void fuzzer_everything_nested_message_a_init(
@@ -139,35 +130,27 @@ void fuzzer_everything_nested_message_c_init(
 
 static void fuzzer_everything_nested_message_a_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct fuzzer_everything_nested_message_t *self_p)
 {
     fuzzer_everything_nested_message_a_init(self_p);
-    self_p->a = pbtools_decoder_read_int32(
-        decoder_p,
-        wire_type);
+    self_p->a = pbtools_decoder_read_int32_unchecked(decoder_p);
 }
 
 static void fuzzer_everything_nested_message_b_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct fuzzer_everything_nested_message_t *self_p)
 {
     fuzzer_everything_nested_message_b_init(self_p);
-    pbtools_decoder_read_string(decoder_p,
-                                wire_type,
-                                &self_p->b_p);
+    pbtools_decoder_read_string_unchecked(decoder_p,
+                                          &self_p->b_p);
 }
 
 static void fuzzer_everything_nested_message_c_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct fuzzer_everything_nested_message_t *self_p)
 {
     fuzzer_everything_nested_message_c_init(self_p);
-    self_p->c = pbtools_decoder_read_float(
-        decoder_p,
-        wire_type);
+    self_p->c = pbtools_decoder_read_float_unchecked(decoder_p);
 }
 
 void fuzzer_everything_nested_message_init(
@@ -214,34 +197,48 @@ void fuzzer_everything_nested_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct fuzzer_everything_nested_message_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 1:
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
             fuzzer_everything_nested_message_a_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
-        case 10000:
+        case PBTOOLS_KEY(10000, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
             fuzzer_everything_nested_message_b_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
-        case 10001:
+        case PBTOOLS_KEY(10001, PBTOOLS_WIRE_TYPE_32_BIT):
             fuzzer_everything_nested_message_c_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 10000:
+            case 10001:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -252,12 +249,14 @@ void fuzzer_everything_nested_message_encode_repeated_inner(
     int field_number,
     struct fuzzer_everything_nested_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct fuzzer_everything_nested_message_t),
-        (pbtools_message_encode_inner_t)fuzzer_everything_nested_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        fuzzer_everything_nested_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void fuzzer_everything_nested_message_decode_repeated_inner(
@@ -265,13 +264,30 @@ void fuzzer_everything_nested_message_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct fuzzer_everything_nested_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct fuzzer_everything_nested_message_t),
-        (pbtools_message_init_t)fuzzer_everything_nested_message_init,
-        (pbtools_message_decode_inner_t)fuzzer_everything_nested_message_decode_inner);
+        sizeof(struct fuzzer_everything_nested_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        fuzzer_everything_nested_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        fuzzer_everything_nested_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 void fuzzer_everything_init(
@@ -298,7 +314,7 @@ void fuzzer_everything_init(
     self_p->optional_nested_enum = 0;
     self_p->optional_string_piece_p = "";
     self_p->optional_cord_p = "";
-    self_p->optional_lazy_message_p = NULL;
+    pbtools_lazy_message_init(&self_p->optional_lazy_message);
     self_p->repeated_int32.length = 0;
     self_p->repeated_int64.length = 0;
     self_p->repeated_uint32.length = 0;
@@ -352,10 +368,10 @@ void fuzzer_everything_encode_inner(
     pbtools_encoder_write_repeated_uint32(encoder_p, 3300, &self_p->repeated_uint32);
     pbtools_encoder_write_repeated_int64(encoder_p, 3200, &self_p->repeated_int64);
     pbtools_encoder_write_repeated_int32(encoder_p, 3100, &self_p->repeated_int32);
-    pbtools_encoder_sub_message_encode(
+    pbtools_encoder_lazy_message_encode(
         encoder_p,
         27,
-        (struct pbtools_message_base_t *)self_p->optional_lazy_message_p,
+        &self_p->optional_lazy_message,
         (pbtools_message_encode_inner_t)fuzzer_everything_nested_message_encode_inner);
     pbtools_encoder_write_string(encoder_p, 25, self_p->optional_cord_p);
     pbtools_encoder_write_string(encoder_p, 24, self_p->optional_string_piece_p);
@@ -416,10 +432,87 @@ void fuzzer_everything_encode_inner(
     }
 }
 
+static const uint32_t fuzzer_everything_keys[64] = {
+    PBTOOLS_KEY(55, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(7, PBTOOLS_WIRE_TYPE_32_BIT),
+    PBTOOLS_KEY(3100, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(112, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(3800, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(25, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(3500, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(15, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(3400, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4000, PBTOOLS_WIRE_TYPE_64_BIT),
+    PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4100, PBTOOLS_WIRE_TYPE_32_BIT),
+    PBTOOLS_KEY(4200, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(3700, PBTOOLS_WIRE_TYPE_32_BIT),
+    PBTOOLS_KEY(57, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(9, PBTOOLS_WIRE_TYPE_32_BIT),
+    PBTOOLS_KEY(27, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(114, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(3400, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(111, PBTOOLS_WIRE_TYPE_VARINT),
+    0,
+    PBTOOLS_KEY(51, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(8, PBTOOLS_WIRE_TYPE_64_BIT),
+    0,
+    PBTOOLS_KEY(4500, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(3300, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(54, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4100, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(11, PBTOOLS_WIRE_TYPE_32_BIT),
+    PBTOOLS_KEY(24, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(3700, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3300, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(10, PBTOOLS_WIRE_TYPE_64_BIT),
+    PBTOOLS_KEY(3600, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(21, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(4200, PBTOOLS_WIRE_TYPE_64_BIT),
+    PBTOOLS_KEY(51, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(3200, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(14, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(113, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(3800, PBTOOLS_WIRE_TYPE_64_BIT),
+    PBTOOLS_KEY(3900, PBTOOLS_WIRE_TYPE_32_BIT),
+    PBTOOLS_KEY(4000, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(12, PBTOOLS_WIRE_TYPE_64_BIT),
+    PBTOOLS_KEY(4400, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(3200, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(4300, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(13, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3600, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(48, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    0,
+    0,
+    PBTOOLS_KEY(3100, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(18, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    0,
+    PBTOOLS_KEY(4300, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    0,
+    PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_VARINT),
+    PBTOOLS_KEY(3900, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(3500, PBTOOLS_WIRE_TYPE_VARINT)
+};
+
+static const uint8_t fuzzer_everything_displacements[32] = {
+    1, 1, 0, 1, 3, 2, 2, 0,
+    1, 6, 0, 2, 3, 0, 0, 0,
+    7, 1, 3, 10, 6, 9, 0, 1,
+    0, 5, 8, 4, 0, 0, 0, 0
+};
+
 void fuzzer_everything_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct fuzzer_everything_t *self_p)
 {
+    uint32_t key;
+    uint32_t hash;
+    uint32_t slot;
     int wire_type;
     struct pbtools_repeated_info_t repeated_info_repeated_int32;
     struct pbtools_repeated_info_t repeated_info_repeated_int64;
@@ -464,268 +557,612 @@ void fuzzer_everything_decode_inner(
     pbtools_repeated_info_init(&repeated_info_repeated_lazy_message, 57);
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+        hash = (key * 0x5498ee97u);
+        slot = (((hash >> 21) & 0x3f)
+                ^ fuzzer_everything_displacements[hash >> 27]);
+
+        if (fuzzer_everything_keys[slot] != key) {
+            slot = 64;
+        }
+
+        switch (slot) {
+
+        case 32:
+            self_p->optional_int32 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
 
-        case 1:
-            self_p->optional_int32 = pbtools_decoder_read_int32(decoder_p, wire_type);
             break;
 
-        case 2:
-            self_p->optional_int64 = pbtools_decoder_read_int64(decoder_p, wire_type);
+        case 10:
+        field_2:
+            self_p->optional_int64 = pbtools_decoder_read_int64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_3;
+            }
+
             break;
 
-        case 3:
-            self_p->optional_uint32 = pbtools_decoder_read_uint32(decoder_p, wire_type);
+        case 50:
+        field_3:
+            self_p->optional_uint32 = pbtools_decoder_read_uint32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_4;
+            }
+
             break;
 
-        case 4:
-            self_p->optional_uint64 = pbtools_decoder_read_uint64(decoder_p, wire_type);
+        case 27:
+        field_4:
+            self_p->optional_uint64 = pbtools_decoder_read_uint64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  5,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_5;
+            }
+
             break;
 
-        case 5:
-            self_p->optional_sint32 = pbtools_decoder_read_sint32(decoder_p, wire_type);
+        case 61:
+        field_5:
+            self_p->optional_sint32 = pbtools_decoder_read_sint32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  6,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_6;
+            }
+
             break;
 
-        case 6:
-            self_p->optional_sint64 = pbtools_decoder_read_sint64(decoder_p, wire_type);
+        case 33:
+        field_6:
+            self_p->optional_sint64 = pbtools_decoder_read_sint64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  7,
+                                                  PBTOOLS_WIRE_TYPE_32_BIT)) {
+                goto field_7;
+            }
+
             break;
 
-        case 7:
-            self_p->optional_fixed32 = pbtools_decoder_read_fixed32(decoder_p, wire_type);
+        case 1:
+        field_7:
+            self_p->optional_fixed32 = pbtools_decoder_read_fixed32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  8,
+                                                  PBTOOLS_WIRE_TYPE_64_BIT)) {
+                goto field_8;
+            }
+
             break;
 
-        case 8:
-            self_p->optional_fixed64 = pbtools_decoder_read_fixed64(decoder_p, wire_type);
+        case 22:
+        field_8:
+            self_p->optional_fixed64 = pbtools_decoder_read_fixed64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  9,
+                                                  PBTOOLS_WIRE_TYPE_32_BIT)) {
+                goto field_9;
+            }
+
             break;
 
-        case 9:
-            self_p->optional_sfixed32 = pbtools_decoder_read_sfixed32(decoder_p, wire_type);
+        case 15:
+        field_9:
+            self_p->optional_sfixed32 = pbtools_decoder_read_sfixed32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  10,
+                                                  PBTOOLS_WIRE_TYPE_64_BIT)) {
+                goto field_10;
+            }
+
             break;
 
-        case 10:
-            self_p->optional_sfixed64 = pbtools_decoder_read_sfixed64(decoder_p, wire_type);
+        case 35:
+        field_10:
+            self_p->optional_sfixed64 = pbtools_decoder_read_sfixed64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  11,
+                                                  PBTOOLS_WIRE_TYPE_32_BIT)) {
+                goto field_11;
+            }
+
             break;
 
-        case 11:
-            self_p->optional_float = pbtools_decoder_read_float(decoder_p, wire_type);
+        case 29:
+        field_11:
+            self_p->optional_float = pbtools_decoder_read_float_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  12,
+                                                  PBTOOLS_WIRE_TYPE_64_BIT)) {
+                goto field_12;
+            }
+
             break;
 
-        case 12:
-            self_p->optional_double = pbtools_decoder_read_double(decoder_p, wire_type);
+        case 46:
+        field_12:
+            self_p->optional_double = pbtools_decoder_read_double_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  13,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_13;
+            }
+
             break;
 
-        case 13:
-            self_p->optional_bool = pbtools_decoder_read_bool(decoder_p, wire_type);
+        case 51:
+        field_13:
+            self_p->optional_bool = pbtools_decoder_read_bool_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  14,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_14;
+            }
+
             break;
 
-        case 14:
-            pbtools_decoder_read_string(decoder_p, wire_type, &self_p->optional_string_p);
+        case 41:
+        field_14:
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->optional_string_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  15,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_15;
+            }
+
             break;
 
-        case 15:
-            pbtools_decoder_read_bytes(decoder_p, wire_type, &self_p->optional_bytes);
+        case 7:
+        field_15:
+            pbtools_decoder_read_bytes_unchecked(decoder_p, &self_p->optional_bytes);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  18,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_18;
+            }
+
             break;
 
-        case 18:
-            pbtools_decoder_sub_message_decode(
+        case 57:
+        field_18:
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->optional_nested_message_p,
                 sizeof(struct fuzzer_everything_nested_message_t),
                 (pbtools_message_init_t)fuzzer_everything_nested_message_init,
                 (pbtools_message_decode_inner_t)fuzzer_everything_nested_message_decode_inner);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  21,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_21;
+            }
+
             break;
 
-        case 21:
-            self_p->optional_nested_enum = pbtools_decoder_read_enum(decoder_p, wire_type);
+        case 37:
+        field_21:
+            self_p->optional_nested_enum = pbtools_decoder_read_enum_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  24,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_24;
+            }
+
             break;
 
-        case 24:
-            pbtools_decoder_read_string(decoder_p, wire_type, &self_p->optional_string_piece_p);
+        case 30:
+        field_24:
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->optional_string_piece_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  25,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_25;
+            }
+
             break;
 
-        case 25:
-            pbtools_decoder_read_string(decoder_p, wire_type, &self_p->optional_cord_p);
+        case 5:
+        field_25:
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->optional_cord_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  27,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_27;
+            }
+
             break;
 
-        case 27:
-            pbtools_decoder_sub_message_decode(
+        case 16:
+        field_27:
+            pbtools_decoder_read_lazy_message_unchecked(
                 decoder_p,
-                wire_type,
-                (struct pbtools_message_base_t **)&self_p->optional_lazy_message_p,
-                sizeof(struct fuzzer_everything_nested_message_t),
-                (pbtools_message_init_t)fuzzer_everything_nested_message_init,
-                (pbtools_message_decode_inner_t)fuzzer_everything_nested_message_decode_inner);
+                &self_p->optional_lazy_message);
+            break;
+
+        case 2:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_repeated_int32,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
             break;
 
-        case 3100:
+        case 56:
             pbtools_repeated_info_decode_int32(
                 &repeated_info_repeated_int32,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case 48:
+            pbtools_repeated_info_decode_int64(
+                &repeated_info_repeated_int64,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
             break;
 
-        case 3200:
+        case 40:
             pbtools_repeated_info_decode_int64(
                 &repeated_info_repeated_int64,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
             break;
 
-        case 3300:
+        case 34:
             pbtools_repeated_info_decode_uint32(
                 &repeated_info_repeated_uint32,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
             break;
 
-        case 3400:
+        case 25:
+            pbtools_repeated_info_decode_uint32(
+                &repeated_info_repeated_uint32,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case 18:
             pbtools_repeated_info_decode_uint64(
                 &repeated_info_repeated_uint64,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
             break;
 
-        case 3500:
+        case 8:
+            pbtools_repeated_info_decode_uint64(
+                &repeated_info_repeated_uint64,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case 6:
             pbtools_repeated_info_decode_sint32(
                 &repeated_info_repeated_sint32,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
             break;
 
-        case 3600:
+        case 63:
+            pbtools_repeated_info_decode_sint32(
+                &repeated_info_repeated_sint32,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case 52:
             pbtools_repeated_info_decode_sint64(
                 &repeated_info_repeated_sint64,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+            break;
+
+        case 36:
+            pbtools_repeated_info_decode_sint64(
+                &repeated_info_repeated_sint64,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case 31:
+            pbtools_repeated_info_decode_fixed32(
+                &repeated_info_repeated_fixed32,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
             break;
 
-        case 3700:
+        case 13:
             pbtools_repeated_info_decode_fixed32(
                 &repeated_info_repeated_fixed32,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_32_BIT);
             break;
 
-        case 3800:
+        case 4:
             pbtools_repeated_info_decode_fixed64(
                 &repeated_info_repeated_fixed64,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
             break;
 
-        case 3900:
+        case 43:
+            pbtools_repeated_info_decode_fixed64(
+                &repeated_info_repeated_fixed64,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_64_BIT);
+            break;
+
+        case 62:
+            pbtools_repeated_info_decode_sfixed32(
+                &repeated_info_repeated_sfixed32,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+            break;
+
+        case 44:
             pbtools_repeated_info_decode_sfixed32(
                 &repeated_info_repeated_sfixed32,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_32_BIT);
+            break;
+
+        case 45:
+            pbtools_repeated_info_decode_sfixed64(
+                &repeated_info_repeated_sfixed64,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
             break;
 
-        case 4000:
+        case 9:
             pbtools_repeated_info_decode_sfixed64(
                 &repeated_info_repeated_sfixed64,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_64_BIT);
             break;
 
-        case 4100:
+        case 28:
+            pbtools_repeated_info_decode_float(
+                &repeated_info_repeated_float,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+            break;
+
+        case 11:
             pbtools_repeated_info_decode_float(
                 &repeated_info_repeated_float,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_32_BIT);
             break;
 
-        case 4200:
+        case 12:
             pbtools_repeated_info_decode_double(
                 &repeated_info_repeated_double,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
             break;
 
-        case 4300:
+        case 38:
+            pbtools_repeated_info_decode_double(
+                &repeated_info_repeated_double,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_64_BIT);
+            break;
+
+        case 59:
             pbtools_repeated_info_decode_bool(
                 &repeated_info_repeated_bool,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
             break;
 
-        case 4400:
+        case 49:
+            pbtools_repeated_info_decode_bool(
+                &repeated_info_repeated_bool,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case 47:
             pbtools_repeated_info_decode_string(
                 &repeated_info_repeated_string,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
             break;
 
-        case 4500:
+        case 24:
             pbtools_repeated_info_decode_bytes(
                 &repeated_info_repeated_bytes,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
             break;
 
-        case 48:
+        case 53:
+        field_48:
             pbtools_repeated_info_decode(&repeated_info_repeated_nested_message,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  48,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_48;
+            }
+
             break;
 
-        case 51:
+        case 39:
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_repeated_nested_enum,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  54,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_54;
+            }
+
+            break;
+
+        case 21:
             pbtools_repeated_info_decode_int32(
                 &repeated_info_repeated_nested_enum,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
             break;
 
-        case 54:
+        case 26:
+        field_54:
             pbtools_repeated_info_decode_string(
                 &repeated_info_repeated_string_piece,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  54,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_54;
+            }
+
             break;
 
-        case 55:
+        case 0:
+        field_55:
             pbtools_repeated_info_decode_string(
                 &repeated_info_repeated_cord,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  55,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_55;
+            }
+
             break;
 
-        case 57:
+        case 14:
+        field_57:
             pbtools_repeated_info_decode(&repeated_info_repeated_lazy_message,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  57,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_57;
+            }
+
             break;
 
-        case 111:
+        case 19:
             fuzzer_everything_oneof_uint32_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
-        case 112:
+        case 3:
             fuzzer_everything_oneof_nested_message_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
-        case 113:
+        case 42:
             fuzzer_everything_oneof_string_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
-        case 114:
+        case 17:
             fuzzer_everything_oneof_bytes_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+            case 7:
+            case 8:
+            case 9:
+            case 10:
+            case 11:
+            case 12:
+            case 13:
+            case 14:
+            case 15:
+            case 18:
+            case 21:
+            case 24:
+            case 25:
+            case 27:
+            case 48:
+            case 51:
+            case 54:
+            case 55:
+            case 57:
+            case 111:
+            case 112:
+            case 113:
+            case 114:
+            case 3100:
+            case 3200:
+            case 3300:
+            case 3400:
+            case 3500:
+            case 3600:
+            case 3700:
+            case 3800:
+            case 3900:
+            case 4000:
+            case 4100:
+            case 4200:
+            case 4300:
+            case 4400:
+            case 4500:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -825,13 +1262,25 @@ int fuzzer_everything_optional_nested_message_alloc(
 int fuzzer_everything_optional_lazy_message_alloc(
     struct fuzzer_everything_t *self_p)
 {
-    return (pbtools_sub_message_alloc(
-                (struct pbtools_message_base_t **)&self_p->optional_lazy_message_p,
+    return (pbtools_lazy_message_alloc(
+                &self_p->optional_lazy_message,
                 self_p->base.heap_p,
                 sizeof(struct fuzzer_everything_nested_message_t),
                 (pbtools_message_init_t)fuzzer_everything_nested_message_init));
 }
 
+struct fuzzer_everything_nested_message_t *
+fuzzer_everything_optional_lazy_message_get(
+    struct fuzzer_everything_t *self_p)
+{
+    return (pbtools_lazy_message_get(
+                &self_p->optional_lazy_message,
+                self_p->base.heap_p,
+                sizeof(struct fuzzer_everything_nested_message_t),
+                (pbtools_message_init_t)fuzzer_everything_nested_message_init,
+                (pbtools_message_decode_inner_t)fuzzer_everything_nested_message_decode_inner));
+}
+
 int fuzzer_everything_repeated_int32_alloc(
     struct fuzzer_everything_t *self_p,
     int length)
@@ -1041,12 +1490,14 @@ void fuzzer_everything_encode_repeated_inner(
     int field_number,
     struct fuzzer_everything_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct fuzzer_everything_t),
-        (pbtools_message_encode_inner_t)fuzzer_everything_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        fuzzer_everything_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void fuzzer_everything_decode_repeated_inner(
@@ -1054,13 +1505,30 @@ void fuzzer_everything_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct fuzzer_everything_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct fuzzer_everything_t),
-        (pbtools_message_init_t)fuzzer_everything_init,
-        (pbtools_message_decode_inner_t)fuzzer_everything_decode_inner);
+        sizeof(struct fuzzer_everything_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        fuzzer_everything_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        fuzzer_everything_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct fuzzer_everything_t *
@@ -1098,3 +1566,15 @@ int fuzzer_everything_decode(
                 size,
                 (pbtools_message_decode_inner_t)fuzzer_everything_decode_inner));
 }
+
+int fuzzer_everything_decode_padded(
+    struct fuzzer_everything_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode_padded(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)fuzzer_everything_decode_inner));
+}
@@ -41,11 +41,11 @@ extern "C" {
  * Enum fuzzer.Everything.NestedEnum.
  */
 enum fuzzer_everything_nested_enum_e {
-    fuzzer_everything_nested_enum_zero_e = 0,
-    fuzzer_everything_nested_enum_foo_e = 1,
-    fuzzer_everything_nested_enum_bar_e = 2,
-    fuzzer_everything_nested_enum_baz_e = 3,
-    fuzzer_everything_nested_enum_neg_e = -1
+    fuzzer_everything_zero_e = 0,
+    fuzzer_everything_foo_e = 1,
+    fuzzer_everything_bar_e = 2,
+    fuzzer_everything_baz_e = 3,
+    fuzzer_everything_neg_e = -1
 };
 
 /**
@@ -116,7 +116,7 @@ struct fuzzer_everything_t {
     enum fuzzer_everything_nested_enum_e optional_nested_enum;
     char *optional_string_piece_p;
     char *optional_cord_p;
-    struct fuzzer_everything_nested_message_t *optional_lazy_message_p;
+    struct pbtools_lazy_message_t optional_lazy_message;
     struct pbtools_repeated_int32_t repeated_int32;
     struct pbtools_repeated_int64_t repeated_int64;
     struct pbtools_repeated_uint32_t repeated_uint32;
@@ -152,6 +152,10 @@ int fuzzer_everything_optional_nested_message_alloc(
 int fuzzer_everything_optional_lazy_message_alloc(
     struct fuzzer_everything_t *self_p);
 
+struct fuzzer_everything_nested_message_t *
+fuzzer_everything_optional_lazy_message_get(
+    struct fuzzer_everything_t *self_p);
+
 int fuzzer_everything_repeated_int32_alloc(
     struct fuzzer_everything_t *self_p,
     int length);
@@ -271,6 +275,11 @@ int fuzzer_everything_decode(
     const uint8_t *encoded_p,
     size_t size);
 
+int fuzzer_everything_decode_padded(
+    struct fuzzer_everything_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
 /* Internal functions. Do not use! */
 
 void fuzzer_everything_init(
@@ -60,19 +60,29 @@ void imported_imported_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct imported_imported_message_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->v1 = pbtools_decoder_read_bool_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_2;
+            }
 
-        case 1:
-            self_p->v1 = pbtools_decoder_read_bool(decoder_p, wire_type);
             break;
 
-        case 2:
-            pbtools_decoder_sub_message_decode(
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_2:
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->v2_p,
                 sizeof(struct imported_imported_duplicated_package_message_t),
                 (pbtools_message_init_t)imported_imported_duplicated_package_message_init,
@@ -80,7 +90,20 @@ void imported_imported_message_decode_inner(
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -101,12 +124,14 @@ void imported_imported_message_encode_repeated_inner(
     int field_number,
     struct imported_imported_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct imported_imported_message_t),
-        (pbtools_message_encode_inner_t)imported_imported_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        imported_imported_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void imported_imported_message_decode_repeated_inner(
@@ -114,13 +139,30 @@ void imported_imported_message_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct imported_imported_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct imported_imported_message_t),
-        (pbtools_message_init_t)imported_imported_message_init,
-        (pbtools_message_decode_inner_t)imported_imported_message_decode_inner);
+        sizeof(struct imported_imported_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        imported_imported_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        imported_imported_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct imported_imported_message_t *
@@ -54,17 +54,32 @@ void foo_bar_imported2_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct foo_bar_imported2_message_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 10:
-            self_p->v1 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        switch (key) {
+
+        case PBTOOLS_KEY(10, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->v1 = pbtools_decoder_read_int32_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 10:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -75,12 +90,14 @@ void foo_bar_imported2_message_encode_repeated_inner(
     int field_number,
     struct foo_bar_imported2_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct foo_bar_imported2_message_t),
-        (pbtools_message_encode_inner_t)foo_bar_imported2_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        foo_bar_imported2_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void foo_bar_imported2_message_decode_repeated_inner(
@@ -88,13 +105,30 @@ void foo_bar_imported2_message_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct foo_bar_imported2_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct foo_bar_imported2_message_t),
-        (pbtools_message_init_t)foo_bar_imported2_message_init,
-        (pbtools_message_decode_inner_t)foo_bar_imported2_message_decode_inner);
+        sizeof(struct foo_bar_imported2_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        foo_bar_imported2_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        foo_bar_imported2_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct foo_bar_imported2_message_t *
@@ -152,17 +186,32 @@ void foo_bar_imported3_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct foo_bar_imported3_message_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 20:
-            self_p->v1 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        switch (key) {
+
+        case PBTOOLS_KEY(20, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->v1 = pbtools_decoder_read_int32_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 20:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -173,12 +222,14 @@ void foo_bar_imported3_message_encode_repeated_inner(
     int field_number,
     struct foo_bar_imported3_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct foo_bar_imported3_message_t),
-        (pbtools_message_encode_inner_t)foo_bar_imported3_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        foo_bar_imported3_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void foo_bar_imported3_message_decode_repeated_inner(
@@ -186,13 +237,30 @@ void foo_bar_imported3_message_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct foo_bar_imported3_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct foo_bar_imported3_message_t),
-        (pbtools_message_init_t)foo_bar_imported3_message_init,
-        (pbtools_message_decode_inner_t)foo_bar_imported3_message_decode_inner);
+        sizeof(struct foo_bar_imported3_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        foo_bar_imported3_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        foo_bar_imported3_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct foo_bar_imported3_message_t *
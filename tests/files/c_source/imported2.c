@@ -58,15 +58,17 @@ void imported2_foo_bar_imported2_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct imported2_foo_bar_imported2_message_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 15:
-            pbtools_decoder_sub_message_decode(
+        switch (key) {
+
+        case PBTOOLS_KEY(15, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->v1_p,
                 sizeof(struct imported_imported_duplicated_package_message_t),
                 (pbtools_message_init_t)imported_imported_duplicated_package_message_init,
@@ -74,7 +76,19 @@ void imported2_foo_bar_imported2_message_decode_inner(
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 15:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -95,12 +109,14 @@ void imported2_foo_bar_imported2_message_encode_repeated_inner(
     int field_number,
     struct imported2_foo_bar_imported2_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct imported2_foo_bar_imported2_message_t),
-        (pbtools_message_encode_inner_t)imported2_foo_bar_imported2_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        imported2_foo_bar_imported2_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void imported2_foo_bar_imported2_message_decode_repeated_inner(
@@ -108,13 +124,30 @@ void imported2_foo_bar_imported2_message_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct imported2_foo_bar_imported2_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct imported2_foo_bar_imported2_message_t),
-        (pbtools_message_init_t)imported2_foo_bar_imported2_message_init,
-        (pbtools_message_decode_inner_t)imported2_foo_bar_imported2_message_decode_inner);
+        sizeof(struct imported2_foo_bar_imported2_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        imported2_foo_bar_imported2_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        imported2_foo_bar_imported2_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct imported2_foo_bar_imported2_message_t *
@@ -176,15 +209,17 @@ void imported2_foo_bar_imported3_message_imported2_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct imported2_foo_bar_imported3_message_imported2_message_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
 
-        case 16:
-            pbtools_decoder_sub_message_decode(
+        case PBTOOLS_KEY(16, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->v1_p,
                 sizeof(struct imported_imported_duplicated_package_message_t),
                 (pbtools_message_init_t)imported_imported_duplicated_package_message_init,
@@ -192,7 +227,19 @@ void imported2_foo_bar_imported3_message_imported2_message_decode_inner(
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 16:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -213,12 +260,14 @@ void imported2_foo_bar_imported3_message_imported2_message_encode_repeated_inner
     int field_number,
     struct imported2_foo_bar_imported3_message_imported2_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct imported2_foo_bar_imported3_message_imported2_message_t),
-        (pbtools_message_encode_inner_t)imported2_foo_bar_imported3_message_imported2_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        imported2_foo_bar_imported3_message_imported2_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void imported2_foo_bar_imported3_message_imported2_message_decode_repeated_inner(
@@ -226,13 +275,30 @@ void imported2_foo_bar_imported3_message_imported2_message_decode_repeated_inner
     struct pbtools_repeated_info_t *repeated_info_p,
     struct imported2_foo_bar_imported3_message_imported2_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct imported2_foo_bar_imported3_message_imported2_message_t),
-        (pbtools_message_init_t)imported2_foo_bar_imported3_message_imported2_message_init,
-        (pbtools_message_decode_inner_t)imported2_foo_bar_imported3_message_imported2_message_decode_inner);
+        sizeof(struct imported2_foo_bar_imported3_message_imported2_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        imported2_foo_bar_imported3_message_imported2_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        imported2_foo_bar_imported3_message_imported2_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 void imported2_foo_bar_imported3_message_init(
@@ -304,10 +370,36 @@ void imported2_foo_bar_imported3_message_encode_inner(
         (pbtools_message_encode_inner_t)imported_imported_duplicated_package_message_encode_inner);
 }
 
+static const uint32_t imported2_foo_bar_imported3_message_keys[16] = {
+    0,
+    PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    0,
+    PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(17, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(8, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(10, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    0,
+    PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    0,
+    PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    0,
+    PBTOOLS_KEY(7, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    0,
+    PBTOOLS_KEY(9, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)
+};
+
+static const uint8_t imported2_foo_bar_imported3_message_displacements[8] = {
+    0, 0, 0, 0, 0, 0, 0, 0
+};
+
 void imported2_foo_bar_imported3_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct imported2_foo_bar_imported3_message_t *self_p)
 {
+    uint32_t key;
+    uint32_t hash;
+    uint32_t slot;
     int wire_type;
     struct pbtools_repeated_info_t repeated_info_v7;
     struct pbtools_repeated_info_t repeated_info_v9;
@@ -320,94 +412,197 @@ void imported2_foo_bar_imported3_message_decode_inner(
     pbtools_repeated_info_init(&repeated_info_v10, 10);
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+        hash = (key * 0x9e3779b1u);
+        slot = (((hash >> 25) & 0xf)
+                ^ imported2_foo_bar_imported3_message_displacements[hash >> 29]);
+
+        if (imported2_foo_bar_imported3_message_keys[slot] != key) {
+            slot = 16;
+        }
+
+        switch (slot) {
 
-        case 17:
-            pbtools_decoder_sub_message_decode(
+        case 4:
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->v1_p,
                 sizeof(struct imported_imported_duplicated_package_message_t),
                 (pbtools_message_init_t)imported_imported_duplicated_package_message_init,
                 (pbtools_message_decode_inner_t)imported_imported_duplicated_package_message_decode_inner);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_2;
+            }
+
             break;
 
-        case 2:
-            pbtools_decoder_sub_message_decode(
+        case 15:
+        field_2:
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->v2_p,
                 sizeof(struct imported2_foo_bar_imported3_message_imported2_message_t),
                 (pbtools_message_init_t)imported2_foo_bar_imported3_message_imported2_message_init,
                 (pbtools_message_decode_inner_t)imported2_foo_bar_imported3_message_imported2_message_decode_inner);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_3;
+            }
+
             break;
 
-        case 3:
-            pbtools_decoder_sub_message_decode(
+        case 8:
+        field_3:
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->v3_p,
                 sizeof(struct bar_imported2_message_t),
                 (pbtools_message_init_t)bar_imported2_message_init,
                 (pbtools_message_decode_inner_t)bar_imported2_message_decode_inner);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_4;
+            }
+
             break;
 
-        case 4:
-            pbtools_decoder_sub_message_decode(
+        case 1:
+        field_4:
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->v4_p,
                 sizeof(struct foo_bar_imported2_message_t),
                 (pbtools_message_init_t)foo_bar_imported2_message_init,
                 (pbtools_message_decode_inner_t)foo_bar_imported2_message_decode_inner);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  5,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_5;
+            }
+
             break;
 
-        case 5:
-            pbtools_decoder_sub_message_decode(
+        case 10:
+        field_5:
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->v5_p,
                 sizeof(struct imported2_foo_bar_imported2_message_t),
                 (pbtools_message_init_t)imported2_foo_bar_imported2_message_init,
                 (pbtools_message_decode_inner_t)imported2_foo_bar_imported2_message_decode_inner);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  6,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_6;
+            }
+
             break;
 
-        case 6:
-            pbtools_decoder_sub_message_decode(
+        case 3:
+        field_6:
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->v6_p,
                 sizeof(struct imported_imported2_message_t),
                 (pbtools_message_init_t)imported_imported2_message_init,
                 (pbtools_message_decode_inner_t)imported_imported2_message_decode_inner);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  7,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_7;
+            }
+
             break;
 
-        case 7:
+        case 12:
+        field_7:
             pbtools_repeated_info_decode(&repeated_info_v7,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  7,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_7;
+            }
+
             break;
 
-        case 9:
+        case 14:
+        field_9:
             pbtools_repeated_info_decode(&repeated_info_v9,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  9,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_9;
+            }
+
             break;
 
-        case 8:
+        case 5:
+        field_8:
             pbtools_repeated_info_decode(&repeated_info_v8,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  8,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_8;
+            }
+
             break;
 
-        case 10:
+        case 6:
+        field_10:
             pbtools_repeated_info_decode(&repeated_info_v10,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  10,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_10;
+            }
+
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+            case 7:
+            case 8:
+            case 9:
+            case 10:
+            case 17:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -543,12 +738,14 @@ void imported2_foo_bar_imported3_message_encode_repeated_inner(
     int field_number,
     struct imported2_foo_bar_imported3_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct imported2_foo_bar_imported3_message_t),
-        (pbtools_message_encode_inner_t)imported2_foo_bar_imported3_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        imported2_foo_bar_imported3_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void imported2_foo_bar_imported3_message_decode_repeated_inner(
@@ -556,13 +753,30 @@ void imported2_foo_bar_imported3_message_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct imported2_foo_bar_imported3_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct imported2_foo_bar_imported3_message_t),
-        (pbtools_message_init_t)imported2_foo_bar_imported3_message_init,
-        (pbtools_message_decode_inner_t)imported2_foo_bar_imported3_message_decode_inner);
+        sizeof(struct imported2_foo_bar_imported3_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        imported2_foo_bar_imported3_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        imported2_foo_bar_imported3_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct imported2_foo_bar_imported3_message_t *
@@ -54,17 +54,32 @@ void bar_imported2_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct bar_imported2_message_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 2:
-            self_p->v1 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        switch (key) {
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->v1 = pbtools_decoder_read_int32_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 2:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -75,12 +90,14 @@ void bar_imported2_message_encode_repeated_inner(
     int field_number,
     struct bar_imported2_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct bar_imported2_message_t),
-        (pbtools_message_encode_inner_t)bar_imported2_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        bar_imported2_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void bar_imported2_message_decode_repeated_inner(
@@ -88,13 +105,30 @@ void bar_imported2_message_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct bar_imported2_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct bar_imported2_message_t),
-        (pbtools_message_init_t)bar_imported2_message_init,
-        (pbtools_message_decode_inner_t)bar_imported2_message_decode_inner);
+        sizeof(struct bar_imported2_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        bar_imported2_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        bar_imported2_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct bar_imported2_message_t *
@@ -152,17 +186,32 @@ void bar_imported3_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct bar_imported3_message_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
 
-        case 35:
-            self_p->v1 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case PBTOOLS_KEY(35, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->v1 = pbtools_decoder_read_int32_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 35:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -173,12 +222,14 @@ void bar_imported3_message_encode_repeated_inner(
     int field_number,
     struct bar_imported3_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct bar_imported3_message_t),
-        (pbtools_message_encode_inner_t)bar_imported3_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        bar_imported3_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void bar_imported3_message_decode_repeated_inner(
@@ -186,13 +237,30 @@ void bar_imported3_message_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct bar_imported3_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct bar_imported3_message_t),
-        (pbtools_message_init_t)bar_imported3_message_init,
-        (pbtools_message_decode_inner_t)bar_imported3_message_decode_inner);
+        sizeof(struct bar_imported3_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        bar_imported3_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        bar_imported3_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct bar_imported3_message_t *
@@ -260,25 +328,34 @@ void bar_imported4_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct bar_imported4_message_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 100:
-            pbtools_decoder_sub_message_decode(
+        switch (key) {
+
+        case PBTOOLS_KEY(100, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->v1_p,
                 sizeof(struct bar_imported3_message_t),
                 (pbtools_message_init_t)bar_imported3_message_init,
                 (pbtools_message_decode_inner_t)bar_imported3_message_decode_inner);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  200,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_200;
+            }
+
             break;
 
-        case 200:
-            pbtools_decoder_sub_message_decode(
+        case PBTOOLS_KEY(200, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_200:
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->v2_p,
                 sizeof(struct foo_bar_imported3_message_t),
                 (pbtools_message_init_t)foo_bar_imported3_message_init,
@@ -286,7 +363,20 @@ void bar_imported4_message_decode_inner(
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 100:
+            case 200:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -317,12 +407,14 @@ void bar_imported4_message_encode_repeated_inner(
     int field_number,
     struct bar_imported4_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct bar_imported4_message_t),
-        (pbtools_message_encode_inner_t)bar_imported4_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        bar_imported4_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void bar_imported4_message_decode_repeated_inner(
@@ -330,13 +422,30 @@ void bar_imported4_message_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct bar_imported4_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct bar_imported4_message_t),
-        (pbtools_message_init_t)bar_imported4_message_init,
-        (pbtools_message_decode_inner_t)bar_imported4_message_decode_inner);
+        sizeof(struct bar_imported4_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        bar_imported4_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        bar_imported4_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct bar_imported4_message_t *
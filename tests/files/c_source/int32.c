@@ -54,17 +54,32 @@ void int32_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct int32_message_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 1:
-            self_p->value = pbtools_decoder_read_int32(decoder_p, wire_type);
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->value = pbtools_decoder_read_int32_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -75,12 +90,14 @@ void int32_message_encode_repeated_inner(
     int field_number,
     struct int32_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct int32_message_t),
-        (pbtools_message_encode_inner_t)int32_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        int32_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void int32_message_decode_repeated_inner(
@@ -88,13 +105,30 @@ void int32_message_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct int32_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct int32_message_t),
-        (pbtools_message_init_t)int32_message_init,
-        (pbtools_message_decode_inner_t)int32_message_decode_inner);
+        sizeof(struct int32_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        int32_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        int32_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct int32_message_t *
@@ -133,6 +167,18 @@ int int32_message_decode(
                 (pbtools_message_decode_inner_t)int32_message_decode_inner));
 }
 
+int int32_message_decode_padded(
+    struct int32_message_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode_padded(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)int32_message_decode_inner));
+}
+
 void int32_message2_init(
     struct int32_message2_t *self_p,
     struct pbtools_heap_t *heap_p)
@@ -152,17 +198,32 @@ void int32_message2_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct int32_message2_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 16:
-            self_p->value = pbtools_decoder_read_int32(decoder_p, wire_type);
+        switch (key) {
+
+        case PBTOOLS_KEY(16, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->value = pbtools_decoder_read_int32_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 16:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -173,12 +234,14 @@ void int32_message2_encode_repeated_inner(
     int field_number,
     struct int32_message2_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct int32_message2_t),
-        (pbtools_message_encode_inner_t)int32_message2_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        int32_message2_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void int32_message2_decode_repeated_inner(
@@ -186,13 +249,30 @@ void int32_message2_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct int32_message2_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct int32_message2_t),
-        (pbtools_message_init_t)int32_message2_init,
-        (pbtools_message_decode_inner_t)int32_message2_decode_inner);
+        sizeof(struct int32_message2_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        int32_message2_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        int32_message2_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct int32_message2_t *
@@ -230,3 +310,15 @@ int int32_message2_decode(
                 size,
                 (pbtools_message_decode_inner_t)int32_message2_decode_inner));
 }
+
+int int32_message2_decode_padded(
+    struct int32_message2_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode_padded(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)int32_message2_decode_inner));
+}
@@ -81,6 +81,11 @@ int int32_message_decode(
     const uint8_t *encoded_p,
     size_t size);
 
+int int32_message_decode_padded(
+    struct int32_message_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
 /**
  * Encoding and decoding of int32.Message2.
  */
@@ -99,6 +104,11 @@ int int32_message2_decode(
     const uint8_t *encoded_p,
     size_t size);
 
+int int32_message2_decode_padded(
+    struct int32_message2_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
 /* Internal functions. Do not use! */
 
 void int32_message_init(
@@ -68,6 +68,11 @@ int int64_message_decode(
     const uint8_t *encoded_p,
     size_t size);
 
+int int64_message_decode_padded(
+    struct int64_message_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
 /* Internal functions. Do not use! */
 
 void int64_message_init(
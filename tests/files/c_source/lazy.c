@@ -0,0 +1,392 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by pbtools.
+ */
+
+#include <limits.h>
+#include "lazy.h"
+
+#if CHAR_BIT != 8
+#    error "Number of bits in a char must be 8."
+#endif
+
+void lazy_bar_init(
+    struct lazy_bar_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->v1 = 0;
+    self_p->v2_p = "";
+}
+
+void lazy_bar_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct lazy_bar_t *self_p)
+{
+    pbtools_encoder_write_string(encoder_p, 2, self_p->v2_p);
+    pbtools_encoder_write_int32(encoder_p, 1, self_p->v1);
+}
+
+void lazy_bar_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct lazy_bar_t *self_p)
+{
+    uint32_t key;
+    int wire_type;
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->v1 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_2;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_2:
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->v2_p);
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+}
+
+void lazy_bar_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct lazy_bar_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        lazy_bar_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void lazy_bar_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct lazy_bar_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct lazy_bar_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        lazy_bar_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        lazy_bar_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+struct lazy_bar_t *
+lazy_bar_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct lazy_bar_t),
+                (pbtools_message_init_t)lazy_bar_init));
+}
+
+int lazy_bar_encode(
+    struct lazy_bar_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)lazy_bar_encode_inner));
+}
+
+int lazy_bar_decode(
+    struct lazy_bar_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)lazy_bar_decode_inner));
+}
+
+void lazy_foo_init(
+    struct lazy_foo_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    pbtools_lazy_message_init(&self_p->v1);
+    self_p->v2_p = NULL;
+    self_p->v3 = 0;
+}
+
+void lazy_foo_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct lazy_foo_t *self_p)
+{
+    pbtools_encoder_write_int32(encoder_p, 3, self_p->v3);
+    pbtools_encoder_sub_message_encode(
+        encoder_p,
+        2,
+        (struct pbtools_message_base_t *)self_p->v2_p,
+        (pbtools_message_encode_inner_t)lazy_bar_encode_inner);
+    pbtools_encoder_lazy_message_encode(
+        encoder_p,
+        1,
+        &self_p->v1,
+        (pbtools_message_encode_inner_t)lazy_bar_encode_inner);
+}
+
+void lazy_foo_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct lazy_foo_t *self_p)
+{
+    uint32_t key;
+    int wire_type;
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_decoder_read_lazy_message_unchecked(
+                decoder_p,
+                &self_p->v1);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_2;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_2:
+            pbtools_decoder_sub_message_decode_unchecked(
+                decoder_p,
+                (struct pbtools_message_base_t **)&self_p->v2_p,
+                sizeof(struct lazy_bar_t),
+                (pbtools_message_init_t)lazy_bar_init,
+                (pbtools_message_decode_inner_t)lazy_bar_decode_inner);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_3;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_VARINT):
+        field_3:
+            self_p->v3 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+}
+
+int lazy_foo_v1_alloc(
+    struct lazy_foo_t *self_p)
+{
+    return (pbtools_lazy_message_alloc(
+                &self_p->v1,
+                self_p->base.heap_p,
+                sizeof(struct lazy_bar_t),
+                (pbtools_message_init_t)lazy_bar_init));
+}
+
+struct lazy_bar_t *
+lazy_foo_v1_get(
+    struct lazy_foo_t *self_p)
+{
+    return (pbtools_lazy_message_get(
+                &self_p->v1,
+                self_p->base.heap_p,
+                sizeof(struct lazy_bar_t),
+                (pbtools_message_init_t)lazy_bar_init,
+                (pbtools_message_decode_inner_t)lazy_bar_decode_inner));
+}
+
+int lazy_foo_v2_alloc(
+    struct lazy_foo_t *self_p)
+{
+    return (pbtools_sub_message_alloc(
+                (struct pbtools_message_base_t **)&self_p->v2_p,
+                self_p->base.heap_p,
+                sizeof(struct lazy_bar_t),
+                (pbtools_message_init_t)lazy_bar_init));
+}
+
+void lazy_foo_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct lazy_foo_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        lazy_foo_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void lazy_foo_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct lazy_foo_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct lazy_foo_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        lazy_foo_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        lazy_foo_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+struct lazy_foo_t *
+lazy_foo_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct lazy_foo_t),
+                (pbtools_message_init_t)lazy_foo_init));
+}
+
+int lazy_foo_encode(
+    struct lazy_foo_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)lazy_foo_encode_inner));
+}
+
+int lazy_foo_decode(
+    struct lazy_foo_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)lazy_foo_decode_inner));
+}
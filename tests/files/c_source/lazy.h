@@ -0,0 +1,165 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by pbtools.
+ */
+
+#ifndef LAZY_H
+#define LAZY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "pbtools.h"
+
+/**
+ * Message lazy.Bar.
+ */
+struct lazy_bar_repeated_t {
+    int length;
+    struct lazy_bar_t *items_p;
+};
+
+struct lazy_bar_t {
+    struct pbtools_message_base_t base;
+    int32_t v1;
+    char *v2_p;
+};
+
+/**
+ * Message lazy.Foo.
+ */
+struct lazy_foo_repeated_t {
+    int length;
+    struct lazy_foo_t *items_p;
+};
+
+struct lazy_foo_t {
+    struct pbtools_message_base_t base;
+    struct pbtools_lazy_message_t v1;
+    struct lazy_bar_t *v2_p;
+    int32_t v3;
+};
+
+/**
+ * Encoding and decoding of lazy.Bar.
+ */
+struct lazy_bar_t *
+lazy_bar_new(
+    void *workspace_p,
+    size_t size);
+
+int lazy_bar_encode(
+    struct lazy_bar_t *self_p,
+    uint8_t *encoded_p,
+    size_t size);
+
+int lazy_bar_decode(
+    struct lazy_bar_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int lazy_foo_v1_alloc(
+    struct lazy_foo_t *self_p);
+
+struct lazy_bar_t *
+lazy_foo_v1_get(
+    struct lazy_foo_t *self_p);
+
+int lazy_foo_v2_alloc(
+    struct lazy_foo_t *self_p);
+
+/**
+ * Encoding and decoding of lazy.Foo.
+ */
+struct lazy_foo_t *
+lazy_foo_new(
+    void *workspace_p,
+    size_t size);
+
+int lazy_foo_encode(
+    struct lazy_foo_t *self_p,
+    uint8_t *encoded_p,
+    size_t size);
+
+int lazy_foo_decode(
+    struct lazy_foo_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+/* Internal functions. Do not use! */
+
+void lazy_bar_init(
+    struct lazy_bar_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void lazy_bar_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct lazy_bar_t *self_p);
+
+void lazy_bar_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct lazy_bar_t *self_p);
+
+void lazy_bar_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct lazy_bar_repeated_t *repeated_p);
+
+void lazy_bar_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct lazy_bar_repeated_t *repeated_p);
+
+void lazy_foo_init(
+    struct lazy_foo_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void lazy_foo_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct lazy_foo_t *self_p);
+
+void lazy_foo_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct lazy_foo_t *self_p);
+
+void lazy_foo_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct lazy_foo_repeated_t *repeated_p);
+
+void lazy_foo_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct lazy_foo_repeated_t *repeated_p);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
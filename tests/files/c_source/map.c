@@ -54,17 +54,32 @@ void map_value_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct map_value_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 1:
-            self_p->v1 = pbtools_decoder_read_bool(decoder_p, wire_type);
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->v1 = pbtools_decoder_read_bool_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -75,12 +90,14 @@ void map_value_encode_repeated_inner(
     int field_number,
     struct map_value_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct map_value_t),
-        (pbtools_message_encode_inner_t)map_value_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        map_value_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void map_value_decode_repeated_inner(
@@ -88,13 +105,30 @@ void map_value_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct map_value_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct map_value_t),
-        (pbtools_message_init_t)map_value_init,
-        (pbtools_message_decode_inner_t)map_value_decode_inner);
+        sizeof(struct map_value_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        map_value_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        map_value_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct map_value_t *
@@ -154,21 +188,45 @@ void map_message_pbtools_map_map1_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct map_message_pbtools_map_map1_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->key_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
 
-        case 1:
-            pbtools_decoder_read_string(decoder_p, wire_type, &self_p->key_p);
             break;
 
-        case 2:
-            self_p->value = pbtools_decoder_read_bool(decoder_p, wire_type);
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
+        field_2:
+            self_p->value = pbtools_decoder_read_bool_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -179,12 +237,14 @@ void map_message_pbtools_map_map1_encode_repeated_inner(
     int field_number,
     struct map_message_pbtools_map_map1_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct map_message_pbtools_map_map1_t),
-        (pbtools_message_encode_inner_t)map_message_pbtools_map_map1_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        map_message_pbtools_map_map1_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void map_message_pbtools_map_map1_decode_repeated_inner(
@@ -192,13 +252,30 @@ void map_message_pbtools_map_map1_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct map_message_pbtools_map_map1_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct map_message_pbtools_map_map1_t),
-        (pbtools_message_init_t)map_message_pbtools_map_map1_init,
-        (pbtools_message_decode_inner_t)map_message_pbtools_map_map1_decode_inner);
+        sizeof(struct map_message_pbtools_map_map1_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        map_message_pbtools_map_map1_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        map_message_pbtools_map_map1_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 void map_message_pbtools_map_map2_init(
@@ -226,19 +303,29 @@ void map_message_pbtools_map_map2_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct map_message_pbtools_map_map2_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->key = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_2;
+            }
 
-        case 1:
-            self_p->key = pbtools_decoder_read_int32(decoder_p, wire_type);
             break;
 
-        case 2:
-            pbtools_decoder_sub_message_decode(
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_2:
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->value_p,
                 sizeof(struct map_value_t),
                 (pbtools_message_init_t)map_value_init,
@@ -246,7 +333,20 @@ void map_message_pbtools_map_map2_decode_inner(
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -267,12 +367,14 @@ void map_message_pbtools_map_map2_encode_repeated_inner(
     int field_number,
     struct map_message_pbtools_map_map2_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct map_message_pbtools_map_map2_t),
-        (pbtools_message_encode_inner_t)map_message_pbtools_map_map2_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        map_message_pbtools_map_map2_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void map_message_pbtools_map_map2_decode_repeated_inner(
@@ -280,13 +382,30 @@ void map_message_pbtools_map_map2_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct map_message_pbtools_map_map2_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct map_message_pbtools_map_map2_t),
-        (pbtools_message_init_t)map_message_pbtools_map_map2_init,
-        (pbtools_message_decode_inner_t)map_message_pbtools_map_map2_decode_inner);
+        sizeof(struct map_message_pbtools_map_map2_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        map_message_pbtools_map_map2_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        map_message_pbtools_map_map2_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 void map_message_pbtools_map_map3_init(
@@ -314,19 +433,29 @@ void map_message_pbtools_map_map3_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct map_message_pbtools_map_map3_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->key = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_2;
+            }
 
-        case 1:
-            self_p->key = pbtools_decoder_read_int32(decoder_p, wire_type);
             break;
 
-        case 2:
-            pbtools_decoder_sub_message_decode(
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_2:
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->value_p,
                 sizeof(struct map_value_t),
                 (pbtools_message_init_t)map_value_init,
@@ -334,7 +463,20 @@ void map_message_pbtools_map_map3_decode_inner(
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -355,12 +497,14 @@ void map_message_pbtools_map_map3_encode_repeated_inner(
     int field_number,
     struct map_message_pbtools_map_map3_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct map_message_pbtools_map_map3_t),
-        (pbtools_message_encode_inner_t)map_message_pbtools_map_map3_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        map_message_pbtools_map_map3_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void map_message_pbtools_map_map3_decode_repeated_inner(
@@ -368,13 +512,30 @@ void map_message_pbtools_map_map3_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct map_message_pbtools_map_map3_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct map_message_pbtools_map_map3_t),
-        (pbtools_message_init_t)map_message_pbtools_map_map3_init,
-        (pbtools_message_decode_inner_t)map_message_pbtools_map_map3_decode_inner);
+        sizeof(struct map_message_pbtools_map_map3_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        map_message_pbtools_map_map3_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        map_message_pbtools_map_map3_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 void map_message_init(
@@ -409,6 +570,7 @@ void map_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct map_message_t *self_p)
 {
+    uint32_t key;
     int wire_type;
     struct pbtools_repeated_info_t repeated_info_map1;
     struct pbtools_repeated_info_t repeated_info_map2;
@@ -419,28 +581,68 @@ void map_message_decode_inner(
     pbtools_repeated_info_init(&repeated_info_map3, 3);
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
 
-        case 1:
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_1:
             pbtools_repeated_info_decode(&repeated_info_map1,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_1;
+            }
+
             break;
 
-        case 2:
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_2:
             pbtools_repeated_info_decode(&repeated_info_map2,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_2;
+            }
+
             break;
 
-        case 3:
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_3:
             pbtools_repeated_info_decode(&repeated_info_map3,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_3;
+            }
+
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -500,12 +702,14 @@ void map_message_encode_repeated_inner(
     int field_number,
     struct map_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct map_message_t),
-        (pbtools_message_encode_inner_t)map_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        map_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void map_message_decode_repeated_inner(
@@ -513,13 +717,30 @@ void map_message_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct map_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct map_message_t),
-        (pbtools_message_init_t)map_message_init,
-        (pbtools_message_decode_inner_t)map_message_decode_inner);
+        sizeof(struct map_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        map_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        map_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct map_message_t *
@@ -579,21 +800,45 @@ void map_message2_map1_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct map_message2_map1_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->key_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
 
-        case 1:
-            pbtools_decoder_read_string(decoder_p, wire_type, &self_p->key_p);
             break;
 
-        case 2:
-            self_p->value = pbtools_decoder_read_bool(decoder_p, wire_type);
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
+        field_2:
+            self_p->value = pbtools_decoder_read_bool_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -604,12 +849,14 @@ void map_message2_map1_encode_repeated_inner(
     int field_number,
     struct map_message2_map1_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct map_message2_map1_t),
-        (pbtools_message_encode_inner_t)map_message2_map1_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        map_message2_map1_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void map_message2_map1_decode_repeated_inner(
@@ -617,13 +864,30 @@ void map_message2_map1_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct map_message2_map1_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct map_message2_map1_t),
-        (pbtools_message_init_t)map_message2_map1_init,
-        (pbtools_message_decode_inner_t)map_message2_map1_decode_inner);
+        sizeof(struct map_message2_map1_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        map_message2_map1_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        map_message2_map1_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 void map_message2_map2_init(
@@ -651,19 +915,29 @@ void map_message2_map2_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct map_message2_map2_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->key = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_2;
+            }
 
-        case 1:
-            self_p->key = pbtools_decoder_read_int32(decoder_p, wire_type);
             break;
 
-        case 2:
-            pbtools_decoder_sub_message_decode(
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_2:
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->value_p,
                 sizeof(struct map_value_t),
                 (pbtools_message_init_t)map_value_init,
@@ -671,7 +945,20 @@ void map_message2_map2_decode_inner(
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -692,12 +979,14 @@ void map_message2_map2_encode_repeated_inner(
     int field_number,
     struct map_message2_map2_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct map_message2_map2_t),
-        (pbtools_message_encode_inner_t)map_message2_map2_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        map_message2_map2_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void map_message2_map2_decode_repeated_inner(
@@ -705,13 +994,30 @@ void map_message2_map2_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct map_message2_map2_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct map_message2_map2_t),
-        (pbtools_message_init_t)map_message2_map2_init,
-        (pbtools_message_decode_inner_t)map_message2_map2_decode_inner);
+        sizeof(struct map_message2_map2_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        map_message2_map2_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        map_message2_map2_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 void map_message2_map3_init(
@@ -739,19 +1045,29 @@ void map_message2_map3_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct map_message2_map3_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->key = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_2;
+            }
 
-        case 1:
-            self_p->key = pbtools_decoder_read_int32(decoder_p, wire_type);
             break;
 
-        case 2:
-            pbtools_decoder_sub_message_decode(
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_2:
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->value_p,
                 sizeof(struct map_value_t),
                 (pbtools_message_init_t)map_value_init,
@@ -759,7 +1075,20 @@ void map_message2_map3_decode_inner(
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -780,12 +1109,14 @@ void map_message2_map3_encode_repeated_inner(
     int field_number,
     struct map_message2_map3_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct map_message2_map3_t),
-        (pbtools_message_encode_inner_t)map_message2_map3_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        map_message2_map3_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void map_message2_map3_decode_repeated_inner(
@@ -793,13 +1124,30 @@ void map_message2_map3_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct map_message2_map3_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct map_message2_map3_t),
-        (pbtools_message_init_t)map_message2_map3_init,
-        (pbtools_message_decode_inner_t)map_message2_map3_decode_inner);
+        sizeof(struct map_message2_map3_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        map_message2_map3_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        map_message2_map3_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 void map_message2_init(
@@ -834,6 +1182,7 @@ void map_message2_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct map_message2_t *self_p)
 {
+    uint32_t key;
     int wire_type;
     struct pbtools_repeated_info_t repeated_info_map1;
     struct pbtools_repeated_info_t repeated_info_map2;
@@ -844,28 +1193,68 @@ void map_message2_decode_inner(
     pbtools_repeated_info_init(&repeated_info_map3, 3);
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
 
-        case 1:
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_1:
             pbtools_repeated_info_decode(&repeated_info_map1,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_1;
+            }
+
             break;
 
-        case 2:
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_2:
             pbtools_repeated_info_decode(&repeated_info_map2,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_2;
+            }
+
             break;
 
-        case 3:
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_3:
             pbtools_repeated_info_decode(&repeated_info_map3,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_3;
+            }
+
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -925,12 +1314,14 @@ void map_message2_encode_repeated_inner(
     int field_number,
     struct map_message2_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct map_message2_t),
-        (pbtools_message_encode_inner_t)map_message2_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        map_message2_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void map_message2_decode_repeated_inner(
@@ -938,13 +1329,30 @@ void map_message2_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct map_message2_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct map_message2_t),
-        (pbtools_message_init_t)map_message2_init,
-        (pbtools_message_decode_inner_t)map_message2_decode_inner);
+        sizeof(struct map_message2_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        map_message2_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        map_message2_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct map_message2_t *
@@ -57,13 +57,17 @@ void message_foo_decode_inner(
 {
     (void)self_p;
 
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
 
 
         default:
+            wire_type = (int)(key & 0x7);
             pbtools_decoder_skip_field(decoder_p, wire_type);
             break;
         }
@@ -75,12 +79,14 @@ void message_foo_encode_repeated_inner(
     int field_number,
     struct message_foo_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct message_foo_t),
-        (pbtools_message_encode_inner_t)message_foo_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        message_foo_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void message_foo_decode_repeated_inner(
@@ -88,13 +94,30 @@ void message_foo_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct message_foo_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct message_foo_t),
-        (pbtools_message_init_t)message_foo_init,
-        (pbtools_message_decode_inner_t)message_foo_decode_inner);
+        sizeof(struct message_foo_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        message_foo_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        message_foo_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct message_foo_t *
@@ -152,17 +175,32 @@ void message_bar_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct message_bar_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 333:
-            self_p->fie = pbtools_decoder_read_int32(decoder_p, wire_type);
+        switch (key) {
+
+        case PBTOOLS_KEY(333, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->fie = pbtools_decoder_read_int32_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 333:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -173,12 +211,14 @@ void message_bar_encode_repeated_inner(
     int field_number,
     struct message_bar_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct message_bar_t),
-        (pbtools_message_encode_inner_t)message_bar_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        message_bar_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void message_bar_decode_repeated_inner(
@@ -186,13 +226,30 @@ void message_bar_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct message_bar_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct message_bar_t),
-        (pbtools_message_init_t)message_bar_init,
-        (pbtools_message_decode_inner_t)message_bar_decode_inner);
+        sizeof(struct message_bar_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        message_bar_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        message_bar_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct message_bar_t *
@@ -256,19 +313,29 @@ void message_message_fie_foo_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct message_message_fie_foo_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->value = pbtools_decoder_read_bool_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_1;
+            }
 
-        case 5:
-            self_p->value = pbtools_decoder_read_bool(decoder_p, wire_type);
             break;
 
-        case 1:
-            pbtools_decoder_sub_message_decode(
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_1:
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->bar_p,
                 sizeof(struct message_bar_t),
                 (pbtools_message_init_t)message_bar_init,
@@ -276,7 +343,20 @@ void message_message_fie_foo_decode_inner(
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 5:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -297,12 +377,14 @@ void message_message_fie_foo_encode_repeated_inner(
     int field_number,
     struct message_message_fie_foo_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct message_message_fie_foo_t),
-        (pbtools_message_encode_inner_t)message_message_fie_foo_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        message_message_fie_foo_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void message_message_fie_foo_decode_repeated_inner(
@@ -310,13 +392,30 @@ void message_message_fie_foo_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct message_message_fie_foo_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct message_message_fie_foo_t),
-        (pbtools_message_init_t)message_message_fie_foo_init,
-        (pbtools_message_decode_inner_t)message_message_fie_foo_decode_inner);
+        sizeof(struct message_message_fie_foo_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        message_message_fie_foo_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        message_message_fie_foo_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 void message_message_fie_init(
@@ -342,15 +441,17 @@ void message_message_fie_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct message_message_fie_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
 
-        case 1:
-            pbtools_decoder_sub_message_decode(
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->foo_p,
                 sizeof(struct message_message_fie_foo_t),
                 (pbtools_message_init_t)message_message_fie_foo_init,
@@ -358,7 +459,19 @@ void message_message_fie_decode_inner(
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -379,12 +492,14 @@ void message_message_fie_encode_repeated_inner(
     int field_number,
     struct message_message_fie_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct message_message_fie_t),
-        (pbtools_message_encode_inner_t)message_message_fie_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        message_message_fie_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void message_message_fie_decode_repeated_inner(
@@ -392,13 +507,30 @@ void message_message_fie_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct message_message_fie_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct message_message_fie_t),
-        (pbtools_message_init_t)message_message_fie_init,
-        (pbtools_message_decode_inner_t)message_message_fie_decode_inner);
+        sizeof(struct message_message_fie_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        message_message_fie_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        message_message_fie_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 void message_message_init(
@@ -432,29 +564,46 @@ void message_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct message_message_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->foo = pbtools_decoder_read_enum_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  832,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_832;
+            }
 
-        case 1:
-            self_p->foo = pbtools_decoder_read_enum(decoder_p, wire_type);
             break;
 
-        case 832:
-            pbtools_decoder_sub_message_decode(
+        case PBTOOLS_KEY(832, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_832:
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->bar_p,
                 sizeof(struct message_bar_t),
                 (pbtools_message_init_t)message_bar_init,
                 (pbtools_message_decode_inner_t)message_bar_decode_inner);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_4;
+            }
+
             break;
 
-        case 4:
-            pbtools_decoder_sub_message_decode(
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_4:
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->fie_p,
                 sizeof(struct message_message_fie_t),
                 (pbtools_message_init_t)message_message_fie_init,
@@ -462,7 +611,21 @@ void message_message_decode_inner(
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 4:
+            case 832:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -493,12 +656,14 @@ void message_message_encode_repeated_inner(
     int field_number,
     struct message_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct message_message_t),
-        (pbtools_message_encode_inner_t)message_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        message_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void message_message_decode_repeated_inner(
@@ -506,13 +671,30 @@ void message_message_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct message_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct message_message_t),
-        (pbtools_message_init_t)message_message_init,
-        (pbtools_message_decode_inner_t)message_message_decode_inner);
+        sizeof(struct message_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        message_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        message_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct message_message_t *
@@ -570,17 +752,32 @@ void message_unused_inner_types_unused_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct message_unused_inner_types_unused_message_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
 
-        case 1:
-            self_p->v1 = pbtools_decoder_read_bool(decoder_p, wire_type);
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->v1 = pbtools_decoder_read_bool_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -591,12 +788,14 @@ void message_unused_inner_types_unused_message_encode_repeated_inner(
     int field_number,
     struct message_unused_inner_types_unused_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct message_unused_inner_types_unused_message_t),
-        (pbtools_message_encode_inner_t)message_unused_inner_types_unused_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        message_unused_inner_types_unused_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void message_unused_inner_types_unused_message_decode_repeated_inner(
@@ -604,13 +803,30 @@ void message_unused_inner_types_unused_message_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct message_unused_inner_types_unused_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct message_unused_inner_types_unused_message_t),
-        (pbtools_message_init_t)message_unused_inner_types_unused_message_init,
-        (pbtools_message_decode_inner_t)message_unused_inner_types_unused_message_decode_inner);
+        sizeof(struct message_unused_inner_types_unused_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        message_unused_inner_types_unused_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        message_unused_inner_types_unused_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 void message_unused_inner_types_init(
@@ -632,17 +848,32 @@ void message_unused_inner_types_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct message_unused_inner_types_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
 
-        case 1:
-            self_p->v2 = pbtools_decoder_read_bool(decoder_p, wire_type);
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->v2 = pbtools_decoder_read_bool_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -653,12 +884,14 @@ void message_unused_inner_types_encode_repeated_inner(
     int field_number,
     struct message_unused_inner_types_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct message_unused_inner_types_t),
-        (pbtools_message_encode_inner_t)message_unused_inner_types_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        message_unused_inner_types_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void message_unused_inner_types_decode_repeated_inner(
@@ -666,13 +899,30 @@ void message_unused_inner_types_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct message_unused_inner_types_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct message_unused_inner_types_t),
-        (pbtools_message_init_t)message_unused_inner_types_init,
-        (pbtools_message_decode_inner_t)message_unused_inner_types_decode_inner);
+        sizeof(struct message_unused_inner_types_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        message_unused_inner_types_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        message_unused_inner_types_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct message_unused_inner_types_t *
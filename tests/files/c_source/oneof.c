@@ -51,24 +51,19 @@ void oneof_message_v2_init(
 
 static void oneof_message_v1_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct oneof_message_t *self_p)
 {
     oneof_message_v1_init(self_p);
-    self_p->v1 = pbtools_decoder_read_int32(
-        decoder_p,
-        wire_type);
+    self_p->v1 = pbtools_decoder_read_int32_unchecked(decoder_p);
 }
 
 static void oneof_message_v2_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct oneof_message_t *self_p)
 {
     oneof_message_v2_init(self_p);
-    pbtools_decoder_read_string(decoder_p,
-                                wire_type,
-                                &self_p->v2_p);
+    pbtools_decoder_read_string_unchecked(decoder_p,
+                                          &self_p->v2_p);
 }
 
 void oneof_message_init(
@@ -108,27 +103,41 @@ void oneof_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct oneof_message_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
 
-        case 1:
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
             oneof_message_v1_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
-        case 2:
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
             oneof_message_v2_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -139,12 +148,14 @@ void oneof_message_encode_repeated_inner(
     int field_number,
     struct oneof_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct oneof_message_t),
-        (pbtools_message_encode_inner_t)oneof_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        oneof_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void oneof_message_decode_repeated_inner(
@@ -152,13 +163,91 @@ void oneof_message_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct oneof_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct oneof_message_t),
-        (pbtools_message_init_t)oneof_message_init,
-        (pbtools_message_decode_inner_t)oneof_message_decode_inner);
+        sizeof(struct oneof_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        oneof_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        oneof_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t oneof_message_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false }
+};
+
+void oneof_message_view_init(
+    struct oneof_message_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &oneof_message_view_fields[0],
+                      2,
+                      &self_p->offsets[0]);
+}
+
+int oneof_message_view_error(
+    struct oneof_message_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+enum oneof_message_value_e oneof_message_view_get_value(
+    struct oneof_message_view_t *self_p)
+{
+    return ((enum oneof_message_value_e)(
+                pbtools_view_last_field(&self_p->base,
+                                        0,
+                                        2) + 1));
+}
+
+int32_t oneof_message_view_get_v1(
+    struct oneof_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 0, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+struct pbtools_bytes_t oneof_message_view_get_v2(
+    struct oneof_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+
+    value.buf_p = NULL;
+    value.size = 0;
+
+    if (pbtools_view_seek(&self_p->base, 1, &decoder)) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    return (value);
 }
 
 struct oneof_message_t *
@@ -225,13 +314,11 @@ void oneof_message2_v6_init(
 
 static void oneof_message2_v4_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct oneof_message2_t *self_p)
 {
     self_p->oneof1 = oneof_message2_oneof1_v4_e;
-    pbtools_decoder_sub_message_decode(
+    pbtools_decoder_sub_message_decode_unchecked(
         decoder_p,
-        wire_type,
         (struct pbtools_message_base_t **)&self_p->v4_p,
         sizeof(struct oneof_message2_foo_t),
         (pbtools_message_init_t)oneof_message2_foo_init,
@@ -240,24 +327,19 @@ static void oneof_message2_v4_decode(
 
 static void oneof_message2_v5_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct oneof_message2_t *self_p)
 {
     oneof_message2_v5_init(self_p);
-    pbtools_decoder_read_bytes(decoder_p,
-                               wire_type,
-                               &self_p->v5);
+    pbtools_decoder_read_bytes_unchecked(decoder_p,
+                                         &self_p->v5);
 }
 
 static void oneof_message2_v6_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct oneof_message2_t *self_p)
 {
     oneof_message2_v6_init(self_p);
-    self_p->v6 = pbtools_decoder_read_enum(
-        decoder_p,
-        wire_type);
+    self_p->v6 = pbtools_decoder_read_enum_unchecked(decoder_p);
 }
 
 void oneof_message2_v1_init(
@@ -293,24 +375,19 @@ int oneof_message2_v3_alloc(
 
 static void oneof_message2_v1_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct oneof_message2_t *self_p)
 {
     oneof_message2_v1_init(self_p);
-    self_p->v1 = pbtools_decoder_read_bool(
-        decoder_p,
-        wire_type);
+    self_p->v1 = pbtools_decoder_read_bool_unchecked(decoder_p);
 }
 
 static void oneof_message2_v2_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct oneof_message2_t *self_p)
 {
     self_p->oneof2 = oneof_message2_oneof2_v2_e;
-    pbtools_decoder_sub_message_decode(
+    pbtools_decoder_sub_message_decode_unchecked(
         decoder_p,
-        wire_type,
         (struct pbtools_message_base_t **)&self_p->v2_p,
         sizeof(struct oneof_message2_foo_t),
         (pbtools_message_init_t)oneof_message2_foo_init,
@@ -319,13 +396,11 @@ static void oneof_message2_v2_decode(
 
 static void oneof_message2_v3_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct oneof_message2_t *self_p)
 {
     self_p->oneof2 = oneof_message2_oneof2_v3_e;
-    pbtools_decoder_sub_message_decode(
+    pbtools_decoder_sub_message_decode_unchecked(
         decoder_p,
-        wire_type,
         (struct pbtools_message_base_t **)&self_p->v3_p,
         sizeof(struct oneof_message_t),
         (pbtools_message_init_t)oneof_message_init,
@@ -351,17 +426,32 @@ void oneof_message2_foo_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct oneof_message2_foo_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 55:
-            self_p->bar = pbtools_decoder_read_int32(decoder_p, wire_type);
+        switch (key) {
+
+        case PBTOOLS_KEY(55, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->bar = pbtools_decoder_read_int32_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 55:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -372,12 +462,14 @@ void oneof_message2_foo_encode_repeated_inner(
     int field_number,
     struct oneof_message2_foo_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct oneof_message2_foo_t),
-        (pbtools_message_encode_inner_t)oneof_message2_foo_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        oneof_message2_foo_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void oneof_message2_foo_decode_repeated_inner(
@@ -385,13 +477,65 @@ void oneof_message2_foo_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct oneof_message2_foo_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct oneof_message2_foo_t),
-        (pbtools_message_init_t)oneof_message2_foo_init,
-        (pbtools_message_decode_inner_t)oneof_message2_foo_decode_inner);
+        sizeof(struct oneof_message2_foo_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        oneof_message2_foo_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        oneof_message2_foo_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t oneof_message2_foo_view_fields[] = {
+    { 55, PBTOOLS_WIRE_TYPE_VARINT, false }
+};
+
+void oneof_message2_foo_view_init(
+    struct oneof_message2_foo_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &oneof_message2_foo_view_fields[0],
+                      1,
+                      &self_p->offsets[0]);
+}
+
+int oneof_message2_foo_view_error(
+    struct oneof_message2_foo_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+int32_t oneof_message2_foo_view_get_bar(
+    struct oneof_message2_foo_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 0, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
 }
 
 void oneof_message2_init(
@@ -468,55 +612,69 @@ void oneof_message2_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct oneof_message2_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 4:
+        switch (key) {
+
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
             oneof_message2_v4_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
-        case 5:
+        case PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
             oneof_message2_v5_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
-        case 6:
+        case PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_VARINT):
             oneof_message2_v6_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
-        case 1:
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
             oneof_message2_v1_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
-        case 2:
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
             oneof_message2_v2_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
-        case 3:
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
             oneof_message2_v3_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -527,12 +685,14 @@ void oneof_message2_encode_repeated_inner(
     int field_number,
     struct oneof_message2_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct oneof_message2_t),
-        (pbtools_message_encode_inner_t)oneof_message2_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        oneof_message2_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void oneof_message2_decode_repeated_inner(
@@ -540,13 +700,179 @@ void oneof_message2_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct oneof_message2_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct oneof_message2_t),
-        (pbtools_message_init_t)oneof_message2_init,
-        (pbtools_message_decode_inner_t)oneof_message2_decode_inner);
+        sizeof(struct oneof_message2_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        oneof_message2_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        oneof_message2_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t oneof_message2_view_fields[] = {
+    { 4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 5, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 6, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 1, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 3, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false }
+};
+
+void oneof_message2_view_init(
+    struct oneof_message2_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &oneof_message2_view_fields[0],
+                      6,
+                      &self_p->offsets[0]);
+}
+
+int oneof_message2_view_error(
+    struct oneof_message2_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+enum oneof_message2_oneof1_e oneof_message2_view_get_oneof1(
+    struct oneof_message2_view_t *self_p)
+{
+    return ((enum oneof_message2_oneof1_e)(
+                pbtools_view_last_field(&self_p->base,
+                                        0,
+                                        3) + 1));
+}
+
+bool oneof_message2_view_get_v4(
+    struct oneof_message2_view_t *self_p,
+    struct oneof_message2_foo_view_t *value_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+    bool found;
+
+    value.buf_p = NULL;
+    value.size = 0;
+    found = pbtools_view_seek(&self_p->base, 0, &decoder);
+
+    if (found) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    oneof_message2_foo_view_init(value_p, value.buf_p, value.size);
+
+    return (found);
+}
+
+struct pbtools_bytes_t oneof_message2_view_get_v5(
+    struct oneof_message2_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+
+    value.buf_p = NULL;
+    value.size = 0;
+
+    if (pbtools_view_seek(&self_p->base, 1, &decoder)) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    return (value);
+}
+
+enum oneof_enum_e oneof_message2_view_get_v6(
+    struct oneof_message2_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 2, &decoder)) {
+        return ((enum oneof_enum_e)0);
+    }
+
+    return ((enum oneof_enum_e)pbtools_decoder_read_enum_unchecked(&decoder));
+}
+
+enum oneof_message2_oneof2_e oneof_message2_view_get_oneof2(
+    struct oneof_message2_view_t *self_p)
+{
+    return ((enum oneof_message2_oneof2_e)(
+                pbtools_view_last_field(&self_p->base,
+                                        3,
+                                        3) + 1));
+}
+
+bool oneof_message2_view_get_v1(
+    struct oneof_message2_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 3, &decoder)) {
+        return (false);
+    }
+
+    return (pbtools_decoder_read_bool_unchecked(&decoder));
+}
+
+bool oneof_message2_view_get_v2(
+    struct oneof_message2_view_t *self_p,
+    struct oneof_message2_foo_view_t *value_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+    bool found;
+
+    value.buf_p = NULL;
+    value.size = 0;
+    found = pbtools_view_seek(&self_p->base, 4, &decoder);
+
+    if (found) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    oneof_message2_foo_view_init(value_p, value.buf_p, value.size);
+
+    return (found);
+}
+
+bool oneof_message2_view_get_v3(
+    struct oneof_message2_view_t *self_p,
+    struct oneof_message_view_t *value_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+    bool found;
+
+    value.buf_p = NULL;
+    value.size = 0;
+    found = pbtools_view_seek(&self_p->base, 5, &decoder);
+
+    if (found) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    oneof_message_view_init(value_p, value.buf_p, value.size);
+
+    return (found);
 }
 
 struct oneof_message2_t *
@@ -599,13 +925,11 @@ int oneof_message3_v1_alloc(
 
 static void oneof_message3_v1_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct oneof_message3_t *self_p)
 {
     self_p->oneof1 = oneof_message3_oneof1_v1_e;
-    pbtools_decoder_sub_message_decode(
+    pbtools_decoder_sub_message_decode_unchecked(
         decoder_p,
-        wire_type,
         (struct pbtools_message_base_t **)&self_p->v1_p,
         sizeof(struct oneof_message3_bar_t),
         (pbtools_message_init_t)oneof_message3_bar_init,
@@ -628,24 +952,19 @@ void oneof_message3_foo_v2_init(
 
 static void oneof_message3_foo_v1_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct oneof_message3_foo_t *self_p)
 {
     oneof_message3_foo_v1_init(self_p);
-    self_p->v1 = pbtools_decoder_read_bool(
-        decoder_p,
-        wire_type);
+    self_p->v1 = pbtools_decoder_read_bool_unchecked(decoder_p);
 }
 
 static void oneof_message3_foo_v2_decode(
     struct pbtools_decoder_t *decoder_p,
-    int wire_type,
     struct oneof_message3_foo_t *self_p)
 {
     oneof_message3_foo_v2_init(self_p);
-    pbtools_decoder_read_bytes(decoder_p,
-                               wire_type,
-                               &self_p->v2);
+    pbtools_decoder_read_bytes_unchecked(decoder_p,
+                                         &self_p->v2);
 }
 
 void oneof_message3_foo_init(
@@ -685,27 +1004,41 @@ void oneof_message3_foo_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct oneof_message3_foo_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
 
-        case 1:
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
             oneof_message3_foo_v1_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
-        case 2:
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
             oneof_message3_foo_v2_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -716,12 +1049,14 @@ void oneof_message3_foo_encode_repeated_inner(
     int field_number,
     struct oneof_message3_foo_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct oneof_message3_foo_t),
-        (pbtools_message_encode_inner_t)oneof_message3_foo_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        oneof_message3_foo_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void oneof_message3_foo_decode_repeated_inner(
@@ -729,13 +1064,91 @@ void oneof_message3_foo_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct oneof_message3_foo_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct oneof_message3_foo_t),
-        (pbtools_message_init_t)oneof_message3_foo_init,
-        (pbtools_message_decode_inner_t)oneof_message3_foo_decode_inner);
+        sizeof(struct oneof_message3_foo_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        oneof_message3_foo_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        oneof_message3_foo_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t oneof_message3_foo_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false }
+};
+
+void oneof_message3_foo_view_init(
+    struct oneof_message3_foo_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &oneof_message3_foo_view_fields[0],
+                      2,
+                      &self_p->offsets[0]);
+}
+
+int oneof_message3_foo_view_error(
+    struct oneof_message3_foo_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+enum oneof_message3_foo_inner_oneof_e oneof_message3_foo_view_get_inner_oneof(
+    struct oneof_message3_foo_view_t *self_p)
+{
+    return ((enum oneof_message3_foo_inner_oneof_e)(
+                pbtools_view_last_field(&self_p->base,
+                                        0,
+                                        2) + 1));
+}
+
+bool oneof_message3_foo_view_get_v1(
+    struct oneof_message3_foo_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 0, &decoder)) {
+        return (false);
+    }
+
+    return (pbtools_decoder_read_bool_unchecked(&decoder));
+}
+
+struct pbtools_bytes_t oneof_message3_foo_view_get_v2(
+    struct oneof_message3_foo_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+
+    value.buf_p = NULL;
+    value.size = 0;
+
+    if (pbtools_view_seek(&self_p->base, 1, &decoder)) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    return (value);
 }
 
 void oneof_message3_bar_init(
@@ -760,22 +1173,45 @@ void oneof_message3_bar_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct oneof_message3_bar_t *self_p)
 {
+    uint32_t key;
     int wire_type;
     struct pbtools_repeated_info_t repeated_info_foo;
 
     pbtools_repeated_info_init(&repeated_info_foo, 1);
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
 
-        case 1:
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_1:
             pbtools_repeated_info_decode(&repeated_info_foo,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_1;
+            }
+
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -803,12 +1239,14 @@ void oneof_message3_bar_encode_repeated_inner(
     int field_number,
     struct oneof_message3_bar_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct oneof_message3_bar_t),
-        (pbtools_message_encode_inner_t)oneof_message3_bar_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        oneof_message3_bar_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void oneof_message3_bar_decode_repeated_inner(
@@ -816,13 +1254,76 @@ void oneof_message3_bar_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct oneof_message3_bar_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct oneof_message3_bar_t),
-        (pbtools_message_init_t)oneof_message3_bar_init,
-        (pbtools_message_decode_inner_t)oneof_message3_bar_decode_inner);
+        sizeof(struct oneof_message3_bar_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        oneof_message3_bar_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        oneof_message3_bar_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t oneof_message3_bar_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, true }
+};
+
+void oneof_message3_bar_view_init(
+    struct oneof_message3_bar_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &oneof_message3_bar_view_fields[0],
+                      1,
+                      &self_p->offsets[0]);
+}
+
+int oneof_message3_bar_view_error(
+    struct oneof_message3_bar_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+void oneof_message3_bar_view_foo_begin(
+    struct oneof_message3_bar_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 0);
+}
+
+bool oneof_message3_bar_view_foo_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct oneof_message3_foo_view_t *value_p)
+{
+    struct pbtools_bytes_t value;
+
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, &value);
+    oneof_message3_foo_view_init(value_p, value.buf_p, value.size);
+
+    return (true);
 }
 
 void oneof_message3_init(
@@ -856,20 +1357,34 @@ void oneof_message3_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct oneof_message3_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 1:
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
             oneof_message3_v1_decode(
                 decoder_p,
-                wire_type,
                 self_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -880,12 +1395,14 @@ void oneof_message3_encode_repeated_inner(
     int field_number,
     struct oneof_message3_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct oneof_message3_t),
-        (pbtools_message_encode_inner_t)oneof_message3_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        oneof_message3_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void oneof_message3_decode_repeated_inner(
@@ -893,13 +1410,83 @@ void oneof_message3_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct oneof_message3_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct oneof_message3_t),
-        (pbtools_message_init_t)oneof_message3_init,
-        (pbtools_message_decode_inner_t)oneof_message3_decode_inner);
+        sizeof(struct oneof_message3_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        oneof_message3_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        oneof_message3_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t oneof_message3_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false }
+};
+
+void oneof_message3_view_init(
+    struct oneof_message3_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &oneof_message3_view_fields[0],
+                      1,
+                      &self_p->offsets[0]);
+}
+
+int oneof_message3_view_error(
+    struct oneof_message3_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+enum oneof_message3_oneof1_e oneof_message3_view_get_oneof1(
+    struct oneof_message3_view_t *self_p)
+{
+    return ((enum oneof_message3_oneof1_e)(
+                pbtools_view_last_field(&self_p->base,
+                                        0,
+                                        1) + 1));
+}
+
+bool oneof_message3_view_get_v1(
+    struct oneof_message3_view_t *self_p,
+    struct oneof_message3_bar_view_t *value_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+    bool found;
+
+    value.buf_p = NULL;
+    value.size = 0;
+    found = pbtools_view_seek(&self_p->base, 0, &decoder);
+
+    if (found) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    oneof_message3_bar_view_init(value_p, value.buf_p, value.size);
+
+    return (found);
 }
 
 struct oneof_message3_t *
@@ -71,6 +71,14 @@ struct oneof_message_t {
     };
 };
 
+/**
+ * View of an encoded oneof.Message.
+ */
+struct oneof_message_view_t {
+    struct pbtools_view_t base;
+    int offsets[2];
+};
+
 /**
  * Message oneof.Message2.Foo.
  */
@@ -84,6 +92,14 @@ struct oneof_message2_foo_t {
     int32_t bar;
 };
 
+/**
+ * View of an encoded oneof.Message2.Foo.
+ */
+struct oneof_message2_foo_view_t {
+    struct pbtools_view_t base;
+    int offsets[1];
+};
+
 /**
  * Enum oneof.Message2.oneof1.
  */
@@ -128,6 +144,14 @@ struct oneof_message2_t {
     };
 };
 
+/**
+ * View of an encoded oneof.Message2.
+ */
+struct oneof_message2_view_t {
+    struct pbtools_view_t base;
+    int offsets[6];
+};
+
 /**
  * Enum oneof.Message3.Foo.inner_oneof.
  */
@@ -154,6 +178,14 @@ struct oneof_message3_foo_t {
     };
 };
 
+/**
+ * View of an encoded oneof.Message3.Foo.
+ */
+struct oneof_message3_foo_view_t {
+    struct pbtools_view_t base;
+    int offsets[2];
+};
+
 /**
  * Message oneof.Message3.Bar.
  */
@@ -167,6 +199,14 @@ struct oneof_message3_bar_t {
     struct oneof_message3_foo_repeated_t foo;
 };
 
+/**
+ * View of an encoded oneof.Message3.Bar.
+ */
+struct oneof_message3_bar_view_t {
+    struct pbtools_view_t base;
+    int offsets[1];
+};
+
 /**
  * Enum oneof.Message3.oneof1.
  */
@@ -191,6 +231,34 @@ struct oneof_message3_t {
     };
 };
 
+/**
+ * View of an encoded oneof.Message3.
+ */
+struct oneof_message3_view_t {
+    struct pbtools_view_t base;
+    int offsets[1];
+};
+
+/**
+ * Fields of an encoded oneof.Message read on demand.
+ */
+void oneof_message_view_init(
+    struct oneof_message_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int oneof_message_view_error(
+    struct oneof_message_view_t *self_p);
+
+enum oneof_message_value_e oneof_message_view_get_value(
+    struct oneof_message_view_t *self_p);
+
+int32_t oneof_message_view_get_v1(
+    struct oneof_message_view_t *self_p);
+
+struct pbtools_bytes_t oneof_message_view_get_v2(
+    struct oneof_message_view_t *self_p);
+
 void oneof_message_v1_init(
     struct oneof_message_t *self_p);
 
@@ -215,6 +283,58 @@ int oneof_message_decode(
     const uint8_t *encoded_p,
     size_t size);
 
+/**
+ * Fields of an encoded oneof.Message2.Foo read on demand.
+ */
+void oneof_message2_foo_view_init(
+    struct oneof_message2_foo_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int oneof_message2_foo_view_error(
+    struct oneof_message2_foo_view_t *self_p);
+
+int32_t oneof_message2_foo_view_get_bar(
+    struct oneof_message2_foo_view_t *self_p);
+
+/**
+ * Fields of an encoded oneof.Message2 read on demand.
+ */
+void oneof_message2_view_init(
+    struct oneof_message2_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int oneof_message2_view_error(
+    struct oneof_message2_view_t *self_p);
+
+enum oneof_message2_oneof1_e oneof_message2_view_get_oneof1(
+    struct oneof_message2_view_t *self_p);
+
+bool oneof_message2_view_get_v4(
+    struct oneof_message2_view_t *self_p,
+    struct oneof_message2_foo_view_t *value_p);
+
+struct pbtools_bytes_t oneof_message2_view_get_v5(
+    struct oneof_message2_view_t *self_p);
+
+enum oneof_enum_e oneof_message2_view_get_v6(
+    struct oneof_message2_view_t *self_p);
+
+enum oneof_message2_oneof2_e oneof_message2_view_get_oneof2(
+    struct oneof_message2_view_t *self_p);
+
+bool oneof_message2_view_get_v1(
+    struct oneof_message2_view_t *self_p);
+
+bool oneof_message2_view_get_v2(
+    struct oneof_message2_view_t *self_p,
+    struct oneof_message2_foo_view_t *value_p);
+
+bool oneof_message2_view_get_v3(
+    struct oneof_message2_view_t *self_p,
+    struct oneof_message_view_t *value_p);
+
 int oneof_message2_v4_alloc(
     struct oneof_message2_t *self_p);
 
@@ -251,6 +371,26 @@ int oneof_message2_decode(
     const uint8_t *encoded_p,
     size_t size);
 
+/**
+ * Fields of an encoded oneof.Message3.Foo read on demand.
+ */
+void oneof_message3_foo_view_init(
+    struct oneof_message3_foo_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int oneof_message3_foo_view_error(
+    struct oneof_message3_foo_view_t *self_p);
+
+enum oneof_message3_foo_inner_oneof_e oneof_message3_foo_view_get_inner_oneof(
+    struct oneof_message3_foo_view_t *self_p);
+
+bool oneof_message3_foo_view_get_v1(
+    struct oneof_message3_foo_view_t *self_p);
+
+struct pbtools_bytes_t oneof_message3_foo_view_get_v2(
+    struct oneof_message3_foo_view_t *self_p);
+
 void oneof_message3_foo_v1_init(
     struct oneof_message3_foo_t *self_p);
 
@@ -261,6 +401,43 @@ int oneof_message3_bar_foo_alloc(
     struct oneof_message3_bar_t *self_p,
     int length);
 
+/**
+ * Fields of an encoded oneof.Message3.Bar read on demand.
+ */
+void oneof_message3_bar_view_init(
+    struct oneof_message3_bar_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int oneof_message3_bar_view_error(
+    struct oneof_message3_bar_view_t *self_p);
+
+void oneof_message3_bar_view_foo_begin(
+    struct oneof_message3_bar_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool oneof_message3_bar_view_foo_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct oneof_message3_foo_view_t *value_p);
+
+/**
+ * Fields of an encoded oneof.Message3 read on demand.
+ */
+void oneof_message3_view_init(
+    struct oneof_message3_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int oneof_message3_view_error(
+    struct oneof_message3_view_t *self_p);
+
+enum oneof_message3_oneof1_e oneof_message3_view_get_oneof1(
+    struct oneof_message3_view_t *self_p);
+
+bool oneof_message3_view_get_v1(
+    struct oneof_message3_view_t *self_p,
+    struct oneof_message3_bar_view_t *value_p);
+
 int oneof_message3_v1_alloc(
     struct oneof_message3_t *self_p);
 
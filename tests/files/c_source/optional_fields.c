@@ -74,42 +74,102 @@ void optional_fields_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct optional_fields_message_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 1:
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
             self_p->v1.is_present = true;
-            self_p->v1.value = pbtools_decoder_read_int32(decoder_p, wire_type);
+            self_p->v1.value = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
+
             break;
 
-        case 2:
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
+        field_2:
             self_p->v2.is_present = true;
-            self_p->v2.value = pbtools_decoder_read_bool(decoder_p, wire_type);
+            self_p->v2.value = pbtools_decoder_read_bool_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_3;
+            }
+
             break;
 
-        case 3:
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_3:
             self_p->v3.is_present = true;
-            pbtools_decoder_read_string(decoder_p, wire_type, &self_p->v3.value_p);
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->v3.value_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_4;
+            }
+
             break;
 
-        case 4:
-            self_p->v4 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_VARINT):
+        field_4:
+            self_p->v4 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  5,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_5;
+            }
+
             break;
 
-        case 5:
+        case PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_5:
             self_p->v5.is_present = true;
-            pbtools_decoder_read_bytes(decoder_p, wire_type, &self_p->v5.value);
+            pbtools_decoder_read_bytes_unchecked(decoder_p, &self_p->v5.value);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  6,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_6;
+            }
+
             break;
 
-        case 6:
+        case PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_VARINT):
+        field_6:
             self_p->v6.is_present = true;
-            self_p->v6.value = pbtools_decoder_read_enum(decoder_p, wire_type);
+            self_p->v6.value = pbtools_decoder_read_enum_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -120,12 +180,14 @@ void optional_fields_message_encode_repeated_inner(
     int field_number,
     struct optional_fields_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct optional_fields_message_t),
-        (pbtools_message_encode_inner_t)optional_fields_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        optional_fields_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void optional_fields_message_decode_repeated_inner(
@@ -133,13 +195,178 @@ void optional_fields_message_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct optional_fields_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct optional_fields_message_t),
-        (pbtools_message_init_t)optional_fields_message_init,
-        (pbtools_message_decode_inner_t)optional_fields_message_decode_inner);
+        sizeof(struct optional_fields_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        optional_fields_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        optional_fields_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t optional_fields_message_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 2, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 3, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 4, PBTOOLS_WIRE_TYPE_VARINT, false },
+    { 5, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, false },
+    { 6, PBTOOLS_WIRE_TYPE_VARINT, false }
+};
+
+void optional_fields_message_view_init(
+    struct optional_fields_message_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &optional_fields_message_view_fields[0],
+                      6,
+                      &self_p->offsets[0]);
+}
+
+int optional_fields_message_view_error(
+    struct optional_fields_message_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+int32_t optional_fields_message_view_get_v1(
+    struct optional_fields_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 0, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+bool optional_fields_message_view_has_v1(
+    struct optional_fields_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    return (pbtools_view_seek(&self_p->base, 0, &decoder));
+}
+
+bool optional_fields_message_view_get_v2(
+    struct optional_fields_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 1, &decoder)) {
+        return (false);
+    }
+
+    return (pbtools_decoder_read_bool_unchecked(&decoder));
+}
+
+bool optional_fields_message_view_has_v2(
+    struct optional_fields_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    return (pbtools_view_seek(&self_p->base, 1, &decoder));
+}
+
+struct pbtools_bytes_t optional_fields_message_view_get_v3(
+    struct optional_fields_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+
+    value.buf_p = NULL;
+    value.size = 0;
+
+    if (pbtools_view_seek(&self_p->base, 2, &decoder)) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    return (value);
+}
+
+bool optional_fields_message_view_has_v3(
+    struct optional_fields_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    return (pbtools_view_seek(&self_p->base, 2, &decoder));
+}
+
+int32_t optional_fields_message_view_get_v4(
+    struct optional_fields_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 3, &decoder)) {
+        return (0);
+    }
+
+    return (pbtools_decoder_read_int32_unchecked(&decoder));
+}
+
+struct pbtools_bytes_t optional_fields_message_view_get_v5(
+    struct optional_fields_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+    struct pbtools_bytes_t value;
+
+    value.buf_p = NULL;
+    value.size = 0;
+
+    if (pbtools_view_seek(&self_p->base, 4, &decoder)) {
+        pbtools_decoder_read_bytes_view_unchecked(&decoder, &value);
+    }
+
+    return (value);
+}
+
+bool optional_fields_message_view_has_v5(
+    struct optional_fields_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    return (pbtools_view_seek(&self_p->base, 4, &decoder));
+}
+
+enum optional_fields_enum_e optional_fields_message_view_get_v6(
+    struct optional_fields_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    if (!pbtools_view_seek(&self_p->base, 5, &decoder)) {
+        return ((enum optional_fields_enum_e)0);
+    }
+
+    return ((enum optional_fields_enum_e)pbtools_decoder_read_enum_unchecked(&decoder));
+}
+
+bool optional_fields_message_view_has_v6(
+    struct optional_fields_message_view_t *self_p)
+{
+    struct pbtools_decoder_t decoder;
+
+    return (pbtools_view_seek(&self_p->base, 5, &decoder));
 }
 
 struct optional_fields_message_t *
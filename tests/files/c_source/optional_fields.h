@@ -78,6 +78,58 @@ struct optional_fields_message_t {
     } v6;
 };
 
+/**
+ * View of an encoded optional_fields.Message.
+ */
+struct optional_fields_message_view_t {
+    struct pbtools_view_t base;
+    int offsets[6];
+};
+
+/**
+ * Fields of an encoded optional_fields.Message read on demand.
+ */
+void optional_fields_message_view_init(
+    struct optional_fields_message_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int optional_fields_message_view_error(
+    struct optional_fields_message_view_t *self_p);
+
+int32_t optional_fields_message_view_get_v1(
+    struct optional_fields_message_view_t *self_p);
+
+bool optional_fields_message_view_has_v1(
+    struct optional_fields_message_view_t *self_p);
+
+bool optional_fields_message_view_get_v2(
+    struct optional_fields_message_view_t *self_p);
+
+bool optional_fields_message_view_has_v2(
+    struct optional_fields_message_view_t *self_p);
+
+struct pbtools_bytes_t optional_fields_message_view_get_v3(
+    struct optional_fields_message_view_t *self_p);
+
+bool optional_fields_message_view_has_v3(
+    struct optional_fields_message_view_t *self_p);
+
+int32_t optional_fields_message_view_get_v4(
+    struct optional_fields_message_view_t *self_p);
+
+struct pbtools_bytes_t optional_fields_message_view_get_v5(
+    struct optional_fields_message_view_t *self_p);
+
+bool optional_fields_message_view_has_v5(
+    struct optional_fields_message_view_t *self_p);
+
+enum optional_fields_enum_e optional_fields_message_view_get_v6(
+    struct optional_fields_message_view_t *self_p);
+
+bool optional_fields_message_view_has_v6(
+    struct optional_fields_message_view_t *self_p);
+
 /**
  * Encoding and decoding of optional_fields.Message.
  */
@@ -56,21 +56,45 @@ void ordering_bar_fie_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct ordering_bar_fie_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->v1 = pbtools_decoder_read_bool_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
 
-        case 1:
-            self_p->v1 = pbtools_decoder_read_bool(decoder_p, wire_type);
             break;
 
-        case 2:
-            self_p->v2 = pbtools_decoder_read_enum(decoder_p, wire_type);
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
+        field_2:
+            self_p->v2 = pbtools_decoder_read_enum_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -81,12 +105,14 @@ void ordering_bar_fie_encode_repeated_inner(
     int field_number,
     struct ordering_bar_fie_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct ordering_bar_fie_t),
-        (pbtools_message_encode_inner_t)ordering_bar_fie_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        ordering_bar_fie_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void ordering_bar_fie_decode_repeated_inner(
@@ -94,13 +120,30 @@ void ordering_bar_fie_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct ordering_bar_fie_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct ordering_bar_fie_t),
-        (pbtools_message_init_t)ordering_bar_fie_init,
-        (pbtools_message_decode_inner_t)ordering_bar_fie_decode_inner);
+        sizeof(struct ordering_bar_fie_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        ordering_bar_fie_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        ordering_bar_fie_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 void ordering_bar_gom_init(
@@ -126,15 +169,17 @@ void ordering_bar_gom_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct ordering_bar_gom_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
 
-        case 1:
-            pbtools_decoder_sub_message_decode(
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->v1_p,
                 sizeof(struct ordering_bar_fie_t),
                 (pbtools_message_init_t)ordering_bar_fie_init,
@@ -142,7 +187,19 @@ void ordering_bar_gom_decode_inner(
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -163,12 +220,14 @@ void ordering_bar_gom_encode_repeated_inner(
     int field_number,
     struct ordering_bar_gom_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct ordering_bar_gom_t),
-        (pbtools_message_encode_inner_t)ordering_bar_gom_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        ordering_bar_gom_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void ordering_bar_gom_decode_repeated_inner(
@@ -176,13 +235,30 @@ void ordering_bar_gom_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct ordering_bar_gom_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct ordering_bar_gom_t),
-        (pbtools_message_init_t)ordering_bar_gom_init,
-        (pbtools_message_decode_inner_t)ordering_bar_gom_decode_inner);
+        sizeof(struct ordering_bar_gom_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        ordering_bar_gom_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        ordering_bar_gom_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 void ordering_bar_init(
@@ -218,33 +294,58 @@ void ordering_bar_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct ordering_bar_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->value = pbtools_decoder_read_bool_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_2;
+            }
 
-        case 1:
-            self_p->value = pbtools_decoder_read_bool(decoder_p, wire_type);
             break;
 
-        case 2:
-            pbtools_decoder_sub_message_decode(
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_2:
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->fie_p,
                 sizeof(struct ordering_bar_fie_t),
                 (pbtools_message_init_t)ordering_bar_fie_init,
                 (pbtools_message_decode_inner_t)ordering_bar_fie_decode_inner);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_3;
+            }
+
             break;
 
-        case 3:
-            self_p->fum = pbtools_decoder_read_enum(decoder_p, wire_type);
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_VARINT):
+        field_3:
+            self_p->fum = pbtools_decoder_read_enum_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_4;
+            }
+
             break;
 
-        case 4:
-            pbtools_decoder_sub_message_decode(
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_4:
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->gom_p,
                 sizeof(struct ordering_bar_gom_t),
                 (pbtools_message_init_t)ordering_bar_gom_init,
@@ -252,7 +353,22 @@ void ordering_bar_decode_inner(
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -283,12 +399,14 @@ void ordering_bar_encode_repeated_inner(
     int field_number,
     struct ordering_bar_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct ordering_bar_t),
-        (pbtools_message_encode_inner_t)ordering_bar_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        ordering_bar_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void ordering_bar_decode_repeated_inner(
@@ -296,13 +414,30 @@ void ordering_bar_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct ordering_bar_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct ordering_bar_t),
-        (pbtools_message_init_t)ordering_bar_init,
-        (pbtools_message_decode_inner_t)ordering_bar_decode_inner);
+        sizeof(struct ordering_bar_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        ordering_bar_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        ordering_bar_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct ordering_bar_t *
@@ -366,27 +501,50 @@ void ordering_foo_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct ordering_foo_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
 
-        case 1:
-            pbtools_decoder_sub_message_decode(
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_decoder_sub_message_decode_unchecked(
                 decoder_p,
-                wire_type,
                 (struct pbtools_message_base_t **)&self_p->bar_p,
                 sizeof(struct ordering_bar_t),
                 (pbtools_message_init_t)ordering_bar_init,
                 (pbtools_message_decode_inner_t)ordering_bar_decode_inner);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
+
             break;
 
-        case 2:
-            self_p->fam = pbtools_decoder_read_enum(decoder_p, wire_type);
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
+        field_2:
+            self_p->fam = pbtools_decoder_read_enum_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -407,12 +565,14 @@ void ordering_foo_encode_repeated_inner(
     int field_number,
     struct ordering_foo_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct ordering_foo_t),
-        (pbtools_message_encode_inner_t)ordering_foo_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        ordering_foo_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void ordering_foo_decode_repeated_inner(
@@ -420,13 +580,30 @@ void ordering_foo_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct ordering_foo_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct ordering_foo_t),
-        (pbtools_message_init_t)ordering_foo_init,
-        (pbtools_message_decode_inner_t)ordering_foo_decode_inner);
+        sizeof(struct ordering_foo_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        ordering_foo_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        ordering_foo_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct ordering_foo_t *
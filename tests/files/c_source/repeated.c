@@ -63,6 +63,7 @@ void repeated_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct repeated_message_t *self_p)
 {
+    uint32_t key;
     int wire_type;
     struct pbtools_repeated_info_t repeated_info_int32s;
     struct pbtools_repeated_info_t repeated_info_messages;
@@ -75,37 +76,92 @@ void repeated_message_decode_inner(
     pbtools_repeated_info_init(&repeated_info_bytes, 4);
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 1:
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_int32s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_2;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
             pbtools_repeated_info_decode_int32(
                 &repeated_info_int32s,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
             break;
 
-        case 2:
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_2:
             pbtools_repeated_info_decode(&repeated_info_messages,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_2;
+            }
+
             break;
 
-        case 3:
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_3:
             pbtools_repeated_info_decode_string(
                 &repeated_info_strings,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_3;
+            }
+
             break;
 
-        case 4:
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_4:
             pbtools_repeated_info_decode_bytes(
                 &repeated_info_bytes,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_4;
+            }
+
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -175,12 +231,14 @@ void repeated_message_encode_repeated_inner(
     int field_number,
     struct repeated_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct repeated_message_t),
-        (pbtools_message_encode_inner_t)repeated_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        repeated_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void repeated_message_decode_repeated_inner(
@@ -188,15 +246,148 @@ void repeated_message_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct repeated_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct repeated_message_t),
-        (pbtools_message_init_t)repeated_message_init,
-        (pbtools_message_decode_inner_t)repeated_message_decode_inner);
+        sizeof(struct repeated_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        repeated_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        repeated_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t repeated_message_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, true },
+    { 3, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, true },
+    { 4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, true }
+};
+
+void repeated_message_view_init(
+    struct repeated_message_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &repeated_message_view_fields[0],
+                      4,
+                      &self_p->offsets[0]);
+}
+
+int repeated_message_view_error(
+    struct repeated_message_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+void repeated_message_view_int32s_begin(
+    struct repeated_message_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 0);
+}
+
+bool repeated_message_view_int32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_view_messages_begin(
+    struct repeated_message_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 1);
+}
+
+bool repeated_message_view_messages_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct repeated_message_view_t *value_p)
+{
+    struct pbtools_bytes_t value;
+
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, &value);
+    repeated_message_view_init(value_p, value.buf_p, value.size);
+
+    return (true);
+}
+
+void repeated_message_view_strings_begin(
+    struct repeated_message_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 2);
+}
+
+bool repeated_message_view_strings_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct pbtools_bytes_t *value_p)
+{{
+    if (!pbtools_view_iterator_next(iterator_p)) {{
+        return (false);
+    }}
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, value_p);
+
+    return (true);
+}}
+
+void repeated_message_view_bytes_begin(
+    struct repeated_message_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 3);
 }
 
+bool repeated_message_view_bytes_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct pbtools_bytes_t *value_p)
+{{
+    if (!pbtools_view_iterator_next(iterator_p)) {{
+        return (false);
+    }}
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, value_p);
+
+    return (true);
+}}
+
 struct repeated_message_t *
 repeated_message_new(
     void *workspace_p,
@@ -233,6 +424,30 @@ int repeated_message_decode(
                 (pbtools_message_decode_inner_t)repeated_message_decode_inner));
 }
 
+int repeated_message_decode_segments(
+    struct repeated_message_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)repeated_message_decode_inner));
+}
+
+int repeated_message_int32s_set_storage(
+    struct repeated_message_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->int32s,
+                items_p,
+                capacity));
+}
+
 void repeated_message_scalar_value_types_init(
     struct repeated_message_scalar_value_types_t *self_p,
     struct pbtools_heap_t *heap_p)
@@ -280,6 +495,7 @@ void repeated_message_scalar_value_types_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct repeated_message_scalar_value_types_t *self_p)
 {
+    uint32_t key;
     int wire_type;
     struct pbtools_repeated_info_t repeated_info_int32s;
     struct pbtools_repeated_info_t repeated_info_int64s;
@@ -314,115 +530,353 @@ void repeated_message_scalar_value_types_decode_inner(
     pbtools_repeated_info_init(&repeated_info_bytess, 15);
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_int32s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_2;
+            }
+
+            break;
 
-        case 1:
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
             pbtools_repeated_info_decode_int32(
                 &repeated_info_int32s,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_2:
+            pbtools_repeated_info_decode_int64(
+                &repeated_info_int64s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_3;
+            }
+
             break;
 
-        case 2:
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
             pbtools_repeated_info_decode_int64(
                 &repeated_info_int64s,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_3:
+            pbtools_repeated_info_decode_sint32(
+                &repeated_info_sint32s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_4;
+            }
+
             break;
 
-        case 3:
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_VARINT):
             pbtools_repeated_info_decode_sint32(
                 &repeated_info_sint32s,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_4:
+            pbtools_repeated_info_decode_sint64(
+                &repeated_info_sint64s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  5,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_5;
+            }
+
             break;
 
-        case 4:
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_VARINT):
             pbtools_repeated_info_decode_sint64(
                 &repeated_info_sint64s,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_5:
+            pbtools_repeated_info_decode_uint32(
+                &repeated_info_uint32s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  6,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_6;
+            }
+
             break;
 
-        case 5:
+        case PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_VARINT):
             pbtools_repeated_info_decode_uint32(
                 &repeated_info_uint32s,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_6:
+            pbtools_repeated_info_decode_uint64(
+                &repeated_info_uint64s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  7,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_7;
+            }
+
             break;
 
-        case 6:
+        case PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_VARINT):
             pbtools_repeated_info_decode_uint64(
                 &repeated_info_uint64s,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
             break;
 
-        case 7:
+        case PBTOOLS_KEY(7, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_7:
             pbtools_repeated_info_decode_fixed32(
                 &repeated_info_fixed32s,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  8,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_8;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(7, PBTOOLS_WIRE_TYPE_32_BIT):
+            pbtools_repeated_info_decode_fixed32(
+                &repeated_info_fixed32s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_32_BIT);
+            break;
+
+        case PBTOOLS_KEY(8, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_8:
+            pbtools_repeated_info_decode_fixed64(
+                &repeated_info_fixed64s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  9,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_9;
+            }
+
             break;
 
-        case 8:
+        case PBTOOLS_KEY(8, PBTOOLS_WIRE_TYPE_64_BIT):
             pbtools_repeated_info_decode_fixed64(
                 &repeated_info_fixed64s,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_64_BIT);
+            break;
+
+        case PBTOOLS_KEY(9, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_9:
+            pbtools_repeated_info_decode_sfixed32(
+                &repeated_info_sfixed32s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  10,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_10;
+            }
+
             break;
 
-        case 9:
+        case PBTOOLS_KEY(9, PBTOOLS_WIRE_TYPE_32_BIT):
             pbtools_repeated_info_decode_sfixed32(
                 &repeated_info_sfixed32s,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_32_BIT);
+            break;
+
+        case PBTOOLS_KEY(10, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_10:
+            pbtools_repeated_info_decode_sfixed64(
+                &repeated_info_sfixed64s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  11,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_11;
+            }
+
             break;
 
-        case 10:
+        case PBTOOLS_KEY(10, PBTOOLS_WIRE_TYPE_64_BIT):
             pbtools_repeated_info_decode_sfixed64(
                 &repeated_info_sfixed64s,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_64_BIT);
+            break;
+
+        case PBTOOLS_KEY(11, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_11:
+            pbtools_repeated_info_decode_float(
+                &repeated_info_floats,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  12,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_12;
+            }
+
             break;
 
-        case 11:
+        case PBTOOLS_KEY(11, PBTOOLS_WIRE_TYPE_32_BIT):
             pbtools_repeated_info_decode_float(
                 &repeated_info_floats,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_32_BIT);
+            break;
+
+        case PBTOOLS_KEY(12, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_12:
+            pbtools_repeated_info_decode_double(
+                &repeated_info_doubles,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  13,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_13;
+            }
+
             break;
 
-        case 12:
+        case PBTOOLS_KEY(12, PBTOOLS_WIRE_TYPE_64_BIT):
             pbtools_repeated_info_decode_double(
                 &repeated_info_doubles,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_64_BIT);
+            break;
+
+        case PBTOOLS_KEY(13, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_13:
+            pbtools_repeated_info_decode_bool(
+                &repeated_info_bools,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  14,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_14;
+            }
+
             break;
 
-        case 13:
+        case PBTOOLS_KEY(13, PBTOOLS_WIRE_TYPE_VARINT):
             pbtools_repeated_info_decode_bool(
                 &repeated_info_bools,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
             break;
 
-        case 14:
+        case PBTOOLS_KEY(14, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_14:
             pbtools_repeated_info_decode_string(
                 &repeated_info_strings,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  14,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_14;
+            }
+
             break;
 
-        case 15:
+        case PBTOOLS_KEY(15, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_15:
             pbtools_repeated_info_decode_bytes(
                 &repeated_info_bytess,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  15,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_15;
+            }
+
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+            case 7:
+            case 8:
+            case 9:
+            case 10:
+            case 11:
+            case 12:
+            case 13:
+            case 14:
+            case 15:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -644,12 +1098,14 @@ void repeated_message_scalar_value_types_encode_repeated_inner(
     int field_number,
     struct repeated_message_scalar_value_types_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct repeated_message_scalar_value_types_t),
-        (pbtools_message_encode_inner_t)repeated_message_scalar_value_types_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        repeated_message_scalar_value_types_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void repeated_message_scalar_value_types_decode_repeated_inner(
@@ -657,498 +1113,474 @@ void repeated_message_scalar_value_types_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct repeated_message_scalar_value_types_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct repeated_message_scalar_value_types_t),
-        (pbtools_message_init_t)repeated_message_scalar_value_types_init,
-        (pbtools_message_decode_inner_t)repeated_message_scalar_value_types_decode_inner);
+        sizeof(struct repeated_message_scalar_value_types_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        repeated_message_scalar_value_types_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        repeated_message_scalar_value_types_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
-struct repeated_message_scalar_value_types_t *
-repeated_message_scalar_value_types_new(
-    void *workspace_p,
+static const struct pbtools_view_field_t repeated_message_scalar_value_types_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 2, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 3, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 4, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 5, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 6, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 7, PBTOOLS_WIRE_TYPE_32_BIT, true },
+    { 8, PBTOOLS_WIRE_TYPE_64_BIT, true },
+    { 9, PBTOOLS_WIRE_TYPE_32_BIT, true },
+    { 10, PBTOOLS_WIRE_TYPE_64_BIT, true },
+    { 11, PBTOOLS_WIRE_TYPE_32_BIT, true },
+    { 12, PBTOOLS_WIRE_TYPE_64_BIT, true },
+    { 13, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 14, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, true },
+    { 15, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, true }
+};
+
+void repeated_message_scalar_value_types_view_init(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    const uint8_t *encoded_p,
     size_t size)
 {
-    return (pbtools_message_new(
-                workspace_p,
-                size,
-                sizeof(struct repeated_message_scalar_value_types_t),
-                (pbtools_message_init_t)repeated_message_scalar_value_types_init));
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &repeated_message_scalar_value_types_view_fields[0],
+                      15,
+                      &self_p->offsets[0]);
 }
 
-int repeated_message_scalar_value_types_encode(
-    struct repeated_message_scalar_value_types_t *self_p,
-    uint8_t *encoded_p,
-    size_t size)
+int repeated_message_scalar_value_types_view_error(
+    struct repeated_message_scalar_value_types_view_t *self_p)
 {
-    return (pbtools_message_encode(
-                &self_p->base,
-                encoded_p,
-                size,
-                (pbtools_message_encode_inner_t)repeated_message_scalar_value_types_encode_inner));
+    return (pbtools_view_get_error(&self_p->base));
 }
 
-int repeated_message_scalar_value_types_decode(
-    struct repeated_message_scalar_value_types_t *self_p,
-    const uint8_t *encoded_p,
-    size_t size)
+void repeated_message_scalar_value_types_view_int32s_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
 {
-    return (pbtools_message_decode(
-                &self_p->base,
-                encoded_p,
-                size,
-                (pbtools_message_decode_inner_t)repeated_message_scalar_value_types_decode_inner));
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 0);
 }
 
-void repeated_message_scalar_value_types_packed_init(
-    struct repeated_message_scalar_value_types_packed_t *self_p,
-    struct pbtools_heap_t *heap_p)
+bool repeated_message_scalar_value_types_view_int32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
 {
-    self_p->base.heap_p = heap_p;
-    self_p->int32s.length = 0;
-    self_p->int64s.length = 0;
-    self_p->sint32s.length = 0;
-    self_p->sint64s.length = 0;
-    self_p->uint32s.length = 0;
-    self_p->uint64s.length = 0;
-    self_p->fixed32s.length = 0;
-    self_p->fixed64s.length = 0;
-    self_p->sfixed32s.length = 0;
-    self_p->sfixed64s.length = 0;
-    self_p->floats.length = 0;
-    self_p->doubles.length = 0;
-    self_p->bools.length = 0;
-    self_p->strings.length = 0;
-    self_p->bytess.length = 0;
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
 }
 
-void repeated_message_scalar_value_types_packed_encode_inner(
-    struct pbtools_encoder_t *encoder_p,
-    struct repeated_message_scalar_value_types_packed_t *self_p)
+void repeated_message_scalar_value_types_view_int64s_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
 {
-    pbtools_encoder_write_repeated_bytes(encoder_p, 15, &self_p->bytess);
-    pbtools_encoder_write_repeated_string(encoder_p, 14, &self_p->strings);
-    pbtools_encoder_write_repeated_bool(encoder_p, 13, &self_p->bools);
-    pbtools_encoder_write_repeated_double(encoder_p, 12, &self_p->doubles);
-    pbtools_encoder_write_repeated_float(encoder_p, 11, &self_p->floats);
-    pbtools_encoder_write_repeated_sfixed64(encoder_p, 10, &self_p->sfixed64s);
-    pbtools_encoder_write_repeated_sfixed32(encoder_p, 9, &self_p->sfixed32s);
-    pbtools_encoder_write_repeated_fixed64(encoder_p, 8, &self_p->fixed64s);
-    pbtools_encoder_write_repeated_fixed32(encoder_p, 7, &self_p->fixed32s);
-    pbtools_encoder_write_repeated_uint64(encoder_p, 6, &self_p->uint64s);
-    pbtools_encoder_write_repeated_uint32(encoder_p, 5, &self_p->uint32s);
-    pbtools_encoder_write_repeated_sint64(encoder_p, 4, &self_p->sint64s);
-    pbtools_encoder_write_repeated_sint32(encoder_p, 3, &self_p->sint32s);
-    pbtools_encoder_write_repeated_int64(encoder_p, 2, &self_p->int64s);
-    pbtools_encoder_write_repeated_int32(encoder_p, 1, &self_p->int32s);
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 1);
 }
 
-void repeated_message_scalar_value_types_packed_decode_inner(
-    struct pbtools_decoder_t *decoder_p,
-    struct repeated_message_scalar_value_types_packed_t *self_p)
+bool repeated_message_scalar_value_types_view_int64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int64_t *value_p)
 {
-    int wire_type;
-    struct pbtools_repeated_info_t repeated_info_int32s;
-    struct pbtools_repeated_info_t repeated_info_int64s;
-    struct pbtools_repeated_info_t repeated_info_sint32s;
-    struct pbtools_repeated_info_t repeated_info_sint64s;
-    struct pbtools_repeated_info_t repeated_info_uint32s;
-    struct pbtools_repeated_info_t repeated_info_uint64s;
-    struct pbtools_repeated_info_t repeated_info_fixed32s;
-    struct pbtools_repeated_info_t repeated_info_fixed64s;
-    struct pbtools_repeated_info_t repeated_info_sfixed32s;
-    struct pbtools_repeated_info_t repeated_info_sfixed64s;
-    struct pbtools_repeated_info_t repeated_info_floats;
-    struct pbtools_repeated_info_t repeated_info_doubles;
-    struct pbtools_repeated_info_t repeated_info_bools;
-    struct pbtools_repeated_info_t repeated_info_strings;
-    struct pbtools_repeated_info_t repeated_info_bytess;
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
 
-    pbtools_repeated_info_init(&repeated_info_int32s, 1);
-    pbtools_repeated_info_init(&repeated_info_int64s, 2);
-    pbtools_repeated_info_init(&repeated_info_sint32s, 3);
-    pbtools_repeated_info_init(&repeated_info_sint64s, 4);
-    pbtools_repeated_info_init(&repeated_info_uint32s, 5);
-    pbtools_repeated_info_init(&repeated_info_uint64s, 6);
-    pbtools_repeated_info_init(&repeated_info_fixed32s, 7);
-    pbtools_repeated_info_init(&repeated_info_fixed64s, 8);
-    pbtools_repeated_info_init(&repeated_info_sfixed32s, 9);
-    pbtools_repeated_info_init(&repeated_info_sfixed64s, 10);
-    pbtools_repeated_info_init(&repeated_info_floats, 11);
-    pbtools_repeated_info_init(&repeated_info_doubles, 12);
-    pbtools_repeated_info_init(&repeated_info_bools, 13);
-    pbtools_repeated_info_init(&repeated_info_strings, 14);
-    pbtools_repeated_info_init(&repeated_info_bytess, 15);
+    *value_p = pbtools_decoder_read_int64_unchecked(&iterator_p->decoder);
 
-    while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
 
-        case 1:
-            pbtools_repeated_info_decode_int32(
-                &repeated_info_int32s,
-                decoder_p,
-                wire_type);
-            break;
+        return (false);
+    }
 
-        case 2:
-            pbtools_repeated_info_decode_int64(
-                &repeated_info_int64s,
-                decoder_p,
-                wire_type);
-            break;
+    return (true);
+}
 
-        case 3:
-            pbtools_repeated_info_decode_sint32(
-                &repeated_info_sint32s,
-                decoder_p,
-                wire_type);
-            break;
+void repeated_message_scalar_value_types_view_sint32s_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 2);
+}
 
-        case 4:
-            pbtools_repeated_info_decode_sint64(
-                &repeated_info_sint64s,
-                decoder_p,
-                wire_type);
-            break;
+bool repeated_message_scalar_value_types_view_sint32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
 
-        case 5:
-            pbtools_repeated_info_decode_uint32(
-                &repeated_info_uint32s,
-                decoder_p,
-                wire_type);
-            break;
+    *value_p = pbtools_decoder_read_sint32_unchecked(&iterator_p->decoder);
 
-        case 6:
-            pbtools_repeated_info_decode_uint64(
-                &repeated_info_uint64s,
-                decoder_p,
-                wire_type);
-            break;
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
 
-        case 7:
-            pbtools_repeated_info_decode_fixed32(
-                &repeated_info_fixed32s,
-                decoder_p,
-                wire_type);
-            break;
+        return (false);
+    }
 
-        case 8:
-            pbtools_repeated_info_decode_fixed64(
-                &repeated_info_fixed64s,
-                decoder_p,
-                wire_type);
-            break;
+    return (true);
+}
 
-        case 9:
-            pbtools_repeated_info_decode_sfixed32(
-                &repeated_info_sfixed32s,
-                decoder_p,
-                wire_type);
-            break;
+void repeated_message_scalar_value_types_view_sint64s_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 3);
+}
 
-        case 10:
-            pbtools_repeated_info_decode_sfixed64(
-                &repeated_info_sfixed64s,
-                decoder_p,
-                wire_type);
-            break;
+bool repeated_message_scalar_value_types_view_sint64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int64_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
 
-        case 11:
-            pbtools_repeated_info_decode_float(
-                &repeated_info_floats,
-                decoder_p,
-                wire_type);
-            break;
+    *value_p = pbtools_decoder_read_sint64_unchecked(&iterator_p->decoder);
 
-        case 12:
-            pbtools_repeated_info_decode_double(
-                &repeated_info_doubles,
-                decoder_p,
-                wire_type);
-            break;
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
 
-        case 13:
-            pbtools_repeated_info_decode_bool(
-                &repeated_info_bools,
-                decoder_p,
-                wire_type);
-            break;
+        return (false);
+    }
 
-        case 14:
-            pbtools_repeated_info_decode_string(
-                &repeated_info_strings,
-                decoder_p,
-                wire_type);
-            break;
+    return (true);
+}
 
-        case 15:
-            pbtools_repeated_info_decode_bytes(
-                &repeated_info_bytess,
-                decoder_p,
-                wire_type);
-            break;
+void repeated_message_scalar_value_types_view_uint32s_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 4);
+}
 
-        default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
-            break;
-        }
+bool repeated_message_scalar_value_types_view_uint32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
     }
 
-    pbtools_decoder_decode_repeated_int32(
-        decoder_p,
-        &repeated_info_int32s,
-        &self_p->int32s);
-    pbtools_decoder_decode_repeated_int64(
-        decoder_p,
-        &repeated_info_int64s,
-        &self_p->int64s);
-    pbtools_decoder_decode_repeated_sint32(
-        decoder_p,
-        &repeated_info_sint32s,
-        &self_p->sint32s);
-    pbtools_decoder_decode_repeated_sint64(
-        decoder_p,
-        &repeated_info_sint64s,
-        &self_p->sint64s);
-    pbtools_decoder_decode_repeated_uint32(
-        decoder_p,
-        &repeated_info_uint32s,
-        &self_p->uint32s);
-    pbtools_decoder_decode_repeated_uint64(
-        decoder_p,
-        &repeated_info_uint64s,
-        &self_p->uint64s);
-    pbtools_decoder_decode_repeated_fixed32(
-        decoder_p,
-        &repeated_info_fixed32s,
-        &self_p->fixed32s);
-    pbtools_decoder_decode_repeated_fixed64(
-        decoder_p,
-        &repeated_info_fixed64s,
-        &self_p->fixed64s);
-    pbtools_decoder_decode_repeated_sfixed32(
-        decoder_p,
-        &repeated_info_sfixed32s,
-        &self_p->sfixed32s);
-    pbtools_decoder_decode_repeated_sfixed64(
-        decoder_p,
-        &repeated_info_sfixed64s,
-        &self_p->sfixed64s);
-    pbtools_decoder_decode_repeated_float(
-        decoder_p,
-        &repeated_info_floats,
-        &self_p->floats);
-    pbtools_decoder_decode_repeated_double(
-        decoder_p,
-        &repeated_info_doubles,
-        &self_p->doubles);
-    pbtools_decoder_decode_repeated_bool(
-        decoder_p,
-        &repeated_info_bools,
-        &self_p->bools);
-    pbtools_decoder_decode_repeated_string(
-        decoder_p,
-        &repeated_info_strings,
-        &self_p->strings);
-    pbtools_decoder_decode_repeated_bytes(
-        decoder_p,
-        &repeated_info_bytess,
-        &self_p->bytess);
+    *value_p = pbtools_decoder_read_uint32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
 }
 
-int repeated_message_scalar_value_types_packed_int32s_alloc(
-    struct repeated_message_scalar_value_types_packed_t *self_p,
-    int length)
+void repeated_message_scalar_value_types_view_uint64s_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
 {
-    return (pbtools_alloc_repeated_int32(
-                &self_p->base,
-                length,
-                &self_p->int32s));
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 5);
 }
 
-int repeated_message_scalar_value_types_packed_int64s_alloc(
-    struct repeated_message_scalar_value_types_packed_t *self_p,
-    int length)
+bool repeated_message_scalar_value_types_view_uint64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint64_t *value_p)
 {
-    return (pbtools_alloc_repeated_int64(
-                &self_p->base,
-                length,
-                &self_p->int64s));
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_uint64_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
 }
 
-int repeated_message_scalar_value_types_packed_sint32s_alloc(
-    struct repeated_message_scalar_value_types_packed_t *self_p,
-    int length)
+void repeated_message_scalar_value_types_view_fixed32s_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
 {
-    return (pbtools_alloc_repeated_sint32(
-                &self_p->base,
-                length,
-                &self_p->sint32s));
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 6);
 }
 
-int repeated_message_scalar_value_types_packed_sint64s_alloc(
-    struct repeated_message_scalar_value_types_packed_t *self_p,
-    int length)
+bool repeated_message_scalar_value_types_view_fixed32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint32_t *value_p)
 {
-    return (pbtools_alloc_repeated_sint64(
-                &self_p->base,
-                length,
-                &self_p->sint64s));
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_fixed32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
 }
 
-int repeated_message_scalar_value_types_packed_uint32s_alloc(
-    struct repeated_message_scalar_value_types_packed_t *self_p,
-    int length)
+void repeated_message_scalar_value_types_view_fixed64s_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
 {
-    return (pbtools_alloc_repeated_uint32(
-                &self_p->base,
-                length,
-                &self_p->uint32s));
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 7);
 }
 
-int repeated_message_scalar_value_types_packed_uint64s_alloc(
-    struct repeated_message_scalar_value_types_packed_t *self_p,
-    int length)
+bool repeated_message_scalar_value_types_view_fixed64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint64_t *value_p)
 {
-    return (pbtools_alloc_repeated_uint64(
-                &self_p->base,
-                length,
-                &self_p->uint64s));
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_fixed64_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
 }
 
-int repeated_message_scalar_value_types_packed_fixed32s_alloc(
-    struct repeated_message_scalar_value_types_packed_t *self_p,
-    int length)
+void repeated_message_scalar_value_types_view_sfixed32s_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
 {
-    return (pbtools_alloc_repeated_fixed32(
-                &self_p->base,
-                length,
-                &self_p->fixed32s));
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 8);
 }
 
-int repeated_message_scalar_value_types_packed_fixed64s_alloc(
-    struct repeated_message_scalar_value_types_packed_t *self_p,
-    int length)
+bool repeated_message_scalar_value_types_view_sfixed32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
 {
-    return (pbtools_alloc_repeated_fixed64(
-                &self_p->base,
-                length,
-                &self_p->fixed64s));
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_sfixed32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
 }
 
-int repeated_message_scalar_value_types_packed_sfixed32s_alloc(
-    struct repeated_message_scalar_value_types_packed_t *self_p,
-    int length)
+void repeated_message_scalar_value_types_view_sfixed64s_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
 {
-    return (pbtools_alloc_repeated_sfixed32(
-                &self_p->base,
-                length,
-                &self_p->sfixed32s));
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 9);
 }
 
-int repeated_message_scalar_value_types_packed_sfixed64s_alloc(
-    struct repeated_message_scalar_value_types_packed_t *self_p,
-    int length)
+bool repeated_message_scalar_value_types_view_sfixed64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int64_t *value_p)
 {
-    return (pbtools_alloc_repeated_sfixed64(
-                &self_p->base,
-                length,
-                &self_p->sfixed64s));
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_sfixed64_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
 }
 
-int repeated_message_scalar_value_types_packed_floats_alloc(
-    struct repeated_message_scalar_value_types_packed_t *self_p,
-    int length)
+void repeated_message_scalar_value_types_view_floats_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
 {
-    return (pbtools_alloc_repeated_float(
-                &self_p->base,
-                length,
-                &self_p->floats));
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 10);
 }
 
-int repeated_message_scalar_value_types_packed_doubles_alloc(
-    struct repeated_message_scalar_value_types_packed_t *self_p,
-    int length)
+bool repeated_message_scalar_value_types_view_floats_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    float *value_p)
 {
-    return (pbtools_alloc_repeated_double(
-                &self_p->base,
-                length,
-                &self_p->doubles));
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_float_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
 }
 
-int repeated_message_scalar_value_types_packed_bools_alloc(
-    struct repeated_message_scalar_value_types_packed_t *self_p,
-    int length)
+void repeated_message_scalar_value_types_view_doubles_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
 {
-    return (pbtools_alloc_repeated_bool(
-                &self_p->base,
-                length,
-                &self_p->bools));
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 11);
 }
 
-int repeated_message_scalar_value_types_packed_strings_alloc(
-    struct repeated_message_scalar_value_types_packed_t *self_p,
-    int length)
+bool repeated_message_scalar_value_types_view_doubles_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    double *value_p)
 {
-    return (pbtools_alloc_repeated_string(
-                &self_p->base,
-                length,
-                &self_p->strings));
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_double_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
 }
 
-int repeated_message_scalar_value_types_packed_bytess_alloc(
-    struct repeated_message_scalar_value_types_packed_t *self_p,
-    int length)
+void repeated_message_scalar_value_types_view_bools_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
 {
-    return (pbtools_alloc_repeated_bytes(
-                &self_p->base,
-                length,
-                &self_p->bytess));
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 12);
 }
 
-void repeated_message_scalar_value_types_packed_encode_repeated_inner(
-    struct pbtools_encoder_t *encoder_p,
-    int field_number,
-    struct repeated_message_scalar_value_types_packed_repeated_t *repeated_p)
+bool repeated_message_scalar_value_types_view_bools_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    bool *value_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct repeated_message_scalar_value_types_packed_t),
-        (pbtools_message_encode_inner_t)repeated_message_scalar_value_types_packed_encode_inner);
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_bool_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
 }
 
-void repeated_message_scalar_value_types_packed_decode_repeated_inner(
-    struct pbtools_decoder_t *decoder_p,
-    struct pbtools_repeated_info_t *repeated_info_p,
-    struct repeated_message_scalar_value_types_packed_repeated_t *repeated_p)
+void repeated_message_scalar_value_types_view_strings_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
 {
-    pbtools_decode_repeated_inner(
-        decoder_p,
-        repeated_info_p,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct repeated_message_scalar_value_types_packed_t),
-        (pbtools_message_init_t)repeated_message_scalar_value_types_packed_init,
-        (pbtools_message_decode_inner_t)repeated_message_scalar_value_types_packed_decode_inner);
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 13);
 }
 
-struct repeated_message_scalar_value_types_packed_t *
-repeated_message_scalar_value_types_packed_new(
+bool repeated_message_scalar_value_types_view_strings_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct pbtools_bytes_t *value_p)
+{{
+    if (!pbtools_view_iterator_next(iterator_p)) {{
+        return (false);
+    }}
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, value_p);
+
+    return (true);
+}}
+
+void repeated_message_scalar_value_types_view_bytess_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 14);
+}
+
+bool repeated_message_scalar_value_types_view_bytess_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct pbtools_bytes_t *value_p)
+{{
+    if (!pbtools_view_iterator_next(iterator_p)) {{
+        return (false);
+    }}
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, value_p);
+
+    return (true);
+}}
+
+struct repeated_message_scalar_value_types_t *
+repeated_message_scalar_value_types_new(
     void *workspace_p,
     size_t size)
 {
     return (pbtools_message_new(
                 workspace_p,
                 size,
-                sizeof(struct repeated_message_scalar_value_types_packed_t),
-                (pbtools_message_init_t)repeated_message_scalar_value_types_packed_init));
+                sizeof(struct repeated_message_scalar_value_types_t),
+                (pbtools_message_init_t)repeated_message_scalar_value_types_init));
 }
 
-int repeated_message_scalar_value_types_packed_encode(
-    struct repeated_message_scalar_value_types_packed_t *self_p,
+int repeated_message_scalar_value_types_encode(
+    struct repeated_message_scalar_value_types_t *self_p,
     uint8_t *encoded_p,
     size_t size)
 {
@@ -1156,11 +1588,11 @@ int repeated_message_scalar_value_types_packed_encode(
                 &self_p->base,
                 encoded_p,
                 size,
-                (pbtools_message_encode_inner_t)repeated_message_scalar_value_types_packed_encode_inner));
+                (pbtools_message_encode_inner_t)repeated_message_scalar_value_types_encode_inner));
 }
 
-int repeated_message_scalar_value_types_packed_decode(
-    struct repeated_message_scalar_value_types_packed_t *self_p,
+int repeated_message_scalar_value_types_decode(
+    struct repeated_message_scalar_value_types_t *self_p,
     const uint8_t *encoded_p,
     size_t size)
 {
@@ -1168,11 +1600,179 @@ int repeated_message_scalar_value_types_packed_decode(
                 &self_p->base,
                 encoded_p,
                 size,
-                (pbtools_message_decode_inner_t)repeated_message_scalar_value_types_packed_decode_inner));
+                (pbtools_message_decode_inner_t)repeated_message_scalar_value_types_decode_inner));
 }
 
-void repeated_message_scalar_value_types_not_packed_init(
-    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+int repeated_message_scalar_value_types_decode_segments(
+    struct repeated_message_scalar_value_types_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)repeated_message_scalar_value_types_decode_inner));
+}
+
+int repeated_message_scalar_value_types_int32s_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->int32s,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_int64s_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    int64_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->int64s,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_sint32s_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->sint32s,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_sint64s_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    int64_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->sint64s,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_uint32s_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    uint32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->uint32s,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_uint64s_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    uint64_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->uint64s,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_fixed32s_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    uint32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->fixed32s,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_fixed64s_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    uint64_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->fixed64s,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_sfixed32s_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->sfixed32s,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_sfixed64s_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    int64_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->sfixed64s,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_floats_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    float *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->floats,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_doubles_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    double *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->doubles,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_bools_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    bool *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->bools,
+                items_p,
+                capacity));
+}
+
+void repeated_message_scalar_value_types_packed_init(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
     struct pbtools_heap_t *heap_p)
 {
     self_p->base.heap_p = heap_p;
@@ -1193,9 +1793,9 @@ void repeated_message_scalar_value_types_not_packed_init(
     self_p->bytess.length = 0;
 }
 
-void repeated_message_scalar_value_types_not_packed_encode_inner(
+void repeated_message_scalar_value_types_packed_encode_inner(
     struct pbtools_encoder_t *encoder_p,
-    struct repeated_message_scalar_value_types_not_packed_t *self_p)
+    struct repeated_message_scalar_value_types_packed_t *self_p)
 {
     pbtools_encoder_write_repeated_bytes(encoder_p, 15, &self_p->bytess);
     pbtools_encoder_write_repeated_string(encoder_p, 14, &self_p->strings);
@@ -1214,10 +1814,11 @@ void repeated_message_scalar_value_types_not_packed_encode_inner(
     pbtools_encoder_write_repeated_int32(encoder_p, 1, &self_p->int32s);
 }
 
-void repeated_message_scalar_value_types_not_packed_decode_inner(
+void repeated_message_scalar_value_types_packed_decode_inner(
     struct pbtools_decoder_t *decoder_p,
-    struct repeated_message_scalar_value_types_not_packed_t *self_p)
+    struct repeated_message_scalar_value_types_packed_t *self_p)
 {
+    uint32_t key;
     int wire_type;
     struct pbtools_repeated_info_t repeated_info_int32s;
     struct pbtools_repeated_info_t repeated_info_int64s;
@@ -1252,115 +1853,353 @@ void repeated_message_scalar_value_types_not_packed_decode_inner(
     pbtools_repeated_info_init(&repeated_info_bytess, 15);
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_int32s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
 
-        case 1:
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_2;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
             pbtools_repeated_info_decode_int32(
                 &repeated_info_int32s,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_2:
+            pbtools_repeated_info_decode_int64(
+                &repeated_info_int64s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_3;
+            }
+
             break;
 
-        case 2:
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
             pbtools_repeated_info_decode_int64(
                 &repeated_info_int64s,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_3:
+            pbtools_repeated_info_decode_sint32(
+                &repeated_info_sint32s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_4;
+            }
+
             break;
 
-        case 3:
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_VARINT):
             pbtools_repeated_info_decode_sint32(
                 &repeated_info_sint32s,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_4:
+            pbtools_repeated_info_decode_sint64(
+                &repeated_info_sint64s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  5,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_5;
+            }
+
             break;
 
-        case 4:
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_VARINT):
             pbtools_repeated_info_decode_sint64(
                 &repeated_info_sint64s,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
             break;
 
-        case 5:
+        case PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_5:
             pbtools_repeated_info_decode_uint32(
                 &repeated_info_uint32s,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  6,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_6;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_uint32(
+                &repeated_info_uint32s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_6:
+            pbtools_repeated_info_decode_uint64(
+                &repeated_info_uint64s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  7,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_7;
+            }
+
             break;
 
-        case 6:
+        case PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_VARINT):
             pbtools_repeated_info_decode_uint64(
                 &repeated_info_uint64s,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
             break;
 
-        case 7:
+        case PBTOOLS_KEY(7, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_7:
             pbtools_repeated_info_decode_fixed32(
                 &repeated_info_fixed32s,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  8,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_8;
+            }
+
             break;
 
-        case 8:
+        case PBTOOLS_KEY(7, PBTOOLS_WIRE_TYPE_32_BIT):
+            pbtools_repeated_info_decode_fixed32(
+                &repeated_info_fixed32s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_32_BIT);
+            break;
+
+        case PBTOOLS_KEY(8, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_8:
+            pbtools_repeated_info_decode_fixed64(
+                &repeated_info_fixed64s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  9,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_9;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(8, PBTOOLS_WIRE_TYPE_64_BIT):
             pbtools_repeated_info_decode_fixed64(
                 &repeated_info_fixed64s,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_64_BIT);
+            break;
+
+        case PBTOOLS_KEY(9, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_9:
+            pbtools_repeated_info_decode_sfixed32(
+                &repeated_info_sfixed32s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  10,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_10;
+            }
+
             break;
 
-        case 9:
+        case PBTOOLS_KEY(9, PBTOOLS_WIRE_TYPE_32_BIT):
             pbtools_repeated_info_decode_sfixed32(
                 &repeated_info_sfixed32s,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_32_BIT);
+            break;
+
+        case PBTOOLS_KEY(10, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_10:
+            pbtools_repeated_info_decode_sfixed64(
+                &repeated_info_sfixed64s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  11,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_11;
+            }
+
             break;
 
-        case 10:
+        case PBTOOLS_KEY(10, PBTOOLS_WIRE_TYPE_64_BIT):
             pbtools_repeated_info_decode_sfixed64(
                 &repeated_info_sfixed64s,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_64_BIT);
+            break;
+
+        case PBTOOLS_KEY(11, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_11:
+            pbtools_repeated_info_decode_float(
+                &repeated_info_floats,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  12,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_12;
+            }
+
             break;
 
-        case 11:
+        case PBTOOLS_KEY(11, PBTOOLS_WIRE_TYPE_32_BIT):
             pbtools_repeated_info_decode_float(
                 &repeated_info_floats,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_32_BIT);
+            break;
+
+        case PBTOOLS_KEY(12, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_12:
+            pbtools_repeated_info_decode_double(
+                &repeated_info_doubles,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  13,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_13;
+            }
+
             break;
 
-        case 12:
+        case PBTOOLS_KEY(12, PBTOOLS_WIRE_TYPE_64_BIT):
             pbtools_repeated_info_decode_double(
                 &repeated_info_doubles,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_64_BIT);
             break;
 
-        case 13:
+        case PBTOOLS_KEY(13, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_13:
             pbtools_repeated_info_decode_bool(
                 &repeated_info_bools,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  14,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_14;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(13, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_bool(
+                &repeated_info_bools,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
             break;
 
-        case 14:
+        case PBTOOLS_KEY(14, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_14:
             pbtools_repeated_info_decode_string(
                 &repeated_info_strings,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  14,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_14;
+            }
+
             break;
 
-        case 15:
+        case PBTOOLS_KEY(15, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_15:
             pbtools_repeated_info_decode_bytes(
                 &repeated_info_bytess,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  15,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_15;
+            }
+
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+            case 7:
+            case 8:
+            case 9:
+            case 10:
+            case 11:
+            case 12:
+            case 13:
+            case 14:
+            case 15:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -1427,8 +2266,8 @@ void repeated_message_scalar_value_types_not_packed_decode_inner(
         &self_p->bytess);
 }
 
-int repeated_message_scalar_value_types_not_packed_int32s_alloc(
-    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+int repeated_message_scalar_value_types_packed_int32s_alloc(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
     int length)
 {
     return (pbtools_alloc_repeated_int32(
@@ -1437,8 +2276,8 @@ int repeated_message_scalar_value_types_not_packed_int32s_alloc(
                 &self_p->int32s));
 }
 
-int repeated_message_scalar_value_types_not_packed_int64s_alloc(
-    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+int repeated_message_scalar_value_types_packed_int64s_alloc(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
     int length)
 {
     return (pbtools_alloc_repeated_int64(
@@ -1447,8 +2286,8 @@ int repeated_message_scalar_value_types_not_packed_int64s_alloc(
                 &self_p->int64s));
 }
 
-int repeated_message_scalar_value_types_not_packed_sint32s_alloc(
-    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+int repeated_message_scalar_value_types_packed_sint32s_alloc(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
     int length)
 {
     return (pbtools_alloc_repeated_sint32(
@@ -1457,8 +2296,8 @@ int repeated_message_scalar_value_types_not_packed_sint32s_alloc(
                 &self_p->sint32s));
 }
 
-int repeated_message_scalar_value_types_not_packed_sint64s_alloc(
-    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+int repeated_message_scalar_value_types_packed_sint64s_alloc(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
     int length)
 {
     return (pbtools_alloc_repeated_sint64(
@@ -1467,8 +2306,8 @@ int repeated_message_scalar_value_types_not_packed_sint64s_alloc(
                 &self_p->sint64s));
 }
 
-int repeated_message_scalar_value_types_not_packed_uint32s_alloc(
-    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+int repeated_message_scalar_value_types_packed_uint32s_alloc(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
     int length)
 {
     return (pbtools_alloc_repeated_uint32(
@@ -1477,167 +2316,2105 @@ int repeated_message_scalar_value_types_not_packed_uint32s_alloc(
                 &self_p->uint32s));
 }
 
-int repeated_message_scalar_value_types_not_packed_uint64s_alloc(
-    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+int repeated_message_scalar_value_types_packed_uint64s_alloc(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_uint64(
+                &self_p->base,
+                length,
+                &self_p->uint64s));
+}
+
+int repeated_message_scalar_value_types_packed_fixed32s_alloc(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_fixed32(
+                &self_p->base,
+                length,
+                &self_p->fixed32s));
+}
+
+int repeated_message_scalar_value_types_packed_fixed64s_alloc(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_fixed64(
+                &self_p->base,
+                length,
+                &self_p->fixed64s));
+}
+
+int repeated_message_scalar_value_types_packed_sfixed32s_alloc(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_sfixed32(
+                &self_p->base,
+                length,
+                &self_p->sfixed32s));
+}
+
+int repeated_message_scalar_value_types_packed_sfixed64s_alloc(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_sfixed64(
+                &self_p->base,
+                length,
+                &self_p->sfixed64s));
+}
+
+int repeated_message_scalar_value_types_packed_floats_alloc(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_float(
+                &self_p->base,
+                length,
+                &self_p->floats));
+}
+
+int repeated_message_scalar_value_types_packed_doubles_alloc(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_double(
+                &self_p->base,
+                length,
+                &self_p->doubles));
+}
+
+int repeated_message_scalar_value_types_packed_bools_alloc(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_bool(
+                &self_p->base,
+                length,
+                &self_p->bools));
+}
+
+int repeated_message_scalar_value_types_packed_strings_alloc(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_string(
+                &self_p->base,
+                length,
+                &self_p->strings));
+}
+
+int repeated_message_scalar_value_types_packed_bytess_alloc(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
     int length)
 {
-    return (pbtools_alloc_repeated_uint64(
+    return (pbtools_alloc_repeated_bytes(
+                &self_p->base,
+                length,
+                &self_p->bytess));
+}
+
+void repeated_message_scalar_value_types_packed_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct repeated_message_scalar_value_types_packed_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        repeated_message_scalar_value_types_packed_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void repeated_message_scalar_value_types_packed_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct repeated_message_scalar_value_types_packed_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct repeated_message_scalar_value_types_packed_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        repeated_message_scalar_value_types_packed_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        repeated_message_scalar_value_types_packed_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t repeated_message_scalar_value_types_packed_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 2, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 3, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 4, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 5, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 6, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 7, PBTOOLS_WIRE_TYPE_32_BIT, true },
+    { 8, PBTOOLS_WIRE_TYPE_64_BIT, true },
+    { 9, PBTOOLS_WIRE_TYPE_32_BIT, true },
+    { 10, PBTOOLS_WIRE_TYPE_64_BIT, true },
+    { 11, PBTOOLS_WIRE_TYPE_32_BIT, true },
+    { 12, PBTOOLS_WIRE_TYPE_64_BIT, true },
+    { 13, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 14, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, true },
+    { 15, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, true }
+};
+
+void repeated_message_scalar_value_types_packed_view_init(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &repeated_message_scalar_value_types_packed_view_fields[0],
+                      15,
+                      &self_p->offsets[0]);
+}
+
+int repeated_message_scalar_value_types_packed_view_error(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+void repeated_message_scalar_value_types_packed_view_int32s_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 0);
+}
+
+bool repeated_message_scalar_value_types_packed_view_int32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_packed_view_int64s_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 1);
+}
+
+bool repeated_message_scalar_value_types_packed_view_int64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int64_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int64_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_packed_view_sint32s_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 2);
+}
+
+bool repeated_message_scalar_value_types_packed_view_sint32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_sint32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_packed_view_sint64s_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 3);
+}
+
+bool repeated_message_scalar_value_types_packed_view_sint64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int64_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_sint64_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_packed_view_uint32s_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 4);
+}
+
+bool repeated_message_scalar_value_types_packed_view_uint32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_uint32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_packed_view_uint64s_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 5);
+}
+
+bool repeated_message_scalar_value_types_packed_view_uint64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint64_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_uint64_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_packed_view_fixed32s_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 6);
+}
+
+bool repeated_message_scalar_value_types_packed_view_fixed32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_fixed32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_packed_view_fixed64s_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 7);
+}
+
+bool repeated_message_scalar_value_types_packed_view_fixed64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint64_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_fixed64_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_packed_view_sfixed32s_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 8);
+}
+
+bool repeated_message_scalar_value_types_packed_view_sfixed32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_sfixed32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_packed_view_sfixed64s_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 9);
+}
+
+bool repeated_message_scalar_value_types_packed_view_sfixed64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int64_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_sfixed64_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_packed_view_floats_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 10);
+}
+
+bool repeated_message_scalar_value_types_packed_view_floats_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    float *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_float_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_packed_view_doubles_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 11);
+}
+
+bool repeated_message_scalar_value_types_packed_view_doubles_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    double *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_double_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_packed_view_bools_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 12);
+}
+
+bool repeated_message_scalar_value_types_packed_view_bools_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    bool *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_bool_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_packed_view_strings_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 13);
+}
+
+bool repeated_message_scalar_value_types_packed_view_strings_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct pbtools_bytes_t *value_p)
+{{
+    if (!pbtools_view_iterator_next(iterator_p)) {{
+        return (false);
+    }}
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, value_p);
+
+    return (true);
+}}
+
+void repeated_message_scalar_value_types_packed_view_bytess_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 14);
+}
+
+bool repeated_message_scalar_value_types_packed_view_bytess_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct pbtools_bytes_t *value_p)
+{{
+    if (!pbtools_view_iterator_next(iterator_p)) {{
+        return (false);
+    }}
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, value_p);
+
+    return (true);
+}}
+
+struct repeated_message_scalar_value_types_packed_t *
+repeated_message_scalar_value_types_packed_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct repeated_message_scalar_value_types_packed_t),
+                (pbtools_message_init_t)repeated_message_scalar_value_types_packed_init));
+}
+
+int repeated_message_scalar_value_types_packed_encode(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)repeated_message_scalar_value_types_packed_encode_inner));
+}
+
+int repeated_message_scalar_value_types_packed_decode(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)repeated_message_scalar_value_types_packed_decode_inner));
+}
+
+int repeated_message_scalar_value_types_packed_decode_segments(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)repeated_message_scalar_value_types_packed_decode_inner));
+}
+
+int repeated_message_scalar_value_types_packed_int32s_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->int32s,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_packed_int64s_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    int64_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->int64s,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_packed_sint32s_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->sint32s,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_packed_sint64s_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    int64_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->sint64s,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_packed_uint32s_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    uint32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->uint32s,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_packed_uint64s_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    uint64_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->uint64s,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_packed_fixed32s_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    uint32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->fixed32s,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_packed_fixed64s_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    uint64_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->fixed64s,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_packed_sfixed32s_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->sfixed32s,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_packed_sfixed64s_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    int64_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->sfixed64s,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_packed_floats_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    float *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->floats,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_packed_doubles_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    double *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->doubles,
+                items_p,
+                capacity));
+}
+
+int repeated_message_scalar_value_types_packed_bools_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    bool *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->bools,
+                items_p,
+                capacity));
+}
+
+void repeated_message_scalar_value_types_not_packed_init(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->int32s.length = 0;
+    self_p->int64s.length = 0;
+    self_p->sint32s.length = 0;
+    self_p->sint64s.length = 0;
+    self_p->uint32s.length = 0;
+    self_p->uint64s.length = 0;
+    self_p->fixed32s.length = 0;
+    self_p->fixed64s.length = 0;
+    self_p->sfixed32s.length = 0;
+    self_p->sfixed64s.length = 0;
+    self_p->floats.length = 0;
+    self_p->doubles.length = 0;
+    self_p->bools.length = 0;
+    self_p->strings.length = 0;
+    self_p->bytess.length = 0;
+}
+
+void repeated_message_scalar_value_types_not_packed_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct repeated_message_scalar_value_types_not_packed_t *self_p)
+{
+    pbtools_encoder_write_repeated_bytes(encoder_p, 15, &self_p->bytess);
+    pbtools_encoder_write_repeated_string(encoder_p, 14, &self_p->strings);
+    pbtools_encoder_write_repeated_bool(encoder_p, 13, &self_p->bools);
+    pbtools_encoder_write_repeated_double(encoder_p, 12, &self_p->doubles);
+    pbtools_encoder_write_repeated_float(encoder_p, 11, &self_p->floats);
+    pbtools_encoder_write_repeated_sfixed64(encoder_p, 10, &self_p->sfixed64s);
+    pbtools_encoder_write_repeated_sfixed32(encoder_p, 9, &self_p->sfixed32s);
+    pbtools_encoder_write_repeated_fixed64(encoder_p, 8, &self_p->fixed64s);
+    pbtools_encoder_write_repeated_fixed32(encoder_p, 7, &self_p->fixed32s);
+    pbtools_encoder_write_repeated_uint64(encoder_p, 6, &self_p->uint64s);
+    pbtools_encoder_write_repeated_uint32(encoder_p, 5, &self_p->uint32s);
+    pbtools_encoder_write_repeated_sint64(encoder_p, 4, &self_p->sint64s);
+    pbtools_encoder_write_repeated_sint32(encoder_p, 3, &self_p->sint32s);
+    pbtools_encoder_write_repeated_int64(encoder_p, 2, &self_p->int64s);
+    pbtools_encoder_write_repeated_int32(encoder_p, 1, &self_p->int32s);
+}
+
+void repeated_message_scalar_value_types_not_packed_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct repeated_message_scalar_value_types_not_packed_t *self_p)
+{
+    uint32_t key;
+    int wire_type;
+    struct pbtools_repeated_info_t repeated_info_int32s;
+    struct pbtools_repeated_info_t repeated_info_int64s;
+    struct pbtools_repeated_info_t repeated_info_sint32s;
+    struct pbtools_repeated_info_t repeated_info_sint64s;
+    struct pbtools_repeated_info_t repeated_info_uint32s;
+    struct pbtools_repeated_info_t repeated_info_uint64s;
+    struct pbtools_repeated_info_t repeated_info_fixed32s;
+    struct pbtools_repeated_info_t repeated_info_fixed64s;
+    struct pbtools_repeated_info_t repeated_info_sfixed32s;
+    struct pbtools_repeated_info_t repeated_info_sfixed64s;
+    struct pbtools_repeated_info_t repeated_info_floats;
+    struct pbtools_repeated_info_t repeated_info_doubles;
+    struct pbtools_repeated_info_t repeated_info_bools;
+    struct pbtools_repeated_info_t repeated_info_strings;
+    struct pbtools_repeated_info_t repeated_info_bytess;
+
+    pbtools_repeated_info_init(&repeated_info_int32s, 1);
+    pbtools_repeated_info_init(&repeated_info_int64s, 2);
+    pbtools_repeated_info_init(&repeated_info_sint32s, 3);
+    pbtools_repeated_info_init(&repeated_info_sint64s, 4);
+    pbtools_repeated_info_init(&repeated_info_uint32s, 5);
+    pbtools_repeated_info_init(&repeated_info_uint64s, 6);
+    pbtools_repeated_info_init(&repeated_info_fixed32s, 7);
+    pbtools_repeated_info_init(&repeated_info_fixed64s, 8);
+    pbtools_repeated_info_init(&repeated_info_sfixed32s, 9);
+    pbtools_repeated_info_init(&repeated_info_sfixed64s, 10);
+    pbtools_repeated_info_init(&repeated_info_floats, 11);
+    pbtools_repeated_info_init(&repeated_info_doubles, 12);
+    pbtools_repeated_info_init(&repeated_info_bools, 13);
+    pbtools_repeated_info_init(&repeated_info_strings, 14);
+    pbtools_repeated_info_init(&repeated_info_bytess, 15);
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_int32s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_2;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_int32s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_2:
+            pbtools_repeated_info_decode_int64(
+                &repeated_info_int64s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_3;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_int64(
+                &repeated_info_int64s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_3:
+            pbtools_repeated_info_decode_sint32(
+                &repeated_info_sint32s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_4;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_sint32(
+                &repeated_info_sint32s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_4:
+            pbtools_repeated_info_decode_sint64(
+                &repeated_info_sint64s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  5,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_5;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_sint64(
+                &repeated_info_sint64s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_5:
+            pbtools_repeated_info_decode_uint32(
+                &repeated_info_uint32s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  6,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_6;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_uint32(
+                &repeated_info_uint32s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_6:
+            pbtools_repeated_info_decode_uint64(
+                &repeated_info_uint64s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  7,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_7;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_uint64(
+                &repeated_info_uint64s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(7, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_7:
+            pbtools_repeated_info_decode_fixed32(
+                &repeated_info_fixed32s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  8,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_8;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(7, PBTOOLS_WIRE_TYPE_32_BIT):
+            pbtools_repeated_info_decode_fixed32(
+                &repeated_info_fixed32s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_32_BIT);
+            break;
+
+        case PBTOOLS_KEY(8, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_8:
+            pbtools_repeated_info_decode_fixed64(
+                &repeated_info_fixed64s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  9,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_9;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(8, PBTOOLS_WIRE_TYPE_64_BIT):
+            pbtools_repeated_info_decode_fixed64(
+                &repeated_info_fixed64s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_64_BIT);
+            break;
+
+        case PBTOOLS_KEY(9, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_9:
+            pbtools_repeated_info_decode_sfixed32(
+                &repeated_info_sfixed32s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  10,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_10;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(9, PBTOOLS_WIRE_TYPE_32_BIT):
+            pbtools_repeated_info_decode_sfixed32(
+                &repeated_info_sfixed32s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_32_BIT);
+            break;
+
+        case PBTOOLS_KEY(10, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_10:
+            pbtools_repeated_info_decode_sfixed64(
+                &repeated_info_sfixed64s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  11,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_11;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(10, PBTOOLS_WIRE_TYPE_64_BIT):
+            pbtools_repeated_info_decode_sfixed64(
+                &repeated_info_sfixed64s,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_64_BIT);
+            break;
+
+        case PBTOOLS_KEY(11, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_11:
+            pbtools_repeated_info_decode_float(
+                &repeated_info_floats,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  12,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_12;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(11, PBTOOLS_WIRE_TYPE_32_BIT):
+            pbtools_repeated_info_decode_float(
+                &repeated_info_floats,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_32_BIT);
+            break;
+
+        case PBTOOLS_KEY(12, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_12:
+            pbtools_repeated_info_decode_double(
+                &repeated_info_doubles,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  13,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_13;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(12, PBTOOLS_WIRE_TYPE_64_BIT):
+            pbtools_repeated_info_decode_double(
+                &repeated_info_doubles,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_64_BIT);
+            break;
+
+        case PBTOOLS_KEY(13, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_13:
+            pbtools_repeated_info_decode_bool(
+                &repeated_info_bools,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  14,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_14;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(13, PBTOOLS_WIRE_TYPE_VARINT):
+            pbtools_repeated_info_decode_bool(
+                &repeated_info_bools,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_VARINT);
+            break;
+
+        case PBTOOLS_KEY(14, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_14:
+            pbtools_repeated_info_decode_string(
+                &repeated_info_strings,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  14,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_14;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(15, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_15:
+            pbtools_repeated_info_decode_bytes(
+                &repeated_info_bytess,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  15,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_15;
+            }
+
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+            case 7:
+            case 8:
+            case 9:
+            case 10:
+            case 11:
+            case 12:
+            case 13:
+            case 14:
+            case 15:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+
+    pbtools_decoder_decode_repeated_int32(
+        decoder_p,
+        &repeated_info_int32s,
+        &self_p->int32s);
+    pbtools_decoder_decode_repeated_int64(
+        decoder_p,
+        &repeated_info_int64s,
+        &self_p->int64s);
+    pbtools_decoder_decode_repeated_sint32(
+        decoder_p,
+        &repeated_info_sint32s,
+        &self_p->sint32s);
+    pbtools_decoder_decode_repeated_sint64(
+        decoder_p,
+        &repeated_info_sint64s,
+        &self_p->sint64s);
+    pbtools_decoder_decode_repeated_uint32(
+        decoder_p,
+        &repeated_info_uint32s,
+        &self_p->uint32s);
+    pbtools_decoder_decode_repeated_uint64(
+        decoder_p,
+        &repeated_info_uint64s,
+        &self_p->uint64s);
+    pbtools_decoder_decode_repeated_fixed32(
+        decoder_p,
+        &repeated_info_fixed32s,
+        &self_p->fixed32s);
+    pbtools_decoder_decode_repeated_fixed64(
+        decoder_p,
+        &repeated_info_fixed64s,
+        &self_p->fixed64s);
+    pbtools_decoder_decode_repeated_sfixed32(
+        decoder_p,
+        &repeated_info_sfixed32s,
+        &self_p->sfixed32s);
+    pbtools_decoder_decode_repeated_sfixed64(
+        decoder_p,
+        &repeated_info_sfixed64s,
+        &self_p->sfixed64s);
+    pbtools_decoder_decode_repeated_float(
+        decoder_p,
+        &repeated_info_floats,
+        &self_p->floats);
+    pbtools_decoder_decode_repeated_double(
+        decoder_p,
+        &repeated_info_doubles,
+        &self_p->doubles);
+    pbtools_decoder_decode_repeated_bool(
+        decoder_p,
+        &repeated_info_bools,
+        &self_p->bools);
+    pbtools_decoder_decode_repeated_string(
+        decoder_p,
+        &repeated_info_strings,
+        &self_p->strings);
+    pbtools_decoder_decode_repeated_bytes(
+        decoder_p,
+        &repeated_info_bytess,
+        &self_p->bytess);
+}
+
+int repeated_message_scalar_value_types_not_packed_int32s_alloc(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->int32s));
+}
+
+int repeated_message_scalar_value_types_not_packed_int64s_alloc(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int64(
+                &self_p->base,
+                length,
+                &self_p->int64s));
+}
+
+int repeated_message_scalar_value_types_not_packed_sint32s_alloc(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_sint32(
+                &self_p->base,
+                length,
+                &self_p->sint32s));
+}
+
+int repeated_message_scalar_value_types_not_packed_sint64s_alloc(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_sint64(
+                &self_p->base,
+                length,
+                &self_p->sint64s));
+}
+
+int repeated_message_scalar_value_types_not_packed_uint32s_alloc(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_uint32(
+                &self_p->base,
+                length,
+                &self_p->uint32s));
+}
+
+int repeated_message_scalar_value_types_not_packed_uint64s_alloc(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_uint64(
+                &self_p->base,
+                length,
+                &self_p->uint64s));
+}
+
+int repeated_message_scalar_value_types_not_packed_fixed32s_alloc(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_fixed32(
+                &self_p->base,
+                length,
+                &self_p->fixed32s));
+}
+
+int repeated_message_scalar_value_types_not_packed_fixed64s_alloc(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_fixed64(
+                &self_p->base,
+                length,
+                &self_p->fixed64s));
+}
+
+int repeated_message_scalar_value_types_not_packed_sfixed32s_alloc(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_sfixed32(
+                &self_p->base,
+                length,
+                &self_p->sfixed32s));
+}
+
+int repeated_message_scalar_value_types_not_packed_sfixed64s_alloc(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_sfixed64(
+                &self_p->base,
+                length,
+                &self_p->sfixed64s));
+}
+
+int repeated_message_scalar_value_types_not_packed_floats_alloc(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_float(
+                &self_p->base,
+                length,
+                &self_p->floats));
+}
+
+int repeated_message_scalar_value_types_not_packed_doubles_alloc(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_double(
+                &self_p->base,
+                length,
+                &self_p->doubles));
+}
+
+int repeated_message_scalar_value_types_not_packed_bools_alloc(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_bool(
+                &self_p->base,
+                length,
+                &self_p->bools));
+}
+
+int repeated_message_scalar_value_types_not_packed_strings_alloc(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_string(
+                &self_p->base,
+                length,
+                &self_p->strings));
+}
+
+int repeated_message_scalar_value_types_not_packed_bytess_alloc(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_bytes(
+                &self_p->base,
+                length,
+                &self_p->bytess));
+}
+
+void repeated_message_scalar_value_types_not_packed_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct repeated_message_scalar_value_types_not_packed_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        repeated_message_scalar_value_types_not_packed_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void repeated_message_scalar_value_types_not_packed_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct repeated_message_scalar_value_types_not_packed_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct repeated_message_scalar_value_types_not_packed_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        repeated_message_scalar_value_types_not_packed_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        repeated_message_scalar_value_types_not_packed_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t repeated_message_scalar_value_types_not_packed_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 2, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 3, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 4, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 5, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 6, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 7, PBTOOLS_WIRE_TYPE_32_BIT, true },
+    { 8, PBTOOLS_WIRE_TYPE_64_BIT, true },
+    { 9, PBTOOLS_WIRE_TYPE_32_BIT, true },
+    { 10, PBTOOLS_WIRE_TYPE_64_BIT, true },
+    { 11, PBTOOLS_WIRE_TYPE_32_BIT, true },
+    { 12, PBTOOLS_WIRE_TYPE_64_BIT, true },
+    { 13, PBTOOLS_WIRE_TYPE_VARINT, true },
+    { 14, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, true },
+    { 15, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, true }
+};
+
+void repeated_message_scalar_value_types_not_packed_view_init(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &repeated_message_scalar_value_types_not_packed_view_fields[0],
+                      15,
+                      &self_p->offsets[0]);
+}
+
+int repeated_message_scalar_value_types_not_packed_view_error(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+void repeated_message_scalar_value_types_not_packed_view_int32s_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 0);
+}
+
+bool repeated_message_scalar_value_types_not_packed_view_int32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_not_packed_view_int64s_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 1);
+}
+
+bool repeated_message_scalar_value_types_not_packed_view_int64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int64_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_int64_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_not_packed_view_sint32s_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 2);
+}
+
+bool repeated_message_scalar_value_types_not_packed_view_sint32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_sint32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_not_packed_view_sint64s_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 3);
+}
+
+bool repeated_message_scalar_value_types_not_packed_view_sint64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int64_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_sint64_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_not_packed_view_uint32s_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 4);
+}
+
+bool repeated_message_scalar_value_types_not_packed_view_uint32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_uint32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_not_packed_view_uint64s_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 5);
+}
+
+bool repeated_message_scalar_value_types_not_packed_view_uint64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint64_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_uint64_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_not_packed_view_fixed32s_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 6);
+}
+
+bool repeated_message_scalar_value_types_not_packed_view_fixed32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_fixed32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_not_packed_view_fixed64s_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 7);
+}
+
+bool repeated_message_scalar_value_types_not_packed_view_fixed64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint64_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_fixed64_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_not_packed_view_sfixed32s_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 8);
+}
+
+bool repeated_message_scalar_value_types_not_packed_view_sfixed32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_sfixed32_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_not_packed_view_sfixed64s_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 9);
+}
+
+bool repeated_message_scalar_value_types_not_packed_view_sfixed64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int64_t *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_sfixed64_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_not_packed_view_floats_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 10);
+}
+
+bool repeated_message_scalar_value_types_not_packed_view_floats_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    float *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_float_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_not_packed_view_doubles_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 11);
+}
+
+bool repeated_message_scalar_value_types_not_packed_view_doubles_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    double *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_double_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_not_packed_view_bools_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 12);
+}
+
+bool repeated_message_scalar_value_types_not_packed_view_bools_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    bool *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = pbtools_decoder_read_bool_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+void repeated_message_scalar_value_types_not_packed_view_strings_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 13);
+}
+
+bool repeated_message_scalar_value_types_not_packed_view_strings_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct pbtools_bytes_t *value_p)
+{{
+    if (!pbtools_view_iterator_next(iterator_p)) {{
+        return (false);
+    }}
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, value_p);
+
+    return (true);
+}}
+
+void repeated_message_scalar_value_types_not_packed_view_bytess_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 14);
+}
+
+bool repeated_message_scalar_value_types_not_packed_view_bytess_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct pbtools_bytes_t *value_p)
+{{
+    if (!pbtools_view_iterator_next(iterator_p)) {{
+        return (false);
+    }}
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, value_p);
+
+    return (true);
+}}
+
+struct repeated_message_scalar_value_types_not_packed_t *
+repeated_message_scalar_value_types_not_packed_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct repeated_message_scalar_value_types_not_packed_t),
+                (pbtools_message_init_t)repeated_message_scalar_value_types_not_packed_init));
+}
+
+int repeated_message_scalar_value_types_not_packed_encode(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)repeated_message_scalar_value_types_not_packed_encode_inner));
+}
+
+int repeated_message_scalar_value_types_not_packed_decode(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
                 &self_p->base,
-                length,
-                &self_p->uint64s));
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)repeated_message_scalar_value_types_not_packed_decode_inner));
 }
 
-int repeated_message_scalar_value_types_not_packed_fixed32s_alloc(
+int repeated_message_scalar_value_types_not_packed_decode_segments(
     struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    const struct pbtools_segment_t *segments_p,
     int length)
 {
-    return (pbtools_alloc_repeated_fixed32(
+    return (pbtools_message_decode_segments(
                 &self_p->base,
+                segments_p,
                 length,
-                &self_p->fixed32s));
+                (pbtools_message_decode_inner_t)repeated_message_scalar_value_types_not_packed_decode_inner));
 }
 
-int repeated_message_scalar_value_types_not_packed_fixed64s_alloc(
+int repeated_message_scalar_value_types_not_packed_int32s_set_storage(
     struct repeated_message_scalar_value_types_not_packed_t *self_p,
-    int length)
+    int32_t *items_p,
+    int capacity)
 {
-    return (pbtools_alloc_repeated_fixed64(
+    return (pbtools_repeated_set_storage(
                 &self_p->base,
-                length,
-                &self_p->fixed64s));
+                (struct pbtools_repeated_message_t *)&self_p->int32s,
+                items_p,
+                capacity));
 }
 
-int repeated_message_scalar_value_types_not_packed_sfixed32s_alloc(
+int repeated_message_scalar_value_types_not_packed_int64s_set_storage(
     struct repeated_message_scalar_value_types_not_packed_t *self_p,
-    int length)
+    int64_t *items_p,
+    int capacity)
 {
-    return (pbtools_alloc_repeated_sfixed32(
+    return (pbtools_repeated_set_storage(
                 &self_p->base,
-                length,
-                &self_p->sfixed32s));
+                (struct pbtools_repeated_message_t *)&self_p->int64s,
+                items_p,
+                capacity));
 }
 
-int repeated_message_scalar_value_types_not_packed_sfixed64s_alloc(
+int repeated_message_scalar_value_types_not_packed_sint32s_set_storage(
     struct repeated_message_scalar_value_types_not_packed_t *self_p,
-    int length)
+    int32_t *items_p,
+    int capacity)
 {
-    return (pbtools_alloc_repeated_sfixed64(
+    return (pbtools_repeated_set_storage(
                 &self_p->base,
-                length,
-                &self_p->sfixed64s));
+                (struct pbtools_repeated_message_t *)&self_p->sint32s,
+                items_p,
+                capacity));
 }
 
-int repeated_message_scalar_value_types_not_packed_floats_alloc(
+int repeated_message_scalar_value_types_not_packed_sint64s_set_storage(
     struct repeated_message_scalar_value_types_not_packed_t *self_p,
-    int length)
+    int64_t *items_p,
+    int capacity)
 {
-    return (pbtools_alloc_repeated_float(
+    return (pbtools_repeated_set_storage(
                 &self_p->base,
-                length,
-                &self_p->floats));
+                (struct pbtools_repeated_message_t *)&self_p->sint64s,
+                items_p,
+                capacity));
 }
 
-int repeated_message_scalar_value_types_not_packed_doubles_alloc(
+int repeated_message_scalar_value_types_not_packed_uint32s_set_storage(
     struct repeated_message_scalar_value_types_not_packed_t *self_p,
-    int length)
+    uint32_t *items_p,
+    int capacity)
 {
-    return (pbtools_alloc_repeated_double(
+    return (pbtools_repeated_set_storage(
                 &self_p->base,
-                length,
-                &self_p->doubles));
+                (struct pbtools_repeated_message_t *)&self_p->uint32s,
+                items_p,
+                capacity));
 }
 
-int repeated_message_scalar_value_types_not_packed_bools_alloc(
+int repeated_message_scalar_value_types_not_packed_uint64s_set_storage(
     struct repeated_message_scalar_value_types_not_packed_t *self_p,
-    int length)
+    uint64_t *items_p,
+    int capacity)
 {
-    return (pbtools_alloc_repeated_bool(
+    return (pbtools_repeated_set_storage(
                 &self_p->base,
-                length,
-                &self_p->bools));
+                (struct pbtools_repeated_message_t *)&self_p->uint64s,
+                items_p,
+                capacity));
 }
 
-int repeated_message_scalar_value_types_not_packed_strings_alloc(
+int repeated_message_scalar_value_types_not_packed_fixed32s_set_storage(
     struct repeated_message_scalar_value_types_not_packed_t *self_p,
-    int length)
+    uint32_t *items_p,
+    int capacity)
 {
-    return (pbtools_alloc_repeated_string(
+    return (pbtools_repeated_set_storage(
                 &self_p->base,
-                length,
-                &self_p->strings));
+                (struct pbtools_repeated_message_t *)&self_p->fixed32s,
+                items_p,
+                capacity));
 }
 
-int repeated_message_scalar_value_types_not_packed_bytess_alloc(
+int repeated_message_scalar_value_types_not_packed_fixed64s_set_storage(
     struct repeated_message_scalar_value_types_not_packed_t *self_p,
-    int length)
+    uint64_t *items_p,
+    int capacity)
 {
-    return (pbtools_alloc_repeated_bytes(
+    return (pbtools_repeated_set_storage(
                 &self_p->base,
-                length,
-                &self_p->bytess));
+                (struct pbtools_repeated_message_t *)&self_p->fixed64s,
+                items_p,
+                capacity));
 }
 
-void repeated_message_scalar_value_types_not_packed_encode_repeated_inner(
-    struct pbtools_encoder_t *encoder_p,
-    int field_number,
-    struct repeated_message_scalar_value_types_not_packed_repeated_t *repeated_p)
+int repeated_message_scalar_value_types_not_packed_sfixed32s_set_storage(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int32_t *items_p,
+    int capacity)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct repeated_message_scalar_value_types_not_packed_t),
-        (pbtools_message_encode_inner_t)repeated_message_scalar_value_types_not_packed_encode_inner);
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->sfixed32s,
+                items_p,
+                capacity));
 }
 
-void repeated_message_scalar_value_types_not_packed_decode_repeated_inner(
-    struct pbtools_decoder_t *decoder_p,
-    struct pbtools_repeated_info_t *repeated_info_p,
-    struct repeated_message_scalar_value_types_not_packed_repeated_t *repeated_p)
+int repeated_message_scalar_value_types_not_packed_sfixed64s_set_storage(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int64_t *items_p,
+    int capacity)
 {
-    pbtools_decode_repeated_inner(
-        decoder_p,
-        repeated_info_p,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct repeated_message_scalar_value_types_not_packed_t),
-        (pbtools_message_init_t)repeated_message_scalar_value_types_not_packed_init,
-        (pbtools_message_decode_inner_t)repeated_message_scalar_value_types_not_packed_decode_inner);
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->sfixed64s,
+                items_p,
+                capacity));
 }
 
-struct repeated_message_scalar_value_types_not_packed_t *
-repeated_message_scalar_value_types_not_packed_new(
-    void *workspace_p,
-    size_t size)
+int repeated_message_scalar_value_types_not_packed_floats_set_storage(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    float *items_p,
+    int capacity)
 {
-    return (pbtools_message_new(
-                workspace_p,
-                size,
-                sizeof(struct repeated_message_scalar_value_types_not_packed_t),
-                (pbtools_message_init_t)repeated_message_scalar_value_types_not_packed_init));
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->floats,
+                items_p,
+                capacity));
 }
 
-int repeated_message_scalar_value_types_not_packed_encode(
+int repeated_message_scalar_value_types_not_packed_doubles_set_storage(
     struct repeated_message_scalar_value_types_not_packed_t *self_p,
-    uint8_t *encoded_p,
-    size_t size)
+    double *items_p,
+    int capacity)
 {
-    return (pbtools_message_encode(
+    return (pbtools_repeated_set_storage(
                 &self_p->base,
-                encoded_p,
-                size,
-                (pbtools_message_encode_inner_t)repeated_message_scalar_value_types_not_packed_encode_inner));
+                (struct pbtools_repeated_message_t *)&self_p->doubles,
+                items_p,
+                capacity));
 }
 
-int repeated_message_scalar_value_types_not_packed_decode(
+int repeated_message_scalar_value_types_not_packed_bools_set_storage(
     struct repeated_message_scalar_value_types_not_packed_t *self_p,
-    const uint8_t *encoded_p,
-    size_t size)
+    bool *items_p,
+    int capacity)
 {
-    return (pbtools_message_decode(
+    return (pbtools_repeated_set_storage(
                 &self_p->base,
-                encoded_p,
-                size,
-                (pbtools_message_decode_inner_t)repeated_message_scalar_value_types_not_packed_decode_inner));
+                (struct pbtools_repeated_message_t *)&self_p->bools,
+                items_p,
+                capacity));
 }
 
 void repeated_foo_init(
@@ -1664,6 +4441,7 @@ void repeated_foo_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct repeated_foo_t *self_p)
 {
+    uint32_t key;
     int wire_type;
     struct pbtools_repeated_info_t repeated_info_messages;
     struct pbtools_repeated_info_t repeated_info_enums;
@@ -1672,23 +4450,53 @@ void repeated_foo_decode_inner(
     pbtools_repeated_info_init(&repeated_info_enums, 2);
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
 
-        case 1:
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_1:
             pbtools_repeated_info_decode(&repeated_info_messages,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_1;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_repeated_info_decode_int32(
+                &repeated_info_enums,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
             break;
 
-        case 2:
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
             pbtools_repeated_info_decode_int32(
                 &repeated_info_enums,
                 decoder_p,
-                wire_type);
+                PBTOOLS_WIRE_TYPE_VARINT);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -1730,12 +4538,14 @@ void repeated_foo_encode_repeated_inner(
     int field_number,
     struct repeated_foo_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct repeated_foo_t),
-        (pbtools_message_encode_inner_t)repeated_foo_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        repeated_foo_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void repeated_foo_decode_repeated_inner(
@@ -1743,13 +4553,104 @@ void repeated_foo_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct repeated_foo_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct repeated_foo_t),
-        (pbtools_message_init_t)repeated_foo_init,
-        (pbtools_message_decode_inner_t)repeated_foo_decode_inner);
+        sizeof(struct repeated_foo_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        repeated_foo_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        repeated_foo_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t repeated_foo_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, true },
+    { 2, PBTOOLS_WIRE_TYPE_VARINT, true }
+};
+
+void repeated_foo_view_init(
+    struct repeated_foo_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &repeated_foo_view_fields[0],
+                      2,
+                      &self_p->offsets[0]);
+}
+
+int repeated_foo_view_error(
+    struct repeated_foo_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+void repeated_foo_view_messages_begin(
+    struct repeated_foo_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 0);
+}
+
+bool repeated_foo_view_messages_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct repeated_message_view_t *value_p)
+{
+    struct pbtools_bytes_t value;
+
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, &value);
+    repeated_message_view_init(value_p, value.buf_p, value.size);
+
+    return (true);
+}
+
+void repeated_foo_view_enums_begin(
+    struct repeated_foo_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 1);
+}
+
+bool repeated_foo_view_enums_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    enum repeated_enum_e *value_p)
+{
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    *value_p = (enum repeated_enum_e)pbtools_decoder_read_enum_unchecked(&iterator_p->decoder);
+
+    /* Packed items are not validated by the scan. */
+    if (iterator_p->decoder.pos < 0) {
+        iterator_p->view_p->state = iterator_p->decoder.pos;
+
+        return (false);
+    }
+
+    return (true);
 }
 
 struct repeated_foo_t *
@@ -1788,6 +4689,30 @@ int repeated_foo_decode(
                 (pbtools_message_decode_inner_t)repeated_foo_decode_inner));
 }
 
+int repeated_foo_decode_segments(
+    struct repeated_foo_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)repeated_foo_decode_inner));
+}
+
+int repeated_foo_enums_set_storage(
+    struct repeated_foo_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->enums,
+                items_p,
+                capacity));
+}
+
 void repeated_bar_fie_init(
     struct repeated_bar_fie_t *self_p,
     struct pbtools_heap_t *heap_p)
@@ -1810,22 +4735,45 @@ void repeated_bar_fie_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct repeated_bar_fie_t *self_p)
 {
+    uint32_t key;
     int wire_type;
     struct pbtools_repeated_info_t repeated_info_inner_foos;
 
     pbtools_repeated_info_init(&repeated_info_inner_foos, 1);
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 1:
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_1:
             pbtools_repeated_info_decode(&repeated_info_inner_foos,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_1;
+            }
+
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -1853,12 +4801,14 @@ void repeated_bar_fie_encode_repeated_inner(
     int field_number,
     struct repeated_bar_fie_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct repeated_bar_fie_t),
-        (pbtools_message_encode_inner_t)repeated_bar_fie_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        repeated_bar_fie_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void repeated_bar_fie_decode_repeated_inner(
@@ -1866,13 +4816,76 @@ void repeated_bar_fie_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct repeated_bar_fie_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct repeated_bar_fie_t),
-        (pbtools_message_init_t)repeated_bar_fie_init,
-        (pbtools_message_decode_inner_t)repeated_bar_fie_decode_inner);
+        sizeof(struct repeated_bar_fie_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        repeated_bar_fie_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        repeated_bar_fie_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t repeated_bar_fie_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, true }
+};
+
+void repeated_bar_fie_view_init(
+    struct repeated_bar_fie_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &repeated_bar_fie_view_fields[0],
+                      1,
+                      &self_p->offsets[0]);
+}
+
+int repeated_bar_fie_view_error(
+    struct repeated_bar_fie_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+void repeated_bar_fie_view_inner_foos_begin(
+    struct repeated_bar_fie_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 0);
+}
+
+bool repeated_bar_fie_view_inner_foos_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct repeated_foo_view_t *value_p)
+{
+    struct pbtools_bytes_t value;
+
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, &value);
+    repeated_foo_view_init(value_p, value.buf_p, value.size);
+
+    return (true);
 }
 
 void repeated_bar_init(
@@ -1902,6 +4915,7 @@ void repeated_bar_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct repeated_bar_t *self_p)
 {
+    uint32_t key;
     int wire_type;
     struct pbtools_repeated_info_t repeated_info_foos;
     struct pbtools_repeated_info_t repeated_info_fies;
@@ -1910,22 +4924,53 @@ void repeated_bar_decode_inner(
     pbtools_repeated_info_init(&repeated_info_fies, 2);
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
 
-        case 1:
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_1:
             pbtools_repeated_info_decode(&repeated_info_foos,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  1,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_1;
+            }
+
             break;
 
-        case 2:
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_2:
             pbtools_repeated_info_decode(&repeated_info_fies,
                                          decoder_p,
-                                         wire_type);
+                                         PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_2;
+            }
+
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -1969,12 +5014,14 @@ void repeated_bar_encode_repeated_inner(
     int field_number,
     struct repeated_bar_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct repeated_bar_t),
-        (pbtools_message_encode_inner_t)repeated_bar_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        repeated_bar_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void repeated_bar_decode_repeated_inner(
@@ -1982,13 +5029,100 @@ void repeated_bar_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct repeated_bar_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct repeated_bar_t),
-        (pbtools_message_init_t)repeated_bar_init,
-        (pbtools_message_decode_inner_t)repeated_bar_decode_inner);
+        sizeof(struct repeated_bar_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        repeated_bar_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        repeated_bar_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+static const struct pbtools_view_field_t repeated_bar_view_fields[] = {
+    { 1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, true },
+    { 2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED, true }
+};
+
+void repeated_bar_view_init(
+    struct repeated_bar_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    pbtools_view_init(&self_p->base,
+                      encoded_p,
+                      size,
+                      &repeated_bar_view_fields[0],
+                      2,
+                      &self_p->offsets[0]);
+}
+
+int repeated_bar_view_error(
+    struct repeated_bar_view_t *self_p)
+{
+    return (pbtools_view_get_error(&self_p->base));
+}
+
+void repeated_bar_view_foos_begin(
+    struct repeated_bar_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 0);
+}
+
+bool repeated_bar_view_foos_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct repeated_foo_view_t *value_p)
+{
+    struct pbtools_bytes_t value;
+
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, &value);
+    repeated_foo_view_init(value_p, value.buf_p, value.size);
+
+    return (true);
+}
+
+void repeated_bar_view_fies_begin(
+    struct repeated_bar_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p)
+{
+    pbtools_view_iterator_init(iterator_p, &self_p->base, 1);
+}
+
+bool repeated_bar_view_fies_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct repeated_bar_fie_view_t *value_p)
+{
+    struct pbtools_bytes_t value;
+
+    if (!pbtools_view_iterator_next(iterator_p)) {
+        return (false);
+    }
+
+    pbtools_decoder_read_bytes_view_unchecked(&iterator_p->decoder, &value);
+    repeated_bar_fie_view_init(value_p, value.buf_p, value.size);
+
+    return (true);
 }
 
 struct repeated_bar_t *
@@ -2026,3 +5160,15 @@ int repeated_bar_decode(
                 size,
                 (pbtools_message_decode_inner_t)repeated_bar_decode_inner));
 }
+
+int repeated_bar_decode_segments(
+    struct repeated_bar_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)repeated_bar_decode_inner));
+}
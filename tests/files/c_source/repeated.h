@@ -61,6 +61,14 @@ struct repeated_message_t {
     struct pbtools_repeated_bytes_t bytes;
 };
 
+/**
+ * View of an encoded repeated.Message.
+ */
+struct repeated_message_view_t {
+    struct pbtools_view_t base;
+    int offsets[4];
+};
+
 /**
  * Message repeated.MessageScalarValueTypes.
  */
@@ -88,6 +96,14 @@ struct repeated_message_scalar_value_types_t {
     struct pbtools_repeated_bytes_t bytess;
 };
 
+/**
+ * View of an encoded repeated.MessageScalarValueTypes.
+ */
+struct repeated_message_scalar_value_types_view_t {
+    struct pbtools_view_t base;
+    int offsets[15];
+};
+
 /**
  * Message repeated.MessageScalarValueTypesPacked.
  */
@@ -115,6 +131,14 @@ struct repeated_message_scalar_value_types_packed_t {
     struct pbtools_repeated_bytes_t bytess;
 };
 
+/**
+ * View of an encoded repeated.MessageScalarValueTypesPacked.
+ */
+struct repeated_message_scalar_value_types_packed_view_t {
+    struct pbtools_view_t base;
+    int offsets[15];
+};
+
 /**
  * Message repeated.MessageScalarValueTypesNotPacked.
  */
@@ -142,6 +166,14 @@ struct repeated_message_scalar_value_types_not_packed_t {
     struct pbtools_repeated_bytes_t bytess;
 };
 
+/**
+ * View of an encoded repeated.MessageScalarValueTypesNotPacked.
+ */
+struct repeated_message_scalar_value_types_not_packed_view_t {
+    struct pbtools_view_t base;
+    int offsets[15];
+};
+
 /**
  * Message repeated.Foo.
  */
@@ -156,6 +188,14 @@ struct repeated_foo_t {
     struct pbtools_repeated_int32_t enums;
 };
 
+/**
+ * View of an encoded repeated.Foo.
+ */
+struct repeated_foo_view_t {
+    struct pbtools_view_t base;
+    int offsets[2];
+};
+
 /**
  * Message repeated.Bar.Fie.
  */
@@ -169,6 +209,14 @@ struct repeated_bar_fie_t {
     struct repeated_foo_repeated_t inner_foos;
 };
 
+/**
+ * View of an encoded repeated.Bar.Fie.
+ */
+struct repeated_bar_fie_view_t {
+    struct pbtools_view_t base;
+    int offsets[1];
+};
+
 /**
  * Message repeated.Bar.
  */
@@ -183,6 +231,14 @@ struct repeated_bar_t {
     struct repeated_bar_fie_repeated_t fies;
 };
 
+/**
+ * View of an encoded repeated.Bar.
+ */
+struct repeated_bar_view_t {
+    struct pbtools_view_t base;
+    int offsets[2];
+};
+
 int repeated_message_int32s_alloc(
     struct repeated_message_t *self_p,
     int length);
@@ -199,6 +255,49 @@ int repeated_message_bytes_alloc(
     struct repeated_message_t *self_p,
     int length);
 
+/**
+ * Fields of an encoded repeated.Message read on demand.
+ */
+void repeated_message_view_init(
+    struct repeated_message_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int repeated_message_view_error(
+    struct repeated_message_view_t *self_p);
+
+void repeated_message_view_int32s_begin(
+    struct repeated_message_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_view_int32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void repeated_message_view_messages_begin(
+    struct repeated_message_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_view_messages_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct repeated_message_view_t *value_p);
+
+void repeated_message_view_strings_begin(
+    struct repeated_message_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_view_strings_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct pbtools_bytes_t *value_p);
+
+void repeated_message_view_bytes_begin(
+    struct repeated_message_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_view_bytes_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct pbtools_bytes_t *value_p);
+
 /**
  * Encoding and decoding of repeated.Message.
  */
@@ -217,6 +316,16 @@ int repeated_message_decode(
     const uint8_t *encoded_p,
     size_t size);
 
+int repeated_message_decode_segments(
+    struct repeated_message_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+int repeated_message_int32s_set_storage(
+    struct repeated_message_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
 int repeated_message_scalar_value_types_int32s_alloc(
     struct repeated_message_scalar_value_types_t *self_p,
     int length);
@@ -277,6 +386,137 @@ int repeated_message_scalar_value_types_bytess_alloc(
     struct repeated_message_scalar_value_types_t *self_p,
     int length);
 
+/**
+ * Fields of an encoded repeated.MessageScalarValueTypes read on demand.
+ */
+void repeated_message_scalar_value_types_view_init(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int repeated_message_scalar_value_types_view_error(
+    struct repeated_message_scalar_value_types_view_t *self_p);
+
+void repeated_message_scalar_value_types_view_int32s_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_view_int32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void repeated_message_scalar_value_types_view_int64s_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_view_int64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int64_t *value_p);
+
+void repeated_message_scalar_value_types_view_sint32s_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_view_sint32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void repeated_message_scalar_value_types_view_sint64s_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_view_sint64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int64_t *value_p);
+
+void repeated_message_scalar_value_types_view_uint32s_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_view_uint32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint32_t *value_p);
+
+void repeated_message_scalar_value_types_view_uint64s_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_view_uint64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint64_t *value_p);
+
+void repeated_message_scalar_value_types_view_fixed32s_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_view_fixed32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint32_t *value_p);
+
+void repeated_message_scalar_value_types_view_fixed64s_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_view_fixed64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint64_t *value_p);
+
+void repeated_message_scalar_value_types_view_sfixed32s_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_view_sfixed32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void repeated_message_scalar_value_types_view_sfixed64s_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_view_sfixed64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int64_t *value_p);
+
+void repeated_message_scalar_value_types_view_floats_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_view_floats_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    float *value_p);
+
+void repeated_message_scalar_value_types_view_doubles_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_view_doubles_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    double *value_p);
+
+void repeated_message_scalar_value_types_view_bools_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_view_bools_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    bool *value_p);
+
+void repeated_message_scalar_value_types_view_strings_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_view_strings_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct pbtools_bytes_t *value_p);
+
+void repeated_message_scalar_value_types_view_bytess_begin(
+    struct repeated_message_scalar_value_types_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_view_bytess_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct pbtools_bytes_t *value_p);
+
 /**
  * Encoding and decoding of repeated.MessageScalarValueTypes.
  */
@@ -295,6 +535,76 @@ int repeated_message_scalar_value_types_decode(
     const uint8_t *encoded_p,
     size_t size);
 
+int repeated_message_scalar_value_types_decode_segments(
+    struct repeated_message_scalar_value_types_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+int repeated_message_scalar_value_types_int32s_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_int64s_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    int64_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_sint32s_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_sint64s_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    int64_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_uint32s_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    uint32_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_uint64s_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    uint64_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_fixed32s_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    uint32_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_fixed64s_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    uint64_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_sfixed32s_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_sfixed64s_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    int64_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_floats_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    float *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_doubles_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    double *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_bools_set_storage(
+    struct repeated_message_scalar_value_types_t *self_p,
+    bool *items_p,
+    int capacity);
+
 int repeated_message_scalar_value_types_packed_int32s_alloc(
     struct repeated_message_scalar_value_types_packed_t *self_p,
     int length);
@@ -355,6 +665,137 @@ int repeated_message_scalar_value_types_packed_bytess_alloc(
     struct repeated_message_scalar_value_types_packed_t *self_p,
     int length);
 
+/**
+ * Fields of an encoded repeated.MessageScalarValueTypesPacked read on demand.
+ */
+void repeated_message_scalar_value_types_packed_view_init(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int repeated_message_scalar_value_types_packed_view_error(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p);
+
+void repeated_message_scalar_value_types_packed_view_int32s_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_packed_view_int32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void repeated_message_scalar_value_types_packed_view_int64s_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_packed_view_int64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int64_t *value_p);
+
+void repeated_message_scalar_value_types_packed_view_sint32s_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_packed_view_sint32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void repeated_message_scalar_value_types_packed_view_sint64s_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_packed_view_sint64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int64_t *value_p);
+
+void repeated_message_scalar_value_types_packed_view_uint32s_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_packed_view_uint32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint32_t *value_p);
+
+void repeated_message_scalar_value_types_packed_view_uint64s_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_packed_view_uint64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint64_t *value_p);
+
+void repeated_message_scalar_value_types_packed_view_fixed32s_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_packed_view_fixed32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint32_t *value_p);
+
+void repeated_message_scalar_value_types_packed_view_fixed64s_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_packed_view_fixed64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint64_t *value_p);
+
+void repeated_message_scalar_value_types_packed_view_sfixed32s_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_packed_view_sfixed32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void repeated_message_scalar_value_types_packed_view_sfixed64s_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_packed_view_sfixed64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int64_t *value_p);
+
+void repeated_message_scalar_value_types_packed_view_floats_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_packed_view_floats_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    float *value_p);
+
+void repeated_message_scalar_value_types_packed_view_doubles_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_packed_view_doubles_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    double *value_p);
+
+void repeated_message_scalar_value_types_packed_view_bools_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_packed_view_bools_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    bool *value_p);
+
+void repeated_message_scalar_value_types_packed_view_strings_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_packed_view_strings_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct pbtools_bytes_t *value_p);
+
+void repeated_message_scalar_value_types_packed_view_bytess_begin(
+    struct repeated_message_scalar_value_types_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_packed_view_bytess_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct pbtools_bytes_t *value_p);
+
 /**
  * Encoding and decoding of repeated.MessageScalarValueTypesPacked.
  */
@@ -373,6 +814,76 @@ int repeated_message_scalar_value_types_packed_decode(
     const uint8_t *encoded_p,
     size_t size);
 
+int repeated_message_scalar_value_types_packed_decode_segments(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+int repeated_message_scalar_value_types_packed_int32s_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_packed_int64s_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    int64_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_packed_sint32s_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_packed_sint64s_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    int64_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_packed_uint32s_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    uint32_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_packed_uint64s_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    uint64_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_packed_fixed32s_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    uint32_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_packed_fixed64s_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    uint64_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_packed_sfixed32s_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_packed_sfixed64s_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    int64_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_packed_floats_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    float *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_packed_doubles_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    double *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_packed_bools_set_storage(
+    struct repeated_message_scalar_value_types_packed_t *self_p,
+    bool *items_p,
+    int capacity);
+
 int repeated_message_scalar_value_types_not_packed_int32s_alloc(
     struct repeated_message_scalar_value_types_not_packed_t *self_p,
     int length);
@@ -433,6 +944,137 @@ int repeated_message_scalar_value_types_not_packed_bytess_alloc(
     struct repeated_message_scalar_value_types_not_packed_t *self_p,
     int length);
 
+/**
+ * Fields of an encoded repeated.MessageScalarValueTypesNotPacked read on demand.
+ */
+void repeated_message_scalar_value_types_not_packed_view_init(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int repeated_message_scalar_value_types_not_packed_view_error(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p);
+
+void repeated_message_scalar_value_types_not_packed_view_int32s_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_not_packed_view_int32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void repeated_message_scalar_value_types_not_packed_view_int64s_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_not_packed_view_int64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int64_t *value_p);
+
+void repeated_message_scalar_value_types_not_packed_view_sint32s_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_not_packed_view_sint32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void repeated_message_scalar_value_types_not_packed_view_sint64s_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_not_packed_view_sint64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int64_t *value_p);
+
+void repeated_message_scalar_value_types_not_packed_view_uint32s_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_not_packed_view_uint32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint32_t *value_p);
+
+void repeated_message_scalar_value_types_not_packed_view_uint64s_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_not_packed_view_uint64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint64_t *value_p);
+
+void repeated_message_scalar_value_types_not_packed_view_fixed32s_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_not_packed_view_fixed32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint32_t *value_p);
+
+void repeated_message_scalar_value_types_not_packed_view_fixed64s_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_not_packed_view_fixed64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    uint64_t *value_p);
+
+void repeated_message_scalar_value_types_not_packed_view_sfixed32s_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_not_packed_view_sfixed32s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int32_t *value_p);
+
+void repeated_message_scalar_value_types_not_packed_view_sfixed64s_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_not_packed_view_sfixed64s_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    int64_t *value_p);
+
+void repeated_message_scalar_value_types_not_packed_view_floats_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_not_packed_view_floats_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    float *value_p);
+
+void repeated_message_scalar_value_types_not_packed_view_doubles_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_not_packed_view_doubles_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    double *value_p);
+
+void repeated_message_scalar_value_types_not_packed_view_bools_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_not_packed_view_bools_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    bool *value_p);
+
+void repeated_message_scalar_value_types_not_packed_view_strings_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_not_packed_view_strings_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct pbtools_bytes_t *value_p);
+
+void repeated_message_scalar_value_types_not_packed_view_bytess_begin(
+    struct repeated_message_scalar_value_types_not_packed_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_message_scalar_value_types_not_packed_view_bytess_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct pbtools_bytes_t *value_p);
+
 /**
  * Encoding and decoding of repeated.MessageScalarValueTypesNotPacked.
  */
@@ -451,6 +1093,76 @@ int repeated_message_scalar_value_types_not_packed_decode(
     const uint8_t *encoded_p,
     size_t size);
 
+int repeated_message_scalar_value_types_not_packed_decode_segments(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+int repeated_message_scalar_value_types_not_packed_int32s_set_storage(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_not_packed_int64s_set_storage(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int64_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_not_packed_sint32s_set_storage(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_not_packed_sint64s_set_storage(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int64_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_not_packed_uint32s_set_storage(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    uint32_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_not_packed_uint64s_set_storage(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    uint64_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_not_packed_fixed32s_set_storage(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    uint32_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_not_packed_fixed64s_set_storage(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    uint64_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_not_packed_sfixed32s_set_storage(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_not_packed_sfixed64s_set_storage(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    int64_t *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_not_packed_floats_set_storage(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    float *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_not_packed_doubles_set_storage(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    double *items_p,
+    int capacity);
+
+int repeated_message_scalar_value_types_not_packed_bools_set_storage(
+    struct repeated_message_scalar_value_types_not_packed_t *self_p,
+    bool *items_p,
+    int capacity);
+
 int repeated_foo_messages_alloc(
     struct repeated_foo_t *self_p,
     int length);
@@ -459,6 +1171,33 @@ int repeated_foo_enums_alloc(
     struct repeated_foo_t *self_p,
     int length);
 
+/**
+ * Fields of an encoded repeated.Foo read on demand.
+ */
+void repeated_foo_view_init(
+    struct repeated_foo_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int repeated_foo_view_error(
+    struct repeated_foo_view_t *self_p);
+
+void repeated_foo_view_messages_begin(
+    struct repeated_foo_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_foo_view_messages_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct repeated_message_view_t *value_p);
+
+void repeated_foo_view_enums_begin(
+    struct repeated_foo_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_foo_view_enums_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    enum repeated_enum_e *value_p);
+
 /**
  * Encoding and decoding of repeated.Foo.
  */
@@ -477,6 +1216,16 @@ int repeated_foo_decode(
     const uint8_t *encoded_p,
     size_t size);
 
+int repeated_foo_decode_segments(
+    struct repeated_foo_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+int repeated_foo_enums_set_storage(
+    struct repeated_foo_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
 int repeated_bar_foos_alloc(
     struct repeated_bar_t *self_p,
     int length);
@@ -489,6 +1238,52 @@ int repeated_bar_fie_inner_foos_alloc(
     struct repeated_bar_fie_t *self_p,
     int length);
 
+/**
+ * Fields of an encoded repeated.Bar.Fie read on demand.
+ */
+void repeated_bar_fie_view_init(
+    struct repeated_bar_fie_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int repeated_bar_fie_view_error(
+    struct repeated_bar_fie_view_t *self_p);
+
+void repeated_bar_fie_view_inner_foos_begin(
+    struct repeated_bar_fie_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_bar_fie_view_inner_foos_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct repeated_foo_view_t *value_p);
+
+/**
+ * Fields of an encoded repeated.Bar read on demand.
+ */
+void repeated_bar_view_init(
+    struct repeated_bar_view_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int repeated_bar_view_error(
+    struct repeated_bar_view_t *self_p);
+
+void repeated_bar_view_foos_begin(
+    struct repeated_bar_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_bar_view_foos_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct repeated_foo_view_t *value_p);
+
+void repeated_bar_view_fies_begin(
+    struct repeated_bar_view_t *self_p,
+    struct pbtools_view_iterator_t *iterator_p);
+
+bool repeated_bar_view_fies_next(
+    struct pbtools_view_iterator_t *iterator_p,
+    struct repeated_bar_fie_view_t *value_p);
+
 /**
  * Encoding and decoding of repeated.Bar.
  */
@@ -507,6 +1302,11 @@ int repeated_bar_decode(
     const uint8_t *encoded_p,
     size_t size);
 
+int repeated_bar_decode_segments(
+    struct repeated_bar_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
 /* Internal functions. Do not use! */
 
 void repeated_message_init(
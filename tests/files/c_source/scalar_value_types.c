@@ -82,73 +82,214 @@ void scalar_value_types_message_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct scalar_value_types_message_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->v1 = pbtools_decoder_read_bool_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_2;
+            }
 
-        case 1:
-            self_p->v1 = pbtools_decoder_read_bool(decoder_p, wire_type);
             break;
 
-        case 2:
-            pbtools_decoder_read_bytes(decoder_p, wire_type, &self_p->v2);
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_2:
+            pbtools_decoder_read_bytes_unchecked(decoder_p, &self_p->v2);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_64_BIT)) {
+                goto field_3;
+            }
+
             break;
 
-        case 3:
-            self_p->v3 = pbtools_decoder_read_double(decoder_p, wire_type);
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_64_BIT):
+        field_3:
+            self_p->v3 = pbtools_decoder_read_double_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_32_BIT)) {
+                goto field_4;
+            }
+
             break;
 
-        case 4:
-            self_p->v4 = pbtools_decoder_read_fixed32(decoder_p, wire_type);
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_32_BIT):
+        field_4:
+            self_p->v4 = pbtools_decoder_read_fixed32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  5,
+                                                  PBTOOLS_WIRE_TYPE_64_BIT)) {
+                goto field_5;
+            }
+
             break;
 
-        case 5:
-            self_p->v5 = pbtools_decoder_read_fixed64(decoder_p, wire_type);
+        case PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_64_BIT):
+        field_5:
+            self_p->v5 = pbtools_decoder_read_fixed64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  6,
+                                                  PBTOOLS_WIRE_TYPE_32_BIT)) {
+                goto field_6;
+            }
+
             break;
 
-        case 6:
-            self_p->v6 = pbtools_decoder_read_float(decoder_p, wire_type);
+        case PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_32_BIT):
+        field_6:
+            self_p->v6 = pbtools_decoder_read_float_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  7,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_7;
+            }
+
             break;
 
-        case 7:
-            self_p->v7 = pbtools_decoder_read_int32(decoder_p, wire_type);
+        case PBTOOLS_KEY(7, PBTOOLS_WIRE_TYPE_VARINT):
+        field_7:
+            self_p->v7 = pbtools_decoder_read_int32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  8,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_8;
+            }
+
             break;
 
-        case 8:
-            self_p->v8 = pbtools_decoder_read_int64(decoder_p, wire_type);
+        case PBTOOLS_KEY(8, PBTOOLS_WIRE_TYPE_VARINT):
+        field_8:
+            self_p->v8 = pbtools_decoder_read_int64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  9,
+                                                  PBTOOLS_WIRE_TYPE_32_BIT)) {
+                goto field_9;
+            }
+
             break;
 
-        case 9:
-            self_p->v9 = pbtools_decoder_read_sfixed32(decoder_p, wire_type);
+        case PBTOOLS_KEY(9, PBTOOLS_WIRE_TYPE_32_BIT):
+        field_9:
+            self_p->v9 = pbtools_decoder_read_sfixed32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  10,
+                                                  PBTOOLS_WIRE_TYPE_64_BIT)) {
+                goto field_10;
+            }
+
             break;
 
-        case 10:
-            self_p->v10 = pbtools_decoder_read_sfixed64(decoder_p, wire_type);
+        case PBTOOLS_KEY(10, PBTOOLS_WIRE_TYPE_64_BIT):
+        field_10:
+            self_p->v10 = pbtools_decoder_read_sfixed64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  11,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_11;
+            }
+
             break;
 
-        case 11:
-            self_p->v11 = pbtools_decoder_read_sint32(decoder_p, wire_type);
+        case PBTOOLS_KEY(11, PBTOOLS_WIRE_TYPE_VARINT):
+        field_11:
+            self_p->v11 = pbtools_decoder_read_sint32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  12,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_12;
+            }
+
             break;
 
-        case 12:
-            self_p->v12 = pbtools_decoder_read_sint64(decoder_p, wire_type);
+        case PBTOOLS_KEY(12, PBTOOLS_WIRE_TYPE_VARINT):
+        field_12:
+            self_p->v12 = pbtools_decoder_read_sint64_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  13,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_13;
+            }
+
             break;
 
-        case 13:
-            pbtools_decoder_read_string(decoder_p, wire_type, &self_p->v13_p);
+        case PBTOOLS_KEY(13, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+        field_13:
+            pbtools_decoder_read_string_unchecked(decoder_p, &self_p->v13_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  14,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_14;
+            }
+
             break;
 
-        case 14:
-            self_p->v14 = pbtools_decoder_read_uint32(decoder_p, wire_type);
+        case PBTOOLS_KEY(14, PBTOOLS_WIRE_TYPE_VARINT):
+        field_14:
+            self_p->v14 = pbtools_decoder_read_uint32_unchecked(decoder_p);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  15,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_15;
+            }
+
             break;
 
-        case 15:
-            self_p->v15 = pbtools_decoder_read_uint64(decoder_p, wire_type);
+        case PBTOOLS_KEY(15, PBTOOLS_WIRE_TYPE_VARINT):
+        field_15:
+            self_p->v15 = pbtools_decoder_read_uint64_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+            case 7:
+            case 8:
+            case 9:
+            case 10:
+            case 11:
+            case 12:
+            case 13:
+            case 14:
+            case 15:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -159,12 +300,14 @@ void scalar_value_types_message_encode_repeated_inner(
     int field_number,
     struct scalar_value_types_message_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct scalar_value_types_message_t),
-        (pbtools_message_encode_inner_t)scalar_value_types_message_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        scalar_value_types_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void scalar_value_types_message_decode_repeated_inner(
@@ -172,13 +315,30 @@ void scalar_value_types_message_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct scalar_value_types_message_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct scalar_value_types_message_t),
-        (pbtools_message_init_t)scalar_value_types_message_init,
-        (pbtools_message_decode_inner_t)scalar_value_types_message_decode_inner);
+        sizeof(struct scalar_value_types_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        scalar_value_types_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        scalar_value_types_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct scalar_value_types_message_t *
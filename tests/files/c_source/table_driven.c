@@ -0,0 +1,2124 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by pbtools.
+ */
+
+#include <limits.h>
+#include "table_driven.h"
+
+#if CHAR_BIT != 8
+#    error "Number of bits in a char must be 8."
+#endif
+
+void table_driven_bar_v2_init(
+    struct table_driven_bar_t *self_p)
+{
+    self_p->value = table_driven_bar_value_v2_e;
+    self_p->v2_p = "";
+}
+
+void table_driven_bar_v3_init(
+    struct table_driven_bar_t *self_p)
+{
+    self_p->value = table_driven_bar_value_v3_e;
+    self_p->v3 = 0;
+}
+
+static void table_driven_bar_v2_decode(
+    struct pbtools_decoder_t *decoder_p,
+    struct table_driven_bar_t *self_p)
+{
+    table_driven_bar_v2_init(self_p);
+    pbtools_decoder_read_string_unchecked(decoder_p,
+                                          &self_p->v2_p);
+}
+
+static void table_driven_bar_v3_decode(
+    struct pbtools_decoder_t *decoder_p,
+    struct table_driven_bar_t *self_p)
+{
+    table_driven_bar_v3_init(self_p);
+    self_p->v3 = pbtools_decoder_read_int32_unchecked(decoder_p);
+}
+
+void table_driven_bar_init(
+    struct table_driven_bar_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->v1 = 0;
+    self_p->value = 0;
+}
+
+void table_driven_bar_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct table_driven_bar_t *self_p)
+{
+    pbtools_encoder_write_int32(encoder_p, 1, self_p->v1);
+    switch (self_p->value) {
+
+    case table_driven_bar_value_v2_e:
+        pbtools_encoder_write_string_always(
+            encoder_p,
+            2,
+            self_p->v2_p);
+        break;
+
+    case table_driven_bar_value_v3_e:
+        pbtools_encoder_write_int32_always(
+            encoder_p,
+            3,
+            self_p->v3);
+        break;
+
+    default:
+        break;
+    }
+}
+
+void table_driven_bar_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct table_driven_bar_t *self_p)
+{
+    uint32_t key;
+    int wire_type;
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->v1 = pbtools_decoder_read_int32_unchecked(decoder_p);
+            break;
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            table_driven_bar_v2_decode(
+                decoder_p,
+                self_p);
+            break;
+
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_VARINT):
+            table_driven_bar_v3_decode(
+                decoder_p,
+                self_p);
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+}
+
+static const struct pbtools_field_info_t table_driven_bar_validate_fields[] = {
+    {
+        1,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        0,
+        0,
+        NULL
+    },
+    {
+        2,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_STRING,
+        0,
+        0,
+        0,
+        0,
+        NULL
+    },
+    {
+        3,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        0,
+        0,
+        NULL
+    }
+};
+
+const struct pbtools_message_info_t table_driven_bar_info = {
+    sizeof(struct table_driven_bar_t),
+    (pbtools_message_init_t)table_driven_bar_init,
+    (pbtools_message_encode_inner_t)table_driven_bar_encode_inner,
+    (pbtools_message_decode_inner_t)table_driven_bar_decode_inner,
+    0,
+    NULL,
+    NULL,
+    3,
+    &table_driven_bar_validate_fields[0]
+};
+
+void table_driven_bar_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct table_driven_bar_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        table_driven_bar_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void table_driven_bar_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct table_driven_bar_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct table_driven_bar_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        table_driven_bar_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        table_driven_bar_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+struct table_driven_bar_t *
+table_driven_bar_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct table_driven_bar_t),
+                (pbtools_message_init_t)table_driven_bar_init));
+}
+
+int table_driven_bar_encode(
+    struct table_driven_bar_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)table_driven_bar_encode_inner));
+}
+
+int table_driven_bar_decode(
+    struct table_driven_bar_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)table_driven_bar_decode_inner));
+}
+
+int table_driven_bar_decode_segments(
+    struct table_driven_bar_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)table_driven_bar_decode_inner));
+}
+
+static const struct pbtools_field_info_t table_driven_foo_fields[] = {
+    {
+        1,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct table_driven_foo_t, v1),
+        0,
+        NULL
+    },
+    {
+        2,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_SINT64,
+        0,
+        0,
+        offsetof(struct table_driven_foo_t, v2),
+        0,
+        NULL
+    },
+    {
+        3,
+        PBTOOLS_WIRE_TYPE_32_BIT,
+        PBTOOLS_FIELD_KIND_FIXED32,
+        0,
+        0,
+        offsetof(struct table_driven_foo_t, v3),
+        0,
+        NULL
+    },
+    {
+        4,
+        PBTOOLS_WIRE_TYPE_64_BIT,
+        PBTOOLS_FIELD_KIND_DOUBLE,
+        0,
+        0,
+        offsetof(struct table_driven_foo_t, v4),
+        0,
+        NULL
+    },
+    {
+        5,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_BOOL,
+        0,
+        0,
+        offsetof(struct table_driven_foo_t, v5),
+        0,
+        NULL
+    },
+    {
+        6,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_ENUM,
+        0,
+        0,
+        offsetof(struct table_driven_foo_t, v6),
+        0,
+        NULL
+    },
+    {
+        7,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_STRING,
+        0,
+        0,
+        offsetof(struct table_driven_foo_t, v7_p),
+        0,
+        NULL
+    },
+    {
+        8,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_BYTES,
+        0,
+        0,
+        offsetof(struct table_driven_foo_t, v8),
+        0,
+        NULL
+    },
+    {
+        9,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        PBTOOLS_FIELD_FLAG_OPTIONAL,
+        0,
+        offsetof(struct table_driven_foo_t, v9.value),
+        offsetof(struct table_driven_foo_t, v9.is_present),
+        NULL
+    },
+    {
+        10,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_STRING,
+        PBTOOLS_FIELD_FLAG_OPTIONAL,
+        0,
+        offsetof(struct table_driven_foo_t, v10.value_p),
+        offsetof(struct table_driven_foo_t, v10.is_present),
+        NULL
+    },
+    {
+        11,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_INT32,
+        PBTOOLS_FIELD_FLAG_REPEATED,
+        0,
+        offsetof(struct table_driven_foo_t, v11),
+        0,
+        NULL
+    },
+    {
+        12,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_STRING,
+        PBTOOLS_FIELD_FLAG_REPEATED,
+        1,
+        offsetof(struct table_driven_foo_t, v12),
+        0,
+        NULL
+    },
+    {
+        13,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_MESSAGE,
+        PBTOOLS_FIELD_FLAG_REPEATED,
+        2,
+        offsetof(struct table_driven_foo_t, v13),
+        0,
+        &table_driven_bar_info
+    },
+    {
+        14,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_MESSAGE,
+        0,
+        0,
+        offsetof(struct table_driven_foo_t, v14_p),
+        0,
+        &table_driven_bar_info
+    },
+    {
+        300,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_UINT64,
+        0,
+        0,
+        offsetof(struct table_driven_foo_t, v300),
+        0,
+        NULL
+    }
+};
+
+const struct pbtools_message_info_t table_driven_foo_info = {
+    sizeof(struct table_driven_foo_t),
+    (pbtools_message_init_t)table_driven_foo_init,
+    (pbtools_message_encode_inner_t)table_driven_foo_encode_inner,
+    (pbtools_message_decode_inner_t)table_driven_foo_decode_inner,
+    15,
+    &table_driven_foo_fields[0],
+    NULL,
+    0,
+    NULL
+};
+
+void table_driven_foo_init(
+    struct table_driven_foo_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->v1 = 0;
+    self_p->v2 = 0;
+    self_p->v3 = 0;
+    self_p->v4 = 0;
+    self_p->v5 = 0;
+    self_p->v6 = 0;
+    self_p->v7_p = "";
+    pbtools_bytes_init(&self_p->v8);
+    self_p->v9.is_present = false;
+    self_p->v10.is_present = false;
+    self_p->v11.length = 0;
+    self_p->v12.length = 0;
+    self_p->v13.length = 0;
+    self_p->v14_p = NULL;
+    self_p->v300 = 0;
+}
+
+void table_driven_foo_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct table_driven_foo_t *self_p)
+{
+    pbtools_message_info_encode_inner(encoder_p, &self_p->base, &table_driven_foo_info);
+}
+
+void table_driven_foo_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct table_driven_foo_t *self_p)
+{
+    struct pbtools_repeated_info_t repeated_infos[3];
+
+    pbtools_message_info_decode_inner(decoder_p,
+                                      &self_p->base,
+                                      &table_driven_foo_info,
+                                      &repeated_infos[0]);
+}
+
+int table_driven_foo_v14_alloc(
+    struct table_driven_foo_t *self_p)
+{
+    return (pbtools_sub_message_alloc(
+                (struct pbtools_message_base_t **)&self_p->v14_p,
+                self_p->base.heap_p,
+                sizeof(struct table_driven_bar_t),
+                (pbtools_message_init_t)table_driven_bar_init));
+}
+
+int table_driven_foo_v11_alloc(
+    struct table_driven_foo_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_int32(
+                &self_p->base,
+                length,
+                &self_p->v11));
+}
+
+int table_driven_foo_v12_alloc(
+    struct table_driven_foo_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_string(
+                &self_p->base,
+                length,
+                &self_p->v12));
+}
+
+int table_driven_foo_v13_alloc(
+    struct table_driven_foo_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated(
+                (struct pbtools_repeated_message_t *)&self_p->v13,
+                length,
+                self_p->base.heap_p,
+                sizeof(struct table_driven_bar_t),
+                (pbtools_message_init_t)table_driven_bar_init));
+}
+
+void table_driven_foo_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct table_driven_foo_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        table_driven_foo_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void table_driven_foo_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct table_driven_foo_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct table_driven_foo_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        table_driven_foo_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        table_driven_foo_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+struct table_driven_foo_t *
+table_driven_foo_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct table_driven_foo_t),
+                (pbtools_message_init_t)table_driven_foo_init));
+}
+
+int table_driven_foo_encode(
+    struct table_driven_foo_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)table_driven_foo_encode_inner));
+}
+
+int table_driven_foo_decode(
+    struct table_driven_foo_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)table_driven_foo_decode_inner));
+}
+
+int table_driven_foo_decode_segments(
+    struct table_driven_foo_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)table_driven_foo_decode_inner));
+}
+
+int table_driven_foo_decode_callbacks(
+    struct table_driven_foo_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct table_driven_foo_callbacks_t *callbacks_p,
+    void *arg_p)
+{
+    struct pbtools_repeated_callback_t callbacks[] = {
+        {
+            13,
+            sizeof(struct table_driven_bar_t),
+            (pbtools_message_init_t)table_driven_bar_init,
+            (pbtools_item_callback_t)callbacks_p->on_v13
+        }
+    };
+
+    return (pbtools_message_decode_callbacks(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)table_driven_foo_decode_inner,
+                &callbacks[0],
+                1,
+                arg_p));
+}
+
+int table_driven_foo_v11_set_storage(
+    struct table_driven_foo_t *self_p,
+    int32_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->v11,
+                items_p,
+                capacity));
+}
+
+int table_driven_foo_validate(
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_validate(encoded_p,
+                                     size,
+                                     &table_driven_foo_info));
+}
+
+int table_driven_foo_decode_masked(
+    struct table_driven_foo_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_field_mask_t *mask_p)
+{
+    return (pbtools_message_decode_masked(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)table_driven_foo_decode_inner,
+                mask_p));
+}
+
+int table_driven_foo_decode_limited(
+    struct table_driven_foo_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_decode_limits_t *limits_p)
+{
+    return (pbtools_message_decode_limited(&self_p->base,
+                                           encoded_p,
+                                           size,
+                                           &table_driven_foo_info,
+                                           limits_p));
+}
+
+void table_driven_foo_decoder_init(
+    struct pbtools_stream_decoder_t *decoder_p,
+    struct table_driven_foo_t *self_p)
+{
+    pbtools_stream_decoder_init(decoder_p,
+                                &self_p->base,
+                                &table_driven_foo_info);
+}
+
+int table_driven_foo_decoder_feed(
+    struct pbtools_stream_decoder_t *decoder_p,
+    const uint8_t *chunk_p,
+    size_t size)
+{
+    return (pbtools_stream_decoder_feed(decoder_p, chunk_p, size));
+}
+
+int table_driven_foo_decoder_finish(
+    struct pbtools_stream_decoder_t *decoder_p)
+{
+    return (pbtools_stream_decoder_finish(decoder_p));
+}
+
+static void table_driven_bar_columns_alloc(
+    struct pbtools_decoder_t *decoder_p,
+    struct table_driven_bar_columns_t *columns_p,
+    int length)
+{
+    columns_p->length = length;
+    columns_p->v1.values_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        length,
+        sizeof(int32_t));
+    columns_p->v1.present_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        (length + 7) / 8,
+        sizeof(uint8_t));
+}
+
+static void table_driven_bar_decode_columns_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct table_driven_bar_columns_t *columns_p,
+    int index)
+{
+    uint32_t key;
+    int wire_type;
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            columns_p->v1.values_p[index] = pbtools_decoder_read_int32_unchecked(decoder_p);
+            columns_p->v1.present_p[index / 8] |= (uint8_t)(1u << (index % 8));
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+}
+
+static void table_driven_bar_encode_columns_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    const struct table_driven_bar_columns_t *columns_p)
+{
+    int index;
+    int pos;
+
+    for (index = columns_p->length - 1; index >= 0; index--) {
+        pos = encoder_p->pos;
+
+        if ((columns_p->v1.values_p != NULL)
+            && PBTOOLS_COLUMN_IS_PRESENT(
+                columns_p->v1.present_p,
+                index)) {
+            pbtools_encoder_write_int32(
+                encoder_p,
+                1,
+                columns_p->v1.values_p[index]);
+        }
+
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+int table_driven_foo_encode_columns(
+    struct table_driven_foo_t *self_p,
+    uint8_t *encoded_p,
+    size_t size,
+    const struct table_driven_foo_repeated_columns_t *columns_p)
+{
+    struct pbtools_repeated_columns_t columns[] = {
+        {
+            13,
+            columns_p->v13_p,
+            (pbtools_columns_alloc_t)table_driven_bar_columns_alloc,
+            (pbtools_columns_decode_inner_t)table_driven_bar_decode_columns_inner,
+            (pbtools_columns_encode_t)table_driven_bar_encode_columns_inner
+        }
+    };
+
+    return (pbtools_message_encode_columns(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)table_driven_foo_encode_inner,
+                &columns[0],
+                1));
+}
+
+int table_driven_foo_decode_columns(
+    struct table_driven_foo_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct table_driven_foo_repeated_columns_t *columns_p)
+{
+    struct pbtools_repeated_columns_t columns[] = {
+        {
+            13,
+            columns_p->v13_p,
+            (pbtools_columns_alloc_t)table_driven_bar_columns_alloc,
+            (pbtools_columns_decode_inner_t)table_driven_bar_decode_columns_inner,
+            (pbtools_columns_encode_t)table_driven_bar_encode_columns_inner
+        }
+    };
+
+    return (pbtools_message_decode_columns(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)table_driven_foo_decode_inner,
+                &columns[0],
+                1));
+}
+
+static const struct pbtools_field_info_t table_driven_baz_fields[] = {
+    {
+        1,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_MESSAGE,
+        0,
+        0,
+        offsetof(struct table_driven_baz_t, v1_p),
+        0,
+        &table_driven_foo_info
+    },
+    {
+        2,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_MESSAGE,
+        PBTOOLS_FIELD_FLAG_REPEATED,
+        0,
+        offsetof(struct table_driven_baz_t, v2),
+        0,
+        &table_driven_foo_info
+    },
+    {
+        3,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_FIXED64,
+        PBTOOLS_FIELD_FLAG_REPEATED,
+        1,
+        offsetof(struct table_driven_baz_t, v3),
+        0,
+        NULL
+    }
+};
+
+const struct pbtools_message_info_t table_driven_baz_info = {
+    sizeof(struct table_driven_baz_t),
+    (pbtools_message_init_t)table_driven_baz_init,
+    (pbtools_message_encode_inner_t)table_driven_baz_encode_inner,
+    (pbtools_message_decode_inner_t)table_driven_baz_decode_inner,
+    3,
+    &table_driven_baz_fields[0],
+    NULL,
+    0,
+    NULL
+};
+
+void table_driven_baz_init(
+    struct table_driven_baz_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->v1_p = NULL;
+    self_p->v2.length = 0;
+    self_p->v3.length = 0;
+}
+
+void table_driven_baz_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct table_driven_baz_t *self_p)
+{
+    pbtools_message_info_encode_inner(encoder_p, &self_p->base, &table_driven_baz_info);
+}
+
+void table_driven_baz_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct table_driven_baz_t *self_p)
+{
+    struct pbtools_repeated_info_t repeated_infos[2];
+
+    pbtools_message_info_decode_inner(decoder_p,
+                                      &self_p->base,
+                                      &table_driven_baz_info,
+                                      &repeated_infos[0]);
+}
+
+int table_driven_baz_v1_alloc(
+    struct table_driven_baz_t *self_p)
+{
+    return (pbtools_sub_message_alloc(
+                (struct pbtools_message_base_t **)&self_p->v1_p,
+                self_p->base.heap_p,
+                sizeof(struct table_driven_foo_t),
+                (pbtools_message_init_t)table_driven_foo_init));
+}
+
+int table_driven_baz_v2_alloc(
+    struct table_driven_baz_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated(
+                (struct pbtools_repeated_message_t *)&self_p->v2,
+                length,
+                self_p->base.heap_p,
+                sizeof(struct table_driven_foo_t),
+                (pbtools_message_init_t)table_driven_foo_init));
+}
+
+int table_driven_baz_v3_alloc(
+    struct table_driven_baz_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_fixed64(
+                &self_p->base,
+                length,
+                &self_p->v3));
+}
+
+void table_driven_baz_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct table_driven_baz_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        table_driven_baz_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void table_driven_baz_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct table_driven_baz_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct table_driven_baz_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        table_driven_baz_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        table_driven_baz_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+struct table_driven_baz_t *
+table_driven_baz_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct table_driven_baz_t),
+                (pbtools_message_init_t)table_driven_baz_init));
+}
+
+int table_driven_baz_encode(
+    struct table_driven_baz_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)table_driven_baz_encode_inner));
+}
+
+int table_driven_baz_decode(
+    struct table_driven_baz_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)table_driven_baz_decode_inner));
+}
+
+int table_driven_baz_decode_segments(
+    struct table_driven_baz_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)table_driven_baz_decode_inner));
+}
+
+int table_driven_baz_decode_callbacks(
+    struct table_driven_baz_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct table_driven_baz_callbacks_t *callbacks_p,
+    void *arg_p)
+{
+    struct pbtools_repeated_callback_t callbacks[] = {
+        {
+            2,
+            sizeof(struct table_driven_foo_t),
+            (pbtools_message_init_t)table_driven_foo_init,
+            (pbtools_item_callback_t)callbacks_p->on_v2
+        }
+    };
+
+    return (pbtools_message_decode_callbacks(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)table_driven_baz_decode_inner,
+                &callbacks[0],
+                1,
+                arg_p));
+}
+
+int table_driven_baz_v3_set_storage(
+    struct table_driven_baz_t *self_p,
+    uint64_t *items_p,
+    int capacity)
+{
+    return (pbtools_repeated_set_storage(
+                &self_p->base,
+                (struct pbtools_repeated_message_t *)&self_p->v3,
+                items_p,
+                capacity));
+}
+
+int table_driven_baz_validate(
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_validate(encoded_p,
+                                     size,
+                                     &table_driven_baz_info));
+}
+
+int table_driven_baz_decode_masked(
+    struct table_driven_baz_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_field_mask_t *mask_p)
+{
+    return (pbtools_message_decode_masked(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)table_driven_baz_decode_inner,
+                mask_p));
+}
+
+int table_driven_baz_decode_limited(
+    struct table_driven_baz_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_decode_limits_t *limits_p)
+{
+    return (pbtools_message_decode_limited(&self_p->base,
+                                           encoded_p,
+                                           size,
+                                           &table_driven_baz_info,
+                                           limits_p));
+}
+
+void table_driven_baz_decoder_init(
+    struct pbtools_stream_decoder_t *decoder_p,
+    struct table_driven_baz_t *self_p)
+{
+    pbtools_stream_decoder_init(decoder_p,
+                                &self_p->base,
+                                &table_driven_baz_info);
+}
+
+int table_driven_baz_decoder_feed(
+    struct pbtools_stream_decoder_t *decoder_p,
+    const uint8_t *chunk_p,
+    size_t size)
+{
+    return (pbtools_stream_decoder_feed(decoder_p, chunk_p, size));
+}
+
+int table_driven_baz_decoder_finish(
+    struct pbtools_stream_decoder_t *decoder_p)
+{
+    return (pbtools_stream_decoder_finish(decoder_p));
+}
+
+static void table_driven_foo_columns_alloc(
+    struct pbtools_decoder_t *decoder_p,
+    struct table_driven_foo_columns_t *columns_p,
+    int length)
+{
+    columns_p->length = length;
+    columns_p->v1.values_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        length,
+        sizeof(int32_t));
+    columns_p->v1.present_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        (length + 7) / 8,
+        sizeof(uint8_t));
+    columns_p->v2.values_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        length,
+        sizeof(int64_t));
+    columns_p->v2.present_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        (length + 7) / 8,
+        sizeof(uint8_t));
+    columns_p->v3.values_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        length,
+        sizeof(uint32_t));
+    columns_p->v3.present_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        (length + 7) / 8,
+        sizeof(uint8_t));
+    columns_p->v4.values_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        length,
+        sizeof(double));
+    columns_p->v4.present_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        (length + 7) / 8,
+        sizeof(uint8_t));
+    columns_p->v5.values_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        length,
+        sizeof(bool));
+    columns_p->v5.present_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        (length + 7) / 8,
+        sizeof(uint8_t));
+    columns_p->v6.values_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        length,
+        sizeof(enum table_driven_enum_e));
+    columns_p->v6.present_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        (length + 7) / 8,
+        sizeof(uint8_t));
+    columns_p->v9.values_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        length,
+        sizeof(int32_t));
+    columns_p->v9.present_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        (length + 7) / 8,
+        sizeof(uint8_t));
+    columns_p->v300.values_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        length,
+        sizeof(uint64_t));
+    columns_p->v300.present_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        (length + 7) / 8,
+        sizeof(uint8_t));
+}
+
+static void table_driven_foo_decode_columns_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct table_driven_foo_columns_t *columns_p,
+    int index)
+{
+    uint32_t key;
+    int wire_type;
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            columns_p->v1.values_p[index] = pbtools_decoder_read_int32_unchecked(decoder_p);
+            columns_p->v1.present_p[index / 8] |= (uint8_t)(1u << (index % 8));
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_2;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_VARINT):
+        field_2:
+            columns_p->v2.values_p[index] = pbtools_decoder_read_sint64_unchecked(decoder_p);
+            columns_p->v2.present_p[index / 8] |= (uint8_t)(1u << (index % 8));
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_32_BIT)) {
+                goto field_3;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_32_BIT):
+        field_3:
+            columns_p->v3.values_p[index] = pbtools_decoder_read_fixed32_unchecked(decoder_p);
+            columns_p->v3.present_p[index / 8] |= (uint8_t)(1u << (index % 8));
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_64_BIT)) {
+                goto field_4;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_64_BIT):
+        field_4:
+            columns_p->v4.values_p[index] = pbtools_decoder_read_double_unchecked(decoder_p);
+            columns_p->v4.present_p[index / 8] |= (uint8_t)(1u << (index % 8));
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  5,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_5;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_VARINT):
+        field_5:
+            columns_p->v5.values_p[index] = pbtools_decoder_read_bool_unchecked(decoder_p);
+            columns_p->v5.present_p[index / 8] |= (uint8_t)(1u << (index % 8));
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  6,
+                                                  PBTOOLS_WIRE_TYPE_VARINT)) {
+                goto field_6;
+            }
+
+            break;
+
+        case PBTOOLS_KEY(6, PBTOOLS_WIRE_TYPE_VARINT):
+        field_6:
+            columns_p->v6.values_p[index] = pbtools_decoder_read_enum_unchecked(decoder_p);
+            columns_p->v6.present_p[index / 8] |= (uint8_t)(1u << (index % 8));
+            break;
+
+        case PBTOOLS_KEY(9, PBTOOLS_WIRE_TYPE_VARINT):
+            columns_p->v9.values_p[index] = pbtools_decoder_read_int32_unchecked(decoder_p);
+            columns_p->v9.present_p[index / 8] |= (uint8_t)(1u << (index % 8));
+            break;
+
+        case PBTOOLS_KEY(300, PBTOOLS_WIRE_TYPE_VARINT):
+            columns_p->v300.values_p[index] = pbtools_decoder_read_uint64_unchecked(decoder_p);
+            columns_p->v300.present_p[index / 8] |= (uint8_t)(1u << (index % 8));
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+            case 9:
+            case 300:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+}
+
+static void table_driven_foo_encode_columns_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    const struct table_driven_foo_columns_t *columns_p)
+{
+    int index;
+    int pos;
+
+    for (index = columns_p->length - 1; index >= 0; index--) {
+        pos = encoder_p->pos;
+
+        if ((columns_p->v300.values_p != NULL)
+            && PBTOOLS_COLUMN_IS_PRESENT(
+                columns_p->v300.present_p,
+                index)) {
+            pbtools_encoder_write_uint64(
+                encoder_p,
+                300,
+                columns_p->v300.values_p[index]);
+        }
+
+        if ((columns_p->v9.values_p != NULL)
+            && PBTOOLS_COLUMN_IS_PRESENT(
+                columns_p->v9.present_p,
+                index)) {
+            pbtools_encoder_write_int32_always(
+                encoder_p,
+                9,
+                columns_p->v9.values_p[index]);
+        }
+
+        if ((columns_p->v6.values_p != NULL)
+            && PBTOOLS_COLUMN_IS_PRESENT(
+                columns_p->v6.present_p,
+                index)) {
+            pbtools_encoder_write_enum(
+                encoder_p,
+                6,
+                columns_p->v6.values_p[index]);
+        }
+
+        if ((columns_p->v5.values_p != NULL)
+            && PBTOOLS_COLUMN_IS_PRESENT(
+                columns_p->v5.present_p,
+                index)) {
+            pbtools_encoder_write_bool(
+                encoder_p,
+                5,
+                columns_p->v5.values_p[index]);
+        }
+
+        if ((columns_p->v4.values_p != NULL)
+            && PBTOOLS_COLUMN_IS_PRESENT(
+                columns_p->v4.present_p,
+                index)) {
+            pbtools_encoder_write_double(
+                encoder_p,
+                4,
+                columns_p->v4.values_p[index]);
+        }
+
+        if ((columns_p->v3.values_p != NULL)
+            && PBTOOLS_COLUMN_IS_PRESENT(
+                columns_p->v3.present_p,
+                index)) {
+            pbtools_encoder_write_fixed32(
+                encoder_p,
+                3,
+                columns_p->v3.values_p[index]);
+        }
+
+        if ((columns_p->v2.values_p != NULL)
+            && PBTOOLS_COLUMN_IS_PRESENT(
+                columns_p->v2.present_p,
+                index)) {
+            pbtools_encoder_write_sint64(
+                encoder_p,
+                2,
+                columns_p->v2.values_p[index]);
+        }
+
+        if ((columns_p->v1.values_p != NULL)
+            && PBTOOLS_COLUMN_IS_PRESENT(
+                columns_p->v1.present_p,
+                index)) {
+            pbtools_encoder_write_int32(
+                encoder_p,
+                1,
+                columns_p->v1.values_p[index]);
+        }
+
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+int table_driven_baz_encode_columns(
+    struct table_driven_baz_t *self_p,
+    uint8_t *encoded_p,
+    size_t size,
+    const struct table_driven_baz_repeated_columns_t *columns_p)
+{
+    struct pbtools_repeated_columns_t columns[] = {
+        {
+            2,
+            columns_p->v2_p,
+            (pbtools_columns_alloc_t)table_driven_foo_columns_alloc,
+            (pbtools_columns_decode_inner_t)table_driven_foo_decode_columns_inner,
+            (pbtools_columns_encode_t)table_driven_foo_encode_columns_inner
+        }
+    };
+
+    return (pbtools_message_encode_columns(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)table_driven_baz_encode_inner,
+                &columns[0],
+                1));
+}
+
+int table_driven_baz_decode_columns(
+    struct table_driven_baz_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct table_driven_baz_repeated_columns_t *columns_p)
+{
+    struct pbtools_repeated_columns_t columns[] = {
+        {
+            2,
+            columns_p->v2_p,
+            (pbtools_columns_alloc_t)table_driven_foo_columns_alloc,
+            (pbtools_columns_decode_inner_t)table_driven_foo_decode_columns_inner,
+            (pbtools_columns_encode_t)table_driven_foo_encode_columns_inner
+        }
+    };
+
+    return (pbtools_message_decode_columns(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)table_driven_baz_decode_inner,
+                &columns[0],
+                1));
+}
+
+static const struct pbtools_field_info_t table_driven_node_fields[] = {
+    {
+        1,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct table_driven_node_t, value),
+        0,
+        NULL
+    },
+    {
+        2,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_MESSAGE,
+        0,
+        0,
+        offsetof(struct table_driven_node_t, next_p),
+        0,
+        &table_driven_node_info
+    },
+    {
+        3,
+        PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED,
+        PBTOOLS_FIELD_KIND_MESSAGE,
+        PBTOOLS_FIELD_FLAG_REPEATED,
+        0,
+        offsetof(struct table_driven_node_t, children),
+        0,
+        &table_driven_node_info
+    }
+};
+
+const struct pbtools_message_info_t table_driven_node_info = {
+    sizeof(struct table_driven_node_t),
+    (pbtools_message_init_t)table_driven_node_init,
+    (pbtools_message_encode_inner_t)table_driven_node_encode_inner,
+    (pbtools_message_decode_inner_t)table_driven_node_decode_inner,
+    3,
+    &table_driven_node_fields[0],
+    NULL,
+    0,
+    NULL
+};
+
+void table_driven_node_init(
+    struct table_driven_node_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->value = 0;
+    self_p->next_p = NULL;
+    self_p->children.length = 0;
+}
+
+void table_driven_node_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct table_driven_node_t *self_p)
+{
+    pbtools_message_info_encode_inner(encoder_p, &self_p->base, &table_driven_node_info);
+}
+
+void table_driven_node_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct table_driven_node_t *self_p)
+{
+    struct pbtools_repeated_info_t repeated_infos[1];
+
+    pbtools_message_info_decode_inner(decoder_p,
+                                      &self_p->base,
+                                      &table_driven_node_info,
+                                      &repeated_infos[0]);
+}
+
+int table_driven_node_next_alloc(
+    struct table_driven_node_t *self_p)
+{
+    return (pbtools_sub_message_alloc(
+                (struct pbtools_message_base_t **)&self_p->next_p,
+                self_p->base.heap_p,
+                sizeof(struct table_driven_node_t),
+                (pbtools_message_init_t)table_driven_node_init));
+}
+
+int table_driven_node_children_alloc(
+    struct table_driven_node_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated(
+                (struct pbtools_repeated_message_t *)&self_p->children,
+                length,
+                self_p->base.heap_p,
+                sizeof(struct table_driven_node_t),
+                (pbtools_message_init_t)table_driven_node_init));
+}
+
+void table_driven_node_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct table_driven_node_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        table_driven_node_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void table_driven_node_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct table_driven_node_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct table_driven_node_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        table_driven_node_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        table_driven_node_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+struct table_driven_node_t *
+table_driven_node_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct table_driven_node_t),
+                (pbtools_message_init_t)table_driven_node_init));
+}
+
+int table_driven_node_encode(
+    struct table_driven_node_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)table_driven_node_encode_inner));
+}
+
+int table_driven_node_decode(
+    struct table_driven_node_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)table_driven_node_decode_inner));
+}
+
+int table_driven_node_decode_segments(
+    struct table_driven_node_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)table_driven_node_decode_inner));
+}
+
+int table_driven_node_decode_callbacks(
+    struct table_driven_node_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct table_driven_node_callbacks_t *callbacks_p,
+    void *arg_p)
+{
+    struct pbtools_repeated_callback_t callbacks[] = {
+        {
+            3,
+            sizeof(struct table_driven_node_t),
+            (pbtools_message_init_t)table_driven_node_init,
+            (pbtools_item_callback_t)callbacks_p->on_children
+        }
+    };
+
+    return (pbtools_message_decode_callbacks(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)table_driven_node_decode_inner,
+                &callbacks[0],
+                1,
+                arg_p));
+}
+
+int table_driven_node_validate(
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_validate(encoded_p,
+                                     size,
+                                     &table_driven_node_info));
+}
+
+int table_driven_node_decode_masked(
+    struct table_driven_node_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_field_mask_t *mask_p)
+{
+    return (pbtools_message_decode_masked(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)table_driven_node_decode_inner,
+                mask_p));
+}
+
+int table_driven_node_decode_limited(
+    struct table_driven_node_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_decode_limits_t *limits_p)
+{
+    return (pbtools_message_decode_limited(&self_p->base,
+                                           encoded_p,
+                                           size,
+                                           &table_driven_node_info,
+                                           limits_p));
+}
+
+void table_driven_node_decoder_init(
+    struct pbtools_stream_decoder_t *decoder_p,
+    struct table_driven_node_t *self_p)
+{
+    pbtools_stream_decoder_init(decoder_p,
+                                &self_p->base,
+                                &table_driven_node_info);
+}
+
+int table_driven_node_decoder_feed(
+    struct pbtools_stream_decoder_t *decoder_p,
+    const uint8_t *chunk_p,
+    size_t size)
+{
+    return (pbtools_stream_decoder_feed(decoder_p, chunk_p, size));
+}
+
+int table_driven_node_decoder_finish(
+    struct pbtools_stream_decoder_t *decoder_p)
+{
+    return (pbtools_stream_decoder_finish(decoder_p));
+}
+
+static void table_driven_node_columns_alloc(
+    struct pbtools_decoder_t *decoder_p,
+    struct table_driven_node_columns_t *columns_p,
+    int length)
+{
+    columns_p->length = length;
+    columns_p->value.values_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        length,
+        sizeof(int32_t));
+    columns_p->value.present_p = pbtools_decoder_alloc_column(
+        decoder_p,
+        (length + 7) / 8,
+        sizeof(uint8_t));
+}
+
+static void table_driven_node_decode_columns_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct table_driven_node_columns_t *columns_p,
+    int index)
+{
+    uint32_t key;
+    int wire_type;
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            columns_p->value.values_p[index] = pbtools_decoder_read_int32_unchecked(decoder_p);
+            columns_p->value.present_p[index / 8] |= (uint8_t)(1u << (index % 8));
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+}
+
+static void table_driven_node_encode_columns_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    const struct table_driven_node_columns_t *columns_p)
+{
+    int index;
+    int pos;
+
+    for (index = columns_p->length - 1; index >= 0; index--) {
+        pos = encoder_p->pos;
+
+        if ((columns_p->value.values_p != NULL)
+            && PBTOOLS_COLUMN_IS_PRESENT(
+                columns_p->value.present_p,
+                index)) {
+            pbtools_encoder_write_int32(
+                encoder_p,
+                1,
+                columns_p->value.values_p[index]);
+        }
+
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+int table_driven_node_encode_columns(
+    struct table_driven_node_t *self_p,
+    uint8_t *encoded_p,
+    size_t size,
+    const struct table_driven_node_repeated_columns_t *columns_p)
+{
+    struct pbtools_repeated_columns_t columns[] = {
+        {
+            3,
+            columns_p->children_p,
+            (pbtools_columns_alloc_t)table_driven_node_columns_alloc,
+            (pbtools_columns_decode_inner_t)table_driven_node_decode_columns_inner,
+            (pbtools_columns_encode_t)table_driven_node_encode_columns_inner
+        }
+    };
+
+    return (pbtools_message_encode_columns(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)table_driven_node_encode_inner,
+                &columns[0],
+                1));
+}
+
+int table_driven_node_decode_columns(
+    struct table_driven_node_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct table_driven_node_repeated_columns_t *columns_p)
+{
+    struct pbtools_repeated_columns_t columns[] = {
+        {
+            3,
+            columns_p->children_p,
+            (pbtools_columns_alloc_t)table_driven_node_columns_alloc,
+            (pbtools_columns_decode_inner_t)table_driven_node_decode_columns_inner,
+            (pbtools_columns_encode_t)table_driven_node_encode_columns_inner
+        }
+    };
+
+    return (pbtools_message_decode_columns(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)table_driven_node_decode_inner,
+                &columns[0],
+                1));
+}
+
+static const struct pbtools_field_info_t table_driven_unordered_fields[] = {
+    {
+        3,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct table_driven_unordered_t, v3),
+        0,
+        NULL
+    },
+    {
+        1,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct table_driven_unordered_t, v1),
+        0,
+        NULL
+    },
+    {
+        2,
+        PBTOOLS_WIRE_TYPE_VARINT,
+        PBTOOLS_FIELD_KIND_INT32,
+        0,
+        0,
+        offsetof(struct table_driven_unordered_t, v2),
+        0,
+        NULL
+    }
+};
+
+static const uint16_t table_driven_unordered_sorted_indexes[] = {
+    1,
+    2,
+    0
+};
+
+const struct pbtools_message_info_t table_driven_unordered_info = {
+    sizeof(struct table_driven_unordered_t),
+    (pbtools_message_init_t)table_driven_unordered_init,
+    (pbtools_message_encode_inner_t)table_driven_unordered_encode_inner,
+    (pbtools_message_decode_inner_t)table_driven_unordered_decode_inner,
+    3,
+    &table_driven_unordered_fields[0],
+    &table_driven_unordered_sorted_indexes[0],
+    0,
+    NULL
+};
+
+void table_driven_unordered_init(
+    struct table_driven_unordered_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    self_p->v3 = 0;
+    self_p->v1 = 0;
+    self_p->v2 = 0;
+}
+
+void table_driven_unordered_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct table_driven_unordered_t *self_p)
+{
+    pbtools_message_info_encode_inner(encoder_p, &self_p->base, &table_driven_unordered_info);
+}
+
+void table_driven_unordered_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct table_driven_unordered_t *self_p)
+{
+    pbtools_message_info_decode_inner(decoder_p,
+                                      &self_p->base,
+                                      &table_driven_unordered_info,
+                                      NULL);
+}
+
+void table_driven_unordered_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct table_driven_unordered_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        table_driven_unordered_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void table_driven_unordered_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct table_driven_unordered_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct table_driven_unordered_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        table_driven_unordered_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        table_driven_unordered_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+struct table_driven_unordered_t *
+table_driven_unordered_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct table_driven_unordered_t),
+                (pbtools_message_init_t)table_driven_unordered_init));
+}
+
+int table_driven_unordered_encode(
+    struct table_driven_unordered_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)table_driven_unordered_encode_inner));
+}
+
+int table_driven_unordered_decode(
+    struct table_driven_unordered_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)table_driven_unordered_decode_inner));
+}
+
+int table_driven_unordered_decode_segments(
+    struct table_driven_unordered_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length)
+{
+    return (pbtools_message_decode_segments(
+                &self_p->base,
+                segments_p,
+                length,
+                (pbtools_message_decode_inner_t)table_driven_unordered_decode_inner));
+}
+
+int table_driven_unordered_validate(
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_validate(encoded_p,
+                                     size,
+                                     &table_driven_unordered_info));
+}
+
+int table_driven_unordered_decode_masked(
+    struct table_driven_unordered_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_field_mask_t *mask_p)
+{
+    return (pbtools_message_decode_masked(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)table_driven_unordered_decode_inner,
+                mask_p));
+}
+
+int table_driven_unordered_decode_limited(
+    struct table_driven_unordered_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_decode_limits_t *limits_p)
+{
+    return (pbtools_message_decode_limited(&self_p->base,
+                                           encoded_p,
+                                           size,
+                                           &table_driven_unordered_info,
+                                           limits_p));
+}
+
+void table_driven_unordered_decoder_init(
+    struct pbtools_stream_decoder_t *decoder_p,
+    struct table_driven_unordered_t *self_p)
+{
+    pbtools_stream_decoder_init(decoder_p,
+                                &self_p->base,
+                                &table_driven_unordered_info);
+}
+
+int table_driven_unordered_decoder_feed(
+    struct pbtools_stream_decoder_t *decoder_p,
+    const uint8_t *chunk_p,
+    size_t size)
+{
+    return (pbtools_stream_decoder_feed(decoder_p, chunk_p, size));
+}
+
+int table_driven_unordered_decoder_finish(
+    struct pbtools_stream_decoder_t *decoder_p)
+{
+    return (pbtools_stream_decoder_finish(decoder_p));
+}
@@ -0,0 +1,721 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by pbtools.
+ */
+
+#ifndef TABLE_DRIVEN_H
+#define TABLE_DRIVEN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "pbtools.h"
+
+/**
+ * Enum table_driven.Enum.
+ */
+enum table_driven_enum_e {
+    table_driven_a_e = 0,
+    table_driven_b_e = 1
+};
+
+/**
+ * Enum table_driven.Bar.value.
+ */
+enum table_driven_bar_value_e {
+    table_driven_bar_value_none_e = 0,
+    table_driven_bar_value_v2_e = 1,
+    table_driven_bar_value_v3_e = 2
+};
+
+/**
+ * Message table_driven.Bar.
+ */
+struct table_driven_bar_repeated_t {
+    int length;
+    struct table_driven_bar_t *items_p;
+};
+
+struct table_driven_bar_t {
+    struct pbtools_message_base_t base;
+    int32_t v1;
+    enum table_driven_bar_value_e value;
+    union {
+        char *v2_p;
+        int32_t v3;
+    };
+};
+
+/**
+ * Message table_driven.Foo.
+ */
+struct table_driven_foo_repeated_t {
+    int length;
+    struct table_driven_foo_t *items_p;
+};
+
+struct table_driven_foo_t {
+    struct pbtools_message_base_t base;
+    int32_t v1;
+    int64_t v2;
+    uint32_t v3;
+    double v4;
+    bool v5;
+    enum table_driven_enum_e v6;
+    char *v7_p;
+    struct pbtools_bytes_t v8;
+    struct {
+        bool is_present;
+        int32_t value;
+    } v9;
+    struct {
+        bool is_present;
+        char *value_p;
+    } v10;
+    struct pbtools_repeated_int32_t v11;
+    struct pbtools_repeated_string_t v12;
+    struct table_driven_bar_repeated_t v13;
+    struct table_driven_bar_t *v14_p;
+    uint64_t v300;
+};
+
+/**
+ * Callbacks of table_driven.Foo repeated sub-message fields.
+ */
+struct table_driven_foo_callbacks_t {
+    void (*on_v13)(
+        void *arg_p,
+        const struct table_driven_bar_t *item_p);
+};
+
+/**
+ * Columns of repeated table_driven.Bar items.
+ */
+struct table_driven_bar_columns_t {
+    int length;
+    struct {
+        int32_t *values_p;
+        uint8_t *present_p;
+    } v1;
+};
+
+/**
+ * Columns of table_driven.Foo repeated sub-message fields.
+ */
+struct table_driven_foo_repeated_columns_t {
+    struct table_driven_bar_columns_t *v13_p;
+};
+
+/**
+ * Message table_driven.Baz.
+ */
+struct table_driven_baz_repeated_t {
+    int length;
+    struct table_driven_baz_t *items_p;
+};
+
+struct table_driven_baz_t {
+    struct pbtools_message_base_t base;
+    struct table_driven_foo_t *v1_p;
+    struct table_driven_foo_repeated_t v2;
+    struct pbtools_repeated_uint64_t v3;
+};
+
+/**
+ * Callbacks of table_driven.Baz repeated sub-message fields.
+ */
+struct table_driven_baz_callbacks_t {
+    void (*on_v2)(
+        void *arg_p,
+        const struct table_driven_foo_t *item_p);
+};
+
+/**
+ * Columns of repeated table_driven.Foo items.
+ */
+struct table_driven_foo_columns_t {
+    int length;
+    struct {
+        int32_t *values_p;
+        uint8_t *present_p;
+    } v1;
+    struct {
+        int64_t *values_p;
+        uint8_t *present_p;
+    } v2;
+    struct {
+        uint32_t *values_p;
+        uint8_t *present_p;
+    } v3;
+    struct {
+        double *values_p;
+        uint8_t *present_p;
+    } v4;
+    struct {
+        bool *values_p;
+        uint8_t *present_p;
+    } v5;
+    struct {
+        enum table_driven_enum_e *values_p;
+        uint8_t *present_p;
+    } v6;
+    struct {
+        int32_t *values_p;
+        uint8_t *present_p;
+    } v9;
+    struct {
+        uint64_t *values_p;
+        uint8_t *present_p;
+    } v300;
+};
+
+/**
+ * Columns of table_driven.Baz repeated sub-message fields.
+ */
+struct table_driven_baz_repeated_columns_t {
+    struct table_driven_foo_columns_t *v2_p;
+};
+
+/**
+ * Message table_driven.Node.
+ */
+struct table_driven_node_repeated_t {
+    int length;
+    struct table_driven_node_t *items_p;
+};
+
+struct table_driven_node_t {
+    struct pbtools_message_base_t base;
+    int32_t value;
+    struct table_driven_node_t *next_p;
+    struct table_driven_node_repeated_t children;
+};
+
+/**
+ * Callbacks of table_driven.Node repeated sub-message fields.
+ */
+struct table_driven_node_callbacks_t {
+    void (*on_children)(
+        void *arg_p,
+        const struct table_driven_node_t *item_p);
+};
+
+/**
+ * Columns of repeated table_driven.Node items.
+ */
+struct table_driven_node_columns_t {
+    int length;
+    struct {
+        int32_t *values_p;
+        uint8_t *present_p;
+    } value;
+};
+
+/**
+ * Columns of table_driven.Node repeated sub-message fields.
+ */
+struct table_driven_node_repeated_columns_t {
+    struct table_driven_node_columns_t *children_p;
+};
+
+/**
+ * Message table_driven.Unordered.
+ */
+struct table_driven_unordered_repeated_t {
+    int length;
+    struct table_driven_unordered_t *items_p;
+};
+
+struct table_driven_unordered_t {
+    struct pbtools_message_base_t base;
+    int32_t v3;
+    int32_t v1;
+    int32_t v2;
+};
+
+void table_driven_bar_v2_init(
+    struct table_driven_bar_t *self_p);
+
+void table_driven_bar_v3_init(
+    struct table_driven_bar_t *self_p);
+
+/**
+ * Encoding and decoding of table_driven.Bar.
+ */
+struct table_driven_bar_t *
+table_driven_bar_new(
+    void *workspace_p,
+    size_t size);
+
+int table_driven_bar_encode(
+    struct table_driven_bar_t *self_p,
+    uint8_t *encoded_p,
+    size_t size);
+
+int table_driven_bar_decode(
+    struct table_driven_bar_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int table_driven_bar_decode_segments(
+    struct table_driven_bar_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+int table_driven_foo_v11_alloc(
+    struct table_driven_foo_t *self_p,
+    int length);
+
+int table_driven_foo_v12_alloc(
+    struct table_driven_foo_t *self_p,
+    int length);
+
+int table_driven_foo_v13_alloc(
+    struct table_driven_foo_t *self_p,
+    int length);
+
+int table_driven_foo_v14_alloc(
+    struct table_driven_foo_t *self_p);
+
+/**
+ * Encoding and decoding of table_driven.Foo.
+ */
+struct table_driven_foo_t *
+table_driven_foo_new(
+    void *workspace_p,
+    size_t size);
+
+int table_driven_foo_encode(
+    struct table_driven_foo_t *self_p,
+    uint8_t *encoded_p,
+    size_t size);
+
+int table_driven_foo_decode(
+    struct table_driven_foo_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int table_driven_foo_decode_segments(
+    struct table_driven_foo_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+int table_driven_foo_decode_callbacks(
+    struct table_driven_foo_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct table_driven_foo_callbacks_t *callbacks_p,
+    void *arg_p);
+
+int table_driven_foo_encode_columns(
+    struct table_driven_foo_t *self_p,
+    uint8_t *encoded_p,
+    size_t size,
+    const struct table_driven_foo_repeated_columns_t *columns_p);
+
+int table_driven_foo_decode_columns(
+    struct table_driven_foo_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct table_driven_foo_repeated_columns_t *columns_p);
+
+int table_driven_foo_v11_set_storage(
+    struct table_driven_foo_t *self_p,
+    int32_t *items_p,
+    int capacity);
+
+int table_driven_foo_validate(
+    const uint8_t *encoded_p,
+    size_t size);
+
+int table_driven_foo_decode_masked(
+    struct table_driven_foo_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_field_mask_t *mask_p);
+
+int table_driven_foo_decode_limited(
+    struct table_driven_foo_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_decode_limits_t *limits_p);
+
+void table_driven_foo_decoder_init(
+    struct pbtools_stream_decoder_t *decoder_p,
+    struct table_driven_foo_t *self_p);
+
+int table_driven_foo_decoder_feed(
+    struct pbtools_stream_decoder_t *decoder_p,
+    const uint8_t *chunk_p,
+    size_t size);
+
+int table_driven_foo_decoder_finish(
+    struct pbtools_stream_decoder_t *decoder_p);
+
+int table_driven_baz_v1_alloc(
+    struct table_driven_baz_t *self_p);
+
+int table_driven_baz_v2_alloc(
+    struct table_driven_baz_t *self_p,
+    int length);
+
+int table_driven_baz_v3_alloc(
+    struct table_driven_baz_t *self_p,
+    int length);
+
+/**
+ * Encoding and decoding of table_driven.Baz.
+ */
+struct table_driven_baz_t *
+table_driven_baz_new(
+    void *workspace_p,
+    size_t size);
+
+int table_driven_baz_encode(
+    struct table_driven_baz_t *self_p,
+    uint8_t *encoded_p,
+    size_t size);
+
+int table_driven_baz_decode(
+    struct table_driven_baz_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int table_driven_baz_decode_segments(
+    struct table_driven_baz_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+int table_driven_baz_decode_callbacks(
+    struct table_driven_baz_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct table_driven_baz_callbacks_t *callbacks_p,
+    void *arg_p);
+
+int table_driven_baz_encode_columns(
+    struct table_driven_baz_t *self_p,
+    uint8_t *encoded_p,
+    size_t size,
+    const struct table_driven_baz_repeated_columns_t *columns_p);
+
+int table_driven_baz_decode_columns(
+    struct table_driven_baz_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct table_driven_baz_repeated_columns_t *columns_p);
+
+int table_driven_baz_v3_set_storage(
+    struct table_driven_baz_t *self_p,
+    uint64_t *items_p,
+    int capacity);
+
+int table_driven_baz_validate(
+    const uint8_t *encoded_p,
+    size_t size);
+
+int table_driven_baz_decode_masked(
+    struct table_driven_baz_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_field_mask_t *mask_p);
+
+int table_driven_baz_decode_limited(
+    struct table_driven_baz_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_decode_limits_t *limits_p);
+
+void table_driven_baz_decoder_init(
+    struct pbtools_stream_decoder_t *decoder_p,
+    struct table_driven_baz_t *self_p);
+
+int table_driven_baz_decoder_feed(
+    struct pbtools_stream_decoder_t *decoder_p,
+    const uint8_t *chunk_p,
+    size_t size);
+
+int table_driven_baz_decoder_finish(
+    struct pbtools_stream_decoder_t *decoder_p);
+
+int table_driven_node_next_alloc(
+    struct table_driven_node_t *self_p);
+
+int table_driven_node_children_alloc(
+    struct table_driven_node_t *self_p,
+    int length);
+
+/**
+ * Encoding and decoding of table_driven.Node.
+ */
+struct table_driven_node_t *
+table_driven_node_new(
+    void *workspace_p,
+    size_t size);
+
+int table_driven_node_encode(
+    struct table_driven_node_t *self_p,
+    uint8_t *encoded_p,
+    size_t size);
+
+int table_driven_node_decode(
+    struct table_driven_node_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int table_driven_node_decode_segments(
+    struct table_driven_node_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+int table_driven_node_decode_callbacks(
+    struct table_driven_node_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct table_driven_node_callbacks_t *callbacks_p,
+    void *arg_p);
+
+int table_driven_node_encode_columns(
+    struct table_driven_node_t *self_p,
+    uint8_t *encoded_p,
+    size_t size,
+    const struct table_driven_node_repeated_columns_t *columns_p);
+
+int table_driven_node_decode_columns(
+    struct table_driven_node_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct table_driven_node_repeated_columns_t *columns_p);
+
+int table_driven_node_validate(
+    const uint8_t *encoded_p,
+    size_t size);
+
+int table_driven_node_decode_masked(
+    struct table_driven_node_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_field_mask_t *mask_p);
+
+int table_driven_node_decode_limited(
+    struct table_driven_node_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_decode_limits_t *limits_p);
+
+void table_driven_node_decoder_init(
+    struct pbtools_stream_decoder_t *decoder_p,
+    struct table_driven_node_t *self_p);
+
+int table_driven_node_decoder_feed(
+    struct pbtools_stream_decoder_t *decoder_p,
+    const uint8_t *chunk_p,
+    size_t size);
+
+int table_driven_node_decoder_finish(
+    struct pbtools_stream_decoder_t *decoder_p);
+
+/**
+ * Encoding and decoding of table_driven.Unordered.
+ */
+struct table_driven_unordered_t *
+table_driven_unordered_new(
+    void *workspace_p,
+    size_t size);
+
+int table_driven_unordered_encode(
+    struct table_driven_unordered_t *self_p,
+    uint8_t *encoded_p,
+    size_t size);
+
+int table_driven_unordered_decode(
+    struct table_driven_unordered_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int table_driven_unordered_decode_segments(
+    struct table_driven_unordered_t *self_p,
+    const struct pbtools_segment_t *segments_p,
+    int length);
+
+int table_driven_unordered_validate(
+    const uint8_t *encoded_p,
+    size_t size);
+
+int table_driven_unordered_decode_masked(
+    struct table_driven_unordered_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_field_mask_t *mask_p);
+
+int table_driven_unordered_decode_limited(
+    struct table_driven_unordered_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size,
+    const struct pbtools_decode_limits_t *limits_p);
+
+void table_driven_unordered_decoder_init(
+    struct pbtools_stream_decoder_t *decoder_p,
+    struct table_driven_unordered_t *self_p);
+
+int table_driven_unordered_decoder_feed(
+    struct pbtools_stream_decoder_t *decoder_p,
+    const uint8_t *chunk_p,
+    size_t size);
+
+int table_driven_unordered_decoder_finish(
+    struct pbtools_stream_decoder_t *decoder_p);
+
+/* Internal functions. Do not use! */
+
+void table_driven_bar_init(
+    struct table_driven_bar_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void table_driven_bar_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct table_driven_bar_t *self_p);
+
+void table_driven_bar_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct table_driven_bar_t *self_p);
+
+void table_driven_bar_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct table_driven_bar_repeated_t *repeated_p);
+
+void table_driven_bar_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct table_driven_bar_repeated_t *repeated_p);
+
+extern const struct pbtools_message_info_t table_driven_bar_info;
+
+void table_driven_foo_init(
+    struct table_driven_foo_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void table_driven_foo_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct table_driven_foo_t *self_p);
+
+void table_driven_foo_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct table_driven_foo_t *self_p);
+
+void table_driven_foo_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct table_driven_foo_repeated_t *repeated_p);
+
+void table_driven_foo_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct table_driven_foo_repeated_t *repeated_p);
+
+extern const struct pbtools_message_info_t table_driven_foo_info;
+
+void table_driven_baz_init(
+    struct table_driven_baz_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void table_driven_baz_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct table_driven_baz_t *self_p);
+
+void table_driven_baz_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct table_driven_baz_t *self_p);
+
+void table_driven_baz_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct table_driven_baz_repeated_t *repeated_p);
+
+void table_driven_baz_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct table_driven_baz_repeated_t *repeated_p);
+
+extern const struct pbtools_message_info_t table_driven_baz_info;
+
+void table_driven_node_init(
+    struct table_driven_node_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void table_driven_node_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct table_driven_node_t *self_p);
+
+void table_driven_node_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct table_driven_node_t *self_p);
+
+void table_driven_node_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct table_driven_node_repeated_t *repeated_p);
+
+void table_driven_node_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct table_driven_node_repeated_t *repeated_p);
+
+extern const struct pbtools_message_info_t table_driven_node_info;
+
+void table_driven_unordered_init(
+    struct table_driven_unordered_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void table_driven_unordered_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct table_driven_unordered_t *self_p);
+
+void table_driven_unordered_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct table_driven_unordered_t *self_p);
+
+void table_driven_unordered_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct table_driven_unordered_repeated_t *repeated_p);
+
+void table_driven_unordered_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct table_driven_unordered_repeated_t *repeated_p);
+
+extern const struct pbtools_message_info_t table_driven_unordered_info;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
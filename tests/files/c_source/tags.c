@@ -54,17 +54,32 @@ void tags_message1_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct tags_message1_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 1:
-            self_p->value = pbtools_decoder_read_bool(decoder_p, wire_type);
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->value = pbtools_decoder_read_bool_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -75,12 +90,14 @@ void tags_message1_encode_repeated_inner(
     int field_number,
     struct tags_message1_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct tags_message1_t),
-        (pbtools_message_encode_inner_t)tags_message1_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        tags_message1_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void tags_message1_decode_repeated_inner(
@@ -88,13 +105,30 @@ void tags_message1_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct tags_message1_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct tags_message1_t),
-        (pbtools_message_init_t)tags_message1_init,
-        (pbtools_message_decode_inner_t)tags_message1_decode_inner);
+        sizeof(struct tags_message1_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        tags_message1_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        tags_message1_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct tags_message1_t *
@@ -152,17 +186,32 @@ void tags_message2_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct tags_message2_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 15:
-            self_p->value = pbtools_decoder_read_bool(decoder_p, wire_type);
+        switch (key) {
+
+        case PBTOOLS_KEY(15, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->value = pbtools_decoder_read_bool_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 15:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -173,12 +222,14 @@ void tags_message2_encode_repeated_inner(
     int field_number,
     struct tags_message2_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct tags_message2_t),
-        (pbtools_message_encode_inner_t)tags_message2_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        tags_message2_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void tags_message2_decode_repeated_inner(
@@ -186,13 +237,30 @@ void tags_message2_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct tags_message2_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct tags_message2_t),
-        (pbtools_message_init_t)tags_message2_init,
-        (pbtools_message_decode_inner_t)tags_message2_decode_inner);
+        sizeof(struct tags_message2_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        tags_message2_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        tags_message2_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct tags_message2_t *
@@ -250,17 +318,32 @@ void tags_message3_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct tags_message3_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
 
-        case 16:
-            self_p->value = pbtools_decoder_read_bool(decoder_p, wire_type);
+        case PBTOOLS_KEY(16, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->value = pbtools_decoder_read_bool_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 16:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -271,12 +354,14 @@ void tags_message3_encode_repeated_inner(
     int field_number,
     struct tags_message3_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct tags_message3_t),
-        (pbtools_message_encode_inner_t)tags_message3_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        tags_message3_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void tags_message3_decode_repeated_inner(
@@ -284,13 +369,30 @@ void tags_message3_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct tags_message3_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct tags_message3_t),
-        (pbtools_message_init_t)tags_message3_init,
-        (pbtools_message_decode_inner_t)tags_message3_decode_inner);
+        sizeof(struct tags_message3_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        tags_message3_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        tags_message3_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct tags_message3_t *
@@ -348,17 +450,32 @@ void tags_message4_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct tags_message4_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 2047:
-            self_p->value = pbtools_decoder_read_bool(decoder_p, wire_type);
+        switch (key) {
+
+        case PBTOOLS_KEY(2047, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->value = pbtools_decoder_read_bool_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 2047:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -369,12 +486,14 @@ void tags_message4_encode_repeated_inner(
     int field_number,
     struct tags_message4_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct tags_message4_t),
-        (pbtools_message_encode_inner_t)tags_message4_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        tags_message4_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void tags_message4_decode_repeated_inner(
@@ -382,13 +501,30 @@ void tags_message4_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct tags_message4_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct tags_message4_t),
-        (pbtools_message_init_t)tags_message4_init,
-        (pbtools_message_decode_inner_t)tags_message4_decode_inner);
+        sizeof(struct tags_message4_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        tags_message4_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        tags_message4_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct tags_message4_t *
@@ -446,17 +582,32 @@ void tags_message5_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct tags_message5_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
 
-        case 2048:
-            self_p->value = pbtools_decoder_read_bool(decoder_p, wire_type);
+        switch (key) {
+
+        case PBTOOLS_KEY(2048, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->value = pbtools_decoder_read_bool_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 2048:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -467,12 +618,14 @@ void tags_message5_encode_repeated_inner(
     int field_number,
     struct tags_message5_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct tags_message5_t),
-        (pbtools_message_encode_inner_t)tags_message5_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        tags_message5_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void tags_message5_decode_repeated_inner(
@@ -480,13 +633,30 @@ void tags_message5_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct tags_message5_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct tags_message5_t),
-        (pbtools_message_init_t)tags_message5_init,
-        (pbtools_message_decode_inner_t)tags_message5_decode_inner);
+        sizeof(struct tags_message5_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        tags_message5_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        tags_message5_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct tags_message5_t *
@@ -544,17 +714,32 @@ void tags_message6_decode_inner(
     struct pbtools_decoder_t *decoder_p,
     struct tags_message6_t *self_p)
 {
+    uint32_t key;
     int wire_type;
 
     while (pbtools_decoder_available(decoder_p)) {
-        switch (pbtools_decoder_read_tag(decoder_p, &wire_type)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
 
-        case 536870911:
-            self_p->value = pbtools_decoder_read_bool(decoder_p, wire_type);
+        case PBTOOLS_KEY(536870911, PBTOOLS_WIRE_TYPE_VARINT):
+            self_p->value = pbtools_decoder_read_bool_unchecked(decoder_p);
             break;
 
         default:
-            pbtools_decoder_skip_field(decoder_p, wire_type);
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 536870911:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
             break;
         }
     }
@@ -565,12 +750,14 @@ void tags_message6_encode_repeated_inner(
     int field_number,
     struct tags_message6_repeated_t *repeated_p)
 {
-    pbtools_encode_repeated_inner(
-        encoder_p,
-        field_number,
-        (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct tags_message6_t),
-        (pbtools_message_encode_inner_t)tags_message6_encode_inner);
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        tags_message6_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
 }
 
 void tags_message6_decode_repeated_inner(
@@ -578,13 +765,30 @@ void tags_message6_decode_repeated_inner(
     struct pbtools_repeated_info_t *repeated_info_p,
     struct tags_message6_repeated_t *repeated_p)
 {
-    pbtools_decode_repeated_inner(
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
         decoder_p,
         repeated_info_p,
         (struct pbtools_repeated_message_t *)repeated_p,
-        sizeof(struct tags_message6_t),
-        (pbtools_message_init_t)tags_message6_init,
-        (pbtools_message_decode_inner_t)tags_message6_decode_inner);
+        sizeof(struct tags_message6_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        tags_message6_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        tags_message6_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
 }
 
 struct tags_message6_t *
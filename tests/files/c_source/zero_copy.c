@@ -0,0 +1,528 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by pbtools.
+ */
+
+#include <limits.h>
+#include "zero_copy.h"
+
+#if CHAR_BIT != 8
+#    error "Number of bits in a char must be 8."
+#endif
+
+void zero_copy_sub_message_init(
+    struct zero_copy_sub_message_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    pbtools_bytes_init(&self_p->v1);
+}
+
+void zero_copy_sub_message_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct zero_copy_sub_message_t *self_p)
+{
+    pbtools_encoder_write_bytes(encoder_p, 1, &self_p->v1);
+}
+
+void zero_copy_sub_message_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct zero_copy_sub_message_t *self_p)
+{
+    uint32_t key;
+    int wire_type;
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+
+        switch (key) {
+
+        case PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED):
+            pbtools_decoder_read_bytes_view_unchecked(decoder_p, &self_p->v1);
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+}
+
+void zero_copy_sub_message_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct zero_copy_sub_message_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        zero_copy_sub_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void zero_copy_sub_message_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct zero_copy_sub_message_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct zero_copy_sub_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        zero_copy_sub_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        zero_copy_sub_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+struct zero_copy_sub_message_t *
+zero_copy_sub_message_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct zero_copy_sub_message_t),
+                (pbtools_message_init_t)zero_copy_sub_message_init));
+}
+
+int zero_copy_sub_message_encode(
+    struct zero_copy_sub_message_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)zero_copy_sub_message_encode_inner));
+}
+
+int zero_copy_sub_message_decode(
+    struct zero_copy_sub_message_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)zero_copy_sub_message_decode_inner));
+}
+
+void zero_copy_message_v7_init(
+    struct zero_copy_message_t *self_p)
+{
+    self_p->v6 = zero_copy_message_v6_v7_e;
+    pbtools_bytes_init(&self_p->v7);
+}
+
+void zero_copy_message_v8_init(
+    struct zero_copy_message_t *self_p)
+{
+    self_p->v6 = zero_copy_message_v6_v8_e;
+    pbtools_bytes_init(&self_p->v8);
+}
+
+static void zero_copy_message_v7_decode(
+    struct pbtools_decoder_t *decoder_p,
+    struct zero_copy_message_t *self_p)
+{
+    zero_copy_message_v7_init(self_p);
+    pbtools_decoder_read_bytes_view_unchecked(
+        decoder_p,
+        &self_p->v7);
+}
+
+static void zero_copy_message_v8_decode(
+    struct pbtools_decoder_t *decoder_p,
+    struct zero_copy_message_t *self_p)
+{
+    zero_copy_message_v8_init(self_p);
+    pbtools_decoder_read_bytes_view_unchecked(
+        decoder_p,
+        &self_p->v8);
+}
+
+void zero_copy_message_init(
+    struct zero_copy_message_t *self_p,
+    struct pbtools_heap_t *heap_p)
+{
+    self_p->base.heap_p = heap_p;
+    pbtools_bytes_init(&self_p->v1);
+    pbtools_bytes_init(&self_p->v2);
+    self_p->v3.length = 0;
+    self_p->v4.length = 0;
+    self_p->v5.is_present = false;
+    self_p->v9_p = NULL;
+    self_p->v6 = 0;
+}
+
+void zero_copy_message_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct zero_copy_message_t *self_p)
+{
+    pbtools_encoder_sub_message_encode(
+        encoder_p,
+        9,
+        (struct pbtools_message_base_t *)self_p->v9_p,
+        (pbtools_message_encode_inner_t)zero_copy_sub_message_encode_inner);
+    if (self_p->v5.is_present) {
+        pbtools_encoder_write_bytes_always(encoder_p, 5, &self_p->v5.value);
+    }
+    pbtools_encoder_write_repeated_bytes(encoder_p, 4, &self_p->v4);
+    pbtools_encoder_write_repeated_bytes(encoder_p, 3, &self_p->v3);
+    pbtools_encoder_write_bytes(encoder_p, 2, &self_p->v2);
+    pbtools_encoder_write_bytes(encoder_p, 1, &self_p->v1);
+    switch (self_p->v6) {
+
+    case zero_copy_message_v6_v7_e:
+        pbtools_encoder_write_bytes_always(
+            encoder_p,
+            7,
+            &self_p->v7);
+        break;
+
+    case zero_copy_message_v6_v8_e:
+        pbtools_encoder_write_bytes_always(
+            encoder_p,
+            8,
+            &self_p->v8);
+        break;
+
+    default:
+        break;
+    }
+}
+
+static const uint32_t zero_copy_message_keys[8] = {
+    PBTOOLS_KEY(4, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(5, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(3, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(2, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(7, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(1, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(8, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED),
+    PBTOOLS_KEY(9, PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)
+};
+
+static const uint8_t zero_copy_message_displacements[4] = {
+    0, 0, 0, 7
+};
+
+void zero_copy_message_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct zero_copy_message_t *self_p)
+{
+    uint32_t key;
+    uint32_t hash;
+    uint32_t slot;
+    int wire_type;
+    struct pbtools_repeated_info_t repeated_info_v3;
+    struct pbtools_repeated_info_t repeated_info_v4;
+
+    pbtools_repeated_info_init(&repeated_info_v3, 3);
+    pbtools_repeated_info_init(&repeated_info_v4, 4);
+
+    while (pbtools_decoder_available(decoder_p)) {
+        key = pbtools_decoder_read_key(decoder_p);
+        hash = (key * 0x9e3779b1u);
+        slot = (((hash >> 27) & 0x7)
+                ^ zero_copy_message_displacements[hash >> 30]);
+
+        if (zero_copy_message_keys[slot] != key) {
+            slot = 8;
+        }
+
+        switch (slot) {
+
+        case 5:
+            pbtools_decoder_read_bytes_view_unchecked(decoder_p, &self_p->v1);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  2,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_2;
+            }
+
+            break;
+
+        case 3:
+        field_2:
+            pbtools_decoder_read_bytes_view_unchecked(decoder_p, &self_p->v2);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_3;
+            }
+
+            break;
+
+        case 2:
+        field_3:
+            pbtools_repeated_info_decode_bytes(
+                &repeated_info_v3,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  3,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_3;
+            }
+
+            break;
+
+        case 0:
+        field_4:
+            pbtools_repeated_info_decode_bytes(
+                &repeated_info_v4,
+                decoder_p,
+                PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  4,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_4;
+            }
+
+            break;
+
+        case 1:
+            self_p->v5.is_present = true;
+            pbtools_decoder_read_bytes_view_unchecked(decoder_p, &self_p->v5.value);
+
+            if (pbtools_decoder_read_expected_tag(decoder_p,
+                                                  9,
+                                                  PBTOOLS_WIRE_TYPE_LENGTH_DELIMITED)) {
+                goto field_9;
+            }
+
+            break;
+
+        case 7:
+        field_9:
+            pbtools_decoder_sub_message_decode_unchecked(
+                decoder_p,
+                (struct pbtools_message_base_t **)&self_p->v9_p,
+                sizeof(struct zero_copy_sub_message_t),
+                (pbtools_message_init_t)zero_copy_sub_message_init,
+                (pbtools_message_decode_inner_t)zero_copy_sub_message_decode_inner);
+            break;
+
+        case 4:
+            zero_copy_message_v7_decode(
+                decoder_p,
+                self_p);
+            break;
+
+        case 6:
+            zero_copy_message_v8_decode(
+                decoder_p,
+                self_p);
+            break;
+
+        default:
+            wire_type = (int)(key & 0x7);
+
+            switch (key >> 3) {
+
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 7:
+            case 8:
+            case 9:
+                pbtools_decoder_abort(decoder_p, PBTOOLS_BAD_WIRE_TYPE);
+                break;
+
+            default:
+                pbtools_decoder_skip_field(decoder_p, wire_type);
+                break;
+            }
+
+            break;
+        }
+    }
+
+    pbtools_decoder_decode_repeated_bytes_view(
+        decoder_p,
+        &repeated_info_v3,
+        &self_p->v3);
+    pbtools_decoder_decode_repeated_bytes_view(
+        decoder_p,
+        &repeated_info_v4,
+        &self_p->v4);
+}
+
+int zero_copy_message_v9_alloc(
+    struct zero_copy_message_t *self_p)
+{
+    return (pbtools_sub_message_alloc(
+                (struct pbtools_message_base_t **)&self_p->v9_p,
+                self_p->base.heap_p,
+                sizeof(struct zero_copy_sub_message_t),
+                (pbtools_message_init_t)zero_copy_sub_message_init));
+}
+
+int zero_copy_message_v3_alloc(
+    struct zero_copy_message_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_bytes(
+                &self_p->base,
+                length,
+                &self_p->v3));
+}
+
+int zero_copy_message_v4_alloc(
+    struct zero_copy_message_t *self_p,
+    int length)
+{
+    return (pbtools_alloc_repeated_bytes(
+                &self_p->base,
+                length,
+                &self_p->v4));
+}
+
+void zero_copy_message_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct zero_copy_message_repeated_t *repeated_p)
+{
+    int i;
+    int pos;
+
+    for (i = repeated_p->length - 1; i >= 0; i--) {
+        pos = encoder_p->pos;
+        zero_copy_message_encode_inner(encoder_p, &repeated_p->items_p[i]);
+        pbtools_encoder_write_sub_message_length(encoder_p, field_number, pos);
+    }
+}
+
+void zero_copy_message_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct zero_copy_message_repeated_t *repeated_p)
+{
+    struct pbtools_repeated_iterator_t iterator;
+    struct pbtools_decoder_t decoder;
+    int i;
+
+    if (repeated_info_p->length == 0) {
+        return;
+    }
+
+    pbtools_repeated_iterator_init(
+        &iterator,
+        decoder_p,
+        repeated_info_p,
+        (struct pbtools_repeated_message_t *)repeated_p,
+        sizeof(struct zero_copy_message_t));
+
+    for (i = 0; i < repeated_p->length; i++) {
+        zero_copy_message_init(&repeated_p->items_p[i], decoder_p->heap_p);
+    }
+
+    while (pbtools_repeated_iterator_next(&iterator, &decoder)) {
+        zero_copy_message_decode_inner(
+            &decoder,
+            &repeated_p->items_p[iterator.length]);
+    }
+}
+
+struct zero_copy_message_t *
+zero_copy_message_new(
+    void *workspace_p,
+    size_t size)
+{
+    return (pbtools_message_new(
+                workspace_p,
+                size,
+                sizeof(struct zero_copy_message_t),
+                (pbtools_message_init_t)zero_copy_message_init));
+}
+
+int zero_copy_message_encode(
+    struct zero_copy_message_t *self_p,
+    uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_encode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_encode_inner_t)zero_copy_message_encode_inner));
+}
+
+int zero_copy_message_decode(
+    struct zero_copy_message_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    return (pbtools_message_decode(
+                &self_p->base,
+                encoded_p,
+                size,
+                (pbtools_message_decode_inner_t)zero_copy_message_decode_inner));
+}
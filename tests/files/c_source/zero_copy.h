@@ -0,0 +1,191 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by pbtools.
+ */
+
+#ifndef ZERO_COPY_H
+#define ZERO_COPY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "pbtools.h"
+
+/**
+ * Message zero_copy.SubMessage.
+ */
+struct zero_copy_sub_message_repeated_t {
+    int length;
+    struct zero_copy_sub_message_t *items_p;
+};
+
+struct zero_copy_sub_message_t {
+    struct pbtools_message_base_t base;
+    struct pbtools_bytes_t v1;
+};
+
+/**
+ * Enum zero_copy.Message.v6.
+ */
+enum zero_copy_message_v6_e {
+    zero_copy_message_v6_none_e = 0,
+    zero_copy_message_v6_v7_e = 1,
+    zero_copy_message_v6_v8_e = 2
+};
+
+/**
+ * Message zero_copy.Message.
+ */
+struct zero_copy_message_repeated_t {
+    int length;
+    struct zero_copy_message_t *items_p;
+};
+
+struct zero_copy_message_t {
+    struct pbtools_message_base_t base;
+    struct pbtools_bytes_t v1;
+    struct pbtools_bytes_t v2;
+    struct pbtools_repeated_bytes_t v3;
+    struct pbtools_repeated_bytes_t v4;
+    struct {
+        bool is_present;
+        struct pbtools_bytes_t value;
+    } v5;
+    struct zero_copy_sub_message_t *v9_p;
+    enum zero_copy_message_v6_e v6;
+    union {
+        struct pbtools_bytes_t v7;
+        struct pbtools_bytes_t v8;
+    };
+};
+
+/**
+ * Encoding and decoding of zero_copy.SubMessage.
+ */
+struct zero_copy_sub_message_t *
+zero_copy_sub_message_new(
+    void *workspace_p,
+    size_t size);
+
+int zero_copy_sub_message_encode(
+    struct zero_copy_sub_message_t *self_p,
+    uint8_t *encoded_p,
+    size_t size);
+
+int zero_copy_sub_message_decode(
+    struct zero_copy_sub_message_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+int zero_copy_message_v3_alloc(
+    struct zero_copy_message_t *self_p,
+    int length);
+
+int zero_copy_message_v4_alloc(
+    struct zero_copy_message_t *self_p,
+    int length);
+
+int zero_copy_message_v9_alloc(
+    struct zero_copy_message_t *self_p);
+
+void zero_copy_message_v7_init(
+    struct zero_copy_message_t *self_p);
+
+void zero_copy_message_v8_init(
+    struct zero_copy_message_t *self_p);
+
+/**
+ * Encoding and decoding of zero_copy.Message.
+ */
+struct zero_copy_message_t *
+zero_copy_message_new(
+    void *workspace_p,
+    size_t size);
+
+int zero_copy_message_encode(
+    struct zero_copy_message_t *self_p,
+    uint8_t *encoded_p,
+    size_t size);
+
+int zero_copy_message_decode(
+    struct zero_copy_message_t *self_p,
+    const uint8_t *encoded_p,
+    size_t size);
+
+/* Internal functions. Do not use! */
+
+void zero_copy_sub_message_init(
+    struct zero_copy_sub_message_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void zero_copy_sub_message_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct zero_copy_sub_message_t *self_p);
+
+void zero_copy_sub_message_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct zero_copy_sub_message_t *self_p);
+
+void zero_copy_sub_message_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct zero_copy_sub_message_repeated_t *repeated_p);
+
+void zero_copy_sub_message_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct zero_copy_sub_message_repeated_t *repeated_p);
+
+void zero_copy_message_init(
+    struct zero_copy_message_t *self_p,
+    struct pbtools_heap_t *heap_p);
+
+void zero_copy_message_encode_inner(
+    struct pbtools_encoder_t *encoder_p,
+    struct zero_copy_message_t *self_p);
+
+void zero_copy_message_decode_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct zero_copy_message_t *self_p);
+
+void zero_copy_message_encode_repeated_inner(
+    struct pbtools_encoder_t *encoder_p,
+    int field_number,
+    struct zero_copy_message_repeated_t *repeated_p);
+
+void zero_copy_message_decode_repeated_inner(
+    struct pbtools_decoder_t *decoder_p,
+    struct pbtools_repeated_info_t *repeated_info_p,
+    struct zero_copy_message_repeated_t *repeated_p);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -38,6 +38,9 @@
 #include "files/c_source/map.h"
 #include "files/c_source/add_and_remove_fields.h"
 #include "files/c_source/optional_fields.h"
+#include "files/c_source/zero_copy.h"
+#include "files/c_source/lazy.h"
+#include "files/c_source/table_driven.h"
 
 #define membersof(a) (sizeof(a) / sizeof((a)[0]))
 
@@ -223,6 +226,39 @@ TEST(int32_decode_oveflow)
     }
 }
 
+TEST(int32_decode_varint_fast_and_slow_paths)
+{
+    int i;
+    int size;
+    uint8_t workspace[512];
+    struct int32_message_t *message_p;
+    struct {
+        int32_t decoded;
+        int size;
+        const char *encoded_p;
+    } datas[] = {
+        /* Slow path, less than 10 bytes left in the buffer. */
+        { 0x7f,        2, "\x08\x7f" },
+        { 0x3fff,      3, "\x08\xff\x7f" },
+        { -0x1,       11, "\x08\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01" },
+        /* Fast path, followed by an unknown field. */
+        { 0x7f,       12, "\x08\x7f\x10\x80\x80\x80\x80\x80\x80\x80\x80\x01" },
+        { 0x3fff,     13, "\x08\xff\x7f\x10\x80\x80\x80\x80\x80\x80\x80\x80\x01" },
+        { 0x10000000, 13, "\x08\x80\x80\x80\x80\x01\x10\x80\x80\x80\x80\x80\x01" },
+        { -0x1,       13, "\x08\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01\x10\x00" }
+    };
+
+    for (i = 0; i < membersof(datas); i++) {
+        message_p = int32_message_new(&workspace[0], sizeof(workspace));
+        ASSERT_NE(message_p, NULL);
+        size = int32_message_decode(message_p,
+                                    (uint8_t *)datas[i].encoded_p,
+                                    datas[i].size);
+        ASSERT_EQ(size, datas[i].size);
+        ASSERT_EQ(message_p->value, datas[i].decoded);
+    }
+}
+
 TEST(int32_decode_seek_out_of_data)
 {
     int size;
@@ -1451,6 +1487,511 @@ TEST(address_book_decode_issue_8)
     ASSERT_EQ(size, -PBTOOLS_VARINT_OVERFLOW);
 }
 
+static void address_book_on_person(void *arg_p,
+                                   const struct address_book_person_t *person_p)
+{
+    int *count_p;
+
+    count_p = arg_p;
+    ASSERT_EQ(person_p->id, *count_p);
+    ASSERT_EQ(person_p->name_p, "Kalle Kula");
+    ASSERT_EQ(person_p->phones.length, 1);
+    ASSERT_EQ(person_p->phones.items_p[0].number_p, "+46701232345");
+    (*count_p)++;
+}
+
+TEST(address_book_decode_callbacks)
+{
+    int i;
+    int size;
+    int count;
+    static uint8_t encoded[65536];
+    static uint8_t encode_workspace[262144];
+    uint8_t workspace[1024];
+    struct address_book_address_book_t *address_book_p;
+    struct address_book_person_t *person_p;
+    struct address_book_address_book_callbacks_t callbacks;
+
+    callbacks.on_people = address_book_on_person;
+
+    address_book_p = address_book_address_book_new(&encode_workspace[0],
+                                                   sizeof(encode_workspace));
+    ASSERT_NE(address_book_p, NULL);
+    ASSERT_EQ(address_book_address_book_people_alloc(address_book_p, 1000), 0);
+
+    for (i = 0; i < 1000; i++) {
+        person_p = &address_book_p->people.items_p[i];
+        person_p->name_p = "Kalle Kula";
+        person_p->id = i;
+        ASSERT_EQ(address_book_person_phones_alloc(person_p, 1), 0);
+        person_p->phones.items_p[0].number_p = "+46701232345";
+    }
+
+    size = address_book_address_book_encode(address_book_p,
+                                            &encoded[0],
+                                            sizeof(encoded));
+    ASSERT_GT(size, 0);
+
+    /* All items do not fit in the workspace. */
+    address_book_p = address_book_address_book_new(&workspace[0],
+                                                   sizeof(workspace));
+    ASSERT_NE(address_book_p, NULL);
+    ASSERT_EQ(address_book_address_book_decode(address_book_p,
+                                               &encoded[0],
+                                               (size_t)size),
+              -PBTOOLS_OUT_OF_MEMORY);
+
+    /* One item at a time does. */
+    count = 0;
+    address_book_p = address_book_address_book_new(&workspace[0],
+                                                   sizeof(workspace));
+    ASSERT_NE(address_book_p, NULL);
+    ASSERT_EQ(address_book_address_book_decode_callbacks(address_book_p,
+                                                         &encoded[0],
+                                                         (size_t)size,
+                                                         &callbacks,
+                                                         &count),
+              size);
+    ASSERT_EQ(count, 1000);
+    ASSERT_EQ(address_book_p->people.length, 0);
+}
+
+TEST(address_book_decode_segments)
+{
+    int i;
+    int size;
+    int segment_size;
+    int number_of_segments;
+    static uint8_t encoded[65536];
+    static uint8_t workspace[262144];
+    static struct pbtools_segment_t segments[65536];
+    struct address_book_address_book_t *address_book_p;
+    struct address_book_person_t *person_p;
+
+    address_book_p = address_book_address_book_new(&workspace[0],
+                                                   sizeof(workspace));
+    ASSERT_NE(address_book_p, NULL);
+    ASSERT_EQ(address_book_address_book_people_alloc(address_book_p, 1000), 0);
+
+    for (i = 0; i < 1000; i++) {
+        person_p = &address_book_p->people.items_p[i];
+        person_p->name_p = "Kalle Kula";
+        person_p->id = i;
+        ASSERT_EQ(address_book_person_phones_alloc(person_p, 1), 0);
+        person_p->phones.items_p[0].number_p = "+46701232345";
+    }
+
+    size = address_book_address_book_encode(address_book_p,
+                                            &encoded[0],
+                                            sizeof(encoded));
+    ASSERT_GT(size, 0);
+
+    /* Many people in each segment, and one byte segments where all
+       fields cross segment boundaries. */
+    for (segment_size = 1; segment_size <= 1500; segment_size += 1499) {
+        number_of_segments = 0;
+
+        for (i = 0; i < size; i += segment_size) {
+            segments[number_of_segments].buf_p = &encoded[i];
+            segments[number_of_segments].size = (size_t)segment_size;
+
+            if (i + segment_size > size) {
+                segments[number_of_segments].size = (size_t)(size - i);
+            }
+
+            number_of_segments++;
+        }
+
+        address_book_p = address_book_address_book_new(&workspace[0],
+                                                       sizeof(workspace));
+        ASSERT_NE(address_book_p, NULL);
+        ASSERT_EQ(address_book_address_book_decode_segments(address_book_p,
+                                                            &segments[0],
+                                                            number_of_segments),
+                  size);
+        ASSERT_EQ(address_book_p->people.length, 1000);
+
+        for (i = 0; i < 1000; i++) {
+            person_p = &address_book_p->people.items_p[i];
+            ASSERT_EQ(person_p->name_p, "Kalle Kula");
+            ASSERT_EQ(person_p->id, i);
+            ASSERT_EQ(person_p->phones.length, 1);
+            ASSERT_EQ(person_p->phones.items_p[0].number_p, "+46701232345");
+        }
+    }
+}
+
+TEST(address_book_decode_callbacks_no_callback)
+{
+    int size;
+    uint8_t workspace[1024];
+    struct address_book_address_book_t *address_book_p;
+    struct address_book_address_book_callbacks_t callbacks;
+
+    callbacks.on_people = NULL;
+    address_book_p = address_book_address_book_new(&workspace[0],
+                                                   sizeof(workspace));
+    ASSERT_NE(address_book_p, NULL);
+    size = address_book_address_book_decode_callbacks(
+        address_book_p,
+        (uint8_t *)"\x0a\x02\x10\x01\x0a\x02\x10\x02",
+        8,
+        &callbacks,
+        NULL);
+    ASSERT_EQ(size, 8);
+    ASSERT_EQ(address_book_p->people.length, 2);
+    ASSERT_EQ(address_book_p->people.items_p[0].id, 1);
+    ASSERT_EQ(address_book_p->people.items_p[1].id, 2);
+}
+
+static void address_book_on_person_count(
+    void *arg_p,
+    const struct address_book_person_t *person_p)
+{
+    (void)person_p;
+
+    (*(int *)arg_p)++;
+}
+
+TEST(address_book_decode_callbacks_error)
+{
+    int size;
+    int count;
+    uint8_t workspace[1024];
+    struct address_book_address_book_t *address_book_p;
+    struct address_book_address_book_callbacks_t callbacks;
+
+    callbacks.on_people = address_book_on_person_count;
+
+    /* Bad wire type in the second person. */
+    count = 0;
+    address_book_p = address_book_address_book_new(&workspace[0],
+                                                   sizeof(workspace));
+    ASSERT_NE(address_book_p, NULL);
+    size = address_book_address_book_decode_callbacks(
+        address_book_p,
+        (uint8_t *)"\x0a\x02\x10\x01\x0a\x02\x11\x01\x0a\x02\x10\x03",
+        12,
+        &callbacks,
+        &count);
+    ASSERT_EQ(size, -PBTOOLS_BAD_WIRE_TYPE);
+    ASSERT_EQ(count, 1);
+    ASSERT_EQ(address_book_p->people.length, 0);
+}
+
+TEST(address_book_decode_columns)
+{
+    int i;
+    int size;
+    static uint8_t encoded[65536];
+    static uint8_t encode_workspace[262144];
+    uint8_t workspace[8192];
+    struct address_book_address_book_t *address_book_p;
+    struct address_book_person_t *person_p;
+    struct address_book_person_columns_t people;
+    struct address_book_address_book_repeated_columns_t columns;
+
+    columns.people_p = &people;
+
+    address_book_p = address_book_address_book_new(&encode_workspace[0],
+                                                   sizeof(encode_workspace));
+    ASSERT_NE(address_book_p, NULL);
+    ASSERT_EQ(address_book_address_book_people_alloc(address_book_p, 1000), 0);
+
+    for (i = 0; i < 1000; i++) {
+        person_p = &address_book_p->people.items_p[i];
+        person_p->name_p = "Kalle Kula";
+        person_p->id = i;
+        ASSERT_EQ(address_book_person_phones_alloc(person_p, 1), 0);
+        person_p->phones.items_p[0].number_p = "+46701232345";
+    }
+
+    size = address_book_address_book_encode(address_book_p,
+                                            &encoded[0],
+                                            sizeof(encoded));
+    ASSERT_GT(size, 0);
+
+    address_book_p = address_book_address_book_new(&workspace[0],
+                                                   sizeof(workspace));
+    ASSERT_NE(address_book_p, NULL);
+    ASSERT_EQ(address_book_address_book_decode_columns(address_book_p,
+                                                       &encoded[0],
+                                                       (size_t)size,
+                                                       &columns),
+              size);
+    ASSERT_EQ(address_book_p->people.length, 0);
+    ASSERT_EQ(people.length, 1000);
+
+    /* The id of the first person is zero and not encoded. */
+    ASSERT_EQ(people.id.values_p[0], 0);
+    ASSERT_FALSE(pbtools_column_is_present(people.id.present_p, 0));
+
+    for (i = 1; i < 1000; i++) {
+        ASSERT_EQ(people.id.values_p[i], i);
+        ASSERT_TRUE(pbtools_column_is_present(people.id.present_p, i));
+    }
+}
+
+TEST(address_book_decode_columns_no_columns)
+{
+    int size;
+    uint8_t workspace[1024];
+    struct address_book_address_book_t *address_book_p;
+    struct address_book_person_columns_t people;
+    struct address_book_address_book_repeated_columns_t columns;
+
+    /* Items are stored in the message as usual. */
+    columns.people_p = NULL;
+    address_book_p = address_book_address_book_new(&workspace[0],
+                                                   sizeof(workspace));
+    ASSERT_NE(address_book_p, NULL);
+    size = address_book_address_book_decode_columns(
+        address_book_p,
+        (uint8_t *)"\x0a\x02\x10\x01\x0a\x02\x10\x02",
+        8,
+        &columns);
+    ASSERT_EQ(size, 8);
+    ASSERT_EQ(address_book_p->people.length, 2);
+    ASSERT_EQ(address_book_p->people.items_p[0].id, 1);
+    ASSERT_EQ(address_book_p->people.items_p[1].id, 2);
+
+    /* No people. */
+    people.length = 5;
+    columns.people_p = &people;
+    address_book_p = address_book_address_book_new(&workspace[0],
+                                                   sizeof(workspace));
+    ASSERT_NE(address_book_p, NULL);
+    size = address_book_address_book_decode_columns(address_book_p,
+                                                    (uint8_t *)"",
+                                                    0,
+                                                    &columns);
+    ASSERT_EQ(size, 0);
+    ASSERT_EQ(people.length, 0);
+}
+
+TEST(address_book_decode_columns_error)
+{
+    int size;
+    uint8_t workspace[256];
+    struct address_book_address_book_t *address_book_p;
+    struct address_book_person_columns_t people;
+    struct address_book_address_book_repeated_columns_t columns;
+
+    columns.people_p = &people;
+
+    /* Bad wire type in the second person. */
+    address_book_p = address_book_address_book_new(&workspace[0],
+                                                   sizeof(workspace));
+    ASSERT_NE(address_book_p, NULL);
+    size = address_book_address_book_decode_columns(
+        address_book_p,
+        (uint8_t *)"\x0a\x02\x10\x01\x0a\x02\x11\x01\x0a\x02\x10\x03",
+        12,
+        &columns);
+    ASSERT_EQ(size, -PBTOOLS_BAD_WIRE_TYPE);
+
+    /* Other fields are skipped, but must be valid. */
+    address_book_p = address_book_address_book_new(&workspace[0],
+                                                   sizeof(workspace));
+    ASSERT_NE(address_book_p, NULL);
+    size = address_book_address_book_decode_columns(
+        address_book_p,
+        (uint8_t *)"\x0a\x05\x0a\x01\x41\x10\x07\x0a\x02\x0a\x05",
+        11,
+        &columns);
+    ASSERT_EQ(size, -PBTOOLS_OUT_OF_DATA);
+
+    /* Too many people for the workspace. */
+    address_book_p = address_book_address_book_new(&workspace[0], 128);
+    ASSERT_NE(address_book_p, NULL);
+    size = address_book_address_book_decode_columns(
+        address_book_p,
+        (uint8_t *)("\x0a\x02\x10\x01\x0a\x02\x10\x02\x0a\x02\x10\x03"
+                    "\x0a\x02\x10\x04\x0a\x02\x10\x05\x0a\x02\x10\x06"
+                    "\x0a\x02\x10\x07\x0a\x02\x10\x08\x0a\x02\x10\x09"
+                    "\x0a\x02\x10\x0a\x0a\x02\x10\x0b\x0a\x02\x10\x0c"),
+        48,
+        &columns);
+    ASSERT_EQ(size, -PBTOOLS_OUT_OF_MEMORY);
+}
+
+TEST(address_book_encode_columns)
+{
+    int i;
+    int size;
+    int32_t ids[1000];
+    static uint8_t encoded[65536];
+    static uint8_t expected[65536];
+    static uint8_t workspace[65536];
+    struct address_book_address_book_t *address_book_p;
+    struct address_book_person_columns_t people;
+    struct address_book_address_book_repeated_columns_t columns;
+
+    for (i = 0; i < 1000; i++) {
+        ids[i] = i;
+    }
+
+    people.length = 1000;
+    people.id.values_p = &ids[0];
+    people.id.present_p = NULL;
+    columns.people_p = &people;
+
+    /* Same encoding as from items. */
+    address_book_p = address_book_address_book_new(&workspace[0],
+                                                   sizeof(workspace));
+    ASSERT_NE(address_book_p, NULL);
+    ASSERT_EQ(address_book_address_book_people_alloc(address_book_p, 1000), 0);
+
+    for (i = 0; i < 1000; i++) {
+        address_book_p->people.items_p[i].id = i;
+    }
+
+    size = address_book_address_book_encode(address_book_p,
+                                            &expected[0],
+                                            sizeof(expected));
+    ASSERT_GT(size, 0);
+
+    address_book_p = address_book_address_book_new(&workspace[0],
+                                                   sizeof(workspace));
+    ASSERT_NE(address_book_p, NULL);
+    ASSERT_EQ(address_book_address_book_encode_columns(address_book_p,
+                                                       &encoded[0],
+                                                       sizeof(encoded),
+                                                       &columns),
+              size);
+    ASSERT_MEMORY_EQ(&encoded[0], &expected[0], (size_t)size);
+
+    /* Too small buffer. */
+    ASSERT_EQ(address_book_address_book_encode_columns(address_book_p,
+                                                       &encoded[0],
+                                                       100,
+                                                       &columns),
+              -PBTOOLS_ENCODE_BUFFER_FULL);
+
+    /* Other fields are encoded as usual. */
+    columns.people_p = NULL;
+    ASSERT_EQ(address_book_address_book_encode_columns(address_book_p,
+                                                       &encoded[0],
+                                                       sizeof(encoded),
+                                                       &columns),
+              0);
+}
+
+TEST(address_book_view)
+{
+    int i;
+    int size;
+    uint8_t encoded[256];
+    uint8_t workspace[1024];
+    struct address_book_address_book_t *address_book_p;
+    struct address_book_person_t *person_p;
+    struct address_book_address_book_view_t view;
+    struct address_book_person_view_t person;
+    struct address_book_person_phone_number_view_t phone_number;
+    struct pbtools_view_iterator_t people;
+    struct pbtools_view_iterator_t phones;
+    struct pbtools_bytes_t value;
+
+    address_book_p = address_book_address_book_new(&workspace[0],
+                                                   sizeof(workspace));
+    ASSERT_NE(address_book_p, NULL);
+    ASSERT_EQ(address_book_address_book_people_alloc(address_book_p, 2), 0);
+
+    for (i = 0; i < 2; i++) {
+        person_p = &address_book_p->people.items_p[i];
+        person_p->name_p = "Kalle Kula";
+        person_p->id = (i + 56);
+        person_p->email_p = "";
+        ASSERT_EQ(address_book_person_phones_alloc(person_p, 2), 0);
+        person_p->phones.items_p[0].number_p = "+46701232345";
+        person_p->phones.items_p[0].type = address_book_person_home_e;
+        person_p->phones.items_p[1].number_p = "+46999999999";
+        person_p->phones.items_p[1].type = address_book_person_work_e;
+    }
+
+    size = address_book_address_book_encode(address_book_p,
+                                            &encoded[0],
+                                            sizeof(encoded));
+    ASSERT_GT(size, 0);
+
+    /* Fields are read straight from the encoded buffer. */
+    address_book_address_book_view_init(&view, &encoded[0], (size_t)size);
+    address_book_address_book_view_people_begin(&view, &people);
+
+    for (i = 0; i < 2; i++) {
+        ASSERT_TRUE(address_book_address_book_view_people_next(&people,
+                                                               &person));
+        value = address_book_person_view_get_name(&person);
+        ASSERT_EQ(value.size, 10);
+        ASSERT_MEMORY_EQ(value.buf_p, "Kalle Kula", 10);
+        ASSERT_TRUE(value.buf_p > &encoded[0]);
+        ASSERT_TRUE(value.buf_p < &encoded[size]);
+        ASSERT_EQ(address_book_person_view_get_id(&person), i + 56);
+        value = address_book_person_view_get_email(&person);
+        ASSERT_EQ(value.size, 0);
+
+        address_book_person_view_phones_begin(&person, &phones);
+        ASSERT_TRUE(address_book_person_view_phones_next(&phones,
+                                                         &phone_number));
+        value = address_book_person_phone_number_view_get_number(
+            &phone_number);
+        ASSERT_MEMORY_EQ(value.buf_p, "+46701232345", 12);
+        ASSERT_EQ(address_book_person_phone_number_view_get_type(
+                      &phone_number),
+                  address_book_person_home_e);
+        ASSERT_TRUE(address_book_person_view_phones_next(&phones,
+                                                         &phone_number));
+        value = address_book_person_phone_number_view_get_number(
+            &phone_number);
+        ASSERT_MEMORY_EQ(value.buf_p, "+46999999999", 12);
+        ASSERT_EQ(address_book_person_phone_number_view_get_type(
+                      &phone_number),
+                  address_book_person_work_e);
+        ASSERT_FALSE(address_book_person_view_phones_next(&phones,
+                                                          &phone_number));
+        ASSERT_EQ(address_book_person_view_error(&person), 0);
+    }
+
+    ASSERT_FALSE(address_book_address_book_view_people_next(&people,
+                                                            &person));
+    ASSERT_EQ(address_book_address_book_view_error(&view), 0);
+
+    /* Empty message. */
+    address_book_person_view_init(&person, NULL, 0);
+    ASSERT_EQ(address_book_person_view_get_id(&person), 0);
+    ASSERT_EQ(address_book_person_view_get_name(&person).size, 0);
+    address_book_person_view_phones_begin(&person, &phones);
+    ASSERT_FALSE(address_book_person_view_phones_next(&phones,
+                                                      &phone_number));
+    ASSERT_EQ(address_book_person_view_error(&person), 0);
+}
+
+TEST(address_book_view_error)
+{
+    struct address_book_address_book_view_t view;
+    struct address_book_person_view_t person;
+    struct pbtools_view_iterator_t people;
+
+    /* Person of five bytes with two left. */
+    address_book_address_book_view_init(&view,
+                                        (uint8_t *)"\x0a\x05\x10\x01",
+                                        4);
+    address_book_address_book_view_people_begin(&view, &people);
+    ASSERT_FALSE(address_book_address_book_view_people_next(&people,
+                                                            &person));
+    ASSERT_EQ(address_book_address_book_view_error(&view),
+              -PBTOOLS_OUT_OF_DATA);
+
+    /* Id of wrong wire type. */
+    address_book_person_view_init(&person,
+                                  (uint8_t *)"\x0a\x01\x41\x15\x01\x02\x03\x04",
+                                  8);
+    ASSERT_EQ(address_book_person_view_get_name(&person).size, 0);
+    ASSERT_EQ(address_book_person_view_get_id(&person), 0);
+    ASSERT_EQ(address_book_person_view_error(&person),
+              -PBTOOLS_BAD_WIRE_TYPE);
+}
+
 TEST(tags_1)
 {
     uint8_t encoded[128];
@@ -1850,6 +2391,37 @@ TEST(oneof_message2_v3_v1_default_value)
     ASSERT_EQ(message_p->v3_p->v1, 0);
 }
 
+TEST(oneof_message2_view)
+{
+    struct oneof_message2_view_t view;
+    struct oneof_message2_foo_view_t foo;
+    struct oneof_message_view_t message;
+
+    /* v1, v4 and then v3, which replaces v1. */
+    oneof_message2_view_init(&view,
+                             (uint8_t *)"\x08\x01\x22\x02\xb8\x03\x1a\x02\x08\x05",
+                             10);
+    ASSERT_EQ(oneof_message2_view_get_oneof1(&view),
+              oneof_message2_oneof1_v4_e);
+    ASSERT_TRUE(oneof_message2_view_get_v4(&view, &foo));
+    ASSERT_EQ(oneof_message2_foo_view_get_bar(&foo), 0);
+    ASSERT_EQ(oneof_message2_view_get_oneof2(&view),
+              oneof_message2_oneof2_v3_e);
+    ASSERT_TRUE(oneof_message2_view_get_v3(&view, &message));
+    ASSERT_EQ(oneof_message_view_get_value(&message),
+              oneof_message_value_v1_e);
+    ASSERT_EQ(oneof_message_view_get_v1(&message), 5);
+    ASSERT_FALSE(oneof_message2_view_get_v2(&view, &foo));
+    ASSERT_EQ(oneof_message2_foo_view_get_bar(&foo), 0);
+
+    /* None. */
+    oneof_message2_view_init(&view, NULL, 0);
+    ASSERT_EQ(oneof_message2_view_get_oneof1(&view),
+              oneof_message2_oneof1_none_e);
+    ASSERT_EQ(oneof_message2_view_get_oneof2(&view),
+              oneof_message2_oneof2_none_e);
+}
+
 TEST(oneof_message2_v4_default_value)
 {
     uint8_t encoded[128];
@@ -2066,7 +2638,7 @@ TEST(repeated_int32s_decode_zero_items)
 TEST(repeated_int32s_decode_error_out_of_memory)
 {
     int size;
-    uint8_t workspace[128];
+    uint8_t workspace[256];
     struct repeated_message_t *message_p;
 
     message_p = repeated_message_new(&workspace[0], sizeof(workspace));
@@ -2157,53 +2729,277 @@ TEST(repeated_int32s_decode_mixed_packed_and_not_packed)
     ASSERT_EQ(message_p->int32s.items_p[6], 7);
 }
 
-TEST(repeated_fixed32_decode_mixed_packed_and_not_packed)
+TEST(repeated_int32s_decode_storage)
 {
     int size;
-    uint8_t workspace[1024];
+    int32_t items[7];
+    uint8_t workspace[512];
     struct repeated_message_scalar_value_types_t *message_p;
 
     message_p = repeated_message_scalar_value_types_new(&workspace[0],
                                                         sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(repeated_message_scalar_value_types_int32s_set_storage(
+                  message_p,
+                  &items[0],
+                  7),
+              0);
     size = repeated_message_scalar_value_types_decode(
         message_p,
-        (uint8_t *)
-        "\x3d\x01\x00\x00\x00\x3a\x14\x02\x00\x00"
-        "\x00\x03\x00\x00\x00\x04\x00\x00\x00\x05"
-        "\x00\x00\x00\x06\x00\x00\x00\x3d\x07\x00"
-        "\x00\x00",
-        32);
-    ASSERT_EQ(size, 32);
-    ASSERT_EQ(message_p->fixed32s.length, 7);
-    ASSERT_EQ(message_p->fixed32s.items_p[0], 1);
-    ASSERT_EQ(message_p->fixed32s.items_p[1], 2);
-    ASSERT_EQ(message_p->fixed32s.items_p[2], 3);
-    ASSERT_EQ(message_p->fixed32s.items_p[3], 4);
-    ASSERT_EQ(message_p->fixed32s.items_p[4], 5);
-    ASSERT_EQ(message_p->fixed32s.items_p[5], 6);
-    ASSERT_EQ(message_p->fixed32s.items_p[6], 7);
+        (uint8_t *)"\x08\x01\x0a\x05\x02\x03\x04\x05\x06\x08\x07"
+        "\x10\x08",
+        13);
+    ASSERT_EQ(size, 13);
+    ASSERT_EQ(message_p->int32s.length, 7);
+    ASSERT_EQ(message_p->int32s.items_p, &items[0]);
+    ASSERT_EQ(items[0], 1);
+    ASSERT_EQ(items[1], 2);
+    ASSERT_EQ(items[2], 3);
+    ASSERT_EQ(items[3], 4);
+    ASSERT_EQ(items[4], 5);
+    ASSERT_EQ(items[5], 6);
+    ASSERT_EQ(items[6], 7);
+    ASSERT_EQ(message_p->int64s.length, 1);
+    ASSERT_EQ(message_p->int64s.items_p[0], 8);
 }
 
-TEST(repeated_fixed64_decode_mixed_packed_and_not_packed)
+TEST(repeated_int32s_decode_storage_workspace)
 {
     int size;
-    uint8_t workspace[1024];
-    struct repeated_message_scalar_value_types_t *message_p;
+    int32_t items[100];
+    uint8_t workspace[256];
+    struct repeated_message_t *message_p;
 
-    message_p = repeated_message_scalar_value_types_new(&workspace[0],
-                                                        sizeof(workspace));
-    size = repeated_message_scalar_value_types_decode(
+    /* Does not fit in the workspace, see
+       repeated_int32s_decode_error_out_of_memory. */
+    message_p = repeated_message_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(repeated_message_int32s_set_storage(message_p, &items[0], 100),
+              0);
+    size = repeated_message_decode(
         message_p,
         (uint8_t *)
-        "\x41\x01\x00\x00\x00\x00\x00\x00\x00\x42"
-        "\x28\x02\x00\x00\x00\x00\x00\x00\x00\x03"
-        "\x00\x00\x00\x00\x00\x00\x00\x04\x00\x00"
-        "\x00\x00\x00\x00\x00\x05\x00\x00\x00\x00"
-        "\x00\x00\x00\x06\x00\x00\x00\x00\x00\x00"
-        "\x00\x41\x07\x00\x00\x00\x00\x00\x00\x00",
-        60);
-    ASSERT_EQ(size, 60);
-    ASSERT_EQ(message_p->fixed64s.length, 7);
+        "\x0a\x64"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x01",
+        102);
+    ASSERT_EQ(size, 102);
+    ASSERT_EQ(message_p->int32s.length, 100);
+    ASSERT_EQ(message_p->int32s.items_p, &items[0]);
+    ASSERT_EQ(items[0], 0);
+    ASSERT_EQ(items[99], 1);
+}
+
+TEST(repeated_int32s_decode_storage_overflow)
+{
+    int size;
+    int32_t items[6];
+    uint8_t workspace[512];
+    struct repeated_message_t *message_p;
+
+    message_p = repeated_message_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(repeated_message_int32s_set_storage(message_p, &items[0], 6),
+              0);
+    size = repeated_message_decode(
+        message_p,
+        (uint8_t *)"\x0a\x07\x01\x02\x03\x04\x05\x06\x07",
+        9);
+    ASSERT_EQ(size, -PBTOOLS_STORAGE_OVERFLOW);
+}
+
+TEST(repeated_int32s_decode_storage_out_of_memory)
+{
+    int32_t items[1];
+    uint8_t workspace[sizeof(struct pbtools_heap_t)
+                      + sizeof(struct repeated_message_t)];
+    struct repeated_message_t *message_p;
+
+    message_p = repeated_message_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(repeated_message_int32s_set_storage(message_p, &items[0], 1),
+              -1);
+}
+
+TEST(repeated_int32s_decode_scattered)
+{
+    int i;
+    int j;
+    int size;
+    uint8_t workspace[512];
+    struct pbtools_segment_t segments[3];
+    struct repeated_message_scalar_value_types_t *message_p;
+    const uint8_t *encoded_p;
+
+    encoded_p = (uint8_t *)"\x08\x01\x0a\x05\x02\x03\x04\x05\x06\x08\x07"
+        "\x10\x08";
+
+    /* Runs of the repeated fields in different segments. */
+    for (i = 0; i <= 13; i++) {
+        for (j = i; j <= 13; j++) {
+            segments[0].buf_p = &encoded_p[0];
+            segments[0].size = (size_t)i;
+            segments[1].buf_p = &encoded_p[i];
+            segments[1].size = (size_t)(j - i);
+            segments[2].buf_p = &encoded_p[j];
+            segments[2].size = (size_t)(13 - j);
+            message_p = repeated_message_scalar_value_types_new(
+                &workspace[0],
+                sizeof(workspace));
+            ASSERT_NE(message_p, NULL);
+            size = repeated_message_scalar_value_types_decode_segments(
+                message_p,
+                &segments[0],
+                3);
+            ASSERT_EQ(size, 13);
+            ASSERT_EQ(message_p->int32s.length, 7);
+            ASSERT_EQ(message_p->int32s.items_p[0], 1);
+            ASSERT_EQ(message_p->int32s.items_p[1], 2);
+            ASSERT_EQ(message_p->int32s.items_p[2], 3);
+            ASSERT_EQ(message_p->int32s.items_p[3], 4);
+            ASSERT_EQ(message_p->int32s.items_p[4], 5);
+            ASSERT_EQ(message_p->int32s.items_p[5], 6);
+            ASSERT_EQ(message_p->int32s.items_p[6], 7);
+            ASSERT_EQ(message_p->int64s.length, 1);
+            ASSERT_EQ(message_p->int64s.items_p[0], 8);
+        }
+    }
+}
+
+TEST(repeated_int32s_decode_scattered_errors)
+{
+    uint8_t workspace[512];
+    struct pbtools_segment_t segments[2];
+    struct repeated_message_t *message_p;
+
+    /* No data. */
+    segments[0].buf_p = NULL;
+    segments[0].size = 0;
+    segments[1].buf_p = NULL;
+    segments[1].size = 0;
+    message_p = repeated_message_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(repeated_message_decode_segments(message_p, &segments[0], 2), 0);
+    ASSERT_EQ(message_p->int32s.length, 0);
+
+    /* Last field is not complete. */
+    segments[0].buf_p = (uint8_t *)"\x0a\x07\x01\x02";
+    segments[0].size = 4;
+    segments[1].buf_p = (uint8_t *)"\x03";
+    segments[1].size = 1;
+    message_p = repeated_message_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(repeated_message_decode_segments(message_p, &segments[0], 2),
+              -PBTOOLS_OUT_OF_DATA);
+
+    /* Bad wire type in the second segment. */
+    segments[0].buf_p = (uint8_t *)"\x08\x01";
+    segments[0].size = 2;
+    segments[1].buf_p = (uint8_t *)"\x0f\x01";
+    segments[1].size = 2;
+    message_p = repeated_message_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(repeated_message_decode_segments(message_p, &segments[0], 2),
+              -PBTOOLS_BAD_WIRE_TYPE);
+}
+
+TEST(repeated_int32s_decode_bad_wire_type)
+{
+    int size;
+    uint8_t workspace[1024];
+    struct repeated_message_scalar_value_types_t *message_p;
+
+    /* Unknown field 31 is skipped. */
+    message_p = repeated_message_scalar_value_types_new(&workspace[0],
+                                                        sizeof(workspace));
+    size = repeated_message_scalar_value_types_decode(
+        message_p,
+        (uint8_t *)"\xf8\x01\x05\x08\x01",
+        5);
+    ASSERT_EQ(size, 5);
+    ASSERT_EQ(message_p->int32s.length, 1);
+    ASSERT_EQ(message_p->int32s.items_p[0], 1);
+
+    /* Known field 1 with 32-bit wire type. */
+    message_p = repeated_message_scalar_value_types_new(&workspace[0],
+                                                        sizeof(workspace));
+    size = repeated_message_scalar_value_types_decode(
+        message_p,
+        (uint8_t *)"\x08\x01\x0d\x01\x00\x00\x00",
+        7);
+    ASSERT_EQ(size, -PBTOOLS_BAD_WIRE_TYPE);
+}
+
+TEST(repeated_fixed32_decode_mixed_packed_and_not_packed)
+{
+    int size;
+    uint8_t workspace[1024];
+    struct repeated_message_scalar_value_types_t *message_p;
+
+    message_p = repeated_message_scalar_value_types_new(&workspace[0],
+                                                        sizeof(workspace));
+    size = repeated_message_scalar_value_types_decode(
+        message_p,
+        (uint8_t *)
+        "\x3d\x01\x00\x00\x00\x3a\x14\x02\x00\x00"
+        "\x00\x03\x00\x00\x00\x04\x00\x00\x00\x05"
+        "\x00\x00\x00\x06\x00\x00\x00\x3d\x07\x00"
+        "\x00\x00",
+        32);
+    ASSERT_EQ(size, 32);
+    ASSERT_EQ(message_p->fixed32s.length, 7);
+    ASSERT_EQ(message_p->fixed32s.items_p[0], 1);
+    ASSERT_EQ(message_p->fixed32s.items_p[1], 2);
+    ASSERT_EQ(message_p->fixed32s.items_p[2], 3);
+    ASSERT_EQ(message_p->fixed32s.items_p[3], 4);
+    ASSERT_EQ(message_p->fixed32s.items_p[4], 5);
+    ASSERT_EQ(message_p->fixed32s.items_p[5], 6);
+    ASSERT_EQ(message_p->fixed32s.items_p[6], 7);
+}
+
+TEST(repeated_fixed32_decode_packed_partial_item)
+{
+    int size;
+    uint8_t workspace[1024];
+    struct repeated_message_scalar_value_types_t *message_p;
+
+    message_p = repeated_message_scalar_value_types_new(&workspace[0],
+                                                        sizeof(workspace));
+    size = repeated_message_scalar_value_types_decode(
+        message_p,
+        (uint8_t *)"\x3a\x06\x01\x00\x00\x00\x02\x00",
+        8);
+    ASSERT_EQ(size, -PBTOOLS_OUT_OF_DATA);
+}
+
+TEST(repeated_fixed64_decode_mixed_packed_and_not_packed)
+{
+    int size;
+    uint8_t workspace[1024];
+    struct repeated_message_scalar_value_types_t *message_p;
+
+    message_p = repeated_message_scalar_value_types_new(&workspace[0],
+                                                        sizeof(workspace));
+    size = repeated_message_scalar_value_types_decode(
+        message_p,
+        (uint8_t *)
+        "\x41\x01\x00\x00\x00\x00\x00\x00\x00\x42"
+        "\x28\x02\x00\x00\x00\x00\x00\x00\x00\x03"
+        "\x00\x00\x00\x00\x00\x00\x00\x04\x00\x00"
+        "\x00\x00\x00\x00\x00\x05\x00\x00\x00\x00"
+        "\x00\x00\x00\x06\x00\x00\x00\x00\x00\x00"
+        "\x00\x41\x07\x00\x00\x00\x00\x00\x00\x00",
+        60);
+    ASSERT_EQ(size, 60);
+    ASSERT_EQ(message_p->fixed64s.length, 7);
     ASSERT_EQ(message_p->fixed64s.items_p[0], 1);
     ASSERT_EQ(message_p->fixed64s.items_p[1], 2);
     ASSERT_EQ(message_p->fixed64s.items_p[2], 3);
@@ -2483,6 +3279,281 @@ TEST(repeated_nested_decode_out_of_order)
     }
 }
 
+static int repeated_interleaved_encode(uint8_t *encoded_p, bool interleaved)
+{
+    int i;
+    int j;
+    int size;
+    int field;
+
+    size = 0;
+
+    for (i = 0; i < 40; i++) {
+        if (interleaved) {
+            field = (i % 4);
+            j = (i / 4);
+        } else {
+            field = (i / 10);
+            j = (i % 10);
+        }
+
+        switch (field) {
+
+        case 0:
+            /* int32s[j] = j, not packed. */
+            encoded_p[size++] = 0x08;
+            encoded_p[size++] = (uint8_t)j;
+            break;
+
+        case 1:
+            /* messages[j].int32s[0] = j. */
+            encoded_p[size++] = 0x12;
+            encoded_p[size++] = 3;
+            encoded_p[size++] = 0x0a;
+            encoded_p[size++] = 1;
+            encoded_p[size++] = (uint8_t)j;
+            break;
+
+        case 2:
+            /* strings[j] = "0123456789abcdefghi" with first character j. */
+            encoded_p[size++] = 0x1a;
+            encoded_p[size++] = 19;
+            memcpy(&encoded_p[size], "0123456789abcdefghi", 19);
+            encoded_p[size] = (uint8_t)('0' + j);
+            size += 19;
+            break;
+
+        default:
+            /* bytes[j] = 18 bytes of j. */
+            encoded_p[size++] = 0x22;
+            encoded_p[size++] = 18;
+            memset(&encoded_p[size], j, 18);
+            size += 18;
+            break;
+        }
+    }
+
+    return (size);
+}
+
+TEST(repeated_interleaved)
+{
+    int i;
+    int size;
+    int encoded_size;
+    uint8_t workspace[2048];
+    uint8_t encoded[512];
+    struct repeated_message_t *message_p;
+
+    encoded_size = repeated_interleaved_encode(&encoded[0], true);
+    message_p = repeated_message_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    size = repeated_message_decode(message_p, &encoded[0], (size_t)encoded_size);
+    ASSERT_EQ(size, encoded_size);
+    ASSERT_EQ(message_p->int32s.length, 10);
+    ASSERT_EQ(message_p->messages.length, 10);
+    ASSERT_EQ(message_p->strings.length, 10);
+    ASSERT_EQ(message_p->bytes.length, 10);
+
+    for (i = 0; i < 10; i++) {
+        ASSERT_EQ(message_p->int32s.items_p[i], i);
+        ASSERT_EQ(message_p->messages.items_p[i].int32s.length, 1);
+        ASSERT_EQ(message_p->messages.items_p[i].int32s.items_p[0], i);
+        ASSERT_EQ(message_p->strings.items_pp[i][0], '0' + i);
+        ASSERT_EQ(message_p->bytes.items_p[i].size, 18);
+        ASSERT_EQ(message_p->bytes.items_p[i].buf_p[17], i);
+    }
+}
+
+TEST(repeated_view)
+{
+    int i;
+    int encoded_size;
+    int32_t value;
+    uint8_t encoded[512];
+    struct repeated_message_view_t view;
+    struct repeated_message_view_t message;
+    struct pbtools_view_iterator_t int32s;
+    struct pbtools_view_iterator_t messages;
+    struct pbtools_view_iterator_t inner_int32s;
+    struct pbtools_view_iterator_t strings;
+    struct pbtools_bytes_t string;
+
+    encoded_size = repeated_interleaved_encode(&encoded[0], true);
+    repeated_message_view_init(&view, &encoded[0], (size_t)encoded_size);
+    repeated_message_view_int32s_begin(&view, &int32s);
+    repeated_message_view_messages_begin(&view, &messages);
+    repeated_message_view_strings_begin(&view, &strings);
+
+    for (i = 0; i < 10; i++) {
+        ASSERT_TRUE(repeated_message_view_int32s_next(&int32s, &value));
+        ASSERT_EQ(value, i);
+        ASSERT_TRUE(repeated_message_view_messages_next(&messages, &message));
+        repeated_message_view_int32s_begin(&message, &inner_int32s);
+        ASSERT_TRUE(repeated_message_view_int32s_next(&inner_int32s, &value));
+        ASSERT_EQ(value, i);
+        ASSERT_FALSE(repeated_message_view_int32s_next(&inner_int32s,
+                                                       &value));
+        ASSERT_TRUE(repeated_message_view_strings_next(&strings, &string));
+        ASSERT_EQ(string.size, 19);
+        ASSERT_EQ(string.buf_p[0], '0' + i);
+    }
+
+    ASSERT_FALSE(repeated_message_view_int32s_next(&int32s, &value));
+    ASSERT_FALSE(repeated_message_view_messages_next(&messages, &message));
+    ASSERT_FALSE(repeated_message_view_strings_next(&strings, &string));
+    ASSERT_EQ(repeated_message_view_error(&view), 0);
+}
+
+TEST(repeated_view_packed)
+{
+    int i;
+    int32_t value;
+    struct repeated_message_view_t view;
+    struct pbtools_view_iterator_t int32s;
+
+    /* Packed, not packed, empty packed and packed again. */
+    repeated_message_view_init(
+        &view,
+        (uint8_t *)"\x0a\x03\x01\x02\x03\x1a\x00\x08\x04\x0a\x00\x0a\x01\x05",
+        14);
+    repeated_message_view_int32s_begin(&view, &int32s);
+
+    for (i = 1; i <= 5; i++) {
+        ASSERT_TRUE(repeated_message_view_int32s_next(&int32s, &value));
+        ASSERT_EQ(value, i);
+    }
+
+    ASSERT_FALSE(repeated_message_view_int32s_next(&int32s, &value));
+    ASSERT_EQ(repeated_message_view_error(&view), 0);
+
+    /* Last item of the packed run is truncated. */
+    repeated_message_view_init(&view, (uint8_t *)"\x0a\x02\x01\x80", 4);
+    repeated_message_view_int32s_begin(&view, &int32s);
+    ASSERT_TRUE(repeated_message_view_int32s_next(&int32s, &value));
+    ASSERT_EQ(value, 1);
+    ASSERT_FALSE(repeated_message_view_int32s_next(&int32s, &value));
+    ASSERT_EQ(repeated_message_view_error(&view), -PBTOOLS_OUT_OF_DATA);
+
+    /* Bad wire type. */
+    repeated_message_view_init(&view, (uint8_t *)"\x08\x01\x0d\x01\x02\x03\x04", 7);
+    repeated_message_view_int32s_begin(&view, &int32s);
+    ASSERT_TRUE(repeated_message_view_int32s_next(&int32s, &value));
+    ASSERT_FALSE(repeated_message_view_int32s_next(&int32s, &value));
+    ASSERT_EQ(repeated_message_view_error(&view), -PBTOOLS_BAD_WIRE_TYPE);
+}
+
+TEST(repeated_view_packed_fixed64_same_as_decode)
+{
+    int i;
+    int j;
+    int size;
+    uint64_t value;
+    uint8_t workspace[1024];
+    struct repeated_message_scalar_value_types_t *message_p;
+    struct repeated_message_scalar_value_types_view_t view;
+    struct pbtools_view_iterator_t fixed64s;
+    struct {
+        int size;
+        const char *encoded_p;
+    } datas[] = {
+        /* Only a partial item. */
+        { 5, "\x42\x03\x01\x02\x03" },
+        /* A full item and a partial item. */
+        { 11, "\x42\x09\x01\x00\x00\x00\x00\x00\x00\x00\x02" },
+        /* Only a partial item between full items. */
+        {
+            25,
+            "\x42\x08\x01\x00\x00\x00\x00\x00\x00\x00"
+            "\x42\x03\x01\x02\x03"
+            "\x42\x08\x02\x00\x00\x00\x00\x00\x00\x00"
+        }
+    };
+
+    for (i = 0; i < membersof(datas); i++) {
+        message_p = repeated_message_scalar_value_types_new(
+            &workspace[0],
+            sizeof(workspace));
+        ASSERT_NE(message_p, NULL);
+        size = repeated_message_scalar_value_types_decode(
+            message_p,
+            (uint8_t *)datas[i].encoded_p,
+            (size_t)datas[i].size);
+        repeated_message_scalar_value_types_view_init(
+            &view,
+            (uint8_t *)datas[i].encoded_p,
+            (size_t)datas[i].size);
+        repeated_message_scalar_value_types_view_fixed64s_begin(&view,
+                                                                &fixed64s);
+        j = 0;
+
+        while (repeated_message_scalar_value_types_view_fixed64s_next(
+                   &fixed64s,
+                   &value)) {
+            if (size >= 0) {
+                ASSERT_LT(j, message_p->fixed64s.length);
+                ASSERT_EQ(value, message_p->fixed64s.items_p[j]);
+            }
+
+            j++;
+        }
+
+        if (size >= 0) {
+            ASSERT_EQ(repeated_message_scalar_value_types_view_error(&view),
+                      0);
+            ASSERT_EQ(j, message_p->fixed64s.length);
+        } else {
+            ASSERT_EQ(repeated_message_scalar_value_types_view_error(&view),
+                      size);
+        }
+    }
+}
+
+TEST(repeated_interleaved_same_workspace_size_as_not_interleaved)
+{
+    int workspace_size;
+    int size;
+    int encoded_size;
+    uint8_t workspace[2048];
+    uint8_t encoded[512];
+    struct repeated_message_t *message_p;
+
+    /* Find the smallest workspace for fields not interleaved. */
+    encoded_size = repeated_interleaved_encode(&encoded[0], false);
+
+    for (workspace_size = 64;
+         workspace_size < (int)sizeof(workspace);
+         workspace_size++) {
+        message_p = repeated_message_new(&workspace[0],
+                                         (size_t)workspace_size);
+
+        if (message_p == NULL) {
+            continue;
+        }
+
+        size = repeated_message_decode(message_p,
+                                       &encoded[0],
+                                       (size_t)encoded_size);
+
+        if (size == encoded_size) {
+            break;
+        }
+
+        ASSERT_EQ(size, -PBTOOLS_OUT_OF_MEMORY);
+    }
+
+    /* Temporary runs must be freed when the memory is needed. */
+    encoded_size = repeated_interleaved_encode(&encoded[0], true);
+    message_p = repeated_message_new(&workspace[0], (size_t)workspace_size);
+    ASSERT_NE(message_p, NULL);
+    size = repeated_message_decode(message_p, &encoded[0], (size_t)encoded_size);
+    ASSERT_EQ(size, encoded_size);
+    ASSERT_EQ(message_p->messages.length, 10);
+    ASSERT_EQ(message_p->messages.items_p[9].int32s.items_p[0], 9);
+    ASSERT_EQ(message_p->strings.items_pp[9][0], '9');
+    ASSERT_EQ(message_p->bytes.items_p[9].buf_p[0], 9);
+}
+
 TEST(repeated_scalar_value_types)
 {
     int size;
@@ -2864,6 +3935,173 @@ TEST(repeated_foo_enums)
     ASSERT_EQ(message_p->enums.items_p[1], repeated_b_e);
 }
 
+static uint64_t packed_varints_value(int i)
+{
+    uint64_t value;
+
+    /* A run of one byte varints followed by mixed lengths. */
+    if ((i >= 64) && (i < 160)) {
+        return ((uint64_t)i);
+    }
+
+    value = (0x9e3779b97f4a7c15ull * (uint64_t)(i + 1));
+
+    return (value >> ((value >> 58) & 0x3f));
+}
+
+TEST(repeated_scalar_value_types_packed_varints_simd)
+{
+    int i;
+    int j;
+    int size;
+    int encoded_size;
+    static uint8_t workspace[65536];
+    static uint8_t encoded[32768];
+    struct repeated_message_scalar_value_types_packed_t *message_p;
+    int simds[] = {
+        PBTOOLS_SIMD_NONE,
+        PBTOOLS_SIMD_SSE4_1,
+        PBTOOLS_SIMD_AVX2
+    };
+    int length = 300;
+
+    message_p = repeated_message_scalar_value_types_packed_new(
+        &workspace[0],
+        sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(repeated_message_scalar_value_types_packed_int32s_alloc(
+                  message_p, length), 0);
+    ASSERT_EQ(repeated_message_scalar_value_types_packed_int64s_alloc(
+                  message_p, length), 0);
+    ASSERT_EQ(repeated_message_scalar_value_types_packed_sint32s_alloc(
+                  message_p, length), 0);
+    ASSERT_EQ(repeated_message_scalar_value_types_packed_sint64s_alloc(
+                  message_p, length), 0);
+    ASSERT_EQ(repeated_message_scalar_value_types_packed_uint32s_alloc(
+                  message_p, length), 0);
+    ASSERT_EQ(repeated_message_scalar_value_types_packed_uint64s_alloc(
+                  message_p, length), 0);
+    ASSERT_EQ(repeated_message_scalar_value_types_packed_bools_alloc(
+                  message_p, length), 0);
+
+    for (i = 0; i < length; i++) {
+        message_p->int32s.items_p[i] = (int32_t)packed_varints_value(i);
+        message_p->int64s.items_p[i] = (int64_t)packed_varints_value(i);
+        message_p->sint32s.items_p[i] = (int32_t)packed_varints_value(i);
+        message_p->sint64s.items_p[i] = (int64_t)packed_varints_value(i);
+        message_p->uint32s.items_p[i] = (uint32_t)packed_varints_value(i);
+        message_p->uint64s.items_p[i] = packed_varints_value(i);
+        message_p->bools.items_p[i] = ((packed_varints_value(i) & 1) == 1);
+    }
+
+    encoded_size = repeated_message_scalar_value_types_packed_encode(
+        message_p,
+        &encoded[0],
+        sizeof(encoded));
+    ASSERT_GT(encoded_size, 0);
+
+    /* All instruction sets must give identical results. */
+    for (j = 0; j < membersof(simds); j++) {
+        pbtools_simd_select(simds[j]);
+        message_p = repeated_message_scalar_value_types_packed_new(
+            &workspace[0],
+            sizeof(workspace));
+        ASSERT_NE(message_p, NULL);
+        size = repeated_message_scalar_value_types_packed_decode(
+            message_p,
+            &encoded[0],
+            (size_t)encoded_size);
+        ASSERT_EQ(size, encoded_size);
+        ASSERT_EQ(message_p->int32s.length, length);
+        ASSERT_EQ(message_p->int64s.length, length);
+        ASSERT_EQ(message_p->sint32s.length, length);
+        ASSERT_EQ(message_p->sint64s.length, length);
+        ASSERT_EQ(message_p->uint32s.length, length);
+        ASSERT_EQ(message_p->uint64s.length, length);
+        ASSERT_EQ(message_p->bools.length, length);
+
+        for (i = 0; i < length; i++) {
+            ASSERT_EQ(message_p->int32s.items_p[i],
+                      (int32_t)packed_varints_value(i));
+            ASSERT_EQ(message_p->int64s.items_p[i],
+                      (int64_t)packed_varints_value(i));
+            ASSERT_EQ(message_p->sint32s.items_p[i],
+                      (int32_t)packed_varints_value(i));
+            ASSERT_EQ(message_p->sint64s.items_p[i],
+                      (int64_t)packed_varints_value(i));
+            ASSERT_EQ(message_p->uint32s.items_p[i],
+                      (uint32_t)packed_varints_value(i));
+            ASSERT_EQ(message_p->uint64s.items_p[i], packed_varints_value(i));
+            ASSERT_EQ(message_p->bools.items_p[i],
+                      ((packed_varints_value(i) & 1) == 1));
+        }
+    }
+
+    pbtools_simd_select(PBTOOLS_SIMD_AVX2);
+}
+
+TEST(repeated_scalar_value_types_packed_varints_simd_errors)
+{
+    int i;
+    int j;
+    int size;
+    uint8_t workspace[4096];
+    uint8_t encoded[66];
+    struct repeated_message_scalar_value_types_packed_t *message_p;
+    int simds[] = {
+        PBTOOLS_SIMD_NONE,
+        PBTOOLS_SIMD_SSE4_1,
+        PBTOOLS_SIMD_AVX2
+    };
+
+    /* 64 bytes of uint64s, with an overflowing varint in the middle. */
+    encoded[0] = 0x32;
+    encoded[1] = 64;
+
+    for (i = 0; i < 64; i++) {
+        encoded[2 + i] = (uint8_t)i;
+    }
+
+    for (i = 20; i < 31; i++) {
+        encoded[2 + i] = 0x80;
+    }
+
+    for (j = 0; j < membersof(simds); j++) {
+        pbtools_simd_select(simds[j]);
+        message_p = repeated_message_scalar_value_types_packed_new(
+            &workspace[0],
+            sizeof(workspace));
+        ASSERT_NE(message_p, NULL);
+        size = repeated_message_scalar_value_types_packed_decode(
+            message_p,
+            &encoded[0],
+            sizeof(encoded));
+        ASSERT_EQ(size, -PBTOOLS_VARINT_OVERFLOW);
+    }
+
+    /* Last varint truncated. */
+    for (i = 20; i < 31; i++) {
+        encoded[2 + i] = (uint8_t)i;
+    }
+
+    encoded[65] = 0x80;
+
+    for (j = 0; j < membersof(simds); j++) {
+        pbtools_simd_select(simds[j]);
+        message_p = repeated_message_scalar_value_types_packed_new(
+            &workspace[0],
+            sizeof(workspace));
+        ASSERT_NE(message_p, NULL);
+        size = repeated_message_scalar_value_types_packed_decode(
+            message_p,
+            &encoded[0],
+            sizeof(encoded));
+        ASSERT_EQ(size, -PBTOOLS_OUT_OF_DATA);
+    }
+
+    pbtools_simd_select(PBTOOLS_SIMD_AVX2);
+}
+
 TEST(scalar_value_types_decode_bad_wire_types)
 {
     int i;
@@ -3041,18 +4279,168 @@ TEST(skip_fixed_32)
     ASSERT_EQ(message_p->value, 1);
 }
 
-TEST(message)
+TEST(skip_varint)
 {
     int size;
-    struct message_message_t *message_p;
-    uint8_t encoded[256];
-    uint8_t workspace[1024];
+    size_t j;
+    uint8_t workspace[512];
+    struct int32_message_t *message_p;
+    int simds[] = {
+        PBTOOLS_SIMD_NONE,
+        PBTOOLS_SIMD_AVX2
+    };
 
-    message_p = message_message_new(&workspace[0], sizeof(workspace));
-    ASSERT_NE(message_p, NULL);
-    message_p->foo = message_message_b_e;
-    ASSERT_EQ(message_message_fie_alloc(message_p), 0);
-    ASSERT_EQ(message_message_fie_foo_alloc(message_p->fie_p), 0);
+    for (j = 0; j < membersof(simds); j++) {
+        pbtools_simd_select(simds[j]);
+
+        /* Longest varint, with enough bytes after it for vector
+           loads. */
+        message_p = int32_message_new(&workspace[0], sizeof(workspace));
+        ASSERT_NE(message_p, NULL);
+        size = int32_message_decode(
+            message_p,
+            (uint8_t *)("\x30\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01"
+                        "\x08\x01\x30\x00\x30\x00\x30\x00"),
+            19);
+        ASSERT_EQ(size, 19);
+        ASSERT_EQ(message_p->value, 1);
+
+        /* Too long varint. */
+        message_p = int32_message_new(&workspace[0], sizeof(workspace));
+        ASSERT_NE(message_p, NULL);
+        size = int32_message_decode(
+            message_p,
+            (uint8_t *)("\x30\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff"
+                        "\x01\x08\x01\x30\x00\x30\x00"),
+            18);
+        ASSERT_EQ(size, -PBTOOLS_VARINT_OVERFLOW);
+
+        /* Truncated varint. */
+        message_p = int32_message_new(&workspace[0], sizeof(workspace));
+        ASSERT_NE(message_p, NULL);
+        size = int32_message_decode(message_p,
+                                    (uint8_t *)"\x08\x01\x30\xff\xff",
+                                    5);
+        ASSERT_EQ(size, -PBTOOLS_OUT_OF_DATA);
+    }
+
+    pbtools_simd_select(PBTOOLS_SIMD_AVX2);
+}
+
+TEST(utf8_is_valid)
+{
+    int i;
+    int j;
+    int k;
+    uint8_t buf[100];
+    int simds[] = {
+        PBTOOLS_SIMD_NONE,
+        PBTOOLS_SIMD_SSE4_1,
+        PBTOOLS_SIMD_AVX2
+    };
+    struct data_t {
+        const char *sequence_p;
+        bool valid;
+    } datas[] = {
+        { "\x7f", true },
+        { "\xc2\x80", true },
+        { "\xdf\xbf", true },
+        { "\xe0\xa0\x80", true },
+        { "\xed\x9f\xbf", true },
+        { "\xee\x80\x80", true },
+        { "\xef\xbf\xbf", true },
+        { "\xf0\x90\x80\x80", true },
+        { "\xf4\x8f\xbf\xbf", true },
+        /* Continuation byte without a leading byte. */
+        { "\x80", false },
+        { "\xbf", false },
+        /* Overlong. */
+        { "\xc0\x80", false },
+        { "\xc1\xbf", false },
+        { "\xe0\x9f\xbf", false },
+        { "\xf0\x8f\xbf\xbf", false },
+        /* Surrogates. */
+        { "\xed\xa0\x80", false },
+        { "\xed\xbf\xbf", false },
+        /* Larger than U+10FFFF. */
+        { "\xf4\x90\x80\x80", false },
+        { "\xf5\x80\x80\x80", false },
+        { "\xff", false },
+        /* Truncated. */
+        { "\xc2", false },
+        { "\xe0\xa0", false },
+        { "\xf0\x90\x80", false },
+        /* Too long. */
+        { "\xc2\x80\x80", false }
+    };
+
+    for (i = 0; i < membersof(simds); i++) {
+        pbtools_simd_select(simds[i]);
+        ASSERT(pbtools_utf8_is_valid(NULL, 0));
+
+        /* Put each sequence at all positions in ASCII text, to cross
+           all block boundaries. */
+        for (j = 0; j < membersof(datas); j++) {
+            for (k = 0; k <= 64; k++) {
+                memset(&buf[0], 'a', sizeof(buf));
+                memcpy(&buf[k],
+                       datas[j].sequence_p,
+                       strlen(datas[j].sequence_p));
+                ASSERT_EQ(pbtools_utf8_is_valid(&buf[0], sizeof(buf)),
+                          datas[j].valid);
+                ASSERT_EQ(pbtools_utf8_is_valid(
+                              &buf[0],
+                              (size_t)k + strlen(datas[j].sequence_p)),
+                          datas[j].valid);
+            }
+        }
+    }
+
+    pbtools_simd_select(PBTOOLS_SIMD_AVX2);
+}
+
+TEST(decode_padded)
+{
+    int size;
+    uint8_t encoded[8 + PBTOOLS_PADDING];
+    uint8_t workspace[512];
+    struct int32_message_t *message_p;
+
+    /* Padding looks like a continued varint. */
+    memset(&encoded[0], 0x80, sizeof(encoded));
+    memcpy(&encoded[0], "\x08\xff\xff\xff\xff\x07\x30\x01", 8);
+
+    message_p = int32_message_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    size = int32_message_decode_padded(message_p, &encoded[0], 8);
+    ASSERT_EQ(size, 8);
+    ASSERT_EQ(message_p->value, 2147483647);
+
+    /* Truncated value. */
+    message_p = int32_message_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    size = int32_message_decode_padded(message_p, &encoded[0], 5);
+    ASSERT_EQ(size, -PBTOOLS_OUT_OF_DATA);
+
+    /* Truncated skipped field. */
+    message_p = int32_message_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    size = int32_message_decode_padded(message_p, &encoded[0], 7);
+    ASSERT_EQ(size, -PBTOOLS_OUT_OF_DATA);
+}
+
+TEST(message)
+{
+    int size;
+    struct message_message_t *message_p;
+    uint8_t encoded[256];
+    uint8_t workspace[1024];
+
+    message_p = message_message_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    message_p->foo = message_message_b_e;
+    ASSERT_EQ(message_message_fie_alloc(message_p), 0);
+    ASSERT_EQ(message_message_fie_foo_alloc(message_p->fie_p), 0);
     message_p->fie_p->foo_p->value = true;
     ASSERT_EQ(message_message_fie_foo_bar_alloc(message_p->fie_p->foo_p), 0);
     message_p->fie_p->foo_p->bar_p->fie = 8;
@@ -3287,6 +4675,78 @@ TEST(benchmark_message_3)
     ASSERT_EQ(message_p->field13.items_p[4].field2, 393211234353453ll);
 }
 
+TEST(benchmark_message_2_expected_tags)
+{
+    struct benchmark_message2_t *message_p;
+    uint8_t workspace[512];
+
+    /* All fields in declaration order. */
+    message_p = benchmark_message2_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(benchmark_message2_decode(
+                  message_p,
+                  (uint8_t *)"\x08\x01\x10\x02\x18\x04\x22\x01\x61\x28\x05"
+                  "\x30\x01",
+                  13),
+              13);
+    ASSERT_EQ(message_p->field1, benchmark_e1_e);
+    ASSERT_EQ(message_p->field2, 2);
+    ASSERT_EQ(message_p->field3, 2);
+    ASSERT_EQ(message_p->field4_p, "a");
+    ASSERT_EQ(message_p->field5, 5);
+    ASSERT_TRUE(message_p->field6);
+
+    /* Two byte tag of field 2, missing field 4 and field 6 before
+       field 5. */
+    message_p = benchmark_message2_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(benchmark_message2_decode(
+                  message_p,
+                  (uint8_t *)"\x08\x01\x90\x00\x02\x18\x04\x30\x01\x28\x05",
+                  11),
+              11);
+    ASSERT_EQ(message_p->field1, benchmark_e1_e);
+    ASSERT_EQ(message_p->field2, 2);
+    ASSERT_EQ(message_p->field3, 2);
+    ASSERT_EQ(message_p->field4_p, "");
+    ASSERT_EQ(message_p->field5, 5);
+    ASSERT_TRUE(message_p->field6);
+
+    /* Value of expected field missing. */
+    message_p = benchmark_message2_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(benchmark_message2_decode(message_p,
+                                        (uint8_t *)"\x08\x01\x10",
+                                        3),
+              -PBTOOLS_OUT_OF_DATA);
+}
+
+TEST(benchmark_sub_message_sparse_field_numbers)
+{
+    struct benchmark_sub_message_t *message_p;
+    uint8_t workspace[512];
+
+    /* Fields 300, 206, unknown 299 and 1. */
+    message_p = benchmark_sub_message_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(benchmark_sub_message_decode(
+                  message_p,
+                  (uint8_t *)"\xe0\x12\x03\xf0\x0c\x01\xd8\x12\x07\x08\x05",
+                  11),
+              11);
+    ASSERT_EQ(message_p->field300, benchmark_e3_e);
+    ASSERT_TRUE(message_p->field206);
+    ASSERT_EQ(message_p->field1, 5);
+
+    /* Field 300 with bad wire type. */
+    message_p = benchmark_sub_message_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(benchmark_sub_message_decode(message_p,
+                                           (uint8_t *)"\xe2\x12\x00",
+                                           3),
+              -PBTOOLS_BAD_WIRE_TYPE);
+}
+
 TEST(no_package)
 {
     int size;
@@ -3415,6 +4875,11 @@ TEST(error_code_to_string)
         { PBTOOLS_VARINT_OVERFLOW, "Varint overflow" },
         { PBTOOLS_SEEK_OVERFLOW, "Seek overflow" },
         { PBTOOLS_LENGTH_DELIMITED_OVERFLOW, "Length delimited overflow" },
+        { PBTOOLS_NESTING_TOO_DEEP, "Nesting too deep" },
+        { PBTOOLS_REPEATED_FIELD_TOO_LONG, "Repeated field too long" },
+        { PBTOOLS_MEMORY_LIMIT_EXCEEDED, "Memory limit exceeded" },
+        { PBTOOLS_BAD_UTF8, "Bad UTF-8" },
+        { PBTOOLS_STORAGE_OVERFLOW, "Storage overflow" },
         { 99999, "Unknown error" }
     };
 
@@ -3746,3 +5211,1386 @@ TEST(optional_fields_3)
     ASSERT_TRUE(message_p->v6.is_present);
     ASSERT_EQ(message_p->v6.value, optional_fields_a_e);
 }
+
+TEST(optional_fields_view)
+{
+    struct optional_fields_message_view_t view;
+
+    /* v1 is present and zero, v6 is not present. */
+    optional_fields_message_view_init(&view, (uint8_t *)"\x08\x00\x20\x07", 4);
+    ASSERT_TRUE(optional_fields_message_view_has_v1(&view));
+    ASSERT_EQ(optional_fields_message_view_get_v1(&view), 0);
+    ASSERT_FALSE(optional_fields_message_view_has_v2(&view));
+    ASSERT_FALSE(optional_fields_message_view_get_v2(&view));
+    ASSERT_EQ(optional_fields_message_view_get_v4(&view), 7);
+    ASSERT_FALSE(optional_fields_message_view_has_v6(&view));
+    ASSERT_EQ(optional_fields_message_view_get_v6(&view), optional_fields_a_e);
+}
+
+static bool is_view(struct pbtools_bytes_t *bytes_p,
+                    uint8_t *encoded_p,
+                    int size)
+{
+    return ((bytes_p->buf_p >= encoded_p)
+            && (&bytes_p->buf_p[bytes_p->size] <= &encoded_p[size]));
+}
+
+TEST(zero_copy)
+{
+    uint8_t encoded[128];
+    int size;
+    uint8_t workspace[1024];
+    struct zero_copy_message_t *message_p;
+
+    /* Encode. */
+    message_p = zero_copy_message_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    message_p->v1.buf_p = (uint8_t *)"Hello";
+    message_p->v1.size = 5;
+    message_p->v2.buf_p = (uint8_t *)"\x00\x01";
+    message_p->v2.size = 2;
+    ASSERT_EQ(zero_copy_message_v3_alloc(message_p, 2), 0);
+    message_p->v3.items_p[0].buf_p = (uint8_t *)"a";
+    message_p->v3.items_p[0].size = 1;
+    message_p->v3.items_p[1].buf_p = (uint8_t *)"bc";
+    message_p->v3.items_p[1].size = 2;
+    ASSERT_EQ(zero_copy_message_v4_alloc(message_p, 1), 0);
+    message_p->v4.items_p[0].buf_p = (uint8_t *)"\x02";
+    message_p->v4.items_p[0].size = 1;
+    message_p->v5.is_present = true;
+    message_p->v5.value.buf_p = (uint8_t *)"def";
+    message_p->v5.value.size = 3;
+    zero_copy_message_v7_init(message_p);
+    message_p->v7.buf_p = (uint8_t *)"ghij";
+    message_p->v7.size = 4;
+    ASSERT_EQ(zero_copy_message_v9_alloc(message_p), 0);
+    message_p->v9_p->v1.buf_p = (uint8_t *)"k";
+    message_p->v9_p->v1.size = 1;
+    size = zero_copy_message_encode(message_p, &encoded[0], sizeof(encoded));
+    ASSERT_EQ(size, 37);
+
+    /* Decode. */
+    message_p = zero_copy_message_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(zero_copy_message_decode(message_p, &encoded[0], (size_t)size),
+              size);
+    ASSERT_EQ(message_p->v1.size, 5);
+    ASSERT_MEMORY_EQ(message_p->v1.buf_p, "Hello", 5);
+    ASSERT_TRUE(is_view(&message_p->v1, &encoded[0], size));
+    ASSERT_EQ(message_p->v2.size, 2);
+    ASSERT_MEMORY_EQ(message_p->v2.buf_p, "\x00\x01", 2);
+    ASSERT_TRUE(is_view(&message_p->v2, &encoded[0], size));
+    ASSERT_EQ(message_p->v3.length, 2);
+    ASSERT_EQ(message_p->v3.items_p[0].size, 1);
+    ASSERT_MEMORY_EQ(message_p->v3.items_p[0].buf_p, "a", 1);
+    ASSERT_TRUE(is_view(&message_p->v3.items_p[0], &encoded[0], size));
+    ASSERT_EQ(message_p->v3.items_p[1].size, 2);
+    ASSERT_MEMORY_EQ(message_p->v3.items_p[1].buf_p, "bc", 2);
+    ASSERT_TRUE(is_view(&message_p->v3.items_p[1], &encoded[0], size));
+    ASSERT_EQ(message_p->v4.length, 1);
+    ASSERT_EQ(message_p->v4.items_p[0].size, 1);
+    ASSERT_MEMORY_EQ(message_p->v4.items_p[0].buf_p, "\x02", 1);
+    ASSERT_TRUE(is_view(&message_p->v4.items_p[0], &encoded[0], size));
+    ASSERT_TRUE(message_p->v5.is_present);
+    ASSERT_EQ(message_p->v5.value.size, 3);
+    ASSERT_MEMORY_EQ(message_p->v5.value.buf_p, "def", 3);
+    ASSERT_TRUE(is_view(&message_p->v5.value, &encoded[0], size));
+    ASSERT_EQ(message_p->v6, zero_copy_message_v6_v7_e);
+    ASSERT_EQ(message_p->v7.size, 4);
+    ASSERT_MEMORY_EQ(message_p->v7.buf_p, "ghij", 4);
+    ASSERT_TRUE(is_view(&message_p->v7, &encoded[0], size));
+    ASSERT_NE(message_p->v9_p, NULL);
+    ASSERT_EQ(message_p->v9_p->v1.size, 1);
+    ASSERT_MEMORY_EQ(message_p->v9_p->v1.buf_p, "k", 1);
+    ASSERT_TRUE(is_view(&message_p->v9_p->v1, &encoded[0], size));
+}
+
+TEST(zero_copy_workspace_smaller_than_value)
+{
+    uint8_t encoded[1003];
+    uint8_t workspace[256];
+    struct zero_copy_message_t *message_p;
+    struct bytes_message_t *bytes_message_p;
+
+    encoded[0] = 0x12;
+    encoded[1] = 0xe8;
+    encoded[2] = 0x07;
+    memset(&encoded[3], 'x', 1000);
+
+    message_p = zero_copy_message_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(zero_copy_message_decode(message_p,
+                                       &encoded[0],
+                                       sizeof(encoded)),
+              sizeof(encoded));
+    ASSERT_EQ(message_p->v2.size, 1000);
+    ASSERT_EQ(message_p->v2.buf_p, &encoded[3]);
+
+    /* Copying needs room for the value in the workspace. */
+    encoded[0] = 0x0a;
+    bytes_message_p = bytes_message_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(bytes_message_p, NULL);
+    ASSERT_EQ(bytes_message_decode(bytes_message_p,
+                                   &encoded[0],
+                                   sizeof(encoded)),
+              -PBTOOLS_OUT_OF_MEMORY);
+}
+
+TEST(zero_copy_decode_out_of_data)
+{
+    uint8_t encoded[] = { 0x0a, 0x05, 'H', 'e', 'l', 'l' };
+    uint8_t workspace[512];
+    struct zero_copy_message_t *message_p;
+
+    message_p = zero_copy_message_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(zero_copy_message_decode(message_p,
+                                       &encoded[0],
+                                       sizeof(encoded)),
+              -PBTOOLS_OUT_OF_DATA);
+}
+
+TEST(lazy)
+{
+    uint8_t encoded[128];
+    int size;
+    uint8_t workspace[1024];
+    struct lazy_foo_t *message_p;
+    struct lazy_bar_t *bar_p;
+
+    /* Encode. */
+    message_p = lazy_foo_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(lazy_foo_v1_get(message_p), NULL);
+    ASSERT_EQ(lazy_foo_v1_alloc(message_p), 0);
+    bar_p = lazy_foo_v1_get(message_p);
+    ASSERT_NE(bar_p, NULL);
+    bar_p->v1 = 5;
+    bar_p->v2_p = "a";
+    ASSERT_EQ(lazy_foo_v2_alloc(message_p), 0);
+    message_p->v2_p->v1 = 6;
+    message_p->v3 = 7;
+    size = lazy_foo_encode(message_p, &encoded[0], sizeof(encoded));
+    ASSERT_EQ(size, 13);
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x0a\x05\x08\x05\x12\x01\x61\x12\x02\x08\x06\x18\x07",
+                     size);
+
+    /* Decode. Only the eager sub-message is decoded. */
+    message_p = lazy_foo_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(lazy_foo_decode(message_p, &encoded[0], (size_t)size), size);
+    ASSERT_EQ(message_p->v1.message_p, NULL);
+    ASSERT_EQ(message_p->v1.encoded_p, &encoded[2]);
+    ASSERT_EQ(message_p->v1.size, 5);
+    ASSERT_NE(message_p->v2_p, NULL);
+    ASSERT_EQ(message_p->v2_p->v1, 6);
+    ASSERT_EQ(message_p->v3, 7);
+
+    /* Decoded on first access. */
+    bar_p = lazy_foo_v1_get(message_p);
+    ASSERT_NE(bar_p, NULL);
+    ASSERT_EQ(bar_p->v1, 5);
+    ASSERT_EQ(bar_p->v2_p, "a");
+    ASSERT_EQ(lazy_foo_v1_get(message_p), bar_p);
+}
+
+TEST(lazy_encode_not_decoded)
+{
+    uint8_t encoded[128];
+    int size;
+    uint8_t workspace[1024];
+    struct lazy_foo_t *message_p;
+
+    /* Fields of the lazy sub-message in reverse order, which would
+       not be the case if it was decoded and encoded again. */
+    message_p = lazy_foo_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(lazy_foo_decode(message_p,
+                              (uint8_t *)"\x0a\x05\x12\x01\x61\x08\x05\x18\x07",
+                              9),
+              9);
+    size = lazy_foo_encode(message_p, &encoded[0], sizeof(encoded));
+    ASSERT_EQ(size, 9);
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x0a\x05\x12\x01\x61\x08\x05\x18\x07",
+                     size);
+
+    /* Encoded from the message once accessed. */
+    ASSERT_NE(lazy_foo_v1_get(message_p), NULL);
+    size = lazy_foo_encode(message_p, &encoded[0], sizeof(encoded));
+    ASSERT_EQ(size, 9);
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x0a\x05\x08\x05\x12\x01\x61\x18\x07",
+                     size);
+}
+
+TEST(lazy_decode_error_on_access)
+{
+    uint8_t workspace[1024];
+    uint8_t encoded[16];
+    int pos;
+    struct lazy_foo_t *message_p;
+
+    /* A string in the lazy sub-message does not fit. */
+    message_p = lazy_foo_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(lazy_foo_decode(message_p, (uint8_t *)"\x0a\x02\x12\x05", 4),
+              4);
+    ASSERT_EQ(lazy_foo_v1_get(message_p), NULL);
+    ASSERT_EQ(message_p->v1.size, -PBTOOLS_OUT_OF_DATA);
+
+    /* Repeated access neither decodes nor allocates again, and the
+       failed sub-message is dropped when encoding. */
+    pos = message_p->base.heap_p->pos;
+    ASSERT_EQ(lazy_foo_v1_get(message_p), NULL);
+    ASSERT_EQ(lazy_foo_v1_get(message_p), NULL);
+    ASSERT_EQ(message_p->base.heap_p->pos, pos);
+    ASSERT_EQ(lazy_foo_encode(message_p, &encoded[0], sizeof(encoded)), 0);
+
+    /* The lazy sub-message does not fit. */
+    message_p = lazy_foo_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(lazy_foo_decode(message_p, (uint8_t *)"\x0a\x02\x08", 3),
+              -PBTOOLS_OUT_OF_DATA);
+}
+
+TEST(table_driven)
+{
+    uint8_t encoded[128];
+    int size;
+    uint8_t workspace[2048];
+    struct table_driven_foo_t *message_p;
+
+    /* Encode. */
+    message_p = table_driven_foo_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    message_p->v1 = -1;
+    message_p->v2 = -2;
+    message_p->v3 = 3;
+    message_p->v4 = 4.0;
+    message_p->v5 = true;
+    message_p->v6 = table_driven_b_e;
+    message_p->v7_p = "7";
+    message_p->v8.buf_p = (uint8_t *)"\x08";
+    message_p->v8.size = 1;
+    message_p->v9.is_present = true;
+    message_p->v9.value = 0;
+    message_p->v10.is_present = true;
+    message_p->v10.value_p = "";
+    ASSERT_EQ(table_driven_foo_v11_alloc(message_p, 2), 0);
+    message_p->v11.items_p[0] = 11;
+    message_p->v11.items_p[1] = -11;
+    ASSERT_EQ(table_driven_foo_v12_alloc(message_p, 2), 0);
+    message_p->v12.items_pp[0] = "a";
+    message_p->v12.items_pp[1] = "";
+    ASSERT_EQ(table_driven_foo_v13_alloc(message_p, 2), 0);
+    message_p->v13.items_p[0].v1 = 13;
+    table_driven_bar_v2_init(&message_p->v13.items_p[1]);
+    message_p->v13.items_p[1].v2_p = "b";
+    ASSERT_EQ(table_driven_foo_v14_alloc(message_p), 0);
+    table_driven_bar_v3_init(message_p->v14_p);
+    message_p->v14_p->v3 = 14;
+    message_p->v300 = 300;
+
+    size = table_driven_foo_encode(message_p, &encoded[0], sizeof(encoded));
+    ASSERT_EQ(size, 76);
+    ASSERT_MEMORY_EQ(
+        &encoded[0],
+        "\x08\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01\x10\x03\x1d\x03\x00"
+        "\x00\x00\x21\x00\x00\x00\x00\x00\x00\x10\x40\x28\x01\x30\x01\x3a"
+        "\x01\x37\x42\x01\x08\x48\x00\x52\x00\x5a\x0b\x0b\xf5\xff\xff\xff"
+        "\xff\xff\xff\xff\xff\x01\x62\x01\x61\x62\x00\x6a\x02\x08\x0d\x6a"
+        "\x03\x12\x01\x62\x72\x02\x18\x0e\xe0\x12\xac\x02",
+        size);
+
+    /* Decode. */
+    message_p = table_driven_foo_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_foo_decode(message_p, &encoded[0], (size_t)size),
+              size);
+    ASSERT_EQ(message_p->v1, -1);
+    ASSERT_EQ(message_p->v2, -2);
+    ASSERT_EQ(message_p->v3, 3u);
+    ASSERT_EQ(message_p->v4, 4.0);
+    ASSERT_TRUE(message_p->v5);
+    ASSERT_EQ(message_p->v6, table_driven_b_e);
+    ASSERT_EQ(message_p->v7_p, "7");
+    ASSERT_EQ(message_p->v8.size, 1u);
+    ASSERT_EQ(message_p->v8.buf_p[0], 8);
+    ASSERT_TRUE(message_p->v9.is_present);
+    ASSERT_EQ(message_p->v9.value, 0);
+    ASSERT_TRUE(message_p->v10.is_present);
+    ASSERT_EQ(message_p->v10.value_p, "");
+    ASSERT_EQ(message_p->v11.length, 2);
+    ASSERT_EQ(message_p->v11.items_p[0], 11);
+    ASSERT_EQ(message_p->v11.items_p[1], -11);
+    ASSERT_EQ(message_p->v12.length, 2);
+    ASSERT_EQ(message_p->v12.items_pp[0], "a");
+    ASSERT_EQ(message_p->v12.items_pp[1], "");
+    ASSERT_EQ(message_p->v13.length, 2);
+    ASSERT_EQ(message_p->v13.items_p[0].v1, 13);
+    ASSERT_EQ(message_p->v13.items_p[0].value, table_driven_bar_value_none_e);
+    ASSERT_EQ(message_p->v13.items_p[1].value, table_driven_bar_value_v2_e);
+    ASSERT_EQ(message_p->v13.items_p[1].v2_p, "b");
+    ASSERT_NE(message_p->v14_p, NULL);
+    ASSERT_EQ(message_p->v14_p->value, table_driven_bar_value_v3_e);
+    ASSERT_EQ(message_p->v14_p->v3, 14);
+    ASSERT_EQ(message_p->v300, 300u);
+}
+
+TEST(table_driven_decode_any_order)
+{
+    uint8_t workspace[1024];
+    struct table_driven_foo_t *message_p;
+    struct table_driven_unordered_t *unordered_p;
+    struct pbtools_stream_decoder_t decoder;
+    const uint8_t *encoded_p;
+
+    /* Field 300, unknown field 20, field 12, field 1 and field 12. */
+    message_p = table_driven_foo_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_foo_decode(
+                  message_p,
+                  (uint8_t *)"\xe0\x12\x01\xa0\x01\x05\x62\x01\x61\x08\x02"
+                  "\x62\x01\x62",
+                  14),
+              14);
+    ASSERT_EQ(message_p->v1, 2);
+    ASSERT_EQ(message_p->v12.length, 2);
+    ASSERT_EQ(message_p->v12.items_pp[0], "a");
+    ASSERT_EQ(message_p->v12.items_pp[1], "b");
+    ASSERT_FALSE(message_p->v9.is_present);
+    ASSERT_EQ(message_p->v14_p, NULL);
+    ASSERT_EQ(message_p->v300, 1u);
+
+    /* Bad wire type of the expected field. */
+    message_p = table_driven_foo_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_foo_decode(message_p,
+                                      (uint8_t *)"\x08\x01\x15\x01",
+                                      4),
+              -PBTOOLS_BAD_WIRE_TYPE);
+
+    /* Fields 1, unknown field 4, 2 and 3 of a table not in field
+       number order. */
+    encoded_p = (uint8_t *)"\x08\x01\x20\x04\x10\x02\x18\x03";
+    unordered_p = table_driven_unordered_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(unordered_p, NULL);
+    ASSERT_EQ(table_driven_unordered_decode(unordered_p, encoded_p, 8), 8);
+    ASSERT_EQ(unordered_p->v1, 1);
+    ASSERT_EQ(unordered_p->v2, 2);
+    ASSERT_EQ(unordered_p->v3, 3);
+    ASSERT_EQ(table_driven_unordered_validate(encoded_p, 8), 8);
+
+    unordered_p = table_driven_unordered_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(unordered_p, NULL);
+    table_driven_unordered_decoder_init(&decoder, unordered_p);
+    ASSERT_EQ(table_driven_unordered_decoder_feed(&decoder, encoded_p, 8), 0);
+    ASSERT_EQ(table_driven_unordered_decoder_finish(&decoder), 8);
+    ASSERT_EQ(unordered_p->v1, 1);
+    ASSERT_EQ(unordered_p->v2, 2);
+    ASSERT_EQ(unordered_p->v3, 3);
+}
+
+static void table_driven_foo_fill(struct table_driven_foo_t *message_p,
+                                  int32_t value)
+{
+    message_p->v1 = value;
+    message_p->v2 = -value;
+    message_p->v4 = 4.5;
+    message_p->v7_p = "seven";
+    message_p->v8.buf_p = (uint8_t *)"\x01\x02\x03";
+    message_p->v8.size = 3;
+    message_p->v10.is_present = true;
+    message_p->v10.value_p = "ten";
+    ASSERT_EQ(table_driven_foo_v11_alloc(message_p, 3), 0);
+    message_p->v11.items_p[0] = value;
+    message_p->v11.items_p[1] = -1;
+    message_p->v11.items_p[2] = 300;
+    ASSERT_EQ(table_driven_foo_v12_alloc(message_p, 2), 0);
+    message_p->v12.items_pp[0] = "a";
+    message_p->v12.items_pp[1] = "bc";
+    ASSERT_EQ(table_driven_foo_v13_alloc(message_p, 1), 0);
+    table_driven_bar_v2_init(&message_p->v13.items_p[0]);
+    message_p->v13.items_p[0].v2_p = "bar";
+    ASSERT_EQ(table_driven_foo_v14_alloc(message_p), 0);
+    message_p->v14_p->v1 = value;
+}
+
+static void table_driven_foo_assert(struct table_driven_foo_t *message_p,
+                                    int32_t value)
+{
+    ASSERT_EQ(message_p->v1, value);
+    ASSERT_EQ(message_p->v2, -value);
+    ASSERT_EQ(message_p->v4, 4.5);
+    ASSERT_EQ(message_p->v7_p, "seven");
+    ASSERT_EQ(message_p->v8.size, 3u);
+    ASSERT_MEMORY_EQ(message_p->v8.buf_p, "\x01\x02\x03", 3);
+    ASSERT_FALSE(message_p->v9.is_present);
+    ASSERT_TRUE(message_p->v10.is_present);
+    ASSERT_EQ(message_p->v10.value_p, "ten");
+    ASSERT_EQ(message_p->v11.length, 3);
+    ASSERT_EQ(message_p->v11.items_p[0], value);
+    ASSERT_EQ(message_p->v11.items_p[1], -1);
+    ASSERT_EQ(message_p->v11.items_p[2], 300);
+    ASSERT_EQ(message_p->v12.length, 2);
+    ASSERT_EQ(message_p->v12.items_pp[0], "a");
+    ASSERT_EQ(message_p->v12.items_pp[1], "bc");
+    ASSERT_EQ(message_p->v13.length, 1);
+    ASSERT_EQ(message_p->v13.items_p[0].value, table_driven_bar_value_v2_e);
+    ASSERT_EQ(message_p->v13.items_p[0].v2_p, "bar");
+    ASSERT_NE(message_p->v14_p, NULL);
+    ASSERT_EQ(message_p->v14_p->v1, value);
+}
+
+TEST(table_driven_stream_decode)
+{
+    uint8_t encoded[512];
+    int size;
+    int chunk_size;
+    int offset;
+    int length;
+    uint8_t workspace[4096];
+    struct table_driven_baz_t *message_p;
+    struct pbtools_stream_decoder_t decoder;
+
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_baz_v1_alloc(message_p), 0);
+    table_driven_foo_fill(message_p->v1_p, 1);
+    ASSERT_EQ(table_driven_baz_v2_alloc(message_p, 2), 0);
+    table_driven_foo_fill(&message_p->v2.items_p[0], 2);
+    table_driven_foo_fill(&message_p->v2.items_p[1], 3);
+    ASSERT_EQ(table_driven_baz_v3_alloc(message_p, 2), 0);
+    message_p->v3.items_p[0] = 1;
+    message_p->v3.items_p[1] = 0x123456789aull;
+    size = table_driven_baz_encode(message_p, &encoded[0], sizeof(encoded));
+    ASSERT_GT(size, 0);
+
+    /* Any chunk size gives the same message. */
+    for (chunk_size = 1; chunk_size <= size; chunk_size++) {
+        message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+        ASSERT_NE(message_p, NULL);
+        table_driven_baz_decoder_init(&decoder, message_p);
+
+        for (offset = 0; offset < size; offset += chunk_size) {
+            length = (size - offset);
+
+            if (length > chunk_size) {
+                length = chunk_size;
+            }
+
+            ASSERT_EQ(table_driven_baz_decoder_feed(&decoder,
+                                                    &encoded[offset],
+                                                    (size_t)length),
+                      0);
+        }
+
+        ASSERT_EQ(table_driven_baz_decoder_finish(&decoder), size);
+        ASSERT_NE(message_p->v1_p, NULL);
+        table_driven_foo_assert(message_p->v1_p, 1);
+        ASSERT_EQ(message_p->v2.length, 2);
+        table_driven_foo_assert(&message_p->v2.items_p[0], 2);
+        table_driven_foo_assert(&message_p->v2.items_p[1], 3);
+        ASSERT_EQ(message_p->v3.length, 2);
+        ASSERT_EQ(message_p->v3.items_p[0], 1u);
+        ASSERT_EQ(message_p->v3.items_p[1], 0x123456789aull);
+    }
+}
+
+TEST(table_driven_decode_masked)
+{
+    uint8_t encoded[512];
+    int size;
+    int pos;
+    uint8_t workspace[4096];
+    struct table_driven_baz_t *message_p;
+    static const int foo_1_field_numbers[] = { 1, 7, 11 };
+    static const struct pbtools_field_mask_t foo_1_mask = {
+        3, &foo_1_field_numbers[0], NULL
+    };
+    static const int foo_2_field_numbers[] = { 14 };
+    static const struct pbtools_field_mask_t foo_2_mask = {
+        1, &foo_2_field_numbers[0], NULL
+    };
+    static const int baz_field_numbers[] = { 1, 2 };
+    static const struct pbtools_field_mask_t *const baz_sub_masks[] = {
+        &foo_1_mask, &foo_2_mask
+    };
+    static const struct pbtools_field_mask_t baz_mask = {
+        2, &baz_field_numbers[0], &baz_sub_masks[0]
+    };
+
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_baz_v1_alloc(message_p), 0);
+    table_driven_foo_fill(message_p->v1_p, 1);
+    ASSERT_EQ(table_driven_baz_v2_alloc(message_p, 2), 0);
+    table_driven_foo_fill(&message_p->v2.items_p[0], 2);
+    table_driven_foo_fill(&message_p->v2.items_p[1], 3);
+    ASSERT_EQ(table_driven_baz_v3_alloc(message_p, 1), 0);
+    message_p->v3.items_p[0] = 3;
+    size = table_driven_baz_encode(message_p, &encoded[0], sizeof(encoded));
+    ASSERT_GT(size, 0);
+
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_baz_decode(message_p, &encoded[0], (size_t)size),
+              size);
+    pos = message_p->base.heap_p->pos;
+
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_baz_decode_masked(message_p,
+                                             &encoded[0],
+                                             (size_t)size,
+                                             &baz_mask),
+              size);
+    ASSERT_LT(message_p->base.heap_p->pos, pos);
+    ASSERT_NE(message_p->v1_p, NULL);
+    ASSERT_EQ(message_p->v1_p->v1, 1);
+    ASSERT_EQ(message_p->v1_p->v2, 0);
+    ASSERT_EQ(message_p->v1_p->v7_p, "seven");
+    ASSERT_EQ(message_p->v1_p->v8.size, 0u);
+    ASSERT_FALSE(message_p->v1_p->v10.is_present);
+    ASSERT_EQ(message_p->v1_p->v11.length, 3);
+    ASSERT_EQ(message_p->v1_p->v11.items_p[2], 300);
+    ASSERT_EQ(message_p->v1_p->v12.length, 0);
+    ASSERT_EQ(message_p->v1_p->v13.length, 0);
+    ASSERT_EQ(message_p->v1_p->v14_p, NULL);
+    ASSERT_EQ(message_p->v2.length, 2);
+    ASSERT_EQ(message_p->v2.items_p[1].v1, 0);
+    ASSERT_EQ(message_p->v2.items_p[1].v7_p, "");
+    ASSERT_NE(message_p->v2.items_p[1].v14_p, NULL);
+    ASSERT_EQ(message_p->v2.items_p[1].v14_p->v1, 3);
+    ASSERT_EQ(message_p->v3.length, 0);
+
+    /* Decoding without a mask decodes everything. */
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_baz_decode(message_p, &encoded[0], (size_t)size),
+              size);
+    table_driven_foo_assert(message_p->v1_p, 1);
+    ASSERT_EQ(message_p->v3.length, 1);
+}
+
+/* Returns the result of decoding given message in chunks of given
+   size. */
+static int table_driven_baz_stream_decode(struct table_driven_baz_t *message_p,
+                                          const uint8_t *encoded_p,
+                                          int size,
+                                          int chunk_size)
+{
+    struct pbtools_stream_decoder_t decoder;
+    int offset;
+    int length;
+
+    table_driven_baz_decoder_init(&decoder, message_p);
+
+    for (offset = 0; offset < size; offset += chunk_size) {
+        length = (size - offset);
+
+        if (length > chunk_size) {
+            length = chunk_size;
+        }
+
+        (void)table_driven_baz_decoder_feed(&decoder,
+                                            &encoded_p[offset],
+                                            (size_t)length);
+    }
+
+    return (table_driven_baz_decoder_finish(&decoder));
+}
+
+/* Decoding in chunks succeeds exactly when decoding all at once does,
+   and gives the same message. */
+TEST(table_driven_stream_decode_same_as_decode)
+{
+    static uint8_t workspace[65536];
+    static uint8_t stream_workspace[65536];
+    uint8_t valid[512];
+    uint8_t encoded[512];
+    int valid_size;
+    int size;
+    int chunk_size;
+    int i;
+    int j;
+    int res;
+    uint32_t random;
+    struct table_driven_baz_t *message_p;
+    struct table_driven_baz_t *stream_message_p;
+    static const uint8_t partial_fixed64[] = {
+        0x1a, 0x03, 0xac, 0x68, 0x68
+    };
+    static const uint8_t one_and_a_partial_fixed64[] = {
+        0x1a, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02
+    };
+    static const uint8_t partial_between_full_fixed64[] = {
+        0x1a, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x1a, 0x03, 0xac, 0x68, 0x68,
+        0x1a, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_baz_v1_alloc(message_p), 0);
+    table_driven_foo_fill(message_p->v1_p, 1);
+    ASSERT_EQ(table_driven_baz_v2_alloc(message_p, 1), 0);
+    table_driven_foo_fill(&message_p->v2.items_p[0], 2);
+    ASSERT_EQ(table_driven_baz_v3_alloc(message_p, 2), 0);
+    message_p->v3.items_p[0] = 1;
+    message_p->v3.items_p[1] = 2;
+    valid_size = table_driven_baz_encode(message_p,
+                                         &valid[0],
+                                         sizeof(valid));
+    ASSERT_GT(valid_size, 0);
+
+    /* A partial fixed size item is dropped if there are no full
+       items, and is an error otherwise. */
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_baz_decode(message_p, &partial_fixed64[0], 5), 5);
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_baz_decode(message_p,
+                                      &one_and_a_partial_fixed64[0],
+                                      11),
+              -PBTOOLS_OUT_OF_DATA);
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_baz_decode(message_p,
+                                      &partial_between_full_fixed64[0],
+                                      25),
+              25);
+    ASSERT_EQ(message_p->v3.length, 2);
+    ASSERT_EQ(message_p->v3.items_p[0], 1);
+    ASSERT_EQ(message_p->v3.items_p[1], 2);
+
+    for (chunk_size = 1; chunk_size <= 5; chunk_size++) {
+        stream_message_p = table_driven_baz_new(&stream_workspace[0],
+                                                sizeof(stream_workspace));
+        ASSERT_NE(stream_message_p, NULL);
+        ASSERT_EQ(table_driven_baz_stream_decode(stream_message_p,
+                                                 &partial_fixed64[0],
+                                                 5,
+                                                 chunk_size),
+                  5);
+        ASSERT_EQ(stream_message_p->v3.length, 0);
+    }
+
+    for (chunk_size = 1; chunk_size <= 11; chunk_size++) {
+        stream_message_p = table_driven_baz_new(&stream_workspace[0],
+                                                sizeof(stream_workspace));
+        ASSERT_NE(stream_message_p, NULL);
+        ASSERT_EQ(table_driven_baz_stream_decode(
+                      stream_message_p,
+                      &one_and_a_partial_fixed64[0],
+                      11,
+                      chunk_size),
+                  -PBTOOLS_OUT_OF_DATA);
+    }
+
+    for (chunk_size = 1; chunk_size <= 25; chunk_size++) {
+        stream_message_p = table_driven_baz_new(&stream_workspace[0],
+                                                sizeof(stream_workspace));
+        ASSERT_NE(stream_message_p, NULL);
+        ASSERT_EQ(table_driven_baz_stream_decode(
+                      stream_message_p,
+                      &partial_between_full_fixed64[0],
+                      25,
+                      chunk_size),
+                  25);
+        ASSERT_EQ(stream_message_p->v3.length, 2);
+        ASSERT_EQ(stream_message_p->v3.items_p[0], 1);
+        ASSERT_EQ(stream_message_p->v3.items_p[1], 2);
+    }
+
+    random = 1;
+
+    for (i = 0; i < 5000; i++) {
+        memcpy(&encoded[0], &valid[0], (size_t)valid_size);
+
+        for (j = 0; j < 3; j++) {
+            random ^= (random << 13);
+            random ^= (random >> 17);
+            random ^= (random << 5);
+            encoded[random % (uint32_t)valid_size] = (uint8_t)(random >> 24);
+        }
+
+        /* Truncate every other message. */
+        size = valid_size;
+
+        if ((i % 2) == 0) {
+            size = (int)(random >> 8) % (valid_size + 1);
+        }
+
+        message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+        ASSERT_NE(message_p, NULL);
+        res = table_driven_baz_decode(message_p, &encoded[0], (size_t)size);
+
+        for (chunk_size = 1; chunk_size <= 7; chunk_size += 3) {
+            stream_message_p = table_driven_baz_new(&stream_workspace[0],
+                                                    sizeof(stream_workspace));
+            ASSERT_NE(stream_message_p, NULL);
+
+            if (res >= 0) {
+                ASSERT_EQ(table_driven_baz_stream_decode(stream_message_p,
+                                                         &encoded[0],
+                                                         size,
+                                                         chunk_size),
+                          res);
+                ASSERT_EQ(stream_message_p->v2.length, message_p->v2.length);
+                ASSERT_EQ(stream_message_p->v3.length, message_p->v3.length);
+                ASSERT_MEMORY_EQ(stream_message_p->v3.items_p,
+                                 message_p->v3.items_p,
+                                 sizeof(uint64_t)
+                                 * (size_t)message_p->v3.length);
+            } else {
+                ASSERT_LT(table_driven_baz_stream_decode(stream_message_p,
+                                                         &encoded[0],
+                                                         size,
+                                                         chunk_size),
+                          0);
+            }
+        }
+    }
+}
+
+TEST(table_driven_stream_decode_errors)
+{
+    uint8_t workspace[1024];
+    struct table_driven_baz_t *message_p;
+    struct table_driven_foo_t *foo_p;
+    struct pbtools_stream_decoder_t decoder;
+
+    /* Ends within a sub-message. */
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    table_driven_baz_decoder_init(&decoder, message_p);
+    ASSERT_EQ(table_driven_baz_decoder_feed(&decoder,
+                                            (uint8_t *)"\x0a\x02\x08",
+                                            3),
+              0);
+    ASSERT_EQ(table_driven_baz_decoder_finish(&decoder),
+              -PBTOOLS_OUT_OF_DATA);
+
+    /* Field longer than its sub-message. */
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    table_driven_baz_decoder_init(&decoder, message_p);
+    ASSERT_EQ(table_driven_baz_decoder_feed(&decoder,
+                                            (uint8_t *)"\x0a\x02\x3a\x05",
+                                            4),
+              -PBTOOLS_OUT_OF_DATA);
+
+    /* Bad wire type. */
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    table_driven_baz_decoder_init(&decoder, message_p);
+    ASSERT_EQ(table_driven_baz_decoder_feed(&decoder,
+                                            (uint8_t *)"\x08\x01",
+                                            2),
+              -PBTOOLS_BAD_WIRE_TYPE);
+    ASSERT_EQ(table_driven_baz_decoder_finish(&decoder),
+              -PBTOOLS_BAD_WIRE_TYPE);
+
+    /* Feeding after an error gives the error. */
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    table_driven_baz_decoder_init(&decoder, message_p);
+    ASSERT_EQ(table_driven_baz_decoder_feed(&decoder,
+                                            (uint8_t *)"\x08\x01",
+                                            2),
+              -PBTOOLS_BAD_WIRE_TYPE);
+    ASSERT_EQ(table_driven_baz_decoder_feed(&decoder,
+                                            (uint8_t *)"\x0a\x00",
+                                            2),
+              -PBTOOLS_BAD_WIRE_TYPE);
+    ASSERT_EQ(table_driven_baz_decoder_finish(&decoder),
+              -PBTOOLS_BAD_WIRE_TYPE);
+
+    /* Out of memory. */
+    foo_p = table_driven_foo_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(foo_p, NULL);
+    table_driven_foo_decoder_init(&decoder, foo_p);
+    ASSERT_EQ(table_driven_foo_decoder_feed(&decoder,
+                                            (uint8_t *)"\x3a\xe8\x07",
+                                            3),
+              -PBTOOLS_OUT_OF_MEMORY);
+}
+
+TEST(table_driven_validate)
+{
+    uint8_t encoded[512];
+    int size;
+    int length;
+    uint8_t workspace[4096];
+    struct table_driven_baz_t *message_p;
+
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_baz_v1_alloc(message_p), 0);
+    table_driven_foo_fill(message_p->v1_p, 1);
+    ASSERT_EQ(table_driven_baz_v2_alloc(message_p, 2), 0);
+    table_driven_foo_fill(&message_p->v2.items_p[0], 2);
+    table_driven_foo_fill(&message_p->v2.items_p[1], 3);
+    ASSERT_EQ(table_driven_baz_v3_alloc(message_p, 2), 0);
+    message_p->v3.items_p[0] = 1;
+    message_p->v3.items_p[1] = 2;
+    size = table_driven_baz_encode(message_p, &encoded[0], sizeof(encoded));
+    ASSERT_GT(size, 0);
+    ASSERT_EQ(table_driven_baz_validate(&encoded[0], (size_t)size), size);
+
+    /* Same result as the decoder for all truncated messages. */
+    for (length = 0; length < size; length++) {
+        message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+        ASSERT_NE(message_p, NULL);
+        ASSERT_EQ(table_driven_baz_validate(&encoded[0], (size_t)length),
+                  table_driven_baz_decode(message_p,
+                                          &encoded[0],
+                                          (size_t)length));
+    }
+
+    /* Length delimited int32. */
+    ASSERT_EQ(table_driven_foo_validate((uint8_t *)"\x0a\x00", 2),
+              -PBTOOLS_BAD_WIRE_TYPE);
+
+    /* Varint sub-message. */
+    ASSERT_EQ(table_driven_baz_validate((uint8_t *)"\x08\x00", 2),
+              -PBTOOLS_BAD_WIRE_TYPE);
+
+    /* Packed fixed64 with a partial item, which is dropped. */
+    ASSERT_EQ(table_driven_baz_validate(
+                  (uint8_t *)"\x1a\x07\x00\x00\x00\x00\x00\x00\x00",
+                  9),
+              9);
+
+    /* Packed fixed64 with a partial item after a full item. */
+    ASSERT_EQ(table_driven_baz_validate(
+                  (uint8_t *)"\x1a\x09\x01\x00\x00\x00\x00\x00\x00\x00"
+                  "\x02",
+                  11),
+              -PBTOOLS_OUT_OF_DATA);
+
+    /* String as varint in a oneof of a message without a table. */
+    ASSERT_EQ(table_driven_baz_validate(
+                  (uint8_t *)"\x0a\x04\x6a\x02\x10\x01",
+                  6),
+              -PBTOOLS_BAD_WIRE_TYPE);
+
+    /* Packed int32 with a partial varint. */
+    ASSERT_EQ(table_driven_foo_validate((uint8_t *)"\x5a\x02\x01\x80", 4),
+              -PBTOOLS_OUT_OF_DATA);
+
+    /* Field number zero in a sub-message. */
+    ASSERT_EQ(table_driven_baz_validate((uint8_t *)"\x0a\x02\x00\x00", 4),
+              -PBTOOLS_BAD_FIELD_NUMBER);
+
+    /* Unknown field with a bad wire type in a message without a
+       table. */
+    ASSERT_EQ(table_driven_foo_validate((uint8_t *)"\x72\x01\x7b", 3),
+              -PBTOOLS_BAD_WIRE_TYPE);
+
+    /* Too long length. */
+    ASSERT_EQ(table_driven_foo_validate((uint8_t *)"\x3a\x02\x41", 3),
+              -PBTOOLS_OUT_OF_DATA);
+
+    /* Unknown fields are skipped. */
+    ASSERT_EQ(table_driven_foo_validate(
+                  (uint8_t *)"\x78\x01\x7d\x01\x02\x03\x04",
+                  7),
+              7);
+}
+
+/* Validation succeeds exactly when decoding does, for random
+   mutations of a valid message. The error may differ, as repeated
+   sub-messages are decoded after their parent. */
+TEST(table_driven_validate_same_as_decode)
+{
+    static uint8_t workspace[65536];
+    uint8_t valid[512];
+    uint8_t encoded[512];
+    int valid_size;
+    int size;
+    int i;
+    int j;
+    int res;
+    uint32_t random;
+    struct table_driven_baz_t *message_p;
+    static const uint8_t partial_fixed64[] = {
+        0x1a, 0x03, 0xac, 0x68, 0x68
+    };
+    static const uint8_t one_and_a_partial_fixed64[] = {
+        0x1a, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02
+    };
+    static const uint8_t partial_between_full_fixed64[] = {
+        0x1a, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x1a, 0x03, 0xac, 0x68, 0x68,
+        0x1a, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_baz_v1_alloc(message_p), 0);
+    table_driven_foo_fill(message_p->v1_p, 1);
+    ASSERT_EQ(table_driven_baz_v2_alloc(message_p, 1), 0);
+    table_driven_foo_fill(&message_p->v2.items_p[0], 2);
+    ASSERT_EQ(table_driven_baz_v3_alloc(message_p, 2), 0);
+    message_p->v3.items_p[0] = 1;
+    message_p->v3.items_p[1] = 2;
+    valid_size = table_driven_baz_encode(message_p,
+                                         &valid[0],
+                                         sizeof(valid));
+    ASSERT_GT(valid_size, 0);
+
+    /* Packed fixed64 with a partial item, without and with a full
+       item. */
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_baz_validate(&partial_fixed64[0], 5),
+              table_driven_baz_decode(message_p, &partial_fixed64[0], 5));
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_baz_validate(&one_and_a_partial_fixed64[0], 11),
+              table_driven_baz_decode(message_p,
+                                      &one_and_a_partial_fixed64[0],
+                                      11));
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_baz_validate(&partial_between_full_fixed64[0], 25),
+              table_driven_baz_decode(message_p,
+                                      &partial_between_full_fixed64[0],
+                                      25));
+    random = 1;
+
+    for (i = 0; i < 20000; i++) {
+        memcpy(&encoded[0], &valid[0], (size_t)valid_size);
+
+        for (j = 0; j < 3; j++) {
+            random ^= (random << 13);
+            random ^= (random >> 17);
+            random ^= (random << 5);
+            encoded[random % (uint32_t)valid_size] = (uint8_t)(random >> 24);
+        }
+
+        /* Truncate every other message. */
+        size = valid_size;
+
+        if ((i % 2) == 0) {
+            size = (int)(random >> 8) % (valid_size + 1);
+        }
+
+        message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+        ASSERT_NE(message_p, NULL);
+        res = table_driven_baz_decode(message_p, &encoded[0], (size_t)size);
+
+        if (res >= 0) {
+            ASSERT_EQ(table_driven_baz_validate(&encoded[0], (size_t)size),
+                      res);
+        } else {
+            ASSERT_LT(table_driven_baz_validate(&encoded[0], (size_t)size),
+                      0);
+        }
+    }
+}
+
+TEST(table_driven_decode_limited)
+{
+    uint8_t encoded[512];
+    int size;
+    int length;
+    int res;
+    uint8_t workspace[4096];
+    struct table_driven_baz_t *message_p;
+    struct pbtools_decode_limits_t limits;
+
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_baz_v1_alloc(message_p), 0);
+    table_driven_foo_fill(message_p->v1_p, 1);
+    ASSERT_EQ(table_driven_baz_v2_alloc(message_p, 2), 0);
+    table_driven_foo_fill(&message_p->v2.items_p[0], 2);
+    table_driven_foo_fill(&message_p->v2.items_p[1], 3);
+    ASSERT_EQ(table_driven_baz_v3_alloc(message_p, 2), 0);
+    message_p->v3.items_p[0] = 1;
+    message_p->v3.items_p[1] = 0x123456789aull;
+    size = table_driven_baz_encode(message_p, &encoded[0], sizeof(encoded));
+    ASSERT_GT(size, 0);
+
+    limits.max_depth = 3;
+    limits.max_repeated_length = 3;
+    limits.max_heap_size = sizeof(workspace);
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_baz_decode_limited(message_p,
+                                              &encoded[0],
+                                              (size_t)size,
+                                              &limits),
+              size);
+    ASSERT_NE(message_p->v1_p, NULL);
+    table_driven_foo_assert(message_p->v1_p, 1);
+    ASSERT_EQ(message_p->v2.length, 2);
+    table_driven_foo_assert(&message_p->v2.items_p[0], 2);
+    table_driven_foo_assert(&message_p->v2.items_p[1], 3);
+    ASSERT_EQ(message_p->v3.length, 2);
+    ASSERT_EQ(message_p->v3.items_p[0], 1u);
+    ASSERT_EQ(message_p->v3.items_p[1], 0x123456789aull);
+
+    /* Same result as the recursive decoder for all truncated
+       messages. */
+    for (length = 0; length < size; length++) {
+        message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+        ASSERT_NE(message_p, NULL);
+        res = table_driven_baz_decode(message_p, &encoded[0], (size_t)length);
+        message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+        ASSERT_NE(message_p, NULL);
+        ASSERT_EQ(table_driven_baz_decode_limited(message_p,
+                                                  &encoded[0],
+                                                  (size_t)length,
+                                                  &limits),
+                  res);
+    }
+
+    /* Bar sub-messages are decoded by code at depth three. */
+    limits.max_depth = 2;
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_baz_decode_limited(message_p,
+                                              &encoded[0],
+                                              (size_t)size,
+                                              &limits),
+              -PBTOOLS_NESTING_TOO_DEEP);
+
+    /* Three int32 items in each Foo. */
+    limits.max_depth = 3;
+    limits.max_repeated_length = 2;
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_baz_decode_limited(message_p,
+                                              &encoded[0],
+                                              (size_t)size,
+                                              &limits),
+              -PBTOOLS_REPEATED_FIELD_TOO_LONG);
+
+    limits.max_repeated_length = 3;
+    limits.max_heap_size = 1024;
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_baz_decode_limited(message_p,
+                                              &encoded[0],
+                                              (size_t)size,
+                                              &limits),
+              -PBTOOLS_MEMORY_LIMIT_EXCEEDED);
+
+    /* The rest of the workspace is available again. */
+    limits.max_heap_size = sizeof(workspace);
+    ASSERT_EQ(table_driven_baz_decode_limited(message_p,
+                                              &encoded[0],
+                                              (size_t)size,
+                                              &limits),
+              size);
+}
+
+/* Encode given number of nested nodes, each with a value and a next
+   or children sub-message. Values count down to one. */
+static int table_driven_node_encode_nested(uint8_t *encoded_p,
+                                           int size,
+                                           int depth,
+                                           bool children)
+{
+    int pos;
+    int length;
+    int value;
+
+    pos = size;
+
+    for (value = 1; value <= depth; value++) {
+        if (value > 1) {
+            length = (size - pos);
+
+            if (length >= 128) {
+                encoded_p[--pos] = (uint8_t)(length >> 7);
+                encoded_p[--pos] = (uint8_t)(0x80 | (length & 0x7f));
+            } else {
+                encoded_p[--pos] = (uint8_t)length;
+            }
+
+            encoded_p[--pos] = (children ? 0x1a : 0x12);
+        }
+
+        encoded_p[--pos] = (uint8_t)(value & 0x7f);
+        encoded_p[--pos] = 0x08;
+    }
+
+    memmove(encoded_p, &encoded_p[pos], (size_t)(size - pos));
+
+    return (size - pos);
+}
+
+TEST(table_driven_decode_limited_nested)
+{
+    static uint8_t encoded[2048];
+    static uint8_t workspace[262144];
+    int size;
+    int i;
+    int value;
+    bool children;
+    struct table_driven_node_t *message_p;
+    struct table_driven_node_t *node_p;
+    struct pbtools_decode_limits_t limits;
+
+    limits.max_depth = 200;
+    limits.max_repeated_length = 1;
+    limits.max_heap_size = sizeof(workspace);
+
+    for (i = 0; i < 2; i++) {
+        children = (i == 1);
+        size = table_driven_node_encode_nested(&encoded[0],
+                                               sizeof(encoded),
+                                               200,
+                                               children);
+        message_p = table_driven_node_new(&workspace[0], sizeof(workspace));
+        ASSERT_NE(message_p, NULL);
+        ASSERT_EQ(table_driven_node_decode_limited(message_p,
+                                                   &encoded[0],
+                                                   (size_t)size,
+                                                   &limits),
+                  size);
+        node_p = message_p;
+
+        for (value = 200; value > 1; value--) {
+            ASSERT_EQ(node_p->value, value & 0x7f);
+
+            if (children) {
+                ASSERT_EQ(node_p->children.length, 1);
+                node_p = &node_p->children.items_p[0];
+            } else {
+                ASSERT_NE(node_p->next_p, NULL);
+                node_p = node_p->next_p;
+            }
+        }
+
+        ASSERT_EQ(node_p->value, 1);
+        ASSERT_EQ(node_p->next_p, NULL);
+        ASSERT_EQ(node_p->children.length, 0);
+
+        /* One level too deep. */
+        size = table_driven_node_encode_nested(&encoded[0],
+                                               sizeof(encoded),
+                                               201,
+                                               children);
+        message_p = table_driven_node_new(&workspace[0], sizeof(workspace));
+        ASSERT_NE(message_p, NULL);
+        ASSERT_EQ(table_driven_node_decode_limited(message_p,
+                                                   &encoded[0],
+                                                   (size_t)size,
+                                                   &limits),
+                  -PBTOOLS_NESTING_TOO_DEEP);
+    }
+}
+
+static void table_driven_on_child(void *arg_p,
+                                  const struct table_driven_node_t *node_p)
+{
+    int *count_p;
+
+    count_p = arg_p;
+
+    if (*count_p == 0) {
+        ASSERT_EQ(node_p->value, 2);
+        ASSERT_EQ(node_p->children.length, 1);
+        ASSERT_EQ(node_p->children.items_p[0].value, 3);
+    } else {
+        ASSERT_EQ(node_p->value, 4);
+        ASSERT_EQ(node_p->children.length, 0);
+    }
+
+    (*count_p)++;
+}
+
+TEST(table_driven_decode_callbacks)
+{
+    int count;
+    uint8_t workspace[512];
+    struct table_driven_node_t *message_p;
+    struct table_driven_node_callbacks_t callbacks;
+
+    callbacks.on_children = table_driven_on_child;
+
+    /* Only children of the top level node are given to the
+       callback. */
+    count = 0;
+    message_p = table_driven_node_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_node_decode_callbacks(
+                  message_p,
+                  (uint8_t *)("\x08\x01\x1a\x06\x08\x02\x1a\x02\x08\x03"
+                              "\x1a\x02\x08\x04"),
+                  14,
+                  &callbacks,
+                  &count),
+              14);
+    ASSERT_EQ(count, 2);
+    ASSERT_EQ(message_p->value, 1);
+    ASSERT_EQ(message_p->children.length, 0);
+}
+
+TEST(table_driven_decode_columns)
+{
+    uint8_t workspace[512];
+    struct table_driven_node_t *message_p;
+    struct table_driven_node_columns_t children;
+    struct table_driven_node_repeated_columns_t columns;
+
+    columns.children_p = &children;
+
+    /* Only children of the top level node are decoded into columns,
+       and their children are skipped. */
+    message_p = table_driven_node_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_node_decode_columns(
+                  message_p,
+                  (uint8_t *)("\x08\x01\x1a\x06\x08\x02\x1a\x02\x08\x03"
+                              "\x1a\x02\x08\x04"),
+                  14,
+                  &columns),
+              14);
+    ASSERT_EQ(message_p->value, 1);
+    ASSERT_EQ(message_p->children.length, 0);
+    ASSERT_EQ(children.length, 2);
+    ASSERT_EQ(children.value.values_p[0], 2);
+    ASSERT_EQ(children.value.values_p[1], 4);
+    ASSERT_TRUE(pbtools_column_is_present(children.value.present_p, 0));
+    ASSERT_TRUE(pbtools_column_is_present(children.value.present_p, 1));
+}
+
+TEST(table_driven_encode_columns)
+{
+    int size;
+    uint8_t encoded[128];
+    uint8_t workspace[1024];
+    int32_t v1[3];
+    int32_t v9[3];
+    uint8_t v9_present;
+    struct table_driven_baz_t *message_p;
+    struct table_driven_foo_columns_t foos;
+    struct table_driven_baz_repeated_columns_t columns;
+
+    memset(&foos, 0, sizeof(foos));
+    v1[0] = 1;
+    v1[1] = 0;
+    v1[2] = -3;
+    v9[0] = 0;
+    v9[1] = 5;
+    v9[2] = 6;
+    v9_present = 0x3;
+    foos.length = 3;
+    foos.v1.values_p = &v1[0];
+    foos.v9.values_p = &v9[0];
+    foos.v9.present_p = &v9_present;
+    columns.v2_p = &foos;
+
+    /* Rows are encoded after the items in the message. */
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_baz_v3_alloc(message_p, 1), 0);
+    message_p->v3.items_p[0] = 7;
+    size = table_driven_baz_encode_columns(message_p,
+                                           &encoded[0],
+                                           sizeof(encoded),
+                                           &columns);
+    ASSERT_EQ(size, 33);
+
+    message_p = table_driven_baz_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_baz_decode(message_p, &encoded[0], (size_t)size),
+              size);
+    ASSERT_EQ(message_p->v3.length, 1);
+    ASSERT_EQ(message_p->v3.items_p[0], 7);
+    ASSERT_EQ(message_p->v2.length, 3);
+    ASSERT_EQ(message_p->v2.items_p[0].v1, 1);
+    ASSERT_TRUE(message_p->v2.items_p[0].v9.is_present);
+    ASSERT_EQ(message_p->v2.items_p[0].v9.value, 0);
+    ASSERT_EQ(message_p->v2.items_p[1].v1, 0);
+    ASSERT_TRUE(message_p->v2.items_p[1].v9.is_present);
+    ASSERT_EQ(message_p->v2.items_p[1].v9.value, 5);
+    ASSERT_EQ(message_p->v2.items_p[2].v1, -3);
+    ASSERT_FALSE(message_p->v2.items_p[2].v9.is_present);
+    ASSERT_EQ(message_p->v2.items_p[2].v2, 0);
+}
+
+TEST(table_driven_decode_storage)
+{
+    int32_t items[2];
+    uint8_t workspace[512];
+    struct table_driven_foo_t *message_p;
+
+    message_p = table_driven_foo_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_foo_v11_set_storage(message_p, &items[0], 2), 0);
+    ASSERT_EQ(table_driven_foo_decode(
+                  message_p,
+                  (uint8_t *)"\x5a\x0b\x0b\xf5\xff\xff\xff\xff\xff\xff"
+                  "\xff\xff\x01",
+                  13),
+              13);
+    ASSERT_EQ(message_p->v11.length, 2);
+    ASSERT_EQ(message_p->v11.items_p, &items[0]);
+    ASSERT_EQ(items[0], 11);
+    ASSERT_EQ(items[1], -11);
+
+    message_p = table_driven_foo_new(&workspace[0], sizeof(workspace));
+    ASSERT_NE(message_p, NULL);
+    ASSERT_EQ(table_driven_foo_v11_set_storage(message_p, &items[0], 1), 0);
+    ASSERT_EQ(table_driven_foo_decode(
+                  message_p,
+                  (uint8_t *)"\x5a\x0b\x0b\xf5\xff\xff\xff\xff\xff\xff"
+                  "\xff\xff\x01",
+                  13),
+              -PBTOOLS_STORAGE_OVERFLOW);
+}
+
+TEST(table_driven_decode_segments)
+{
+    int i;
+    uint8_t workspace[2048];
+    struct pbtools_segment_t segments[2];
+    struct table_driven_foo_t *message_p;
+    const uint8_t *encoded_p;
+
+    encoded_p = (uint8_t *)
+        "\x08\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01\x10\x03\x1d\x03\x00"
+        "\x00\x00\x21\x00\x00\x00\x00\x00\x00\x10\x40\x28\x01\x30\x01\x3a"
+        "\x01\x37\x42\x01\x08\x48\x00\x52\x00\x5a\x0b\x0b\xf5\xff\xff\xff"
+        "\xff\xff\xff\xff\xff\x01\x62\x01\x61\x62\x00\x6a\x02\x08\x0d\x6a"
+        "\x03\x12\x01\x62\x72\x02\x18\x0e\xe0\x12\xac\x02";
+
+    for (i = 0; i <= 76; i++) {
+        segments[0].buf_p = &encoded_p[0];
+        segments[0].size = (size_t)i;
+        segments[1].buf_p = &encoded_p[i];
+        segments[1].size = (size_t)(76 - i);
+        message_p = table_driven_foo_new(&workspace[0], sizeof(workspace));
+        ASSERT_NE(message_p, NULL);
+        ASSERT_EQ(table_driven_foo_decode_segments(message_p, &segments[0], 2),
+                  76);
+        ASSERT_EQ(message_p->v1, -1);
+        ASSERT_EQ(message_p->v4, 4.0);
+        ASSERT_EQ(message_p->v7_p, "7");
+        ASSERT_EQ(message_p->v11.length, 2);
+        ASSERT_EQ(message_p->v11.items_p[0], 11);
+        ASSERT_EQ(message_p->v11.items_p[1], -11);
+        ASSERT_EQ(message_p->v12.length, 2);
+        ASSERT_EQ(message_p->v12.items_pp[0], "a");
+        ASSERT_EQ(message_p->v12.items_pp[1], "");
+        ASSERT_EQ(message_p->v13.length, 2);
+        ASSERT_EQ(message_p->v13.items_p[0].v1, 13);
+        ASSERT_EQ(message_p->v13.items_p[1].v2_p, "b");
+        ASSERT_NE(message_p->v14_p, NULL);
+        ASSERT_EQ(message_p->v14_p->v3, 14);
+        ASSERT_EQ(message_p->v300, 300u);
+    }
+}
@@ -27,6 +27,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
@@ -40,6 +41,37 @@ static void assert_res(ssize_t res)
     }
 }
 
+/* Padded input must give the same result. The padding is allocated
+   exactly to catch reads after it. */
+static void test_padded(const uint8_t *encoded_p, size_t size, ssize_t res)
+{
+    uint8_t *padded_p;
+    uint8_t workspace[4096];
+    struct fuzzer_everything_t *decoded_p;
+
+    decoded_p = fuzzer_everything_new(&workspace[0], sizeof(workspace));
+
+    if (decoded_p == NULL) {
+        return;
+    }
+
+    padded_p = malloc(size + PBTOOLS_PADDING);
+
+    if (padded_p == NULL) {
+        return;
+    }
+
+    memcpy(padded_p, encoded_p, size);
+    memset(&padded_p[size], 0x80, PBTOOLS_PADDING);
+
+    if (fuzzer_everything_decode_padded(decoded_p, padded_p, size) != res) {
+        printf("Padded decode differs.\n");
+        __builtin_trap();
+    }
+
+    free(padded_p);
+}
+
 static void test(const uint8_t *encoded_p, size_t size)
 {
     ssize_t res;
@@ -55,6 +87,7 @@ static void test(const uint8_t *encoded_p, size_t size)
     }
 
     res = fuzzer_everything_decode(decoded_p, encoded_p, size);
+    test_padded(encoded_p, size, res);
 
     if (res >= 0) {
         res = fuzzer_everything_encode(decoded_p, &encoded[0], sizeof(encoded));
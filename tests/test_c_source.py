@@ -24,7 +24,11 @@ class CommandLineTest(unittest.TestCase):
 
         remove_files([filename_h, filename_c])
 
-        pbtools.c_source.generate_files([proto])
+        options = pbtools.c_source.Options(callbacks=True,
+                                           segmented_input=True,
+                                           columns=True,
+                                           views=True)
+        pbtools.c_source.generate_files([proto], options=options)
 
         for filename in [filename_h, filename_c]:
             self.assert_files_equal(filename,
@@ -19,7 +19,9 @@ class CommandLineTest(unittest.TestCase):
 
     def test_command_line_generate_c_source(self):
         specs = [
-            'address_book',
+            ('address_book',
+             [],
+             ['--callbacks', '--segmented-input', '--columns', '--views']),
             'benchmark',
             'bool',
             'bytes',
@@ -38,16 +40,18 @@ class CommandLineTest(unittest.TestCase):
             ('importing', ['.', 'imports']),
             ('no_package_importing', ['.', 'imports']),
             'no_package_imported',
-            'int32',
-            'int64',
+            ('int32', [], ['--padded-input']),
+            ('int64', [], ['--padded-input']),
             'message',
             'map',
             'no_package',
-            'oneof',
-            'optional_fields',
+            ('oneof', [], ['--views']),
+            ('optional_fields', [], ['--views']),
             'options',
             'ordering',
-            'repeated',
+            ('repeated',
+             [],
+             ['--caller-storage', '--segmented-input', '--views']),
             'scalar_value_types',
             'service',
             'sfixed32',
@@ -59,7 +63,8 @@ class CommandLineTest(unittest.TestCase):
             'uint32',
             'uint64',
             'field_names',
-            'add_and_remove_fields'
+            'add_and_remove_fields',
+            'lazy'
         ]
 
         for spec in specs:
@@ -70,6 +75,9 @@ class CommandLineTest(unittest.TestCase):
                 for include_path in spec[1]:
                     options += ['-I', f'tests/files/{include_path}']
 
+                if len(spec) == 3:
+                    options += spec[2]
+
                 spec = pbtools.parser.camel_to_snake_case(os.path.basename(spec[0]))
             else:
                 proto = f'tests/files/{spec}.proto'
@@ -98,6 +106,7 @@ class CommandLineTest(unittest.TestCase):
         argv = [
             'pbtools',
             'generate_c_source',
+            '--padded-input',
             'tests/files/int32.proto',
             'tests/files/int64.proto'
         ]
@@ -122,6 +131,7 @@ class CommandLineTest(unittest.TestCase):
         argv = [
             'pbtools',
             'generate_c_source',
+            '--padded-input',
             'tests/files/int32.proto'
         ]
 
@@ -250,3 +260,77 @@ class CommandLineTest(unittest.TestCase):
             self.assert_files_equal(
                 filename,
                 f'tests/files/c_source/enums_upper_case_{filename}')
+
+    def test_command_line_generate_c_source_table_driven(self):
+        spec = 'table_driven'
+        proto = f'tests/files/{spec}.proto'
+
+        argv = [
+            'pbtools',
+            'generate_c_source',
+            '--table-driven',
+            '--callbacks',
+            '--caller-storage',
+            '--segmented-input',
+            '--columns',
+            proto
+        ]
+
+        filename_h = f'{spec}.h'
+        filename_c = f'{spec}.c'
+
+        remove_files([filename_h, filename_c])
+
+        with patch('sys.argv', argv):
+            pbtools._main()
+
+        for filename in [filename_h, filename_c]:
+            self.assert_files_equal(filename,
+                                    f'tests/files/c_source/{filename}')
+
+    def test_command_line_generate_c_source_lazy_sub_messages(self):
+        spec = 'lazy'
+        proto = f'tests/files/{spec}.proto'
+
+        argv = [
+            'pbtools',
+            'generate_c_source',
+            '--lazy-sub-messages',
+            proto
+        ]
+
+        filename_h = f'{spec}.h'
+        filename_c = f'{spec}.c'
+
+        remove_files([filename_h, filename_c])
+
+        with patch('sys.argv', argv):
+            pbtools._main()
+
+        for filename in [filename_h, filename_c]:
+            self.assert_files_equal(
+                filename,
+                f'tests/files/c_source/lazy_sub_messages_{filename}')
+
+    def test_command_line_generate_c_source_zero_copy(self):
+        spec = 'zero_copy'
+        proto = f'tests/files/{spec}.proto'
+
+        argv = [
+            'pbtools',
+            'generate_c_source',
+            '--zero-copy',
+            proto
+        ]
+
+        filename_h = f'{spec}.h'
+        filename_c = f'{spec}.c'
+
+        remove_files([filename_h, filename_c])
+
+        with patch('sys.argv', argv):
+            pbtools._main()
+
+        for filename in [filename_h, filename_c]:
+            self.assert_files_equal(filename,
+                                    f'tests/files/c_source/{filename}')
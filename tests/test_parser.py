@@ -944,5 +944,14 @@ class ParserTest(unittest.TestCase):
         self.assertFalse(field.optional)
 
 
+    def test_lazy(self):
+        parsed = pbtools.parse_file('tests/files/lazy.proto')
+
+        message = parsed.messages[1]
+        self.assertEqual(message.name, 'Foo')
+        self.assertTrue(message.fields[0].lazy)
+        self.assertFalse(message.fields[1].lazy)
+
+
 if __name__ == '__main__':
     unittest.main()